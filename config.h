@@ -0,0 +1,155 @@
+/*
+ * This file is genereated by configure script
+ */
+#ifndef CONFIG_H
+#define CONFIG_H
+
+/*
+ * Portable Network Graphics Library
+ */
+#define HAVE_LIBPNG
+
+/*
+ * Simple Direct Media Layer
+ */
+//#define HAVE_LIBSDL
+
+/*
+ * Library to load, handle and manipulate images in the JPEG format
+ */
+#define HAVE_JPEG
+
+/*
+ * A lossy image compression format
+ */
+//#define HAVE_WEBP
+
+/*
+ * A HEIF file format.
+ */
+//#define HAVE_HEIF
+
+/*
+ * An open-source JPEG 2000 library
+ */
+//#define HAVE_OPENJPEG
+
+/*
+ * Library to handle, display and manipulate GIF images
+ */
+//#define HAVE_GIFLIB
+
+/*
+ * Tag Image File Format (TIFF) library
+ */
+//#define HAVE_TIFF
+
+/*
+ * Standard (de)compression library
+ */
+#define HAVE_ZLIB
+
+/*
+ * http://www.libarchive.org/
+ */
+//#define HAVE_LIBARCHIVE
+
+/*
+ * Xrandr library
+ */
+//#define HAVE_LIBXRANDR
+
+/*
+ * X11 library
+ */
+#define HAVE_LIBX11
+
+/*
+ * XCB library
+ */
+//#define HAVE_LIBXCB
+
+/*
+ * XCB errors library
+ */
+//#define HAVE_XCB_UTIL_ERRORS
+
+/*
+ * MIT-SHM X Extension
+ */
+#define HAVE_X_SHM
+
+/*
+ * Portable ascii art GFX library
+ */
+//#define HAVE_AALIB
+
+/*
+ * A high-quality and portable font engine
+ */
+#define HAVE_FREETYPE
+
+/*
+ * A library for configuring and customizing font access
+ */
+#define HAVE_FONTCONFIG
+
+/*
+ * Dynamic linker
+ */
+#define HAVE_DL
+
+/*
+ * Video for linux 2
+ */
+#define HAVE_V4L2
+
+/*
+ * Posix Threads
+ */
+#define HAVE_PTHREAD
+
+/*
+ * mmap() call
+ */
+#define HAVE_MMAP
+
+/*
+ * an UAPI drm/drm.h header
+ */
+//#define HAVE_DRM_DRM_H
+
+/*
+ * fallback for UAPI drm.h in libdrm/drm.h
+ */
+//#define HAVE_LIBDRM_DRM_H
+
+/*
+ * Keymap handling library for toolkits and window systems
+ */
+//#define HAVE_XKBCOMMON
+
+/*
+ * Wayland windowing system
+ */
+//#define HAVE_WAYLAND
+
+/*
+ * C stack trace writeout
+ */
+#define HAVE_BACKTRACE
+
+/* Version of the SDL library "1" or "2" */
+#define LIBSDL_VERSION 
+
+/* Shortcut for DRM */
+#if (defined(HAVE_DRM_DRM_H) || defined(HAVE_LIBDRM_DRM_H))
+# define HAVE_LINUX_DRM
+#endif
+
+/*
+ * OS to compile for
+ */
+#define OS_LINUX 1
+
+#endif /* CONFIG_H */
@@ -56,13 +56,9 @@ static void redraw(void)
 	gp_backend_flip(backend);
 }
 
-static void shm_update(gp_proxy_cli *self, struct gp_proxy_rect *rect)
+static void shm_blit(gp_pixmap *src, struct gp_proxy_rect *rect)
 {
 	gp_size screen_h = backend->pixmap->h;
-
-	if (self != cli_shown)
-		return;
-
 	gp_size w = rect->w;
 	gp_size h = rect->h;
 
@@ -75,13 +71,54 @@ static void shm_update(gp_proxy_cli *self, struct gp_proxy_rect *rect)
 	}
 
 	//TODO: Check SIZE!!!
-	gp_blit_xywh_clipped(&shm->pixmap, x, y, w, h, backend->pixmap, x, y);
+	gp_blit_xywh_clipped(src, x, y, w, h, backend->pixmap, x, y);
 
 	gp_backend_update_rect_xywh(backend, x, y, w, h);
+}
+
+static void shm_update(gp_proxy_cli *self, struct gp_proxy_rect *rect)
+{
+	if (self != cli_shown)
+		return;
+
+	shm_blit(&shm->pixmap, rect);
 
 	gp_proxy_cli_rect_updated(self, rect);
 }
 
+static void shm_update_rects(gp_proxy_cli *self, struct gp_proxy_rects *rects)
+{
+	uint32_t i;
+
+	if (self != cli_shown)
+		return;
+
+	for (i = 0; i < rects->cnt; i++)
+		shm_blit(&shm->pixmap, &rects->rects[i]);
+
+	gp_proxy_cli_rects_updated(self, rects);
+}
+
+static void shm_present(gp_proxy_cli *self, struct gp_proxy_present *present)
+{
+	uint32_t i;
+
+	if (self != cli_shown)
+		return;
+
+	if (present->buf >= shm->bufs.cnt) {
+		GP_WARN("Invalid buffer %u", present->buf);
+		return;
+	}
+
+	gp_pixmap src = gp_proxy_shm_pixmap(shm, present->buf);
+
+	for (i = 0; i < present->rects.cnt; i++)
+		shm_blit(&src, &present->rects.rects[i]);
+
+	gp_proxy_cli_present(self, present->buf);
+}
+
 static void do_exit(void)
 {
 	gp_backend_exit(backend);
@@ -100,6 +137,9 @@ static void on_unmap(gp_proxy_cli *self)
 
 		gp_proxy_cli_send(cli_shown, GP_PROXY_MAP, &shm->path);
 		gp_proxy_cli_send(cli_shown, GP_PROXY_PIXMAP, &shm->pixmap);
+		if (shm->bufs.cnt > 1)
+			gp_proxy_cli_send(cli_shown, GP_PROXY_BUFFERS, &shm->bufs);
+		cli_shown->presented = -1;
 		gp_proxy_cli_send(cli_shown, GP_PROXY_SHOW, NULL);
 	}
 }
@@ -258,6 +298,12 @@ static enum gp_poll_event_ret client_event(gp_fd *self)
 		case GP_PROXY_UPDATE:
 			shm_update(self->priv, &msg->rect.rect);
 		break;
+		case GP_PROXY_UPDATE_RECTS:
+			shm_update_rects(self->priv, &msg->rects.rects);
+		break;
+		case GP_PROXY_PRESENT:
+			shm_present(self->priv, &msg->present.present);
+		break;
 		case GP_PROXY_NAME:
 			if (!cli_shown)
 				redraw();
@@ -311,23 +357,40 @@ static void print_help(void)
 	printf("Ctrl + Esc .... Server exit\n");
 }
 
+static void print_usage(const char *name)
+{
+	printf("Usage: %s [-b backend] [-n buffers]\n\n", name);
+	printf("-b backend ... backend init string, -h for help\n");
+	printf("-n buffers ... number of shared memory buffers (1-%i), default 2\n",
+	       GP_PROXY_BUFS_MAX);
+}
+
 int main(int argc, char *argv[])
 {
 	const char *backend_opts = NULL;
+	unsigned int bufs = 2;
 	int opt;
 
 	print_help();
 
 	signal(SIGPIPE, SIG_IGN);
 
-	while ((opt = getopt(argc, argv, "b:h")) != -1) {
+	while ((opt = getopt(argc, argv, "b:hn:")) != -1) {
 	switch (opt) {
 		case 'b':
 			backend_opts = optarg;
 		break;
 		case 'h':
+			print_usage(argv[0]);
 			gp_backend_init_help();
 		break;
+		case 'n':
+			bufs = atoi(optarg);
+			if (!bufs || bufs > GP_PROXY_BUFS_MAX) {
+				print_usage(argv[0]);
+				return 1;
+			}
+		break;
 		default:
 			fprintf(stderr, "Invalid parameter '%c'", opt);
 		}
@@ -345,7 +408,8 @@ int main(int argc, char *argv[])
 	gp_size w = backend->pixmap->w;
 	gp_size h = backend->pixmap->h;
 
-	shm = gp_proxy_shm_init("/dev/shm/.proxy_backend", w, h, gp_backend_pixel_type(backend));
+	shm = gp_proxy_shm_bufs_init("/dev/shm/.proxy_backend", w, h,
+	                             gp_backend_pixel_type(backend), bufs);
 	if (!shm) {
 		gp_backend_exit(backend);
 		return 1;
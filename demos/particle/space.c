@@ -12,11 +12,14 @@ struct space *space_create(unsigned int particle_count, int min_w, int min_h,
                            int max_w, int max_h)
 {
 	struct space *new = malloc(sizeof(struct space) +
-	                           sizeof(struct particle) * particle_count);
+	                           sizeof(struct particle) * particle_count +
+	                           sizeof(gp_coord) * 2 * particle_count);
 
 	if (new == NULL)
 		return NULL;
 
+	new->xy = (gp_coord *)&new->particles[particle_count];
+
 	new->particle_count = particle_count;
 	new->min_w = min_w;
 	new->min_h = min_h;
@@ -55,6 +58,7 @@ void space_destroy(struct space *space)
 void space_draw_particles(gp_pixmap *pixmap, struct space *space)
 {
 	unsigned int i;
+	gp_coord *xy = space->xy;
 
 	gp_fill(pixmap, 0x000000);
 
@@ -64,9 +68,8 @@ void space_draw_particles(gp_pixmap *pixmap, struct space *space)
 		gp_coord x = space->particles[i].x;
 		gp_coord y = space->particles[i].y;
 
-		color = gp_rgb_to_pixmap_pixel(0xee, 0xee, 0xee, pixmap);
-
-		gp_putpixel(pixmap, x>>8, y>>8, color);
+		xy[2*i] = x>>8;
+		xy[2*i+1] = y>>8;
 
 		int val = SQUARE(space->particles[i].vx) + SQUARE(space->particles[i].vy);
 
@@ -79,6 +82,9 @@ void space_draw_particles(gp_pixmap *pixmap, struct space *space)
 
 		gp_circle(pixmap, x>>8, y>>8, 3, color);
 	}
+
+	gp_putpixels(pixmap, space->particle_count, xy,
+	             gp_rgb_to_pixmap_pixel(0xee, 0xee, 0xee, pixmap));
 }
 
 static void central_gravity(struct space *space, int time)
@@ -44,6 +44,9 @@ struct space {
 	/* particle mass */
 	int mass_kappa;
 
+	/* coordinates for gp_putpixels(), allocated after the particles */
+	gp_coord *xy;
+
 	struct particle particles[];
 };
 
@@ -0,0 +1,223 @@
+//SPDX-License-Identifier: LGPL-2.0-or-later
+
+/*
+
+   Copyright (c) 2024 Cyril Hrubis <metan@ucw.cz>
+
+ */
+
+/**
+ * @brief Virtual table widget example.
+ * @example table_virtual.c
+ *
+ * A table with ten million rows, sorting is done incrementally by a merge
+ * sort that runs in an application task.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <widgets/gp_widgets.h>
+
+#define TABLE_ROWS 10000000
+/* Number of elements merged in a single sort step */
+#define SORT_STEP 1000000
+
+enum tbl_ids {
+	ROW,
+	VALUE,
+};
+
+static uint32_t *perm, *tmp;
+
+static uint32_t row_value(uint32_t idx)
+{
+	idx ^= idx >> 16;
+	idx *= 0x7feb352d;
+	idx ^= idx >> 15;
+	idx *= 0x846ca68b;
+	idx ^= idx >> 16;
+
+	return idx % 1000000;
+}
+
+static int tbl_seek_row(gp_widget *self, int op, unsigned int pos)
+{
+	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(self);
+
+	switch (op) {
+	case GP_TABLE_ROW_RESET:
+		tbl_priv->row_idx = 0;
+	break;
+	case GP_TABLE_ROW_ADVANCE:
+		tbl_priv->row_idx += pos;
+	break;
+	case GP_TABLE_ROW_MAX:
+		return TABLE_ROWS;
+	}
+
+	if (tbl_priv->row_idx >= TABLE_ROWS)
+		return 0;
+
+	return 1;
+}
+
+static int tbl_get_cell(gp_widget *self, gp_widget_table_cell *cell, unsigned int col_id)
+{
+	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(self);
+	static char buf[32];
+	uint32_t idx = perm[tbl_priv->row_idx];
+
+	switch (col_id) {
+	case ROW:
+		snprintf(buf, sizeof(buf), "%u", idx);
+	break;
+	case VALUE:
+		snprintf(buf, sizeof(buf), "%u", row_value(idx));
+		cell->tattr = GP_TATTR_RIGHT;
+	break;
+	}
+
+	cell->text = buf;
+
+	return 1;
+}
+
+/* Resumable bottom-up merge sort state */
+static struct sort_state {
+	uint32_t width;
+	uint32_t lo, i, j, k;
+	unsigned int passes, pass;
+} st;
+
+static uint32_t sort_key(uint32_t idx, unsigned int col)
+{
+	return col == ROW ? idx : row_value(idx);
+}
+
+static int sort_before(uint32_t a, uint32_t b, unsigned int col, int desc)
+{
+	uint32_t ka = sort_key(a, col);
+	uint32_t kb = sort_key(b, col);
+
+	if (ka == kb)
+		return a <= b;
+
+	return desc ? ka > kb : ka < kb;
+}
+
+static void merge_start(void)
+{
+	st.i = st.lo;
+	st.k = st.lo;
+	st.j = GP_MIN(st.lo + st.width, (uint32_t)TABLE_ROWS);
+}
+
+static unsigned int tbl_sort_step(gp_widget *self, int desc, unsigned int col, int restart)
+{
+	unsigned int cnt = 0;
+
+	if (restart) {
+		st.width = 1;
+		st.lo = 0;
+		st.pass = 0;
+		st.passes = 0;
+		while ((1u<<st.passes) < TABLE_ROWS)
+			st.passes++;
+		merge_start();
+	}
+
+	while (cnt < SORT_STEP) {
+		uint32_t mid = GP_MIN(st.lo + st.width, (uint32_t)TABLE_ROWS);
+		uint32_t hi = GP_MIN(st.lo + 2 * st.width, (uint32_t)TABLE_ROWS);
+
+		for (; st.k < hi && cnt < SORT_STEP; st.k++, cnt++) {
+			if (st.i < mid && (st.j >= hi || sort_before(perm[st.i], perm[st.j], col, desc)))
+				tmp[st.k] = perm[st.i++];
+			else
+				tmp[st.k] = perm[st.j++];
+		}
+
+		if (st.k < hi)
+			break;
+
+		st.lo = hi;
+
+		if (st.lo >= TABLE_ROWS) {
+			uint32_t *swp = perm;
+
+			perm = tmp;
+			tmp = swp;
+
+			st.lo = 0;
+			st.width *= 2;
+			st.pass++;
+
+			if (st.pass >= st.passes)
+				break;
+		}
+
+		merge_start();
+	}
+
+	gp_widget_table_refresh(self);
+
+	if (st.pass >= st.passes)
+		return 100;
+
+	return (100llu * st.pass * TABLE_ROWS + 100llu * st.lo) / ((uint64_t)st.passes * TABLE_ROWS);
+}
+
+static gp_widget_table_col_ops table_col_ops = {
+	.seek_row = tbl_seek_row,
+	.get_cell = tbl_get_cell,
+	.sort_step = tbl_sort_step,
+	.col_map = {
+		{.id = "row", .idx = ROW, .sortable = 1},
+		{.id = "value", .idx = VALUE, .sortable = 1},
+		{}
+	}
+};
+
+static gp_widget_table_header table_header[] = {
+	{.col_desc = &table_col_ops.col_map[0], .label = "Row", .col_min_size = 8, .col_fill = 1},
+	{.col_desc = &table_col_ops.col_map[1], .label = "Value", .col_min_size = 6, .col_fill = 1},
+};
+
+gp_app_info app_info = {
+	.name = "Virtual Table Example",
+	.desc = "Table widget with ten million rows",
+	.version = "1.0",
+	.license = "GPL-2.0-or-later",
+	.url = "http://gfxprim.ucw.cz",
+	.authors = (gp_app_info_author []) {
+		{.name = "Cyril Hrubis", .email = "metan@ucw.cz", .years = "2024"},
+		{}
+	}
+};
+
+int main(int argc, char *argv[])
+{
+	uint32_t i;
+
+	perm = malloc(sizeof(*perm) * TABLE_ROWS);
+	tmp = malloc(sizeof(*tmp) * TABLE_ROWS);
+
+	if (!perm || !tmp) {
+		fprintf(stderr, "Malloc failed\n");
+		return 1;
+	}
+
+	for (i = 0; i < TABLE_ROWS; i++)
+		perm[i] = i;
+
+	gp_widget *table = gp_widget_table_new(2, 20, &table_col_ops, table_header);
+	if (!table)
+		return 1;
+
+	gp_widget_table_rows_set(table, TABLE_ROWS);
+
+	gp_widgets_main_loop(table, NULL, argc, argv);
+
+	return 0;
+}
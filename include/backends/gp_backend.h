@@ -32,6 +32,7 @@
 #include <utils/gp_timer.h>
 #include <utils/gp_list.h>
 #include <utils/gp_poll.h>
+#include <utils/gp_damage.h>
 
 #include <input/gp_ev_queue.h>
 #include <input/gp_task.h>
@@ -248,6 +249,20 @@ struct gp_backend {
 	                    gp_coord x0, gp_coord y0,
 	                    gp_coord x1, gp_coord y1);
 
+	/**
+	 * @brief Updates a set of display rectangles.
+	 *
+	 * Optional, backends that can push several rectangles to the display
+	 * at once, e.g. with a single flush or message, should implement this.
+	 * If not set gp_backend_update_rects() calls gp_backend::update_rect
+	 * for each rectangle.
+	 *
+	 * The rectangles are already transformed to the display coordinates
+	 * and clipped to the pixmap size.
+	 */
+	void (*update_rects)(gp_backend *self, const gp_bbox *rects,
+	                     unsigned int cnt);
+
 	/**
 	 * @brief Attribute change callback.
 	 *
@@ -326,6 +341,13 @@ struct gp_backend {
 	/** @brief Task queue */
 	gp_task_queue *tasks;
 
+	/**
+	 * @brief A queue for tasks and events posted from other threads.
+	 *
+	 * Allocated by gp_backend_post_init().
+	 */
+	struct gp_backend_post *post;
+
 	/**
 	 * @brief List of input drivers feeding the ev_queue
 	 *
@@ -347,6 +369,16 @@ struct gp_backend {
 	 */
 	unsigned int dpi;
 
+	/**
+	 * @brief Updates are presented on gp_backend_flip().
+	 *
+	 * Set by backends that render into a swapchain, e.g. the proxy backend
+	 * initialized with #GP_PROXY_INIT_SWAPCHAIN. For these the
+	 * gp_backend_update_rect() only records the damage and the frame is
+	 * shown on the display by gp_backend_flip().
+	 */
+	unsigned int flip_presents:1;
+
 	/* Backed private data */
 	char priv[] GP_ALIGNED;
 };
@@ -469,6 +501,30 @@ static inline void gp_backend_update_rect_xywh(gp_backend *self,
 	gp_backend_update_rect_xyxy(self, x, y, x + w - 1, y + h - 1);
 }
 
+/**
+ * @brief Copies a set of rectangles from backend pixmap to a display.
+ *
+ * The rectangles are usually produced by a gp_damage region. Backends that
+ * implement gp_backend::update_rects transfer all of them at once, otherwise
+ * each rectangle is updated separately.
+ *
+ * @param self A backend.
+ * @param rects An array of rectangles.
+ * @param cnt A number of rectangles in the array.
+ */
+void gp_backend_update_rects(gp_backend *self, const gp_bbox *rects, unsigned int cnt);
+
+/**
+ * @brief Copies a damage region from backend pixmap to a display.
+ *
+ * @param self A backend.
+ * @param damage A damage region.
+ */
+static inline void gp_backend_update_damage(gp_backend *self, const gp_damage *damage)
+{
+	gp_backend_update_rects(self, damage->rects, damage->cnt);
+}
+
 /**
  * @brief Copies data from backend buffer to display.
  *
@@ -978,6 +1034,47 @@ void gp_backend_task_rem(gp_backend *self, gp_task *task);
  */
 void gp_backend_task_queue_set(gp_backend *self, gp_task_queue *task_queue);
 
+/**
+ * @brief Initializes a queue for posting tasks and events from other threads.
+ *
+ * Creates an eventfd that is added to the gp_backend::fds so that the backend
+ * wakes up when a task or an event has been posted. Must be called from the
+ * main loop thread before any other thread posts anything.
+ *
+ * @param self A backend.
+ * @return Zero on success, non-zero otherwise.
+ */
+int gp_backend_post_init(gp_backend *self);
+
+/**
+ * @brief Posts a task from any thread.
+ *
+ * The task is inserted into the gp_backend::tasks by the main loop thread,
+ * the memory for the task is owned by the caller and must not be freed until
+ * the task is removed from the queue.
+ *
+ * This function is thread safe.
+ *
+ * @param self A backend.
+ * @param task A task to be inserted into the task queue.
+ * @return Zero on success, non-zero otherwise.
+ */
+int gp_backend_task_post(gp_backend *self, gp_task *task);
+
+/**
+ * @brief Posts an event from any thread.
+ *
+ * The event is copied and pushed into the gp_backend::event_queue by the main
+ * loop thread. Use #GP_EV_USR type for application defined events.
+ *
+ * This function is thread safe.
+ *
+ * @param self A backend.
+ * @param ev An event to be posted.
+ * @return Zero on success, non-zero otherwise.
+ */
+int gp_backend_ev_post(gp_backend *self, const gp_event *ev);
+
 /**
  * @brief Removes all events from the event queue.
  *
@@ -22,6 +22,38 @@
 
 #include <backends/gp_backend.h>
 
+/**
+ * @brief A proxy backend init flags.
+ */
+enum gp_proxy_init_flags {
+	/**
+	 * @brief Asynchronous screen updates.
+	 *
+	 * By default each update waits until the server has finished copying
+	 * the data from the shared memory. With this flag set updates are
+	 * queued, merged into a damage region and send without waiting for
+	 * the server. There is at most one update in flight, damage
+	 * accumulated in the meantime is send once the server replies.
+	 *
+	 * The server has to support #GP_PROXY_UPDATE_RECTS messages.
+	 */
+	GP_PROXY_INIT_ASYNC = 0x01,
+	/**
+	 * @brief Render into a swapchain.
+	 *
+	 * If the server provides more than one buffer the application
+	 * renders into a buffer that is not read by the server. The
+	 * gp_backend_update_rect() only records the damage, the frame is
+	 * presented by gp_backend_flip() or gp_backend_update() hence the
+	 * application has to call one of them once it finished a frame. The
+	 * gp_backend::flip_presents is set once the swapchain is active.
+	 *
+	 * Without this flag the application always renders into the first
+	 * buffer and updates the screen with each gp_backend_update_rect().
+	 */
+	GP_PROXY_INIT_SWAPCHAIN = 0x02,
+};
+
 /**
  * @brief Connects to a proxy backend.
  *
@@ -32,4 +64,16 @@
  */
 gp_backend *gp_proxy_init(const char *path, const char *name);
 
+/**
+ * @brief Connects to a proxy backend.
+ *
+ * Same as gp_proxy_init() but allows to pass init flags.
+ *
+ * @param path Path to an UNIX socket, pass NULL for default.
+ * @param name An application name.
+ * @param flags A bitwise combination of enum gp_proxy_init_flags.
+ */
+gp_backend *gp_proxy_init_ex(const char *path, const char *name,
+                             enum gp_proxy_init_flags flags);
+
 #endif /* GP_PROXY_H */
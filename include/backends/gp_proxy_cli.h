@@ -36,6 +36,13 @@ typedef struct gp_proxy_cli {
 
 	gp_dlist_head head;
 
+	/**
+	 * @brief A last buffer presented by #GP_PROXY_PRESENT.
+	 *
+	 * Set to -1 when the application does not own any buffer.
+	 */
+	int presented;
+
 	/** @brief Connection buffer. */
 	gp_proxy_buf buf;
 } gp_proxy_cli;
@@ -78,6 +85,10 @@ static inline void gp_proxy_cli_show(gp_proxy_cli *self, gp_proxy_shm *shm, gp_p
 	/* Map SHM and create pixmap */
 	gp_proxy_cli_send(self, GP_PROXY_MAP, &shm->path);
 	gp_proxy_cli_send(self, GP_PROXY_PIXMAP, &shm->pixmap);
+	/* Describe the swapchain */
+	if (shm->bufs.cnt > 1)
+		gp_proxy_cli_send(self, GP_PROXY_BUFFERS, &shm->bufs);
+	self->presented = -1;
 	/* Set the current cursor position */
 	gp_proxy_cli_send(self, GP_PROXY_CURSOR_POS, cur_pos);
 	/* And finally show the app */
@@ -101,6 +112,9 @@ static inline void gp_proxy_cli_hide(gp_proxy_cli *self)
 
 	gp_proxy_cli_send(self, GP_PROXY_HIDE, NULL);
 	gp_proxy_cli_send(self, GP_PROXY_UNMAP, NULL);
+
+	/* Buffers are implicitly released on hide */
+	self->presented = -1;
 }
 
 /**
@@ -130,6 +144,45 @@ static inline void gp_proxy_cli_rect_updated(gp_proxy_cli *self, struct gp_proxy
 	gp_proxy_cli_send(self, GP_PROXY_UPDATE, rect);
 }
 
+/**
+ * @brief Tells client that requested asynchronous update was finished.
+ *
+ * This is called by the proxy backend after it finished copying data from the
+ * shared buffer for a #GP_PROXY_UPDATE_RECTS request. Only the cookie is send
+ * back to the client.
+ *
+ * @param self A client (application).
+ * @param rects The rectangles from the update request.
+ */
+static inline void gp_proxy_cli_rects_updated(gp_proxy_cli *self, struct gp_proxy_rects *rects)
+{
+	struct gp_proxy_rects ack = {.cookie = rects->cookie};
+
+	gp_proxy_cli_send(self, GP_PROXY_UPDATE_RECTS, &ack);
+}
+
+/**
+ * @brief Marks a buffer as presented and releases the previous one.
+ *
+ * This is called by the proxy backend after it finished copying data from a
+ * buffer presented by a #GP_PROXY_PRESENT request. The buffer is kept by the
+ * server, so that it can be read again, until a different buffer is
+ * presented, at which point the previously presented buffer is released back
+ * to the application.
+ *
+ * @param self A client (application).
+ * @param buf A presented buffer index.
+ */
+static inline void gp_proxy_cli_present(gp_proxy_cli *self, uint32_t buf)
+{
+	uint32_t prev = self->presented;
+
+	if (self->presented >= 0 && prev != buf)
+		gp_proxy_cli_send(self, GP_PROXY_RELEASE, &prev);
+
+	self->presented = buf;
+}
+
 /**
  * @brief A function to fill the proxy client buffer.
  *
@@ -134,6 +134,55 @@ enum gp_proxy_msg_types {
 	 * @brief Sets cursor image or shows/hides cursor.
 	 */
 	GP_PROXY_CURSOR,
+	/**
+	 * @brief Application asks server to update a set of rects on screen.
+	 *
+	 * This is an asynchronous variant of the #GP_PROXY_UPDATE, the
+	 * application does not wait for the reply and continues rendering.
+	 *
+	 * The payload is the struct gp_proxy_rects. The server replies with
+	 * the same message type with the same cookie once it has finished
+	 * reading the shared memory, the rects in the reply are not used.
+	 */
+	GP_PROXY_UPDATE_RECTS,
+	/**
+	 * @brief Server describes buffers in the shared memory.
+	 *
+	 * Send by the server after #GP_PROXY_PIXMAP when the mapped shared
+	 * memory contains more than one buffer. Each buffer has the layout
+	 * described by the #GP_PROXY_PIXMAP message and they are placed
+	 * gp_proxy_bufs::stride bytes apart. If this message is not send the
+	 * shared memory contains a single buffer.
+	 *
+	 * Applications that do not use the swapchain ignore this message and
+	 * keep rendering into the first buffer using #GP_PROXY_UPDATE and
+	 * #GP_PROXY_UPDATE_RECTS messages.
+	 *
+	 * The payload is the struct gp_proxy_bufs.
+	 */
+	GP_PROXY_BUFFERS,
+	/**
+	 * @brief Application presents a buffer.
+	 *
+	 * Send by the application when it finished rendering into a buffer.
+	 * From this point the buffer belongs to the server, which keeps
+	 * reading it until another buffer is presented. Application must not
+	 * render into a presented buffer until it's released by a
+	 * #GP_PROXY_RELEASE message.
+	 *
+	 * The payload is the struct gp_proxy_present.
+	 */
+	GP_PROXY_PRESENT,
+	/**
+	 * @brief Server releases a buffer.
+	 *
+	 * Send by the server when it stops reading a presented buffer, which
+	 * happens when a different buffer has been presented. The buffers are
+	 * also implicitly released on #GP_PROXY_HIDE.
+	 *
+	 * The payload is an uint32_t buffer index.
+	 */
+	GP_PROXY_RELEASE,
 	/** @brief Last message type + 1. */
 	GP_PROXY_MAX,
 };
@@ -182,6 +231,75 @@ struct gp_proxy_rect {
 	uint32_t cookie;
 };
 
+/** @brief Maximal number of rectangles in struct gp_proxy_rects. */
+#define GP_PROXY_RECTS_MAX 8
+
+/**
+ * @brief A set of rectangles.
+ */
+struct gp_proxy_rects {
+	/**
+	 * @brief An update cookie.
+	 *
+	 * Written back to the application by the sever when the update has
+	 * been finished.
+	 */
+	uint32_t cookie;
+	/** @brief A number of valid rectangles. */
+	uint32_t cnt;
+	/** @brief The rectangles, cookies in these are not used. */
+	struct gp_proxy_rect rects[GP_PROXY_RECTS_MAX];
+};
+
+/**
+ * @brief Returns a size of the struct gp_proxy_rects payload.
+ *
+ * Only the valid rectangles are send over the connection.
+ *
+ * @param cnt A number of valid rectangles.
+ * @return A payload size in bytes.
+ */
+static inline size_t gp_proxy_rects_size(uint32_t cnt)
+{
+	return 2 * sizeof(uint32_t) + cnt * sizeof(struct gp_proxy_rect);
+}
+
+/** @brief Maximal number of buffers in the shared memory. */
+#define GP_PROXY_BUFS_MAX 4
+
+/**
+ * @brief A shared memory buffers description.
+ */
+struct gp_proxy_bufs {
+	/** @brief An offset between two consecutive buffers in bytes. */
+	uint64_t stride;
+	/** @brief A number of buffers. */
+	uint32_t cnt;
+	/** @brief Unused, set to zero. */
+	uint32_t reserved;
+};
+
+/**
+ * @brief A buffer present request.
+ */
+struct gp_proxy_present {
+	/** @brief An index of the presented buffer. */
+	uint32_t buf;
+	/** @brief Rectangles that changed since the last presented buffer. */
+	struct gp_proxy_rects rects;
+};
+
+/**
+ * @brief Returns a size of the struct gp_proxy_present payload.
+ *
+ * @param cnt A number of valid rectangles.
+ * @return A payload size in bytes.
+ */
+static inline size_t gp_proxy_present_size(uint32_t cnt)
+{
+	return sizeof(uint32_t) + gp_proxy_rects_size(cnt);
+}
+
 /**
  * @brief A mmap() request.
  *
@@ -225,6 +343,57 @@ struct gp_proxy_rect_msg {
 	struct gp_proxy_rect rect;
 };
 
+/**
+ * @brief A multiple rectangles update request.
+ *
+ * Send by the application to request asynchronous update from the SHM memory
+ * to the screen.
+ */
+struct gp_proxy_rects_msg {
+	/** @brief Event type is set to GP_PROXY_UPDATE_RECTS. */
+	uint32_t type;
+	/** @brief Size is set to header size + gp_proxy_rects_size(cnt). */
+	uint32_t size;
+	/** @brief The rectangles payload. */
+	struct gp_proxy_rects rects;
+};
+
+/**
+ * @brief A shared memory buffers description message.
+ */
+struct gp_proxy_bufs_msg {
+	/** @brief Event type is set to GP_PROXY_BUFFERS. */
+	uint32_t type;
+	/** @brief Size is set to header size + sizeof(struct gp_proxy_bufs). */
+	uint32_t size;
+	/** @brief The buffers payload. */
+	struct gp_proxy_bufs bufs;
+};
+
+/**
+ * @brief A buffer present message.
+ */
+struct gp_proxy_present_msg {
+	/** @brief Event type is set to GP_PROXY_PRESENT. */
+	uint32_t type;
+	/** @brief Size is set to header size + gp_proxy_present_size(cnt). */
+	uint32_t size;
+	/** @brief The present payload. */
+	struct gp_proxy_present present;
+};
+
+/**
+ * @brief A buffer release message.
+ */
+struct gp_proxy_release_msg {
+	/** @brief Event type is set to GP_PROXY_RELEASE. */
+	uint32_t type;
+	/** @brief Size is set to header size + sizeof(uint32_t). */
+	uint32_t size;
+	/** @brief The released buffer index. */
+	uint32_t buf;
+};
+
 /**
  * @brief An initial infromation send to a client (application).
  *
@@ -297,6 +466,10 @@ typedef union gp_proxy_msg {
 	struct gp_proxy_map_msg map;
 	struct gp_proxy_pixmap_msg pix;
 	struct gp_proxy_rect_msg rect;
+	struct gp_proxy_rects_msg rects;
+	struct gp_proxy_bufs_msg bufs;
+	struct gp_proxy_present_msg present;
+	struct gp_proxy_release_msg release;
 	struct gp_proxy_cli_init_msg cli_init;
 	struct gp_proxy_cursor_msg cursor;
 	struct gp_proxy_cursor_pos_msg cursor_pos;
@@ -307,7 +480,7 @@ typedef union gp_proxy_msg {
  *
  * Must be bigger than maximal message size!
  */
-#define GP_PROXY_BUF_SIZE 128
+#define GP_PROXY_BUF_SIZE 256
 
 /** @brief A proxy message buffer. */
 typedef struct gp_proxy_buf {
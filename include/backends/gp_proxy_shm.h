@@ -23,12 +23,31 @@ typedef struct gp_proxy_shm {
 	int fd;
 	/** @brief A SHM segment size. */
 	size_t size;
-	/** @brief A pixmap with the SHM segment as a pixels. */
+	/** @brief A pixmap with the first SHM buffer as a pixels. */
 	gp_pixmap pixmap;
 	/** @brief A path to the SHM segment. */
 	struct gp_proxy_path path;
+	/** @brief A number of buffers and offset between them. */
+	struct gp_proxy_bufs bufs;
 } gp_proxy_shm;
 
+/**
+ * @brief Returns a pixmap for a SHM buffer.
+ *
+ * @param self A SHM pixmap.
+ * @param buf A buffer index, must be smaller than gp_proxy_shm::bufs::cnt.
+ *
+ * @return A pixmap with the buffer as a pixels.
+ */
+static inline gp_pixmap gp_proxy_shm_pixmap(gp_proxy_shm *self, unsigned int buf)
+{
+	gp_pixmap ret = self->pixmap;
+
+	ret.pixels += buf * self->bufs.stride;
+
+	return ret;
+}
+
 /**
  * @brief Creates an SHM pixmap.
  *
@@ -44,6 +63,25 @@ typedef struct gp_proxy_shm {
  */
 gp_proxy_shm *gp_proxy_shm_init(const char *path, gp_size w, gp_size h, gp_pixel_type type);
 
+/**
+ * @brief Creates an SHM pixmap with several buffers.
+ *
+ * Same as gp_proxy_shm_init() but allocates bufs buffers in the SHM segment,
+ * each of them rounded to PAGE_SIZE. Having more than one buffer allows the
+ * application to render while the server reads the previously presented
+ * buffer.
+ *
+ * @param path in the /dev/shm/ filesystem, 64 bytes at max.
+ * @param w Image width.
+ * @param h Image height.
+ * @param type Image pixel type.
+ * @param bufs A number of buffers, at most GP_PROXY_BUFS_MAX.
+ *
+ * @return Newly created SHM pixmap.
+ */
+gp_proxy_shm *gp_proxy_shm_bufs_init(const char *path, gp_size w, gp_size h,
+                                     gp_pixel_type type, unsigned int bufs);
+
 /**
  * @brief Resizes a SHM pixmap.
  *
@@ -25,6 +25,11 @@ typedef struct gp_filter_tables {
 
 /*
  * Generic point filter, applies corresponding table on bitmap.
+ *
+ * The work is split into horizontal stripes and distributed between threads,
+ * see gp_nr_threads(). In-place operation with the same source and
+ * destination offsets runs threaded as well, overlapping in-place rectangles
+ * are processed in a single thread.
  */
 int gp_filter_tables_apply(const gp_pixmap *const src,
                            gp_coord x_src, gp_coord y_src,
@@ -39,6 +44,11 @@ int gp_filter_tables_apply(const gp_pixmap *const src,
  */
 int gp_filter_tables_init(gp_filter_tables *self, const gp_pixmap *pixmap);
 
+/*
+ * Allocates and initializes tables for a pixel type.
+ */
+int gp_filter_tables_init_type(gp_filter_tables *self, gp_pixel_type pixel_type);
+
 /*
  * Allocates and initializes table structure and tables.
  */
@@ -1,6 +1,11 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 /*
- * Copyright (C) 2009-2013 Cyril Hrubis <metan@ucw.cz>
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/**
+ * @file gp_edge_detection.h
+ * @brief Edge detection filters.
  */
 
 #ifndef FILTERS_GP_EDGE_DETECTION_H
@@ -8,13 +13,113 @@
 
 #include <filters/gp_filter.h>
 
+/**
+ * @brief A gradient operator.
+ */
+enum gp_edge_op {
+	/** @brief A 3x3 Sobel operator, the center row and column weighted by 2. */
+	GP_EDGE_SOBEL,
+	/** @brief A 3x3 Prewitt operator. */
+	GP_EDGE_PREWITT,
+};
+
+/**
+ * @brief Single pass edge detection.
+ *
+ * Computes the gradient from the 3x3 neighbourhood of each pixel and writes
+ * the gradient magnitude and optionally the direction of each channel. The
+ * pixels outside of the source are clamped to the nearest edge pixel.
+ *
+ * The magnitude is clamped to the channel maximum. The direction is an angle
+ * in the [-pi, pi] interval mapped to [0, channel maximum], it's set to zero
+ * if the gradient is zero in either of the directions.
+ *
+ * @param src A source pixmap.
+ * @param E A destination for the magnitude, may be NULL. The pixmap has to
+ *          have the same pixel type and at least the size of the source.
+ * @param Phi A destination for the direction, may be NULL. The pixmap has to
+ *            have the same pixel type and at least the size of the source.
+ * @param op A gradient operator.
+ * @param callback An optional progress callback.
+ *
+ * @return Zero on success, non-zero on failure or if aborted by the callback.
+ */
+int gp_filter_edge(const gp_pixmap *src, gp_pixmap *E, gp_pixmap *Phi,
+                   enum gp_edge_op op, gp_progress_cb *callback);
+
+/**
+ * @brief Sobel edge detection.
+ *
+ * Allocates and computes the magnitude and direction pixmaps, see
+ * gp_filter_edge().
+ *
+ * @param src A source pixmap.
+ * @param E A pointer to store the magnitude pixmap to, may be NULL.
+ * @param Phi A pointer to store the direction pixmap to, may be NULL.
+ * @param callback An optional progress callback.
+ *
+ * @return Zero on success, non-zero on failure or if aborted by the callback.
+ */
 int gp_filter_edge_sobel(const gp_pixmap *src,
                          gp_pixmap **E, gp_pixmap **Phi,
                          gp_progress_cb *callback);
 
+/**
+ * @brief Prewitt edge detection.
+ *
+ * Allocates and computes the magnitude and direction pixmaps, see
+ * gp_filter_edge().
+ *
+ * @param src A source pixmap.
+ * @param E A pointer to store the magnitude pixmap to, may be NULL.
+ * @param Phi A pointer to store the direction pixmap to, may be NULL.
+ * @param callback An optional progress callback.
+ *
+ * @return Zero on success, non-zero on failure or if aborted by the callback.
+ */
 int gp_filter_edge_prewitt(const gp_pixmap *src,
                            gp_pixmap **E, gp_pixmap **Phi,
                            gp_progress_cb *callback);
 
+/**
+ * @brief Canny edge detector.
+ *
+ * The source is converted into grayscale, then the gradient is computed in a
+ * single pass, thinned by non-maximum suppression and the edges are traced by
+ * hysteresis. Pixels with magnitude above the high threshold are edges, and
+ * so are pixels above the low threshold connected to an edge.
+ *
+ * The source is not smoothed, noisy images should be blurred first, e.g. by
+ * gp_filter_gaussian_blur().
+ *
+ * @param src A source pixmap.
+ * @param dst A destination G8 pixmap, at least as large as the source. Edges
+ *            are set to 255, the rest to 0.
+ * @param op A gradient operator.
+ * @param low A low threshold as a fraction of the maximal magnitude in [0, 1].
+ * @param high A high threshold as a fraction of the maximal magnitude in [0, 1].
+ * @param callback An optional progress callback.
+ *
+ * @return Zero on success, non-zero on failure or if aborted by the callback.
+ */
+int gp_filter_edge_canny(const gp_pixmap *src, gp_pixmap *dst,
+                         enum gp_edge_op op, float low, float high,
+                         gp_progress_cb *callback);
+
+/**
+ * @brief Canny edge detector, allocates the result.
+ *
+ * @param src A source pixmap.
+ * @param op A gradient operator.
+ * @param low A low threshold as a fraction of the maximal magnitude in [0, 1].
+ * @param high A high threshold as a fraction of the maximal magnitude in [0, 1].
+ * @param callback An optional progress callback.
+ *
+ * @return A newly allocated G8 pixmap or NULL on failure.
+ */
+gp_pixmap *gp_filter_edge_canny_alloc(const gp_pixmap *src,
+                                      enum gp_edge_op op,
+                                      float low, float high,
+                                      gp_progress_cb *callback);
 
 #endif /* FILTERS_GP_EDGE_DETECTION_H */
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/**
+ * @file gp_filter_graph.h
+ * @brief A lazily evaluated filter pipeline.
+ *
+ * Filters are first added into the graph and executed only when the graph is
+ * run. Chaining the filters one after another allocates a full intermediate
+ * pixmap for each step, while the graph avoids most of them:
+ *
+ * - Consecutive point filters are composed into a single point filter chain
+ *   and fused into the neighbouring stencil filter so that they run on the
+ *   same rows while they are still in the cache.
+ * - Stencil filters, e.g. blur or median, are processed in row strips with a
+ *   halo as large as the sum of the kernel radii, the intermediate results
+ *   live only in per thread strip buffers. The strips run in parallel.
+ * - Filters that need the whole image, i.e. resize and dithering, split the
+ *   graph into segments, only their inputs and outputs are materialized.
+ *
+ * @code
+ * gp_filter_graph graph;
+ *
+ * gp_filter_graph_init(&graph);
+ *
+ * gp_filter_graph_resize(&graph, 800, 600, GP_INTERP_LINEAR_LF_INT);
+ * gp_filter_graph_gaussian_blur(&graph, 1, 1);
+ * gp_filter_graph_brightness(&graph, 0.1);
+ * gp_filter_graph_dither(&graph, GP_DITHER_FLOYD_STEINBERG, GP_PIXEL_G1);
+ *
+ * res = gp_filter_graph_run(&graph, img, NULL);
+ *
+ * gp_filter_graph_exit(&graph);
+ * @endcode
+ */
+
+#ifndef FILTERS_GP_FILTER_GRAPH_H
+#define FILTERS_GP_FILTER_GRAPH_H
+
+#include <filters/gp_filter.h>
+#include <filters/gp_resize.h>
+#include <filters/gp_dither.gen.h>
+#include <filters/gp_tiled.h>
+
+struct gp_filter_graph_node;
+
+/**
+ * @brief A filter graph.
+ */
+typedef struct gp_filter_graph {
+	/** @brief A number of nodes. */
+	unsigned int node_cnt;
+	/** @brief A size of the nodes array. */
+	unsigned int node_size;
+	/** @brief The nodes in the order they are applied. */
+	struct gp_filter_graph_node *nodes;
+	/** @brief A strip height, 0 for default. */
+	gp_size strip_h;
+} gp_filter_graph;
+
+/**
+ * @brief Initializes an empty filter graph.
+ *
+ * @param self A filter graph.
+ */
+void gp_filter_graph_init(gp_filter_graph *self);
+
+/**
+ * @brief Frees the filter graph nodes.
+ *
+ * @param self A filter graph.
+ */
+void gp_filter_graph_exit(gp_filter_graph *self);
+
+/**
+ * @brief Adds a brightness filter.
+ *
+ * @param self A filter graph.
+ * @param p A brightness, see gp_filter_brightness().
+ *
+ * @return Zero on success, non-zero on allocation failure.
+ */
+int gp_filter_graph_brightness(gp_filter_graph *self, float p);
+
+/**
+ * @brief Adds a contrast filter.
+ *
+ * @param self A filter graph.
+ * @param p A contrast, see gp_filter_contrast().
+ *
+ * @return Zero on success, non-zero on allocation failure.
+ */
+int gp_filter_graph_contrast(gp_filter_graph *self, float p);
+
+/**
+ * @brief Adds a brightness and contrast filter.
+ *
+ * @param self A filter graph.
+ * @param b A brightness, see gp_filter_brightness_contrast().
+ * @param c A contrast, see gp_filter_brightness_contrast().
+ *
+ * @return Zero on success, non-zero on allocation failure.
+ */
+int gp_filter_graph_brightness_contrast(gp_filter_graph *self, float b, float c);
+
+/**
+ * @brief Adds a posterize filter.
+ *
+ * @param self A filter graph.
+ * @param steps A number of steps, see gp_filter_posterize().
+ *
+ * @return Zero on success, non-zero on allocation failure.
+ */
+int gp_filter_graph_posterize(gp_filter_graph *self, unsigned int steps);
+
+/**
+ * @brief Adds an invert filter.
+ *
+ * @param self A filter graph.
+ *
+ * @return Zero on success, non-zero on allocation failure.
+ */
+int gp_filter_graph_invert(gp_filter_graph *self);
+
+/**
+ * @brief Adds a stencil filter.
+ *
+ * @param self A filter graph.
+ * @param filter A tiled filter, the structure is copied into the graph.
+ *
+ * @return Zero on success, non-zero on allocation failure.
+ */
+int gp_filter_graph_stencil(gp_filter_graph *self, const gp_tiled_filter *filter);
+
+/**
+ * @brief Adds a gaussian blur.
+ *
+ * @param self A filter graph.
+ * @param x_sigma A sigma in x direction.
+ * @param y_sigma A sigma in y direction.
+ *
+ * @return Zero on success, non-zero on allocation failure.
+ */
+int gp_filter_graph_gaussian_blur(gp_filter_graph *self,
+                                  float x_sigma, float y_sigma);
+
+/**
+ * @brief Adds a median filter.
+ *
+ * @param self A filter graph.
+ * @param xmed A median radius in x direction.
+ * @param ymed A median radius in y direction.
+ *
+ * @return Zero on success, non-zero on allocation failure.
+ */
+int gp_filter_graph_median(gp_filter_graph *self, int xmed, int ymed);
+
+/**
+ * @brief Adds a resize.
+ *
+ * @param self A filter graph.
+ * @param w A new width.
+ * @param h A new height.
+ * @param interp An interpolation type.
+ *
+ * @return Zero on success, non-zero on allocation failure.
+ */
+int gp_filter_graph_resize(gp_filter_graph *self, gp_size w, gp_size h,
+                           gp_interpolation_type interp);
+
+/**
+ * @brief Adds a dithering.
+ *
+ * @param self A filter graph.
+ * @param type A dithering type.
+ * @param pixel_type A pixel type to dither to.
+ *
+ * @return Zero on success, non-zero on allocation failure.
+ */
+int gp_filter_graph_dither(gp_filter_graph *self, gp_dither_type type,
+                           gp_pixel_type pixel_type);
+
+/**
+ * @brief Runs the graph on a pixmap.
+ *
+ * @param self A filter graph.
+ * @param src A source pixmap.
+ * @param callback An optional progress callback.
+ *
+ * @return A newly allocated pixmap or NULL on failure.
+ */
+gp_pixmap *gp_filter_graph_run(const gp_filter_graph *self, const gp_pixmap *src,
+                               gp_progress_cb *callback);
+
+#endif /* FILTERS_GP_FILTER_GRAPH_H */
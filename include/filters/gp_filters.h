@@ -23,6 +23,9 @@
 
 /* Histograms, ... */
 #include <filters/gp_stats.h>
+#include <filters/gp_integral_image.h>
+#include <filters/gp_tiled.h>
+#include <filters/gp_filter_graph.h>
 
 /* Image rotations (90 180 270 grads) and mirroring */
 #include <filters/gp_rotate.h>
@@ -0,0 +1,272 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/**
+ * @file gp_integral_image.h
+ * @brief Integral image, also known as summed-area table.
+ *
+ * Each entry of the table is a sum of all pixel channel values above and to
+ * the left of it. Once the table is computed a sum, mean or variance over any
+ * rectangle can be queried in constant time by looking up four table entries,
+ * regardless of the rectangle size.
+ *
+ * @code
+ * gp_integral_image *ii;
+ *
+ * ii = gp_filter_integral_image_alloc(img, GP_INTEGRAL_SQUARES, NULL);
+ * if (!ii)
+ *	return 1;
+ *
+ * // Local mean and variance in a 7x7 window centered at x, y
+ * float mean = gp_integral_image_mean(ii, 0, x - 3, y - 3, 7, 7);
+ * float var = gp_integral_image_variance(ii, 0, x - 3, y - 3, 7, 7);
+ *
+ * gp_integral_image_free(ii);
+ * @endcode
+ */
+
+#ifndef FILTERS_GP_INTEGRAL_IMAGE_H
+#define FILTERS_GP_INTEGRAL_IMAGE_H
+
+#include <filters/gp_filter.h>
+
+/**
+ * @brief Integral image flags.
+ */
+enum gp_integral_flags {
+	/** @brief Computes sums of squared values as well, needed for variance. */
+	GP_INTEGRAL_SQUARES = 0x01,
+	/** @brief Forces 64-bit accumulators even if 32-bit would be enough. */
+	GP_INTEGRAL_WIDE = 0x02,
+};
+
+/**
+ * @brief An integral image.
+ *
+ * The tables are (w + 1) x (h + 1) entries large, the first row and column
+ * are zeroed so that the queries does not have to special case the image
+ * edges. Entry at x + 1, y + 1 is the sum of the rectangle from 0, 0 to x, y
+ * inclusive.
+ */
+typedef struct gp_integral_image {
+	/** @brief A pixel type the image was allocated for. */
+	gp_pixel_type pixel_type;
+	/** @brief Image width. */
+	gp_size w;
+	/** @brief Image height. */
+	gp_size h;
+	/** @brief A number of channels. */
+	uint8_t chan_cnt;
+	/** @brief Set if sums are 64-bit wide. */
+	uint8_t wide;
+	/** @brief Per channel tables of sums. */
+	union {
+		uint32_t *sum32[GP_PIXEL_CHANS_MAX];
+		uint64_t *sum64[GP_PIXEL_CHANS_MAX];
+	};
+	/** @brief Per channel tables of squared sums, NULL if not requested. */
+	uint64_t *sq_sum[GP_PIXEL_CHANS_MAX];
+} gp_integral_image;
+
+/**
+ * @brief Allocates an integral image.
+ *
+ * The accumulators are 32-bit if a sum of the whole image cannot overflow, 64
+ * bit otherwise. The squared sums are always 64-bit.
+ *
+ * @param pixel_type A pixel type, palette types are not supported.
+ * @param w An image width.
+ * @param h An image height.
+ * @param flags A bitwise or of enum gp_integral_flags.
+ *
+ * @return A newly allocated integral image or NULL on failure.
+ */
+gp_integral_image *gp_integral_image_alloc(gp_pixel_type pixel_type,
+                                           gp_size w, gp_size h, int flags);
+
+/**
+ * @brief Frees an integral image.
+ *
+ * @param self An integral image.
+ */
+void gp_integral_image_free(gp_integral_image *self);
+
+/**
+ * @brief Computes an integral image.
+ *
+ * The rows are summed first and then the columns are accumulated, both
+ * passes run in threads.
+ *
+ * @param self An integral image, pixel type and size must match the source.
+ * @param src A source pixmap.
+ * @param callback An optional progress callback.
+ *
+ * @return Zero on success, non-zero on failure or if aborted by the callback.
+ */
+int gp_filter_integral_image(gp_integral_image *self, const gp_pixmap *src,
+                             gp_progress_cb *callback);
+
+/**
+ * @brief Allocates and computes an integral image.
+ *
+ * @param src A source pixmap.
+ * @param flags A bitwise or of enum gp_integral_flags.
+ * @param callback An optional progress callback.
+ *
+ * @return A newly allocated integral image or NULL on failure.
+ */
+gp_integral_image *gp_filter_integral_image_alloc(const gp_pixmap *src, int flags,
+                                                  gp_progress_cb *callback);
+
+/**
+ * @brief Clips a rectangle to the integral image size.
+ *
+ * @return A number of pixels in the clipped rectangle.
+ */
+static inline uint32_t gp_integral_image_clip(const gp_integral_image *self,
+                                              gp_coord *x, gp_coord *y,
+                                              gp_size *w, gp_size *h)
+{
+	gp_coord x1 = GP_MIN(*x + (gp_coord)*w, (gp_coord)self->w);
+	gp_coord y1 = GP_MIN(*y + (gp_coord)*h, (gp_coord)self->h);
+
+	*x = GP_MAX(*x, 0);
+	*y = GP_MAX(*y, 0);
+
+	if (x1 <= *x || y1 <= *y) {
+		*w = *h = 0;
+		return 0;
+	}
+
+	*w = x1 - *x;
+	*h = y1 - *y;
+
+	return *w * *h;
+}
+
+#define GP_INTEGRAL_RECT(table, stride, x, y, w, h) \
+	((table)[((y) + (h)) * (stride) + (x) + (w)] - \
+	 (table)[((y) + (h)) * (stride) + (x)] - \
+	 (table)[(y) * (stride) + (x) + (w)] + \
+	 (table)[(y) * (stride) + (x)])
+
+/**
+ * @brief Returns a sum of channel values in a rectangle.
+ *
+ * The rectangle is clipped to the image size.
+ *
+ * @param self An integral image.
+ * @param chan A channel index.
+ * @param x A rectangle x offset.
+ * @param y A rectangle y offset.
+ * @param w A rectangle width.
+ * @param h A rectangle height.
+ *
+ * @return A sum of channel values.
+ */
+static inline uint64_t gp_integral_image_sum(const gp_integral_image *self,
+                                             unsigned int chan,
+                                             gp_coord x, gp_coord y,
+                                             gp_size w, gp_size h)
+{
+	size_t stride = self->w + 1;
+
+	if (!gp_integral_image_clip(self, &x, &y, &w, &h))
+		return 0;
+
+	if (self->wide)
+		return GP_INTEGRAL_RECT(self->sum64[chan], stride, x, y, w, h);
+
+	/* Wraps around in the intermediate results but the result is correct */
+	return (uint32_t)GP_INTEGRAL_RECT(self->sum32[chan], stride, x, y, w, h);
+}
+
+/**
+ * @brief Returns a sum of squared channel values in a rectangle.
+ *
+ * The image has to be allocated with GP_INTEGRAL_SQUARES.
+ *
+ * @param self An integral image.
+ * @param chan A channel index.
+ * @param x A rectangle x offset.
+ * @param y A rectangle y offset.
+ * @param w A rectangle width.
+ * @param h A rectangle height.
+ *
+ * @return A sum of squared channel values.
+ */
+static inline uint64_t gp_integral_image_sq_sum(const gp_integral_image *self,
+                                                unsigned int chan,
+                                                gp_coord x, gp_coord y,
+                                                gp_size w, gp_size h)
+{
+	size_t stride = self->w + 1;
+
+	if (!gp_integral_image_clip(self, &x, &y, &w, &h))
+		return 0;
+
+	return GP_INTEGRAL_RECT(self->sq_sum[chan], stride, x, y, w, h);
+}
+
+/**
+ * @brief Returns a mean of channel values in a rectangle.
+ *
+ * The rectangle is clipped to the image size, the mean is computed from the
+ * pixels inside of the image.
+ *
+ * @param self An integral image.
+ * @param chan A channel index.
+ * @param x A rectangle x offset.
+ * @param y A rectangle y offset.
+ * @param w A rectangle width.
+ * @param h A rectangle height.
+ *
+ * @return A mean value or 0 if the rectangle is outside of the image.
+ */
+static inline float gp_integral_image_mean(const gp_integral_image *self,
+                                           unsigned int chan,
+                                           gp_coord x, gp_coord y,
+                                           gp_size w, gp_size h)
+{
+	uint32_t cnt = gp_integral_image_clip(self, &x, &y, &w, &h);
+
+	if (!cnt)
+		return 0;
+
+	return (double)gp_integral_image_sum(self, chan, x, y, w, h) / cnt;
+}
+
+/**
+ * @brief Returns a variance of channel values in a rectangle.
+ *
+ * The image has to be allocated with GP_INTEGRAL_SQUARES.
+ *
+ * @param self An integral image.
+ * @param chan A channel index.
+ * @param x A rectangle x offset.
+ * @param y A rectangle y offset.
+ * @param w A rectangle width.
+ * @param h A rectangle height.
+ *
+ * @return A population variance or 0 if the rectangle is outside of the image.
+ */
+static inline float gp_integral_image_variance(const gp_integral_image *self,
+                                               unsigned int chan,
+                                               gp_coord x, gp_coord y,
+                                               gp_size w, gp_size h)
+{
+	uint32_t cnt = gp_integral_image_clip(self, &x, &y, &w, &h);
+	double mean, var;
+
+	if (!cnt)
+		return 0;
+
+	mean = (double)gp_integral_image_sum(self, chan, x, y, w, h) / cnt;
+	var = (double)gp_integral_image_sq_sum(self, chan, x, y, w, h) / cnt - mean * mean;
+
+	return var < 0 ? 0 : var;
+}
+
+#endif /* FILTERS_GP_INTEGRAL_IMAGE_H */
@@ -5,10 +5,13 @@
  * Copyright (C) 2018 Cyril Hrubis <metan@ucw.cz>
  */
 #include <filters/gp_filter.h>
+#include <filters/gp_point_chain.h>
 
 @ def filter(name, args, params):
 /*** Function prototypes for {{name}} filter ***/
 
+void gp_point_chain_{{name}}(gp_point_chain *self{{maybe_opts_l(args)}});
+
 int gp_filter_{{name}}_ex(const gp_pixmap *src,
                           gp_coord x_src, gp_coord y_src,
 			  gp_size w_src, gp_size h_src,
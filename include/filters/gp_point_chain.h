@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/**
+ * @file gp_point_chain.h
+ * @brief A chain of point filters applied in a single pass.
+ *
+ * Each point filter, e.g. brightness or contrast, is a per-channel lookup
+ * table. Applying several of them one after another reads and writes the
+ * whole image for each filter, while the chain composes the tables first and
+ * then applies the result in a single pass over the image.
+ *
+ * The result is exactly the same as if the filters were applied one after
+ * another.
+ *
+ * @code
+ * gp_point_chain chain;
+ *
+ * if (gp_point_chain_init(&chain, img->pixel_type))
+ *	return 1;
+ *
+ * gp_point_chain_brightness(&chain, 0.1);
+ * gp_point_chain_contrast(&chain, 1.2);
+ * gp_point_chain_invert(&chain);
+ *
+ * gp_point_chain_apply(img, img, &chain, NULL);
+ *
+ * gp_point_chain_exit(&chain);
+ * @endcode
+ *
+ * The functions that add filters into the chain are generated and declared in
+ * gp_point.gen.h along with the filters they correspond to.
+ */
+
+#ifndef FILTERS_GP_POINT_CHAIN_H
+#define FILTERS_GP_POINT_CHAIN_H
+
+#include <core/gp_gamma_correction.h>
+#include <filters/gp_filter.h>
+#include <filters/gp_apply_tables.h>
+
+/**
+ * @brief A point filter chain.
+ */
+typedef struct gp_point_chain {
+	/** @brief Composed per-channel tables. */
+	gp_filter_tables tables;
+	/** @brief A pixel type the chain was built for. */
+	gp_pixel_type pixel_type;
+} gp_point_chain;
+
+/**
+ * @brief Initializes an empty chain.
+ *
+ * @param self A point filter chain.
+ * @param pixel_type A pixel type the chain is going to be applied on.
+ *
+ * @return Zero on success, non-zero on allocation failure.
+ */
+int gp_point_chain_init(gp_point_chain *self, gp_pixel_type pixel_type);
+
+/**
+ * @brief Frees the chain tables.
+ *
+ * @param self A point filter chain.
+ */
+void gp_point_chain_exit(gp_point_chain *self);
+
+/**
+ * @brief Removes all filters from the chain.
+ *
+ * @param self A point filter chain.
+ */
+void gp_point_chain_reset(gp_point_chain *self);
+
+/**
+ * @brief Adds a gamma or sRGB correction into the chain.
+ *
+ * Uses the gp_correction_acquire() tables, only the color channels are
+ * corrected, alpha is left as it is. Since the chain keeps the values in the
+ * pixel channel sizes the linearized values are rounded back to the channel
+ * size, so the extra precision of the linear tables is lost.
+ *
+ * @param self A point filter chain.
+ * @param desc A correction description.
+ * @param encode If zero the values are linearized, e.g. val^gamma, otherwise
+ *               the values are encoded back, e.g. val^(1/gamma).
+ *
+ * @return Zero on success, non-zero if the correction tables couldn't be
+ *         acquired.
+ */
+int gp_point_chain_correction(gp_point_chain *self,
+                              gp_correction_desc *desc, int encode);
+
+/**
+ * @brief Applies the chain on a pixmap rectangle.
+ *
+ * Both source and destination pixmaps must have the pixel type the chain was
+ * initialized for. The source and destination may be the same pixmap.
+ *
+ * @param src A source pixmap.
+ * @param x_src A source rectangle x offset.
+ * @param y_src A source rectangle y offset.
+ * @param w_src A source rectangle width.
+ * @param h_src A source rectangle height.
+ * @param dst A destination pixmap.
+ * @param x_dst A destination x offset.
+ * @param y_dst A destination y offset.
+ * @param self A point filter chain.
+ * @param callback An optional progress callback.
+ *
+ * @return Zero on success, non-zero on failure or if aborted by the callback.
+ */
+int gp_point_chain_apply_ex(const gp_pixmap *src,
+                            gp_coord x_src, gp_coord y_src,
+                            gp_size w_src, gp_size h_src,
+                            gp_pixmap *dst,
+                            gp_coord x_dst, gp_coord y_dst,
+                            const gp_point_chain *self,
+                            gp_progress_cb *callback);
+
+/**
+ * @brief Applies the chain on a pixmap and allocates the result.
+ *
+ * @param src A source pixmap.
+ * @param x_src A source rectangle x offset.
+ * @param y_src A source rectangle y offset.
+ * @param w_src A source rectangle width.
+ * @param h_src A source rectangle height.
+ * @param self A point filter chain.
+ * @param callback An optional progress callback.
+ *
+ * @return A newly allocated pixmap or NULL on failure.
+ */
+gp_pixmap *gp_point_chain_apply_ex_alloc(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         const gp_point_chain *self,
+                                         gp_progress_cb *callback);
+
+/**
+ * @brief Applies the chain on a whole pixmap.
+ *
+ * @param src A source pixmap.
+ * @param dst A destination pixmap, at least as large as the source.
+ * @param self A point filter chain.
+ * @param callback An optional progress callback.
+ *
+ * @return Zero on success, non-zero on failure or if aborted by the callback.
+ */
+static inline int gp_point_chain_apply(const gp_pixmap *src, gp_pixmap *dst,
+                                       const gp_point_chain *self,
+                                       gp_progress_cb *callback)
+{
+	return gp_point_chain_apply_ex(src, 0, 0, src->w, src->h,
+	                               dst, 0, 0, self, callback);
+}
+
+/**
+ * @brief Applies the chain on a whole pixmap and allocates the result.
+ *
+ * @param src A source pixmap.
+ * @param self A point filter chain.
+ * @param callback An optional progress callback.
+ *
+ * @return A newly allocated pixmap or NULL on failure.
+ */
+static inline gp_pixmap *gp_point_chain_apply_alloc(const gp_pixmap *src,
+                                                    const gp_point_chain *self,
+                                                    gp_progress_cb *callback)
+{
+	return gp_point_chain_apply_ex_alloc(src, 0, 0, src->w, src->h,
+	                                     self, callback);
+}
+
+#endif /* FILTERS_GP_POINT_CHAIN_H */
@@ -12,6 +12,8 @@
 #ifndef FILTERS_GP_RAND_H
 #define FILTERS_GP_RAND_H
 
+#include <stdint.h>
+
 /*
  * Fills the array with size integers with Normal (Gaussian) distribution
  * defined by sigma and mu parameters.
@@ -20,4 +22,42 @@
  */
 void gp_norm_int(int *arr, unsigned int size, int sigma, int mu);
 
+/*
+ * Philox4x32-10 counter based random number generator.
+ *
+ * Replaces the counter with four random numbers that depend only on the
+ * counter and the key. There is no state, so any part of the random sequence
+ * can be generated in any order, e.g. each image row in a different thread.
+ */
+static inline void gp_rand_philox(uint32_t ctr[4], const uint32_t key[2])
+{
+	uint32_t k0 = key[0], k1 = key[1];
+	unsigned int i;
+
+	for (i = 0; i < 10; i++) {
+		uint64_t p0 = (uint64_t)0xd2511f53 * ctr[0];
+		uint64_t p1 = (uint64_t)0xcd9e8d57 * ctr[2];
+		uint32_t c1 = ctr[1], c3 = ctr[3];
+
+		ctr[0] = (p1 >> 32) ^ c1 ^ k0;
+		ctr[1] = p1;
+		ctr[2] = (p0 >> 32) ^ c3 ^ k1;
+		ctr[3] = p0;
+
+		k0 += 0x9e3779b9;
+		k1 += 0xbb67ae85;
+	}
+}
+
+/*
+ * Same as gp_norm_int() but the numbers are generated by gp_rand_philox()
+ * from the seed and the stream number, i.e. the same seed and stream always
+ * produce the same sequence. Different streams, e.g. image rows, produce
+ * independent sequences.
+ *
+ * The size _MUST_ be divisible by four.
+ */
+void gp_norm_int_ctr(int *arr, unsigned int size, int sigma, int mu,
+                     uint64_t seed, uint64_t stream);
+
 #endif /* FILTERS_GP_RAND_H */
@@ -40,4 +40,21 @@ gp_histogram_channel *gp_histogram_channel_by_name(gp_histogram *self,
 int gp_filter_histogram(gp_histogram *self, const gp_pixmap *src,
                         gp_progress_cb *callback);
 
+/*
+ * Computes histogram of a rectangle inside of the src pixmap.
+ *
+ * If step is greater than one only every step-th pixel in every step-th row
+ * is counted, which gives an approximate histogram, e.g. for auto exposure,
+ * in a fraction of the time. Zero is treated as one.
+ *
+ * The image is split into stripes that are processed in threads, each of them
+ * counts into a private histogram and the results are summed at the end.
+ *
+ * Returns non-zero on failure (i.e. canceled by callback).
+ */
+int gp_filter_histogram_ex(gp_histogram *self, const gp_pixmap *src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           unsigned int step, gp_progress_cb *callback);
+
 #endif /* FILTERS_GP_STATS_H */
@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/**
+ * @file gp_tiled.h
+ * @brief Tiled filter execution for images that do not fit into memory.
+ *
+ * The image is split into tiles that are read from a source, filtered and
+ * written into a sink one by one, so only a few tiles have to be in memory at
+ * a time. Each tile is read with a halo, i.e. extra pixels around the tile as
+ * large as the filter kernel radius, so that the result is exactly the same
+ * as if the filter was applied on the whole image.
+ *
+ * @code
+ * gp_pixmap *in = gp_tile_raw_map("scan.raw", 30000, 30000, GP_PIXEL_G8, 0);
+ * gp_pixmap *out = gp_tile_raw_map("out.raw", 30000, 30000, GP_PIXEL_G8,
+ *                                  GP_TILE_RAW_CREATE);
+ * gp_tile_src src;
+ * gp_tile_sink sink;
+ * gp_tiled_filter median;
+ *
+ * gp_tile_src_pixmap(&src, in);
+ * gp_tile_sink_pixmap(&sink, out);
+ * gp_tiled_filter_median(&median, 3, 3);
+ *
+ * gp_filter_tiled(&src, &sink, &median, 0, 0, NULL);
+ *
+ * gp_tile_raw_unmap(in);
+ * gp_tile_raw_unmap(out);
+ * @endcode
+ */
+
+#ifndef FILTERS_GP_TILED_H
+#define FILTERS_GP_TILED_H
+
+#include <filters/gp_filter.h>
+
+/**
+ * @brief A tile source.
+ */
+typedef struct gp_tile_src {
+	/** @brief A source image pixel type. */
+	gp_pixel_type pixel_type;
+	/** @brief A source image width. */
+	gp_size w;
+	/** @brief A source image height. */
+	gp_size h;
+	/**
+	 * @brief Reads a rectangle of the source image.
+	 *
+	 * Fills the whole tile pixmap with the image rectangle starting at x,
+	 * y. The rectangle is always inside of the image. Calls are serialized
+	 * by the engine.
+	 *
+	 * @return Zero on success, non-zero on failure with errno set.
+	 */
+	int (*read)(struct gp_tile_src *self, gp_coord x, gp_coord y,
+	            gp_pixmap *tile);
+	/** @brief A source private pointer. */
+	void *priv;
+} gp_tile_src;
+
+/**
+ * @brief A tile sink.
+ */
+typedef struct gp_tile_sink {
+	/**
+	 * @brief Writes a filtered rectangle into the destination image.
+	 *
+	 * Writes w x h rectangle from x_tile, y_tile in the tile pixmap to x, y
+	 * in the destination image. Tiles may be written in any order when the
+	 * engine runs in threads. Calls are serialized by the engine.
+	 *
+	 * @return Zero on success, non-zero on failure with errno set.
+	 */
+	int (*write)(struct gp_tile_sink *self, gp_coord x, gp_coord y,
+	             const gp_pixmap *tile, gp_coord x_tile, gp_coord y_tile,
+	             gp_size w, gp_size h);
+	/** @brief A sink private pointer. */
+	void *priv;
+} gp_tile_sink;
+
+/**
+ * @brief A filter to be run on tiles.
+ */
+typedef struct gp_tiled_filter {
+	/** @brief A kernel radius in x direction. */
+	gp_size halo_x;
+	/** @brief A kernel radius in y direction. */
+	gp_size halo_y;
+	/**
+	 * @brief Filters a whole tile.
+	 *
+	 * The src and dst have the same size and pixel type, only the pixels
+	 * further than halo from the tile edges, or from the image edges, are
+	 * used.
+	 */
+	int (*filter)(const gp_pixmap *src, gp_pixmap *dst,
+	              const struct gp_tiled_filter *self,
+	              gp_progress_cb *callback);
+	/** @brief Filter parameters. */
+	union {
+		void *priv;
+		struct {
+			float x_sigma;
+			float y_sigma;
+		} blur;
+		struct {
+			int xmed;
+			int ymed;
+		} median;
+	};
+} gp_tiled_filter;
+
+/**
+ * @brief Runs a filter on tiles.
+ *
+ * Tiles run in parallel, each thread allocates its own tile buffers. The
+ * number of threads is chosen by gp_nr_threads().
+ *
+ * @param src A tile source.
+ * @param sink A tile sink, the destination has the size and pixel type of the
+ *             source.
+ * @param filter A filter.
+ * @param tile_w A tile width without the halo, 0 for default.
+ * @param tile_h A tile height without the halo, 0 for default.
+ * @param callback An optional progress callback.
+ *
+ * @return Zero on success, non-zero on failure or if aborted by the callback.
+ */
+int gp_filter_tiled(gp_tile_src *src, gp_tile_sink *sink,
+                    const gp_tiled_filter *filter,
+                    gp_size tile_w, gp_size tile_h,
+                    gp_progress_cb *callback);
+
+/**
+ * @brief Initializes a source that reads from a pixmap.
+ *
+ * @param self A tile source.
+ * @param pixmap A source pixmap, e.g. mapped by gp_tile_raw_map().
+ */
+void gp_tile_src_pixmap(gp_tile_src *self, const gp_pixmap *pixmap);
+
+/**
+ * @brief Initializes a sink that writes into a pixmap.
+ *
+ * @param self A tile sink.
+ * @param pixmap A destination pixmap, e.g. mapped by gp_tile_raw_map().
+ */
+void gp_tile_sink_pixmap(gp_tile_sink *self, gp_pixmap *pixmap);
+
+/**
+ * @brief Flags for gp_tile_raw_map().
+ */
+enum gp_tile_raw_flags {
+	/** @brief Creates or truncates the file to the image size. */
+	GP_TILE_RAW_CREATE = 0x01,
+};
+
+/**
+ * @brief Maps a raw image file into a pixmap.
+ *
+ * The file contains pixels in the pixel type format with rows aligned to
+ * whole bytes, i.e. the gp_pixmap layout. The pages are loaded and written
+ * back by the operating system on demand, so the image does not have to fit
+ * into the memory.
+ *
+ * @param path A path to the file.
+ * @param w An image width.
+ * @param h An image height.
+ * @param pixel_type An image pixel type.
+ * @param flags A bitwise or of enum gp_tile_raw_flags.
+ *
+ * @return A pixmap or NULL on failure.
+ */
+gp_pixmap *gp_tile_raw_map(const char *path, gp_size w, gp_size h,
+                           gp_pixel_type pixel_type, int flags);
+
+/**
+ * @brief Unmaps a pixmap mapped by gp_tile_raw_map().
+ *
+ * @param self A mapped pixmap.
+ */
+void gp_tile_raw_unmap(gp_pixmap *self);
+
+/**
+ * @brief Initializes a tiled gaussian blur.
+ *
+ * @param self A tiled filter.
+ * @param x_sigma A sigma in x direction.
+ * @param y_sigma A sigma in y direction.
+ */
+void gp_tiled_filter_gaussian_blur(gp_tiled_filter *self,
+                                   float x_sigma, float y_sigma);
+
+/**
+ * @brief Initializes a tiled median filter.
+ *
+ * @param self A tiled filter.
+ * @param xmed A median radius in x direction.
+ * @param ymed A median radius in y direction.
+ */
+void gp_tiled_filter_median(gp_tiled_filter *self, int xmed, int ymed);
+
+#endif /* FILTERS_GP_TILED_H */
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/**
+ * @file gp_batch.h
+ * @brief Batch drawing functions.
+ *
+ * These functions draw many primitives of the same kind and color at once.
+ * The pixel type dispatch, coordinate transformations and clipping setup is
+ * done once per batch rather than once per primitive, which makes them
+ * considerably faster than calling gp_putpixel(), gp_line() or gp_fill_rect()
+ * in a loop.
+ */
+
+#ifndef GFX_GP_BATCH_H
+#define GFX_GP_BATCH_H
+
+#include <stddef.h>
+#include <core/gp_types.h>
+
+/**
+ * @brief Puts an array of pixels.
+ * @ingroup gfx
+ *
+ * Pixels outside of the pixmap are ignored.
+ *
+ * @param pixmap A pixmap to draw into.
+ * @param cnt A number of pixels.
+ * @param xy An array of 2 * cnt coordinates in the [x0, y0, ..., xn, yn] format.
+ * @param pixel A pixel value to be used for the drawing.
+ */
+void gp_putpixels(gp_pixmap *pixmap, size_t cnt, const gp_coord *xy,
+                  gp_pixel pixel);
+
+/**
+ * @brief Draws an array of lines.
+ * @ingroup gfx
+ *
+ * Draws exactly the same pixels as gp_line() called for each line would.
+ *
+ * @param pixmap A pixmap to draw into.
+ * @param cnt A number of lines.
+ * @param xyxy An array of 4 * cnt coordinates in the [x0, y0, x1, y1, ...]
+ *             format.
+ * @param pixel A pixel value to be used for the drawing.
+ */
+void gp_lines(gp_pixmap *pixmap, size_t cnt, const gp_coord *xyxy,
+              gp_pixel pixel);
+
+/**
+ * @brief Fills an array of rectangles.
+ * @ingroup gfx
+ *
+ * Draws exactly the same pixels as gp_fill_rect() called for each rectangle
+ * would.
+ *
+ * @param pixmap A pixmap to draw into.
+ * @param cnt A number of rectangles.
+ * @param xyxy An array of 4 * cnt coordinates in the [x0, y0, x1, y1, ...]
+ *             format.
+ * @param pixel A pixel value to be used for the drawing.
+ */
+void gp_fill_rects(gp_pixmap *pixmap, size_t cnt, const gp_coord *xyxy,
+                   gp_pixel pixel);
+
+#endif /* GFX_GP_BATCH_H */
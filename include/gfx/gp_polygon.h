@@ -3,7 +3,7 @@
  * Copyright (C) 2009-2011 Jiri "BlueBear" Dluhos
  *                         <jiri.bluebear.dluhos@gmail.com>
  *
- * Copyright (C) 2009-2024 Cyril Hrubis <metan@ucw.cz>
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
  */
 
 /**
@@ -73,4 +73,41 @@ void gp_fill_polygon(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
 void gp_fill_polygon_raw(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
                          unsigned int vertex_count, const gp_coord *xy, gp_pixel pixel);
 
+/**
+ * @brief A polygon fill rule.
+ * @ingroup gfx
+ */
+enum gp_fill_rule {
+	/** @brief A point is inside if a ray crosses odd number of edges. */
+	GP_FILL_EVEN_ODD,
+	/** @brief A point is inside if the edge winding number is non-zero. */
+	GP_FILL_NON_ZERO,
+};
+
+/**
+ * @brief Fills several polygons in a single pass.
+ * @ingroup gfx
+ *
+ * All edges of all polygons are merged into a single edge table and filled
+ * together according to the fill rule, which can be used to draw polygons
+ * with holes.
+ *
+ * @param pixmap A pixmap to draw the polygons into.
+ * @param x_off A x offset to draw the polygons at.
+ * @param y_off A y offset to draw the polygons at.
+ * @param poly_count The number of polygons.
+ * @param vertex_counts An array of poly_count vertex counts.
+ * @param xy An array of all polygon coordinates in the [x0, y0, ..., xn, yn]
+ *           format, polygons are stored one after another.
+ * @param rule A fill rule.
+ * @param pixel A pixel value to be used to fill the polygons.
+ */
+void gp_fill_polygons(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                      unsigned int poly_count, const unsigned int *vertex_counts,
+                      const gp_coord *xy, enum gp_fill_rule rule, gp_pixel pixel);
+
+void gp_fill_polygons_raw(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                          unsigned int poly_count, const unsigned int *vertex_counts,
+                          const gp_coord *xy, enum gp_fill_rule rule, gp_pixel pixel);
+
 #endif /* GFX_GP_POLYGON_H */
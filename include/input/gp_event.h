@@ -36,8 +36,14 @@ enum gp_ev_type {
 	GP_EV_TMR = 5,
 	/** @brief A poll event on a filescriptor. */
 	GP_EV_FD = 6,
+	/**
+	 * @brief An user event.
+	 *
+	 * The gp_event::code and gp_event::ptr are application defined.
+	 */
+	GP_EV_USR = 7,
 	/** @brief Last used event type. */
-	GP_EV_MAX = 6,
+	GP_EV_MAX = 7,
 };
 
 /** @brief A key event type. */
@@ -245,6 +251,8 @@ struct gp_event {
 		gp_timer *tmr;
 		/** @brief A poll fd event. */
 		gp_fd *fd;
+		/** @brief An user pointer for the GP_EV_USR event. */
+		void *ptr;
 	};
 
 	/** @brief An event timestamp. */
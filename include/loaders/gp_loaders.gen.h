@@ -0,0 +1,1195 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_loaders.gen.h
+ *
+ * GENERATED on 2026 10 19 16:35:03 from gp_loaders.gen.h.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+#ifndef GP_LOADERS_GEN_H
+#define GP_LOADERS_GEN_H
+
+/*
+ * Inline functions for loading and saving various pixmap formats.
+ *
+ * Copyright (C) 2017-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+#include <loaders/gp_loader.h>
+
+/**
+ * @brief Autogenerated loader functions.
+ * @file gp_loaders.gen.h
+ */
+
+
+
+extern const gp_loader gp_bmp;
+
+/**
+ * @brief A function to match a bmp file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_bmp(const void *buf);
+
+/**
+ * @brief Reads a bmp image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_bmp_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a bmp image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_bmp(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_bmp, src_path, callback);
+}
+
+/**
+ * @brief Reads a bmp image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_bmp(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_bmp, io, callback);
+}
+
+/**
+ * @brief Writes a bmp image to an I/O.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param io A writeable I/O.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set. The resulting
+ *         errno may also be set to any possible error from open(3), write(3),
+ *         seek(3), etc.
+ */
+int gp_write_bmp(const gp_pixmap *src, gp_io *io,
+                 gp_progress_cb *callback);
+
+/**
+ * @brief Writes a bmp image to a file.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param dst_path A path to a file to write the image into.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set.
+ */
+static inline int gp_save_bmp(const gp_pixmap *src, const char *dst_path,
+                              gp_progress_cb *callback)
+{
+	return gp_loader_save_image(&gp_bmp, src, dst_path, callback);
+}
+
+
+extern const gp_loader gp_jpg;
+
+/**
+ * @brief A function to match a jpg file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_jpg(const void *buf);
+
+/**
+ * @brief Reads a jpg image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_jpg_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a jpg image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_jpg(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_jpg, src_path, callback);
+}
+
+/**
+ * @brief Reads a jpg image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_jpg(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_jpg, io, callback);
+}
+
+/**
+ * @brief Writes a jpg image to an I/O.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param io A writeable I/O.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set. The resulting
+ *         errno may also be set to any possible error from open(3), write(3),
+ *         seek(3), etc.
+ */
+int gp_write_jpg(const gp_pixmap *src, gp_io *io,
+                 gp_progress_cb *callback);
+
+/**
+ * @brief Writes a jpg image to a file.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param dst_path A path to a file to write the image into.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set.
+ */
+static inline int gp_save_jpg(const gp_pixmap *src, const char *dst_path,
+                              gp_progress_cb *callback)
+{
+	return gp_loader_save_image(&gp_jpg, src, dst_path, callback);
+}
+
+
+extern const gp_loader gp_png;
+
+/**
+ * @brief A function to match a png file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_png(const void *buf);
+
+/**
+ * @brief Reads a png image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_png_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a png image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_png(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_png, src_path, callback);
+}
+
+/**
+ * @brief Reads a png image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_png(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_png, io, callback);
+}
+
+/**
+ * @brief Writes a png image to an I/O.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param io A writeable I/O.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set. The resulting
+ *         errno may also be set to any possible error from open(3), write(3),
+ *         seek(3), etc.
+ */
+int gp_write_png(const gp_pixmap *src, gp_io *io,
+                 gp_progress_cb *callback);
+
+/**
+ * @brief Writes a png image to a file.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param dst_path A path to a file to write the image into.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set.
+ */
+static inline int gp_save_png(const gp_pixmap *src, const char *dst_path,
+                              gp_progress_cb *callback)
+{
+	return gp_loader_save_image(&gp_png, src, dst_path, callback);
+}
+
+
+extern const gp_loader gp_tiff;
+
+/**
+ * @brief A function to match a tiff file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_tiff(const void *buf);
+
+/**
+ * @brief Reads a tiff image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_tiff_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a tiff image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_tiff(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_tiff, src_path, callback);
+}
+
+/**
+ * @brief Reads a tiff image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_tiff(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_tiff, io, callback);
+}
+
+/**
+ * @brief Writes a tiff image to an I/O.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param io A writeable I/O.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set. The resulting
+ *         errno may also be set to any possible error from open(3), write(3),
+ *         seek(3), etc.
+ */
+int gp_write_tiff(const gp_pixmap *src, gp_io *io,
+                 gp_progress_cb *callback);
+
+/**
+ * @brief Writes a tiff image to a file.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param dst_path A path to a file to write the image into.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set.
+ */
+static inline int gp_save_tiff(const gp_pixmap *src, const char *dst_path,
+                              gp_progress_cb *callback)
+{
+	return gp_loader_save_image(&gp_tiff, src, dst_path, callback);
+}
+
+
+extern const gp_loader gp_pbm;
+
+/**
+ * @brief A function to match a pbm file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_pbm(const void *buf);
+
+/**
+ * @brief Reads a pbm image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_pbm_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a pbm image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_pbm(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_pbm, src_path, callback);
+}
+
+/**
+ * @brief Reads a pbm image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_pbm(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_pbm, io, callback);
+}
+
+/**
+ * @brief Writes a pbm image to an I/O.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param io A writeable I/O.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set. The resulting
+ *         errno may also be set to any possible error from open(3), write(3),
+ *         seek(3), etc.
+ */
+int gp_write_pbm(const gp_pixmap *src, gp_io *io,
+                 gp_progress_cb *callback);
+
+/**
+ * @brief Writes a pbm image to a file.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param dst_path A path to a file to write the image into.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set.
+ */
+static inline int gp_save_pbm(const gp_pixmap *src, const char *dst_path,
+                              gp_progress_cb *callback)
+{
+	return gp_loader_save_image(&gp_pbm, src, dst_path, callback);
+}
+
+
+extern const gp_loader gp_pgm;
+
+/**
+ * @brief A function to match a pgm file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_pgm(const void *buf);
+
+/**
+ * @brief Reads a pgm image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_pgm_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a pgm image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_pgm(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_pgm, src_path, callback);
+}
+
+/**
+ * @brief Reads a pgm image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_pgm(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_pgm, io, callback);
+}
+
+/**
+ * @brief Writes a pgm image to an I/O.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param io A writeable I/O.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set. The resulting
+ *         errno may also be set to any possible error from open(3), write(3),
+ *         seek(3), etc.
+ */
+int gp_write_pgm(const gp_pixmap *src, gp_io *io,
+                 gp_progress_cb *callback);
+
+/**
+ * @brief Writes a pgm image to a file.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param dst_path A path to a file to write the image into.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set.
+ */
+static inline int gp_save_pgm(const gp_pixmap *src, const char *dst_path,
+                              gp_progress_cb *callback)
+{
+	return gp_loader_save_image(&gp_pgm, src, dst_path, callback);
+}
+
+
+extern const gp_loader gp_ppm;
+
+/**
+ * @brief A function to match a ppm file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_ppm(const void *buf);
+
+/**
+ * @brief Reads a ppm image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_ppm_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a ppm image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_ppm(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_ppm, src_path, callback);
+}
+
+/**
+ * @brief Reads a ppm image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_ppm(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_ppm, io, callback);
+}
+
+/**
+ * @brief Writes a ppm image to an I/O.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param io A writeable I/O.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set. The resulting
+ *         errno may also be set to any possible error from open(3), write(3),
+ *         seek(3), etc.
+ */
+int gp_write_ppm(const gp_pixmap *src, gp_io *io,
+                 gp_progress_cb *callback);
+
+/**
+ * @brief Writes a ppm image to a file.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param dst_path A path to a file to write the image into.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set.
+ */
+static inline int gp_save_ppm(const gp_pixmap *src, const char *dst_path,
+                              gp_progress_cb *callback)
+{
+	return gp_loader_save_image(&gp_ppm, src, dst_path, callback);
+}
+
+
+extern const gp_loader gp_pnm;
+
+/**
+ * @brief A function to match a pnm file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_pnm(const void *buf);
+
+/**
+ * @brief Reads a pnm image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_pnm_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a pnm image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_pnm(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_pnm, src_path, callback);
+}
+
+/**
+ * @brief Reads a pnm image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_pnm(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_pnm, io, callback);
+}
+
+/**
+ * @brief Writes a pnm image to an I/O.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param io A writeable I/O.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set. The resulting
+ *         errno may also be set to any possible error from open(3), write(3),
+ *         seek(3), etc.
+ */
+int gp_write_pnm(const gp_pixmap *src, gp_io *io,
+                 gp_progress_cb *callback);
+
+/**
+ * @brief Writes a pnm image to a file.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param dst_path A path to a file to write the image into.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set.
+ */
+static inline int gp_save_pnm(const gp_pixmap *src, const char *dst_path,
+                              gp_progress_cb *callback)
+{
+	return gp_loader_save_image(&gp_pnm, src, dst_path, callback);
+}
+
+
+extern const gp_loader gp_webp;
+
+/**
+ * @brief A function to match a webp file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_webp(const void *buf);
+
+/**
+ * @brief Reads a webp image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_webp_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a webp image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_webp(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_webp, src_path, callback);
+}
+
+/**
+ * @brief Reads a webp image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_webp(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_webp, io, callback);
+}
+
+/**
+ * @brief Writes a webp image to an I/O.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param io A writeable I/O.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set. The resulting
+ *         errno may also be set to any possible error from open(3), write(3),
+ *         seek(3), etc.
+ */
+int gp_write_webp(const gp_pixmap *src, gp_io *io,
+                 gp_progress_cb *callback);
+
+/**
+ * @brief Writes a webp image to a file.
+ *
+ * @warning Image loader can save only pixmaps with a compatible pixel types.
+ *
+ * @param src A pixmap to be saved.
+ * @param dst_path A path to a file to write the image into.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero otherwise and errno is set.
+ */
+static inline int gp_save_webp(const gp_pixmap *src, const char *dst_path,
+                              gp_progress_cb *callback)
+{
+	return gp_loader_save_image(&gp_webp, src, dst_path, callback);
+}
+
+
+extern const gp_loader gp_ico;
+
+/**
+ * @brief A function to match a ico file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_ico(const void *buf);
+
+/**
+ * @brief Reads a ico image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_ico_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a ico image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_ico(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_ico, src_path, callback);
+}
+
+/**
+ * @brief Reads a ico image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_ico(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_ico, io, callback);
+}
+
+extern const gp_loader gp_jp2;
+
+/**
+ * @brief A function to match a jp2 file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_jp2(const void *buf);
+
+/**
+ * @brief Reads a jp2 image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_jp2_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a jp2 image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_jp2(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_jp2, src_path, callback);
+}
+
+/**
+ * @brief Reads a jp2 image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_jp2(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_jp2, io, callback);
+}
+
+extern const gp_loader gp_pcx;
+
+/**
+ * @brief A function to match a pcx file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_pcx(const void *buf);
+
+/**
+ * @brief Reads a pcx image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_pcx_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a pcx image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_pcx(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_pcx, src_path, callback);
+}
+
+/**
+ * @brief Reads a pcx image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_pcx(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_pcx, io, callback);
+}
+
+extern const gp_loader gp_gif;
+
+/**
+ * @brief A function to match a gif file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_gif(const void *buf);
+
+/**
+ * @brief Reads a gif image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_gif_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a gif image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_gif(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_gif, src_path, callback);
+}
+
+/**
+ * @brief Reads a gif image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_gif(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_gif, io, callback);
+}
+
+extern const gp_loader gp_psp;
+
+/**
+ * @brief A function to match a psp file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_psp(const void *buf);
+
+/**
+ * @brief Reads a psp image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_psp_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a psp image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_psp(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_psp, src_path, callback);
+}
+
+/**
+ * @brief Reads a psp image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_psp(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_psp, io, callback);
+}
+
+extern const gp_loader gp_psd;
+
+/**
+ * @brief A function to match a psd file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_psd(const void *buf);
+
+/**
+ * @brief Reads a psd image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_psd_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a psd image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_psd(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_psd, src_path, callback);
+}
+
+/**
+ * @brief Reads a psd image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_psd(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_psd, io, callback);
+}
+
+extern const gp_loader gp_heif;
+
+/**
+ * @brief A function to match a heif file signature.
+ *
+ * @param buf A buffer with at least 32 bytes from the start of the image.
+ * @return Returns one on match and zero otherwise.
+ */
+int gp_match_heif(const void *buf);
+
+/**
+ * @brief Reads a heif image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param img A pointer to store the newly allocated image into.
+ * @param image_info If not NULL this structure is filled in before the
+ *                   image data are loaded. The meta data storage,
+ *                   if not NULL, is filled with metadata, e.g. exif.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return Zero on success, non-zero on a failure and errno is set.
+ */
+int gp_read_heif_ex(gp_io *io, gp_pixmap **img, gp_image_info *image_info,
+                   gp_progress_cb *callback);
+
+/**
+ * @brief Loads a heif image from a file.
+ *
+ * @param src_path A path to an image file.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the file or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_load_heif(const char *src_path,
+                                     gp_progress_cb *callback)
+{
+        return gp_loader_load_image(&gp_heif, src_path, callback);
+}
+
+/**
+ * @brief Reads a heif image from an I/O.
+ *
+ * @param io A readable I/O channel.
+ * @param callback A progress callback. The operation can be aborted by a
+ *                 non-zero callback return value.
+ * @return A newly allocated image loaded from the I/O or NULL in a case of a
+ *         failure. In a case of a failure errno is set.
+ */
+static inline gp_pixmap *gp_read_heif(gp_io *io, gp_progress_cb *callback)
+{
+        return gp_loader_read_image(&gp_heif, io, callback);
+}
+#endif /* GP_LOADERS_GEN_H */
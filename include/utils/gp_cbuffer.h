@@ -59,6 +59,19 @@ static inline size_t gp_cbuffer_append(gp_cbuffer *self)
 	return old_last;
 }
 
+/**
+ * @brief Removes the first, i.e. the oldest, element from the buffer.
+ *
+ * Only the index is removed, any data has to be freed by the user of this API
+ * before this function is called. The buffer must not be empty.
+ *
+ * @param self A circular buffer.
+ */
+static inline void gp_cbuffer_remove_first(gp_cbuffer *self)
+{
+	self->used--;
+}
+
 /**
  * @brief Returns next position in the circular buffer.
  *
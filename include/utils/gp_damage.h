@@ -0,0 +1,91 @@
+//SPDX-License-Identifier: LGPL-2.0-or-later
+
+/*
+
+   Copyright (c) 2026 Cyril Hrubis <metan@ucw.cz>
+
+ */
+
+/**
+ * @file gp_damage.h
+ * @brief A damage region.
+ *
+ * A damage region is a small set of non-overlapping bounding boxes that
+ * describes which parts of a buffer have changed. Rectangles are merged when
+ * they overlap or when merging them does not waste any area. When the set is
+ * full the pair whose merge adds the smallest area is merged, which keeps
+ * small changes in the opposite corners of the buffer separate.
+ */
+
+#ifndef GP_DAMAGE_H
+#define GP_DAMAGE_H
+
+#include <utils/gp_bbox.h>
+
+/** @brief Maximal number of rectangles in a damage region. */
+#define GP_DAMAGE_RECTS_MAX 8
+
+/**
+ * @brief A damage region.
+ */
+typedef struct gp_damage {
+	/** @brief A number of rectangles in the region. */
+	unsigned int cnt;
+	/** @brief Non-overlapping rectangles. */
+	gp_bbox rects[GP_DAMAGE_RECTS_MAX];
+} gp_damage;
+
+/**
+ * @brief Clears a damage region.
+ *
+ * @param self A damage region.
+ */
+static inline void gp_damage_clear(gp_damage *self)
+{
+	self->cnt = 0;
+}
+
+/**
+ * @brief Returns true if damage region is empty.
+ *
+ * @param self A damage region.
+ * @return True if there are no rectangles in the region.
+ */
+static inline int gp_damage_empty(const gp_damage *self)
+{
+	return !self->cnt;
+}
+
+/**
+ * @brief Adds a rectangle to a damage region.
+ *
+ * Empty rectangles are ignored.
+ *
+ * @param self A damage region.
+ * @param box A rectangle to add.
+ */
+void gp_damage_add(gp_damage *self, gp_bbox box);
+
+/**
+ * @brief Adds all rectangles from one damage region to another.
+ *
+ * @param self A damage region to add to.
+ * @param damage A damage region to be added.
+ */
+static inline void gp_damage_merge(gp_damage *self, const gp_damage *damage)
+{
+	unsigned int i;
+
+	for (i = 0; i < damage->cnt; i++)
+		gp_damage_add(self, damage->rects[i]);
+}
+
+/**
+ * @brief Returns a bounding box of the whole damage region.
+ *
+ * @param self A damage region.
+ * @return A bounding box that contains all rectangles in the region.
+ */
+gp_bbox gp_damage_bbox(const gp_damage *self);
+
+#endif /* GP_DAMAGE_H */
@@ -0,0 +1,79 @@
+//SPDX-License-Identifier: LGPL-2.0-or-later
+
+/*
+
+   Copyright (c) 2026 Cyril Hrubis <metan@ucw.cz>
+
+ */
+
+/**
+ * @file gp_mpsc.h
+ * @brief A lock-free multiple producer single consumer queue.
+ *
+ * An intrusive queue, the user embeds the gp_mpsc_node into a structure and
+ * uses GP_CONTAINER_OF() to get the structure back from the node returned by
+ * gp_mpsc_pop().
+ *
+ * Any number of threads can push into the queue at the same time, but only
+ * a single thread can pop from it. Neither push nor pop takes a lock.
+ */
+
+#ifndef UTILS_GP_MPSC_H
+#define UTILS_GP_MPSC_H
+
+#include <stddef.h>
+
+/**
+ * @brief A queue node.
+ */
+typedef struct gp_mpsc_node {
+	/** @brief A next node, owned by the queue. */
+	struct gp_mpsc_node *next;
+} gp_mpsc_node;
+
+/**
+ * @brief A multiple producer single consumer queue.
+ */
+typedef struct gp_mpsc {
+	/** @brief Last pushed node, shared between producers. */
+	gp_mpsc_node *head;
+	/** @brief First node to be popped, owned by the consumer. */
+	gp_mpsc_node *tail;
+	/** @brief A placeholder node so that queue is never empty. */
+	gp_mpsc_node stub;
+} gp_mpsc;
+
+/**
+ * @brief Initializes a queue.
+ *
+ * Must be called before the queue is shared with other threads.
+ *
+ * @param self A queue.
+ */
+void gp_mpsc_init(gp_mpsc *self);
+
+/**
+ * @brief Pushes a node into the queue.
+ *
+ * Safe to be called from any thread.
+ *
+ * @param self A queue.
+ * @param node A node to push.
+ */
+void gp_mpsc_push(gp_mpsc *self, gp_mpsc_node *node);
+
+/**
+ * @brief Pops a node from the queue.
+ *
+ * Must be called only from the consumer thread.
+ *
+ * The function may return NULL while a push into the queue is in progress
+ * in a different thread, the pushed node is returned once the push has
+ * finished.
+ *
+ * @param self A queue.
+ * @return A node or NULL if queue is empty.
+ */
+gp_mpsc_node *gp_mpsc_pop(gp_mpsc *self);
+
+#endif /* UTILS_GP_MPSC_H */
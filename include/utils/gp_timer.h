@@ -13,6 +13,7 @@
 
 #include <stdint.h>
 #include <utils/gp_types.h>
+#include <utils/gp_list.h>
 #include <input/gp_types.h>
 
 /**
@@ -27,6 +28,7 @@ struct gp_timer {
 	union {
 		gp_heap_head heap;
 		gp_timer *next;
+		gp_dlist_head list;
 	};
 
 	/** @brief Initial xpiration time, set by user, modified by the queue */
@@ -55,8 +57,8 @@ struct gp_timer {
 	 * This defferes freeing the timer memory afte the timer is stopped.
 	 */
 	uint32_t free_on_stop:1;
-
-
+	/** @brief A timer wheel slot the timer is inserted into. Do not touch! */
+	uint32_t slot:8;
 
 	/** @brief Library private pointer. Do not touch! */
 	void *_priv;
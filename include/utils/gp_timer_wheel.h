@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/**
+ * @file gp_timer_wheel.h
+ * @brief A hierarchical timer wheel.
+ *
+ * An alternative to the timer queue in gp_timer.h for cases where there are
+ * many timers that are frequently started and stopped, e.g. cursor blinking,
+ * animations, key repeat, timeouts.
+ *
+ * The wheel consists of #GP_TIMER_WHEEL_LEVELS levels of
+ * #GP_TIMER_WHEEL_SLOTS slots, the first level slots are one millisecond wide,
+ * each next level slots are #GP_TIMER_WHEEL_SLOTS times wider than on the
+ * previous level. Timers are inserted into a slot by their expiration time and
+ * are moved into lower levels once the time comes closer to the expiration.
+ *
+ * Both insert and remove run in O(1), all timers that expire at the same
+ * millisecond are processed in one batch.
+ *
+ * The timers are the same #gp_timer structures as used by the timer queue with
+ * the same semantics for the callback return value, gp_timer::stopped
+ * callback and gp_timer_free(). A timer can be inserted either into a timer
+ * queue or into a timer wheel but not both at the same time.
+ */
+
+#ifndef UTILS_GP_TIMER_WHEEL_H
+#define UTILS_GP_TIMER_WHEEL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <utils/gp_list.h>
+#include <utils/gp_timer.h>
+
+/** @brief Number of bits per a timer wheel level. */
+#define GP_TIMER_WHEEL_BITS 6
+/** @brief Number of slots per a timer wheel level. */
+#define GP_TIMER_WHEEL_SLOTS (1<<GP_TIMER_WHEEL_BITS)
+/**
+ * @brief Number of timer wheel levels.
+ *
+ * Timers that expire further than 2^24 ms, i.e. about four and half hours, are
+ * inserted into the last slot and moved to the right slot once the wheel
+ * turns.
+ */
+#define GP_TIMER_WHEEL_LEVELS 4
+
+/**
+ * @brief A timer wheel.
+ */
+typedef struct gp_timer_wheel {
+	/** @brief A time the wheel has been processed up to. */
+	uint64_t clk;
+	/** @brief Number of timers in the wheel. */
+	size_t cnt;
+	/** @brief A bitmap of non-empty slots per level. */
+	uint64_t used[GP_TIMER_WHEEL_LEVELS];
+	/** @brief The timer lists. */
+	gp_dlist slots[GP_TIMER_WHEEL_LEVELS][GP_TIMER_WHEEL_SLOTS];
+} gp_timer_wheel;
+
+/**
+ * @brief Initializes an empty timer wheel.
+ *
+ * @param self A timer wheel.
+ * @param now A timestamp, usually obtained by calling gp_time_stamp().
+ */
+void gp_timer_wheel_init(gp_timer_wheel *self, uint64_t now);
+
+/**
+ * @brief Inserts timer into a timer wheel.
+ *
+ * Same as gp_timer_queue_ins() but runs in O(1).
+ *
+ * @param self A timer wheel.
+ * @param now A timestamp, usually obtained by calling gp_time_stamp().
+ * @param timer A timer to insert.
+ */
+void gp_timer_wheel_ins(gp_timer_wheel *self, uint64_t now, gp_timer *timer);
+
+/**
+ * @brief Removes timer from a timer wheel.
+ *
+ * Same as gp_timer_queue_rem() but runs in O(1).
+ *
+ * @param self A timer wheel.
+ * @param timer A timer to remove.
+ */
+void gp_timer_wheel_rem(gp_timer_wheel *self, gp_timer *timer);
+
+/**
+ * @brief Processes timer wheel, all timers with expires <= now are processed.
+ *
+ * Same as gp_timer_queue_process().
+ *
+ * @param self A timer wheel.
+ * @param now A timestamp, usually obtained by calling gp_time_stamp().
+ * @return Number of timers processed.
+ */
+int gp_timer_wheel_process(gp_timer_wheel *self, uint64_t now);
+
+/**
+ * @brief Returns a time the gp_timer_wheel_process() should be called at.
+ *
+ * The time may be earlier than the closest timer expiration, since timers in
+ * the upper levels are only known to expire inside of the slot time range.
+ * The application is supposed to call gp_timer_wheel_process() then and ask
+ * again.
+ *
+ * @param self A timer wheel.
+ * @return A timestamp or UINT64_MAX if the wheel is empty.
+ */
+uint64_t gp_timer_wheel_expires(const gp_timer_wheel *self);
+
+/**
+ * @brief Returns number of timers in the wheel.
+ *
+ * @param self A timer wheel.
+ * @return Number of timers in the wheel.
+ */
+static inline size_t gp_timer_wheel_size(const gp_timer_wheel *self)
+{
+	return self->cnt;
+}
+
+#endif /* UTILS_GP_TIMER_WHEEL_H */
@@ -0,0 +1,173 @@
+//SPDX-License-Identifier: LGPL-2.0-or-later
+
+/*
+
+   Copyright (c) 2026 Cyril Hrubis <metan@ucw.cz>
+
+ */
+
+/**
+ * @file gp_app_job.h
+ * @brief Runs a job in a background thread.
+ *
+ * Jobs are meant for work that would block the app main loop for too long,
+ * e.g. loading images or listing large directories. The gp_app_job::run()
+ * callback runs in a worker thread and once it finishes the
+ * gp_app_job::done() callback is called in the context of the app main loop,
+ * where it's safe to modify widgets.
+ *
+ * Pending jobs are sorted by priorities the same way as tasks are, see
+ * #gp_task.
+ *
+ * Example job
+ * -----------
+ * @code
+ * static int load_run(gp_app_job *self)
+ * {
+ *	//Runs in a worker thread, must not touch widgets
+ *	self->priv = load_data(...);
+ *
+ *	return 0;
+ * }
+ *
+ * static void load_done(gp_app_job *self)
+ * {
+ *	if (self->canceled) {
+ *		free_data(self->priv);
+ *		return;
+ *	}
+ *
+ *	//Runs in the app main loop, update widgets here
+ * }
+ *
+ * static gp_app_job load_job = {
+ *	.id = "load",
+ *	.prio = GP_TASK_MIN_PRIO,
+ *	.run = load_run,
+ *	.done = load_done,
+ * };
+ *
+ * ...
+ *	gp_app_job_submit(&load_job);
+ * ...
+ * @endcode
+ */
+
+#ifndef WIDGETS_GP_APP_JOB_H
+#define WIDGETS_GP_APP_JOB_H
+
+#include <input/gp_task.h>
+
+/** @brief A maximal number of worker threads. */
+#define GP_APP_JOB_THREADS_MAX 4
+
+/** @brief A job state. */
+enum gp_app_job_state {
+	/** @brief Job is not submitted. */
+	GP_APP_JOB_IDLE = 0,
+	/** @brief Job is waiting for a worker thread. */
+	GP_APP_JOB_QUEUED,
+	/** @brief Job is running in a worker thread. */
+	GP_APP_JOB_RUNNING,
+	/** @brief Job has finished, gp_app_job::done() has not been called yet. */
+	GP_APP_JOB_DONE,
+};
+
+/**
+ * @brief A background job.
+ */
+typedef struct gp_app_job {
+	/**
+	 * @brief A task used by the library.
+	 *
+	 * Holds the job in the queue of pending jobs and then runs the
+	 * gp_app_job::done() callback in the app main loop.
+	 */
+	gp_task task;
+	/** @brief Human readable job id. */
+	const char *id;
+	/** @brief A job priority, same values as for #gp_task priorities. */
+	unsigned int prio;
+	/**
+	 * @brief The job callback, runs in a worker thread.
+	 *
+	 * Long running jobs should check gp_app_job_canceled() and return
+	 * early when job has been canceled.
+	 *
+	 * @param self A job.
+	 * @return A value that is stored into gp_app_job::ret.
+	 */
+	int (*run)(struct gp_app_job *self);
+	/**
+	 * @brief A completion callback, runs in the app main loop.
+	 *
+	 * Called after gp_app_job::run() has finished, or instead of it when a
+	 * pending job was canceled. The gp_app_job::canceled flag is set in
+	 * both cases if gp_app_job_cancel() was called.
+	 *
+	 * The job can be freed or submitted again from this callback.
+	 *
+	 * @param self A job.
+	 */
+	void (*done)(struct gp_app_job *self);
+	/** @brief A return value from gp_app_job::run(). */
+	int ret;
+	/** @brief Set when job was canceled. */
+	int canceled;
+	/** @brief A job state, do not touch. */
+	int state;
+	/** @brief A private pointer to be used by the user of the API. */
+	void *priv;
+} gp_app_job;
+
+/**
+ * @brief Submits a job to be executed in a background thread.
+ *
+ * Worker threads are started on the first submit.
+ *
+ * @note The gp_app_job::done() callback is called from the app main loop. If
+ *       the main loop is not running or if worker threads couldn't be
+ *       started, the job runs synchronously and both callbacks are called
+ *       before this function returns.
+ *
+ * @param self A job.
+ * @return Zero on success, non-zero if job is still in progress.
+ */
+int gp_app_job_submit(gp_app_job *self);
+
+/**
+ * @brief Cancels a job.
+ *
+ * A pending job is removed from the queue and gp_app_job::done() is called on
+ * the next main loop iteration. A running job is only marked as canceled and
+ * gp_app_job::done() is called once gp_app_job::run() returns.
+ *
+ * Must be called from the app main loop.
+ *
+ * @param self A job.
+ */
+void gp_app_job_cancel(gp_app_job *self);
+
+/**
+ * @brief Returns true if job has been canceled.
+ *
+ * Safe to be called from the gp_app_job::run() callback.
+ *
+ * @param self A job.
+ * @return Non-zero if job has been canceled.
+ */
+static inline int gp_app_job_canceled(gp_app_job *self)
+{
+	return __atomic_load_n(&self->canceled, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Returns true if job has been submitted and not finished yet.
+ *
+ * @param self A job.
+ * @return Non-zero if job is queued, running or waiting for the
+ *         gp_app_job::done() callback.
+ */
+int gp_app_job_busy(gp_app_job *self);
+
+#endif /* WIDGETS_GP_APP_JOB_H */
@@ -15,6 +15,7 @@
 #define WIDGETS_GP_APP_TASK_H
 
 #include <input/gp_task.h>
+#include <input/gp_event.h>
 
 /**
  * @brief Inserts a task into the widgets main loop.
@@ -34,4 +35,34 @@ void gp_app_task_start(gp_task *task);
  */
 void gp_app_task_stop(gp_task *task);
 
+/**
+ * @brief Posts a task into the widgets main loop from any thread.
+ *
+ * The task is inserted into the main loop task queue by the main loop thread,
+ * which is woken up by the call. This is the way how worker threads hand over
+ * results to the application.
+ *
+ * This function is thread safe, but can be used only after the main loop has
+ * been initialized, e.g. from threads started from widget callbacks.
+ *
+ * @param task Pointer to a gp_task.
+ * @return Zero on success, non-zero otherwise.
+ */
+int gp_app_task_post(gp_task *task);
+
+/**
+ * @brief Posts an event into the widgets main loop from any thread.
+ *
+ * The event is copied and delivered by the main loop thread. Events with
+ * #GP_EV_USR type are passed to the application event handlers without
+ * being routed to the widgets.
+ *
+ * This function is thread safe, but can be used only after the main loop has
+ * been initialized.
+ *
+ * @param ev An event to be posted.
+ * @return Zero on success, non-zero otherwise.
+ */
+int gp_app_ev_post(const gp_event *ev);
+
 #endif /* WIDGETS_GP_APP_TASK_H */
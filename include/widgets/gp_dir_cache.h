@@ -30,9 +30,9 @@ typedef struct gp_dir_entry {
 	/** @brief Length of the entry name. */
 	unsigned int name_len;
 	/** @brief Set if entry is a directory. */
-	int is_dir:1;
+	unsigned int is_dir:1;
 	/** @brief If set the entry is hidden from listing. */
-	int filtered:1;
+	unsigned int filtered:1;
 	/** @brief Entry name. */
 	char name[];
 } gp_dir_entry;
@@ -65,6 +65,19 @@ typedef struct gp_dir_cache {
 	size_t used;
 	/** @brief An array of dir cache entres sorted accordingly to sort_type. */
 	gp_dir_entry **entries;
+	/**
+	 * @brief Not filtered entries in the same order as in entries.
+	 *
+	 * Updated on insert and remove, rebuilt lazily after the filter flags
+	 * has been changed.
+	 */
+	gp_dir_entry **entries_filter;
+	/** @brief A hash table to look up entries by name. */
+	struct gp_htable *names;
+	/** @brief Set once the entries were sorted, new entries are inserted in order. */
+	unsigned int sorted:1;
+	/** @brief Set when gp_dir_cache::entries_filter has to be rebuilt. */
+	unsigned int filter_dirty:1;
 } gp_dir_cache;
 
 /**
@@ -95,6 +108,9 @@ void gp_dir_cache_destroy(gp_dir_cache *self);
  *
  * This function is called by the platform code.
  *
+ * Once the cache has been sorted the entry is inserted in the sort order. If
+ * an entry with the same name exists it's replaced.
+ *
  * @param self A directory cache to add the entry to
  * @param size A file size in bytes
  * @param name A file name
@@ -121,6 +137,9 @@ int gp_dir_cache_rem_entry_by_name(gp_dir_cache *self, const char *name);
 /**
  * @brief Looks up an entry based on a file name
  *
+ * Directory entries can be looked up both with and without the trailing
+ * slash.
+ *
  * @param self A directory cache.
  * @param name An entry name to look for.
  *
@@ -190,6 +209,7 @@ static inline void gp_dir_cache_set_filter(gp_dir_cache *self, unsigned int pos,
 
 	self->entries[pos]->filtered = !!filter;
 	self->filtered += filter ? 1 : -1;
+	self->filter_dirty = 1;
 }
 
 /**
@@ -219,6 +239,9 @@ static inline size_t gp_dir_cache_entries_filter(gp_dir_cache *self)
 /**
  * @brief Returns entry on position pos ignoring filtered out elements.
  *
+ * Runs in O(1) unless filter flags were changed since the last call, then the
+ * index of not filtered entries is rebuilt first.
+ *
  * @param self A directory cache.
  * @param pos Element position in the gp_dir_cache::entries array.
  *
@@ -150,6 +150,13 @@ struct gp_widget {
 	 */
 	uint32_t event_mask;
 
+	/**
+	 * @brief A render timer started by gp_widget_render_timer().
+	 *
+	 * @warning This is internal API do not use in applications!
+	 */
+	struct gp_timer *timer;
+
 	/**
 	 * @brief Private widget data area.
 	 *
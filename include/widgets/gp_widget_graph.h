@@ -2,7 +2,7 @@
 
 /*
 
-   Copyright (c) 2014-2024 Cyril Hrubis <metan@ucw.cz>
+   Copyright (c) 2014-2026 Cyril Hrubis <metan@ucw.cz>
 
  */
 
@@ -10,6 +10,11 @@
  * @file gp_widget_graph.h
  * @brief An XY graph.
  *
+ * The graph range is maintained incrementally when points are added, hence
+ * adding a point is O(1) amortized regardless of the number of data points.
+ * When there is more data points than the graph width in pixels only the
+ * minimum and maximum for each pixel column is drawn.
+ *
  * Graph widget JSON attributes
  * ----------------------------
  *
@@ -97,6 +102,20 @@ gp_widget *gp_widget_graph_new(gp_widget_size min_w, gp_widget_size min_h,
  */
 void gp_widget_graph_point_add(gp_widget *self, double x, double y);
 
+/**
+ * @brief Adds an array of graph points.
+ *
+ * Same as calling gp_widget_graph_point_add() for each point but the graph
+ * range is updated and the widget is scheduled for a redraw only once.
+ *
+ * @param self A graph widget.
+ * @param points An array of graph points.
+ * @param points_cnt A number of points in the array.
+ */
+void gp_widget_graph_points_add(gp_widget *self,
+                                const struct gp_widget_graph_point *points,
+                                size_t points_cnt);
+
 /**
  * @brief Sets a graph style.
  *
@@ -145,6 +164,21 @@ void gp_widget_graph_ymax_set(gp_widget *self, double max_y);
  */
 void gp_widget_graph_yrange_clear(gp_widget *self);
 
+/**
+ * @brief Returns current graph range.
+ *
+ * In autorange mode the range spans the data points currently stored in the
+ * graph, otherwise the y range is the one set by the application.
+ *
+ * @param self A graph widget.
+ * @param min_x Filled with the x minimum, may be NULL.
+ * @param max_x Filled with the x maximum, may be NULL.
+ * @param min_y Filled with the y minimum, may be NULL.
+ * @param max_y Filled with the y maximum, may be NULL.
+ */
+void gp_widget_graph_range_get(gp_widget *self, double *min_x, double *max_x,
+                               double *min_y, double *max_y);
+
 /**
  * @brief Sets graph color.
  *
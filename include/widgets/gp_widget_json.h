@@ -69,6 +69,10 @@ struct gp_widget_json_callbacks {
 
 /**
  * @brief A context to propagate values top down and bottom up.
+ *
+ * The context is created by the layout loader, e.g. gp_widget_layout_json(),
+ * and passed down to the widget JSON parsers. It must not be created by the
+ * application since the loader stores additional private data along with it.
  */
 struct gp_widget_json_ctx {
 	/**
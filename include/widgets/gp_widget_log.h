@@ -14,6 +14,7 @@
  *
  * |   Attribute    |  Type  | Default | Description                                                      |
  * |----------------|--------|---------|------------------------------------------------------------------|
+ * |  **max_bytes** |  uint  |         | A size of the log text buffer in bytes.                          |
  * |  **max_logs**  |  uint  |         | A maximal number of log lines the widget can store.              |
  * |  **min_lines** |  uint  |   25    | A minimal number of log lines visible on the screen.             |
  * |  **min_width** |  uint  |   80    | A minimal widget width in text characters.                       |
@@ -34,11 +35,65 @@
  */
 void gp_widget_log_append(gp_widget *self, const char *text);
 
+/**
+ * @brief Appends an array of lines to the log.
+ *
+ * Appends all lines and schedules a single redraw, which is much faster than
+ * calling gp_widget_log_append() in a loop for a large number of lines.
+ *
+ * @param self A log widget.
+ * @param lines An array of lines to be appended.
+ * @param lines_cnt A number of lines in the array.
+ */
+void gp_widget_log_append_lines(gp_widget *self, const char *const lines[],
+                                size_t lines_cnt);
+
+/**
+ * @brief Returns a number of lines stored in the log.
+ *
+ * @param self A log widget.
+ * @return A number of lines.
+ */
+size_t gp_widget_log_lines(gp_widget *self);
+
+/**
+ * @brief Returns a log line.
+ *
+ * The pointer is valid until the next append to the log.
+ *
+ * @param self A log widget.
+ * @param idx A line index, 0 is the oldest line stored in the log.
+ * @return A log line or NULL if idx is out of range.
+ */
+const char *gp_widget_log_line(gp_widget *self, size_t idx);
+
+/**
+ * @brief Allocates a log widget.
+ *
+ * The log text is stored in a single circular buffer of max_bytes size, the
+ * log lines are indexed by a circular buffer of max_logs entries. When either
+ * of them is full the oldest lines are removed from the log. Lines longer
+ * than the text buffer are truncated.
+ *
+ * @param tattr Text attributes
+ * @param min_width Minimal width in letters
+ * @param min_lines Minimal number of lines
+ * @param max_logs Maximal number of log lines stored internally, if zero
+ *                 it's derived from max_bytes.
+ * @param max_bytes Size of the log text buffer in bytes, if zero it's derived
+ *                  from max_logs.
+ *
+ * @return Newly allocated log widget.
+ */
+gp_widget *gp_widget_log_new_ex(gp_widget_tattr tattr,
+                                unsigned int min_width, unsigned int min_lines,
+                                size_t max_logs, size_t max_bytes);
+
 /**
  * @brief Allocates a log widget.
  *
- * The log widget is a circular buffer of loglines, when size reaches the
- * max_log_lines the oldest message gets removed from the log.
+ * This is a shortcut for gp_widget_log_new_ex() with the text buffer size
+ * derived from the max_logs.
  *
  * @param tattr Text attributes
  * @param min_width Minimal width in letters
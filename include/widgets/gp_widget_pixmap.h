@@ -179,4 +179,30 @@ gp_pixmap *gp_widget_pixmap_get(gp_widget *self);
  */
 gp_pixmap *gp_widget_pixmap_set(gp_widget *self, gp_pixmap *pixmap);
 
+/**
+ * @brief Renders a backing pixmap in a background thread.
+ *
+ * The render callback is called from a worker thread, see gp_app_job.h, with
+ * the current widget size and pixel type and has to return a newly allocated
+ * pixmap. Once the job has finished the pixmap is set as a backing pixmap and
+ * the widget is repainted. If the widget was resized in the meantime the
+ * render callback is called again with the new size.
+ *
+ * Calling this function while a previous render is in progress cancels the
+ * previous render.
+ *
+ * The pixmap rendered this way is owned by the widget and freed when the widget
+ * is freed or when it's replaced, the application must not free it.
+ *
+ * @param self A pixmap widget.
+ * @param render A render callback, runs in a worker thread.
+ * @param priv A private pointer passed to the render callback.
+ * @return Zero on success, non-zero on a failure.
+ */
+int gp_widget_pixmap_render_async(gp_widget *self,
+                                  gp_pixmap *(*render)(gp_size w, gp_size h,
+                                                       gp_pixel_type type,
+                                                       void *priv),
+                                  void *priv);
+
 #endif /* GP_WIDGET_PIXMAP_H */
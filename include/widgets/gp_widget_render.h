@@ -19,6 +19,7 @@
 #include <text/gp_text.h>
 #include <utils/gp_timer.h>
 #include <utils/gp_bbox.h>
+#include <utils/gp_damage.h>
 
 #include <widgets/gp_widget_types.h>
 #include <widgets/gp_widgets_color_scheme.h>
@@ -115,8 +116,8 @@ struct gp_widget_render_ctx {
 	uint16_t dclick_ms;
 	/* feedback delay, how long should be button pressed, tbox red etc */
 	uint16_t feedback_ms;
-	/* area to update on a screen after a call to gp_widget_render() */
-	gp_bbox *flip;
+	/* areas to update on a screen after a call to gp_widget_render() */
+	gp_damage *flip;
 
 	/* passed down if only part of the layout has to be rendered */
 	gp_bbox *bbox;
@@ -13,6 +13,21 @@
  * The table content is not stored in the widget, instead there are callbacks
  * that are called to get the cells content when table is being rendered.
  *
+ * Virtual tables
+ * --------------
+ *
+ * For tables with a large number of rows the application should set the
+ * number of rows with gp_widget_table_rows_set(). In that case the widget
+ * does not walk the rows with the seek function in order to count them, only
+ * the rows that are visible on the screen are seeked to and retrieved. The
+ * column widths are then computed from a bounded sample of rows as well.
+ *
+ * Sorting large tables may take a long time, for that case an incremental
+ * gp_widget_table_col_ops::sort_step() callback can be implemented. The
+ * sorting is then split into steps that run in an application task so that
+ * the application stays responsive and the progress is shown under the table
+ * header.
+ *
  * Table JSON attributes
  * ---------------------
  *
@@ -39,6 +54,7 @@
 #define GP_WIDGET_TABLE_H
 
 #include <core/gp_compiler.h>
+#include <input/gp_task.h>
 
 /** @brief Table row operation. */
 enum gp_widget_table_row_op {
@@ -129,6 +145,22 @@ typedef struct gp_widget_table_col_ops {
 	 * @param col_idx An column index for the column.
 	 */
 	void (*sort)(gp_widget *self, int desc, unsigned int col_idx);
+	/**
+	 * @brief Optional incremental sort.
+	 *
+	 * If set it's used instead of the sort() callback. It's called
+	 * repeatedly from an application task until it returns 100 and each
+	 * call should do only a bounded amount of work.
+	 *
+	 * @param self A table widget.
+	 * @param desc If non-zero table is sorted in descending order.
+	 * @param col_idx An column index for the column.
+	 * @param restart Set on the first call for a sort request, any partial
+	 *                state from a previous request has to be discarded.
+	 *
+	 * @return A sort progress in percents, 100 when the sort is finished.
+	 */
+	unsigned int (*sort_step)(gp_widget *self, int desc, unsigned int col_idx, int restart);
 
 	/**
 	 * @brief Optional on_event handler.
@@ -226,6 +258,16 @@ typedef struct gp_widget_table {
 	unsigned int start_row;
 	unsigned int last_rows;
 
+	/** Number of rows set by gp_widget_table_rows_set() */
+	unsigned int rows;
+	int rows_set:1;
+
+	/** Incremental sort state */
+	int sort_running:1;
+	int sort_restart:1;
+	unsigned int sort_progress;
+	gp_task sort_task;
+
 	gp_widget_table_col_size *cols_w;
 
 	gp_widget_table_priv priv;
@@ -270,6 +312,28 @@ gp_widget *gp_widget_table_new(unsigned int cols, unsigned int min_rows,
  */
 void gp_widget_table_sort_by(gp_widget *self, int desc, unsigned int col);
 
+/**
+ * @brief Sets the number of table rows.
+ *
+ * Switches the table into a virtual mode, the widget no longer counts the
+ * rows by the seek function, which is O(n) for iterator based tables, and
+ * only the visible rows are retrieved on render.
+ *
+ * Application has to call this each time the number of rows changes.
+ *
+ * @param self A table widget.
+ * @param rows A number of rows in the table.
+ */
+void gp_widget_table_rows_set(gp_widget *self, unsigned int rows);
+
+/**
+ * @brief Returns true if incremental sort is in progress.
+ *
+ * @param self A table widget.
+ * @return True if gp_widget_table_col_ops::sort_step() is still running.
+ */
+bool gp_widget_table_sorting(gp_widget *self);
+
 /**
  * @brief Request table widget refres.
  *
@@ -58,6 +58,7 @@
 #include <widgets/gp_app_timer.h>
 #include <widgets/gp_app_poll.h>
 #include <widgets/gp_app_task.h>
+#include <widgets/gp_app_job.h>
 
 #include <widgets/gp_widget_tattr.h>
 #include <widgets/gp_widget_size_units.h>
@@ -6,6 +6,8 @@
 #include <inttypes.h>
 #include <poll.h>
 
+#include "../../config.h"
+
 #include "core/gp_common.h"
 #include <core/gp_transform.h>
 #include "core/gp_pixmap.h"
@@ -18,14 +20,15 @@
 #include <backends/gp_clipboard.h>
 #include <backends/gp_backend_input.h>
 
-void gp_backend_update_rect_xyxy(gp_backend *self,
-                                 gp_coord x0, gp_coord y0,
-                                 gp_coord x1, gp_coord y1)
+/*
+ * Transforms a rectangle into the display coordinates and clips it to the
+ * pixmap size, returns non-zero if the rectangle is outside of the pixmap.
+ */
+static int transform_clip_rect(gp_backend *self,
+                               gp_coord *rx0, gp_coord *ry0,
+                               gp_coord *rx1, gp_coord *ry1)
 {
-	if (!self->update_rect) {
-		gp_backend_update(self);
-		return;
-	}
+	gp_coord x0 = *rx0, y0 = *ry0, x1 = *rx1, y1 = *ry1;
 
 	GP_TRANSFORM_POINT(self->pixmap, x0, y0);
 	GP_TRANSFORM_POINT(self->pixmap, x1, y1);
@@ -39,7 +42,7 @@ void gp_backend_update_rect_xyxy(gp_backend *self,
 	if (x0 < 0) {
 		if (x1 < 0) {
 			GP_WARN("Both x0 and x1 are negative, skipping update");
-			return;
+			return 1;
 		}
 		GP_WARN("Negative x0 coordinate %i, clipping to 0", x0);
 		x0 = 0;
@@ -48,7 +51,7 @@ void gp_backend_update_rect_xyxy(gp_backend *self,
 	if (y0 < 0) {
 		if (y1 < 0) {
 			GP_WARN("Both y0 and y1 are negative, skipping update");
-			return;
+			return 1;
 		}
 		GP_WARN("Negative y0 coordinate %i, clipping to 0", y0);
 		y0 = 0;
@@ -59,7 +62,7 @@ void gp_backend_update_rect_xyxy(gp_backend *self,
 	if (x1 >= w) {
 		if (x0 >= w) {
 			GP_WARN("Both x0 and x1 are >= w, skipping update");
-			return;
+			return 1;
 		}
 		GP_WARN("Too large x1 coordinate %i, clipping to %u", x1, w - 1);
 		x1 = w - 1;
@@ -70,15 +73,77 @@ void gp_backend_update_rect_xyxy(gp_backend *self,
 	if (y1 >= h) {
 		if (y0 >= h) {
 			GP_WARN("Both y0 and y1 are >= h, skipping update");
-			return;
+			return 1;
 		}
 		GP_WARN("Too large y1 coordinate %i, clipping to %u", y1, h - 1);
 		y1 = h - 1;
 	}
 
+	*rx0 = x0;
+	*ry0 = y0;
+	*rx1 = x1;
+	*ry1 = y1;
+
+	return 0;
+}
+
+void gp_backend_update_rect_xyxy(gp_backend *self,
+                                 gp_coord x0, gp_coord y0,
+                                 gp_coord x1, gp_coord y1)
+{
+	if (!self->update_rect) {
+		gp_backend_update(self);
+		return;
+	}
+
+	if (transform_clip_rect(self, &x0, &y0, &x1, &y1))
+		return;
+
 	self->update_rect(self, x0, y0, x1, y1);
 }
 
+void gp_backend_update_rects(gp_backend *self, const gp_bbox *rects, unsigned int cnt)
+{
+	gp_bbox trects[GP_DAMAGE_RECTS_MAX];
+	unsigned int i, tcnt = 0;
+
+	if (!cnt)
+		return;
+
+	if (!self->update_rect) {
+		gp_backend_update(self);
+		return;
+	}
+
+	for (i = 0; i < cnt; i++) {
+		gp_coord x0 = rects[i].x;
+		gp_coord y0 = rects[i].y;
+		gp_coord x1 = x0 + (gp_coord)rects[i].w - 1;
+		gp_coord y1 = y0 + (gp_coord)rects[i].h - 1;
+
+		if (gp_bbox_empty(rects[i]))
+			continue;
+
+		if (transform_clip_rect(self, &x0, &y0, &x1, &y1))
+			continue;
+
+		if (!self->update_rects) {
+			self->update_rect(self, x0, y0, x1, y1);
+			continue;
+		}
+
+		trects[tcnt++] = gp_bbox_pack(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+
+		if (tcnt >= GP_DAMAGE_RECTS_MAX) {
+			self->update_rects(self, trects, tcnt);
+			tcnt = 0;
+		}
+	}
+
+	if (tcnt)
+		self->update_rects(self, trects, tcnt);
+}
+
 int gp_backend_resize(gp_backend *self, uint32_t w, uint32_t h)
 {
 	if (!self->set_attr)
@@ -413,6 +478,10 @@ void gp_backend_poll_add(gp_backend *self, gp_fd *fd)
 	gp_poll_add(&self->fds, fd);
 }
 
+#ifdef OS_LINUX
+void gp_backend_post_exit(gp_backend *self);
+#endif
+
 void gp_backend_exit(gp_backend *self)
 {
 	struct gp_clipboard op = {.op = GP_CLIPBOARD_CLEAR};
@@ -424,5 +493,9 @@ void gp_backend_exit(gp_backend *self)
 
 	gp_backend_input_destroy(self);
 
+#ifdef OS_LINUX
+	gp_backend_post_exit(self);
+#endif
+
 	self->exit(self);
 }
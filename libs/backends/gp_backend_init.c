@@ -382,11 +382,48 @@ static gp_backend *xcb_init(char *params,
 
 #include <backends/gp_linux_input.h>
 
+static int parse_proxy_params(char *params, const char **path,
+                              enum gp_proxy_init_flags *flags)
+{
+	char *param;
+
+	if (!params)
+		return 0;
+
+	do {
+		param = params;
+		params = next_param(params);
+
+		if (!strcasecmp(param, "async")) {
+			*flags |= GP_PROXY_INIT_ASYNC;
+			GP_DEBUG(1, "Proxy asynchronous updates enabled");
+			continue;
+		}
+
+		if (!strcasecmp(param, "swapchain")) {
+			*flags |= GP_PROXY_INIT_SWAPCHAIN;
+			GP_DEBUG(1, "Proxy swapchain enabled");
+			continue;
+		}
+
+		if (*param)
+			*path = param;
+	} while (params);
+
+	return 0;
+}
+
 static gp_backend *proxy_init(char *params,
                               gp_size GP_UNUSED(pref_w), gp_size GP_UNUSED(pref_h),
                               const char *caption)
 {
-	return gp_proxy_init(params, caption);
+	enum gp_proxy_init_flags flags = 0;
+	const char *path = NULL;
+
+	if (parse_proxy_params(params, &path, &flags))
+		return NULL;
+
+	return gp_proxy_init_ex(path, caption, flags);
 }
 
 static gp_backend *display_init(char *params,
@@ -502,8 +539,11 @@ static struct backend_init backends[] = {
 #ifdef OS_LINUX
 	{.name = "proxy",
 	 .init = proxy_init,
-	 .usage = "path",
-	 .help = {"path - Path to an UNIX socket"}
+	 .usage = "proxy:[async]:[swapchain]:[path]",
+	 .help = {"async     - Asynchronous screen updates",
+	          "swapchain - Render into a swapchain, frames are presented on flip",
+	          "path      - Path to an UNIX socket",
+	          NULL}
 	},
 	{.name = "display",
 	 .init = display_init,
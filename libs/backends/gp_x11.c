@@ -75,6 +75,33 @@ static void x11_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
 	XUnlockDisplay(win->dpy);
 }
 
+static void x11_update_rects(gp_backend *self, const gp_bbox *rects,
+                             unsigned int cnt)
+{
+	struct x11_win *win = GP_BACKEND_PRIV(self);
+	unsigned int i;
+
+	GP_DEBUG(4, "Updating %u rects", cnt);
+
+	if (win->resized_flag) {
+		GP_DEBUG(4, "Ignoring update rects, waiting for resize ack");
+		return;
+	}
+
+	XLockDisplay(win->dpy);
+
+	for (i = 0; i < cnt; i++) {
+		putimage(win, rects[i].x, rects[i].y,
+		         rects[i].x + rects[i].w - 1, rects[i].y + rects[i].h - 1);
+	}
+
+	XFlush(win->dpy);
+
+	process_events(win, self);
+
+	XUnlockDisplay(win->dpy);
+}
+
 static void x11_set_pixmap(gp_backend *self)
 {
 	struct x11_win *win = GP_BACKEND_PRIV(self);
@@ -768,6 +795,7 @@ gp_backend *gp_x11_init(const char *display, int x, int y,
 	backend->name = "X11";
 	backend->update = x11_update;
 	backend->update_rect = x11_update_rect;
+	backend->update_rects = x11_update_rects;
 	backend->exit = x11_exit;
 	backend->set_attr = x11_set_attr;
 	backend->clipboard = x11_clipboard;
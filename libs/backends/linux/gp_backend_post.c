@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/eventfd.h>
+
+#include <core/gp_debug.h>
+#include <utils/gp_mpsc.h>
+#include <input/gp_ev_queue.h>
+#include <backends/gp_backend.h>
+
+struct gp_backend_post {
+	gp_mpsc queue;
+	gp_fd fd;
+};
+
+struct post_msg {
+	gp_mpsc_node node;
+	gp_task *task;
+	gp_event ev;
+};
+
+static void post_process(gp_backend *self, struct post_msg *msg)
+{
+	if (!msg->task) {
+		gp_ev_queue_put(self->event_queue, &msg->ev);
+		return;
+	}
+
+	if (!self->tasks) {
+		GP_WARN("Task '%s' posted but backend has no task queue",
+		        msg->task->id);
+		return;
+	}
+
+	if (msg->task->queued)
+		return;
+
+	gp_backend_task_ins(self, msg->task);
+}
+
+static int post_wakeup(struct gp_backend_post *post)
+{
+	uint64_t one = 1;
+
+	if (write(post->fd.fd, &one, sizeof(one)) < 0) {
+		GP_WARN("write(eventfd): %s", strerror(errno));
+		return 1;
+	}
+
+	return 0;
+}
+
+static enum gp_poll_event_ret post_event(gp_fd *self)
+{
+	gp_backend *backend = self->priv;
+	struct gp_backend_post *post = backend->post;
+	gp_mpsc_node *node;
+	uint64_t cnt;
+
+	if (read(self->fd, &cnt, sizeof(cnt)) < 0 && errno != EAGAIN)
+		GP_WARN("read(eventfd): %s", strerror(errno));
+
+	for (;;) {
+		/*
+		 * Leave the rest for later if the event queue is full, the
+		 * eventfd is signaled again so that we are woken up once the
+		 * application has processed the queued events.
+		 */
+		if (gp_ev_queue_full(backend->event_queue)) {
+			post_wakeup(post);
+			break;
+		}
+
+		node = gp_mpsc_pop(&post->queue);
+		if (!node)
+			break;
+
+		struct post_msg *msg = GP_CONTAINER_OF(node, struct post_msg, node);
+
+		post_process(backend, msg);
+		free(msg);
+	}
+
+	return GP_POLL_RET_OK;
+}
+
+int gp_backend_post_init(gp_backend *self)
+{
+	struct gp_backend_post *post;
+	int fd;
+
+	if (self->post)
+		return 0;
+
+	post = malloc(sizeof(*post));
+	if (!post) {
+		GP_WARN("Malloc failed :(");
+		return 1;
+	}
+
+	fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (fd < 0) {
+		GP_WARN("eventfd(): %s", strerror(errno));
+		free(post);
+		return 1;
+	}
+
+	gp_mpsc_init(&post->queue);
+
+	post->fd = (gp_fd) {
+		.fd = fd,
+		.event = post_event,
+		.events = GP_POLLIN,
+		.priv = self,
+	};
+
+	self->post = post;
+
+	gp_backend_poll_add(self, &post->fd);
+
+	return 0;
+}
+
+void gp_backend_post_exit(gp_backend *self)
+{
+	struct gp_backend_post *post = self->post;
+	gp_mpsc_node *node;
+
+	if (!post)
+		return;
+
+	gp_backend_poll_rem(self, &post->fd);
+	close(post->fd.fd);
+
+	while ((node = gp_mpsc_pop(&post->queue)))
+		free(GP_CONTAINER_OF(node, struct post_msg, node));
+
+	free(post);
+	self->post = NULL;
+}
+
+static int post_msg(gp_backend *self, struct post_msg *msg)
+{
+	gp_mpsc_push(&self->post->queue, &msg->node);
+
+	return post_wakeup(self->post);
+}
+
+static struct post_msg *msg_alloc(gp_backend *self)
+{
+	struct post_msg *msg;
+
+	if (!self->post) {
+		GP_WARN("Backend post queue not initialized");
+		return NULL;
+	}
+
+	msg = malloc(sizeof(*msg));
+	if (!msg)
+		GP_WARN("Malloc failed :(");
+
+	return msg;
+}
+
+int gp_backend_task_post(gp_backend *self, gp_task *task)
+{
+	struct post_msg *msg = msg_alloc(self);
+
+	if (!msg)
+		return 1;
+
+	msg->task = task;
+
+	return post_msg(self, msg);
+}
+
+int gp_backend_ev_post(gp_backend *self, const gp_event *ev)
+{
+	struct post_msg *msg = msg_alloc(self);
+
+	if (!msg)
+		return 1;
+
+	msg->task = NULL;
+	msg->ev = *ev;
+
+	return post_msg(self, msg);
+}
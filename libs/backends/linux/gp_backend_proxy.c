@@ -16,6 +16,9 @@
 #include <sys/mman.h>
 #include <core/gp_debug.h>
 #include <core/gp_pixmap.h>
+#include <core/gp_blit.h>
+#include <utils/gp_bbox.h>
+#include <utils/gp_damage.h>
 #include <backends/gp_backend.h>
 #include <backends/gp_proxy_proto.h>
 #include <backends/gp_proxy_conn.h>
@@ -23,6 +26,10 @@
 
 #define UPDATE_COOKIES_MAX 16
 
+#if GP_DAMAGE_RECTS_MAX > GP_PROXY_RECTS_MAX
+# error Damage does not fit into a single update message
+#endif
+
 struct proxy_priv {
 	struct gp_proxy_buf buf;
 
@@ -44,6 +51,29 @@ struct proxy_priv {
 	uint32_t update_cookies[UPDATE_COOKIES_MAX];
 	unsigned int update_cookies_cnt;
 
+	/* asynchronous updates */
+	unsigned int async:1;
+	unsigned int async_inflight:1;
+	uint32_t async_cookie;
+	/*
+	 * damage accumulated while an update is in flight or since the last
+	 * frame was presented in the swapchain mode
+	 */
+	gp_damage damage;
+
+	/* swapchain, used when enabled and server sends more than one buffer */
+	unsigned int swapchain:1;
+	unsigned int bufs;
+	size_t buf_stride;
+	/* buffer we render into */
+	unsigned int back;
+	/* last presented buffer */
+	unsigned int presented;
+	/* bitmask of buffers owned by the server */
+	unsigned int busy;
+	/* areas that are out of date in each buffer */
+	gp_damage stale[GP_PROXY_BUFS_MAX];
+
 	/* mapped memory backing the pixmap */
 	void *map;
 	size_t map_size;
@@ -104,7 +134,11 @@ static void map_buffer(gp_backend *self, union gp_proxy_msg *msg)
 	}
 
 	priv->map = p;
-	priv->map_size = msg->map.size;
+	priv->map_size = size;
+	priv->bufs = 1;
+	priv->back = 0;
+	priv->busy = 0;
+	self->flip_presents = 0;
 
 	gp_proxy_send(priv->fd.fd, GP_PROXY_MAP, NULL);
 }
@@ -126,6 +160,13 @@ static void hidden(gp_backend *self)
 
 	priv->visible = 0;
 
+	/* Server does not reply to updates for hidden clients */
+	priv->async_inflight = 0;
+	gp_damage_clear(&priv->damage);
+
+	/* All buffers are released on hide */
+	priv->busy = 0;
+
 	gp_ev_queue_push_render_stop(self->event_queue, 0);
 }
 
@@ -156,6 +197,7 @@ static void init_pixmap(gp_backend *self, union gp_proxy_msg *msg)
 
 	priv->shm_pixmap = msg->pix.pix;
 	priv->shm_pixmap.pixels = priv->map;
+	priv->back = 0;
 
 	GP_DEBUG(1, "Pixmap %ux%u initialized", msg->pix.pix.w, msg->pix.pix.h);
 
@@ -165,6 +207,57 @@ static void init_pixmap(gp_backend *self, union gp_proxy_msg *msg)
 	gp_ev_queue_push_resize(self->event_queue, msg->pix.pix.w, msg->pix.pix.h, 0);
 }
 
+static void init_bufs(gp_backend *self, union gp_proxy_msg *msg)
+{
+	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
+	struct gp_proxy_bufs *bufs = &msg->bufs.bufs;
+	size_t buf_size = (size_t)priv->shm_pixmap.bytes_per_row * priv->shm_pixmap.h;
+	unsigned int i;
+
+	if (!priv->map) {
+		GP_WARN("Buffer not mapped!");
+		return;
+	}
+
+	if (!priv->swapchain) {
+		GP_DEBUG(1, "Swapchain not enabled, rendering into first buffer");
+		return;
+	}
+
+	if (!bufs->cnt || bufs->cnt > GP_PROXY_BUFS_MAX ||
+	    bufs->stride < buf_size ||
+	    bufs->stride * bufs->cnt > priv->map_size) {
+		GP_WARN("Invalid buffers cnt %"PRIu32" stride %"PRIu64,
+		        bufs->cnt, bufs->stride);
+		return;
+	}
+
+	priv->bufs = bufs->cnt;
+	priv->buf_stride = bufs->stride;
+	priv->back = 0;
+	priv->busy = 0;
+
+	gp_damage_clear(&priv->damage);
+
+	for (i = 0; i < priv->bufs; i++)
+		gp_damage_clear(&priv->stale[i]);
+
+	priv->shm_pixmap.pixels = priv->map;
+	self->flip_presents = priv->bufs > 1;
+
+	GP_DEBUG(1, "Swapchain with %u buffers initialized", priv->bufs);
+}
+
+static void release_buf(struct proxy_priv *priv, uint32_t buf)
+{
+	if (buf >= priv->bufs) {
+		GP_WARN("Invalid buffer %"PRIu32" released", buf);
+		return;
+	}
+
+	priv->busy &= ~(1u<<buf);
+}
+
 /*
  * Inserts update cookie into the array of cookies.
  */
@@ -220,6 +313,56 @@ static int update_cookie_clear(struct proxy_priv *priv, uint32_t cookie)
 	return 1;
 }
 
+/* Serializes reading from the connection and the asynchronous update state */
+static pthread_mutex_t proxy_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Sends the accumulated damage unless there is an update in flight. Has to be
+ * called with the proxy_mutex locked.
+ */
+static void damage_flush(struct proxy_priv *priv)
+{
+	struct gp_proxy_rects rects;
+	unsigned int i;
+
+	if (priv->async_inflight || gp_damage_empty(&priv->damage) || !priv->visible)
+		return;
+
+	rects.cookie = ++priv->async_cookie;
+	rects.cnt = priv->damage.cnt;
+
+	for (i = 0; i < priv->damage.cnt; i++) {
+		rects.rects[i] = (struct gp_proxy_rect) {
+			.x = priv->damage.rects[i].x,
+			.y = priv->damage.rects[i].y,
+			.w = priv->damage.rects[i].w,
+			.h = priv->damage.rects[i].h,
+		};
+	}
+
+	GP_DEBUG(4, "Sending GP_PROXY_UPDATE_RECTS cnt %u cookie %" PRIu32,
+	         rects.cnt, rects.cookie);
+
+	gp_damage_clear(&priv->damage);
+
+	if (gp_proxy_send(priv->fd.fd, GP_PROXY_UPDATE_RECTS, &rects))
+		return;
+
+	priv->async_inflight = 1;
+}
+
+static void update_rects_done(struct proxy_priv *priv, uint32_t cookie)
+{
+	if (!priv->async_inflight || cookie != priv->async_cookie) {
+		GP_WARN("Unexpected update rects cookie %" PRIu32, cookie);
+		return;
+	}
+
+	priv->async_inflight = 0;
+
+	damage_flush(priv);
+}
+
 /**
  * @brief Receives data and parses them into event(s).
  *
@@ -303,6 +446,21 @@ static int proxy_recv_events(gp_fd *self, int block)
 				 msg->rect.rect.cookie);
 			update_cookie_add(priv, msg->rect.rect.cookie);
 		break;
+		case GP_PROXY_UPDATE_RECTS:
+			GP_DEBUG(4, "Got GP_PROXY_UPDATE_RECTS cookie = %u",
+			         msg->rects.rects.cookie);
+			update_rects_done(priv, msg->rects.rects.cookie);
+		break;
+		case GP_PROXY_BUFFERS:
+			GP_DEBUG(4, "Got GP_PROXY_BUFFERS cnt = %u",
+			         msg->bufs.bufs.cnt);
+			init_bufs(backend, msg);
+		break;
+		case GP_PROXY_RELEASE:
+			GP_DEBUG(4, "Got GP_PROXY_RELEASE buf = %u",
+			         msg->release.buf);
+			release_buf(priv, msg->release.buf);
+		break;
 		}
 	}
 
@@ -311,16 +469,14 @@ static int proxy_recv_events(gp_fd *self, int block)
 
 static int proxy_recv_events_mt(gp_backend *self, int block, int check_cookie, uint32_t cookie)
 {
-	static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
-
 	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
 	int ret = 0;
 
 	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
-	pthread_mutex_lock(&mutex);
+	pthread_mutex_lock(&proxy_mutex);
 	if (!check_cookie || update_cookie_get(priv, cookie) < 0)
 		ret = proxy_recv_events(&priv->fd, block);
-	pthread_mutex_unlock(&mutex);
+	pthread_mutex_unlock(&proxy_mutex);
 	pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
 
 	return ret;
@@ -335,22 +491,106 @@ static enum gp_poll_event_ret proxy_process_fd(gp_fd *self)
 	return 0;
 }
 
-static void proxy_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
-                             gp_coord x1, gp_coord y1)
+static gp_pixmap buf_pixmap(struct proxy_priv *priv, unsigned int buf)
 {
-	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
-	static uint32_t cookie;
+	gp_pixmap ret = priv->shm_pixmap;
 
-	if (!priv->visible) {
-		GP_DEBUG(4, "Not visible!");
+	ret.pixels = (uint8_t*)priv->map + buf * priv->buf_stride;
+
+	return ret;
+}
+
+static int acquire_buf(struct proxy_priv *priv)
+{
+	unsigned int i;
+
+	for (i = 0; i < priv->bufs; i++) {
+		if (!(priv->busy & (1u<<i)))
+			return i;
+	}
+
+	return -1;
+}
+
+/*
+ * Presents the back buffer and switches to a buffer that is not owned by the
+ * server, blocks only when the server holds all of the buffers. Has to be
+ * called with the proxy_mutex locked.
+ */
+static void swap_buffers(struct proxy_priv *priv, const gp_bbox *rects, unsigned int cnt)
+{
+	struct gp_proxy_present present = {
+		.buf = priv->back,
+		.rects = {.cnt = cnt},
+	};
+	unsigned int i, j;
+	int back;
+
+	for (i = 0; i < cnt; i++) {
+		present.rects.rects[i] = (struct gp_proxy_rect) {
+			.x = rects[i].x,
+			.y = rects[i].y,
+			.w = rects[i].w,
+			.h = rects[i].h,
+		};
+	}
+
+	for (i = 0; i < priv->bufs; i++) {
+		if (i == priv->back)
+			continue;
+
+		for (j = 0; j < cnt; j++)
+			gp_damage_add(&priv->stale[i], rects[j]);
+	}
+
+	GP_DEBUG(4, "Sending GP_PROXY_PRESENT buf %u", priv->back);
+
+	if (gp_proxy_send(priv->fd.fd, GP_PROXY_PRESENT, &present))
 		return;
+
+	priv->busy |= 1u<<priv->back;
+	priv->presented = priv->back;
+
+	while ((back = acquire_buf(priv)) < 0) {
+		if (proxy_recv_events(&priv->fd, 1) <= 0)
+			return;
 	}
 
+	/* Hidden while waiting, the buffers were swapped or unmapped */
+	if (!priv->visible || priv->presented >= priv->bufs)
+		return;
+
+	gp_damage *stale = &priv->stale[back];
+	gp_pixmap src = buf_pixmap(priv, priv->presented);
+	gp_pixmap dst = buf_pixmap(priv, back);
+
+	for (i = 0; i < stale->cnt; i++) {
+		gp_bbox *box = &stale->rects[i];
+
+		gp_blit_xywh_raw(&src, box->x, box->y, box->w, box->h,
+		                 &dst, box->x, box->y);
+	}
+
+	gp_damage_clear(stale);
+
+	priv->back = back;
+	priv->shm_pixmap.pixels = buf_pixmap(priv, back).pixels;
+}
+
+/*
+ * Sends a single rectangle update and waits for the server to finish reading
+ * the shared memory.
+ */
+static void update_rect_sync(gp_backend *self, gp_bbox box)
+{
+	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
+	static uint32_t cookie;
+
 	struct gp_proxy_rect rect = {
-		.x = x0,
-		.y = y0,
-		.w = x1 - x0 + 1,
-		.h = y1 - y0 + 1,
+		.x = box.x,
+		.y = box.y,
+		.w = box.w,
+		.h = box.h,
 		.cookie = ++cookie,
 	};
 
@@ -362,11 +602,110 @@ static void proxy_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
 		proxy_recv_events_mt(self, 1, 1, cookie);
 }
 
+/*
+ * In the asynchronous mode pushes all rectangles in a single message without
+ * waiting for the server. The synchronous mode sends a GP_PROXY_UPDATE per
+ * rectangle, which is understood by all servers.
+ *
+ * In the swapchain mode the rectangles are only recorded and presented with
+ * the next frame.
+ */
+static void proxy_update_rects(gp_backend *self, const gp_bbox *rects,
+                               unsigned int cnt)
+{
+	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
+	unsigned int i;
+
+	if (!priv->visible) {
+		GP_DEBUG(4, "Not visible!");
+		return;
+	}
+
+	if (priv->bufs <= 1 && !priv->async) {
+		for (i = 0; i < cnt; i++)
+			update_rect_sync(self, rects[i]);
+		return;
+	}
+
+	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+	pthread_mutex_lock(&proxy_mutex);
+
+	for (i = 0; i < cnt; i++)
+		gp_damage_add(&priv->damage, rects[i]);
+
+	if (priv->bufs <= 1)
+		damage_flush(priv);
+
+	pthread_mutex_unlock(&proxy_mutex);
+	pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+}
+
+static void proxy_update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
+                             gp_coord x1, gp_coord y1)
+{
+	gp_bbox box = gp_bbox_pack(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+
+	proxy_update_rects(self, &box, 1);
+}
+
+/*
+ * Presents the back buffer with the damage recorded since the last frame, or
+ * the whole buffer if full is set, and switches to the next buffer.
+ */
+static void present_frame(gp_backend *self, int full)
+{
+	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
+	gp_damage frame;
+
+	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+	pthread_mutex_lock(&proxy_mutex);
+
+	if (!priv->visible || priv->bufs <= 1)
+		goto exit;
+
+	if (full) {
+		gp_damage_clear(&priv->damage);
+		gp_damage_add(&priv->damage,
+		              gp_bbox_pack(0, 0, priv->shm_pixmap.w, priv->shm_pixmap.h));
+	}
+
+	if (gp_damage_empty(&priv->damage))
+		goto exit;
+
+	frame = priv->damage;
+
+	gp_damage_clear(&priv->damage);
+
+	swap_buffers(priv, frame.rects, frame.cnt);
+exit:
+	pthread_mutex_unlock(&proxy_mutex);
+	pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+}
+
 static void proxy_update(gp_backend *self)
 {
+	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
+
+	if (priv->bufs > 1) {
+		present_frame(self, 1);
+		return;
+	}
+
 	proxy_update_rect(self, 0, 0, self->pixmap->w-1, self->pixmap->h-1);
 }
 
+static void proxy_flip(gp_backend *self)
+{
+	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
+
+	if (priv->bufs > 1) {
+		present_frame(self, gp_damage_empty(&priv->damage));
+		return;
+	}
+
+	proxy_update(self);
+}
+
 static int proxy_render_stopped(gp_backend *self)
 {
 	struct proxy_priv *priv = GP_BACKEND_PRIV(self);
@@ -389,7 +728,8 @@ static int proxy_render_stopped(gp_backend *self)
 	return 0;
 }
 
-gp_backend *gp_proxy_init(const char *path, const char *name)
+gp_backend *gp_proxy_init_ex(const char *path, const char *name,
+                             enum gp_proxy_init_flags flags)
 {
 	int fd;
 	gp_backend *ret;
@@ -431,7 +771,9 @@ gp_backend *gp_proxy_init(const char *path, const char *name)
 	ret->set_attr = proxy_set_attr;
 	ret->exit = proxy_exit;
 	ret->update_rect = proxy_update_rect;
+	ret->update_rects = proxy_update_rects;
 	ret->update = proxy_update;
+	ret->flip = proxy_flip;
 	ret->render_stopped = proxy_render_stopped;
 
 	priv->map = NULL;
@@ -439,6 +781,9 @@ gp_backend *gp_proxy_init(const char *path, const char *name)
 	priv->visible = 0;
 	priv->sys_quit_requested = 0;
 	priv->unmap_requested = 0;
+	priv->async = !!(flags & GP_PROXY_INIT_ASYNC);
+	priv->swapchain = !!(flags & GP_PROXY_INIT_SWAPCHAIN);
+	priv->bufs = 1;
 
 	gp_proxy_buf_init(&priv->buf);
 
@@ -461,3 +806,8 @@ gp_backend *gp_proxy_init(const char *path, const char *name)
 
 	return ret;
 }
+
+gp_backend *gp_proxy_init(const char *path, const char *name)
+{
+	return gp_proxy_init_ex(path, name, 0);
+}
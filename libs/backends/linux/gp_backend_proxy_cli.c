@@ -102,6 +102,31 @@ int gp_proxy_cli_msg(gp_proxy_cli *self, gp_proxy_msg **rmsg)
 		         msg->rect.rect.x, msg->rect.rect.y,
 			 msg->rect.rect.w, msg->rect.rect.h);
 	break;
+	case GP_PROXY_UPDATE_RECTS:
+		if (msg->rects.rects.cnt > GP_PROXY_RECTS_MAX ||
+		    msg->size < 8 + gp_proxy_rects_size(msg->rects.rects.cnt)) {
+			GP_WARN("Client (%p) '%s' fd %i invalid update rects",
+			        self, self->name, self->fd.fd);
+			return 1;
+		}
+
+		GP_DEBUG(4, "Client (%p) '%s' fd %i requested %u rects update cookie %u",
+			 self, self->name, self->fd.fd,
+		         msg->rects.rects.cnt, msg->rects.rects.cookie);
+	break;
+	case GP_PROXY_PRESENT:
+		if (msg->present.present.buf >= GP_PROXY_BUFS_MAX ||
+		    msg->present.present.rects.cnt > GP_PROXY_RECTS_MAX ||
+		    msg->size < 8 + gp_proxy_present_size(msg->present.present.rects.cnt)) {
+			GP_WARN("Client (%p) '%s' fd %i invalid present",
+			        self, self->name, self->fd.fd);
+			return 1;
+		}
+
+		GP_DEBUG(4, "Client (%p) '%s' fd %i presented buffer %u",
+			 self, self->name, self->fd.fd,
+		         msg->present.present.buf);
+	break;
 	case GP_PROXY_MAP:
 		GP_DEBUG(1, "Client (%p) '%s' fd %i mapped buffer",
 		         self, self->name, self->fd.fd);
@@ -149,6 +174,7 @@ struct gp_proxy_cli *gp_proxy_cli_add(gp_dlist *clients, int cli_fd)
 	};
 
 	cli->name = NULL;
+	cli->presented = -1;
 
 	gp_proxy_buf_init(&cli->buf);
 
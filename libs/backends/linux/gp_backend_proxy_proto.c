@@ -96,6 +96,14 @@ const char *gp_proxy_msg_type_name(enum gp_proxy_msg_types type)
 		return "GP_PROXY_CURSOR";
 	case GP_PROXY_CURSOR_POS:
 		return "GP_PROXY_CURSOR_POS";
+	case GP_PROXY_UPDATE_RECTS:
+		return "GP_PROXY_UPDATE_RECTS";
+	case GP_PROXY_BUFFERS:
+		return "GP_PROXY_BUFFERS";
+	case GP_PROXY_PRESENT:
+		return "GP_PROXY_PRESENT";
+	case GP_PROXY_RELEASE:
+		return "GP_PROXY_RELEASE";
 	case GP_PROXY_MAX:
 	break;
 	}
@@ -140,6 +148,18 @@ int gp_proxy_send(int fd, enum gp_proxy_msg_types type, void *payload)
 	case GP_PROXY_CURSOR_POS:
 		payload_size = sizeof(struct gp_proxy_coord);
 	break;
+	case GP_PROXY_UPDATE_RECTS:
+		payload_size = gp_proxy_rects_size(((struct gp_proxy_rects *)payload)->cnt);
+	break;
+	case GP_PROXY_BUFFERS:
+		payload_size = sizeof(struct gp_proxy_bufs);
+	break;
+	case GP_PROXY_PRESENT:
+		payload_size = gp_proxy_present_size(((struct gp_proxy_present *)payload)->rects.cnt);
+	break;
+	case GP_PROXY_RELEASE:
+		payload_size = sizeof(uint32_t);
+	break;
 	default:
 	break;
 	}
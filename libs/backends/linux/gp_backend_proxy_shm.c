@@ -29,7 +29,8 @@ static size_t round_to_page_size(size_t size)
 	return ret;
 }
 
-gp_proxy_shm *gp_proxy_shm_init(const char *path, gp_size w, gp_size h, gp_pixel_type type)
+gp_proxy_shm *gp_proxy_shm_bufs_init(const char *path, gp_size w, gp_size h,
+                                     gp_pixel_type type, unsigned int bufs)
 {
 	size_t path_size = strlen(path)+1;
 
@@ -38,6 +39,11 @@ gp_proxy_shm *gp_proxy_shm_init(const char *path, gp_size w, gp_size h, gp_pixel
 		return NULL;
 	}
 
+	if (!bufs || bufs > GP_PROXY_BUFS_MAX) {
+		GP_WARN("Invalid number of buffers %u", bufs);
+		return NULL;
+	}
+
 	gp_proxy_shm *ret = malloc(sizeof(struct gp_proxy_shm));
 
 	if (!ret) {
@@ -51,7 +57,8 @@ gp_proxy_shm *gp_proxy_shm_init(const char *path, gp_size w, gp_size h, gp_pixel
 
 	gp_pixmap_init(&ret->pixmap, w, h, type, NULL, 0);
 
-	size_t size = round_to_page_size(ret->pixmap.bytes_per_row * h);
+	size_t stride = round_to_page_size(ret->pixmap.bytes_per_row * h);
+	size_t size = stride * bufs;
 
 	unlink(path);
 
@@ -78,6 +85,9 @@ gp_proxy_shm *gp_proxy_shm_init(const char *path, gp_size w, gp_size h, gp_pixel
 
 	ret->path.size = size;
 
+	ret->bufs.cnt = bufs;
+	ret->bufs.stride = stride;
+
 	return ret;
 err1:
 	close(fd);
@@ -87,6 +97,11 @@ err0:
 	return NULL;
 }
 
+gp_proxy_shm *gp_proxy_shm_init(const char *path, gp_size w, gp_size h, gp_pixel_type type)
+{
+	return gp_proxy_shm_bufs_init(path, w, h, type, 1);
+}
+
 int gp_proxy_shm_resize(gp_proxy_shm *self, gp_size w, gp_size h)
 {
 	gp_pixmap new;
@@ -94,7 +109,8 @@ int gp_proxy_shm_resize(gp_proxy_shm *self, gp_size w, gp_size h)
 
 	gp_pixmap_init(&new, w, h, ptype, NULL, 0);
 
-	size_t new_size = round_to_page_size(new.bytes_per_row * h);
+	size_t new_stride = round_to_page_size(new.bytes_per_row * h);
+	size_t new_size = new_stride * self->bufs.cnt;
 
 	if (self->size == new_size) {
 		gp_pixmap_init(&self->pixmap, w, h, ptype, self->pixmap.pixels, 0);
@@ -108,7 +124,7 @@ int gp_proxy_shm_resize(gp_proxy_shm *self, gp_size w, gp_size h)
 
 	void *p = mremap(self->pixmap.pixels, self->size, new_size, MREMAP_MAYMOVE, NULL);
 
-	if (!p) {
+	if (p == MAP_FAILED) {
 		GP_WARN("mremap() failed: %s", strerror(errno));
 		return -1;
 	}
@@ -117,6 +133,7 @@ int gp_proxy_shm_resize(gp_proxy_shm *self, gp_size w, gp_size h)
 
 	self->size = new_size;
 	self->path.size = new_size;
+	self->bufs.stride = new_stride;
 	gp_pixmap_init(&self->pixmap, w, h, ptype, p, 0);
 	return 1;
 }
@@ -23,8 +23,14 @@ int gp_display_spi_init(struct gp_display_spi *self,
 	if (self->spi_fd < 0)
 		return 1;
 
+	if (gp_spi_xfer_init(&self->xfer, self->spi_fd, 0)) {
+		gp_spi_close(self->spi_fd);
+		return 1;
+	}
+
 	ret = gp_gpio_export(map->gpio, GP_ARRAY_SIZE(map->gpio), "SPI display");
 	if (ret) {
+		gp_spi_xfer_exit(&self->xfer);
 		gp_spi_close(self->spi_fd);
 		return 1;
 	}
@@ -39,6 +45,7 @@ int gp_display_spi_init(struct gp_display_spi *self,
 
 void gp_display_spi_exit(struct gp_display_spi *self)
 {
+	gp_spi_xfer_exit(&self->xfer);
 	gp_spi_close(self->spi_fd);
 
 	gp_gpio_write(&self->gpio_map->pwr, 0);
@@ -78,6 +85,22 @@ void gp_display_spi_data_write(struct gp_display_spi *self,
 	gp_spi_send(self->spi_fd, data, data_size);
 }
 
+void gp_display_spi_lines_write(struct gp_display_spi *self,
+                                unsigned int lines, size_t line_bytes,
+                                gp_spi_line_conv conv, void *priv)
+{
+	gp_gpio_write(&self->gpio_map->dc, 1);
+	gp_spi_xfer_lines(&self->xfer, lines, line_bytes, conv, priv);
+}
+
+void gp_display_spi_rect_write(struct gp_display_spi *self,
+                               const uint8_t *src, size_t stride,
+                               unsigned int lines, size_t line_bytes)
+{
+	gp_gpio_write(&self->gpio_map->dc, 1);
+	gp_spi_xfer_rect(&self->xfer, src, stride, lines, line_bytes);
+}
+
 void gp_display_spi_wait_ready(struct gp_display_spi *self, int ready)
 {
 	int timeout = 1000;
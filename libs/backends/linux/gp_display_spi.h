@@ -56,6 +56,9 @@ struct gp_display_spi {
 	/** @brief Points to /dev/spiX.X */
 	int spi_fd;
 
+	/** @brief Transfer engine for pixel data. */
+	struct gp_spi_xfer xfer;
+
 	/** @brief Display width in pixels. */
 	uint16_t w;
 	/** @brief Display height in pixels. */
@@ -141,6 +144,38 @@ void gp_display_spi_cmd_data(struct gp_display_spi *self, uint8_t cmd, uint8_t d
 void gp_display_spi_data_write(struct gp_display_spi *self,
                                const uint8_t *data, size_t data_size);
 
+/**
+ * @brief Converts and writes lines of data to the display.
+ *
+ * The lines are converted into preallocated buffers and sent in as large SPI
+ * messages as possible while the next lines are being converted, see
+ * #gp_spi_xfer for details.
+ *
+ * @self An SPI display.
+ * @lines A number of lines.
+ * @line_bytes A size of a converted line in bytes.
+ * @conv A callback that converts a line into the display format.
+ * @priv A private pointer passed to the callback.
+ */
+void gp_display_spi_lines_write(struct gp_display_spi *self,
+                                unsigned int lines, size_t line_bytes,
+                                gp_spi_line_conv conv, void *priv);
+
+/**
+ * @brief Writes a rectangle of data from a buffer to the display.
+ *
+ * Use this instead of calling gp_display_spi_data_write() for each line.
+ *
+ * @self An SPI display.
+ * @src A pointer to the first byte of the first line.
+ * @stride A distance between two lines in bytes.
+ * @lines A number of lines.
+ * @line_bytes A number of bytes to be send from each line.
+ */
+void gp_display_spi_rect_write(struct gp_display_spi *self,
+                               const uint8_t *src, size_t stride,
+                               unsigned int lines, size_t line_bytes);
+
 /**
  * @brief Sets up an GPIO as an interrupt source.
  *
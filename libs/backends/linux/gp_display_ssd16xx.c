@@ -300,7 +300,6 @@ static void ssd168x_full_repaint_start(gp_backend *self)
 {
 	struct gp_display_eink *eink = GP_BACKEND_PRIV(self);
 	struct gp_display_spi *disp = &eink->spi;
-	unsigned int y;
 
 	ssd168x_reset_ram_window(disp);
 	ssd168x_set_ram_addr(disp, 0, 0);
@@ -309,10 +308,7 @@ static void ssd168x_full_repaint_start(gp_backend *self)
 
 	uint16_t line_bytes = (disp->w + 0x07)/8;
 
-	for (y = 0; y < disp->h; y++) {
-		uint8_t *tx_buf = &self->pixmap->pixels[line_bytes * y];
-		gp_display_spi_data_write(disp, tx_buf, line_bytes);
-	}
+	gp_display_spi_rect_write(disp, self->pixmap->pixels, line_bytes, disp->h, line_bytes);
 
 	gp_display_spi_cmd(disp, SSD16XX_UPDT_CTRL2);
 	gp_display_spi_data(disp, SSD16XX_UPDT_EN_CLK | SSD16XX_UPDT_EN_ANALOG |
@@ -328,7 +324,6 @@ static void repaint_full_start(gp_backend *self)
 {
 	struct gp_display_eink *eink = GP_BACKEND_PRIV(self);
 	struct gp_display_spi *spi = &eink->spi;
-	unsigned int y;
 
 	ssd1677_reset_ram_window(spi);
 
@@ -338,11 +333,7 @@ static void repaint_full_start(gp_backend *self)
 
 	uint16_t line_bytes = spi->w/8;
 
-	for (y = 0; y < spi->h; y++) {
-		uint8_t *tx_buf = &self->pixmap->pixels[line_bytes * y];
-
-		gp_display_spi_data_write(spi, tx_buf, line_bytes);
-	}
+	gp_display_spi_rect_write(spi, self->pixmap->pixels, line_bytes, spi->h, line_bytes);
 
 	ssd1677_load_lut(spi, lut_1bpp_DU);
 	gp_display_spi_busy_edge_set(spi, GP_GPIO_EDGE_FALL);
@@ -368,7 +359,6 @@ static void repaint_part_start(gp_backend *self,
 	uint16_t x_end = (x1 + 0x06) & ~0x07;
 	uint16_t y_start = y0;
 	uint16_t y_end = y1;
-	unsigned int y;
 
 	ssd1677_set_ram_window(spi, x_start, x_end, y_start, y_end);
 	ssd1677_set_ram_addr(spi, x_start, y_start);
@@ -378,11 +368,8 @@ static void repaint_part_start(gp_backend *self,
 	unsigned int line_bytes = spi->w/8;
 	unsigned int len = (x_end - x_start)/8  + 1;
 
-	for (y = y_start; y <= y_end; y++) {
-		uint8_t *tx_buf = &self->pixmap->pixels[line_bytes * y + x_start/8];
-
-		gp_display_spi_data_write(spi, tx_buf, len);
-	}
+	gp_display_spi_rect_write(spi, &self->pixmap->pixels[line_bytes * y_start + x_start/8],
+	                          line_bytes, y_end - y_start + 1, len);
 
 	ssd1677_load_lut(spi, lut_1bpp_A2);
 	gp_display_spi_busy_edge_set(spi, GP_GPIO_EDGE_FALL);
@@ -395,7 +382,6 @@ static void ssd168x_part_repaint_start(gp_backend *self,
 {
 	struct gp_display_eink *eink = GP_BACKEND_PRIV(self);
 	struct gp_display_spi *disp = &eink->spi;
-	unsigned int y;
 
 	uint16_t xs = x0 & ~0x07;
 	uint16_t xe = (x1 + 0x06) & ~0x07;
@@ -410,11 +396,8 @@ static void ssd168x_part_repaint_start(gp_backend *self,
 	unsigned int line_bytes = (disp->w + 0x06)/8;
 	unsigned int len = (xe - xs)/8 + 1;
 
-	for (y = ys; y <= ye; y++) {
-		uint8_t *tx_buf = &self->pixmap->pixels[line_bytes * y + xs/8];
-
-		gp_display_spi_data_write(disp, tx_buf, len);
-	}
+	gp_display_spi_rect_write(disp, &self->pixmap->pixels[line_bytes * ys + xs/8],
+	                          line_bytes, ye - ys + 1, len);
 
 	gp_display_spi_cmd(disp, SSD16XX_UPDT_CTRL2);
 	gp_display_spi_data(disp, SSD16XX_UPDT_EN_CLK | SSD16XX_UPDT_EN_ANALOG |
@@ -338,34 +338,25 @@ static void st75256_init(struct gp_display_spi *disp, uint16_t contrast, uint8_t
 static void st75256_2bpp_repaint_full(gp_backend *self)
 {
 	struct gp_display_spi *disp = GP_BACKEND_PRIV(self);
-	unsigned int y;
 
 	sel_disp_range(disp, 0, disp->w/4-1, 0, disp->h-1);
 	gp_display_spi_cmd(disp, ST75256_WRITE_DATA);
 
 	unsigned int row_w = (disp->w+3)/4;
 
-	for (y = 0; y < disp->h; y++) {
-		uint8_t *row = &(self->pixmap->pixels[row_w * y]);
-		gp_display_spi_data_write(disp, row, row_w);
-	}
+	gp_display_spi_rect_write(disp, self->pixmap->pixels, row_w, disp->h, row_w);
 }
 
 static void st75256_1bpp_repaint_full(gp_backend *self)
 {
 	struct gp_display_spi *disp = GP_BACKEND_PRIV(self);
-	unsigned int y;
 
 	sel_disp_range(disp, 0, disp->w/8-1, 0, disp->h-1);
 	gp_display_spi_cmd(disp, ST75256_WRITE_DATA);
 
 	unsigned int row_w = (disp->w + 7)/8;
 
-	for (y = 0; y < disp->h; y++) {
-		uint8_t *row = &(self->pixmap->pixels[row_w * y]);
-
-		gp_display_spi_data_write(disp, row, row_w);
-	}
+	gp_display_spi_rect_write(disp, self->pixmap->pixels, row_w, disp->h, row_w);
 }
 
 static void st75256_2bpp_repaint_part(gp_backend *self,
@@ -378,15 +369,12 @@ static void st75256_2bpp_repaint_part(gp_backend *self,
 	unsigned int max_x = (x1+3)/4;
 	unsigned int width = max_x - min_x + 1;
 	unsigned int row_w = (disp->w+3)/4;
-	int y;
 
 	sel_disp_range(disp, min_x, max_x, y0, y1);
 	gp_display_spi_cmd(disp, ST75256_WRITE_DATA);
 
-	for (y = y0; y <= y1; y++) {
-		uint8_t *row = &(self->pixmap->pixels[row_w * y + min_x]);
-		gp_display_spi_data_write(disp, row, width);
-	}
+	gp_display_spi_rect_write(disp, &self->pixmap->pixels[row_w * y0 + min_x],
+	                          row_w, y1 - y0 + 1, width);
 }
 
 static void st75256_1bpp_repaint_part(gp_backend *self,
@@ -399,15 +387,12 @@ static void st75256_1bpp_repaint_part(gp_backend *self,
 	unsigned int max_x = (x1+7)/8;
 	unsigned int width = max_x - min_x + 1;
 	unsigned int row_w = (disp->w + 7)/8;
-	int y;
 
 	sel_disp_range(disp, min_x, max_x, y0, y1);
 	gp_display_spi_cmd(disp, ST75256_WRITE_DATA);
 
-	for (y = y0; y <= y1; y++) {
-		uint8_t *row = &(self->pixmap->pixels[row_w * y + min_x]);
-		gp_display_spi_data_write(disp, row, width);
-	}
+	gp_display_spi_rect_write(disp, &self->pixmap->pixels[row_w * y0 + min_x],
+	                          row_w, y1 - y0 + 1, width);
 }
 
 gp_backend *gp_display_st75256_init(const char *conn_id,
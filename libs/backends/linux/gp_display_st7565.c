@@ -59,7 +59,7 @@ static void st7565_init(struct gp_display_spi *disp)
 static void st7565_repaint_full(gp_backend *self)
 {
 	struct gp_display_spi *disp = GP_BACKEND_PRIV(self);
-	unsigned int y, p;
+	unsigned int p;
 
 	/*
 	 * Writing to the display is organized in character-lines 8 pixels high, while columns are autoincremented.
@@ -78,11 +78,8 @@ static void st7565_repaint_full(gp_backend *self)
 		gp_display_spi_cmd(disp, ST7565_SETCOL_H);
 		gp_display_spi_cmd(disp, ST7565_SETCOL_L);
 
-		for (y = 0; y < 128; y++) {
-			uint8_t byte = self->pixmap->pixels[p + y * 8];
-
-			gp_display_spi_data(disp, byte);
-		}
+		/* Every 8th byte starting at offset p belongs to the page */
+		gp_display_spi_rect_write(disp, &self->pixmap->pixels[p], 8, 128, 1);
 	}
 }
 
@@ -168,8 +168,8 @@ static void st77xx_repaint_full(gp_backend *self)
 	st77xx_set_window(disp, 0, disp->w-1, 0, disp->h-1);
 	gp_display_spi_cmd(disp, ST77XX_RAM_WRITE);
 
-	gp_display_spi_data_write(disp, self->pixmap->pixels,
-	                          disp->h * self->pixmap->bytes_per_row);
+	gp_display_spi_rect_write(disp, self->pixmap->pixels,
+	                          self->pixmap->bytes_per_row, disp->h, 2 * disp->w);
 }
 
 static enum gp_backend_ret st77xx_set_backlight(gp_backend *self,
@@ -217,35 +217,12 @@ static void st77xx_repaint_part(gp_backend *self,
 	struct gp_display_spi *disp = GP_BACKEND_PRIV(self);
 	gp_size w = x1-x0+1;
 	gp_size h = y1-y0+1;
-	gp_size bytes = w * h * 2;
-	gp_size j;
-	gp_coord y;
 
 	st77xx_set_window(disp, x0, x1, y0, y1);
 	gp_display_spi_cmd(disp, ST77XX_RAM_WRITE);
 
-	/* Optimize small repaints into single write. */
-	if (bytes <= 4096) {
-		uint8_t buf[bytes];
-		unsigned int pos = 0;
-
-		for (y = y0; y <= y1; y++) {
-			uint8_t *row = GP_PIXEL_ADDR(self->pixmap, x0, y);
-
-			for (j = 0; j < w; j++) {
-				buf[2*pos] = row[2*j];
-				buf[2*pos+1] = row[2*j+1];
-				pos++;
-			}
-		}
-
-		gp_display_spi_data_write(disp, buf, bytes);
-	} else {
-		for (y = y0; y <= y1; y++) {
-			uint8_t *row = GP_PIXEL_ADDR(self->pixmap, x0, y);
-			gp_display_spi_data_write(disp, row, 2*w);
-		}
-	}
+	gp_display_spi_rect_write(disp, GP_PIXEL_ADDR(self->pixmap, x0, y0),
+	                          self->pixmap->bytes_per_row, h, 2 * w);
 }
 
 gp_backend *gp_display_st77xx_init(const char *conn_id,
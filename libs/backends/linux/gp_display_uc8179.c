@@ -66,8 +66,6 @@ static void repaint_full_start(gp_backend *self)
 	struct gp_display_eink *eink = GP_BACKEND_PRIV(self);
 	struct gp_display_spi *disp = &eink->spi;
 
-	unsigned int y;
-
 	/* Power on and wait for ready */
 	gp_display_spi_cmd(disp, UC8179_PON);
 	gp_display_spi_wait_ready(disp, 1);
@@ -75,11 +73,7 @@ static void repaint_full_start(gp_backend *self)
 	/* Start data transfer into RAM */
 	gp_display_spi_cmd(disp, UC8179_DTM2);
 
-	for (y = 0; y < 480; y++) {
-		uint8_t *tx_buf = &self->pixmap->pixels[100 * y];
-
-		gp_display_spi_data_write(disp, tx_buf, 100);
-	}
+	gp_display_spi_rect_write(disp, self->pixmap->pixels, 100, 480, 100);
 
 	/* Setup interrupt source */
 	gp_display_spi_busy_edge_set(disp, GP_GPIO_EDGE_RISE);
@@ -142,15 +136,10 @@ static void repaint_part_start(gp_backend *self, gp_coord x0, gp_coord y0, gp_co
 	/* Start partial data transfer into RAM */
 	gp_display_spi_cmd(disp, UC8179_DTM2);
 
-	gp_coord y;
-
 	size_t len = (horiz_end - horiz_start)/8 + 1;
 
-	for (y = y0; y <= y1; y++) {
-		uint8_t *tx_buf = &self->pixmap->pixels[100 * y + x0/8];
-
-		gp_display_spi_data_write(disp, tx_buf, len);
-	}
+	gp_display_spi_rect_write(disp, &self->pixmap->pixels[100 * y0 + x0/8],
+	                          100, y1 - y0 + 1, len);
 
 	/* Exit partial mode */
 	gp_display_spi_cmd(disp, UC8179_PTOUT);
@@ -3,13 +3,15 @@
  * Copyright (C) 2023-2025 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
 #include <string.h>
 #include <inttypes.h>
 #include <sys/ioctl.h>
 #include <linux/spi/spidev.h>
-#include <sys/uio.h>
 
 #include <core/gp_common.h>
 #include <core/gp_debug.h>
@@ -23,7 +25,7 @@ int gp_spi_open(const char *spi_dev, uint8_t mode, uint32_t speed)
 	fd = open(spi_dev, O_RDWR);
 	if (fd < 0) {
 		GP_FATAL("Failed to open '%s': %s", spi_dev, strerror(errno));
-		return 1;
+		return -1;
 	}
 
 	/* 0 == 8bits */
@@ -65,32 +67,292 @@ int gp_spi_write(int spi_fd, uint8_t byte)
 	return 0;
 }
 
-#define MAX_TRANSFER_SIZE 4096u
+#define DEFAULT_BUFSIZ 4096u
 
-int gp_spi_send(int spi_fd, const uint8_t *buf, size_t buf_size)
+size_t gp_spi_bufsiz(void)
 {
-	size_t iovcnt = (buf_size + MAX_TRANSFER_SIZE - 1)/MAX_TRANSFER_SIZE;
-	struct iovec iov[iovcnt];
-	size_t i;
+	static size_t bufsiz;
+	unsigned long val;
+	FILE *f;
+
+	if (bufsiz)
+		return bufsiz;
+
+	bufsiz = DEFAULT_BUFSIZ;
+
+	f = fopen("/sys/module/spidev/parameters/bufsiz", "r");
+	if (!f) {
+		GP_DEBUG(1, "Failed to open spidev bufsiz, using %zu", bufsiz);
+		return bufsiz;
+	}
+
+	if (fscanf(f, "%lu", &val) == 1 && val)
+		bufsiz = val;
+
+	fclose(f);
+
+	GP_DEBUG(1, "SPI bufsiz %zu", bufsiz);
+
+	return bufsiz;
+}
+
+static int spi_msg(int spi_fd, const uint8_t *buf, size_t len)
+{
+	struct spi_ioc_transfer tr = {
+		.tx_buf = (unsigned long)buf,
+		.rx_buf = (unsigned long)NULL,
+		.len = len,
+	};
+
+	if (ioctl(spi_fd, SPI_IOC_MESSAGE(1), &tr) >= 0)
+		return 0;
+
+	/* Not a spidev, e.g. a socket that emulates the device in tests */
+	if (errno == ENOTTY) {
+		if (write(spi_fd, buf, len) == (ssize_t)len)
+			return 0;
+	}
 
-	for (i = 0; i < iovcnt; i++) {
-		size_t len = GP_MIN(MAX_TRANSFER_SIZE, buf_size);
+	GP_WARN("Failed to send SPI message: %s", strerror(errno));
+	return 1;
+}
+
+static int spi_send(int spi_fd, const uint8_t *buf, size_t buf_size, size_t bufsiz)
+{
+	while (buf_size) {
+		size_t len = GP_MIN(bufsiz, buf_size);
 
-		iov[i].iov_base = (void*)buf;
-		iov[i].iov_len = len;
+		if (spi_msg(spi_fd, buf, len))
+			return 1;
 
 		buf += len;
 		buf_size -= len;
 	}
 
-	if (writev(spi_fd, iov, iovcnt) <= 0) {
-		GP_WARN("Failed to send SPI message: %s", strerror(errno));
+	return 0;
+}
+
+int gp_spi_send(int spi_fd, const uint8_t *buf, size_t buf_size)
+{
+	return spi_send(spi_fd, buf, buf_size, gp_spi_bufsiz());
+}
+
+static void *writer(void *arg)
+{
+	struct gp_spi_xfer *self = arg;
+
+	pthread_mutex_lock(&self->lock);
+
+	for (;;) {
+		const uint8_t *buf;
+		size_t len;
+		int ret;
+
+		while (!self->pending && !self->thread_exit)
+			pthread_cond_wait(&self->cond, &self->lock);
+
+		if (!self->pending)
+			break;
+
+		buf = self->pending;
+		len = self->pending_len;
+
+		pthread_mutex_unlock(&self->lock);
+
+		ret = spi_send(self->spi_fd, buf, len, self->bufsiz);
+
+		pthread_mutex_lock(&self->lock);
+
+		self->err |= ret;
+		self->pending = NULL;
+		pthread_cond_broadcast(&self->cond);
+	}
+
+	pthread_mutex_unlock(&self->lock);
+
+	return NULL;
+}
+
+static void writer_start(struct gp_spi_xfer *self)
+{
+	if (pthread_create(&self->thread, NULL, writer, self)) {
+		GP_WARN("Failed to start SPI writer thread, sending synchronously");
+		return;
+	}
+
+	self->thread_running = 1;
+}
+
+static int writer_submit(struct gp_spi_xfer *self, const uint8_t *buf, size_t len)
+{
+	if (!self->thread_running)
+		return spi_send(self->spi_fd, buf, len, self->bufsiz);
+
+	pthread_mutex_lock(&self->lock);
+
+	while (self->pending)
+		pthread_cond_wait(&self->cond, &self->lock);
+
+	self->pending = buf;
+	self->pending_len = len;
+	pthread_cond_broadcast(&self->cond);
+
+	pthread_mutex_unlock(&self->lock);
+
+	return 0;
+}
+
+static int writer_wait(struct gp_spi_xfer *self)
+{
+	int ret;
+
+	if (!self->thread_running)
+		return 0;
+
+	pthread_mutex_lock(&self->lock);
+
+	while (self->pending)
+		pthread_cond_wait(&self->cond, &self->lock);
+
+	ret = self->err;
+	self->err = 0;
+
+	pthread_mutex_unlock(&self->lock);
+
+	return ret;
+}
+
+static int bufs_alloc(struct gp_spi_xfer *self, size_t size)
+{
+	int i;
+
+	for (i = 0; i < 2; i++) {
+		uint8_t *buf = realloc(self->buf[i], size);
+
+		if (!buf) {
+			GP_WARN("Malloc failed :(");
+			return 1;
+		}
+
+		self->buf[i] = buf;
+	}
+
+	self->buf_size = size;
+
+	return 0;
+}
+
+int gp_spi_xfer_init(struct gp_spi_xfer *self, int spi_fd, size_t bufsiz)
+{
+	memset(self, 0, sizeof(*self));
+
+	self->spi_fd = spi_fd;
+	self->bufsiz = bufsiz ? bufsiz : gp_spi_bufsiz();
+
+	if (bufs_alloc(self, self->bufsiz)) {
+		free(self->buf[0]);
 		return 1;
 	}
 
+	pthread_mutex_init(&self->lock, NULL);
+	pthread_cond_init(&self->cond, NULL);
+
 	return 0;
 }
 
+void gp_spi_xfer_exit(struct gp_spi_xfer *self)
+{
+	if (self->thread_running) {
+		pthread_mutex_lock(&self->lock);
+		self->thread_exit = 1;
+		pthread_cond_broadcast(&self->cond);
+		pthread_mutex_unlock(&self->lock);
+
+		pthread_join(self->thread, NULL);
+		self->thread_running = 0;
+	}
+
+	pthread_mutex_destroy(&self->lock);
+	pthread_cond_destroy(&self->cond);
+
+	free(self->buf[0]);
+	free(self->buf[1]);
+	self->buf[0] = self->buf[1] = NULL;
+}
+
+int gp_spi_xfer_lines(struct gp_spi_xfer *self,
+                      unsigned int lines, size_t line_bytes,
+                      gp_spi_line_conv conv, void *priv)
+{
+	unsigned int i, line = 0, buf_lines;
+	int ret = 0, cur = 0;
+
+	if (!lines || !line_bytes)
+		return 0;
+
+	/* The writer is idle here, buffers can be resized safely */
+	if (line_bytes > self->buf_size && bufs_alloc(self, line_bytes))
+		return 1;
+
+	buf_lines = self->buf_size / line_bytes;
+
+	/* Fits into a single buffer, nothing to overlap */
+	if (lines <= buf_lines) {
+		for (i = 0; i < lines; i++)
+			conv(self->buf[0] + i * line_bytes, i, priv);
+
+		return spi_send(self->spi_fd, self->buf[0], lines * line_bytes, self->bufsiz);
+	}
+
+	if (!self->thread_running)
+		writer_start(self);
+
+	while (line < lines) {
+		unsigned int cnt = GP_MIN(buf_lines, lines - line);
+		uint8_t *buf = self->buf[cur];
+
+		for (i = 0; i < cnt; i++)
+			conv(buf + i * line_bytes, line + i, priv);
+
+		ret |= writer_submit(self, buf, cnt * line_bytes);
+
+		line += cnt;
+		cur = !cur;
+	}
+
+	ret |= writer_wait(self);
+
+	return ret;
+}
+
+struct rect_priv {
+	const uint8_t *src;
+	size_t stride;
+	size_t line_bytes;
+};
+
+static void rect_conv(uint8_t *buf, unsigned int line, void *priv)
+{
+	struct rect_priv *rect = priv;
+
+	memcpy(buf, rect->src + line * rect->stride, rect->line_bytes);
+}
+
+int gp_spi_xfer_rect(struct gp_spi_xfer *self, const uint8_t *src, size_t stride,
+                     unsigned int lines, size_t line_bytes)
+{
+	struct rect_priv rect = {
+		.src = src,
+		.stride = stride,
+		.line_bytes = line_bytes,
+	};
+
+	if (stride == line_bytes)
+		return spi_send(self->spi_fd, src, lines * line_bytes, self->bufsiz);
+
+	return gp_spi_xfer_lines(self, lines, line_bytes, rect_conv, &rect);
+}
+
 void gp_spi_close(int spi_fd)
 {
 	if (close(spi_fd))
@@ -11,6 +11,9 @@
 #ifndef GP_LINUX_SPI_H
 #define GP_LINUX_SPI_H
 
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
 #include <linux/spi/spidev.h>
 
 /**
@@ -34,9 +37,21 @@ int gp_spi_open(const char *spi_dev, uint8_t mode, uint32_t speed);
  */
 int gp_spi_write(int spi_fd, uint8_t byte);
 
+/**
+ * @brief Returns a maximal size of a single spidev message.
+ *
+ * The value is read from the spidev bufsiz module parameter, defaults to 4096
+ * which is the kernel default if the parameter is not available.
+ *
+ * @return A maximal SPI message size in bytes.
+ */
+size_t gp_spi_bufsiz(void);
+
 /**
  * @brief Writes a buffer into SPI.
  *
+ * The buffer is split into gp_spi_bufsiz() sized SPI messages.
+ *
  * @spi_fd An SPI bus file descriptor.
  * @buf A buffer to be written.
  * @buf_size A buffer size be written.
@@ -45,6 +60,104 @@ int gp_spi_write(int spi_fd, uint8_t byte);
  */
 int gp_spi_send(int spi_fd, const uint8_t *buf, size_t buf_size);
 
+/**
+ * @brief Converts a single line into the wire format.
+ *
+ * @buf A buffer to write the converted line to.
+ * @line A line index, starts at zero for each transfer.
+ * @priv A private pointer passed to gp_spi_xfer_lines().
+ */
+typedef void (*gp_spi_line_conv)(uint8_t *buf, unsigned int line, void *priv);
+
+/**
+ * @brief An SPI transfer engine.
+ *
+ * Converts lines into a pair of preallocated buffers and sends them in as
+ * large SPI messages as the spidev allows. Once the first buffer is full it's
+ * handed over to a writer thread so that the conversion of the next lines
+ * overlaps with the transfer.
+ *
+ * The writer thread is started on the first transfer that does not fit into a
+ * single buffer, if it cannot be started the buffers are sent synchronously.
+ *
+ * If the file descriptor is not a spidev, i.e. the SPI ioctl() fails with
+ * ENOTTY, the data are written with write() instead, one write per SPI
+ * message. This is used for testing.
+ */
+struct gp_spi_xfer {
+	/** @brief An SPI bus file descriptor. */
+	int spi_fd;
+	/** @brief A maximal size of a single SPI message. */
+	size_t bufsiz;
+	/** @brief A size of each of the buffers. */
+	size_t buf_size;
+	/** @brief A pair of buffers to convert the data into. */
+	uint8_t *buf[2];
+
+	/* Writer thread state protected by the lock. */
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	pthread_t thread;
+	const uint8_t *pending;
+	size_t pending_len;
+	int err;
+	unsigned int thread_running:1;
+	unsigned int thread_exit:1;
+};
+
+/**
+ * @brief Initializes an SPI transfer engine.
+ *
+ * @self A transfer engine.
+ * @spi_fd An SPI bus file descriptor.
+ * @bufsiz A maximal SPI message size, pass 0 for gp_spi_bufsiz().
+ *
+ * @return Zero on success, non-zero otherwise.
+ */
+int gp_spi_xfer_init(struct gp_spi_xfer *self, int spi_fd, size_t bufsiz);
+
+/**
+ * @brief Stops the writer thread and frees the buffers.
+ *
+ * @self A transfer engine.
+ */
+void gp_spi_xfer_exit(struct gp_spi_xfer *self);
+
+/**
+ * @brief Converts and sends lines.
+ *
+ * Returns once all data were sent.
+ *
+ * @self A transfer engine.
+ * @lines A number of lines to send.
+ * @line_bytes A size of a converted line in bytes.
+ * @conv A callback that converts a line into the wire format.
+ * @priv A private pointer passed to the callback.
+ *
+ * @return Zero on success, non-zero otherwise.
+ */
+int gp_spi_xfer_lines(struct gp_spi_xfer *self,
+                      unsigned int lines, size_t line_bytes,
+                      gp_spi_line_conv conv, void *priv);
+
+/**
+ * @brief Sends a rectangle from a buffer.
+ *
+ * If the lines are continuous in the memory, i.e. stride equals line_bytes,
+ * the buffer is sent as it is, otherwise the lines are copied into the
+ * transfer buffers first.
+ *
+ * @self A transfer engine.
+ * @src A pointer to the first byte of the first line.
+ * @stride A distance between two lines in bytes.
+ * @lines A number of lines to send.
+ * @line_bytes A number of bytes to send from each line.
+ *
+ * @return Zero on success, non-zero otherwise.
+ */
+int gp_spi_xfer_rect(struct gp_spi_xfer *self, const uint8_t *src, size_t stride,
+                     unsigned int lines, size_t line_bytes);
+
 /**
  * @brief Closes SPI bus.
  */
@@ -0,0 +1,511 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_convert.gen.c
+ *
+ * GENERATED on 2026 10 19 16:35:03 from gp_convert.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Convert PixelType values macros and functions
+ *
+ * Copyright (C) 2011      Tomas Gavenciak <gavento@ucw.cz>
+ * Copyright (C) 2011-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_convert.h>
+
+gp_pixel gp_RGB888_to_pixel(gp_pixel pixel, gp_pixel_type type)
+{
+	gp_pixel p = 0;
+	switch (type) {
+		case GP_PIXEL_UNKNOWN:
+			GP_ABORT("Cannot convert RGB888 to GP_PIXEL_UNKNOWN");
+			break;
+		case GP_PIXEL_RGB101010:
+			GP_PIXEL_RGB888_TO_RGB101010(pixel, p);
+			break;
+		case GP_PIXEL_xRGB8888:
+			GP_PIXEL_RGB888_TO_xRGB8888(pixel, p);
+			break;
+		case GP_PIXEL_RGBA8888:
+			GP_PIXEL_RGB888_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_RGB888:
+			GP_PIXEL_RGB888_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_BGR888:
+			GP_PIXEL_RGB888_TO_BGR888(pixel, p);
+			break;
+		case GP_PIXEL_RGB555:
+			GP_PIXEL_RGB888_TO_RGB555(pixel, p);
+			break;
+		case GP_PIXEL_RGB565_BE:
+			GP_PIXEL_RGB888_TO_RGB565_BE(pixel, p);
+			break;
+		case GP_PIXEL_RGB565_LE:
+			GP_PIXEL_RGB888_TO_RGB565_LE(pixel, p);
+			break;
+		case GP_PIXEL_RGB666:
+			GP_PIXEL_RGB888_TO_RGB666(pixel, p);
+			break;
+		case GP_PIXEL_RGB332:
+			GP_PIXEL_RGB888_TO_RGB332(pixel, p);
+			break;
+		case GP_PIXEL_CMYK8888:
+			GP_PIXEL_RGB888_TO_CMYK8888(pixel, p);
+			break;
+		case GP_PIXEL_P2:
+			GP_ABORT("Cannot convert RGB888 to palette type P2");
+			break;
+		case GP_PIXEL_P4:
+			GP_ABORT("Cannot convert RGB888 to palette type P4");
+			break;
+		case GP_PIXEL_P8:
+			GP_ABORT("Cannot convert RGB888 to palette type P8");
+			break;
+		case GP_PIXEL_G1_DB:
+			GP_PIXEL_RGB888_TO_G1_DB(pixel, p);
+			break;
+		case GP_PIXEL_G2_DB:
+			GP_PIXEL_RGB888_TO_G2_DB(pixel, p);
+			break;
+		case GP_PIXEL_G4_DB:
+			GP_PIXEL_RGB888_TO_G4_DB(pixel, p);
+			break;
+		case GP_PIXEL_G1_UB:
+			GP_PIXEL_RGB888_TO_G1_UB(pixel, p);
+			break;
+		case GP_PIXEL_G2_UB:
+			GP_PIXEL_RGB888_TO_G2_UB(pixel, p);
+			break;
+		case GP_PIXEL_G4_UB:
+			GP_PIXEL_RGB888_TO_G4_UB(pixel, p);
+			break;
+		case GP_PIXEL_G8:
+			GP_PIXEL_RGB888_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_GA88:
+			GP_PIXEL_RGB888_TO_GA88(pixel, p);
+			break;
+		case GP_PIXEL_G16:
+			GP_PIXEL_RGB888_TO_G16(pixel, p);
+			break;
+		default:
+			GP_ABORT("Unknown PixelType %ud", type);
+	}
+	return p;
+}
+
+gp_pixel gp_pixel_to_RGB888(gp_pixel pixel, gp_pixel_type type)
+{
+	gp_pixel p = 0;
+	switch (type) {
+		case GP_PIXEL_UNKNOWN:
+			GP_ABORT("Cannot convert from GP_PIXEL_UNKNOWN");
+			break;
+		case GP_PIXEL_RGB101010:
+			GP_PIXEL_RGB101010_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_xRGB8888:
+			GP_PIXEL_xRGB8888_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_RGBA8888:
+			GP_PIXEL_RGBA8888_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_RGB888:
+			GP_PIXEL_RGB888_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_BGR888:
+			GP_PIXEL_BGR888_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_RGB555:
+			GP_PIXEL_RGB555_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_RGB565_BE:
+			GP_PIXEL_RGB565_BE_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_RGB565_LE:
+			GP_PIXEL_RGB565_LE_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_RGB666:
+			GP_PIXEL_RGB666_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_RGB332:
+			GP_PIXEL_RGB332_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_CMYK8888:
+			GP_PIXEL_CMYK8888_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_P2:
+			GP_ABORT("Cannot convert from palette type P2 (yet)");
+			break;
+		case GP_PIXEL_P4:
+			GP_ABORT("Cannot convert from palette type P4 (yet)");
+			break;
+		case GP_PIXEL_P8:
+			GP_ABORT("Cannot convert from palette type P8 (yet)");
+			break;
+		case GP_PIXEL_G1_DB:
+			GP_PIXEL_G1_DB_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_G2_DB:
+			GP_PIXEL_G2_DB_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_G4_DB:
+			GP_PIXEL_G4_DB_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_G1_UB:
+			GP_PIXEL_G1_UB_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_G2_UB:
+			GP_PIXEL_G2_UB_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_G4_UB:
+			GP_PIXEL_G4_UB_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_G8:
+			GP_PIXEL_G8_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_GA88:
+			GP_PIXEL_GA88_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_G16:
+			GP_PIXEL_G16_TO_RGB888(pixel, p);
+			break;
+		default:
+			GP_ABORT("Unknown PixelType %u", type);
+	}
+	return p;
+}
+
+
+gp_pixel gp_RGBA8888_to_pixel(gp_pixel pixel, gp_pixel_type type)
+{
+	gp_pixel p = 0;
+	switch (type) {
+		case GP_PIXEL_UNKNOWN:
+			GP_ABORT("Cannot convert RGBA8888 to GP_PIXEL_UNKNOWN");
+			break;
+		case GP_PIXEL_RGB101010:
+			GP_PIXEL_RGBA8888_TO_RGB101010(pixel, p);
+			break;
+		case GP_PIXEL_xRGB8888:
+			GP_PIXEL_RGBA8888_TO_xRGB8888(pixel, p);
+			break;
+		case GP_PIXEL_RGBA8888:
+			GP_PIXEL_RGBA8888_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_RGB888:
+			GP_PIXEL_RGBA8888_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_BGR888:
+			GP_PIXEL_RGBA8888_TO_BGR888(pixel, p);
+			break;
+		case GP_PIXEL_RGB555:
+			GP_PIXEL_RGBA8888_TO_RGB555(pixel, p);
+			break;
+		case GP_PIXEL_RGB565_BE:
+			GP_PIXEL_RGBA8888_TO_RGB565_BE(pixel, p);
+			break;
+		case GP_PIXEL_RGB565_LE:
+			GP_PIXEL_RGBA8888_TO_RGB565_LE(pixel, p);
+			break;
+		case GP_PIXEL_RGB666:
+			GP_PIXEL_RGBA8888_TO_RGB666(pixel, p);
+			break;
+		case GP_PIXEL_RGB332:
+			GP_PIXEL_RGBA8888_TO_RGB332(pixel, p);
+			break;
+		case GP_PIXEL_CMYK8888:
+			GP_PIXEL_RGBA8888_TO_CMYK8888(pixel, p);
+			break;
+		case GP_PIXEL_P2:
+			GP_ABORT("Cannot convert RGBA8888 to palette type P2");
+			break;
+		case GP_PIXEL_P4:
+			GP_ABORT("Cannot convert RGBA8888 to palette type P4");
+			break;
+		case GP_PIXEL_P8:
+			GP_ABORT("Cannot convert RGBA8888 to palette type P8");
+			break;
+		case GP_PIXEL_G1_DB:
+			GP_PIXEL_RGBA8888_TO_G1_DB(pixel, p);
+			break;
+		case GP_PIXEL_G2_DB:
+			GP_PIXEL_RGBA8888_TO_G2_DB(pixel, p);
+			break;
+		case GP_PIXEL_G4_DB:
+			GP_PIXEL_RGBA8888_TO_G4_DB(pixel, p);
+			break;
+		case GP_PIXEL_G1_UB:
+			GP_PIXEL_RGBA8888_TO_G1_UB(pixel, p);
+			break;
+		case GP_PIXEL_G2_UB:
+			GP_PIXEL_RGBA8888_TO_G2_UB(pixel, p);
+			break;
+		case GP_PIXEL_G4_UB:
+			GP_PIXEL_RGBA8888_TO_G4_UB(pixel, p);
+			break;
+		case GP_PIXEL_G8:
+			GP_PIXEL_RGBA8888_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_GA88:
+			GP_PIXEL_RGBA8888_TO_GA88(pixel, p);
+			break;
+		case GP_PIXEL_G16:
+			GP_PIXEL_RGBA8888_TO_G16(pixel, p);
+			break;
+		default:
+			GP_ABORT("Unknown PixelType %ud", type);
+	}
+	return p;
+}
+
+gp_pixel gp_pixel_to_RGBA8888(gp_pixel pixel, gp_pixel_type type)
+{
+	gp_pixel p = 0;
+	switch (type) {
+		case GP_PIXEL_UNKNOWN:
+			GP_ABORT("Cannot convert from GP_PIXEL_UNKNOWN");
+			break;
+		case GP_PIXEL_RGB101010:
+			GP_PIXEL_RGB101010_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_xRGB8888:
+			GP_PIXEL_xRGB8888_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_RGBA8888:
+			GP_PIXEL_RGBA8888_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_RGB888:
+			GP_PIXEL_RGB888_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_BGR888:
+			GP_PIXEL_BGR888_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_RGB555:
+			GP_PIXEL_RGB555_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_RGB565_BE:
+			GP_PIXEL_RGB565_BE_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_RGB565_LE:
+			GP_PIXEL_RGB565_LE_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_RGB666:
+			GP_PIXEL_RGB666_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_RGB332:
+			GP_PIXEL_RGB332_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_CMYK8888:
+			GP_PIXEL_CMYK8888_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_P2:
+			GP_ABORT("Cannot convert from palette type P2 (yet)");
+			break;
+		case GP_PIXEL_P4:
+			GP_ABORT("Cannot convert from palette type P4 (yet)");
+			break;
+		case GP_PIXEL_P8:
+			GP_ABORT("Cannot convert from palette type P8 (yet)");
+			break;
+		case GP_PIXEL_G1_DB:
+			GP_PIXEL_G1_DB_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_G2_DB:
+			GP_PIXEL_G2_DB_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_G4_DB:
+			GP_PIXEL_G4_DB_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_G1_UB:
+			GP_PIXEL_G1_UB_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_G2_UB:
+			GP_PIXEL_G2_UB_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_G4_UB:
+			GP_PIXEL_G4_UB_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_G8:
+			GP_PIXEL_G8_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_GA88:
+			GP_PIXEL_GA88_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_G16:
+			GP_PIXEL_G16_TO_RGBA8888(pixel, p);
+			break;
+		default:
+			GP_ABORT("Unknown PixelType %u", type);
+	}
+	return p;
+}
+
+
+gp_pixel gp_G8_to_pixel(gp_pixel pixel, gp_pixel_type type)
+{
+	gp_pixel p = 0;
+	switch (type) {
+		case GP_PIXEL_UNKNOWN:
+			GP_ABORT("Cannot convert G8 to GP_PIXEL_UNKNOWN");
+			break;
+		case GP_PIXEL_RGB101010:
+			GP_PIXEL_G8_TO_RGB101010(pixel, p);
+			break;
+		case GP_PIXEL_xRGB8888:
+			GP_PIXEL_G8_TO_xRGB8888(pixel, p);
+			break;
+		case GP_PIXEL_RGBA8888:
+			GP_PIXEL_G8_TO_RGBA8888(pixel, p);
+			break;
+		case GP_PIXEL_RGB888:
+			GP_PIXEL_G8_TO_RGB888(pixel, p);
+			break;
+		case GP_PIXEL_BGR888:
+			GP_PIXEL_G8_TO_BGR888(pixel, p);
+			break;
+		case GP_PIXEL_RGB555:
+			GP_PIXEL_G8_TO_RGB555(pixel, p);
+			break;
+		case GP_PIXEL_RGB565_BE:
+			GP_PIXEL_G8_TO_RGB565_BE(pixel, p);
+			break;
+		case GP_PIXEL_RGB565_LE:
+			GP_PIXEL_G8_TO_RGB565_LE(pixel, p);
+			break;
+		case GP_PIXEL_RGB666:
+			GP_PIXEL_G8_TO_RGB666(pixel, p);
+			break;
+		case GP_PIXEL_RGB332:
+			GP_PIXEL_G8_TO_RGB332(pixel, p);
+			break;
+		case GP_PIXEL_CMYK8888:
+			GP_PIXEL_G8_TO_CMYK8888(pixel, p);
+			break;
+		case GP_PIXEL_P2:
+			GP_ABORT("Cannot convert G8 to palette type P2");
+			break;
+		case GP_PIXEL_P4:
+			GP_ABORT("Cannot convert G8 to palette type P4");
+			break;
+		case GP_PIXEL_P8:
+			GP_ABORT("Cannot convert G8 to palette type P8");
+			break;
+		case GP_PIXEL_G1_DB:
+			GP_PIXEL_G8_TO_G1_DB(pixel, p);
+			break;
+		case GP_PIXEL_G2_DB:
+			GP_PIXEL_G8_TO_G2_DB(pixel, p);
+			break;
+		case GP_PIXEL_G4_DB:
+			GP_PIXEL_G8_TO_G4_DB(pixel, p);
+			break;
+		case GP_PIXEL_G1_UB:
+			GP_PIXEL_G8_TO_G1_UB(pixel, p);
+			break;
+		case GP_PIXEL_G2_UB:
+			GP_PIXEL_G8_TO_G2_UB(pixel, p);
+			break;
+		case GP_PIXEL_G4_UB:
+			GP_PIXEL_G8_TO_G4_UB(pixel, p);
+			break;
+		case GP_PIXEL_G8:
+			GP_PIXEL_G8_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_GA88:
+			GP_PIXEL_G8_TO_GA88(pixel, p);
+			break;
+		case GP_PIXEL_G16:
+			GP_PIXEL_G8_TO_G16(pixel, p);
+			break;
+		default:
+			GP_ABORT("Unknown PixelType %ud", type);
+	}
+	return p;
+}
+
+gp_pixel gp_pixel_to_G8(gp_pixel pixel, gp_pixel_type type)
+{
+	gp_pixel p = 0;
+	switch (type) {
+		case GP_PIXEL_UNKNOWN:
+			GP_ABORT("Cannot convert from GP_PIXEL_UNKNOWN");
+			break;
+		case GP_PIXEL_RGB101010:
+			GP_PIXEL_RGB101010_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_xRGB8888:
+			GP_PIXEL_xRGB8888_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_RGBA8888:
+			GP_PIXEL_RGBA8888_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_RGB888:
+			GP_PIXEL_RGB888_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_BGR888:
+			GP_PIXEL_BGR888_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_RGB555:
+			GP_PIXEL_RGB555_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_RGB565_BE:
+			GP_PIXEL_RGB565_BE_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_RGB565_LE:
+			GP_PIXEL_RGB565_LE_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_RGB666:
+			GP_PIXEL_RGB666_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_RGB332:
+			GP_PIXEL_RGB332_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_CMYK8888:
+			GP_PIXEL_CMYK8888_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_P2:
+			GP_ABORT("Cannot convert from palette type P2 (yet)");
+			break;
+		case GP_PIXEL_P4:
+			GP_ABORT("Cannot convert from palette type P4 (yet)");
+			break;
+		case GP_PIXEL_P8:
+			GP_ABORT("Cannot convert from palette type P8 (yet)");
+			break;
+		case GP_PIXEL_G1_DB:
+			GP_PIXEL_G1_DB_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_G2_DB:
+			GP_PIXEL_G2_DB_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_G4_DB:
+			GP_PIXEL_G4_DB_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_G1_UB:
+			GP_PIXEL_G1_UB_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_G2_UB:
+			GP_PIXEL_G2_UB_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_G4_UB:
+			GP_PIXEL_G4_UB_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_G8:
+			GP_PIXEL_G8_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_GA88:
+			GP_PIXEL_GA88_TO_G8(pixel, p);
+			break;
+		case GP_PIXEL_G16:
+			GP_PIXEL_G16_TO_G8(pixel, p);
+			break;
+		default:
+			GP_ABORT("Unknown PixelType %u", type);
+	}
+	return p;
+}
+
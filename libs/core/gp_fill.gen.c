@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_fill.gen.c
+ *
+ * GENERATED on 2026 10 19 16:35:03 from gp_fill.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Optimized fill functions.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_pixmap.h>
+#include <core/gp_write_pixels.gen.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixel_pack.gen.h>
+#include <core/gp_fill.h>
+
+static void fill_1BPP_DB(gp_pixmap *pixmap, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < pixmap->h; y++) {
+		void *start = GP_PIXEL_ADDR(pixmap, 0, y);
+		gp_write_pixels_1BPP_DB(start, pixmap->offset, y%2, pixmap->w, val);
+	}
+}
+
+static void fill_1BPP_UB(gp_pixmap *pixmap, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < pixmap->h; y++) {
+		void *start = GP_PIXEL_ADDR(pixmap, 0, y);
+		gp_write_pixels_1BPP_UB(start, pixmap->offset, y%2, pixmap->w, val);
+	}
+}
+
+static void fill_2BPP_DB(gp_pixmap *pixmap, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < pixmap->h; y++) {
+		void *start = GP_PIXEL_ADDR(pixmap, 0, y);
+		gp_write_pixels_2BPP_DB(start, pixmap->offset, pixmap->w, val);
+	}
+}
+
+static void fill_2BPP_UB(gp_pixmap *pixmap, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < pixmap->h; y++) {
+		void *start = GP_PIXEL_ADDR(pixmap, 0, y);
+		gp_write_pixels_2BPP_UB(start, pixmap->offset, pixmap->w, val);
+	}
+}
+
+static void fill_4BPP_DB(gp_pixmap *pixmap, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < pixmap->h; y++) {
+		void *start = GP_PIXEL_ADDR(pixmap, 0, y);
+		gp_write_pixels_4BPP_DB(start, pixmap->offset, pixmap->w, val);
+	}
+}
+
+static void fill_4BPP_UB(gp_pixmap *pixmap, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < pixmap->h; y++) {
+		void *start = GP_PIXEL_ADDR(pixmap, 0, y);
+		gp_write_pixels_4BPP_UB(start, pixmap->offset, pixmap->w, val);
+	}
+}
+
+static void fill_8BPP(gp_pixmap *pixmap, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < pixmap->h; y++) {
+		void *start = GP_PIXEL_ADDR(pixmap, 0, y);
+		gp_write_pixels_8BPP(start, pixmap->w, val);
+	}
+}
+
+static void fill_16BPP_LE(gp_pixmap *pixmap, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < pixmap->h; y++) {
+		void *start = GP_PIXEL_ADDR(pixmap, 0, y);
+		gp_write_pixels_16BPP_LE(start, pixmap->w, val);
+	}
+}
+
+static void fill_16BPP_BE(gp_pixmap *pixmap, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < pixmap->h; y++) {
+		void *start = GP_PIXEL_ADDR(pixmap, 0, y);
+		gp_write_pixels_16BPP_BE(start, pixmap->w, val);
+	}
+}
+
+static void fill_24BPP(gp_pixmap *pixmap, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < pixmap->h; y++) {
+		void *start = GP_PIXEL_ADDR(pixmap, 0, y);
+		gp_write_pixels_24BPP(start, pixmap->w, val);
+	}
+}
+
+static void fill_32BPP(gp_pixmap *pixmap, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < pixmap->h; y++) {
+		void *start = GP_PIXEL_ADDR(pixmap, 0, y);
+		gp_write_pixels_32BPP(start, pixmap->w, val);
+	}
+}
+
+static void fill_18BPP_DB(gp_pixmap *pixmap, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < pixmap->h; y++) {
+		unsigned int x;
+
+		for (x = 0; x < pixmap->w; x++)
+			gp_putpixel_raw_18BPP_DB(pixmap, x, y, val);
+	}
+}
+
+void gp_fill(gp_pixmap *pixmap, gp_pixel val)
+{
+	GP_FN_PER_PACK_PIXMAP(fill, pixmap, pixmap, val);
+}
@@ -16,29 +16,33 @@ static unsigned int nr_threads = 0;
 unsigned int gp_nr_threads(gp_size w, gp_size h, gp_progress_cb *callback)
 {
 	int count, threads;
+	unsigned int nr = nr_threads;
 	char *env;
 
-	/* Try to override nr_threads from the callback first */
+	/*
+	 * Try to override nr_threads from the callback first, the override
+	 * applies only to this call and must not change the default.
+	 */
 	if (callback != NULL && callback->threads) {
 		GP_DEBUG(1, "Overriding nr_threads from callback to %i",
 		         callback->threads);
-		nr_threads = callback->threads;
+		nr = callback->threads;
 	} else {
 		/* Then try to override it from the enviroment variable */
 		env = getenv("GP_THREADS");
 
 		if (env) {
-			nr_threads = atoi(env);
+			nr = atoi(env);
 			GP_DEBUG(1, "Using GP_THREADS=%u from enviroment "
-			            "variable", nr_threads);
+			            "variable", nr);
 		}
 	}
 
-	if (nr_threads == 0) {
+	if (nr == 0) {
 		count = sysconf(_SC_NPROCESSORS_ONLN);
 		GP_DEBUG(1, "Found %i CPUs", count);
 	} else {
-		count = nr_threads;
+		count = nr;
 		GP_DEBUG(1, "Using nr_threads=%i", count);
 	}
 
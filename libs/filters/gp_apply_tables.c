@@ -42,18 +42,18 @@ static void free_tables(gp_filter_tables *self)
 	}
 }
 
-int gp_filter_tables_init(gp_filter_tables *self, const gp_pixmap *pixmap)
+int gp_filter_tables_init_type(gp_filter_tables *self, gp_pixel_type pixel_type)
 {
 	unsigned int i;
 	const gp_pixel_type_desc *desc;
 
 	GP_DEBUG(2, "Allocating tables for pixel %s",
-	         gp_pixel_type_name(pixmap->pixel_type));
+	         gp_pixel_type_name(pixel_type));
 
 	for (i = 0; i < GP_PIXEL_CHANS_MAX; i++)
 		self->table[i] = NULL;
 
-	desc = gp_pixel_desc(pixmap->pixel_type);
+	desc = gp_pixel_desc(pixel_type);
 
 	for (i = 0; i < desc->numchannels; i++) {
 		self->table[i] = create_table(&desc->channels[i]);
@@ -68,6 +68,11 @@ int gp_filter_tables_init(gp_filter_tables *self, const gp_pixmap *pixmap)
 	return 0;
 }
 
+int gp_filter_tables_init(gp_filter_tables *self, const gp_pixmap *pixmap)
+{
+	return gp_filter_tables_init_type(self, pixmap->pixel_type);
+}
+
 gp_filter_tables *gp_filter_tables_alloc(const gp_pixmap *pixmap)
 {
 	gp_filter_tables *tables = malloc(sizeof(gp_filter_tables));
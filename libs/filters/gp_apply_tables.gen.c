@@ -0,0 +1,1503 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_apply_tables.gen.c
+ *
+ * GENERATED on 2026 10 19 19:42:19 from gp_apply_tables.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Generic Point filer
+ *
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "../../config.h"
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_apply_tables.h>
+
+static int apply_tables_RGB101010(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGB101010(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGB101010(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGB101010(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_RGB101010(R, G, B);
+			gp_putpixel_raw_32BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+/*
+ * All xRGB8888 channels are whole bytes, so we can look up the bytes
+ * directly instead of unpacking and packing the pixel values.
+ *
+ * Which byte in memory belongs to which channel depends on the pixel packing
+ * so we find out by storing each channel mask into a pixel. Padding bytes, if
+ * any, are copied unchanged.
+ */
+static void byte_luts_xRGB8888(const gp_filter_tables *const tables,
+                                    uint8_t luts[4][256])
+{
+	gp_pixel buf;
+	uint8_t *bytes = (uint8_t*)&buf;
+	gp_pixmap tmp;
+	unsigned int i, j;
+
+	gp_pixmap_init(&tmp, 1, 1, GP_PIXEL_xRGB8888, &buf, 0);
+
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < 256; j++)
+			luts[i][j] = j;
+	}
+
+	buf = 0;
+	gp_putpixel_raw_32BPP(&tmp, 0, 0, 0xff0000);
+	for (i = 0; i < 4; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[0][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_32BPP(&tmp, 0, 0, 0xff00);
+	for (i = 0; i < 4; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[1][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_32BPP(&tmp, 0, 0, 0xff);
+	for (i = 0; i < 4; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[2][j];
+	}
+
+}
+
+static int apply_tables_xRGB8888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	uint8_t luts[4][256];
+
+	byte_luts_xRGB8888(tables, luts);
+
+	for (y = 0; y < h_src; y++) {
+		const uint8_t *s = (const uint8_t*)GP_PIXEL_ADDR_32BPP(src, x_src, y_src + y);
+		uint8_t *d = (uint8_t*)GP_PIXEL_ADDR_32BPP(dst, x_dst, y_dst + y);
+
+		for (x = 0; x < w_src; x++) {
+			d[0] = luts[0][s[0]];
+			d[1] = luts[1][s[1]];
+			d[2] = luts[2][s[2]];
+			d[3] = luts[3][s[3]];
+			s += 4;
+			d += 4;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+/*
+ * All RGBA8888 channels are whole bytes, so we can look up the bytes
+ * directly instead of unpacking and packing the pixel values.
+ *
+ * Which byte in memory belongs to which channel depends on the pixel packing
+ * so we find out by storing each channel mask into a pixel. Padding bytes, if
+ * any, are copied unchanged.
+ */
+static void byte_luts_RGBA8888(const gp_filter_tables *const tables,
+                                    uint8_t luts[4][256])
+{
+	gp_pixel buf;
+	uint8_t *bytes = (uint8_t*)&buf;
+	gp_pixmap tmp;
+	unsigned int i, j;
+
+	gp_pixmap_init(&tmp, 1, 1, GP_PIXEL_RGBA8888, &buf, 0);
+
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < 256; j++)
+			luts[i][j] = j;
+	}
+
+	buf = 0;
+	gp_putpixel_raw_32BPP(&tmp, 0, 0, 0xff000000);
+	for (i = 0; i < 4; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[0][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_32BPP(&tmp, 0, 0, 0xff0000);
+	for (i = 0; i < 4; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[1][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_32BPP(&tmp, 0, 0, 0xff00);
+	for (i = 0; i < 4; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[2][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_32BPP(&tmp, 0, 0, 0xff);
+	for (i = 0; i < 4; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[3][j];
+	}
+
+}
+
+static int apply_tables_RGBA8888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	uint8_t luts[4][256];
+
+	byte_luts_RGBA8888(tables, luts);
+
+	for (y = 0; y < h_src; y++) {
+		const uint8_t *s = (const uint8_t*)GP_PIXEL_ADDR_32BPP(src, x_src, y_src + y);
+		uint8_t *d = (uint8_t*)GP_PIXEL_ADDR_32BPP(dst, x_dst, y_dst + y);
+
+		for (x = 0; x < w_src; x++) {
+			d[0] = luts[0][s[0]];
+			d[1] = luts[1][s[1]];
+			d[2] = luts[2][s[2]];
+			d[3] = luts[3][s[3]];
+			s += 4;
+			d += 4;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+/*
+ * All RGB888 channels are whole bytes, so we can look up the bytes
+ * directly instead of unpacking and packing the pixel values.
+ *
+ * Which byte in memory belongs to which channel depends on the pixel packing
+ * so we find out by storing each channel mask into a pixel. Padding bytes, if
+ * any, are copied unchanged.
+ */
+static void byte_luts_RGB888(const gp_filter_tables *const tables,
+                                    uint8_t luts[3][256])
+{
+	gp_pixel buf;
+	uint8_t *bytes = (uint8_t*)&buf;
+	gp_pixmap tmp;
+	unsigned int i, j;
+
+	gp_pixmap_init(&tmp, 1, 1, GP_PIXEL_RGB888, &buf, 0);
+
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < 256; j++)
+			luts[i][j] = j;
+	}
+
+	buf = 0;
+	gp_putpixel_raw_24BPP(&tmp, 0, 0, 0xff0000);
+	for (i = 0; i < 3; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[0][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_24BPP(&tmp, 0, 0, 0xff00);
+	for (i = 0; i < 3; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[1][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_24BPP(&tmp, 0, 0, 0xff);
+	for (i = 0; i < 3; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[2][j];
+	}
+
+}
+
+static int apply_tables_RGB888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	uint8_t luts[3][256];
+
+	byte_luts_RGB888(tables, luts);
+
+	for (y = 0; y < h_src; y++) {
+		const uint8_t *s = (const uint8_t*)GP_PIXEL_ADDR_24BPP(src, x_src, y_src + y);
+		uint8_t *d = (uint8_t*)GP_PIXEL_ADDR_24BPP(dst, x_dst, y_dst + y);
+
+		for (x = 0; x < w_src; x++) {
+			d[0] = luts[0][s[0]];
+			d[1] = luts[1][s[1]];
+			d[2] = luts[2][s[2]];
+			s += 3;
+			d += 3;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+/*
+ * All BGR888 channels are whole bytes, so we can look up the bytes
+ * directly instead of unpacking and packing the pixel values.
+ *
+ * Which byte in memory belongs to which channel depends on the pixel packing
+ * so we find out by storing each channel mask into a pixel. Padding bytes, if
+ * any, are copied unchanged.
+ */
+static void byte_luts_BGR888(const gp_filter_tables *const tables,
+                                    uint8_t luts[3][256])
+{
+	gp_pixel buf;
+	uint8_t *bytes = (uint8_t*)&buf;
+	gp_pixmap tmp;
+	unsigned int i, j;
+
+	gp_pixmap_init(&tmp, 1, 1, GP_PIXEL_BGR888, &buf, 0);
+
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < 256; j++)
+			luts[i][j] = j;
+	}
+
+	buf = 0;
+	gp_putpixel_raw_24BPP(&tmp, 0, 0, 0xff0000);
+	for (i = 0; i < 3; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[0][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_24BPP(&tmp, 0, 0, 0xff00);
+	for (i = 0; i < 3; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[1][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_24BPP(&tmp, 0, 0, 0xff);
+	for (i = 0; i < 3; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[2][j];
+	}
+
+}
+
+static int apply_tables_BGR888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	uint8_t luts[3][256];
+
+	byte_luts_BGR888(tables, luts);
+
+	for (y = 0; y < h_src; y++) {
+		const uint8_t *s = (const uint8_t*)GP_PIXEL_ADDR_24BPP(src, x_src, y_src + y);
+		uint8_t *d = (uint8_t*)GP_PIXEL_ADDR_24BPP(dst, x_dst, y_dst + y);
+
+		for (x = 0; x < w_src; x++) {
+			d[0] = luts[0][s[0]];
+			d[1] = luts[1][s[1]];
+			d[2] = luts[2][s[2]];
+			s += 3;
+			d += 3;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB555(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGB555(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGB555(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGB555(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_RGB555(R, G, B);
+			gp_putpixel_raw_16BPP_BE(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB565_BE(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGB565_BE(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGB565_BE(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGB565_BE(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_RGB565_BE(R, G, B);
+			gp_putpixel_raw_16BPP_BE(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB565_LE(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGB565_LE(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGB565_LE(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGB565_LE(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_RGB565_LE(R, G, B);
+			gp_putpixel_raw_16BPP_LE(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB666(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGB666(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGB666(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGB666(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_RGB666(R, G, B);
+			gp_putpixel_raw_18BPP_DB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_RGB332(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel R;
+	gp_pixel G;
+	gp_pixel B;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, src_x, src_y);
+
+			R = GP_PIXEL_GET_R_RGB332(pix);
+			R = tables->table[0][R];
+			G = GP_PIXEL_GET_G_RGB332(pix);
+			G = tables->table[1][G];
+			B = GP_PIXEL_GET_B_RGB332(pix);
+			B = tables->table[2][B];
+
+			pix = GP_PIXEL_CREATE_RGB332(R, G, B);
+			gp_putpixel_raw_8BPP(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+/*
+ * All CMYK8888 channels are whole bytes, so we can look up the bytes
+ * directly instead of unpacking and packing the pixel values.
+ *
+ * Which byte in memory belongs to which channel depends on the pixel packing
+ * so we find out by storing each channel mask into a pixel. Padding bytes, if
+ * any, are copied unchanged.
+ */
+static void byte_luts_CMYK8888(const gp_filter_tables *const tables,
+                                    uint8_t luts[4][256])
+{
+	gp_pixel buf;
+	uint8_t *bytes = (uint8_t*)&buf;
+	gp_pixmap tmp;
+	unsigned int i, j;
+
+	gp_pixmap_init(&tmp, 1, 1, GP_PIXEL_CMYK8888, &buf, 0);
+
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < 256; j++)
+			luts[i][j] = j;
+	}
+
+	buf = 0;
+	gp_putpixel_raw_32BPP(&tmp, 0, 0, 0xff000000);
+	for (i = 0; i < 4; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[0][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_32BPP(&tmp, 0, 0, 0xff0000);
+	for (i = 0; i < 4; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[1][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_32BPP(&tmp, 0, 0, 0xff00);
+	for (i = 0; i < 4; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[2][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_32BPP(&tmp, 0, 0, 0xff);
+	for (i = 0; i < 4; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[3][j];
+	}
+
+}
+
+static int apply_tables_CMYK8888(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	uint8_t luts[4][256];
+
+	byte_luts_CMYK8888(tables, luts);
+
+	for (y = 0; y < h_src; y++) {
+		const uint8_t *s = (const uint8_t*)GP_PIXEL_ADDR_32BPP(src, x_src, y_src + y);
+		uint8_t *d = (uint8_t*)GP_PIXEL_ADDR_32BPP(dst, x_dst, y_dst + y);
+
+		for (x = 0; x < w_src; x++) {
+			d[0] = luts[0][s[0]];
+			d[1] = luts[1][s[1]];
+			d[2] = luts[2][s[2]];
+			d[3] = luts[3][s[3]];
+			s += 4;
+			d += 4;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G1_DB(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G1_DB(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G1_DB(V);
+			gp_putpixel_raw_1BPP_DB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G2_DB(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G2_DB(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G2_DB(V);
+			gp_putpixel_raw_2BPP_DB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G4_DB(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G4_DB(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G4_DB(V);
+			gp_putpixel_raw_4BPP_DB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G1_UB(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G1_UB(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G1_UB(V);
+			gp_putpixel_raw_1BPP_UB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G2_UB(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G2_UB(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G2_UB(V);
+			gp_putpixel_raw_2BPP_UB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G4_UB(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G4_UB(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G4_UB(V);
+			gp_putpixel_raw_4BPP_UB(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+/*
+ * All G8 channels are whole bytes, so we can look up the bytes
+ * directly instead of unpacking and packing the pixel values.
+ *
+ * Which byte in memory belongs to which channel depends on the pixel packing
+ * so we find out by storing each channel mask into a pixel. Padding bytes, if
+ * any, are copied unchanged.
+ */
+static void byte_luts_G8(const gp_filter_tables *const tables,
+                                    uint8_t luts[1][256])
+{
+	gp_pixel buf;
+	uint8_t *bytes = (uint8_t*)&buf;
+	gp_pixmap tmp;
+	unsigned int i, j;
+
+	gp_pixmap_init(&tmp, 1, 1, GP_PIXEL_G8, &buf, 0);
+
+	for (i = 0; i < 1; i++) {
+		for (j = 0; j < 256; j++)
+			luts[i][j] = j;
+	}
+
+	buf = 0;
+	gp_putpixel_raw_8BPP(&tmp, 0, 0, 0xff);
+	for (i = 0; i < 1; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[0][j];
+	}
+
+}
+
+static int apply_tables_G8(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	uint8_t luts[1][256];
+
+	byte_luts_G8(tables, luts);
+
+	for (y = 0; y < h_src; y++) {
+		const uint8_t *s = (const uint8_t*)GP_PIXEL_ADDR_8BPP(src, x_src, y_src + y);
+		uint8_t *d = (uint8_t*)GP_PIXEL_ADDR_8BPP(dst, x_dst, y_dst + y);
+
+		for (x = 0; x < w_src; x++) {
+			d[0] = luts[0][s[0]];
+			s += 1;
+			d += 1;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+/*
+ * All GA88 channels are whole bytes, so we can look up the bytes
+ * directly instead of unpacking and packing the pixel values.
+ *
+ * Which byte in memory belongs to which channel depends on the pixel packing
+ * so we find out by storing each channel mask into a pixel. Padding bytes, if
+ * any, are copied unchanged.
+ */
+static void byte_luts_GA88(const gp_filter_tables *const tables,
+                                    uint8_t luts[2][256])
+{
+	gp_pixel buf;
+	uint8_t *bytes = (uint8_t*)&buf;
+	gp_pixmap tmp;
+	unsigned int i, j;
+
+	gp_pixmap_init(&tmp, 1, 1, GP_PIXEL_GA88, &buf, 0);
+
+	for (i = 0; i < 2; i++) {
+		for (j = 0; j < 256; j++)
+			luts[i][j] = j;
+	}
+
+	buf = 0;
+	gp_putpixel_raw_16BPP_LE(&tmp, 0, 0, 0xff);
+	for (i = 0; i < 2; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[0][j];
+	}
+
+	buf = 0;
+	gp_putpixel_raw_16BPP_LE(&tmp, 0, 0, 0xff00);
+	for (i = 0; i < 2; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[1][j];
+	}
+
+}
+
+static int apply_tables_GA88(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	uint8_t luts[2][256];
+
+	byte_luts_GA88(tables, luts);
+
+	for (y = 0; y < h_src; y++) {
+		const uint8_t *s = (const uint8_t*)GP_PIXEL_ADDR_16BPP_LE(src, x_src, y_src + y);
+		uint8_t *d = (uint8_t*)GP_PIXEL_ADDR_16BPP_LE(dst, x_dst, y_dst + y);
+
+		for (x = 0; x < w_src; x++) {
+			d[0] = luts[0][s[0]];
+			d[1] = luts[1][s[1]];
+			s += 2;
+			d += 2;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables_G16(const gp_pixmap *const src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      const gp_filter_tables *const tables,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	unsigned int x, y;
+
+	gp_pixel V;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, src_x, src_y);
+
+			V = GP_PIXEL_GET_V_G16(pix);
+			V = tables->table[0][V];
+
+			pix = GP_PIXEL_CREATE_G16(V);
+			gp_putpixel_raw_16BPP_LE(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int apply_tables(const gp_pixmap *const src,
+                        gp_coord x_src, gp_coord y_src,
+                        gp_size w_src, gp_size h_src,
+                        gp_pixmap *dst,
+                        gp_coord x_dst, gp_coord y_dst,
+                        const gp_filter_tables *const tables,
+                        gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return apply_tables_RGB101010(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_xRGB8888:
+		return apply_tables_xRGB8888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return apply_tables_RGBA8888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return apply_tables_RGB888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return apply_tables_BGR888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return apply_tables_RGB555(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB565_BE:
+		return apply_tables_RGB565_BE(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB565_LE:
+		return apply_tables_RGB565_LE(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return apply_tables_RGB666(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return apply_tables_RGB332(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return apply_tables_CMYK8888(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G1_DB:
+		return apply_tables_G1_DB(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G2_DB:
+		return apply_tables_G2_DB(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G4_DB:
+		return apply_tables_G4_DB(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G1_UB:
+		return apply_tables_G1_UB(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G2_UB:
+		return apply_tables_G2_UB(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G4_UB:
+		return apply_tables_G4_UB(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G8:
+		return apply_tables_G8(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return apply_tables_GA88(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	case GP_PIXEL_G16:
+		return apply_tables_G16(src, x_src, y_src,
+		                                  w_src, h_src, dst,
+		                                  x_dst, y_dst,
+		                                  tables, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+#ifdef HAVE_PTHREAD
+struct apply_tables_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	const gp_filter_tables *tables;
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
+
+static void *apply_tables_thread(void *arg)
+{
+	struct apply_tables_args *a = arg;
+
+	a->ret = apply_tables(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  a->tables, a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int apply_tables_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       const gp_filter_tables *tables,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+	t = GP_MIN(t, h_src);
+
+	if (t <= 1) {
+		return apply_tables(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, tables, callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct apply_tables_args args[t];
+	char started[t];
+	gp_size h = h_src / t;
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct apply_tables_args) {
+			.src = src,
+			.x_src = x_src,
+			.y_src = y_src + i * h,
+			.w_src = w_src,
+			.h_src = i == t - 1 ? h_src - i * h : h,
+			.dst = dst,
+			.x_dst = x_dst,
+			.y_dst = y_dst + i * h,
+			.tables = tables,
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, apply_tables_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			apply_tables_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+#else
+static int apply_tables_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       const gp_filter_tables *tables,
+                       gp_progress_cb *callback)
+{
+	return apply_tables(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, tables, callback);
+}
+#endif /* HAVE_PTHREAD */
+
+int gp_filter_tables_apply(const gp_pixmap *const src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           gp_pixmap *dst,
+                           gp_coord x_dst, gp_coord y_dst,
+                           const gp_filter_tables *const tables,
+                           gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type);
+	//TODO: Assert size
+
+	return apply_tables_mp(src, x_src, y_src, w_src, h_src,
+	                       dst, x_dst, y_dst, tables, callback);
+}
@@ -1,20 +1,74 @@
 @ include source.t
+@ include thread_dispatcher.t
 /*
  * Generic Point filer
  *
- * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
  */
 
 #include <errno.h>
+#include <string.h>
+
+#include "../../config.h"
 
 #include <core/gp_pixmap.h>
 #include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
 #include <core/gp_debug.h>
 
 #include <filters/gp_apply_tables.h>
 
+@ def is_byte_aligned(pt):
+@     if pt.pixelpack.size % 8 or pt.pixelpack.size > 32:
+@         return False
+@     for c in pt.chanslist:
+@         if c.size != 8 or c.off % 8:
+@             return False
+@     return True
+@ end
+@
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
+@         if is_byte_aligned(pt):
+@             bpp = pt.pixelpack.size // 8
+/*
+ * All {{ pt.name }} channels are whole bytes, so we can look up the bytes
+ * directly instead of unpacking and packing the pixel values.
+ *
+ * Which byte in memory belongs to which channel depends on the pixel packing
+ * so we find out by storing each channel mask into a pixel. Padding bytes, if
+ * any, are copied unchanged.
+ */
+static void byte_luts_{{ pt.name }}(const gp_filter_tables *const tables,
+                                    uint8_t luts[{{ bpp }}][256])
+{
+	gp_pixel buf;
+	uint8_t *bytes = (uint8_t*)&buf;
+	gp_pixmap tmp;
+	unsigned int i, j;
+
+	gp_pixmap_init(&tmp, 1, 1, GP_PIXEL_{{ pt.name }}, &buf, 0);
+
+	for (i = 0; i < {{ bpp }}; i++) {
+		for (j = 0; j < 256; j++)
+			luts[i][j] = j;
+	}
+
+@             for c in pt.chanslist:
+	buf = 0;
+	gp_putpixel_raw_{{ pt.pixelpack.suffix }}(&tmp, 0, 0, {{ c.C_mask }});
+	for (i = 0; i < {{ bpp }}; i++) {
+		if (bytes[i] != 0xff)
+			continue;
+
+		for (j = 0; j < 256; j++)
+			luts[i][j] = tables->table[{{ c.idx }}][j];
+	}
+
+@             end
+}
+
+@         end
 static int apply_tables_{{ pt.name }}(const gp_pixmap *const src,
                                       gp_coord x_src, gp_coord y_src,
                                       gp_size w_src, gp_size h_src,
@@ -27,9 +81,32 @@ static int apply_tables_{{ pt.name }}(const gp_pixmap *const src,
 
 	unsigned int x, y;
 
-@         for c in pt.chanslist:
+@         if is_byte_aligned(pt):
+	uint8_t luts[{{ bpp }}][256];
+
+	byte_luts_{{ pt.name }}(tables, luts);
+
+	for (y = 0; y < h_src; y++) {
+		const uint8_t *s = (const uint8_t*)GP_PIXEL_ADDR_{{ pt.pixelpack.suffix }}(src, x_src, y_src + y);
+		uint8_t *d = (uint8_t*)GP_PIXEL_ADDR_{{ pt.pixelpack.suffix }}(dst, x_dst, y_dst + y);
+
+		for (x = 0; x < w_src; x++) {
+@             for i in range(0, bpp):
+			d[{{ i }}] = luts[{{ i }}][s[{{ i }}]];
+@             end
+			s += {{ bpp }};
+			d += {{ bpp }};
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+@         else:
+@             for c in pt.chanslist:
 	gp_pixel {{ c.name }};
-@         end
+@             end
 
 	for (y = 0; y < h_src; y++) {
 		for (x = 0; x < w_src; x++) {
@@ -40,10 +117,10 @@ static int apply_tables_{{ pt.name }}(const gp_pixmap *const src,
 
 			gp_pixel pix = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, src_x, src_y);
 
-@         for c in pt.chanslist:
+@             for c in pt.chanslist:
 			{{ c.name }} = GP_PIXEL_GET_{{ c[0] }}_{{ pt.name }}(pix);
 			{{ c.name }} = tables->table[{{ c.idx }}][{{ c.name }}];
-@         end
+@             end
 
 			pix = GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names) }});
 			gp_putpixel_raw_{{ pt.pixelpack.suffix }}(dst, dst_x, dst_y, pix);
@@ -54,6 +131,7 @@ static int apply_tables_{{ pt.name }}(const gp_pixmap *const src,
 			return 1;
 		}
 	}
+@         end
 
 	gp_progress_cb_done(callback);
 
@@ -62,17 +140,14 @@ static int apply_tables_{{ pt.name }}(const gp_pixmap *const src,
 
 @ end
 @
-int gp_filter_tables_apply(const gp_pixmap *const src,
-                           gp_coord x_src, gp_coord y_src,
-                           gp_size w_src, gp_size h_src,
-                           gp_pixmap *dst,
-                           gp_coord x_dst, gp_coord y_dst,
-                           const gp_filter_tables *const tables,
-                           gp_progress_cb *callback)
+static int apply_tables(const gp_pixmap *const src,
+                        gp_coord x_src, gp_coord y_src,
+                        gp_size w_src, gp_size h_src,
+                        gp_pixmap *dst,
+                        gp_coord x_dst, gp_coord y_dst,
+                        const gp_filter_tables *const tables,
+                        gp_progress_cb *callback)
 {
-	GP_ASSERT(src->pixel_type == dst->pixel_type);
-	//TODO: Assert size
-
 	switch (src->pixel_type) {
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
@@ -88,3 +163,20 @@ int gp_filter_tables_apply(const gp_pixmap *const src,
 		return -1;
 	}
 }
+
+{@ dispatcher('apply_tables', [['const gp_filter_tables *', 'tables']]) @}
+
+int gp_filter_tables_apply(const gp_pixmap *const src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           gp_pixmap *dst,
+                           gp_coord x_dst, gp_coord y_dst,
+                           const gp_filter_tables *const tables,
+                           gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type);
+	//TODO: Assert size
+
+	return apply_tables_mp(src, x_src, y_src, w_src, h_src,
+	                       dst, x_dst, y_dst, tables, callback);
+}
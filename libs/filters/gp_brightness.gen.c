@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_brightness.gen.c
+ *
+ * GENERATED on 2026 10 19 18:18:09 from gp_brightness.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Brightness Point filter
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_clamp.h>
+
+
+#include <errno.h>
+
+#include <core/gp_debug.h>
+
+#include <filters/gp_point_chain.h>
+#include <filters/gp_point.h>
+
+void gp_point_chain_brightness(gp_point_chain *self, float p)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(self->pixel_type);
+	unsigned int i;
+	gp_pixel j;
+
+	for (i = 0; i < desc->numchannels; i++) {
+		gp_pixel chan_max = (1 << desc->channels[i].size);
+		gp_pixel *table = self->tables.table[i];
+
+		for (j = 0; j < chan_max; j++)
+			table[j] = GP_CLAMP_GENERIC(((signed)table[j]) + (p * ((signed)chan_max - 1) + 0.5), 0, ((signed)chan_max - 1));
+	}
+}
+int gp_filter_brightness_ex(const gp_pixmap *const src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               float p,
+                               gp_progress_cb *callback)
+{
+	gp_point_chain chain;
+	int ret, err;
+
+	if (gp_point_chain_init(&chain, src->pixel_type))
+		return 1;
+
+	gp_point_chain_brightness(&chain, p);
+
+	ret = gp_point_chain_apply_ex(src, x_src, y_src, w_src, h_src,
+	                              dst, x_dst, y_dst, &chain, callback);
+
+	err = errno;
+	gp_point_chain_exit(&chain);
+	errno = err;
+
+	return ret;
+}
+gp_pixmap *gp_filter_brightness_ex_alloc(const gp_pixmap *const src,
+                                            gp_coord x_src, gp_coord y_src,
+                                            gp_size w_src, gp_size h_src,
+                                            float p,
+                                            gp_progress_cb *callback)
+{
+	gp_pixmap *new = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (gp_filter_brightness_ex(src, x_src, y_src, w_src, h_src, new, 0, 0,
+	                               p,callback)) {
+		int err = errno;
+		gp_pixmap_free(new);
+		errno = err;
+		return NULL;
+	}
+
+	return new;
+}
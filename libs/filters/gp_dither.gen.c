@@ -0,0 +1,12599 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_dither.gen.c
+ *
+ * GENERATED on 2026 10 19 20:26:18 from gp_dither.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Floyd Steinberg dithering -> any pixel
+ *
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <sched.h>
+
+#include "../../config.h"
+
+#include <core/gp_debug.h>
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_convert.h>
+#include <core/gp_clamp.h>
+#include <core/gp_threads.h>
+#include <filters/gp_filter.h>
+#include <filters/gp_dither.gen.h>
+
+#ifdef HAVE_PTHREAD
+/*
+ * Wavefront parallel error diffusion.
+ *
+ * Rows are distributed between threads round robin and each row waits for the
+ * row above to be far enough ahead. The kernels reach at most two pixels left
+ * and right, the current row may read an error once the row above has gone
+ * past it and the row above must not write the errors the current row is
+ * writing ahead, hence the lag of 2*2+1 pixels, rounded up.
+ *
+ * The errors are integers so the order in which they are accumulated does not
+ * matter and the result is identical to the sequential version.
+ */
+#define WAVEFRONT_LAG 8
+#define WAVEFRONT_BLOCK 64
+
+struct wavefront {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	unsigned int threads;
+
+	/* Error rows ring buffers, one for each channel */
+	uint32_t *errors;
+	unsigned int err_rows;
+	unsigned int err_w;
+
+	/* Number of pixels done by each thread as y * w + x */
+	size_t *done;
+	int abort;
+
+	gp_progress_cb *callback;
+};
+
+struct wavefront_thread {
+	struct wavefront *wf;
+	unsigned int id;
+};
+
+static uint32_t *wavefront_row(struct wavefront *self, unsigned int chan, gp_coord y)
+{
+	return self->errors + (chan * self->err_rows + y % self->err_rows) * self->err_w;
+}
+
+static void wavefront_publish(struct wavefront *self, unsigned int id, size_t pos)
+{
+	__atomic_store_n(&self->done[id], pos, __ATOMIC_RELEASE);
+}
+
+/*
+ * Waits until the thread processing the row above has done pos pixels.
+ *
+ * Returns non-zero if the operation was aborted.
+ */
+static int wavefront_wait(struct wavefront *self, unsigned int id, size_t pos)
+{
+	unsigned int prev = id ? id - 1 : self->threads - 1;
+
+	while (__atomic_load_n(&self->done[prev], __ATOMIC_ACQUIRE) < pos) {
+		if (__atomic_load_n(&self->abort, __ATOMIC_RELAXED))
+			return 1;
+
+		sched_yield();
+	}
+
+	return 0;
+}
+
+static void wavefront_abort(struct wavefront *self)
+{
+	__atomic_store_n(&self->abort, 1, __ATOMIC_RELAXED);
+}
+
+static int wavefront_run(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_progress_cb *callback, unsigned int threads,
+                         unsigned int rows, unsigned int add, unsigned int chans,
+                         void *(*fn)(void *),
+                         int (*raw)(const gp_pixmap *, gp_pixmap *, gp_progress_cb *))
+{
+	unsigned int i;
+	int ret;
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	/* Rows in flight plus the rows below the last one the errors go to */
+	struct wavefront wf = {
+		.src = src,
+		.dst = dst,
+		.threads = threads,
+		.err_rows = threads + rows - 1,
+		.err_w = src->w + add,
+		.callback = callback ? &callback_mp : NULL,
+	};
+
+	wf.errors = calloc((size_t)wf.err_rows * wf.err_w * chans, sizeof(uint32_t));
+	wf.done = calloc(threads, sizeof(size_t));
+
+	if (!wf.errors || !wf.done) {
+		free(wf.errors);
+		free(wf.done);
+		errno = ENOMEM;
+		return 1;
+	}
+
+	pthread_t tids[threads];
+	struct wavefront_thread args[threads];
+
+	/*
+	 * Each row depends on the row above, hence we cannot run the rows in
+	 * the caller if thread creation fails. Abort the threads that were
+	 * started and dither the whole image sequentially instead.
+	 */
+	for (i = 0; i < threads; i++) {
+		args[i].wf = &wf;
+		args[i].id = i;
+
+		if (pthread_create(&tids[i], NULL, fn, &args[i])) {
+			GP_DEBUG(1, "pthread_create() failed, running sequentially");
+			wavefront_abort(&wf);
+			break;
+		}
+	}
+
+	unsigned int started = i;
+
+	while (i-- > 0)
+		pthread_join(tids[i], NULL);
+
+	ret = wf.abort;
+
+	free(wf.errors);
+	free(wf.done);
+
+	if (started < threads)
+		return raw(src, dst, callback);
+
+	if (!ret)
+		gp_progress_cb_done(callback);
+
+	return ret;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to RGB101010
+ */
+static int floyd_steinberg_to_RGB101010_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB101010),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 1023 * val_R / 255;
+			err_R -= res_R * 255 / 1023;
+
+			err0_R[x+2] += 7 * err_R;
+			err1_R[x] += 3 * err_R;
+			err1_R[x+1] += 5 * err_R;
+			err1_R[x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 1023);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 1023 * val_G / 255;
+			err_G -= res_G * 255 / 1023;
+
+			err0_G[x+2] += 7 * err_G;
+			err1_G[x] += 3 * err_G;
+			err1_G[x+1] += 5 * err_G;
+			err1_G[x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 1023);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 1023 * val_B / 255;
+			err_B -= res_B * 255 / 1023;
+
+			err0_B[x+2] += 7 * err_B;
+			err1_B[x] += 3 * err_B;
+			err1_B[x+1] += 5 * err_B;
+			err1_B[x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 1023);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_RGB101010_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 16;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 1023 * val_R / 255;
+				err_R -= res_R * 255 / 1023;
+
+				err0_R[x+2] += 7 * err_R;
+				err1_R[x] += 3 * err_R;
+				err1_R[x+1] += 5 * err_R;
+				err1_R[x+2] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 1023);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 16;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 1023 * val_G / 255;
+				err_G -= res_G * 255 / 1023;
+
+				err0_G[x+2] += 7 * err_G;
+				err1_G[x] += 3 * err_G;
+				err1_G[x+1] += 5 * err_G;
+				err1_G[x+2] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 1023);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 16;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 1023 * val_B / 255;
+				err_B -= res_B * 255 / 1023;
+
+				err0_B[x+2] += 7 * err_B;
+				err1_B[x] += 3 * err_B;
+				err1_B[x+1] += 5 * err_B;
+				err1_B[x+2] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 1023);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+				gp_putpixel_raw_32BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to xRGB8888
+ */
+static int floyd_steinberg_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			err0_R[x+2] += 7 * err_R;
+			err1_R[x] += 3 * err_R;
+			err1_R[x+1] += 5 * err_R;
+			err1_R[x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			err0_G[x+2] += 7 * err_G;
+			err1_G[x] += 3 * err_G;
+			err1_G[x+1] += 5 * err_G;
+			err1_G[x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			err0_B[x+2] += 7 * err_B;
+			err1_B[x] += 3 * err_B;
+			err1_B[x+1] += 5 * err_B;
+			err1_B[x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_xRGB8888_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 16;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 255 * val_R / 255;
+				err_R -= res_R * 255 / 255;
+
+				err0_R[x+2] += 7 * err_R;
+				err1_R[x] += 3 * err_R;
+				err1_R[x+1] += 5 * err_R;
+				err1_R[x+2] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 255);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 16;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 255 * val_G / 255;
+				err_G -= res_G * 255 / 255;
+
+				err0_G[x+2] += 7 * err_G;
+				err1_G[x] += 3 * err_G;
+				err1_G[x+1] += 5 * err_G;
+				err1_G[x+2] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 255);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 16;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 255 * val_B / 255;
+				err_B -= res_B * 255 / 255;
+
+				err0_B[x+2] += 7 * err_B;
+				err1_B[x] += 3 * err_B;
+				err1_B[x+1] += 5 * err_B;
+				err1_B[x+2] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 255);
+
+				gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+				gp_putpixel_raw_32BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to RGB888
+ */
+static int floyd_steinberg_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			err0_R[x+2] += 7 * err_R;
+			err1_R[x] += 3 * err_R;
+			err1_R[x+1] += 5 * err_R;
+			err1_R[x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			err0_G[x+2] += 7 * err_G;
+			err1_G[x] += 3 * err_G;
+			err1_G[x+1] += 5 * err_G;
+			err1_G[x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			err0_B[x+2] += 7 * err_B;
+			err1_B[x] += 3 * err_B;
+			err1_B[x+1] += 5 * err_B;
+			err1_B[x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_RGB888_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 16;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 255 * val_R / 255;
+				err_R -= res_R * 255 / 255;
+
+				err0_R[x+2] += 7 * err_R;
+				err1_R[x] += 3 * err_R;
+				err1_R[x+1] += 5 * err_R;
+				err1_R[x+2] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 255);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 16;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 255 * val_G / 255;
+				err_G -= res_G * 255 / 255;
+
+				err0_G[x+2] += 7 * err_G;
+				err1_G[x] += 3 * err_G;
+				err1_G[x+1] += 5 * err_G;
+				err1_G[x+2] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 255);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 16;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 255 * val_B / 255;
+				err_B -= res_B * 255 / 255;
+
+				err0_B[x+2] += 7 * err_B;
+				err1_B[x] += 3 * err_B;
+				err1_B[x+1] += 5 * err_B;
+				err1_B[x+2] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 255);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+				gp_putpixel_raw_24BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to BGR888
+ */
+static int floyd_steinberg_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			err0_B[x+2] += 7 * err_B;
+			err1_B[x] += 3 * err_B;
+			err1_B[x+1] += 5 * err_B;
+			err1_B[x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			err0_G[x+2] += 7 * err_G;
+			err1_G[x] += 3 * err_G;
+			err1_G[x+1] += 5 * err_G;
+			err1_G[x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			err0_R[x+2] += 7 * err_R;
+			err1_R[x] += 3 * err_R;
+			err1_R[x+1] += 5 * err_R;
+			err1_R[x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_BGR888_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_B = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_R = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 16;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 255 * val_B / 255;
+				err_B -= res_B * 255 / 255;
+
+				err0_B[x+2] += 7 * err_B;
+				err1_B[x] += 3 * err_B;
+				err1_B[x+1] += 5 * err_B;
+				err1_B[x+2] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 255);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 16;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 255 * val_G / 255;
+				err_G -= res_G * 255 / 255;
+
+				err0_G[x+2] += 7 * err_G;
+				err1_G[x] += 3 * err_G;
+				err1_G[x+1] += 5 * err_G;
+				err1_G[x+2] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 255);
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 16;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 255 * val_R / 255;
+				err_R -= res_R * 255 / 255;
+
+				err0_R[x+2] += 7 * err_R;
+				err1_R[x] += 3 * err_R;
+				err1_R[x+1] += 5 * err_R;
+				err1_R[x+2] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 255);
+
+				gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+				gp_putpixel_raw_24BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to RGB555
+ */
+static int floyd_steinberg_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			err0_R[x+2] += 7 * err_R;
+			err1_R[x] += 3 * err_R;
+			err1_R[x+1] += 5 * err_R;
+			err1_R[x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 31 * val_G / 255;
+			err_G -= res_G * 255 / 31;
+
+			err0_G[x+2] += 7 * err_G;
+			err1_G[x] += 3 * err_G;
+			err1_G[x+1] += 5 * err_G;
+			err1_G[x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 31);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			err0_B[x+2] += 7 * err_B;
+			err1_B[x] += 3 * err_B;
+			err1_B[x+1] += 5 * err_B;
+			err1_B[x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_RGB555_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 16;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 31 * val_R / 255;
+				err_R -= res_R * 255 / 31;
+
+				err0_R[x+2] += 7 * err_R;
+				err1_R[x] += 3 * err_R;
+				err1_R[x+1] += 5 * err_R;
+				err1_R[x+2] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 31);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 16;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 31 * val_G / 255;
+				err_G -= res_G * 255 / 31;
+
+				err0_G[x+2] += 7 * err_G;
+				err1_G[x] += 3 * err_G;
+				err1_G[x+1] += 5 * err_G;
+				err1_G[x+2] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 31);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 16;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 31 * val_B / 255;
+				err_B -= res_B * 255 / 31;
+
+				err0_B[x+2] += 7 * err_B;
+				err1_B[x] += 3 * err_B;
+				err1_B[x+1] += 5 * err_B;
+				err1_B[x+2] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 31);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+				gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to RGB565_BE
+ */
+static int floyd_steinberg_to_RGB565_BE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_BE),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			err0_R[x+2] += 7 * err_R;
+			err1_R[x] += 3 * err_R;
+			err1_R[x+1] += 5 * err_R;
+			err1_R[x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			err0_G[x+2] += 7 * err_G;
+			err1_G[x] += 3 * err_G;
+			err1_G[x+1] += 5 * err_G;
+			err1_G[x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			err0_B[x+2] += 7 * err_B;
+			err1_B[x] += 3 * err_B;
+			err1_B[x+1] += 5 * err_B;
+			err1_B[x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_RGB565_BE_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 16;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 31 * val_R / 255;
+				err_R -= res_R * 255 / 31;
+
+				err0_R[x+2] += 7 * err_R;
+				err1_R[x] += 3 * err_R;
+				err1_R[x+1] += 5 * err_R;
+				err1_R[x+2] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 31);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 16;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 63 * val_G / 255;
+				err_G -= res_G * 255 / 63;
+
+				err0_G[x+2] += 7 * err_G;
+				err1_G[x] += 3 * err_G;
+				err1_G[x+1] += 5 * err_G;
+				err1_G[x+2] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 63);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 16;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 31 * val_B / 255;
+				err_B -= res_B * 255 / 31;
+
+				err0_B[x+2] += 7 * err_B;
+				err1_B[x] += 3 * err_B;
+				err1_B[x+1] += 5 * err_B;
+				err1_B[x+2] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 31);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B);
+
+				gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to RGB565_LE
+ */
+static int floyd_steinberg_to_RGB565_LE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_LE),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			err0_R[x+2] += 7 * err_R;
+			err1_R[x] += 3 * err_R;
+			err1_R[x+1] += 5 * err_R;
+			err1_R[x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			err0_G[x+2] += 7 * err_G;
+			err1_G[x] += 3 * err_G;
+			err1_G[x+1] += 5 * err_G;
+			err1_G[x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			err0_B[x+2] += 7 * err_B;
+			err1_B[x] += 3 * err_B;
+			err1_B[x+1] += 5 * err_B;
+			err1_B[x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_RGB565_LE_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 16;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 31 * val_R / 255;
+				err_R -= res_R * 255 / 31;
+
+				err0_R[x+2] += 7 * err_R;
+				err1_R[x] += 3 * err_R;
+				err1_R[x+1] += 5 * err_R;
+				err1_R[x+2] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 31);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 16;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 63 * val_G / 255;
+				err_G -= res_G * 255 / 63;
+
+				err0_G[x+2] += 7 * err_G;
+				err1_G[x] += 3 * err_G;
+				err1_G[x+1] += 5 * err_G;
+				err1_G[x+2] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 63);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 16;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 31 * val_B / 255;
+				err_B -= res_B * 255 / 31;
+
+				err0_B[x+2] += 7 * err_B;
+				err1_B[x] += 3 * err_B;
+				err1_B[x+1] += 5 * err_B;
+				err1_B[x+2] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 31);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B);
+
+				gp_putpixel_raw_16BPP_LE(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to RGB666
+ */
+static int floyd_steinberg_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 63 * val_R / 255;
+			err_R -= res_R * 255 / 63;
+
+			err0_R[x+2] += 7 * err_R;
+			err1_R[x] += 3 * err_R;
+			err1_R[x+1] += 5 * err_R;
+			err1_R[x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 63);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			err0_G[x+2] += 7 * err_G;
+			err1_G[x] += 3 * err_G;
+			err1_G[x+1] += 5 * err_G;
+			err1_G[x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 63 * val_B / 255;
+			err_B -= res_B * 255 / 63;
+
+			err0_B[x+2] += 7 * err_B;
+			err1_B[x] += 3 * err_B;
+			err1_B[x+1] += 5 * err_B;
+			err1_B[x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 63);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_RGB666_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 16;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 63 * val_R / 255;
+				err_R -= res_R * 255 / 63;
+
+				err0_R[x+2] += 7 * err_R;
+				err1_R[x] += 3 * err_R;
+				err1_R[x+1] += 5 * err_R;
+				err1_R[x+2] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 63);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 16;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 63 * val_G / 255;
+				err_G -= res_G * 255 / 63;
+
+				err0_G[x+2] += 7 * err_G;
+				err1_G[x] += 3 * err_G;
+				err1_G[x+1] += 5 * err_G;
+				err1_G[x+2] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 63);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 16;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 63 * val_B / 255;
+				err_B -= res_B * 255 / 63;
+
+				err0_B[x+2] += 7 * err_B;
+				err1_B[x] += 3 * err_B;
+				err1_B[x+1] += 5 * err_B;
+				err1_B[x+2] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 63);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+				gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to RGB332
+ */
+static int floyd_steinberg_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 16;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 7 * val_R / 255;
+			err_R -= res_R * 255 / 7;
+
+			err0_R[x+2] += 7 * err_R;
+			err1_R[x] += 3 * err_R;
+			err1_R[x+1] += 5 * err_R;
+			err1_R[x+2] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 7);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 16;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 7 * val_G / 255;
+			err_G -= res_G * 255 / 7;
+
+			err0_G[x+2] += 7 * err_G;
+			err1_G[x] += 3 * err_G;
+			err1_G[x+1] += 5 * err_G;
+			err1_G[x+2] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 7);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 16;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 3 * val_B / 255;
+			err_B -= res_B * 255 / 3;
+
+			err0_B[x+2] += 7 * err_B;
+			err1_B[x] += 3 * err_B;
+			err1_B[x+1] += 5 * err_B;
+			err1_B[x+2] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 3);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_RGB332_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 16;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 7 * val_R / 255;
+				err_R -= res_R * 255 / 7;
+
+				err0_R[x+2] += 7 * err_R;
+				err1_R[x] += 3 * err_R;
+				err1_R[x+1] += 5 * err_R;
+				err1_R[x+2] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 7);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 16;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 7 * val_G / 255;
+				err_G -= res_G * 255 / 7;
+
+				err0_G[x+2] += 7 * err_G;
+				err1_G[x] += 3 * err_G;
+				err1_G[x+1] += 5 * err_G;
+				err1_G[x+2] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 7);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 16;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 3 * val_B / 255;
+				err_B -= res_B * 255 / 3;
+
+				err0_B[x+2] += 7 * err_B;
+				err1_B[x] += 3 * err_B;
+				err1_B[x+1] += 5 * err_B;
+				err1_B[x+2] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 3);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+				gp_putpixel_raw_8BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to G1_DB
+ */
+static int floyd_steinberg_to_G1_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			err0_V[x+2] += 7 * err_V;
+			err1_V[x] += 3 * err_V;
+			err1_V[x+1] += 5 * err_V;
+			err1_V[x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_G1_DB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 16;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 1 * val_V / 255;
+				err_V -= res_V * 255 / 1;
+
+				err0_V[x+2] += 7 * err_V;
+				err1_V[x] += 3 * err_V;
+				err1_V[x+1] += 5 * err_V;
+				err1_V[x+2] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 1);
+
+				gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to G2_DB
+ */
+static int floyd_steinberg_to_G2_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			err0_V[x+2] += 7 * err_V;
+			err1_V[x] += 3 * err_V;
+			err1_V[x+1] += 5 * err_V;
+			err1_V[x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_G2_DB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 16;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 3 * val_V / 255;
+				err_V -= res_V * 255 / 3;
+
+				err0_V[x+2] += 7 * err_V;
+				err1_V[x] += 3 * err_V;
+				err1_V[x+1] += 5 * err_V;
+				err1_V[x+2] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 3);
+
+				gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to G4_DB
+ */
+static int floyd_steinberg_to_G4_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			err0_V[x+2] += 7 * err_V;
+			err1_V[x] += 3 * err_V;
+			err1_V[x+1] += 5 * err_V;
+			err1_V[x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_G4_DB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 16;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 15 * val_V / 255;
+				err_V -= res_V * 255 / 15;
+
+				err0_V[x+2] += 7 * err_V;
+				err1_V[x] += 3 * err_V;
+				err1_V[x+1] += 5 * err_V;
+				err1_V[x+2] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 15);
+
+				gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to G1_UB
+ */
+static int floyd_steinberg_to_G1_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			err0_V[x+2] += 7 * err_V;
+			err1_V[x] += 3 * err_V;
+			err1_V[x+1] += 5 * err_V;
+			err1_V[x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_G1_UB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 16;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 1 * val_V / 255;
+				err_V -= res_V * 255 / 1;
+
+				err0_V[x+2] += 7 * err_V;
+				err1_V[x] += 3 * err_V;
+				err1_V[x+1] += 5 * err_V;
+				err1_V[x+2] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 1);
+
+				gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to G2_UB
+ */
+static int floyd_steinberg_to_G2_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			err0_V[x+2] += 7 * err_V;
+			err1_V[x] += 3 * err_V;
+			err1_V[x+1] += 5 * err_V;
+			err1_V[x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_G2_UB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 16;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 3 * val_V / 255;
+				err_V -= res_V * 255 / 3;
+
+				err0_V[x+2] += 7 * err_V;
+				err1_V[x] += 3 * err_V;
+				err1_V[x+1] += 5 * err_V;
+				err1_V[x+2] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 3);
+
+				gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to G4_UB
+ */
+static int floyd_steinberg_to_G4_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			err0_V[x+2] += 7 * err_V;
+			err1_V[x] += 3 * err_V;
+			err1_V[x+1] += 5 * err_V;
+			err1_V[x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_G4_UB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 16;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 15 * val_V / 255;
+				err_V -= res_V * 255 / 15;
+
+				err0_V[x+2] += 7 * err_V;
+				err1_V[x] += 3 * err_V;
+				err1_V[x+1] += 5 * err_V;
+				err1_V[x+2] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 15);
+
+				gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to G8
+ */
+static int floyd_steinberg_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			err0_V[x+2] += 7 * err_V;
+			err1_V[x] += 3 * err_V;
+			err1_V[x+1] += 5 * err_V;
+			err1_V[x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_G8_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 16;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 255 * val_V / 255;
+				err_V -= res_V * 255 / 255;
+
+				err0_V[x+2] += 7 * err_V;
+				err1_V[x] += 3 * err_V;
+				err1_V[x+1] += 5 * err_V;
+				err1_V[x+2] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 255);
+
+				gp_putpixel_raw_8BPP(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to GA88
+ */
+static int floyd_steinberg_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+	uint32_t errors_A[2][src->w + 2];
+	memset(errors_A, 0, sizeof(errors_A));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+		uint32_t *err0_A = errors_A[(y + 0) % 2];
+		uint32_t *err1_A = errors_A[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			err0_V[x+2] += 7 * err_V;
+			err1_V[x] += 3 * err_V;
+			err1_V[x+1] += 5 * err_V;
+			err1_V[x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+			uint32_t val_A = gp_pixel_to_G8(pix, src->pixel_type);
+			val_A += err0_A[x + 1] / 16;
+
+			uint32_t err_A = val_A;
+
+			gp_pixel res_A = 255 * val_A / 255;
+			err_A -= res_A * 255 / 255;
+
+			err0_A[x+2] += 7 * err_A;
+			err1_A[x] += 3 * err_A;
+			err1_A[x+1] += 5 * err_A;
+			err1_A[x+2] += 1 * err_A;
+
+			GP_CLAMP_DOWN(res_A, 255);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_A, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_GA88_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_A = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_A = wavefront_row(wf, 1, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 16;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 255 * val_V / 255;
+				err_V -= res_V * 255 / 255;
+
+				err0_V[x+2] += 7 * err_V;
+				err1_V[x] += 3 * err_V;
+				err1_V[x+1] += 5 * err_V;
+				err1_V[x+2] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 255);
+				uint32_t val_A = gp_pixel_to_G8(pix, src->pixel_type);
+				val_A += err0_A[x + 1] / 16;
+
+				uint32_t err_A = val_A;
+
+				gp_pixel res_A = 255 * val_A / 255;
+				err_A -= res_A * 255 / 255;
+
+				err0_A[x+2] += 7 * err_A;
+				err1_A[x] += 3 * err_A;
+				err1_A[x+1] += 5 * err_A;
+				err1_A[x+2] += 1 * err_A;
+
+				GP_CLAMP_DOWN(res_A, 255);
+
+				gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_A, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Floyd Steinberg to G16
+ */
+static int floyd_steinberg_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 16;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 65535 * val_V / 255;
+			err_V -= res_V * 255 / 65535;
+
+			err0_V[x+2] += 7 * err_V;
+			err1_V[x] += 3 * err_V;
+			err1_V[x+1] += 5 * err_V;
+			err1_V[x+2] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 65535);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *floyd_steinberg_to_G16_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 16;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 65535 * val_V / 255;
+				err_V -= res_V * 255 / 65535;
+
+				err0_V[x+2] += 7 * err_V;
+				err1_V[x] += 3 * err_V;
+				err1_V[x+1] += 5 * err_V;
+				err1_V[x+2] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 65535);
+
+				gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+static int floyd_steinberg(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+#ifdef HAVE_PTHREAD
+	unsigned int t = GP_MIN(gp_nr_threads(src->w, src->h, callback), src->h);
+
+	if (t > 1) {
+		GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u in %u threads",
+		         gp_pixel_type_name(src->pixel_type),
+		         gp_pixel_type_name(dst->pixel_type),
+		         src->w, src->h, t);
+
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, floyd_steinberg_to_RGB101010_wave,
+			                     floyd_steinberg_to_RGB101010_raw);
+		case GP_PIXEL_xRGB8888:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, floyd_steinberg_to_xRGB8888_wave,
+			                     floyd_steinberg_to_xRGB8888_raw);
+		case GP_PIXEL_RGB888:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, floyd_steinberg_to_RGB888_wave,
+			                     floyd_steinberg_to_RGB888_raw);
+		case GP_PIXEL_BGR888:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, floyd_steinberg_to_BGR888_wave,
+			                     floyd_steinberg_to_BGR888_raw);
+		case GP_PIXEL_RGB555:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, floyd_steinberg_to_RGB555_wave,
+			                     floyd_steinberg_to_RGB555_raw);
+		case GP_PIXEL_RGB565_BE:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, floyd_steinberg_to_RGB565_BE_wave,
+			                     floyd_steinberg_to_RGB565_BE_raw);
+		case GP_PIXEL_RGB565_LE:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, floyd_steinberg_to_RGB565_LE_wave,
+			                     floyd_steinberg_to_RGB565_LE_raw);
+		case GP_PIXEL_RGB666:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, floyd_steinberg_to_RGB666_wave,
+			                     floyd_steinberg_to_RGB666_raw);
+		case GP_PIXEL_RGB332:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, floyd_steinberg_to_RGB332_wave,
+			                     floyd_steinberg_to_RGB332_raw);
+		case GP_PIXEL_G1_DB:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, floyd_steinberg_to_G1_DB_wave,
+			                     floyd_steinberg_to_G1_DB_raw);
+		case GP_PIXEL_G2_DB:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, floyd_steinberg_to_G2_DB_wave,
+			                     floyd_steinberg_to_G2_DB_raw);
+		case GP_PIXEL_G4_DB:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, floyd_steinberg_to_G4_DB_wave,
+			                     floyd_steinberg_to_G4_DB_raw);
+		case GP_PIXEL_G1_UB:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, floyd_steinberg_to_G1_UB_wave,
+			                     floyd_steinberg_to_G1_UB_raw);
+		case GP_PIXEL_G2_UB:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, floyd_steinberg_to_G2_UB_wave,
+			                     floyd_steinberg_to_G2_UB_raw);
+		case GP_PIXEL_G4_UB:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, floyd_steinberg_to_G4_UB_wave,
+			                     floyd_steinberg_to_G4_UB_raw);
+		case GP_PIXEL_G8:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, floyd_steinberg_to_G8_wave,
+			                     floyd_steinberg_to_G8_raw);
+		case GP_PIXEL_GA88:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     2, floyd_steinberg_to_GA88_wave,
+			                     floyd_steinberg_to_GA88_raw);
+		case GP_PIXEL_G16:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, floyd_steinberg_to_G16_wave,
+			                     floyd_steinberg_to_G16_raw);
+		default:
+			errno = EINVAL;
+			return 1;
+		}
+	}
+#endif /* HAVE_PTHREAD */
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return floyd_steinberg_to_RGB101010_raw(src, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return floyd_steinberg_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return floyd_steinberg_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return floyd_steinberg_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return floyd_steinberg_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_BE:
+		return floyd_steinberg_to_RGB565_BE_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_LE:
+		return floyd_steinberg_to_RGB565_LE_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return floyd_steinberg_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return floyd_steinberg_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return floyd_steinberg_to_G1_DB_raw(src, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return floyd_steinberg_to_G2_DB_raw(src, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return floyd_steinberg_to_G4_DB_raw(src, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return floyd_steinberg_to_G1_UB_raw(src, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return floyd_steinberg_to_G2_UB_raw(src, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return floyd_steinberg_to_G4_UB_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return floyd_steinberg_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return floyd_steinberg_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return floyd_steinberg_to_G16_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_floyd_steinberg(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+	return floyd_steinberg(src, dst, callback);
+}
+
+/*
+ * Atkinson to RGB101010
+ */
+static int atkinson_to_RGB101010_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB101010),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 1023 * val_R / 255;
+			err_R -= res_R * 255 / 1023;
+
+			err0_R[x+2] += 1 * err_R;
+			err0_R[x+3] += 1 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+			err1_R[x+2] += 1 * err_R;
+			err2_R[x+0] += 1 * err_R;
+			err2_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 1023);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 1023 * val_G / 255;
+			err_G -= res_G * 255 / 1023;
+
+			err0_G[x+2] += 1 * err_G;
+			err0_G[x+3] += 1 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+			err1_G[x+2] += 1 * err_G;
+			err2_G[x+0] += 1 * err_G;
+			err2_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 1023);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 1023 * val_B / 255;
+			err_B -= res_B * 255 / 1023;
+
+			err0_B[x+2] += 1 * err_B;
+			err0_B[x+3] += 1 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+			err1_B[x+2] += 1 * err_B;
+			err2_B[x+0] += 1 * err_B;
+			err2_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 1023);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_RGB101010_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 8;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 1023 * val_R / 255;
+				err_R -= res_R * 255 / 1023;
+
+				err0_R[x+2] += 1 * err_R;
+				err0_R[x+3] += 1 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+				err1_R[x+2] += 1 * err_R;
+				err2_R[x+0] += 1 * err_R;
+				err2_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 1023);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 8;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 1023 * val_G / 255;
+				err_G -= res_G * 255 / 1023;
+
+				err0_G[x+2] += 1 * err_G;
+				err0_G[x+3] += 1 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+				err1_G[x+2] += 1 * err_G;
+				err2_G[x+0] += 1 * err_G;
+				err2_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 1023);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 8;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 1023 * val_B / 255;
+				err_B -= res_B * 255 / 1023;
+
+				err0_B[x+2] += 1 * err_B;
+				err0_B[x+3] += 1 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+				err1_B[x+2] += 1 * err_B;
+				err2_B[x+0] += 1 * err_B;
+				err2_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 1023);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+				gp_putpixel_raw_32BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to xRGB8888
+ */
+static int atkinson_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			err0_R[x+2] += 1 * err_R;
+			err0_R[x+3] += 1 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+			err1_R[x+2] += 1 * err_R;
+			err2_R[x+0] += 1 * err_R;
+			err2_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			err0_G[x+2] += 1 * err_G;
+			err0_G[x+3] += 1 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+			err1_G[x+2] += 1 * err_G;
+			err2_G[x+0] += 1 * err_G;
+			err2_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			err0_B[x+2] += 1 * err_B;
+			err0_B[x+3] += 1 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+			err1_B[x+2] += 1 * err_B;
+			err2_B[x+0] += 1 * err_B;
+			err2_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_xRGB8888_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 8;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 255 * val_R / 255;
+				err_R -= res_R * 255 / 255;
+
+				err0_R[x+2] += 1 * err_R;
+				err0_R[x+3] += 1 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+				err1_R[x+2] += 1 * err_R;
+				err2_R[x+0] += 1 * err_R;
+				err2_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 255);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 8;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 255 * val_G / 255;
+				err_G -= res_G * 255 / 255;
+
+				err0_G[x+2] += 1 * err_G;
+				err0_G[x+3] += 1 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+				err1_G[x+2] += 1 * err_G;
+				err2_G[x+0] += 1 * err_G;
+				err2_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 255);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 8;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 255 * val_B / 255;
+				err_B -= res_B * 255 / 255;
+
+				err0_B[x+2] += 1 * err_B;
+				err0_B[x+3] += 1 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+				err1_B[x+2] += 1 * err_B;
+				err2_B[x+0] += 1 * err_B;
+				err2_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 255);
+
+				gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+				gp_putpixel_raw_32BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to RGB888
+ */
+static int atkinson_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			err0_R[x+2] += 1 * err_R;
+			err0_R[x+3] += 1 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+			err1_R[x+2] += 1 * err_R;
+			err2_R[x+0] += 1 * err_R;
+			err2_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			err0_G[x+2] += 1 * err_G;
+			err0_G[x+3] += 1 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+			err1_G[x+2] += 1 * err_G;
+			err2_G[x+0] += 1 * err_G;
+			err2_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			err0_B[x+2] += 1 * err_B;
+			err0_B[x+3] += 1 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+			err1_B[x+2] += 1 * err_B;
+			err2_B[x+0] += 1 * err_B;
+			err2_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_RGB888_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 8;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 255 * val_R / 255;
+				err_R -= res_R * 255 / 255;
+
+				err0_R[x+2] += 1 * err_R;
+				err0_R[x+3] += 1 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+				err1_R[x+2] += 1 * err_R;
+				err2_R[x+0] += 1 * err_R;
+				err2_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 255);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 8;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 255 * val_G / 255;
+				err_G -= res_G * 255 / 255;
+
+				err0_G[x+2] += 1 * err_G;
+				err0_G[x+3] += 1 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+				err1_G[x+2] += 1 * err_G;
+				err2_G[x+0] += 1 * err_G;
+				err2_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 255);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 8;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 255 * val_B / 255;
+				err_B -= res_B * 255 / 255;
+
+				err0_B[x+2] += 1 * err_B;
+				err0_B[x+3] += 1 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+				err1_B[x+2] += 1 * err_B;
+				err2_B[x+0] += 1 * err_B;
+				err2_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 255);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+				gp_putpixel_raw_24BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to BGR888
+ */
+static int atkinson_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			err0_B[x+2] += 1 * err_B;
+			err0_B[x+3] += 1 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+			err1_B[x+2] += 1 * err_B;
+			err2_B[x+0] += 1 * err_B;
+			err2_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			err0_G[x+2] += 1 * err_G;
+			err0_G[x+3] += 1 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+			err1_G[x+2] += 1 * err_G;
+			err2_G[x+0] += 1 * err_G;
+			err2_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			err0_R[x+2] += 1 * err_R;
+			err0_R[x+3] += 1 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+			err1_R[x+2] += 1 * err_R;
+			err2_R[x+0] += 1 * err_R;
+			err2_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_BGR888_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_B = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_R = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 8;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 255 * val_B / 255;
+				err_B -= res_B * 255 / 255;
+
+				err0_B[x+2] += 1 * err_B;
+				err0_B[x+3] += 1 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+				err1_B[x+2] += 1 * err_B;
+				err2_B[x+0] += 1 * err_B;
+				err2_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 255);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 8;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 255 * val_G / 255;
+				err_G -= res_G * 255 / 255;
+
+				err0_G[x+2] += 1 * err_G;
+				err0_G[x+3] += 1 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+				err1_G[x+2] += 1 * err_G;
+				err2_G[x+0] += 1 * err_G;
+				err2_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 255);
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 8;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 255 * val_R / 255;
+				err_R -= res_R * 255 / 255;
+
+				err0_R[x+2] += 1 * err_R;
+				err0_R[x+3] += 1 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+				err1_R[x+2] += 1 * err_R;
+				err2_R[x+0] += 1 * err_R;
+				err2_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 255);
+
+				gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+				gp_putpixel_raw_24BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to RGB555
+ */
+static int atkinson_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			err0_R[x+2] += 1 * err_R;
+			err0_R[x+3] += 1 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+			err1_R[x+2] += 1 * err_R;
+			err2_R[x+0] += 1 * err_R;
+			err2_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 31 * val_G / 255;
+			err_G -= res_G * 255 / 31;
+
+			err0_G[x+2] += 1 * err_G;
+			err0_G[x+3] += 1 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+			err1_G[x+2] += 1 * err_G;
+			err2_G[x+0] += 1 * err_G;
+			err2_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 31);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			err0_B[x+2] += 1 * err_B;
+			err0_B[x+3] += 1 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+			err1_B[x+2] += 1 * err_B;
+			err2_B[x+0] += 1 * err_B;
+			err2_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_RGB555_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 8;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 31 * val_R / 255;
+				err_R -= res_R * 255 / 31;
+
+				err0_R[x+2] += 1 * err_R;
+				err0_R[x+3] += 1 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+				err1_R[x+2] += 1 * err_R;
+				err2_R[x+0] += 1 * err_R;
+				err2_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 31);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 8;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 31 * val_G / 255;
+				err_G -= res_G * 255 / 31;
+
+				err0_G[x+2] += 1 * err_G;
+				err0_G[x+3] += 1 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+				err1_G[x+2] += 1 * err_G;
+				err2_G[x+0] += 1 * err_G;
+				err2_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 31);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 8;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 31 * val_B / 255;
+				err_B -= res_B * 255 / 31;
+
+				err0_B[x+2] += 1 * err_B;
+				err0_B[x+3] += 1 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+				err1_B[x+2] += 1 * err_B;
+				err2_B[x+0] += 1 * err_B;
+				err2_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 31);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+				gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to RGB565_BE
+ */
+static int atkinson_to_RGB565_BE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_BE),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			err0_R[x+2] += 1 * err_R;
+			err0_R[x+3] += 1 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+			err1_R[x+2] += 1 * err_R;
+			err2_R[x+0] += 1 * err_R;
+			err2_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			err0_G[x+2] += 1 * err_G;
+			err0_G[x+3] += 1 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+			err1_G[x+2] += 1 * err_G;
+			err2_G[x+0] += 1 * err_G;
+			err2_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			err0_B[x+2] += 1 * err_B;
+			err0_B[x+3] += 1 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+			err1_B[x+2] += 1 * err_B;
+			err2_B[x+0] += 1 * err_B;
+			err2_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_RGB565_BE_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 8;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 31 * val_R / 255;
+				err_R -= res_R * 255 / 31;
+
+				err0_R[x+2] += 1 * err_R;
+				err0_R[x+3] += 1 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+				err1_R[x+2] += 1 * err_R;
+				err2_R[x+0] += 1 * err_R;
+				err2_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 31);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 8;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 63 * val_G / 255;
+				err_G -= res_G * 255 / 63;
+
+				err0_G[x+2] += 1 * err_G;
+				err0_G[x+3] += 1 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+				err1_G[x+2] += 1 * err_G;
+				err2_G[x+0] += 1 * err_G;
+				err2_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 63);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 8;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 31 * val_B / 255;
+				err_B -= res_B * 255 / 31;
+
+				err0_B[x+2] += 1 * err_B;
+				err0_B[x+3] += 1 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+				err1_B[x+2] += 1 * err_B;
+				err2_B[x+0] += 1 * err_B;
+				err2_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 31);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B);
+
+				gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to RGB565_LE
+ */
+static int atkinson_to_RGB565_LE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_LE),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			err0_R[x+2] += 1 * err_R;
+			err0_R[x+3] += 1 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+			err1_R[x+2] += 1 * err_R;
+			err2_R[x+0] += 1 * err_R;
+			err2_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			err0_G[x+2] += 1 * err_G;
+			err0_G[x+3] += 1 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+			err1_G[x+2] += 1 * err_G;
+			err2_G[x+0] += 1 * err_G;
+			err2_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			err0_B[x+2] += 1 * err_B;
+			err0_B[x+3] += 1 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+			err1_B[x+2] += 1 * err_B;
+			err2_B[x+0] += 1 * err_B;
+			err2_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_RGB565_LE_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 8;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 31 * val_R / 255;
+				err_R -= res_R * 255 / 31;
+
+				err0_R[x+2] += 1 * err_R;
+				err0_R[x+3] += 1 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+				err1_R[x+2] += 1 * err_R;
+				err2_R[x+0] += 1 * err_R;
+				err2_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 31);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 8;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 63 * val_G / 255;
+				err_G -= res_G * 255 / 63;
+
+				err0_G[x+2] += 1 * err_G;
+				err0_G[x+3] += 1 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+				err1_G[x+2] += 1 * err_G;
+				err2_G[x+0] += 1 * err_G;
+				err2_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 63);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 8;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 31 * val_B / 255;
+				err_B -= res_B * 255 / 31;
+
+				err0_B[x+2] += 1 * err_B;
+				err0_B[x+3] += 1 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+				err1_B[x+2] += 1 * err_B;
+				err2_B[x+0] += 1 * err_B;
+				err2_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 31);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B);
+
+				gp_putpixel_raw_16BPP_LE(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to RGB666
+ */
+static int atkinson_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 63 * val_R / 255;
+			err_R -= res_R * 255 / 63;
+
+			err0_R[x+2] += 1 * err_R;
+			err0_R[x+3] += 1 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+			err1_R[x+2] += 1 * err_R;
+			err2_R[x+0] += 1 * err_R;
+			err2_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 63);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			err0_G[x+2] += 1 * err_G;
+			err0_G[x+3] += 1 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+			err1_G[x+2] += 1 * err_G;
+			err2_G[x+0] += 1 * err_G;
+			err2_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 63 * val_B / 255;
+			err_B -= res_B * 255 / 63;
+
+			err0_B[x+2] += 1 * err_B;
+			err0_B[x+3] += 1 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+			err1_B[x+2] += 1 * err_B;
+			err2_B[x+0] += 1 * err_B;
+			err2_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 63);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_RGB666_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 8;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 63 * val_R / 255;
+				err_R -= res_R * 255 / 63;
+
+				err0_R[x+2] += 1 * err_R;
+				err0_R[x+3] += 1 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+				err1_R[x+2] += 1 * err_R;
+				err2_R[x+0] += 1 * err_R;
+				err2_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 63);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 8;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 63 * val_G / 255;
+				err_G -= res_G * 255 / 63;
+
+				err0_G[x+2] += 1 * err_G;
+				err0_G[x+3] += 1 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+				err1_G[x+2] += 1 * err_G;
+				err2_G[x+0] += 1 * err_G;
+				err2_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 63);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 8;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 63 * val_B / 255;
+				err_B -= res_B * 255 / 63;
+
+				err0_B[x+2] += 1 * err_B;
+				err0_B[x+3] += 1 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+				err1_B[x+2] += 1 * err_B;
+				err2_B[x+0] += 1 * err_B;
+				err2_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 63);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+				gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to RGB332
+ */
+static int atkinson_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 8;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 7 * val_R / 255;
+			err_R -= res_R * 255 / 7;
+
+			err0_R[x+2] += 1 * err_R;
+			err0_R[x+3] += 1 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+			err1_R[x+2] += 1 * err_R;
+			err2_R[x+0] += 1 * err_R;
+			err2_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 7);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 8;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 7 * val_G / 255;
+			err_G -= res_G * 255 / 7;
+
+			err0_G[x+2] += 1 * err_G;
+			err0_G[x+3] += 1 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+			err1_G[x+2] += 1 * err_G;
+			err2_G[x+0] += 1 * err_G;
+			err2_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 7);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 8;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 3 * val_B / 255;
+			err_B -= res_B * 255 / 3;
+
+			err0_B[x+2] += 1 * err_B;
+			err0_B[x+3] += 1 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+			err1_B[x+2] += 1 * err_B;
+			err2_B[x+0] += 1 * err_B;
+			err2_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 3);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_RGB332_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 8;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 7 * val_R / 255;
+				err_R -= res_R * 255 / 7;
+
+				err0_R[x+2] += 1 * err_R;
+				err0_R[x+3] += 1 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+				err1_R[x+2] += 1 * err_R;
+				err2_R[x+0] += 1 * err_R;
+				err2_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 7);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 8;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 7 * val_G / 255;
+				err_G -= res_G * 255 / 7;
+
+				err0_G[x+2] += 1 * err_G;
+				err0_G[x+3] += 1 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+				err1_G[x+2] += 1 * err_G;
+				err2_G[x+0] += 1 * err_G;
+				err2_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 7);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 8;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 3 * val_B / 255;
+				err_B -= res_B * 255 / 3;
+
+				err0_B[x+2] += 1 * err_B;
+				err0_B[x+3] += 1 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+				err1_B[x+2] += 1 * err_B;
+				err2_B[x+0] += 1 * err_B;
+				err2_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 3);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+				gp_putpixel_raw_8BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to G1_DB
+ */
+static int atkinson_to_G1_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			err0_V[x+2] += 1 * err_V;
+			err0_V[x+3] += 1 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+			err1_V[x+2] += 1 * err_V;
+			err2_V[x+0] += 1 * err_V;
+			err2_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_G1_DB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 8;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 1 * val_V / 255;
+				err_V -= res_V * 255 / 1;
+
+				err0_V[x+2] += 1 * err_V;
+				err0_V[x+3] += 1 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+				err1_V[x+2] += 1 * err_V;
+				err2_V[x+0] += 1 * err_V;
+				err2_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 1);
+
+				gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to G2_DB
+ */
+static int atkinson_to_G2_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			err0_V[x+2] += 1 * err_V;
+			err0_V[x+3] += 1 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+			err1_V[x+2] += 1 * err_V;
+			err2_V[x+0] += 1 * err_V;
+			err2_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_G2_DB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 8;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 3 * val_V / 255;
+				err_V -= res_V * 255 / 3;
+
+				err0_V[x+2] += 1 * err_V;
+				err0_V[x+3] += 1 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+				err1_V[x+2] += 1 * err_V;
+				err2_V[x+0] += 1 * err_V;
+				err2_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 3);
+
+				gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to G4_DB
+ */
+static int atkinson_to_G4_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			err0_V[x+2] += 1 * err_V;
+			err0_V[x+3] += 1 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+			err1_V[x+2] += 1 * err_V;
+			err2_V[x+0] += 1 * err_V;
+			err2_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_G4_DB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 8;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 15 * val_V / 255;
+				err_V -= res_V * 255 / 15;
+
+				err0_V[x+2] += 1 * err_V;
+				err0_V[x+3] += 1 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+				err1_V[x+2] += 1 * err_V;
+				err2_V[x+0] += 1 * err_V;
+				err2_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 15);
+
+				gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to G1_UB
+ */
+static int atkinson_to_G1_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			err0_V[x+2] += 1 * err_V;
+			err0_V[x+3] += 1 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+			err1_V[x+2] += 1 * err_V;
+			err2_V[x+0] += 1 * err_V;
+			err2_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_G1_UB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 8;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 1 * val_V / 255;
+				err_V -= res_V * 255 / 1;
+
+				err0_V[x+2] += 1 * err_V;
+				err0_V[x+3] += 1 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+				err1_V[x+2] += 1 * err_V;
+				err2_V[x+0] += 1 * err_V;
+				err2_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 1);
+
+				gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to G2_UB
+ */
+static int atkinson_to_G2_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			err0_V[x+2] += 1 * err_V;
+			err0_V[x+3] += 1 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+			err1_V[x+2] += 1 * err_V;
+			err2_V[x+0] += 1 * err_V;
+			err2_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_G2_UB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 8;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 3 * val_V / 255;
+				err_V -= res_V * 255 / 3;
+
+				err0_V[x+2] += 1 * err_V;
+				err0_V[x+3] += 1 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+				err1_V[x+2] += 1 * err_V;
+				err2_V[x+0] += 1 * err_V;
+				err2_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 3);
+
+				gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to G4_UB
+ */
+static int atkinson_to_G4_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			err0_V[x+2] += 1 * err_V;
+			err0_V[x+3] += 1 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+			err1_V[x+2] += 1 * err_V;
+			err2_V[x+0] += 1 * err_V;
+			err2_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_G4_UB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 8;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 15 * val_V / 255;
+				err_V -= res_V * 255 / 15;
+
+				err0_V[x+2] += 1 * err_V;
+				err0_V[x+3] += 1 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+				err1_V[x+2] += 1 * err_V;
+				err2_V[x+0] += 1 * err_V;
+				err2_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 15);
+
+				gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to G8
+ */
+static int atkinson_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			err0_V[x+2] += 1 * err_V;
+			err0_V[x+3] += 1 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+			err1_V[x+2] += 1 * err_V;
+			err2_V[x+0] += 1 * err_V;
+			err2_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_G8_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 8;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 255 * val_V / 255;
+				err_V -= res_V * 255 / 255;
+
+				err0_V[x+2] += 1 * err_V;
+				err0_V[x+3] += 1 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+				err1_V[x+2] += 1 * err_V;
+				err2_V[x+0] += 1 * err_V;
+				err2_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 255);
+
+				gp_putpixel_raw_8BPP(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to GA88
+ */
+static int atkinson_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+	uint32_t errors_A[3][src->w + 4];
+	memset(errors_A, 0, sizeof(errors_A));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+		uint32_t *err0_A = errors_A[(y + 0) % 3];
+		uint32_t *err1_A = errors_A[(y + 1) % 3];
+		uint32_t *err2_A = errors_A[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			err0_V[x+2] += 1 * err_V;
+			err0_V[x+3] += 1 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+			err1_V[x+2] += 1 * err_V;
+			err2_V[x+0] += 1 * err_V;
+			err2_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+			uint32_t val_A = gp_pixel_to_G8(pix, src->pixel_type);
+			val_A += err0_A[x + 1] / 8;
+
+			uint32_t err_A = val_A;
+
+			gp_pixel res_A = 255 * val_A / 255;
+			err_A -= res_A * 255 / 255;
+
+			err0_A[x+2] += 1 * err_A;
+			err0_A[x+3] += 1 * err_A;
+			err1_A[x] += 1 * err_A;
+			err1_A[x+1] += 1 * err_A;
+			err1_A[x+2] += 1 * err_A;
+			err2_A[x+0] += 1 * err_A;
+			err2_A[x+1] += 1 * err_A;
+
+			GP_CLAMP_DOWN(res_A, 255);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_A, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_GA88_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_A = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_A = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_A = wavefront_row(wf, 1, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 8;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 255 * val_V / 255;
+				err_V -= res_V * 255 / 255;
+
+				err0_V[x+2] += 1 * err_V;
+				err0_V[x+3] += 1 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+				err1_V[x+2] += 1 * err_V;
+				err2_V[x+0] += 1 * err_V;
+				err2_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 255);
+				uint32_t val_A = gp_pixel_to_G8(pix, src->pixel_type);
+				val_A += err0_A[x + 1] / 8;
+
+				uint32_t err_A = val_A;
+
+				gp_pixel res_A = 255 * val_A / 255;
+				err_A -= res_A * 255 / 255;
+
+				err0_A[x+2] += 1 * err_A;
+				err0_A[x+3] += 1 * err_A;
+				err1_A[x] += 1 * err_A;
+				err1_A[x+1] += 1 * err_A;
+				err1_A[x+2] += 1 * err_A;
+				err2_A[x+0] += 1 * err_A;
+				err2_A[x+1] += 1 * err_A;
+
+				GP_CLAMP_DOWN(res_A, 255);
+
+				gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_A, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Atkinson to G16
+ */
+static int atkinson_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Atkinson %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 8;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 65535 * val_V / 255;
+			err_V -= res_V * 255 / 65535;
+
+			err0_V[x+2] += 1 * err_V;
+			err0_V[x+3] += 1 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+			err1_V[x+2] += 1 * err_V;
+			err2_V[x+0] += 1 * err_V;
+			err2_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 65535);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *atkinson_to_G16_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 8;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 65535 * val_V / 255;
+				err_V -= res_V * 255 / 65535;
+
+				err0_V[x+2] += 1 * err_V;
+				err0_V[x+3] += 1 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+				err1_V[x+2] += 1 * err_V;
+				err2_V[x+0] += 1 * err_V;
+				err2_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 65535);
+
+				gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+static int atkinson(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+#ifdef HAVE_PTHREAD
+	unsigned int t = GP_MIN(gp_nr_threads(src->w, src->h, callback), src->h);
+
+	if (t > 1) {
+		GP_DEBUG(1, "Atkinson %s to %s %ux%u in %u threads",
+		         gp_pixel_type_name(src->pixel_type),
+		         gp_pixel_type_name(dst->pixel_type),
+		         src->w, src->h, t);
+
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, atkinson_to_RGB101010_wave,
+			                     atkinson_to_RGB101010_raw);
+		case GP_PIXEL_xRGB8888:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, atkinson_to_xRGB8888_wave,
+			                     atkinson_to_xRGB8888_raw);
+		case GP_PIXEL_RGB888:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, atkinson_to_RGB888_wave,
+			                     atkinson_to_RGB888_raw);
+		case GP_PIXEL_BGR888:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, atkinson_to_BGR888_wave,
+			                     atkinson_to_BGR888_raw);
+		case GP_PIXEL_RGB555:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, atkinson_to_RGB555_wave,
+			                     atkinson_to_RGB555_raw);
+		case GP_PIXEL_RGB565_BE:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, atkinson_to_RGB565_BE_wave,
+			                     atkinson_to_RGB565_BE_raw);
+		case GP_PIXEL_RGB565_LE:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, atkinson_to_RGB565_LE_wave,
+			                     atkinson_to_RGB565_LE_raw);
+		case GP_PIXEL_RGB666:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, atkinson_to_RGB666_wave,
+			                     atkinson_to_RGB666_raw);
+		case GP_PIXEL_RGB332:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, atkinson_to_RGB332_wave,
+			                     atkinson_to_RGB332_raw);
+		case GP_PIXEL_G1_DB:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, atkinson_to_G1_DB_wave,
+			                     atkinson_to_G1_DB_raw);
+		case GP_PIXEL_G2_DB:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, atkinson_to_G2_DB_wave,
+			                     atkinson_to_G2_DB_raw);
+		case GP_PIXEL_G4_DB:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, atkinson_to_G4_DB_wave,
+			                     atkinson_to_G4_DB_raw);
+		case GP_PIXEL_G1_UB:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, atkinson_to_G1_UB_wave,
+			                     atkinson_to_G1_UB_raw);
+		case GP_PIXEL_G2_UB:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, atkinson_to_G2_UB_wave,
+			                     atkinson_to_G2_UB_raw);
+		case GP_PIXEL_G4_UB:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, atkinson_to_G4_UB_wave,
+			                     atkinson_to_G4_UB_raw);
+		case GP_PIXEL_G8:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, atkinson_to_G8_wave,
+			                     atkinson_to_G8_raw);
+		case GP_PIXEL_GA88:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     2, atkinson_to_GA88_wave,
+			                     atkinson_to_GA88_raw);
+		case GP_PIXEL_G16:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, atkinson_to_G16_wave,
+			                     atkinson_to_G16_raw);
+		default:
+			errno = EINVAL;
+			return 1;
+		}
+	}
+#endif /* HAVE_PTHREAD */
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return atkinson_to_RGB101010_raw(src, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return atkinson_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return atkinson_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return atkinson_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return atkinson_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_BE:
+		return atkinson_to_RGB565_BE_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_LE:
+		return atkinson_to_RGB565_LE_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return atkinson_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return atkinson_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return atkinson_to_G1_DB_raw(src, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return atkinson_to_G2_DB_raw(src, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return atkinson_to_G4_DB_raw(src, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return atkinson_to_G1_UB_raw(src, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return atkinson_to_G2_UB_raw(src, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return atkinson_to_G4_UB_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return atkinson_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return atkinson_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return atkinson_to_G16_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_atkinson(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+	return atkinson(src, dst, callback);
+}
+
+/*
+ * Sierra to RGB101010
+ */
+static int sierra_to_RGB101010_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB101010),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 1023 * val_R / 255;
+			err_R -= res_R * 255 / 1023;
+
+			err0_R[x+3] += 5 * err_R;
+			err0_R[x+4] += 3 * err_R;
+			err1_R[x] += 2 * err_R;
+			err1_R[x+1] += 4 * err_R;
+			err1_R[x+2] += 5 * err_R;
+			err1_R[x+3] += 4 * err_R;
+			err1_R[x+4] += 2 * err_R;
+			err2_R[x+1] += 2 * err_R;
+			err2_R[x+2] += 3 * err_R;
+			err2_R[x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 1023);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 1023 * val_G / 255;
+			err_G -= res_G * 255 / 1023;
+
+			err0_G[x+3] += 5 * err_G;
+			err0_G[x+4] += 3 * err_G;
+			err1_G[x] += 2 * err_G;
+			err1_G[x+1] += 4 * err_G;
+			err1_G[x+2] += 5 * err_G;
+			err1_G[x+3] += 4 * err_G;
+			err1_G[x+4] += 2 * err_G;
+			err2_G[x+1] += 2 * err_G;
+			err2_G[x+2] += 3 * err_G;
+			err2_G[x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 1023);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 1023 * val_B / 255;
+			err_B -= res_B * 255 / 1023;
+
+			err0_B[x+3] += 5 * err_B;
+			err0_B[x+4] += 3 * err_B;
+			err1_B[x] += 2 * err_B;
+			err1_B[x+1] += 4 * err_B;
+			err1_B[x+2] += 5 * err_B;
+			err1_B[x+3] += 4 * err_B;
+			err1_B[x+4] += 2 * err_B;
+			err2_B[x+1] += 2 * err_B;
+			err2_B[x+2] += 3 * err_B;
+			err2_B[x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 1023);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_RGB101010_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 2] / 32;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 1023 * val_R / 255;
+				err_R -= res_R * 255 / 1023;
+
+				err0_R[x+3] += 5 * err_R;
+				err0_R[x+4] += 3 * err_R;
+				err1_R[x] += 2 * err_R;
+				err1_R[x+1] += 4 * err_R;
+				err1_R[x+2] += 5 * err_R;
+				err1_R[x+3] += 4 * err_R;
+				err1_R[x+4] += 2 * err_R;
+				err2_R[x+1] += 2 * err_R;
+				err2_R[x+2] += 3 * err_R;
+				err2_R[x+3] += 2 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 1023);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 2] / 32;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 1023 * val_G / 255;
+				err_G -= res_G * 255 / 1023;
+
+				err0_G[x+3] += 5 * err_G;
+				err0_G[x+4] += 3 * err_G;
+				err1_G[x] += 2 * err_G;
+				err1_G[x+1] += 4 * err_G;
+				err1_G[x+2] += 5 * err_G;
+				err1_G[x+3] += 4 * err_G;
+				err1_G[x+4] += 2 * err_G;
+				err2_G[x+1] += 2 * err_G;
+				err2_G[x+2] += 3 * err_G;
+				err2_G[x+3] += 2 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 1023);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 2] / 32;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 1023 * val_B / 255;
+				err_B -= res_B * 255 / 1023;
+
+				err0_B[x+3] += 5 * err_B;
+				err0_B[x+4] += 3 * err_B;
+				err1_B[x] += 2 * err_B;
+				err1_B[x+1] += 4 * err_B;
+				err1_B[x+2] += 5 * err_B;
+				err1_B[x+3] += 4 * err_B;
+				err1_B[x+4] += 2 * err_B;
+				err2_B[x+1] += 2 * err_B;
+				err2_B[x+2] += 3 * err_B;
+				err2_B[x+3] += 2 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 1023);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+				gp_putpixel_raw_32BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to xRGB8888
+ */
+static int sierra_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			err0_R[x+3] += 5 * err_R;
+			err0_R[x+4] += 3 * err_R;
+			err1_R[x] += 2 * err_R;
+			err1_R[x+1] += 4 * err_R;
+			err1_R[x+2] += 5 * err_R;
+			err1_R[x+3] += 4 * err_R;
+			err1_R[x+4] += 2 * err_R;
+			err2_R[x+1] += 2 * err_R;
+			err2_R[x+2] += 3 * err_R;
+			err2_R[x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			err0_G[x+3] += 5 * err_G;
+			err0_G[x+4] += 3 * err_G;
+			err1_G[x] += 2 * err_G;
+			err1_G[x+1] += 4 * err_G;
+			err1_G[x+2] += 5 * err_G;
+			err1_G[x+3] += 4 * err_G;
+			err1_G[x+4] += 2 * err_G;
+			err2_G[x+1] += 2 * err_G;
+			err2_G[x+2] += 3 * err_G;
+			err2_G[x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			err0_B[x+3] += 5 * err_B;
+			err0_B[x+4] += 3 * err_B;
+			err1_B[x] += 2 * err_B;
+			err1_B[x+1] += 4 * err_B;
+			err1_B[x+2] += 5 * err_B;
+			err1_B[x+3] += 4 * err_B;
+			err1_B[x+4] += 2 * err_B;
+			err2_B[x+1] += 2 * err_B;
+			err2_B[x+2] += 3 * err_B;
+			err2_B[x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_xRGB8888_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 2] / 32;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 255 * val_R / 255;
+				err_R -= res_R * 255 / 255;
+
+				err0_R[x+3] += 5 * err_R;
+				err0_R[x+4] += 3 * err_R;
+				err1_R[x] += 2 * err_R;
+				err1_R[x+1] += 4 * err_R;
+				err1_R[x+2] += 5 * err_R;
+				err1_R[x+3] += 4 * err_R;
+				err1_R[x+4] += 2 * err_R;
+				err2_R[x+1] += 2 * err_R;
+				err2_R[x+2] += 3 * err_R;
+				err2_R[x+3] += 2 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 255);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 2] / 32;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 255 * val_G / 255;
+				err_G -= res_G * 255 / 255;
+
+				err0_G[x+3] += 5 * err_G;
+				err0_G[x+4] += 3 * err_G;
+				err1_G[x] += 2 * err_G;
+				err1_G[x+1] += 4 * err_G;
+				err1_G[x+2] += 5 * err_G;
+				err1_G[x+3] += 4 * err_G;
+				err1_G[x+4] += 2 * err_G;
+				err2_G[x+1] += 2 * err_G;
+				err2_G[x+2] += 3 * err_G;
+				err2_G[x+3] += 2 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 255);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 2] / 32;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 255 * val_B / 255;
+				err_B -= res_B * 255 / 255;
+
+				err0_B[x+3] += 5 * err_B;
+				err0_B[x+4] += 3 * err_B;
+				err1_B[x] += 2 * err_B;
+				err1_B[x+1] += 4 * err_B;
+				err1_B[x+2] += 5 * err_B;
+				err1_B[x+3] += 4 * err_B;
+				err1_B[x+4] += 2 * err_B;
+				err2_B[x+1] += 2 * err_B;
+				err2_B[x+2] += 3 * err_B;
+				err2_B[x+3] += 2 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 255);
+
+				gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+				gp_putpixel_raw_32BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to RGB888
+ */
+static int sierra_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			err0_R[x+3] += 5 * err_R;
+			err0_R[x+4] += 3 * err_R;
+			err1_R[x] += 2 * err_R;
+			err1_R[x+1] += 4 * err_R;
+			err1_R[x+2] += 5 * err_R;
+			err1_R[x+3] += 4 * err_R;
+			err1_R[x+4] += 2 * err_R;
+			err2_R[x+1] += 2 * err_R;
+			err2_R[x+2] += 3 * err_R;
+			err2_R[x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			err0_G[x+3] += 5 * err_G;
+			err0_G[x+4] += 3 * err_G;
+			err1_G[x] += 2 * err_G;
+			err1_G[x+1] += 4 * err_G;
+			err1_G[x+2] += 5 * err_G;
+			err1_G[x+3] += 4 * err_G;
+			err1_G[x+4] += 2 * err_G;
+			err2_G[x+1] += 2 * err_G;
+			err2_G[x+2] += 3 * err_G;
+			err2_G[x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			err0_B[x+3] += 5 * err_B;
+			err0_B[x+4] += 3 * err_B;
+			err1_B[x] += 2 * err_B;
+			err1_B[x+1] += 4 * err_B;
+			err1_B[x+2] += 5 * err_B;
+			err1_B[x+3] += 4 * err_B;
+			err1_B[x+4] += 2 * err_B;
+			err2_B[x+1] += 2 * err_B;
+			err2_B[x+2] += 3 * err_B;
+			err2_B[x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_RGB888_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 2] / 32;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 255 * val_R / 255;
+				err_R -= res_R * 255 / 255;
+
+				err0_R[x+3] += 5 * err_R;
+				err0_R[x+4] += 3 * err_R;
+				err1_R[x] += 2 * err_R;
+				err1_R[x+1] += 4 * err_R;
+				err1_R[x+2] += 5 * err_R;
+				err1_R[x+3] += 4 * err_R;
+				err1_R[x+4] += 2 * err_R;
+				err2_R[x+1] += 2 * err_R;
+				err2_R[x+2] += 3 * err_R;
+				err2_R[x+3] += 2 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 255);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 2] / 32;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 255 * val_G / 255;
+				err_G -= res_G * 255 / 255;
+
+				err0_G[x+3] += 5 * err_G;
+				err0_G[x+4] += 3 * err_G;
+				err1_G[x] += 2 * err_G;
+				err1_G[x+1] += 4 * err_G;
+				err1_G[x+2] += 5 * err_G;
+				err1_G[x+3] += 4 * err_G;
+				err1_G[x+4] += 2 * err_G;
+				err2_G[x+1] += 2 * err_G;
+				err2_G[x+2] += 3 * err_G;
+				err2_G[x+3] += 2 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 255);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 2] / 32;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 255 * val_B / 255;
+				err_B -= res_B * 255 / 255;
+
+				err0_B[x+3] += 5 * err_B;
+				err0_B[x+4] += 3 * err_B;
+				err1_B[x] += 2 * err_B;
+				err1_B[x+1] += 4 * err_B;
+				err1_B[x+2] += 5 * err_B;
+				err1_B[x+3] += 4 * err_B;
+				err1_B[x+4] += 2 * err_B;
+				err2_B[x+1] += 2 * err_B;
+				err2_B[x+2] += 3 * err_B;
+				err2_B[x+3] += 2 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 255);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+				gp_putpixel_raw_24BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to BGR888
+ */
+static int sierra_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			err0_B[x+3] += 5 * err_B;
+			err0_B[x+4] += 3 * err_B;
+			err1_B[x] += 2 * err_B;
+			err1_B[x+1] += 4 * err_B;
+			err1_B[x+2] += 5 * err_B;
+			err1_B[x+3] += 4 * err_B;
+			err1_B[x+4] += 2 * err_B;
+			err2_B[x+1] += 2 * err_B;
+			err2_B[x+2] += 3 * err_B;
+			err2_B[x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			err0_G[x+3] += 5 * err_G;
+			err0_G[x+4] += 3 * err_G;
+			err1_G[x] += 2 * err_G;
+			err1_G[x+1] += 4 * err_G;
+			err1_G[x+2] += 5 * err_G;
+			err1_G[x+3] += 4 * err_G;
+			err1_G[x+4] += 2 * err_G;
+			err2_G[x+1] += 2 * err_G;
+			err2_G[x+2] += 3 * err_G;
+			err2_G[x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			err0_R[x+3] += 5 * err_R;
+			err0_R[x+4] += 3 * err_R;
+			err1_R[x] += 2 * err_R;
+			err1_R[x+1] += 4 * err_R;
+			err1_R[x+2] += 5 * err_R;
+			err1_R[x+3] += 4 * err_R;
+			err1_R[x+4] += 2 * err_R;
+			err2_R[x+1] += 2 * err_R;
+			err2_R[x+2] += 3 * err_R;
+			err2_R[x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_BGR888_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_B = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_R = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 2] / 32;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 255 * val_B / 255;
+				err_B -= res_B * 255 / 255;
+
+				err0_B[x+3] += 5 * err_B;
+				err0_B[x+4] += 3 * err_B;
+				err1_B[x] += 2 * err_B;
+				err1_B[x+1] += 4 * err_B;
+				err1_B[x+2] += 5 * err_B;
+				err1_B[x+3] += 4 * err_B;
+				err1_B[x+4] += 2 * err_B;
+				err2_B[x+1] += 2 * err_B;
+				err2_B[x+2] += 3 * err_B;
+				err2_B[x+3] += 2 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 255);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 2] / 32;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 255 * val_G / 255;
+				err_G -= res_G * 255 / 255;
+
+				err0_G[x+3] += 5 * err_G;
+				err0_G[x+4] += 3 * err_G;
+				err1_G[x] += 2 * err_G;
+				err1_G[x+1] += 4 * err_G;
+				err1_G[x+2] += 5 * err_G;
+				err1_G[x+3] += 4 * err_G;
+				err1_G[x+4] += 2 * err_G;
+				err2_G[x+1] += 2 * err_G;
+				err2_G[x+2] += 3 * err_G;
+				err2_G[x+3] += 2 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 255);
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 2] / 32;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 255 * val_R / 255;
+				err_R -= res_R * 255 / 255;
+
+				err0_R[x+3] += 5 * err_R;
+				err0_R[x+4] += 3 * err_R;
+				err1_R[x] += 2 * err_R;
+				err1_R[x+1] += 4 * err_R;
+				err1_R[x+2] += 5 * err_R;
+				err1_R[x+3] += 4 * err_R;
+				err1_R[x+4] += 2 * err_R;
+				err2_R[x+1] += 2 * err_R;
+				err2_R[x+2] += 3 * err_R;
+				err2_R[x+3] += 2 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 255);
+
+				gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+				gp_putpixel_raw_24BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to RGB555
+ */
+static int sierra_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			err0_R[x+3] += 5 * err_R;
+			err0_R[x+4] += 3 * err_R;
+			err1_R[x] += 2 * err_R;
+			err1_R[x+1] += 4 * err_R;
+			err1_R[x+2] += 5 * err_R;
+			err1_R[x+3] += 4 * err_R;
+			err1_R[x+4] += 2 * err_R;
+			err2_R[x+1] += 2 * err_R;
+			err2_R[x+2] += 3 * err_R;
+			err2_R[x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 31 * val_G / 255;
+			err_G -= res_G * 255 / 31;
+
+			err0_G[x+3] += 5 * err_G;
+			err0_G[x+4] += 3 * err_G;
+			err1_G[x] += 2 * err_G;
+			err1_G[x+1] += 4 * err_G;
+			err1_G[x+2] += 5 * err_G;
+			err1_G[x+3] += 4 * err_G;
+			err1_G[x+4] += 2 * err_G;
+			err2_G[x+1] += 2 * err_G;
+			err2_G[x+2] += 3 * err_G;
+			err2_G[x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 31);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			err0_B[x+3] += 5 * err_B;
+			err0_B[x+4] += 3 * err_B;
+			err1_B[x] += 2 * err_B;
+			err1_B[x+1] += 4 * err_B;
+			err1_B[x+2] += 5 * err_B;
+			err1_B[x+3] += 4 * err_B;
+			err1_B[x+4] += 2 * err_B;
+			err2_B[x+1] += 2 * err_B;
+			err2_B[x+2] += 3 * err_B;
+			err2_B[x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_RGB555_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 2] / 32;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 31 * val_R / 255;
+				err_R -= res_R * 255 / 31;
+
+				err0_R[x+3] += 5 * err_R;
+				err0_R[x+4] += 3 * err_R;
+				err1_R[x] += 2 * err_R;
+				err1_R[x+1] += 4 * err_R;
+				err1_R[x+2] += 5 * err_R;
+				err1_R[x+3] += 4 * err_R;
+				err1_R[x+4] += 2 * err_R;
+				err2_R[x+1] += 2 * err_R;
+				err2_R[x+2] += 3 * err_R;
+				err2_R[x+3] += 2 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 31);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 2] / 32;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 31 * val_G / 255;
+				err_G -= res_G * 255 / 31;
+
+				err0_G[x+3] += 5 * err_G;
+				err0_G[x+4] += 3 * err_G;
+				err1_G[x] += 2 * err_G;
+				err1_G[x+1] += 4 * err_G;
+				err1_G[x+2] += 5 * err_G;
+				err1_G[x+3] += 4 * err_G;
+				err1_G[x+4] += 2 * err_G;
+				err2_G[x+1] += 2 * err_G;
+				err2_G[x+2] += 3 * err_G;
+				err2_G[x+3] += 2 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 31);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 2] / 32;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 31 * val_B / 255;
+				err_B -= res_B * 255 / 31;
+
+				err0_B[x+3] += 5 * err_B;
+				err0_B[x+4] += 3 * err_B;
+				err1_B[x] += 2 * err_B;
+				err1_B[x+1] += 4 * err_B;
+				err1_B[x+2] += 5 * err_B;
+				err1_B[x+3] += 4 * err_B;
+				err1_B[x+4] += 2 * err_B;
+				err2_B[x+1] += 2 * err_B;
+				err2_B[x+2] += 3 * err_B;
+				err2_B[x+3] += 2 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 31);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+				gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to RGB565_BE
+ */
+static int sierra_to_RGB565_BE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_BE),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			err0_R[x+3] += 5 * err_R;
+			err0_R[x+4] += 3 * err_R;
+			err1_R[x] += 2 * err_R;
+			err1_R[x+1] += 4 * err_R;
+			err1_R[x+2] += 5 * err_R;
+			err1_R[x+3] += 4 * err_R;
+			err1_R[x+4] += 2 * err_R;
+			err2_R[x+1] += 2 * err_R;
+			err2_R[x+2] += 3 * err_R;
+			err2_R[x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			err0_G[x+3] += 5 * err_G;
+			err0_G[x+4] += 3 * err_G;
+			err1_G[x] += 2 * err_G;
+			err1_G[x+1] += 4 * err_G;
+			err1_G[x+2] += 5 * err_G;
+			err1_G[x+3] += 4 * err_G;
+			err1_G[x+4] += 2 * err_G;
+			err2_G[x+1] += 2 * err_G;
+			err2_G[x+2] += 3 * err_G;
+			err2_G[x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			err0_B[x+3] += 5 * err_B;
+			err0_B[x+4] += 3 * err_B;
+			err1_B[x] += 2 * err_B;
+			err1_B[x+1] += 4 * err_B;
+			err1_B[x+2] += 5 * err_B;
+			err1_B[x+3] += 4 * err_B;
+			err1_B[x+4] += 2 * err_B;
+			err2_B[x+1] += 2 * err_B;
+			err2_B[x+2] += 3 * err_B;
+			err2_B[x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_RGB565_BE_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 2] / 32;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 31 * val_R / 255;
+				err_R -= res_R * 255 / 31;
+
+				err0_R[x+3] += 5 * err_R;
+				err0_R[x+4] += 3 * err_R;
+				err1_R[x] += 2 * err_R;
+				err1_R[x+1] += 4 * err_R;
+				err1_R[x+2] += 5 * err_R;
+				err1_R[x+3] += 4 * err_R;
+				err1_R[x+4] += 2 * err_R;
+				err2_R[x+1] += 2 * err_R;
+				err2_R[x+2] += 3 * err_R;
+				err2_R[x+3] += 2 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 31);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 2] / 32;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 63 * val_G / 255;
+				err_G -= res_G * 255 / 63;
+
+				err0_G[x+3] += 5 * err_G;
+				err0_G[x+4] += 3 * err_G;
+				err1_G[x] += 2 * err_G;
+				err1_G[x+1] += 4 * err_G;
+				err1_G[x+2] += 5 * err_G;
+				err1_G[x+3] += 4 * err_G;
+				err1_G[x+4] += 2 * err_G;
+				err2_G[x+1] += 2 * err_G;
+				err2_G[x+2] += 3 * err_G;
+				err2_G[x+3] += 2 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 63);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 2] / 32;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 31 * val_B / 255;
+				err_B -= res_B * 255 / 31;
+
+				err0_B[x+3] += 5 * err_B;
+				err0_B[x+4] += 3 * err_B;
+				err1_B[x] += 2 * err_B;
+				err1_B[x+1] += 4 * err_B;
+				err1_B[x+2] += 5 * err_B;
+				err1_B[x+3] += 4 * err_B;
+				err1_B[x+4] += 2 * err_B;
+				err2_B[x+1] += 2 * err_B;
+				err2_B[x+2] += 3 * err_B;
+				err2_B[x+3] += 2 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 31);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B);
+
+				gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to RGB565_LE
+ */
+static int sierra_to_RGB565_LE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_LE),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			err0_R[x+3] += 5 * err_R;
+			err0_R[x+4] += 3 * err_R;
+			err1_R[x] += 2 * err_R;
+			err1_R[x+1] += 4 * err_R;
+			err1_R[x+2] += 5 * err_R;
+			err1_R[x+3] += 4 * err_R;
+			err1_R[x+4] += 2 * err_R;
+			err2_R[x+1] += 2 * err_R;
+			err2_R[x+2] += 3 * err_R;
+			err2_R[x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			err0_G[x+3] += 5 * err_G;
+			err0_G[x+4] += 3 * err_G;
+			err1_G[x] += 2 * err_G;
+			err1_G[x+1] += 4 * err_G;
+			err1_G[x+2] += 5 * err_G;
+			err1_G[x+3] += 4 * err_G;
+			err1_G[x+4] += 2 * err_G;
+			err2_G[x+1] += 2 * err_G;
+			err2_G[x+2] += 3 * err_G;
+			err2_G[x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			err0_B[x+3] += 5 * err_B;
+			err0_B[x+4] += 3 * err_B;
+			err1_B[x] += 2 * err_B;
+			err1_B[x+1] += 4 * err_B;
+			err1_B[x+2] += 5 * err_B;
+			err1_B[x+3] += 4 * err_B;
+			err1_B[x+4] += 2 * err_B;
+			err2_B[x+1] += 2 * err_B;
+			err2_B[x+2] += 3 * err_B;
+			err2_B[x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_RGB565_LE_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 2] / 32;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 31 * val_R / 255;
+				err_R -= res_R * 255 / 31;
+
+				err0_R[x+3] += 5 * err_R;
+				err0_R[x+4] += 3 * err_R;
+				err1_R[x] += 2 * err_R;
+				err1_R[x+1] += 4 * err_R;
+				err1_R[x+2] += 5 * err_R;
+				err1_R[x+3] += 4 * err_R;
+				err1_R[x+4] += 2 * err_R;
+				err2_R[x+1] += 2 * err_R;
+				err2_R[x+2] += 3 * err_R;
+				err2_R[x+3] += 2 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 31);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 2] / 32;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 63 * val_G / 255;
+				err_G -= res_G * 255 / 63;
+
+				err0_G[x+3] += 5 * err_G;
+				err0_G[x+4] += 3 * err_G;
+				err1_G[x] += 2 * err_G;
+				err1_G[x+1] += 4 * err_G;
+				err1_G[x+2] += 5 * err_G;
+				err1_G[x+3] += 4 * err_G;
+				err1_G[x+4] += 2 * err_G;
+				err2_G[x+1] += 2 * err_G;
+				err2_G[x+2] += 3 * err_G;
+				err2_G[x+3] += 2 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 63);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 2] / 32;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 31 * val_B / 255;
+				err_B -= res_B * 255 / 31;
+
+				err0_B[x+3] += 5 * err_B;
+				err0_B[x+4] += 3 * err_B;
+				err1_B[x] += 2 * err_B;
+				err1_B[x+1] += 4 * err_B;
+				err1_B[x+2] += 5 * err_B;
+				err1_B[x+3] += 4 * err_B;
+				err1_B[x+4] += 2 * err_B;
+				err2_B[x+1] += 2 * err_B;
+				err2_B[x+2] += 3 * err_B;
+				err2_B[x+3] += 2 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 31);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B);
+
+				gp_putpixel_raw_16BPP_LE(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to RGB666
+ */
+static int sierra_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 63 * val_R / 255;
+			err_R -= res_R * 255 / 63;
+
+			err0_R[x+3] += 5 * err_R;
+			err0_R[x+4] += 3 * err_R;
+			err1_R[x] += 2 * err_R;
+			err1_R[x+1] += 4 * err_R;
+			err1_R[x+2] += 5 * err_R;
+			err1_R[x+3] += 4 * err_R;
+			err1_R[x+4] += 2 * err_R;
+			err2_R[x+1] += 2 * err_R;
+			err2_R[x+2] += 3 * err_R;
+			err2_R[x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 63);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			err0_G[x+3] += 5 * err_G;
+			err0_G[x+4] += 3 * err_G;
+			err1_G[x] += 2 * err_G;
+			err1_G[x+1] += 4 * err_G;
+			err1_G[x+2] += 5 * err_G;
+			err1_G[x+3] += 4 * err_G;
+			err1_G[x+4] += 2 * err_G;
+			err2_G[x+1] += 2 * err_G;
+			err2_G[x+2] += 3 * err_G;
+			err2_G[x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 63 * val_B / 255;
+			err_B -= res_B * 255 / 63;
+
+			err0_B[x+3] += 5 * err_B;
+			err0_B[x+4] += 3 * err_B;
+			err1_B[x] += 2 * err_B;
+			err1_B[x+1] += 4 * err_B;
+			err1_B[x+2] += 5 * err_B;
+			err1_B[x+3] += 4 * err_B;
+			err1_B[x+4] += 2 * err_B;
+			err2_B[x+1] += 2 * err_B;
+			err2_B[x+2] += 3 * err_B;
+			err2_B[x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 63);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_RGB666_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 2] / 32;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 63 * val_R / 255;
+				err_R -= res_R * 255 / 63;
+
+				err0_R[x+3] += 5 * err_R;
+				err0_R[x+4] += 3 * err_R;
+				err1_R[x] += 2 * err_R;
+				err1_R[x+1] += 4 * err_R;
+				err1_R[x+2] += 5 * err_R;
+				err1_R[x+3] += 4 * err_R;
+				err1_R[x+4] += 2 * err_R;
+				err2_R[x+1] += 2 * err_R;
+				err2_R[x+2] += 3 * err_R;
+				err2_R[x+3] += 2 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 63);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 2] / 32;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 63 * val_G / 255;
+				err_G -= res_G * 255 / 63;
+
+				err0_G[x+3] += 5 * err_G;
+				err0_G[x+4] += 3 * err_G;
+				err1_G[x] += 2 * err_G;
+				err1_G[x+1] += 4 * err_G;
+				err1_G[x+2] += 5 * err_G;
+				err1_G[x+3] += 4 * err_G;
+				err1_G[x+4] += 2 * err_G;
+				err2_G[x+1] += 2 * err_G;
+				err2_G[x+2] += 3 * err_G;
+				err2_G[x+3] += 2 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 63);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 2] / 32;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 63 * val_B / 255;
+				err_B -= res_B * 255 / 63;
+
+				err0_B[x+3] += 5 * err_B;
+				err0_B[x+4] += 3 * err_B;
+				err1_B[x] += 2 * err_B;
+				err1_B[x+1] += 4 * err_B;
+				err1_B[x+2] += 5 * err_B;
+				err1_B[x+3] += 4 * err_B;
+				err1_B[x+4] += 2 * err_B;
+				err2_B[x+1] += 2 * err_B;
+				err2_B[x+2] += 3 * err_B;
+				err2_B[x+3] += 2 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 63);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+				gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to RGB332
+ */
+static int sierra_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[3][src->w + 4];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[3][src->w + 4];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[3][src->w + 4];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 3];
+		uint32_t *err1_R = errors_R[(y + 1) % 3];
+		uint32_t *err2_R = errors_R[(y + 2) % 3];
+		uint32_t *err0_G = errors_G[(y + 0) % 3];
+		uint32_t *err1_G = errors_G[(y + 1) % 3];
+		uint32_t *err2_G = errors_G[(y + 2) % 3];
+		uint32_t *err0_B = errors_B[(y + 0) % 3];
+		uint32_t *err1_B = errors_B[(y + 1) % 3];
+		uint32_t *err2_B = errors_B[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 2] / 32;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 7 * val_R / 255;
+			err_R -= res_R * 255 / 7;
+
+			err0_R[x+3] += 5 * err_R;
+			err0_R[x+4] += 3 * err_R;
+			err1_R[x] += 2 * err_R;
+			err1_R[x+1] += 4 * err_R;
+			err1_R[x+2] += 5 * err_R;
+			err1_R[x+3] += 4 * err_R;
+			err1_R[x+4] += 2 * err_R;
+			err2_R[x+1] += 2 * err_R;
+			err2_R[x+2] += 3 * err_R;
+			err2_R[x+3] += 2 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 7);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 2] / 32;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 7 * val_G / 255;
+			err_G -= res_G * 255 / 7;
+
+			err0_G[x+3] += 5 * err_G;
+			err0_G[x+4] += 3 * err_G;
+			err1_G[x] += 2 * err_G;
+			err1_G[x+1] += 4 * err_G;
+			err1_G[x+2] += 5 * err_G;
+			err1_G[x+3] += 4 * err_G;
+			err1_G[x+4] += 2 * err_G;
+			err2_G[x+1] += 2 * err_G;
+			err2_G[x+2] += 3 * err_G;
+			err2_G[x+3] += 2 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 7);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 2] / 32;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 3 * val_B / 255;
+			err_B -= res_B * 255 / 3;
+
+			err0_B[x+3] += 5 * err_B;
+			err0_B[x+4] += 3 * err_B;
+			err1_B[x] += 2 * err_B;
+			err1_B[x+1] += 4 * err_B;
+			err1_B[x+2] += 5 * err_B;
+			err1_B[x+3] += 4 * err_B;
+			err1_B[x+4] += 2 * err_B;
+			err2_B[x+1] += 2 * err_B;
+			err2_B[x+2] += 3 * err_B;
+			err2_B[x+3] += 2 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 3);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_RGB332_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_R = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_G = wavefront_row(wf, 1, y + 2);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		uint32_t *err2_B = wavefront_row(wf, 2, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 2] / 32;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 7 * val_R / 255;
+				err_R -= res_R * 255 / 7;
+
+				err0_R[x+3] += 5 * err_R;
+				err0_R[x+4] += 3 * err_R;
+				err1_R[x] += 2 * err_R;
+				err1_R[x+1] += 4 * err_R;
+				err1_R[x+2] += 5 * err_R;
+				err1_R[x+3] += 4 * err_R;
+				err1_R[x+4] += 2 * err_R;
+				err2_R[x+1] += 2 * err_R;
+				err2_R[x+2] += 3 * err_R;
+				err2_R[x+3] += 2 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 7);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 2] / 32;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 7 * val_G / 255;
+				err_G -= res_G * 255 / 7;
+
+				err0_G[x+3] += 5 * err_G;
+				err0_G[x+4] += 3 * err_G;
+				err1_G[x] += 2 * err_G;
+				err1_G[x+1] += 4 * err_G;
+				err1_G[x+2] += 5 * err_G;
+				err1_G[x+3] += 4 * err_G;
+				err1_G[x+4] += 2 * err_G;
+				err2_G[x+1] += 2 * err_G;
+				err2_G[x+2] += 3 * err_G;
+				err2_G[x+3] += 2 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 7);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 2] / 32;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 3 * val_B / 255;
+				err_B -= res_B * 255 / 3;
+
+				err0_B[x+3] += 5 * err_B;
+				err0_B[x+4] += 3 * err_B;
+				err1_B[x] += 2 * err_B;
+				err1_B[x+1] += 4 * err_B;
+				err1_B[x+2] += 5 * err_B;
+				err1_B[x+3] += 4 * err_B;
+				err1_B[x+4] += 2 * err_B;
+				err2_B[x+1] += 2 * err_B;
+				err2_B[x+2] += 3 * err_B;
+				err2_B[x+3] += 2 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 3);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+				gp_putpixel_raw_8BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to G1_DB
+ */
+static int sierra_to_G1_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			err0_V[x+3] += 5 * err_V;
+			err0_V[x+4] += 3 * err_V;
+			err1_V[x] += 2 * err_V;
+			err1_V[x+1] += 4 * err_V;
+			err1_V[x+2] += 5 * err_V;
+			err1_V[x+3] += 4 * err_V;
+			err1_V[x+4] += 2 * err_V;
+			err2_V[x+1] += 2 * err_V;
+			err2_V[x+2] += 3 * err_V;
+			err2_V[x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_G1_DB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 2] / 32;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 1 * val_V / 255;
+				err_V -= res_V * 255 / 1;
+
+				err0_V[x+3] += 5 * err_V;
+				err0_V[x+4] += 3 * err_V;
+				err1_V[x] += 2 * err_V;
+				err1_V[x+1] += 4 * err_V;
+				err1_V[x+2] += 5 * err_V;
+				err1_V[x+3] += 4 * err_V;
+				err1_V[x+4] += 2 * err_V;
+				err2_V[x+1] += 2 * err_V;
+				err2_V[x+2] += 3 * err_V;
+				err2_V[x+3] += 2 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 1);
+
+				gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to G2_DB
+ */
+static int sierra_to_G2_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			err0_V[x+3] += 5 * err_V;
+			err0_V[x+4] += 3 * err_V;
+			err1_V[x] += 2 * err_V;
+			err1_V[x+1] += 4 * err_V;
+			err1_V[x+2] += 5 * err_V;
+			err1_V[x+3] += 4 * err_V;
+			err1_V[x+4] += 2 * err_V;
+			err2_V[x+1] += 2 * err_V;
+			err2_V[x+2] += 3 * err_V;
+			err2_V[x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_G2_DB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 2] / 32;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 3 * val_V / 255;
+				err_V -= res_V * 255 / 3;
+
+				err0_V[x+3] += 5 * err_V;
+				err0_V[x+4] += 3 * err_V;
+				err1_V[x] += 2 * err_V;
+				err1_V[x+1] += 4 * err_V;
+				err1_V[x+2] += 5 * err_V;
+				err1_V[x+3] += 4 * err_V;
+				err1_V[x+4] += 2 * err_V;
+				err2_V[x+1] += 2 * err_V;
+				err2_V[x+2] += 3 * err_V;
+				err2_V[x+3] += 2 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 3);
+
+				gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to G4_DB
+ */
+static int sierra_to_G4_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			err0_V[x+3] += 5 * err_V;
+			err0_V[x+4] += 3 * err_V;
+			err1_V[x] += 2 * err_V;
+			err1_V[x+1] += 4 * err_V;
+			err1_V[x+2] += 5 * err_V;
+			err1_V[x+3] += 4 * err_V;
+			err1_V[x+4] += 2 * err_V;
+			err2_V[x+1] += 2 * err_V;
+			err2_V[x+2] += 3 * err_V;
+			err2_V[x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_G4_DB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 2] / 32;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 15 * val_V / 255;
+				err_V -= res_V * 255 / 15;
+
+				err0_V[x+3] += 5 * err_V;
+				err0_V[x+4] += 3 * err_V;
+				err1_V[x] += 2 * err_V;
+				err1_V[x+1] += 4 * err_V;
+				err1_V[x+2] += 5 * err_V;
+				err1_V[x+3] += 4 * err_V;
+				err1_V[x+4] += 2 * err_V;
+				err2_V[x+1] += 2 * err_V;
+				err2_V[x+2] += 3 * err_V;
+				err2_V[x+3] += 2 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 15);
+
+				gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to G1_UB
+ */
+static int sierra_to_G1_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			err0_V[x+3] += 5 * err_V;
+			err0_V[x+4] += 3 * err_V;
+			err1_V[x] += 2 * err_V;
+			err1_V[x+1] += 4 * err_V;
+			err1_V[x+2] += 5 * err_V;
+			err1_V[x+3] += 4 * err_V;
+			err1_V[x+4] += 2 * err_V;
+			err2_V[x+1] += 2 * err_V;
+			err2_V[x+2] += 3 * err_V;
+			err2_V[x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_G1_UB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 2] / 32;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 1 * val_V / 255;
+				err_V -= res_V * 255 / 1;
+
+				err0_V[x+3] += 5 * err_V;
+				err0_V[x+4] += 3 * err_V;
+				err1_V[x] += 2 * err_V;
+				err1_V[x+1] += 4 * err_V;
+				err1_V[x+2] += 5 * err_V;
+				err1_V[x+3] += 4 * err_V;
+				err1_V[x+4] += 2 * err_V;
+				err2_V[x+1] += 2 * err_V;
+				err2_V[x+2] += 3 * err_V;
+				err2_V[x+3] += 2 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 1);
+
+				gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to G2_UB
+ */
+static int sierra_to_G2_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			err0_V[x+3] += 5 * err_V;
+			err0_V[x+4] += 3 * err_V;
+			err1_V[x] += 2 * err_V;
+			err1_V[x+1] += 4 * err_V;
+			err1_V[x+2] += 5 * err_V;
+			err1_V[x+3] += 4 * err_V;
+			err1_V[x+4] += 2 * err_V;
+			err2_V[x+1] += 2 * err_V;
+			err2_V[x+2] += 3 * err_V;
+			err2_V[x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_G2_UB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 2] / 32;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 3 * val_V / 255;
+				err_V -= res_V * 255 / 3;
+
+				err0_V[x+3] += 5 * err_V;
+				err0_V[x+4] += 3 * err_V;
+				err1_V[x] += 2 * err_V;
+				err1_V[x+1] += 4 * err_V;
+				err1_V[x+2] += 5 * err_V;
+				err1_V[x+3] += 4 * err_V;
+				err1_V[x+4] += 2 * err_V;
+				err2_V[x+1] += 2 * err_V;
+				err2_V[x+2] += 3 * err_V;
+				err2_V[x+3] += 2 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 3);
+
+				gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to G4_UB
+ */
+static int sierra_to_G4_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			err0_V[x+3] += 5 * err_V;
+			err0_V[x+4] += 3 * err_V;
+			err1_V[x] += 2 * err_V;
+			err1_V[x+1] += 4 * err_V;
+			err1_V[x+2] += 5 * err_V;
+			err1_V[x+3] += 4 * err_V;
+			err1_V[x+4] += 2 * err_V;
+			err2_V[x+1] += 2 * err_V;
+			err2_V[x+2] += 3 * err_V;
+			err2_V[x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_G4_UB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 2] / 32;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 15 * val_V / 255;
+				err_V -= res_V * 255 / 15;
+
+				err0_V[x+3] += 5 * err_V;
+				err0_V[x+4] += 3 * err_V;
+				err1_V[x] += 2 * err_V;
+				err1_V[x+1] += 4 * err_V;
+				err1_V[x+2] += 5 * err_V;
+				err1_V[x+3] += 4 * err_V;
+				err1_V[x+4] += 2 * err_V;
+				err2_V[x+1] += 2 * err_V;
+				err2_V[x+2] += 3 * err_V;
+				err2_V[x+3] += 2 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 15);
+
+				gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to G8
+ */
+static int sierra_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			err0_V[x+3] += 5 * err_V;
+			err0_V[x+4] += 3 * err_V;
+			err1_V[x] += 2 * err_V;
+			err1_V[x+1] += 4 * err_V;
+			err1_V[x+2] += 5 * err_V;
+			err1_V[x+3] += 4 * err_V;
+			err1_V[x+4] += 2 * err_V;
+			err2_V[x+1] += 2 * err_V;
+			err2_V[x+2] += 3 * err_V;
+			err2_V[x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_G8_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 2] / 32;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 255 * val_V / 255;
+				err_V -= res_V * 255 / 255;
+
+				err0_V[x+3] += 5 * err_V;
+				err0_V[x+4] += 3 * err_V;
+				err1_V[x] += 2 * err_V;
+				err1_V[x+1] += 4 * err_V;
+				err1_V[x+2] += 5 * err_V;
+				err1_V[x+3] += 4 * err_V;
+				err1_V[x+4] += 2 * err_V;
+				err2_V[x+1] += 2 * err_V;
+				err2_V[x+2] += 3 * err_V;
+				err2_V[x+3] += 2 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 255);
+
+				gp_putpixel_raw_8BPP(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to GA88
+ */
+static int sierra_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+	uint32_t errors_A[3][src->w + 4];
+	memset(errors_A, 0, sizeof(errors_A));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+		uint32_t *err0_A = errors_A[(y + 0) % 3];
+		uint32_t *err1_A = errors_A[(y + 1) % 3];
+		uint32_t *err2_A = errors_A[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			err0_V[x+3] += 5 * err_V;
+			err0_V[x+4] += 3 * err_V;
+			err1_V[x] += 2 * err_V;
+			err1_V[x+1] += 4 * err_V;
+			err1_V[x+2] += 5 * err_V;
+			err1_V[x+3] += 4 * err_V;
+			err1_V[x+4] += 2 * err_V;
+			err2_V[x+1] += 2 * err_V;
+			err2_V[x+2] += 3 * err_V;
+			err2_V[x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+			uint32_t val_A = gp_pixel_to_G8(pix, src->pixel_type);
+			val_A += err0_A[x + 2] / 32;
+
+			uint32_t err_A = val_A;
+
+			gp_pixel res_A = 255 * val_A / 255;
+			err_A -= res_A * 255 / 255;
+
+			err0_A[x+3] += 5 * err_A;
+			err0_A[x+4] += 3 * err_A;
+			err1_A[x] += 2 * err_A;
+			err1_A[x+1] += 4 * err_A;
+			err1_A[x+2] += 5 * err_A;
+			err1_A[x+3] += 4 * err_A;
+			err1_A[x+4] += 2 * err_A;
+			err2_A[x+1] += 2 * err_A;
+			err2_A[x+2] += 3 * err_A;
+			err2_A[x+3] += 2 * err_A;
+
+			GP_CLAMP_DOWN(res_A, 255);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_A, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_GA88_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		uint32_t *err0_A = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_A = wavefront_row(wf, 1, y + 1);
+		uint32_t *err2_A = wavefront_row(wf, 1, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 2] / 32;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 255 * val_V / 255;
+				err_V -= res_V * 255 / 255;
+
+				err0_V[x+3] += 5 * err_V;
+				err0_V[x+4] += 3 * err_V;
+				err1_V[x] += 2 * err_V;
+				err1_V[x+1] += 4 * err_V;
+				err1_V[x+2] += 5 * err_V;
+				err1_V[x+3] += 4 * err_V;
+				err1_V[x+4] += 2 * err_V;
+				err2_V[x+1] += 2 * err_V;
+				err2_V[x+2] += 3 * err_V;
+				err2_V[x+3] += 2 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 255);
+				uint32_t val_A = gp_pixel_to_G8(pix, src->pixel_type);
+				val_A += err0_A[x + 2] / 32;
+
+				uint32_t err_A = val_A;
+
+				gp_pixel res_A = 255 * val_A / 255;
+				err_A -= res_A * 255 / 255;
+
+				err0_A[x+3] += 5 * err_A;
+				err0_A[x+4] += 3 * err_A;
+				err1_A[x] += 2 * err_A;
+				err1_A[x+1] += 4 * err_A;
+				err1_A[x+2] += 5 * err_A;
+				err1_A[x+3] += 4 * err_A;
+				err1_A[x+4] += 2 * err_A;
+				err2_A[x+1] += 2 * err_A;
+				err2_A[x+2] += 3 * err_A;
+				err2_A[x+3] += 2 * err_A;
+
+				GP_CLAMP_DOWN(res_A, 255);
+
+				gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+		memset(err0_A, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra to G16
+ */
+static int sierra_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[3][src->w + 4];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 3];
+		uint32_t *err1_V = errors_V[(y + 1) % 3];
+		uint32_t *err2_V = errors_V[(y + 2) % 3];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 2] / 32;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 65535 * val_V / 255;
+			err_V -= res_V * 255 / 65535;
+
+			err0_V[x+3] += 5 * err_V;
+			err0_V[x+4] += 3 * err_V;
+			err1_V[x] += 2 * err_V;
+			err1_V[x+1] += 4 * err_V;
+			err1_V[x+2] += 5 * err_V;
+			err1_V[x+3] += 4 * err_V;
+			err1_V[x+4] += 2 * err_V;
+			err2_V[x+1] += 2 * err_V;
+			err2_V[x+2] += 3 * err_V;
+			err2_V[x+3] += 2 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 65535);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_to_G16_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err2_V = wavefront_row(wf, 0, y + 2);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 2] / 32;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 65535 * val_V / 255;
+				err_V -= res_V * 255 / 65535;
+
+				err0_V[x+3] += 5 * err_V;
+				err0_V[x+4] += 3 * err_V;
+				err1_V[x] += 2 * err_V;
+				err1_V[x+1] += 4 * err_V;
+				err1_V[x+2] += 5 * err_V;
+				err1_V[x+3] += 4 * err_V;
+				err1_V[x+4] += 2 * err_V;
+				err2_V[x+1] += 2 * err_V;
+				err2_V[x+2] += 3 * err_V;
+				err2_V[x+3] += 2 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 65535);
+
+				gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (4 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+static int sierra(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+#ifdef HAVE_PTHREAD
+	unsigned int t = GP_MIN(gp_nr_threads(src->w, src->h, callback), src->h);
+
+	if (t > 1) {
+		GP_DEBUG(1, "Sierra %s to %s %ux%u in %u threads",
+		         gp_pixel_type_name(src->pixel_type),
+		         gp_pixel_type_name(dst->pixel_type),
+		         src->w, src->h, t);
+
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, sierra_to_RGB101010_wave,
+			                     sierra_to_RGB101010_raw);
+		case GP_PIXEL_xRGB8888:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, sierra_to_xRGB8888_wave,
+			                     sierra_to_xRGB8888_raw);
+		case GP_PIXEL_RGB888:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, sierra_to_RGB888_wave,
+			                     sierra_to_RGB888_raw);
+		case GP_PIXEL_BGR888:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, sierra_to_BGR888_wave,
+			                     sierra_to_BGR888_raw);
+		case GP_PIXEL_RGB555:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, sierra_to_RGB555_wave,
+			                     sierra_to_RGB555_raw);
+		case GP_PIXEL_RGB565_BE:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, sierra_to_RGB565_BE_wave,
+			                     sierra_to_RGB565_BE_raw);
+		case GP_PIXEL_RGB565_LE:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, sierra_to_RGB565_LE_wave,
+			                     sierra_to_RGB565_LE_raw);
+		case GP_PIXEL_RGB666:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, sierra_to_RGB666_wave,
+			                     sierra_to_RGB666_raw);
+		case GP_PIXEL_RGB332:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     3, sierra_to_RGB332_wave,
+			                     sierra_to_RGB332_raw);
+		case GP_PIXEL_G1_DB:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, sierra_to_G1_DB_wave,
+			                     sierra_to_G1_DB_raw);
+		case GP_PIXEL_G2_DB:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, sierra_to_G2_DB_wave,
+			                     sierra_to_G2_DB_raw);
+		case GP_PIXEL_G4_DB:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, sierra_to_G4_DB_wave,
+			                     sierra_to_G4_DB_raw);
+		case GP_PIXEL_G1_UB:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, sierra_to_G1_UB_wave,
+			                     sierra_to_G1_UB_raw);
+		case GP_PIXEL_G2_UB:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, sierra_to_G2_UB_wave,
+			                     sierra_to_G2_UB_raw);
+		case GP_PIXEL_G4_UB:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, sierra_to_G4_UB_wave,
+			                     sierra_to_G4_UB_raw);
+		case GP_PIXEL_G8:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, sierra_to_G8_wave,
+			                     sierra_to_G8_raw);
+		case GP_PIXEL_GA88:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     2, sierra_to_GA88_wave,
+			                     sierra_to_GA88_raw);
+		case GP_PIXEL_G16:
+			return wavefront_run(src, dst, callback, t, 3, 4,
+			                     1, sierra_to_G16_wave,
+			                     sierra_to_G16_raw);
+		default:
+			errno = EINVAL;
+			return 1;
+		}
+	}
+#endif /* HAVE_PTHREAD */
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return sierra_to_RGB101010_raw(src, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return sierra_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return sierra_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return sierra_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return sierra_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_BE:
+		return sierra_to_RGB565_BE_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_LE:
+		return sierra_to_RGB565_LE_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return sierra_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return sierra_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return sierra_to_G1_DB_raw(src, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return sierra_to_G2_DB_raw(src, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return sierra_to_G4_DB_raw(src, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return sierra_to_G1_UB_raw(src, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return sierra_to_G2_UB_raw(src, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return sierra_to_G4_UB_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return sierra_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return sierra_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return sierra_to_G16_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_sierra(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+	return sierra(src, dst, callback);
+}
+
+/*
+ * Sierra Lite to RGB101010
+ */
+static int sierra_lite_to_RGB101010_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB101010),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 1023 * val_R / 255;
+			err_R -= res_R * 255 / 1023;
+
+			err0_R[x+2] += 2 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 1023);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 1023 * val_G / 255;
+			err_G -= res_G * 255 / 1023;
+
+			err0_G[x+2] += 2 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 1023);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 1023 * val_B / 255;
+			err_B -= res_B * 255 / 1023;
+
+			err0_B[x+2] += 2 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 1023);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_RGB101010_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 4;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 1023 * val_R / 255;
+				err_R -= res_R * 255 / 1023;
+
+				err0_R[x+2] += 2 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 1023);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 4;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 1023 * val_G / 255;
+				err_G -= res_G * 255 / 1023;
+
+				err0_G[x+2] += 2 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 1023);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 4;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 1023 * val_B / 255;
+				err_B -= res_B * 255 / 1023;
+
+				err0_B[x+2] += 2 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 1023);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+				gp_putpixel_raw_32BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to xRGB8888
+ */
+static int sierra_lite_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			err0_R[x+2] += 2 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			err0_G[x+2] += 2 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			err0_B[x+2] += 2 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_xRGB8888_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 4;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 255 * val_R / 255;
+				err_R -= res_R * 255 / 255;
+
+				err0_R[x+2] += 2 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 255);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 4;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 255 * val_G / 255;
+				err_G -= res_G * 255 / 255;
+
+				err0_G[x+2] += 2 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 255);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 4;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 255 * val_B / 255;
+				err_B -= res_B * 255 / 255;
+
+				err0_B[x+2] += 2 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 255);
+
+				gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+				gp_putpixel_raw_32BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to RGB888
+ */
+static int sierra_lite_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			err0_R[x+2] += 2 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			err0_G[x+2] += 2 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			err0_B[x+2] += 2 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_RGB888_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 4;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 255 * val_R / 255;
+				err_R -= res_R * 255 / 255;
+
+				err0_R[x+2] += 2 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 255);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 4;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 255 * val_G / 255;
+				err_G -= res_G * 255 / 255;
+
+				err0_G[x+2] += 2 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 255);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 4;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 255 * val_B / 255;
+				err_B -= res_B * 255 / 255;
+
+				err0_B[x+2] += 2 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 255);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+				gp_putpixel_raw_24BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to BGR888
+ */
+static int sierra_lite_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 255 * val_B / 255;
+			err_B -= res_B * 255 / 255;
+
+			err0_B[x+2] += 2 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 255);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 255 * val_G / 255;
+			err_G -= res_G * 255 / 255;
+
+			err0_G[x+2] += 2 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 255);
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 255 * val_R / 255;
+			err_R -= res_R * 255 / 255;
+
+			err0_R[x+2] += 2 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 255);
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_BGR888_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_B = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_R = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 4;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 255 * val_B / 255;
+				err_B -= res_B * 255 / 255;
+
+				err0_B[x+2] += 2 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 255);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 4;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 255 * val_G / 255;
+				err_G -= res_G * 255 / 255;
+
+				err0_G[x+2] += 2 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 255);
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 4;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 255 * val_R / 255;
+				err_R -= res_R * 255 / 255;
+
+				err0_R[x+2] += 2 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 255);
+
+				gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+				gp_putpixel_raw_24BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to RGB555
+ */
+static int sierra_lite_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			err0_R[x+2] += 2 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 31 * val_G / 255;
+			err_G -= res_G * 255 / 31;
+
+			err0_G[x+2] += 2 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 31);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			err0_B[x+2] += 2 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_RGB555_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 4;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 31 * val_R / 255;
+				err_R -= res_R * 255 / 31;
+
+				err0_R[x+2] += 2 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 31);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 4;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 31 * val_G / 255;
+				err_G -= res_G * 255 / 31;
+
+				err0_G[x+2] += 2 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 31);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 4;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 31 * val_B / 255;
+				err_B -= res_B * 255 / 31;
+
+				err0_B[x+2] += 2 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 31);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+				gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to RGB565_BE
+ */
+static int sierra_lite_to_RGB565_BE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_BE),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			err0_R[x+2] += 2 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			err0_G[x+2] += 2 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			err0_B[x+2] += 2 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_RGB565_BE_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 4;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 31 * val_R / 255;
+				err_R -= res_R * 255 / 31;
+
+				err0_R[x+2] += 2 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 31);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 4;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 63 * val_G / 255;
+				err_G -= res_G * 255 / 63;
+
+				err0_G[x+2] += 2 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 63);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 4;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 31 * val_B / 255;
+				err_B -= res_B * 255 / 31;
+
+				err0_B[x+2] += 2 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 31);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B);
+
+				gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to RGB565_LE
+ */
+static int sierra_lite_to_RGB565_LE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_LE),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 31 * val_R / 255;
+			err_R -= res_R * 255 / 31;
+
+			err0_R[x+2] += 2 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 31);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			err0_G[x+2] += 2 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 31 * val_B / 255;
+			err_B -= res_B * 255 / 31;
+
+			err0_B[x+2] += 2 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 31);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_RGB565_LE_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 4;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 31 * val_R / 255;
+				err_R -= res_R * 255 / 31;
+
+				err0_R[x+2] += 2 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 31);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 4;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 63 * val_G / 255;
+				err_G -= res_G * 255 / 63;
+
+				err0_G[x+2] += 2 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 63);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 4;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 31 * val_B / 255;
+				err_B -= res_B * 255 / 31;
+
+				err0_B[x+2] += 2 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 31);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B);
+
+				gp_putpixel_raw_16BPP_LE(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to RGB666
+ */
+static int sierra_lite_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 63 * val_R / 255;
+			err_R -= res_R * 255 / 63;
+
+			err0_R[x+2] += 2 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 63);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 63 * val_G / 255;
+			err_G -= res_G * 255 / 63;
+
+			err0_G[x+2] += 2 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 63);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 63 * val_B / 255;
+			err_B -= res_B * 255 / 63;
+
+			err0_B[x+2] += 2 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 63);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_RGB666_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 4;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 63 * val_R / 255;
+				err_R -= res_R * 255 / 63;
+
+				err0_R[x+2] += 2 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 63);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 4;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 63 * val_G / 255;
+				err_G -= res_G * 255 / 63;
+
+				err0_G[x+2] += 2 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 63);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 4;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 63 * val_B / 255;
+				err_B -= res_B * 255 / 63;
+
+				err0_B[x+2] += 2 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 63);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+				gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to RGB332
+ */
+static int sierra_lite_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_R[2][src->w + 2];
+	memset(errors_R, 0, sizeof(errors_R));
+	uint32_t errors_G[2][src->w + 2];
+	memset(errors_G, 0, sizeof(errors_G));
+	uint32_t errors_B[2][src->w + 2];
+	memset(errors_B, 0, sizeof(errors_B));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_R = errors_R[(y + 0) % 2];
+		uint32_t *err1_R = errors_R[(y + 1) % 2];
+		uint32_t *err0_G = errors_G[(y + 0) % 2];
+		uint32_t *err1_G = errors_G[(y + 1) % 2];
+		uint32_t *err0_B = errors_B[(y + 0) % 2];
+		uint32_t *err1_B = errors_B[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+			uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+			val_R += err0_R[x + 1] / 4;
+
+			uint32_t err_R = val_R;
+
+			gp_pixel res_R = 7 * val_R / 255;
+			err_R -= res_R * 255 / 7;
+
+			err0_R[x+2] += 2 * err_R;
+			err1_R[x] += 1 * err_R;
+			err1_R[x+1] += 1 * err_R;
+
+			GP_CLAMP_DOWN(res_R, 7);
+			uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+			val_G += err0_G[x + 1] / 4;
+
+			uint32_t err_G = val_G;
+
+			gp_pixel res_G = 7 * val_G / 255;
+			err_G -= res_G * 255 / 7;
+
+			err0_G[x+2] += 2 * err_G;
+			err1_G[x] += 1 * err_G;
+			err1_G[x+1] += 1 * err_G;
+
+			GP_CLAMP_DOWN(res_G, 7);
+			uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+			val_B += err0_B[x + 1] / 4;
+
+			uint32_t err_B = val_B;
+
+			gp_pixel res_B = 3 * val_B / 255;
+			err_B -= res_B * 255 / 3;
+
+			err0_B[x+2] += 2 * err_B;
+			err1_B[x] += 1 * err_B;
+			err1_B[x+1] += 1 * err_B;
+
+			GP_CLAMP_DOWN(res_B, 3);
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_RGB332_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_R = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_R = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_G = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_G = wavefront_row(wf, 1, y + 1);
+		uint32_t *err0_B = wavefront_row(wf, 2, y + 0);
+		uint32_t *err1_B = wavefront_row(wf, 2, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+				pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+
+				uint32_t val_R = GP_PIXEL_GET_R_RGB888(pix);
+				val_R += err0_R[x + 1] / 4;
+
+				uint32_t err_R = val_R;
+
+				gp_pixel res_R = 7 * val_R / 255;
+				err_R -= res_R * 255 / 7;
+
+				err0_R[x+2] += 2 * err_R;
+				err1_R[x] += 1 * err_R;
+				err1_R[x+1] += 1 * err_R;
+
+				GP_CLAMP_DOWN(res_R, 7);
+				uint32_t val_G = GP_PIXEL_GET_G_RGB888(pix);
+				val_G += err0_G[x + 1] / 4;
+
+				uint32_t err_G = val_G;
+
+				gp_pixel res_G = 7 * val_G / 255;
+				err_G -= res_G * 255 / 7;
+
+				err0_G[x+2] += 2 * err_G;
+				err1_G[x] += 1 * err_G;
+				err1_G[x+1] += 1 * err_G;
+
+				GP_CLAMP_DOWN(res_G, 7);
+				uint32_t val_B = GP_PIXEL_GET_B_RGB888(pix);
+				val_B += err0_B[x + 1] / 4;
+
+				uint32_t err_B = val_B;
+
+				gp_pixel res_B = 3 * val_B / 255;
+				err_B -= res_B * 255 / 3;
+
+				err0_B[x+2] += 2 * err_B;
+				err1_B[x] += 1 * err_B;
+				err1_B[x+1] += 1 * err_B;
+
+				GP_CLAMP_DOWN(res_B, 3);
+
+				gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+				gp_putpixel_raw_8BPP(dst, x, y, res);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_R, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_G, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_B, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to G1_DB
+ */
+static int sierra_lite_to_G1_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			err0_V[x+2] += 2 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_G1_DB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 4;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 1 * val_V / 255;
+				err_V -= res_V * 255 / 1;
+
+				err0_V[x+2] += 2 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 1);
+
+				gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to G2_DB
+ */
+static int sierra_lite_to_G2_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			err0_V[x+2] += 2 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_G2_DB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 4;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 3 * val_V / 255;
+				err_V -= res_V * 255 / 3;
+
+				err0_V[x+2] += 2 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 3);
+
+				gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to G4_DB
+ */
+static int sierra_lite_to_G4_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_DB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			err0_V[x+2] += 2 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_G4_DB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 4;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 15 * val_V / 255;
+				err_V -= res_V * 255 / 15;
+
+				err0_V[x+2] += 2 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 15);
+
+				gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to G1_UB
+ */
+static int sierra_lite_to_G1_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 1 * val_V / 255;
+			err_V -= res_V * 255 / 1;
+
+			err0_V[x+2] += 2 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 1);
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_G1_UB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 4;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 1 * val_V / 255;
+				err_V -= res_V * 255 / 1;
+
+				err0_V[x+2] += 2 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 1);
+
+				gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to G2_UB
+ */
+static int sierra_lite_to_G2_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 3 * val_V / 255;
+			err_V -= res_V * 255 / 3;
+
+			err0_V[x+2] += 2 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 3);
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_G2_UB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 4;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 3 * val_V / 255;
+				err_V -= res_V * 255 / 3;
+
+				err0_V[x+2] += 2 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 3);
+
+				gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to G4_UB
+ */
+static int sierra_lite_to_G4_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_UB),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 15 * val_V / 255;
+			err_V -= res_V * 255 / 15;
+
+			err0_V[x+2] += 2 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 15);
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_G4_UB_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 4;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 15 * val_V / 255;
+				err_V -= res_V * 255 / 15;
+
+				err0_V[x+2] += 2 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 15);
+
+				gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to G8
+ */
+static int sierra_lite_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			err0_V[x+2] += 2 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_G8_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 4;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 255 * val_V / 255;
+				err_V -= res_V * 255 / 255;
+
+				err0_V[x+2] += 2 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 255);
+
+				gp_putpixel_raw_8BPP(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to GA88
+ */
+static int sierra_lite_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+	uint32_t errors_A[2][src->w + 2];
+	memset(errors_A, 0, sizeof(errors_A));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+		uint32_t *err0_A = errors_A[(y + 0) % 2];
+		uint32_t *err1_A = errors_A[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 255 * val_V / 255;
+			err_V -= res_V * 255 / 255;
+
+			err0_V[x+2] += 2 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 255);
+			uint32_t val_A = gp_pixel_to_G8(pix, src->pixel_type);
+			val_A += err0_A[x + 1] / 4;
+
+			uint32_t err_A = val_A;
+
+			gp_pixel res_A = 255 * val_A / 255;
+			err_A -= res_A * 255 / 255;
+
+			err0_A[x+2] += 2 * err_A;
+			err1_A[x] += 1 * err_A;
+			err1_A[x+1] += 1 * err_A;
+
+			GP_CLAMP_DOWN(res_A, 255);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_A, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_GA88_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		uint32_t *err0_A = wavefront_row(wf, 1, y + 0);
+		uint32_t *err1_A = wavefront_row(wf, 1, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 4;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 255 * val_V / 255;
+				err_V -= res_V * 255 / 255;
+
+				err0_V[x+2] += 2 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 255);
+				uint32_t val_A = gp_pixel_to_G8(pix, src->pixel_type);
+				val_A += err0_A[x + 1] / 4;
+
+				uint32_t err_A = val_A;
+
+				gp_pixel res_A = 255 * val_A / 255;
+				err_A -= res_A * 255 / 255;
+
+				err0_A[x+2] += 2 * err_A;
+				err1_A[x] += 1 * err_A;
+				err1_A[x+1] += 1 * err_A;
+
+				GP_CLAMP_DOWN(res_A, 255);
+
+				gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+		memset(err0_A, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Sierra Lite to G16
+ */
+static int sierra_lite_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	uint32_t errors_V[2][src->w + 2];
+	memset(errors_V, 0, sizeof(errors_V));
+
+	GP_DEBUG(1, "Sierra Lite %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		uint32_t *err0_V = errors_V[(y + 0) % 2];
+		uint32_t *err1_V = errors_V[(y + 1) % 2];
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix;
+
+			pix = gp_getpixel_raw(src, x, y);
+
+			uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+			val_V += err0_V[x + 1] / 4;
+
+			uint32_t err_V = val_V;
+
+			gp_pixel res_V = 65535 * val_V / 255;
+			err_V -= res_V * 255 / 65535;
+
+			err0_V[x+2] += 2 * err_V;
+			err1_V[x] += 1 * err_V;
+			err1_V[x+1] += 1 * err_V;
+
+			GP_CLAMP_DOWN(res_V, 65535);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+static void *sierra_lite_to_G16_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
+
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		uint32_t *err0_V = wavefront_row(wf, 0, y + 0);
+		uint32_t *err1_V = wavefront_row(wf, 0, y + 1);
+		gp_coord x0;
+
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
+
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
+
+			for (x = x0; x < x1; x++) {
+				gp_pixel pix;
+
+				pix = gp_getpixel_raw(src, x, y);
+
+				uint32_t val_V = gp_pixel_to_G8(pix, src->pixel_type);
+				val_V += err0_V[x + 1] / 4;
+
+				uint32_t err_V = val_V;
+
+				gp_pixel res_V = 65535 * val_V / 255;
+				err_V -= res_V * 255 / 65535;
+
+				err0_V[x+2] += 2 * err_V;
+				err1_V[x] += 1 * err_V;
+				err1_V[x+1] += 1 * err_V;
+
+				GP_CLAMP_DOWN(res_V, 65535);
+
+				gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+			}
+
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
+		}
+
+		memset(err0_V, 0, (2 + src->w) * sizeof(uint32_t));
+
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+#endif /* HAVE_PTHREAD */
+
+static int sierra_lite(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+#ifdef HAVE_PTHREAD
+	unsigned int t = GP_MIN(gp_nr_threads(src->w, src->h, callback), src->h);
+
+	if (t > 1) {
+		GP_DEBUG(1, "Sierra Lite %s to %s %ux%u in %u threads",
+		         gp_pixel_type_name(src->pixel_type),
+		         gp_pixel_type_name(dst->pixel_type),
+		         src->w, src->h, t);
+
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGB101010:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, sierra_lite_to_RGB101010_wave,
+			                     sierra_lite_to_RGB101010_raw);
+		case GP_PIXEL_xRGB8888:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, sierra_lite_to_xRGB8888_wave,
+			                     sierra_lite_to_xRGB8888_raw);
+		case GP_PIXEL_RGB888:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, sierra_lite_to_RGB888_wave,
+			                     sierra_lite_to_RGB888_raw);
+		case GP_PIXEL_BGR888:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, sierra_lite_to_BGR888_wave,
+			                     sierra_lite_to_BGR888_raw);
+		case GP_PIXEL_RGB555:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, sierra_lite_to_RGB555_wave,
+			                     sierra_lite_to_RGB555_raw);
+		case GP_PIXEL_RGB565_BE:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, sierra_lite_to_RGB565_BE_wave,
+			                     sierra_lite_to_RGB565_BE_raw);
+		case GP_PIXEL_RGB565_LE:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, sierra_lite_to_RGB565_LE_wave,
+			                     sierra_lite_to_RGB565_LE_raw);
+		case GP_PIXEL_RGB666:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, sierra_lite_to_RGB666_wave,
+			                     sierra_lite_to_RGB666_raw);
+		case GP_PIXEL_RGB332:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     3, sierra_lite_to_RGB332_wave,
+			                     sierra_lite_to_RGB332_raw);
+		case GP_PIXEL_G1_DB:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, sierra_lite_to_G1_DB_wave,
+			                     sierra_lite_to_G1_DB_raw);
+		case GP_PIXEL_G2_DB:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, sierra_lite_to_G2_DB_wave,
+			                     sierra_lite_to_G2_DB_raw);
+		case GP_PIXEL_G4_DB:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, sierra_lite_to_G4_DB_wave,
+			                     sierra_lite_to_G4_DB_raw);
+		case GP_PIXEL_G1_UB:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, sierra_lite_to_G1_UB_wave,
+			                     sierra_lite_to_G1_UB_raw);
+		case GP_PIXEL_G2_UB:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, sierra_lite_to_G2_UB_wave,
+			                     sierra_lite_to_G2_UB_raw);
+		case GP_PIXEL_G4_UB:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, sierra_lite_to_G4_UB_wave,
+			                     sierra_lite_to_G4_UB_raw);
+		case GP_PIXEL_G8:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, sierra_lite_to_G8_wave,
+			                     sierra_lite_to_G8_raw);
+		case GP_PIXEL_GA88:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     2, sierra_lite_to_GA88_wave,
+			                     sierra_lite_to_GA88_raw);
+		case GP_PIXEL_G16:
+			return wavefront_run(src, dst, callback, t, 2, 2,
+			                     1, sierra_lite_to_G16_wave,
+			                     sierra_lite_to_G16_raw);
+		default:
+			errno = EINVAL;
+			return 1;
+		}
+	}
+#endif /* HAVE_PTHREAD */
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return sierra_lite_to_RGB101010_raw(src, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return sierra_lite_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return sierra_lite_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return sierra_lite_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return sierra_lite_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_BE:
+		return sierra_lite_to_RGB565_BE_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_LE:
+		return sierra_lite_to_RGB565_LE_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return sierra_lite_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return sierra_lite_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return sierra_lite_to_G1_DB_raw(src, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return sierra_lite_to_G2_DB_raw(src, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return sierra_lite_to_G4_DB_raw(src, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return sierra_lite_to_G1_UB_raw(src, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return sierra_lite_to_G2_UB_raw(src, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return sierra_lite_to_G4_UB_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return sierra_lite_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return sierra_lite_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return sierra_lite_to_G16_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_sierra_lite(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+	return sierra_lite(src, dst, callback);
+}
+
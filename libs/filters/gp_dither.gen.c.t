@@ -2,112 +2,283 @@
 /*
  * Floyd Steinberg dithering -> any pixel
  *
- * Copyright (C) 2009-2023 Cyril Hrubis <metan@ucw.cz>
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
  */
 #include <string.h>
+#include <stdlib.h>
 #include <errno.h>
+#include <sched.h>
+
+#include "../../config.h"
 
 #include <core/gp_debug.h>
 #include <core/gp_pixel.h>
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_convert.h>
 #include <core/gp_clamp.h>
+#include <core/gp_threads.h>
 #include <filters/gp_filter.h>
 #include <filters/gp_dither.gen.h>
 
-@ def distribute_error(name, c, x, y, err):
-@     if name == 'floyd_steinberg':
-errors_{{ c.name }}[{{ y }}%2][{{ x }}+2] += 7 * {{ err }};
-errors_{{ c.name }}[!({{ y }}%2)][{{ x }}] += 3 * {{ err }};
-errors_{{ c.name }}[!({{ y }}%2)][{{ x }}+1] += 5 * {{ err }};
-errors_{{ c.name }}[!({{ y }}%2)][{{ x }}+2] += 1 * {{ err }};
-@     elif name == 'atkinson':
-errors_{{ c.name }}[{{ y }}%3][{{ x }}+2] += 1 * {{ err }};
-errors_{{ c.name }}[{{ y }}%3][{{ x }}+3] += 1 * {{ err }};
-errors_{{ c.name }}[({{ y }}+1)%3][{{ x }}] += 1 * {{ err }};
-errors_{{ c.name }}[({{ y }}+1)%3][{{ x }}+1] += 1 * {{ err }};
-errors_{{ c.name }}[({{ y }}+1)%3][{{ x }}+2] += 1 * {{ err }};
-errors_{{ c.name }}[({{ y }}+2)%3][{{ x }}+0] += 1 * {{ err }};
-errors_{{ c.name }}[({{ y }}+2)%3][{{ x }}+1] += 1 * {{ err }};
-@     elif name == 'sierra':
-errors_{{ c.name }}[{{ y }}%3][{{ x }}+3] += 5 * {{ err }};
-errors_{{ c.name }}[{{ y }}%3][{{ x }}+4] += 3 * {{ err }};
-errors_{{ c.name }}[({{ y }}+1)%3][{{ x }}] += 2 * {{ err }};
-errors_{{ c.name }}[({{ y }}+1)%3][{{ x }}+1] += 4 * {{ err }};
-errors_{{ c.name }}[({{ y }}+1)%3][{{ x }}+2] += 5 * {{ err }};
-errors_{{ c.name }}[({{ y }}+1)%3][{{ x }}+3] += 4 * {{ err }};
-errors_{{ c.name }}[({{ y }}+1)%3][{{ x }}+4] += 2 * {{ err }};
-errors_{{ c.name }}[({{ y }}+2)%3][{{ x }}+1] += 2 * {{ err }};
-errors_{{ c.name }}[({{ y }}+2)%3][{{ x }}+2] += 3 * {{ err }};
-errors_{{ c.name }}[({{ y }}+2)%3][{{ x }}+3] += 2 * {{ err }};
-@     elif name == 'sierra_two_row':
-errors_{{ c.name }}[{{ y }}%2][{{ x }}+3] += 4 * {{ err }};
-errors_{{ c.name }}[{{ y }}%2][{{ x }}+4] += 3 * {{ err }};
-errors_{{ c.name }}[!({{ y }}%2)][{{ x }}] += 1 * {{ err }};
-errors_{{ c.name }}[!({{ y }}%2)][{{ x }}+1] += 2 * {{ err }};
-errors_{{ c.name }}[!({{ y }}%2)][{{ x }}+2] += 3 * {{ err }};
-errors_{{ c.name }}[!({{ y }}%2)][{{ x }}+3] += 2 * {{ err }};
-errors_{{ c.name }}[!({{ y }}%2)][{{ x }}+4] += 1 * {{ err }};
-@     elif name == 'sierra_lite':
-errors_{{ c.name }}[{{ y }}%2][{{ x }}+2] += 2 * {{ err }};
-errors_{{ c.name }}[!({{ y }}%2)][{{ x }}] += 1 * {{ err }};
-errors_{{ c.name }}[!({{ y }}%2)][{{ x }}+1] += 1 * {{ err }};
+@ # Error buffer rows, extra row elements, current pixel offset and divider.
+@ def kernel(name):
+@     return {
+@         'floyd_steinberg': (2, 2, 1, 16),
+@         'atkinson': (3, 4, 1, 8),
+@         'sierra': (3, 4, 2, 32),
+@         'sierra_two_row': (2, 4, 2, 16),
+@         'sierra_lite': (2, 2, 1, 4),
+@     }[name]
 @ end
 @
-@ def get_error(name, c, x, y):
+@ def distribute_error(name, c, x, err):
 @     if name == 'floyd_steinberg':
-errors_{{ c.name }}[{{ y }} % 2][{{ x }} + 1] / 16
+err0_{{ c.name }}[{{ x }}+2] += 7 * {{ err }};
+err1_{{ c.name }}[{{ x }}] += 3 * {{ err }};
+err1_{{ c.name }}[{{ x }}+1] += 5 * {{ err }};
+err1_{{ c.name }}[{{ x }}+2] += 1 * {{ err }};
 @     elif name == 'atkinson':
-errors_{{ c.name }}[{{ y }} % 3][{{ x }} + 1] / 8
+err0_{{ c.name }}[{{ x }}+2] += 1 * {{ err }};
+err0_{{ c.name }}[{{ x }}+3] += 1 * {{ err }};
+err1_{{ c.name }}[{{ x }}] += 1 * {{ err }};
+err1_{{ c.name }}[{{ x }}+1] += 1 * {{ err }};
+err1_{{ c.name }}[{{ x }}+2] += 1 * {{ err }};
+err2_{{ c.name }}[{{ x }}+0] += 1 * {{ err }};
+err2_{{ c.name }}[{{ x }}+1] += 1 * {{ err }};
 @     elif name == 'sierra':
-errors_{{ c.name }}[{{ y }} % 3][{{ x }} + 2] / 32
+err0_{{ c.name }}[{{ x }}+3] += 5 * {{ err }};
+err0_{{ c.name }}[{{ x }}+4] += 3 * {{ err }};
+err1_{{ c.name }}[{{ x }}] += 2 * {{ err }};
+err1_{{ c.name }}[{{ x }}+1] += 4 * {{ err }};
+err1_{{ c.name }}[{{ x }}+2] += 5 * {{ err }};
+err1_{{ c.name }}[{{ x }}+3] += 4 * {{ err }};
+err1_{{ c.name }}[{{ x }}+4] += 2 * {{ err }};
+err2_{{ c.name }}[{{ x }}+1] += 2 * {{ err }};
+err2_{{ c.name }}[{{ x }}+2] += 3 * {{ err }};
+err2_{{ c.name }}[{{ x }}+3] += 2 * {{ err }};
 @     elif name == 'sierra_two_row':
-errors_{{ c.name }}[{{ y }} % 2][{{ x }} + 2] / 16
+err0_{{ c.name }}[{{ x }}+3] += 4 * {{ err }};
+err0_{{ c.name }}[{{ x }}+4] += 3 * {{ err }};
+err1_{{ c.name }}[{{ x }}] += 1 * {{ err }};
+err1_{{ c.name }}[{{ x }}+1] += 2 * {{ err }};
+err1_{{ c.name }}[{{ x }}+2] += 3 * {{ err }};
+err1_{{ c.name }}[{{ x }}+3] += 2 * {{ err }};
+err1_{{ c.name }}[{{ x }}+4] += 1 * {{ err }};
 @     elif name == 'sierra_lite':
-errors_{{ c.name }}[{{ y }} % 2][{{ x }} + 1] / 4
+err0_{{ c.name }}[{{ x }}+2] += 2 * {{ err }};
+err1_{{ c.name }}[{{ x }}] += 1 * {{ err }};
+err1_{{ c.name }}[{{ x }}+1] += 1 * {{ err }};
 @ end
 @
-@ def clear_errors(name, pt, w, y):
-@     if name == 'floyd_steinberg' or name == 'sierra_lite':
-@         rows = 2
-@         add = 2
-@     elif name == 'atkinson':
-@         rows = 3
-@         add = 4
-@     elif name == 'sierra_two_row':
-@         rows = 2
-@         add = 4
-@     elif name == 'sierra':
-@         rows = 3
-@         add = 4
+@ def get_error(name, c, x):
+@     (rows, add, off, div) = kernel(name)
+err0_{{ c.name }}[{{ x }} + {{ off }}] / {{ div }}
+@ end
+@
+@ # Sets err0 to the current row errors, err1 and err2 to the rows below
+@ def row_errors(name, pt, row):
+@     (rows, add, off, div) = kernel(name)
+@     for c in pt.chanslist:
+@         for i in range(0, rows):
+uint32_t *err{{ i }}_{{ c.name }} = {{ row(c, i) }};
+@         end
 @     end
+@ end
+@
+@ def clear_errors(name, pt, w):
+@     (rows, add, off, div) = kernel(name)
 @     for c in pt.chanslist:
-memset(errors_{{ c.name }}[{{ y }} % {{ rows }}], 0, ({{ add }} + {{ w }}) * sizeof(uint32_t));
+memset(err0_{{ c.name }}, 0, ({{ add }} + {{ w }}) * sizeof(uint32_t));
 @     end
 @ end
 @
 @ def def_errors(name, pt, w):
-@     if name == 'floyd_steinberg' or name == 'sierra_lite':
-@         rows = 2
-@         add = 2
-@     elif name == 'atkinson':
-@         rows = 3
-@         add = 4
-@     elif name == 'sierra_two_row':
-@         rows = 2
-@         add = 4
-@     elif name == 'sierra':
-@         rows = 3
-@         add = 4
-@     end
+@     (rows, add, off, div) = kernel(name)
 @     for c in pt.chanslist:
 uint32_t errors_{{ c.name }}[{{ rows }}][{{ w }} + {{ add }}];
+memset(errors_{{ c.name }}, 0, sizeof(errors_{{ c.name }}));
 @     end
-@     for i in range(0, rows):
-{@ clear_errors(name, pt, w, i) @}
 @ end
 @
+@ def dither_pixel(fname, pt):
+gp_pixel pix;
+
+pix = gp_getpixel_raw(src, x, y);
+@     if pt.is_rgb():
+pix = gp_pixel_to_RGB888(pix, src->pixel_type);
+@     end
+
+@     for c in pt.chanslist:
+@         if pt.is_gray():
+uint32_t val_{{ c.name }} = gp_pixel_to_G8(pix, src->pixel_type);
+@         else:
+uint32_t val_{{ c.name }} = GP_PIXEL_GET_{{ c.name }}_RGB888(pix);
+@         end
+val_{{ c.name }} += {@ get_error(fname, c, 'x') @};
+
+uint32_t err_{{ c.name }} = val_{{ c.name }};
+
+gp_pixel res_{{ c.name }} = {{ c.max }} * val_{{ c.name }} / 255;
+err_{{ c.name }} -= res_{{ c.name }} * 255 / {{ c.max }};
+
+{@ distribute_error(fname, c, 'x', 'err_' + c.name) @}
+
+GP_CLAMP_DOWN({{ 'res_' + c.name }}, {{ c.max }});
+@     end
+
+@     if pt.is_gray():
+gp_putpixel_raw_{{ pt.pixelpack.suffix }}(dst, x, y, res_V);
+@     else:
+gp_pixel res = GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names, 'res_') }});
+
+gp_putpixel_raw_{{ pt.pixelpack.suffix }}(dst, x, y, res);
+@     end
+@ end
+@
+#ifdef HAVE_PTHREAD
+/*
+ * Wavefront parallel error diffusion.
+ *
+ * Rows are distributed between threads round robin and each row waits for the
+ * row above to be far enough ahead. The kernels reach at most two pixels left
+ * and right, the current row may read an error once the row above has gone
+ * past it and the row above must not write the errors the current row is
+ * writing ahead, hence the lag of 2*2+1 pixels, rounded up.
+ *
+ * The errors are integers so the order in which they are accumulated does not
+ * matter and the result is identical to the sequential version.
+ */
+#define WAVEFRONT_LAG 8
+#define WAVEFRONT_BLOCK 64
+
+struct wavefront {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	unsigned int threads;
+
+	/* Error rows ring buffers, one for each channel */
+	uint32_t *errors;
+	unsigned int err_rows;
+	unsigned int err_w;
+
+	/* Number of pixels done by each thread as y * w + x */
+	size_t *done;
+	int abort;
+
+	gp_progress_cb *callback;
+};
+
+struct wavefront_thread {
+	struct wavefront *wf;
+	unsigned int id;
+};
+
+static uint32_t *wavefront_row(struct wavefront *self, unsigned int chan, gp_coord y)
+{
+	return self->errors + (chan * self->err_rows + y % self->err_rows) * self->err_w;
+}
+
+static void wavefront_publish(struct wavefront *self, unsigned int id, size_t pos)
+{
+	__atomic_store_n(&self->done[id], pos, __ATOMIC_RELEASE);
+}
+
+/*
+ * Waits until the thread processing the row above has done pos pixels.
+ *
+ * Returns non-zero if the operation was aborted.
+ */
+static int wavefront_wait(struct wavefront *self, unsigned int id, size_t pos)
+{
+	unsigned int prev = id ? id - 1 : self->threads - 1;
+
+	while (__atomic_load_n(&self->done[prev], __ATOMIC_ACQUIRE) < pos) {
+		if (__atomic_load_n(&self->abort, __ATOMIC_RELAXED))
+			return 1;
+
+		sched_yield();
+	}
+
+	return 0;
+}
+
+static void wavefront_abort(struct wavefront *self)
+{
+	__atomic_store_n(&self->abort, 1, __ATOMIC_RELAXED);
+}
+
+static int wavefront_run(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_progress_cb *callback, unsigned int threads,
+                         unsigned int rows, unsigned int add, unsigned int chans,
+                         void *(*fn)(void *),
+                         int (*raw)(const gp_pixmap *, gp_pixmap *, gp_progress_cb *))
+{
+	unsigned int i;
+	int ret;
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	/* Rows in flight plus the rows below the last one the errors go to */
+	struct wavefront wf = {
+		.src = src,
+		.dst = dst,
+		.threads = threads,
+		.err_rows = threads + rows - 1,
+		.err_w = src->w + add,
+		.callback = callback ? &callback_mp : NULL,
+	};
+
+	wf.errors = calloc((size_t)wf.err_rows * wf.err_w * chans, sizeof(uint32_t));
+	wf.done = calloc(threads, sizeof(size_t));
+
+	if (!wf.errors || !wf.done) {
+		free(wf.errors);
+		free(wf.done);
+		errno = ENOMEM;
+		return 1;
+	}
+
+	pthread_t tids[threads];
+	struct wavefront_thread args[threads];
+
+	/*
+	 * Each row depends on the row above, hence we cannot run the rows in
+	 * the caller if thread creation fails. Abort the threads that were
+	 * started and dither the whole image sequentially instead.
+	 */
+	for (i = 0; i < threads; i++) {
+		args[i].wf = &wf;
+		args[i].id = i;
+
+		if (pthread_create(&tids[i], NULL, fn, &args[i])) {
+			GP_DEBUG(1, "pthread_create() failed, running sequentially");
+			wavefront_abort(&wf);
+			break;
+		}
+	}
+
+	unsigned int started = i;
+
+	while (i-- > 0)
+		pthread_join(tids[i], NULL);
+
+	ret = wf.abort;
+
+	free(wf.errors);
+	free(wf.done);
+
+	if (started < threads)
+		return raw(src, dst, callback);
+
+	if (!ret)
+		gp_progress_cb_done(callback);
+
+	return ret;
+}
+#endif /* HAVE_PTHREAD */
+
 @ def gen_dither(name, fname):
+@     (rows, add, off, div) = kernel(fname)
 @     for pt in pixeltypes:
 @         if pt.is_gray() or pt.is_rgb() and not pt.is_alpha():
 /*
@@ -127,50 +298,60 @@ static int {{ fname }}_to_{{ pt.name }}_raw(const gp_pixmap *src,
 		    src->w, src->h);
 
 	for (y = 0; y < (gp_coord)src->h; y++) {
+		{@ row_errors(fname, pt, lambda c, i: 'errors_%s[(y + %i) %% %i]' % (c.name, i, rows)) @}
+
 		for (x = 0; x < (gp_coord)src->w; x++) {
-			gp_pixel pix;
+			{@ dither_pixel(fname, pt) @}
+		}
 
-			pix = gp_getpixel_raw(src, x, y);
-@             if pt.is_rgb():
-			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
-@             end
+		{@ clear_errors(fname, pt, 'src->w') @}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w))
+			return 1;
+	}
 
-@             for c in pt.chanslist:
-@                 if pt.is_gray():
-			uint32_t val_{{ c.name }} = gp_pixel_to_G8(pix, src->pixel_type);
-@                 else:
-			uint32_t val_{{ c.name }} = GP_PIXEL_GET_{{ c.name }}_RGB888(pix);
-@                 end
-			val_{{ c.name }} += {@ get_error(fname, c, 'x', 'y') @};
+	gp_progress_cb_done(callback);
+	return 0;
+}
 
-			uint32_t err_{{ c.name }} = val_{{ c.name }};
+#ifdef HAVE_PTHREAD
+static void *{{ fname }}_to_{{ pt.name }}_wave(void *arg)
+{
+	struct wavefront_thread *self = arg;
+	struct wavefront *wf = self->wf;
+	const gp_pixmap *src = wf->src;
+	gp_pixmap *dst = wf->dst;
+	gp_coord x, y;
 
-			gp_pixel res_{{ c.name }} = {{ c.max }} * val_{{ c.name }} / 255;
-			err_{{ c.name }} -= res_{{ c.name }} * 255 / {{ c.max }};
+	for (y = self->id; y < (gp_coord)src->h; y += wf->threads) {
+		{@ row_errors(fname, pt, lambda c, i: 'wavefront_row(wf, %i, y + %i)' % (c.idx, i)) @}
+		gp_coord x0;
 
-			{@ distribute_error(fname, c, 'x', 'y', 'err_' + c.name) @}
+		for (x0 = 0; x0 < (gp_coord)src->w; x0 += WAVEFRONT_BLOCK) {
+			gp_coord x1 = GP_MIN(x0 + WAVEFRONT_BLOCK, (gp_coord)src->w);
 
-			GP_CLAMP_DOWN({{ 'res_' + c.name }}, {{ c.max }});
-@             end
+			if (y && wavefront_wait(wf, self->id, (size_t)(y - 1) * src->w +
+			                        GP_MIN(x1 + WAVEFRONT_LAG, (gp_coord)src->w)))
+				return NULL;
 
-@             if pt.is_gray():
-			gp_putpixel_raw_{{ pt.pixelpack.suffix }}(dst, x, y, res_V);
-@             else:
-			gp_pixel res = GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names, 'res_') }});
+			for (x = x0; x < x1; x++) {
+				{@ dither_pixel(fname, pt) @}
+			}
 
-			gp_putpixel_raw_{{ pt.pixelpack.suffix }}(dst, x, y, res);
-@             end
+			wavefront_publish(wf, self->id, (size_t)y * src->w + x1);
 		}
 
-		{@ clear_errors(fname, pt, 'src->w', 'y') @}
+		{@ clear_errors(fname, pt, 'src->w') @}
 
-		if (gp_progress_cb_report(callback, y, src->h, src->w))
-			return 1;
+		if (gp_progress_cb_report(wf->callback, y, src->h, src->w)) {
+			wavefront_abort(wf);
+			return NULL;
+		}
 	}
 
-	gp_progress_cb_done(callback);
-	return 0;
+	return NULL;
 }
+#endif /* HAVE_PTHREAD */
 
 @     end
 static int {{ fname }}(const gp_pixmap *src, gp_pixmap *dst,
@@ -183,6 +364,30 @@ static int {{ fname }}(const gp_pixmap *src, gp_pixmap *dst,
 		return 1;
 	}
 
+#ifdef HAVE_PTHREAD
+	unsigned int t = GP_MIN(gp_nr_threads(src->w, src->h, callback), src->h);
+
+	if (t > 1) {
+		GP_DEBUG(1, "{{ name }} %s to %s %ux%u in %u threads",
+		         gp_pixel_type_name(src->pixel_type),
+		         gp_pixel_type_name(dst->pixel_type),
+		         src->w, src->h, t);
+
+		switch (dst->pixel_type) {
+@     for pt in pixeltypes:
+@         if pt.is_gray() or pt.is_rgb() and not pt.is_alpha():
+		case GP_PIXEL_{{ pt.name }}:
+			return wavefront_run(src, dst, callback, t, {{ rows }}, {{ add }},
+			                     {{ pt.chan_cnt }}, {{ fname }}_to_{{ pt.name }}_wave,
+			                     {{ fname }}_to_{{ pt.name }}_raw);
+@     end
+		default:
+			errno = EINVAL;
+			return 1;
+		}
+	}
+#endif /* HAVE_PTHREAD */
+
 	switch (dst->pixel_type) {
 @     for pt in pixeltypes:
 @         if pt.is_gray() or pt.is_rgb() and not pt.is_alpha():
@@ -0,0 +1,7705 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_dither_bayer.gen.c
+ *
+ * GENERATED on 2026 10 19 19:42:18 from gp_dither_bayer.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixel.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_convert.h>
+#include <core/gp_clamp.h>
+#include <filters/gp_filter.h>
+#include <filters/gp_dither.gen.h>
+
+/**
+ * 4x4 Bayer matrix scaled to UINT16_MAX
+ */
+static const uint32_t bayer_4x4[4][4] = {
+    {  3855, 50115, 15420, 61680 },
+    { 34695, 19290, 46260, 30870 },
+    { 11565, 57825,  7710, 53985 },
+    { 42405, 27015, 38550, 23145 }
+};
+
+/**
+ * 8x8 Bayer matrix scaled to UIN16_MAX
+ */
+static const uint32_t bayer_8x8[8][8] = {
+    {     0, 32896,  8224, 41120,  2056, 34952, 10280, 43176 },
+    { 49344, 16448, 57568, 24672, 51400, 18504, 59624, 26728 },
+    { 12336, 45232,  4112, 37008, 14392, 47288,  6168, 39064 },
+    { 61680, 28784, 53456, 20560, 63736, 30840, 55512, 22616 },
+    {  3084, 35980, 11308, 44204,  1028, 33924,  9252, 42148 },
+    { 52428, 19532, 60652, 27756, 50372, 17476, 58596, 25700 },
+    { 15420, 48316,  7196, 40092, 13364, 46260,  5140, 38036 },
+    { 64764, 31868, 56540, 23644, 62708, 29812, 54484, 21588 }
+};
+
+/*
+ * Bayer 4x4 to RGB101010
+ */
+static int bayer_4_to_RGB101010_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB101010),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 1023;
+	const int step_G = UINT16_MAX / 1023;
+	const int step_B = UINT16_MAX / 1023;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 1023)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 1023)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 1023)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to xRGB8888
+ */
+static int bayer_4_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 255;
+	const int step_G = UINT16_MAX / 255;
+	const int step_B = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 255)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 255)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 255)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to RGB888
+ */
+static int bayer_4_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 255;
+	const int step_G = UINT16_MAX / 255;
+	const int step_B = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 255)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 255)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 255)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to BGR888
+ */
+static int bayer_4_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	const int step_B = UINT16_MAX / 255;
+	const int step_G = UINT16_MAX / 255;
+	const int step_R = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_B[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_R[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 255)
+				res_B++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 255)
+				res_G++;
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 255)
+				res_R++;
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to RGB555
+ */
+static int bayer_4_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 31;
+	const int step_G = UINT16_MAX / 31;
+	const int step_B = UINT16_MAX / 31;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 31)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 31)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 31)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to RGB565_BE
+ */
+static int bayer_4_to_RGB565_BE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_BE),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 31;
+	const int step_G = UINT16_MAX / 63;
+	const int step_B = UINT16_MAX / 31;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 31)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 63)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 31)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to RGB565_LE
+ */
+static int bayer_4_to_RGB565_LE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_LE),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 31;
+	const int step_G = UINT16_MAX / 63;
+	const int step_B = UINT16_MAX / 31;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 31)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 63)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 31)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to RGB666
+ */
+static int bayer_4_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 63;
+	const int step_G = UINT16_MAX / 63;
+	const int step_B = UINT16_MAX / 63;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 63)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 63)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 63)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to RGB332
+ */
+static int bayer_4_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 7;
+	const int step_G = UINT16_MAX / 7;
+	const int step_B = UINT16_MAX / 3;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 7)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 7)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 3)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to G1_DB
+ */
+static int bayer_4_to_G1_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_DB),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 1;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 1)
+				res_V++;
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to G2_DB
+ */
+static int bayer_4_to_G2_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_DB),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 3;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 3)
+				res_V++;
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to G4_DB
+ */
+static int bayer_4_to_G4_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_DB),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 15;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 15)
+				res_V++;
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to G1_UB
+ */
+static int bayer_4_to_G1_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_UB),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 1;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 1)
+				res_V++;
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to G2_UB
+ */
+static int bayer_4_to_G2_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_UB),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 3;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 3)
+				res_V++;
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to G4_UB
+ */
+static int bayer_4_to_G4_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_UB),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 15;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 15)
+				res_V++;
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to G8
+ */
+static int bayer_4_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 255)
+				res_V++;
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to GA88
+ */
+static int bayer_4_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 255;
+	const int step_A = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+	uint32_t thresholds_A[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+			thresholds_A[y][x] = (bayer_4x4[y][x] * step_A) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 255)
+				res_V++;
+			uint32_t pix_A = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_A = pix_A << 8;
+
+			gp_pixel res_A = pix_A / step_A;
+			gp_pixel rem_A = pix_A % step_A;
+
+			uint32_t thresh_A = thresholds_A[y & 3][x & 3];
+
+			if (rem_A > thresh_A && res_A < 255)
+				res_A++;
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_A);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 4x4 to G16
+ */
+static int bayer_4_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 65535;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 65535)
+				res_V++;
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int bayer_4(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return bayer_4_to_RGB101010_raw(src, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return bayer_4_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return bayer_4_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return bayer_4_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return bayer_4_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_BE:
+		return bayer_4_to_RGB565_BE_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_LE:
+		return bayer_4_to_RGB565_LE_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return bayer_4_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return bayer_4_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return bayer_4_to_G1_DB_raw(src, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return bayer_4_to_G2_DB_raw(src, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return bayer_4_to_G4_DB_raw(src, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return bayer_4_to_G1_UB_raw(src, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return bayer_4_to_G2_UB_raw(src, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return bayer_4_to_G4_UB_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return bayer_4_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return bayer_4_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return bayer_4_to_G16_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_bayer_4(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+	return bayer_4(src, dst, callback);
+}
+
+/*
+ * Sharpened Bayer 4x4 to RGB101010
+ */
+static int sharpened_bayer_4_to_RGB101010_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB101010),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 1023;
+	const int step_G = UINT16_MAX / 1023;
+	const int step_B = UINT16_MAX / 1023;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<10);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 1023)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<10);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 1023)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<10);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 1023)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to xRGB8888
+ */
+static int sharpened_bayer_4_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 255;
+	const int step_G = UINT16_MAX / 255;
+	const int step_B = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<8);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 255)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<8);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 255)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<8);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 255)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to RGB888
+ */
+static int sharpened_bayer_4_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 255;
+	const int step_G = UINT16_MAX / 255;
+	const int step_B = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<8);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 255)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<8);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 255)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<8);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 255)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to BGR888
+ */
+static int sharpened_bayer_4_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+	}
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+	}
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+
+	const int step_B = UINT16_MAX / 255;
+	const int step_G = UINT16_MAX / 255;
+	const int step_R = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_B[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_R[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		}
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<8);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 255)
+				res_B++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<8);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 255)
+				res_G++;
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<8);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 255)
+				res_R++;
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to RGB555
+ */
+static int sharpened_bayer_4_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 31;
+	const int step_G = UINT16_MAX / 31;
+	const int step_B = UINT16_MAX / 31;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<5);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 31)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<5);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 31)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<5);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 31)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to RGB565_BE
+ */
+static int sharpened_bayer_4_to_RGB565_BE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_BE),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 31;
+	const int step_G = UINT16_MAX / 63;
+	const int step_B = UINT16_MAX / 31;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<5);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 31)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<6);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 63)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<5);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 31)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to RGB565_LE
+ */
+static int sharpened_bayer_4_to_RGB565_LE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_LE),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 31;
+	const int step_G = UINT16_MAX / 63;
+	const int step_B = UINT16_MAX / 31;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<5);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 31)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<6);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 63)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<5);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 31)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to RGB666
+ */
+static int sharpened_bayer_4_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 63;
+	const int step_G = UINT16_MAX / 63;
+	const int step_B = UINT16_MAX / 63;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<6);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 63)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<6);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 63)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<6);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 63)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to RGB332
+ */
+static int sharpened_bayer_4_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 7;
+	const int step_G = UINT16_MAX / 7;
+	const int step_B = UINT16_MAX / 3;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[4][4];
+	uint32_t thresholds_G[4][4];
+	uint32_t thresholds_B[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_R[y][x] = (bayer_4x4[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_4x4[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_4x4[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<3);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 3][x & 3];
+
+			if (rem_R > thresh_R && res_R < 7)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<3);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 3][x & 3];
+
+			if (rem_G > thresh_G && res_G < 7)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<2);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 3][x & 3];
+
+			if (rem_B > thresh_B && res_B < 3)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to G1_DB
+ */
+static int sharpened_bayer_4_to_G1_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_DB),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 1;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<1);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 1)
+				res_V++;
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to G2_DB
+ */
+static int sharpened_bayer_4_to_G2_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_DB),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 3;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<2);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 3)
+				res_V++;
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to G4_DB
+ */
+static int sharpened_bayer_4_to_G4_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_DB),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 15;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<4);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 15)
+				res_V++;
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to G1_UB
+ */
+static int sharpened_bayer_4_to_G1_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_UB),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 1;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<1);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 1)
+				res_V++;
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to G2_UB
+ */
+static int sharpened_bayer_4_to_G2_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_UB),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 3;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<2);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 3)
+				res_V++;
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to G4_UB
+ */
+static int sharpened_bayer_4_to_G4_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_UB),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 15;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<4);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 15)
+				res_V++;
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to G8
+ */
+static int sharpened_bayer_4_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<8);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 255)
+				res_V++;
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to GA88
+ */
+static int sharpened_bayer_4_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 2);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_A = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_A = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_A = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_A[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+	row1_A[0] = row1_A[1];
+	row1_A[src->w+1] = row1_A[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_A[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+	row2_A[0] = row2_A[1];
+	row2_A[src->w+1] = row2_A[src->w];
+
+	const int step_V = UINT16_MAX / 255;
+	const int step_A = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+	uint32_t thresholds_A[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+			thresholds_A[y][x] = (bayer_4x4[y][x] * step_A) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		tmp_row = row0_A;
+		row0_A = row1_A;
+		row1_A = row2_A;
+		row2_A = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_A[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		row2_A[0] = row2_A[1];
+		row2_A[src->w+1] = row2_A[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<8);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 255)
+				res_V++;
+			int32_t pix_A = row1_A[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_A =
+			3*row0_A[x] + 6*row0_A[x+1] + 3*row0_A[x+2] +
+			6*row1_A[x] - 4*row1_A[x+1] + 6*row1_A[x+2] +
+			3*row2_A[x] + 6*row2_A[x+1] + 3*row2_A[x+2];
+
+			avg_A <<= 3;
+
+			pix_A += (pix_A - avg_A) * 4 / (1<<8);
+
+			pix_A = GP_CLAMP(pix_A, 0, UINT16_MAX);
+
+			gp_pixel res_A = pix_A / step_A;
+			gp_pixel rem_A = pix_A % step_A;
+
+			uint32_t thresh_A = thresholds_A[y & 3][x & 3];
+
+			if (rem_A > thresh_A && res_A < 255)
+				res_A++;
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_A);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 4x4 to G16
+ */
+static int sharpened_bayer_4_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 4x4 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 65535;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[4][4];
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			thresholds_V[y][x] = (bayer_4x4[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<16);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 3][x & 3];
+
+			if (rem_V > thresh_V && res_V < 65535)
+				res_V++;
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+static int sharpened_bayer_4(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return sharpened_bayer_4_to_RGB101010_raw(src, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return sharpened_bayer_4_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return sharpened_bayer_4_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return sharpened_bayer_4_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return sharpened_bayer_4_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_BE:
+		return sharpened_bayer_4_to_RGB565_BE_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_LE:
+		return sharpened_bayer_4_to_RGB565_LE_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return sharpened_bayer_4_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return sharpened_bayer_4_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return sharpened_bayer_4_to_G1_DB_raw(src, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return sharpened_bayer_4_to_G2_DB_raw(src, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return sharpened_bayer_4_to_G4_DB_raw(src, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return sharpened_bayer_4_to_G1_UB_raw(src, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return sharpened_bayer_4_to_G2_UB_raw(src, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return sharpened_bayer_4_to_G4_UB_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return sharpened_bayer_4_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return sharpened_bayer_4_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return sharpened_bayer_4_to_G16_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_sharpened_bayer_4(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+	return sharpened_bayer_4(src, dst, callback);
+}
+
+/*
+ * Bayer 8x8 to RGB101010
+ */
+static int bayer_8_to_RGB101010_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB101010),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 1023;
+	const int step_G = UINT16_MAX / 1023;
+	const int step_B = UINT16_MAX / 1023;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 1023)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 1023)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 1023)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to xRGB8888
+ */
+static int bayer_8_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 255;
+	const int step_G = UINT16_MAX / 255;
+	const int step_B = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 255)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 255)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 255)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to RGB888
+ */
+static int bayer_8_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 255;
+	const int step_G = UINT16_MAX / 255;
+	const int step_B = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 255)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 255)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 255)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to BGR888
+ */
+static int bayer_8_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	const int step_B = UINT16_MAX / 255;
+	const int step_G = UINT16_MAX / 255;
+	const int step_R = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_B[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_R[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 255)
+				res_B++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 255)
+				res_G++;
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 255)
+				res_R++;
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to RGB555
+ */
+static int bayer_8_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 31;
+	const int step_G = UINT16_MAX / 31;
+	const int step_B = UINT16_MAX / 31;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 31)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 31)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 31)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to RGB565_BE
+ */
+static int bayer_8_to_RGB565_BE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_BE),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 31;
+	const int step_G = UINT16_MAX / 63;
+	const int step_B = UINT16_MAX / 31;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 31)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 63)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 31)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to RGB565_LE
+ */
+static int bayer_8_to_RGB565_LE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_LE),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 31;
+	const int step_G = UINT16_MAX / 63;
+	const int step_B = UINT16_MAX / 31;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 31)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 63)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 31)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to RGB666
+ */
+static int bayer_8_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 63;
+	const int step_G = UINT16_MAX / 63;
+	const int step_B = UINT16_MAX / 63;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 63)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 63)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 63)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to RGB332
+ */
+static int bayer_8_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	const int step_R = UINT16_MAX / 7;
+	const int step_G = UINT16_MAX / 7;
+	const int step_B = UINT16_MAX / 3;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, y), src->pixel_type);
+
+			uint32_t pix_R = GP_PIXEL_GET_R_RGB888(pix);
+			pix_R = pix_R << 8;
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 7)
+				res_R++;
+			uint32_t pix_G = GP_PIXEL_GET_G_RGB888(pix);
+			pix_G = pix_G << 8;
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 7)
+				res_G++;
+			uint32_t pix_B = GP_PIXEL_GET_B_RGB888(pix);
+			pix_B = pix_B << 8;
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 3)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to G1_DB
+ */
+static int bayer_8_to_G1_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_DB),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 1;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 1)
+				res_V++;
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to G2_DB
+ */
+static int bayer_8_to_G2_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_DB),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 3;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 3)
+				res_V++;
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to G4_DB
+ */
+static int bayer_8_to_G4_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_DB),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 15;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 15)
+				res_V++;
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to G1_UB
+ */
+static int bayer_8_to_G1_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_UB),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 1;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 1)
+				res_V++;
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to G2_UB
+ */
+static int bayer_8_to_G2_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_UB),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 3;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 3)
+				res_V++;
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to G4_UB
+ */
+static int bayer_8_to_G4_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_UB),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 15;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 15)
+				res_V++;
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to G8
+ */
+static int bayer_8_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 255)
+				res_V++;
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to GA88
+ */
+static int bayer_8_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 255;
+	const int step_A = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+	uint32_t thresholds_A[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+			thresholds_A[y][x] = (bayer_8x8[y][x] * step_A) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 255)
+				res_V++;
+			uint32_t pix_A = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_A = pix_A << 8;
+
+			gp_pixel res_A = pix_A / step_A;
+			gp_pixel rem_A = pix_A % step_A;
+
+			uint32_t thresh_A = thresholds_A[y & 7][x & 7];
+
+			if (rem_A > thresh_A && res_A < 255)
+				res_A++;
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_A);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Bayer 8x8 to G16
+ */
+static int bayer_8_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	const int step_V = UINT16_MAX / 65535;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			uint32_t pix_V = gp_pixel_to_G8(gp_getpixel_raw(src, x, y), src->pixel_type);
+			pix_V = pix_V << 8;
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 65535)
+				res_V++;
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int bayer_8(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return bayer_8_to_RGB101010_raw(src, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return bayer_8_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return bayer_8_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return bayer_8_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return bayer_8_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_BE:
+		return bayer_8_to_RGB565_BE_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_LE:
+		return bayer_8_to_RGB565_LE_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return bayer_8_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return bayer_8_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return bayer_8_to_G1_DB_raw(src, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return bayer_8_to_G2_DB_raw(src, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return bayer_8_to_G4_DB_raw(src, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return bayer_8_to_G1_UB_raw(src, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return bayer_8_to_G2_UB_raw(src, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return bayer_8_to_G4_UB_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return bayer_8_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return bayer_8_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return bayer_8_to_G16_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_bayer_8(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+	return bayer_8(src, dst, callback);
+}
+
+/*
+ * Sharpened Bayer 8x8 to RGB101010
+ */
+static int sharpened_bayer_8_to_RGB101010_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB101010),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 1023;
+	const int step_G = UINT16_MAX / 1023;
+	const int step_B = UINT16_MAX / 1023;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<10);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 1023)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<10);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 1023)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<10);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 1023)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to xRGB8888
+ */
+static int sharpened_bayer_8_to_xRGB8888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_xRGB8888),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 255;
+	const int step_G = UINT16_MAX / 255;
+	const int step_B = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<8);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 255)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<8);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 255)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<8);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 255)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to RGB888
+ */
+static int sharpened_bayer_8_to_RGB888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB888),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 255;
+	const int step_G = UINT16_MAX / 255;
+	const int step_B = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<8);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 255)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<8);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 255)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<8);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 255)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to BGR888
+ */
+static int sharpened_bayer_8_to_BGR888_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_BGR888),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+	}
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+	}
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+
+	const int step_B = UINT16_MAX / 255;
+	const int step_G = UINT16_MAX / 255;
+	const int step_R = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_B[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_R[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		}
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<8);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 255)
+				res_B++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<8);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 255)
+				res_G++;
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<8);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 255)
+				res_R++;
+
+			gp_pixel res = GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to RGB555
+ */
+static int sharpened_bayer_8_to_RGB555_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB555),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 31;
+	const int step_G = UINT16_MAX / 31;
+	const int step_B = UINT16_MAX / 31;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<5);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 31)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<5);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 31)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<5);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 31)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to RGB565_BE
+ */
+static int sharpened_bayer_8_to_RGB565_BE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_BE),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 31;
+	const int step_G = UINT16_MAX / 63;
+	const int step_B = UINT16_MAX / 31;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<5);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 31)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<6);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 63)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<5);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 31)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to RGB565_LE
+ */
+static int sharpened_bayer_8_to_RGB565_LE_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB565_LE),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 31;
+	const int step_G = UINT16_MAX / 63;
+	const int step_B = UINT16_MAX / 31;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<5);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 31)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<6);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 63)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<5);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 31)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to RGB666
+ */
+static int sharpened_bayer_8_to_RGB666_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB666),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 63;
+	const int step_G = UINT16_MAX / 63;
+	const int step_B = UINT16_MAX / 63;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<6);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 63)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<6);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 63)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<6);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 63)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to RGB332
+ */
+static int sharpened_bayer_8_to_RGB332_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_RGB332),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 3);
+
+	int16_t *row0_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_R = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_G = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_B = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row1_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row1_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row1_R[0] = row1_R[1];
+	row1_R[src->w+1] = row1_R[src->w];
+	row1_G[0] = row1_G[1];
+	row1_G[src->w+1] = row1_G[src->w];
+	row1_B[0] = row1_B[1];
+	row1_B[src->w+1] = row1_B[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+		row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+		row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+	}
+	row2_R[0] = row2_R[1];
+	row2_R[src->w+1] = row2_R[src->w];
+	row2_G[0] = row2_G[1];
+	row2_G[src->w+1] = row2_G[src->w];
+	row2_B[0] = row2_B[1];
+	row2_B[src->w+1] = row2_B[src->w];
+
+	const int step_R = UINT16_MAX / 7;
+	const int step_G = UINT16_MAX / 7;
+	const int step_B = UINT16_MAX / 3;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_R[8][8];
+	uint32_t thresholds_G[8][8];
+	uint32_t thresholds_B[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_R[y][x] = (bayer_8x8[y][x] * step_R) / UINT16_MAX;
+			thresholds_G[y][x] = (bayer_8x8[y][x] * step_G) / UINT16_MAX;
+			thresholds_B[y][x] = (bayer_8x8[y][x] * step_B) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_R;
+		row0_R = row1_R;
+		row1_R = row2_R;
+		row2_R = tmp_row;
+		tmp_row = row0_G;
+		row0_G = row1_G;
+		row1_G = row2_G;
+		row2_G = tmp_row;
+		tmp_row = row0_B;
+		row0_B = row1_B;
+		row1_B = row2_B;
+		row2_B = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel tmp_pix = gp_pixel_to_RGB888(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_R[x+1] = GP_PIXEL_GET_R_RGB888(tmp_pix);
+			row2_G[x+1] = GP_PIXEL_GET_G_RGB888(tmp_pix);
+			row2_B[x+1] = GP_PIXEL_GET_B_RGB888(tmp_pix);
+		}
+		row2_R[0] = row2_R[1];
+		row2_R[src->w+1] = row2_R[src->w];
+		row2_G[0] = row2_G[1];
+		row2_G[src->w+1] = row2_G[src->w];
+		row2_B[0] = row2_B[1];
+		row2_B[src->w+1] = row2_B[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_R = row1_R[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_R =
+			3*row0_R[x] + 6*row0_R[x+1] + 3*row0_R[x+2] +
+			6*row1_R[x] - 4*row1_R[x+1] + 6*row1_R[x+2] +
+			3*row2_R[x] + 6*row2_R[x+1] + 3*row2_R[x+2];
+
+			avg_R <<= 3;
+
+			pix_R += (pix_R - avg_R) * 4 / (1<<3);
+
+			pix_R = GP_CLAMP(pix_R, 0, UINT16_MAX);
+
+			gp_pixel res_R = pix_R / step_R;
+			gp_pixel rem_R = pix_R % step_R;
+
+			uint32_t thresh_R = thresholds_R[y & 7][x & 7];
+
+			if (rem_R > thresh_R && res_R < 7)
+				res_R++;
+			int32_t pix_G = row1_G[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_G =
+			3*row0_G[x] + 6*row0_G[x+1] + 3*row0_G[x+2] +
+			6*row1_G[x] - 4*row1_G[x+1] + 6*row1_G[x+2] +
+			3*row2_G[x] + 6*row2_G[x+1] + 3*row2_G[x+2];
+
+			avg_G <<= 3;
+
+			pix_G += (pix_G - avg_G) * 4 / (1<<3);
+
+			pix_G = GP_CLAMP(pix_G, 0, UINT16_MAX);
+
+			gp_pixel res_G = pix_G / step_G;
+			gp_pixel rem_G = pix_G % step_G;
+
+			uint32_t thresh_G = thresholds_G[y & 7][x & 7];
+
+			if (rem_G > thresh_G && res_G < 7)
+				res_G++;
+			int32_t pix_B = row1_B[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_B =
+			3*row0_B[x] + 6*row0_B[x+1] + 3*row0_B[x+2] +
+			6*row1_B[x] - 4*row1_B[x+1] + 6*row1_B[x+2] +
+			3*row2_B[x] + 6*row2_B[x+1] + 3*row2_B[x+2];
+
+			avg_B <<= 3;
+
+			pix_B += (pix_B - avg_B) * 4 / (1<<2);
+
+			pix_B = GP_CLAMP(pix_B, 0, UINT16_MAX);
+
+			gp_pixel res_B = pix_B / step_B;
+			gp_pixel rem_B = pix_B % step_B;
+
+			uint32_t thresh_B = thresholds_B[y & 7][x & 7];
+
+			if (rem_B > thresh_B && res_B < 3)
+				res_B++;
+
+			gp_pixel res = GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, res);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to G1_DB
+ */
+static int sharpened_bayer_8_to_G1_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_DB),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 1;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<1);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 1)
+				res_V++;
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to G2_DB
+ */
+static int sharpened_bayer_8_to_G2_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_DB),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 3;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<2);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 3)
+				res_V++;
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to G4_DB
+ */
+static int sharpened_bayer_8_to_G4_DB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_DB),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 15;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<4);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 15)
+				res_V++;
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to G1_UB
+ */
+static int sharpened_bayer_8_to_G1_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G1_UB),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 1;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<1);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 1)
+				res_V++;
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to G2_UB
+ */
+static int sharpened_bayer_8_to_G2_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G2_UB),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 3;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<2);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 3)
+				res_V++;
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to G4_UB
+ */
+static int sharpened_bayer_8_to_G4_UB_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G4_UB),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 15;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<4);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 15)
+				res_V++;
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to G8
+ */
+static int sharpened_bayer_8_to_G8_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G8),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<8);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 255)
+				res_V++;
+
+			gp_putpixel_raw_8BPP(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to GA88
+ */
+static int sharpened_bayer_8_to_GA88_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_GA88),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 2);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row0_A = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_A = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_A = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row1_A[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+	row1_A[0] = row1_A[1];
+	row1_A[src->w+1] = row1_A[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+		row2_A[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+	row2_A[0] = row2_A[1];
+	row2_A[src->w+1] = row2_A[src->w];
+
+	const int step_V = UINT16_MAX / 255;
+	const int step_A = UINT16_MAX / 255;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+	uint32_t thresholds_A[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+			thresholds_A[y][x] = (bayer_8x8[y][x] * step_A) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		tmp_row = row0_A;
+		row0_A = row1_A;
+		row1_A = row2_A;
+		row2_A = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+			row2_A[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		row2_A[0] = row2_A[1];
+		row2_A[src->w+1] = row2_A[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<8);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 255)
+				res_V++;
+			int32_t pix_A = row1_A[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_A =
+			3*row0_A[x] + 6*row0_A[x+1] + 3*row0_A[x+2] +
+			6*row1_A[x] - 4*row1_A[x+1] + 6*row1_A[x+2] +
+			3*row2_A[x] + 6*row2_A[x+1] + 3*row2_A[x+2];
+
+			avg_A <<= 3;
+
+			pix_A += (pix_A - avg_A) * 4 / (1<<8);
+
+			pix_A = GP_CLAMP(pix_A, 0, UINT16_MAX);
+
+			gp_pixel res_A = pix_A / step_A;
+			gp_pixel rem_A = pix_A % step_A;
+
+			uint32_t thresh_A = thresholds_A[y & 7][x & 7];
+
+			if (rem_A > thresh_A && res_A < 255)
+				res_A++;
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_A);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+/*
+ * Sharpened Bayer 8x8 to G16
+ */
+static int sharpened_bayer_8_to_G16_raw(const gp_pixmap *src,
+                                                gp_pixmap *dst,
+                                                gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Sharpened Bayer 8x8 %s to %s %ux%u",
+	            gp_pixel_type_name(src->pixel_type),
+	            gp_pixel_type_name(GP_PIXEL_G16),
+		    src->w, src->h);
+
+	gp_temp_alloc_create(temp, sizeof(int16_t) * 3 * (src->w + 2) * 1);
+
+	int16_t *row0_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row1_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	int16_t *row2_V = gp_temp_alloc_get(temp, sizeof(int16_t) * (src->w + 2));
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row1_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row1_V[0] = row1_V[1];
+	row1_V[src->w+1] = row1_V[src->w];
+
+	for (x = 0; x < (gp_coord)src->w; x++) {
+		row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, 0), src->pixel_type);
+	}
+	row2_V[0] = row2_V[1];
+	row2_V[src->w+1] = row2_V[src->w];
+
+	const int step_V = UINT16_MAX / 65535;
+
+	/* Thresholds scaled to the channel steps */
+	uint32_t thresholds_V[8][8];
+
+	for (y = 0; y < 8; y++) {
+		for (x = 0; x < 8; x++) {
+			thresholds_V[y][x] = (bayer_8x8[y][x] * step_V) / UINT16_MAX;
+		}
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		/* Shuffle rows */
+		int16_t *tmp_row;
+		tmp_row = row0_V;
+		row0_V = row1_V;
+		row1_V = row2_V;
+		row2_V = tmp_row;
+		/* Fetch new row */
+		gp_coord row_y = GP_MIN(y+1, (gp_coord)src->h-1);
+
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			row2_V[x+1] = gp_pixel_to_G8(gp_getpixel_raw(src, x, row_y), src->pixel_type);
+		}
+		row2_V[0] = row2_V[1];
+		row2_V[src->w+1] = row2_V[src->w];
+		for (x = 0; x < (gp_coord)src->w; x++) {
+
+			int32_t pix_V = row1_V[x+1]<<8;
+
+			/* Sharpening */
+			int32_t avg_V =
+			3*row0_V[x] + 6*row0_V[x+1] + 3*row0_V[x+2] +
+			6*row1_V[x] - 4*row1_V[x+1] + 6*row1_V[x+2] +
+			3*row2_V[x] + 6*row2_V[x+1] + 3*row2_V[x+2];
+
+			avg_V <<= 3;
+
+			pix_V += (pix_V - avg_V) * 4 / (1<<16);
+
+			pix_V = GP_CLAMP(pix_V, 0, UINT16_MAX);
+
+			gp_pixel res_V = pix_V / step_V;
+			gp_pixel rem_V = pix_V % step_V;
+
+			uint32_t thresh_V = thresholds_V[y & 7][x & 7];
+
+			if (rem_V > thresh_V && res_V < 65535)
+				res_V++;
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, res_V);
+		}
+
+		if (gp_progress_cb_report(callback, y, src->h, src->w)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	gp_temp_alloc_free(temp);
+	return 0;
+}
+
+static int sharpened_bayer_8(const gp_pixmap *src, gp_pixmap *dst,
+                            gp_progress_cb *callback)
+{
+	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported source pixel type %s",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	switch (dst->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return sharpened_bayer_8_to_RGB101010_raw(src, dst, callback);
+	case GP_PIXEL_xRGB8888:
+		return sharpened_bayer_8_to_xRGB8888_raw(src, dst, callback);
+	case GP_PIXEL_RGB888:
+		return sharpened_bayer_8_to_RGB888_raw(src, dst, callback);
+	case GP_PIXEL_BGR888:
+		return sharpened_bayer_8_to_BGR888_raw(src, dst, callback);
+	case GP_PIXEL_RGB555:
+		return sharpened_bayer_8_to_RGB555_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_BE:
+		return sharpened_bayer_8_to_RGB565_BE_raw(src, dst, callback);
+	case GP_PIXEL_RGB565_LE:
+		return sharpened_bayer_8_to_RGB565_LE_raw(src, dst, callback);
+	case GP_PIXEL_RGB666:
+		return sharpened_bayer_8_to_RGB666_raw(src, dst, callback);
+	case GP_PIXEL_RGB332:
+		return sharpened_bayer_8_to_RGB332_raw(src, dst, callback);
+	case GP_PIXEL_G1_DB:
+		return sharpened_bayer_8_to_G1_DB_raw(src, dst, callback);
+	case GP_PIXEL_G2_DB:
+		return sharpened_bayer_8_to_G2_DB_raw(src, dst, callback);
+	case GP_PIXEL_G4_DB:
+		return sharpened_bayer_8_to_G4_DB_raw(src, dst, callback);
+	case GP_PIXEL_G1_UB:
+		return sharpened_bayer_8_to_G1_UB_raw(src, dst, callback);
+	case GP_PIXEL_G2_UB:
+		return sharpened_bayer_8_to_G2_UB_raw(src, dst, callback);
+	case GP_PIXEL_G4_UB:
+		return sharpened_bayer_8_to_G4_UB_raw(src, dst, callback);
+	case GP_PIXEL_G8:
+		return sharpened_bayer_8_to_G8_raw(src, dst, callback);
+	case GP_PIXEL_GA88:
+		return sharpened_bayer_8_to_GA88_raw(src, dst, callback);
+	case GP_PIXEL_G16:
+		return sharpened_bayer_8_to_G16_raw(src, dst, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+int gp_filter_sharpened_bayer_8(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback)
+{
+	GP_CHECK(src->w <= dst->w);
+	GP_CHECK(src->h <= dst->h);
+	return sharpened_bayer_8(src, dst, callback);
+}
+
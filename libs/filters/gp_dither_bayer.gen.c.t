@@ -91,6 +91,19 @@ static int {{ fname }}_to_{{ pt.name }}_raw(const gp_pixmap *src,
 	const int step_{{ c.name }} = UINT16_MAX / {{ c.max }};
 @             end
 
+	/* Thresholds scaled to the channel steps */
+@             for c in pt.chanslist:
+	uint32_t thresholds_{{ c.name }}[{{ bsize }}][{{ bsize }}];
+@             end
+
+	for (y = 0; y < {{ bsize }}; y++) {
+		for (x = 0; x < {{ bsize }}; x++) {
+@             for c in pt.chanslist:
+			thresholds_{{ c.name }}[y][x] = (bayer_{{ bsize }}x{{ bsize }}[y][x] * step_{{ c.name }}) / UINT16_MAX;
+@             end
+		}
+	}
+
 	for (y = 0; y < (gp_coord)src->h; y++) {
 @             if sharpening:
 		/* Shuffle rows */
@@ -139,11 +152,7 @@ static int {{ fname }}_to_{{ pt.name }}_raw(const gp_pixmap *src,
 			gp_pixel res_{{ c.name }} = pix_{{ c.name }} / step_{{ c.name }};
 			gp_pixel rem_{{ c.name }} = pix_{{ c.name }} % step_{{ c.name }};
 
-@                 if bsize == 4:
-			uint32_t thresh_{{ c.name }} = (bayer_4x4[y & 3][x & 3] * step_{{ c.name}}) / UINT16_MAX;
-@                 else:
-			uint32_t thresh_{{ c.name }} = (bayer_8x8[y & 7][x & 7] * step_{{ c.name}}) / UINT16_MAX;
-@                 endif
+			uint32_t thresh_{{ c.name }} = thresholds_{{ c.name }}[y & {{ bsize - 1 }}][x & {{ bsize - 1 }}];
 
 			if (rem_{{ c.name }} > thresh_{{ c.name }} && res_{{ c.name }} < {{ c.max }})
 				res_{{ c.name }}++;
@@ -0,0 +1,3051 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_edge.gen.c
+ *
+ * GENERATED on 2026 10 19 19:42:18 from gp_edge.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Edge detection
+ *
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <math.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include "../../config.h"
+
+#include <core/gp_debug.h>
+#include <core/gp_clamp.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+
+#include <filters/gp_edge_detection.h>
+
+static int edge_RGB101010(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_R[3][3];
+	int win_G[3][3];
+	int win_B[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[0]);
+			win_R[i][0] = GP_PIXEL_GET_R_RGB101010(pix);
+			win_G[i][0] = GP_PIXEL_GET_G_RGB101010(pix);
+			win_B[i][0] = GP_PIXEL_GET_B_RGB101010(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[1]);
+			win_R[i][1] = GP_PIXEL_GET_R_RGB101010(pix);
+			win_G[i][1] = GP_PIXEL_GET_G_RGB101010(pix);
+			win_B[i][1] = GP_PIXEL_GET_B_RGB101010(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[2]);
+			win_R[i][2] = GP_PIXEL_GET_R_RGB101010(pix);
+			win_G[i][2] = GP_PIXEL_GET_G_RGB101010(pix);
+			win_B[i][2] = GP_PIXEL_GET_B_RGB101010(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[0]);
+			win_R[2][0] = GP_PIXEL_GET_R_RGB101010(pix);
+			win_G[2][0] = GP_PIXEL_GET_G_RGB101010(pix);
+			win_B[2][0] = GP_PIXEL_GET_B_RGB101010(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[1]);
+			win_R[2][1] = GP_PIXEL_GET_R_RGB101010(pix);
+			win_G[2][1] = GP_PIXEL_GET_G_RGB101010(pix);
+			win_B[2][1] = GP_PIXEL_GET_B_RGB101010(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[2]);
+			win_R[2][2] = GP_PIXEL_GET_R_RGB101010(pix);
+			win_G[2][2] = GP_PIXEL_GET_G_RGB101010(pix);
+			win_B[2][2] = GP_PIXEL_GET_B_RGB101010(pix);
+
+			int gx_R = win_R[2][0] + cw * win_R[2][1] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[0][1] - win_R[0][2];
+			int gy_R = win_R[0][2] + cw * win_R[1][2] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[1][0] - win_R[2][0];
+			int gx_G = win_G[2][0] + cw * win_G[2][1] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[0][1] - win_G[0][2];
+			int gy_G = win_G[0][2] + cw * win_G[1][2] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[1][0] - win_G[2][0];
+			int gx_B = win_B[2][0] + cw * win_B[2][1] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[0][1] - win_B[0][2];
+			int gy_B = win_B[0][2] + cw * win_B[1][2] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[1][0] - win_B[2][0];
+
+			if (E) {
+				unsigned int E_R = sqrt(gx_R * gx_R + gy_R * gy_R) + 0.5;
+				E_R = GP_CLAMP_DOWN(E_R, 1023);
+				unsigned int E_G = sqrt(gx_G * gx_G + gy_G * gy_G) + 0.5;
+				E_G = GP_CLAMP_DOWN(E_G, 1023);
+				unsigned int E_B = sqrt(gx_B * gx_B + gy_B * gy_B) + 0.5;
+				E_B = GP_CLAMP_DOWN(E_B, 1023);
+
+				gp_putpixel_raw_32BPP(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB101010(E_R, E_G, E_B));
+			}
+
+			if (Phi) {
+				unsigned int Phi_R = 0;
+
+				if (gx_R && gy_R)
+					Phi_R = ((atan2(gx_R, gy_R) + M_PI) * 1023)/(2*M_PI);
+				unsigned int Phi_G = 0;
+
+				if (gx_G && gy_G)
+					Phi_G = ((atan2(gx_G, gy_G) + M_PI) * 1023)/(2*M_PI);
+				unsigned int Phi_B = 0;
+
+				if (gx_B && gy_B)
+					Phi_B = ((atan2(gx_B, gy_B) + M_PI) * 1023)/(2*M_PI);
+
+				gp_putpixel_raw_32BPP(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB101010(Phi_R, Phi_G, Phi_B));
+			}
+
+			win_R[0][0] = win_R[1][0];
+			win_R[1][0] = win_R[2][0];
+			win_R[0][1] = win_R[1][1];
+			win_R[1][1] = win_R[2][1];
+			win_R[0][2] = win_R[1][2];
+			win_R[1][2] = win_R[2][2];
+			win_G[0][0] = win_G[1][0];
+			win_G[1][0] = win_G[2][0];
+			win_G[0][1] = win_G[1][1];
+			win_G[1][1] = win_G[2][1];
+			win_G[0][2] = win_G[1][2];
+			win_G[1][2] = win_G[2][2];
+			win_B[0][0] = win_B[1][0];
+			win_B[1][0] = win_B[2][0];
+			win_B[0][1] = win_B[1][1];
+			win_B[1][1] = win_B[2][1];
+			win_B[0][2] = win_B[1][2];
+			win_B[1][2] = win_B[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_xRGB8888(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_R[3][3];
+	int win_G[3][3];
+	int win_B[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[0]);
+			win_R[i][0] = GP_PIXEL_GET_R_xRGB8888(pix);
+			win_G[i][0] = GP_PIXEL_GET_G_xRGB8888(pix);
+			win_B[i][0] = GP_PIXEL_GET_B_xRGB8888(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[1]);
+			win_R[i][1] = GP_PIXEL_GET_R_xRGB8888(pix);
+			win_G[i][1] = GP_PIXEL_GET_G_xRGB8888(pix);
+			win_B[i][1] = GP_PIXEL_GET_B_xRGB8888(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[2]);
+			win_R[i][2] = GP_PIXEL_GET_R_xRGB8888(pix);
+			win_G[i][2] = GP_PIXEL_GET_G_xRGB8888(pix);
+			win_B[i][2] = GP_PIXEL_GET_B_xRGB8888(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[0]);
+			win_R[2][0] = GP_PIXEL_GET_R_xRGB8888(pix);
+			win_G[2][0] = GP_PIXEL_GET_G_xRGB8888(pix);
+			win_B[2][0] = GP_PIXEL_GET_B_xRGB8888(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[1]);
+			win_R[2][1] = GP_PIXEL_GET_R_xRGB8888(pix);
+			win_G[2][1] = GP_PIXEL_GET_G_xRGB8888(pix);
+			win_B[2][1] = GP_PIXEL_GET_B_xRGB8888(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[2]);
+			win_R[2][2] = GP_PIXEL_GET_R_xRGB8888(pix);
+			win_G[2][2] = GP_PIXEL_GET_G_xRGB8888(pix);
+			win_B[2][2] = GP_PIXEL_GET_B_xRGB8888(pix);
+
+			int gx_R = win_R[2][0] + cw * win_R[2][1] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[0][1] - win_R[0][2];
+			int gy_R = win_R[0][2] + cw * win_R[1][2] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[1][0] - win_R[2][0];
+			int gx_G = win_G[2][0] + cw * win_G[2][1] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[0][1] - win_G[0][2];
+			int gy_G = win_G[0][2] + cw * win_G[1][2] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[1][0] - win_G[2][0];
+			int gx_B = win_B[2][0] + cw * win_B[2][1] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[0][1] - win_B[0][2];
+			int gy_B = win_B[0][2] + cw * win_B[1][2] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[1][0] - win_B[2][0];
+
+			if (E) {
+				unsigned int E_R = sqrt(gx_R * gx_R + gy_R * gy_R) + 0.5;
+				E_R = GP_CLAMP_DOWN(E_R, 255);
+				unsigned int E_G = sqrt(gx_G * gx_G + gy_G * gy_G) + 0.5;
+				E_G = GP_CLAMP_DOWN(E_G, 255);
+				unsigned int E_B = sqrt(gx_B * gx_B + gy_B * gy_B) + 0.5;
+				E_B = GP_CLAMP_DOWN(E_B, 255);
+
+				gp_putpixel_raw_32BPP(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_xRGB8888(E_R, E_G, E_B));
+			}
+
+			if (Phi) {
+				unsigned int Phi_R = 0;
+
+				if (gx_R && gy_R)
+					Phi_R = ((atan2(gx_R, gy_R) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_G = 0;
+
+				if (gx_G && gy_G)
+					Phi_G = ((atan2(gx_G, gy_G) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_B = 0;
+
+				if (gx_B && gy_B)
+					Phi_B = ((atan2(gx_B, gy_B) + M_PI) * 255)/(2*M_PI);
+
+				gp_putpixel_raw_32BPP(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_xRGB8888(Phi_R, Phi_G, Phi_B));
+			}
+
+			win_R[0][0] = win_R[1][0];
+			win_R[1][0] = win_R[2][0];
+			win_R[0][1] = win_R[1][1];
+			win_R[1][1] = win_R[2][1];
+			win_R[0][2] = win_R[1][2];
+			win_R[1][2] = win_R[2][2];
+			win_G[0][0] = win_G[1][0];
+			win_G[1][0] = win_G[2][0];
+			win_G[0][1] = win_G[1][1];
+			win_G[1][1] = win_G[2][1];
+			win_G[0][2] = win_G[1][2];
+			win_G[1][2] = win_G[2][2];
+			win_B[0][0] = win_B[1][0];
+			win_B[1][0] = win_B[2][0];
+			win_B[0][1] = win_B[1][1];
+			win_B[1][1] = win_B[2][1];
+			win_B[0][2] = win_B[1][2];
+			win_B[1][2] = win_B[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_RGBA8888(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_R[3][3];
+	int win_G[3][3];
+	int win_B[3][3];
+	int win_A[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[0]);
+			win_R[i][0] = GP_PIXEL_GET_R_RGBA8888(pix);
+			win_G[i][0] = GP_PIXEL_GET_G_RGBA8888(pix);
+			win_B[i][0] = GP_PIXEL_GET_B_RGBA8888(pix);
+			win_A[i][0] = GP_PIXEL_GET_A_RGBA8888(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[1]);
+			win_R[i][1] = GP_PIXEL_GET_R_RGBA8888(pix);
+			win_G[i][1] = GP_PIXEL_GET_G_RGBA8888(pix);
+			win_B[i][1] = GP_PIXEL_GET_B_RGBA8888(pix);
+			win_A[i][1] = GP_PIXEL_GET_A_RGBA8888(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[2]);
+			win_R[i][2] = GP_PIXEL_GET_R_RGBA8888(pix);
+			win_G[i][2] = GP_PIXEL_GET_G_RGBA8888(pix);
+			win_B[i][2] = GP_PIXEL_GET_B_RGBA8888(pix);
+			win_A[i][2] = GP_PIXEL_GET_A_RGBA8888(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[0]);
+			win_R[2][0] = GP_PIXEL_GET_R_RGBA8888(pix);
+			win_G[2][0] = GP_PIXEL_GET_G_RGBA8888(pix);
+			win_B[2][0] = GP_PIXEL_GET_B_RGBA8888(pix);
+			win_A[2][0] = GP_PIXEL_GET_A_RGBA8888(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[1]);
+			win_R[2][1] = GP_PIXEL_GET_R_RGBA8888(pix);
+			win_G[2][1] = GP_PIXEL_GET_G_RGBA8888(pix);
+			win_B[2][1] = GP_PIXEL_GET_B_RGBA8888(pix);
+			win_A[2][1] = GP_PIXEL_GET_A_RGBA8888(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[2]);
+			win_R[2][2] = GP_PIXEL_GET_R_RGBA8888(pix);
+			win_G[2][2] = GP_PIXEL_GET_G_RGBA8888(pix);
+			win_B[2][2] = GP_PIXEL_GET_B_RGBA8888(pix);
+			win_A[2][2] = GP_PIXEL_GET_A_RGBA8888(pix);
+
+			int gx_R = win_R[2][0] + cw * win_R[2][1] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[0][1] - win_R[0][2];
+			int gy_R = win_R[0][2] + cw * win_R[1][2] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[1][0] - win_R[2][0];
+			int gx_G = win_G[2][0] + cw * win_G[2][1] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[0][1] - win_G[0][2];
+			int gy_G = win_G[0][2] + cw * win_G[1][2] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[1][0] - win_G[2][0];
+			int gx_B = win_B[2][0] + cw * win_B[2][1] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[0][1] - win_B[0][2];
+			int gy_B = win_B[0][2] + cw * win_B[1][2] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[1][0] - win_B[2][0];
+			int gx_A = win_A[2][0] + cw * win_A[2][1] + win_A[2][2] -
+			           win_A[0][0] - cw * win_A[0][1] - win_A[0][2];
+			int gy_A = win_A[0][2] + cw * win_A[1][2] + win_A[2][2] -
+			           win_A[0][0] - cw * win_A[1][0] - win_A[2][0];
+
+			if (E) {
+				unsigned int E_R = sqrt(gx_R * gx_R + gy_R * gy_R) + 0.5;
+				E_R = GP_CLAMP_DOWN(E_R, 255);
+				unsigned int E_G = sqrt(gx_G * gx_G + gy_G * gy_G) + 0.5;
+				E_G = GP_CLAMP_DOWN(E_G, 255);
+				unsigned int E_B = sqrt(gx_B * gx_B + gy_B * gy_B) + 0.5;
+				E_B = GP_CLAMP_DOWN(E_B, 255);
+				unsigned int E_A = sqrt(gx_A * gx_A + gy_A * gy_A) + 0.5;
+				E_A = GP_CLAMP_DOWN(E_A, 255);
+
+				gp_putpixel_raw_32BPP(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGBA8888(E_R, E_G, E_B, E_A));
+			}
+
+			if (Phi) {
+				unsigned int Phi_R = 0;
+
+				if (gx_R && gy_R)
+					Phi_R = ((atan2(gx_R, gy_R) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_G = 0;
+
+				if (gx_G && gy_G)
+					Phi_G = ((atan2(gx_G, gy_G) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_B = 0;
+
+				if (gx_B && gy_B)
+					Phi_B = ((atan2(gx_B, gy_B) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_A = 0;
+
+				if (gx_A && gy_A)
+					Phi_A = ((atan2(gx_A, gy_A) + M_PI) * 255)/(2*M_PI);
+
+				gp_putpixel_raw_32BPP(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGBA8888(Phi_R, Phi_G, Phi_B, Phi_A));
+			}
+
+			win_R[0][0] = win_R[1][0];
+			win_R[1][0] = win_R[2][0];
+			win_R[0][1] = win_R[1][1];
+			win_R[1][1] = win_R[2][1];
+			win_R[0][2] = win_R[1][2];
+			win_R[1][2] = win_R[2][2];
+			win_G[0][0] = win_G[1][0];
+			win_G[1][0] = win_G[2][0];
+			win_G[0][1] = win_G[1][1];
+			win_G[1][1] = win_G[2][1];
+			win_G[0][2] = win_G[1][2];
+			win_G[1][2] = win_G[2][2];
+			win_B[0][0] = win_B[1][0];
+			win_B[1][0] = win_B[2][0];
+			win_B[0][1] = win_B[1][1];
+			win_B[1][1] = win_B[2][1];
+			win_B[0][2] = win_B[1][2];
+			win_B[1][2] = win_B[2][2];
+			win_A[0][0] = win_A[1][0];
+			win_A[1][0] = win_A[2][0];
+			win_A[0][1] = win_A[1][1];
+			win_A[1][1] = win_A[2][1];
+			win_A[0][2] = win_A[1][2];
+			win_A[1][2] = win_A[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_RGB888(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_R[3][3];
+	int win_G[3][3];
+	int win_B[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_24BPP(src, xi, yi[0]);
+			win_R[i][0] = GP_PIXEL_GET_R_RGB888(pix);
+			win_G[i][0] = GP_PIXEL_GET_G_RGB888(pix);
+			win_B[i][0] = GP_PIXEL_GET_B_RGB888(pix);
+			pix = gp_getpixel_raw_24BPP(src, xi, yi[1]);
+			win_R[i][1] = GP_PIXEL_GET_R_RGB888(pix);
+			win_G[i][1] = GP_PIXEL_GET_G_RGB888(pix);
+			win_B[i][1] = GP_PIXEL_GET_B_RGB888(pix);
+			pix = gp_getpixel_raw_24BPP(src, xi, yi[2]);
+			win_R[i][2] = GP_PIXEL_GET_R_RGB888(pix);
+			win_G[i][2] = GP_PIXEL_GET_G_RGB888(pix);
+			win_B[i][2] = GP_PIXEL_GET_B_RGB888(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_24BPP(src, xi, yi[0]);
+			win_R[2][0] = GP_PIXEL_GET_R_RGB888(pix);
+			win_G[2][0] = GP_PIXEL_GET_G_RGB888(pix);
+			win_B[2][0] = GP_PIXEL_GET_B_RGB888(pix);
+			pix = gp_getpixel_raw_24BPP(src, xi, yi[1]);
+			win_R[2][1] = GP_PIXEL_GET_R_RGB888(pix);
+			win_G[2][1] = GP_PIXEL_GET_G_RGB888(pix);
+			win_B[2][1] = GP_PIXEL_GET_B_RGB888(pix);
+			pix = gp_getpixel_raw_24BPP(src, xi, yi[2]);
+			win_R[2][2] = GP_PIXEL_GET_R_RGB888(pix);
+			win_G[2][2] = GP_PIXEL_GET_G_RGB888(pix);
+			win_B[2][2] = GP_PIXEL_GET_B_RGB888(pix);
+
+			int gx_R = win_R[2][0] + cw * win_R[2][1] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[0][1] - win_R[0][2];
+			int gy_R = win_R[0][2] + cw * win_R[1][2] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[1][0] - win_R[2][0];
+			int gx_G = win_G[2][0] + cw * win_G[2][1] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[0][1] - win_G[0][2];
+			int gy_G = win_G[0][2] + cw * win_G[1][2] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[1][0] - win_G[2][0];
+			int gx_B = win_B[2][0] + cw * win_B[2][1] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[0][1] - win_B[0][2];
+			int gy_B = win_B[0][2] + cw * win_B[1][2] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[1][0] - win_B[2][0];
+
+			if (E) {
+				unsigned int E_R = sqrt(gx_R * gx_R + gy_R * gy_R) + 0.5;
+				E_R = GP_CLAMP_DOWN(E_R, 255);
+				unsigned int E_G = sqrt(gx_G * gx_G + gy_G * gy_G) + 0.5;
+				E_G = GP_CLAMP_DOWN(E_G, 255);
+				unsigned int E_B = sqrt(gx_B * gx_B + gy_B * gy_B) + 0.5;
+				E_B = GP_CLAMP_DOWN(E_B, 255);
+
+				gp_putpixel_raw_24BPP(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB888(E_R, E_G, E_B));
+			}
+
+			if (Phi) {
+				unsigned int Phi_R = 0;
+
+				if (gx_R && gy_R)
+					Phi_R = ((atan2(gx_R, gy_R) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_G = 0;
+
+				if (gx_G && gy_G)
+					Phi_G = ((atan2(gx_G, gy_G) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_B = 0;
+
+				if (gx_B && gy_B)
+					Phi_B = ((atan2(gx_B, gy_B) + M_PI) * 255)/(2*M_PI);
+
+				gp_putpixel_raw_24BPP(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB888(Phi_R, Phi_G, Phi_B));
+			}
+
+			win_R[0][0] = win_R[1][0];
+			win_R[1][0] = win_R[2][0];
+			win_R[0][1] = win_R[1][1];
+			win_R[1][1] = win_R[2][1];
+			win_R[0][2] = win_R[1][2];
+			win_R[1][2] = win_R[2][2];
+			win_G[0][0] = win_G[1][0];
+			win_G[1][0] = win_G[2][0];
+			win_G[0][1] = win_G[1][1];
+			win_G[1][1] = win_G[2][1];
+			win_G[0][2] = win_G[1][2];
+			win_G[1][2] = win_G[2][2];
+			win_B[0][0] = win_B[1][0];
+			win_B[1][0] = win_B[2][0];
+			win_B[0][1] = win_B[1][1];
+			win_B[1][1] = win_B[2][1];
+			win_B[0][2] = win_B[1][2];
+			win_B[1][2] = win_B[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_BGR888(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_B[3][3];
+	int win_G[3][3];
+	int win_R[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_24BPP(src, xi, yi[0]);
+			win_B[i][0] = GP_PIXEL_GET_B_BGR888(pix);
+			win_G[i][0] = GP_PIXEL_GET_G_BGR888(pix);
+			win_R[i][0] = GP_PIXEL_GET_R_BGR888(pix);
+			pix = gp_getpixel_raw_24BPP(src, xi, yi[1]);
+			win_B[i][1] = GP_PIXEL_GET_B_BGR888(pix);
+			win_G[i][1] = GP_PIXEL_GET_G_BGR888(pix);
+			win_R[i][1] = GP_PIXEL_GET_R_BGR888(pix);
+			pix = gp_getpixel_raw_24BPP(src, xi, yi[2]);
+			win_B[i][2] = GP_PIXEL_GET_B_BGR888(pix);
+			win_G[i][2] = GP_PIXEL_GET_G_BGR888(pix);
+			win_R[i][2] = GP_PIXEL_GET_R_BGR888(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_24BPP(src, xi, yi[0]);
+			win_B[2][0] = GP_PIXEL_GET_B_BGR888(pix);
+			win_G[2][0] = GP_PIXEL_GET_G_BGR888(pix);
+			win_R[2][0] = GP_PIXEL_GET_R_BGR888(pix);
+			pix = gp_getpixel_raw_24BPP(src, xi, yi[1]);
+			win_B[2][1] = GP_PIXEL_GET_B_BGR888(pix);
+			win_G[2][1] = GP_PIXEL_GET_G_BGR888(pix);
+			win_R[2][1] = GP_PIXEL_GET_R_BGR888(pix);
+			pix = gp_getpixel_raw_24BPP(src, xi, yi[2]);
+			win_B[2][2] = GP_PIXEL_GET_B_BGR888(pix);
+			win_G[2][2] = GP_PIXEL_GET_G_BGR888(pix);
+			win_R[2][2] = GP_PIXEL_GET_R_BGR888(pix);
+
+			int gx_B = win_B[2][0] + cw * win_B[2][1] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[0][1] - win_B[0][2];
+			int gy_B = win_B[0][2] + cw * win_B[1][2] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[1][0] - win_B[2][0];
+			int gx_G = win_G[2][0] + cw * win_G[2][1] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[0][1] - win_G[0][2];
+			int gy_G = win_G[0][2] + cw * win_G[1][2] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[1][0] - win_G[2][0];
+			int gx_R = win_R[2][0] + cw * win_R[2][1] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[0][1] - win_R[0][2];
+			int gy_R = win_R[0][2] + cw * win_R[1][2] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[1][0] - win_R[2][0];
+
+			if (E) {
+				unsigned int E_B = sqrt(gx_B * gx_B + gy_B * gy_B) + 0.5;
+				E_B = GP_CLAMP_DOWN(E_B, 255);
+				unsigned int E_G = sqrt(gx_G * gx_G + gy_G * gy_G) + 0.5;
+				E_G = GP_CLAMP_DOWN(E_G, 255);
+				unsigned int E_R = sqrt(gx_R * gx_R + gy_R * gy_R) + 0.5;
+				E_R = GP_CLAMP_DOWN(E_R, 255);
+
+				gp_putpixel_raw_24BPP(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_BGR888(E_B, E_G, E_R));
+			}
+
+			if (Phi) {
+				unsigned int Phi_B = 0;
+
+				if (gx_B && gy_B)
+					Phi_B = ((atan2(gx_B, gy_B) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_G = 0;
+
+				if (gx_G && gy_G)
+					Phi_G = ((atan2(gx_G, gy_G) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_R = 0;
+
+				if (gx_R && gy_R)
+					Phi_R = ((atan2(gx_R, gy_R) + M_PI) * 255)/(2*M_PI);
+
+				gp_putpixel_raw_24BPP(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_BGR888(Phi_B, Phi_G, Phi_R));
+			}
+
+			win_B[0][0] = win_B[1][0];
+			win_B[1][0] = win_B[2][0];
+			win_B[0][1] = win_B[1][1];
+			win_B[1][1] = win_B[2][1];
+			win_B[0][2] = win_B[1][2];
+			win_B[1][2] = win_B[2][2];
+			win_G[0][0] = win_G[1][0];
+			win_G[1][0] = win_G[2][0];
+			win_G[0][1] = win_G[1][1];
+			win_G[1][1] = win_G[2][1];
+			win_G[0][2] = win_G[1][2];
+			win_G[1][2] = win_G[2][2];
+			win_R[0][0] = win_R[1][0];
+			win_R[1][0] = win_R[2][0];
+			win_R[0][1] = win_R[1][1];
+			win_R[1][1] = win_R[2][1];
+			win_R[0][2] = win_R[1][2];
+			win_R[1][2] = win_R[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_RGB555(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_R[3][3];
+	int win_G[3][3];
+	int win_B[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi[0]);
+			win_R[i][0] = GP_PIXEL_GET_R_RGB555(pix);
+			win_G[i][0] = GP_PIXEL_GET_G_RGB555(pix);
+			win_B[i][0] = GP_PIXEL_GET_B_RGB555(pix);
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi[1]);
+			win_R[i][1] = GP_PIXEL_GET_R_RGB555(pix);
+			win_G[i][1] = GP_PIXEL_GET_G_RGB555(pix);
+			win_B[i][1] = GP_PIXEL_GET_B_RGB555(pix);
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi[2]);
+			win_R[i][2] = GP_PIXEL_GET_R_RGB555(pix);
+			win_G[i][2] = GP_PIXEL_GET_G_RGB555(pix);
+			win_B[i][2] = GP_PIXEL_GET_B_RGB555(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi[0]);
+			win_R[2][0] = GP_PIXEL_GET_R_RGB555(pix);
+			win_G[2][0] = GP_PIXEL_GET_G_RGB555(pix);
+			win_B[2][0] = GP_PIXEL_GET_B_RGB555(pix);
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi[1]);
+			win_R[2][1] = GP_PIXEL_GET_R_RGB555(pix);
+			win_G[2][1] = GP_PIXEL_GET_G_RGB555(pix);
+			win_B[2][1] = GP_PIXEL_GET_B_RGB555(pix);
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi[2]);
+			win_R[2][2] = GP_PIXEL_GET_R_RGB555(pix);
+			win_G[2][2] = GP_PIXEL_GET_G_RGB555(pix);
+			win_B[2][2] = GP_PIXEL_GET_B_RGB555(pix);
+
+			int gx_R = win_R[2][0] + cw * win_R[2][1] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[0][1] - win_R[0][2];
+			int gy_R = win_R[0][2] + cw * win_R[1][2] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[1][0] - win_R[2][0];
+			int gx_G = win_G[2][0] + cw * win_G[2][1] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[0][1] - win_G[0][2];
+			int gy_G = win_G[0][2] + cw * win_G[1][2] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[1][0] - win_G[2][0];
+			int gx_B = win_B[2][0] + cw * win_B[2][1] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[0][1] - win_B[0][2];
+			int gy_B = win_B[0][2] + cw * win_B[1][2] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[1][0] - win_B[2][0];
+
+			if (E) {
+				unsigned int E_R = sqrt(gx_R * gx_R + gy_R * gy_R) + 0.5;
+				E_R = GP_CLAMP_DOWN(E_R, 31);
+				unsigned int E_G = sqrt(gx_G * gx_G + gy_G * gy_G) + 0.5;
+				E_G = GP_CLAMP_DOWN(E_G, 31);
+				unsigned int E_B = sqrt(gx_B * gx_B + gy_B * gy_B) + 0.5;
+				E_B = GP_CLAMP_DOWN(E_B, 31);
+
+				gp_putpixel_raw_16BPP_BE(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB555(E_R, E_G, E_B));
+			}
+
+			if (Phi) {
+				unsigned int Phi_R = 0;
+
+				if (gx_R && gy_R)
+					Phi_R = ((atan2(gx_R, gy_R) + M_PI) * 31)/(2*M_PI);
+				unsigned int Phi_G = 0;
+
+				if (gx_G && gy_G)
+					Phi_G = ((atan2(gx_G, gy_G) + M_PI) * 31)/(2*M_PI);
+				unsigned int Phi_B = 0;
+
+				if (gx_B && gy_B)
+					Phi_B = ((atan2(gx_B, gy_B) + M_PI) * 31)/(2*M_PI);
+
+				gp_putpixel_raw_16BPP_BE(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB555(Phi_R, Phi_G, Phi_B));
+			}
+
+			win_R[0][0] = win_R[1][0];
+			win_R[1][0] = win_R[2][0];
+			win_R[0][1] = win_R[1][1];
+			win_R[1][1] = win_R[2][1];
+			win_R[0][2] = win_R[1][2];
+			win_R[1][2] = win_R[2][2];
+			win_G[0][0] = win_G[1][0];
+			win_G[1][0] = win_G[2][0];
+			win_G[0][1] = win_G[1][1];
+			win_G[1][1] = win_G[2][1];
+			win_G[0][2] = win_G[1][2];
+			win_G[1][2] = win_G[2][2];
+			win_B[0][0] = win_B[1][0];
+			win_B[1][0] = win_B[2][0];
+			win_B[0][1] = win_B[1][1];
+			win_B[1][1] = win_B[2][1];
+			win_B[0][2] = win_B[1][2];
+			win_B[1][2] = win_B[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_RGB565_BE(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_R[3][3];
+	int win_G[3][3];
+	int win_B[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi[0]);
+			win_R[i][0] = GP_PIXEL_GET_R_RGB565_BE(pix);
+			win_G[i][0] = GP_PIXEL_GET_G_RGB565_BE(pix);
+			win_B[i][0] = GP_PIXEL_GET_B_RGB565_BE(pix);
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi[1]);
+			win_R[i][1] = GP_PIXEL_GET_R_RGB565_BE(pix);
+			win_G[i][1] = GP_PIXEL_GET_G_RGB565_BE(pix);
+			win_B[i][1] = GP_PIXEL_GET_B_RGB565_BE(pix);
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi[2]);
+			win_R[i][2] = GP_PIXEL_GET_R_RGB565_BE(pix);
+			win_G[i][2] = GP_PIXEL_GET_G_RGB565_BE(pix);
+			win_B[i][2] = GP_PIXEL_GET_B_RGB565_BE(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi[0]);
+			win_R[2][0] = GP_PIXEL_GET_R_RGB565_BE(pix);
+			win_G[2][0] = GP_PIXEL_GET_G_RGB565_BE(pix);
+			win_B[2][0] = GP_PIXEL_GET_B_RGB565_BE(pix);
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi[1]);
+			win_R[2][1] = GP_PIXEL_GET_R_RGB565_BE(pix);
+			win_G[2][1] = GP_PIXEL_GET_G_RGB565_BE(pix);
+			win_B[2][1] = GP_PIXEL_GET_B_RGB565_BE(pix);
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi[2]);
+			win_R[2][2] = GP_PIXEL_GET_R_RGB565_BE(pix);
+			win_G[2][2] = GP_PIXEL_GET_G_RGB565_BE(pix);
+			win_B[2][2] = GP_PIXEL_GET_B_RGB565_BE(pix);
+
+			int gx_R = win_R[2][0] + cw * win_R[2][1] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[0][1] - win_R[0][2];
+			int gy_R = win_R[0][2] + cw * win_R[1][2] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[1][0] - win_R[2][0];
+			int gx_G = win_G[2][0] + cw * win_G[2][1] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[0][1] - win_G[0][2];
+			int gy_G = win_G[0][2] + cw * win_G[1][2] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[1][0] - win_G[2][0];
+			int gx_B = win_B[2][0] + cw * win_B[2][1] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[0][1] - win_B[0][2];
+			int gy_B = win_B[0][2] + cw * win_B[1][2] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[1][0] - win_B[2][0];
+
+			if (E) {
+				unsigned int E_R = sqrt(gx_R * gx_R + gy_R * gy_R) + 0.5;
+				E_R = GP_CLAMP_DOWN(E_R, 31);
+				unsigned int E_G = sqrt(gx_G * gx_G + gy_G * gy_G) + 0.5;
+				E_G = GP_CLAMP_DOWN(E_G, 63);
+				unsigned int E_B = sqrt(gx_B * gx_B + gy_B * gy_B) + 0.5;
+				E_B = GP_CLAMP_DOWN(E_B, 31);
+
+				gp_putpixel_raw_16BPP_BE(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB565_BE(E_R, E_G, E_B));
+			}
+
+			if (Phi) {
+				unsigned int Phi_R = 0;
+
+				if (gx_R && gy_R)
+					Phi_R = ((atan2(gx_R, gy_R) + M_PI) * 31)/(2*M_PI);
+				unsigned int Phi_G = 0;
+
+				if (gx_G && gy_G)
+					Phi_G = ((atan2(gx_G, gy_G) + M_PI) * 63)/(2*M_PI);
+				unsigned int Phi_B = 0;
+
+				if (gx_B && gy_B)
+					Phi_B = ((atan2(gx_B, gy_B) + M_PI) * 31)/(2*M_PI);
+
+				gp_putpixel_raw_16BPP_BE(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB565_BE(Phi_R, Phi_G, Phi_B));
+			}
+
+			win_R[0][0] = win_R[1][0];
+			win_R[1][0] = win_R[2][0];
+			win_R[0][1] = win_R[1][1];
+			win_R[1][1] = win_R[2][1];
+			win_R[0][2] = win_R[1][2];
+			win_R[1][2] = win_R[2][2];
+			win_G[0][0] = win_G[1][0];
+			win_G[1][0] = win_G[2][0];
+			win_G[0][1] = win_G[1][1];
+			win_G[1][1] = win_G[2][1];
+			win_G[0][2] = win_G[1][2];
+			win_G[1][2] = win_G[2][2];
+			win_B[0][0] = win_B[1][0];
+			win_B[1][0] = win_B[2][0];
+			win_B[0][1] = win_B[1][1];
+			win_B[1][1] = win_B[2][1];
+			win_B[0][2] = win_B[1][2];
+			win_B[1][2] = win_B[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_RGB565_LE(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_R[3][3];
+	int win_G[3][3];
+	int win_B[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[0]);
+			win_R[i][0] = GP_PIXEL_GET_R_RGB565_LE(pix);
+			win_G[i][0] = GP_PIXEL_GET_G_RGB565_LE(pix);
+			win_B[i][0] = GP_PIXEL_GET_B_RGB565_LE(pix);
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[1]);
+			win_R[i][1] = GP_PIXEL_GET_R_RGB565_LE(pix);
+			win_G[i][1] = GP_PIXEL_GET_G_RGB565_LE(pix);
+			win_B[i][1] = GP_PIXEL_GET_B_RGB565_LE(pix);
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[2]);
+			win_R[i][2] = GP_PIXEL_GET_R_RGB565_LE(pix);
+			win_G[i][2] = GP_PIXEL_GET_G_RGB565_LE(pix);
+			win_B[i][2] = GP_PIXEL_GET_B_RGB565_LE(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[0]);
+			win_R[2][0] = GP_PIXEL_GET_R_RGB565_LE(pix);
+			win_G[2][0] = GP_PIXEL_GET_G_RGB565_LE(pix);
+			win_B[2][0] = GP_PIXEL_GET_B_RGB565_LE(pix);
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[1]);
+			win_R[2][1] = GP_PIXEL_GET_R_RGB565_LE(pix);
+			win_G[2][1] = GP_PIXEL_GET_G_RGB565_LE(pix);
+			win_B[2][1] = GP_PIXEL_GET_B_RGB565_LE(pix);
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[2]);
+			win_R[2][2] = GP_PIXEL_GET_R_RGB565_LE(pix);
+			win_G[2][2] = GP_PIXEL_GET_G_RGB565_LE(pix);
+			win_B[2][2] = GP_PIXEL_GET_B_RGB565_LE(pix);
+
+			int gx_R = win_R[2][0] + cw * win_R[2][1] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[0][1] - win_R[0][2];
+			int gy_R = win_R[0][2] + cw * win_R[1][2] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[1][0] - win_R[2][0];
+			int gx_G = win_G[2][0] + cw * win_G[2][1] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[0][1] - win_G[0][2];
+			int gy_G = win_G[0][2] + cw * win_G[1][2] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[1][0] - win_G[2][0];
+			int gx_B = win_B[2][0] + cw * win_B[2][1] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[0][1] - win_B[0][2];
+			int gy_B = win_B[0][2] + cw * win_B[1][2] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[1][0] - win_B[2][0];
+
+			if (E) {
+				unsigned int E_R = sqrt(gx_R * gx_R + gy_R * gy_R) + 0.5;
+				E_R = GP_CLAMP_DOWN(E_R, 31);
+				unsigned int E_G = sqrt(gx_G * gx_G + gy_G * gy_G) + 0.5;
+				E_G = GP_CLAMP_DOWN(E_G, 63);
+				unsigned int E_B = sqrt(gx_B * gx_B + gy_B * gy_B) + 0.5;
+				E_B = GP_CLAMP_DOWN(E_B, 31);
+
+				gp_putpixel_raw_16BPP_LE(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB565_LE(E_R, E_G, E_B));
+			}
+
+			if (Phi) {
+				unsigned int Phi_R = 0;
+
+				if (gx_R && gy_R)
+					Phi_R = ((atan2(gx_R, gy_R) + M_PI) * 31)/(2*M_PI);
+				unsigned int Phi_G = 0;
+
+				if (gx_G && gy_G)
+					Phi_G = ((atan2(gx_G, gy_G) + M_PI) * 63)/(2*M_PI);
+				unsigned int Phi_B = 0;
+
+				if (gx_B && gy_B)
+					Phi_B = ((atan2(gx_B, gy_B) + M_PI) * 31)/(2*M_PI);
+
+				gp_putpixel_raw_16BPP_LE(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB565_LE(Phi_R, Phi_G, Phi_B));
+			}
+
+			win_R[0][0] = win_R[1][0];
+			win_R[1][0] = win_R[2][0];
+			win_R[0][1] = win_R[1][1];
+			win_R[1][1] = win_R[2][1];
+			win_R[0][2] = win_R[1][2];
+			win_R[1][2] = win_R[2][2];
+			win_G[0][0] = win_G[1][0];
+			win_G[1][0] = win_G[2][0];
+			win_G[0][1] = win_G[1][1];
+			win_G[1][1] = win_G[2][1];
+			win_G[0][2] = win_G[1][2];
+			win_G[1][2] = win_G[2][2];
+			win_B[0][0] = win_B[1][0];
+			win_B[1][0] = win_B[2][0];
+			win_B[0][1] = win_B[1][1];
+			win_B[1][1] = win_B[2][1];
+			win_B[0][2] = win_B[1][2];
+			win_B[1][2] = win_B[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_RGB666(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_R[3][3];
+	int win_G[3][3];
+	int win_B[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_18BPP_DB(src, xi, yi[0]);
+			win_R[i][0] = GP_PIXEL_GET_R_RGB666(pix);
+			win_G[i][0] = GP_PIXEL_GET_G_RGB666(pix);
+			win_B[i][0] = GP_PIXEL_GET_B_RGB666(pix);
+			pix = gp_getpixel_raw_18BPP_DB(src, xi, yi[1]);
+			win_R[i][1] = GP_PIXEL_GET_R_RGB666(pix);
+			win_G[i][1] = GP_PIXEL_GET_G_RGB666(pix);
+			win_B[i][1] = GP_PIXEL_GET_B_RGB666(pix);
+			pix = gp_getpixel_raw_18BPP_DB(src, xi, yi[2]);
+			win_R[i][2] = GP_PIXEL_GET_R_RGB666(pix);
+			win_G[i][2] = GP_PIXEL_GET_G_RGB666(pix);
+			win_B[i][2] = GP_PIXEL_GET_B_RGB666(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_18BPP_DB(src, xi, yi[0]);
+			win_R[2][0] = GP_PIXEL_GET_R_RGB666(pix);
+			win_G[2][0] = GP_PIXEL_GET_G_RGB666(pix);
+			win_B[2][0] = GP_PIXEL_GET_B_RGB666(pix);
+			pix = gp_getpixel_raw_18BPP_DB(src, xi, yi[1]);
+			win_R[2][1] = GP_PIXEL_GET_R_RGB666(pix);
+			win_G[2][1] = GP_PIXEL_GET_G_RGB666(pix);
+			win_B[2][1] = GP_PIXEL_GET_B_RGB666(pix);
+			pix = gp_getpixel_raw_18BPP_DB(src, xi, yi[2]);
+			win_R[2][2] = GP_PIXEL_GET_R_RGB666(pix);
+			win_G[2][2] = GP_PIXEL_GET_G_RGB666(pix);
+			win_B[2][2] = GP_PIXEL_GET_B_RGB666(pix);
+
+			int gx_R = win_R[2][0] + cw * win_R[2][1] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[0][1] - win_R[0][2];
+			int gy_R = win_R[0][2] + cw * win_R[1][2] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[1][0] - win_R[2][0];
+			int gx_G = win_G[2][0] + cw * win_G[2][1] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[0][1] - win_G[0][2];
+			int gy_G = win_G[0][2] + cw * win_G[1][2] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[1][0] - win_G[2][0];
+			int gx_B = win_B[2][0] + cw * win_B[2][1] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[0][1] - win_B[0][2];
+			int gy_B = win_B[0][2] + cw * win_B[1][2] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[1][0] - win_B[2][0];
+
+			if (E) {
+				unsigned int E_R = sqrt(gx_R * gx_R + gy_R * gy_R) + 0.5;
+				E_R = GP_CLAMP_DOWN(E_R, 63);
+				unsigned int E_G = sqrt(gx_G * gx_G + gy_G * gy_G) + 0.5;
+				E_G = GP_CLAMP_DOWN(E_G, 63);
+				unsigned int E_B = sqrt(gx_B * gx_B + gy_B * gy_B) + 0.5;
+				E_B = GP_CLAMP_DOWN(E_B, 63);
+
+				gp_putpixel_raw_18BPP_DB(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB666(E_R, E_G, E_B));
+			}
+
+			if (Phi) {
+				unsigned int Phi_R = 0;
+
+				if (gx_R && gy_R)
+					Phi_R = ((atan2(gx_R, gy_R) + M_PI) * 63)/(2*M_PI);
+				unsigned int Phi_G = 0;
+
+				if (gx_G && gy_G)
+					Phi_G = ((atan2(gx_G, gy_G) + M_PI) * 63)/(2*M_PI);
+				unsigned int Phi_B = 0;
+
+				if (gx_B && gy_B)
+					Phi_B = ((atan2(gx_B, gy_B) + M_PI) * 63)/(2*M_PI);
+
+				gp_putpixel_raw_18BPP_DB(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB666(Phi_R, Phi_G, Phi_B));
+			}
+
+			win_R[0][0] = win_R[1][0];
+			win_R[1][0] = win_R[2][0];
+			win_R[0][1] = win_R[1][1];
+			win_R[1][1] = win_R[2][1];
+			win_R[0][2] = win_R[1][2];
+			win_R[1][2] = win_R[2][2];
+			win_G[0][0] = win_G[1][0];
+			win_G[1][0] = win_G[2][0];
+			win_G[0][1] = win_G[1][1];
+			win_G[1][1] = win_G[2][1];
+			win_G[0][2] = win_G[1][2];
+			win_G[1][2] = win_G[2][2];
+			win_B[0][0] = win_B[1][0];
+			win_B[1][0] = win_B[2][0];
+			win_B[0][1] = win_B[1][1];
+			win_B[1][1] = win_B[2][1];
+			win_B[0][2] = win_B[1][2];
+			win_B[1][2] = win_B[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_RGB332(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_R[3][3];
+	int win_G[3][3];
+	int win_B[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[0]);
+			win_R[i][0] = GP_PIXEL_GET_R_RGB332(pix);
+			win_G[i][0] = GP_PIXEL_GET_G_RGB332(pix);
+			win_B[i][0] = GP_PIXEL_GET_B_RGB332(pix);
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[1]);
+			win_R[i][1] = GP_PIXEL_GET_R_RGB332(pix);
+			win_G[i][1] = GP_PIXEL_GET_G_RGB332(pix);
+			win_B[i][1] = GP_PIXEL_GET_B_RGB332(pix);
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[2]);
+			win_R[i][2] = GP_PIXEL_GET_R_RGB332(pix);
+			win_G[i][2] = GP_PIXEL_GET_G_RGB332(pix);
+			win_B[i][2] = GP_PIXEL_GET_B_RGB332(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[0]);
+			win_R[2][0] = GP_PIXEL_GET_R_RGB332(pix);
+			win_G[2][0] = GP_PIXEL_GET_G_RGB332(pix);
+			win_B[2][0] = GP_PIXEL_GET_B_RGB332(pix);
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[1]);
+			win_R[2][1] = GP_PIXEL_GET_R_RGB332(pix);
+			win_G[2][1] = GP_PIXEL_GET_G_RGB332(pix);
+			win_B[2][1] = GP_PIXEL_GET_B_RGB332(pix);
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[2]);
+			win_R[2][2] = GP_PIXEL_GET_R_RGB332(pix);
+			win_G[2][2] = GP_PIXEL_GET_G_RGB332(pix);
+			win_B[2][2] = GP_PIXEL_GET_B_RGB332(pix);
+
+			int gx_R = win_R[2][0] + cw * win_R[2][1] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[0][1] - win_R[0][2];
+			int gy_R = win_R[0][2] + cw * win_R[1][2] + win_R[2][2] -
+			           win_R[0][0] - cw * win_R[1][0] - win_R[2][0];
+			int gx_G = win_G[2][0] + cw * win_G[2][1] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[0][1] - win_G[0][2];
+			int gy_G = win_G[0][2] + cw * win_G[1][2] + win_G[2][2] -
+			           win_G[0][0] - cw * win_G[1][0] - win_G[2][0];
+			int gx_B = win_B[2][0] + cw * win_B[2][1] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[0][1] - win_B[0][2];
+			int gy_B = win_B[0][2] + cw * win_B[1][2] + win_B[2][2] -
+			           win_B[0][0] - cw * win_B[1][0] - win_B[2][0];
+
+			if (E) {
+				unsigned int E_R = sqrt(gx_R * gx_R + gy_R * gy_R) + 0.5;
+				E_R = GP_CLAMP_DOWN(E_R, 7);
+				unsigned int E_G = sqrt(gx_G * gx_G + gy_G * gy_G) + 0.5;
+				E_G = GP_CLAMP_DOWN(E_G, 7);
+				unsigned int E_B = sqrt(gx_B * gx_B + gy_B * gy_B) + 0.5;
+				E_B = GP_CLAMP_DOWN(E_B, 3);
+
+				gp_putpixel_raw_8BPP(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB332(E_R, E_G, E_B));
+			}
+
+			if (Phi) {
+				unsigned int Phi_R = 0;
+
+				if (gx_R && gy_R)
+					Phi_R = ((atan2(gx_R, gy_R) + M_PI) * 7)/(2*M_PI);
+				unsigned int Phi_G = 0;
+
+				if (gx_G && gy_G)
+					Phi_G = ((atan2(gx_G, gy_G) + M_PI) * 7)/(2*M_PI);
+				unsigned int Phi_B = 0;
+
+				if (gx_B && gy_B)
+					Phi_B = ((atan2(gx_B, gy_B) + M_PI) * 3)/(2*M_PI);
+
+				gp_putpixel_raw_8BPP(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_RGB332(Phi_R, Phi_G, Phi_B));
+			}
+
+			win_R[0][0] = win_R[1][0];
+			win_R[1][0] = win_R[2][0];
+			win_R[0][1] = win_R[1][1];
+			win_R[1][1] = win_R[2][1];
+			win_R[0][2] = win_R[1][2];
+			win_R[1][2] = win_R[2][2];
+			win_G[0][0] = win_G[1][0];
+			win_G[1][0] = win_G[2][0];
+			win_G[0][1] = win_G[1][1];
+			win_G[1][1] = win_G[2][1];
+			win_G[0][2] = win_G[1][2];
+			win_G[1][2] = win_G[2][2];
+			win_B[0][0] = win_B[1][0];
+			win_B[1][0] = win_B[2][0];
+			win_B[0][1] = win_B[1][1];
+			win_B[1][1] = win_B[2][1];
+			win_B[0][2] = win_B[1][2];
+			win_B[1][2] = win_B[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_CMYK8888(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_K[3][3];
+	int win_Y[3][3];
+	int win_M[3][3];
+	int win_C[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[0]);
+			win_K[i][0] = GP_PIXEL_GET_K_CMYK8888(pix);
+			win_Y[i][0] = GP_PIXEL_GET_Y_CMYK8888(pix);
+			win_M[i][0] = GP_PIXEL_GET_M_CMYK8888(pix);
+			win_C[i][0] = GP_PIXEL_GET_C_CMYK8888(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[1]);
+			win_K[i][1] = GP_PIXEL_GET_K_CMYK8888(pix);
+			win_Y[i][1] = GP_PIXEL_GET_Y_CMYK8888(pix);
+			win_M[i][1] = GP_PIXEL_GET_M_CMYK8888(pix);
+			win_C[i][1] = GP_PIXEL_GET_C_CMYK8888(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[2]);
+			win_K[i][2] = GP_PIXEL_GET_K_CMYK8888(pix);
+			win_Y[i][2] = GP_PIXEL_GET_Y_CMYK8888(pix);
+			win_M[i][2] = GP_PIXEL_GET_M_CMYK8888(pix);
+			win_C[i][2] = GP_PIXEL_GET_C_CMYK8888(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[0]);
+			win_K[2][0] = GP_PIXEL_GET_K_CMYK8888(pix);
+			win_Y[2][0] = GP_PIXEL_GET_Y_CMYK8888(pix);
+			win_M[2][0] = GP_PIXEL_GET_M_CMYK8888(pix);
+			win_C[2][0] = GP_PIXEL_GET_C_CMYK8888(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[1]);
+			win_K[2][1] = GP_PIXEL_GET_K_CMYK8888(pix);
+			win_Y[2][1] = GP_PIXEL_GET_Y_CMYK8888(pix);
+			win_M[2][1] = GP_PIXEL_GET_M_CMYK8888(pix);
+			win_C[2][1] = GP_PIXEL_GET_C_CMYK8888(pix);
+			pix = gp_getpixel_raw_32BPP(src, xi, yi[2]);
+			win_K[2][2] = GP_PIXEL_GET_K_CMYK8888(pix);
+			win_Y[2][2] = GP_PIXEL_GET_Y_CMYK8888(pix);
+			win_M[2][2] = GP_PIXEL_GET_M_CMYK8888(pix);
+			win_C[2][2] = GP_PIXEL_GET_C_CMYK8888(pix);
+
+			int gx_K = win_K[2][0] + cw * win_K[2][1] + win_K[2][2] -
+			           win_K[0][0] - cw * win_K[0][1] - win_K[0][2];
+			int gy_K = win_K[0][2] + cw * win_K[1][2] + win_K[2][2] -
+			           win_K[0][0] - cw * win_K[1][0] - win_K[2][0];
+			int gx_Y = win_Y[2][0] + cw * win_Y[2][1] + win_Y[2][2] -
+			           win_Y[0][0] - cw * win_Y[0][1] - win_Y[0][2];
+			int gy_Y = win_Y[0][2] + cw * win_Y[1][2] + win_Y[2][2] -
+			           win_Y[0][0] - cw * win_Y[1][0] - win_Y[2][0];
+			int gx_M = win_M[2][0] + cw * win_M[2][1] + win_M[2][2] -
+			           win_M[0][0] - cw * win_M[0][1] - win_M[0][2];
+			int gy_M = win_M[0][2] + cw * win_M[1][2] + win_M[2][2] -
+			           win_M[0][0] - cw * win_M[1][0] - win_M[2][0];
+			int gx_C = win_C[2][0] + cw * win_C[2][1] + win_C[2][2] -
+			           win_C[0][0] - cw * win_C[0][1] - win_C[0][2];
+			int gy_C = win_C[0][2] + cw * win_C[1][2] + win_C[2][2] -
+			           win_C[0][0] - cw * win_C[1][0] - win_C[2][0];
+
+			if (E) {
+				unsigned int E_K = sqrt(gx_K * gx_K + gy_K * gy_K) + 0.5;
+				E_K = GP_CLAMP_DOWN(E_K, 255);
+				unsigned int E_Y = sqrt(gx_Y * gx_Y + gy_Y * gy_Y) + 0.5;
+				E_Y = GP_CLAMP_DOWN(E_Y, 255);
+				unsigned int E_M = sqrt(gx_M * gx_M + gy_M * gy_M) + 0.5;
+				E_M = GP_CLAMP_DOWN(E_M, 255);
+				unsigned int E_C = sqrt(gx_C * gx_C + gy_C * gy_C) + 0.5;
+				E_C = GP_CLAMP_DOWN(E_C, 255);
+
+				gp_putpixel_raw_32BPP(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_CMYK8888(E_K, E_Y, E_M, E_C));
+			}
+
+			if (Phi) {
+				unsigned int Phi_K = 0;
+
+				if (gx_K && gy_K)
+					Phi_K = ((atan2(gx_K, gy_K) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_Y = 0;
+
+				if (gx_Y && gy_Y)
+					Phi_Y = ((atan2(gx_Y, gy_Y) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_M = 0;
+
+				if (gx_M && gy_M)
+					Phi_M = ((atan2(gx_M, gy_M) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_C = 0;
+
+				if (gx_C && gy_C)
+					Phi_C = ((atan2(gx_C, gy_C) + M_PI) * 255)/(2*M_PI);
+
+				gp_putpixel_raw_32BPP(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_CMYK8888(Phi_K, Phi_Y, Phi_M, Phi_C));
+			}
+
+			win_K[0][0] = win_K[1][0];
+			win_K[1][0] = win_K[2][0];
+			win_K[0][1] = win_K[1][1];
+			win_K[1][1] = win_K[2][1];
+			win_K[0][2] = win_K[1][2];
+			win_K[1][2] = win_K[2][2];
+			win_Y[0][0] = win_Y[1][0];
+			win_Y[1][0] = win_Y[2][0];
+			win_Y[0][1] = win_Y[1][1];
+			win_Y[1][1] = win_Y[2][1];
+			win_Y[0][2] = win_Y[1][2];
+			win_Y[1][2] = win_Y[2][2];
+			win_M[0][0] = win_M[1][0];
+			win_M[1][0] = win_M[2][0];
+			win_M[0][1] = win_M[1][1];
+			win_M[1][1] = win_M[2][1];
+			win_M[0][2] = win_M[1][2];
+			win_M[1][2] = win_M[2][2];
+			win_C[0][0] = win_C[1][0];
+			win_C[1][0] = win_C[2][0];
+			win_C[0][1] = win_C[1][1];
+			win_C[1][1] = win_C[2][1];
+			win_C[0][2] = win_C[1][2];
+			win_C[1][2] = win_C[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_G1_DB(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_V[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_1BPP_DB(src, xi, yi[0]);
+			win_V[i][0] = GP_PIXEL_GET_V_G1_DB(pix);
+			pix = gp_getpixel_raw_1BPP_DB(src, xi, yi[1]);
+			win_V[i][1] = GP_PIXEL_GET_V_G1_DB(pix);
+			pix = gp_getpixel_raw_1BPP_DB(src, xi, yi[2]);
+			win_V[i][2] = GP_PIXEL_GET_V_G1_DB(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_1BPP_DB(src, xi, yi[0]);
+			win_V[2][0] = GP_PIXEL_GET_V_G1_DB(pix);
+			pix = gp_getpixel_raw_1BPP_DB(src, xi, yi[1]);
+			win_V[2][1] = GP_PIXEL_GET_V_G1_DB(pix);
+			pix = gp_getpixel_raw_1BPP_DB(src, xi, yi[2]);
+			win_V[2][2] = GP_PIXEL_GET_V_G1_DB(pix);
+
+			int gx_V = win_V[2][0] + cw * win_V[2][1] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[0][1] - win_V[0][2];
+			int gy_V = win_V[0][2] + cw * win_V[1][2] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[1][0] - win_V[2][0];
+
+			if (E) {
+				unsigned int E_V = sqrt(gx_V * gx_V + gy_V * gy_V) + 0.5;
+				E_V = GP_CLAMP_DOWN(E_V, 1);
+
+				gp_putpixel_raw_1BPP_DB(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G1_DB(E_V));
+			}
+
+			if (Phi) {
+				unsigned int Phi_V = 0;
+
+				if (gx_V && gy_V)
+					Phi_V = ((atan2(gx_V, gy_V) + M_PI) * 1)/(2*M_PI);
+
+				gp_putpixel_raw_1BPP_DB(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G1_DB(Phi_V));
+			}
+
+			win_V[0][0] = win_V[1][0];
+			win_V[1][0] = win_V[2][0];
+			win_V[0][1] = win_V[1][1];
+			win_V[1][1] = win_V[2][1];
+			win_V[0][2] = win_V[1][2];
+			win_V[1][2] = win_V[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_G2_DB(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_V[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_2BPP_DB(src, xi, yi[0]);
+			win_V[i][0] = GP_PIXEL_GET_V_G2_DB(pix);
+			pix = gp_getpixel_raw_2BPP_DB(src, xi, yi[1]);
+			win_V[i][1] = GP_PIXEL_GET_V_G2_DB(pix);
+			pix = gp_getpixel_raw_2BPP_DB(src, xi, yi[2]);
+			win_V[i][2] = GP_PIXEL_GET_V_G2_DB(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_2BPP_DB(src, xi, yi[0]);
+			win_V[2][0] = GP_PIXEL_GET_V_G2_DB(pix);
+			pix = gp_getpixel_raw_2BPP_DB(src, xi, yi[1]);
+			win_V[2][1] = GP_PIXEL_GET_V_G2_DB(pix);
+			pix = gp_getpixel_raw_2BPP_DB(src, xi, yi[2]);
+			win_V[2][2] = GP_PIXEL_GET_V_G2_DB(pix);
+
+			int gx_V = win_V[2][0] + cw * win_V[2][1] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[0][1] - win_V[0][2];
+			int gy_V = win_V[0][2] + cw * win_V[1][2] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[1][0] - win_V[2][0];
+
+			if (E) {
+				unsigned int E_V = sqrt(gx_V * gx_V + gy_V * gy_V) + 0.5;
+				E_V = GP_CLAMP_DOWN(E_V, 3);
+
+				gp_putpixel_raw_2BPP_DB(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G2_DB(E_V));
+			}
+
+			if (Phi) {
+				unsigned int Phi_V = 0;
+
+				if (gx_V && gy_V)
+					Phi_V = ((atan2(gx_V, gy_V) + M_PI) * 3)/(2*M_PI);
+
+				gp_putpixel_raw_2BPP_DB(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G2_DB(Phi_V));
+			}
+
+			win_V[0][0] = win_V[1][0];
+			win_V[1][0] = win_V[2][0];
+			win_V[0][1] = win_V[1][1];
+			win_V[1][1] = win_V[2][1];
+			win_V[0][2] = win_V[1][2];
+			win_V[1][2] = win_V[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_G4_DB(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_V[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_4BPP_DB(src, xi, yi[0]);
+			win_V[i][0] = GP_PIXEL_GET_V_G4_DB(pix);
+			pix = gp_getpixel_raw_4BPP_DB(src, xi, yi[1]);
+			win_V[i][1] = GP_PIXEL_GET_V_G4_DB(pix);
+			pix = gp_getpixel_raw_4BPP_DB(src, xi, yi[2]);
+			win_V[i][2] = GP_PIXEL_GET_V_G4_DB(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_4BPP_DB(src, xi, yi[0]);
+			win_V[2][0] = GP_PIXEL_GET_V_G4_DB(pix);
+			pix = gp_getpixel_raw_4BPP_DB(src, xi, yi[1]);
+			win_V[2][1] = GP_PIXEL_GET_V_G4_DB(pix);
+			pix = gp_getpixel_raw_4BPP_DB(src, xi, yi[2]);
+			win_V[2][2] = GP_PIXEL_GET_V_G4_DB(pix);
+
+			int gx_V = win_V[2][0] + cw * win_V[2][1] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[0][1] - win_V[0][2];
+			int gy_V = win_V[0][2] + cw * win_V[1][2] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[1][0] - win_V[2][0];
+
+			if (E) {
+				unsigned int E_V = sqrt(gx_V * gx_V + gy_V * gy_V) + 0.5;
+				E_V = GP_CLAMP_DOWN(E_V, 15);
+
+				gp_putpixel_raw_4BPP_DB(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G4_DB(E_V));
+			}
+
+			if (Phi) {
+				unsigned int Phi_V = 0;
+
+				if (gx_V && gy_V)
+					Phi_V = ((atan2(gx_V, gy_V) + M_PI) * 15)/(2*M_PI);
+
+				gp_putpixel_raw_4BPP_DB(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G4_DB(Phi_V));
+			}
+
+			win_V[0][0] = win_V[1][0];
+			win_V[1][0] = win_V[2][0];
+			win_V[0][1] = win_V[1][1];
+			win_V[1][1] = win_V[2][1];
+			win_V[0][2] = win_V[1][2];
+			win_V[1][2] = win_V[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_G1_UB(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_V[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_1BPP_UB(src, xi, yi[0]);
+			win_V[i][0] = GP_PIXEL_GET_V_G1_UB(pix);
+			pix = gp_getpixel_raw_1BPP_UB(src, xi, yi[1]);
+			win_V[i][1] = GP_PIXEL_GET_V_G1_UB(pix);
+			pix = gp_getpixel_raw_1BPP_UB(src, xi, yi[2]);
+			win_V[i][2] = GP_PIXEL_GET_V_G1_UB(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_1BPP_UB(src, xi, yi[0]);
+			win_V[2][0] = GP_PIXEL_GET_V_G1_UB(pix);
+			pix = gp_getpixel_raw_1BPP_UB(src, xi, yi[1]);
+			win_V[2][1] = GP_PIXEL_GET_V_G1_UB(pix);
+			pix = gp_getpixel_raw_1BPP_UB(src, xi, yi[2]);
+			win_V[2][2] = GP_PIXEL_GET_V_G1_UB(pix);
+
+			int gx_V = win_V[2][0] + cw * win_V[2][1] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[0][1] - win_V[0][2];
+			int gy_V = win_V[0][2] + cw * win_V[1][2] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[1][0] - win_V[2][0];
+
+			if (E) {
+				unsigned int E_V = sqrt(gx_V * gx_V + gy_V * gy_V) + 0.5;
+				E_V = GP_CLAMP_DOWN(E_V, 1);
+
+				gp_putpixel_raw_1BPP_UB(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G1_UB(E_V));
+			}
+
+			if (Phi) {
+				unsigned int Phi_V = 0;
+
+				if (gx_V && gy_V)
+					Phi_V = ((atan2(gx_V, gy_V) + M_PI) * 1)/(2*M_PI);
+
+				gp_putpixel_raw_1BPP_UB(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G1_UB(Phi_V));
+			}
+
+			win_V[0][0] = win_V[1][0];
+			win_V[1][0] = win_V[2][0];
+			win_V[0][1] = win_V[1][1];
+			win_V[1][1] = win_V[2][1];
+			win_V[0][2] = win_V[1][2];
+			win_V[1][2] = win_V[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_G2_UB(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_V[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_2BPP_UB(src, xi, yi[0]);
+			win_V[i][0] = GP_PIXEL_GET_V_G2_UB(pix);
+			pix = gp_getpixel_raw_2BPP_UB(src, xi, yi[1]);
+			win_V[i][1] = GP_PIXEL_GET_V_G2_UB(pix);
+			pix = gp_getpixel_raw_2BPP_UB(src, xi, yi[2]);
+			win_V[i][2] = GP_PIXEL_GET_V_G2_UB(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_2BPP_UB(src, xi, yi[0]);
+			win_V[2][0] = GP_PIXEL_GET_V_G2_UB(pix);
+			pix = gp_getpixel_raw_2BPP_UB(src, xi, yi[1]);
+			win_V[2][1] = GP_PIXEL_GET_V_G2_UB(pix);
+			pix = gp_getpixel_raw_2BPP_UB(src, xi, yi[2]);
+			win_V[2][2] = GP_PIXEL_GET_V_G2_UB(pix);
+
+			int gx_V = win_V[2][0] + cw * win_V[2][1] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[0][1] - win_V[0][2];
+			int gy_V = win_V[0][2] + cw * win_V[1][2] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[1][0] - win_V[2][0];
+
+			if (E) {
+				unsigned int E_V = sqrt(gx_V * gx_V + gy_V * gy_V) + 0.5;
+				E_V = GP_CLAMP_DOWN(E_V, 3);
+
+				gp_putpixel_raw_2BPP_UB(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G2_UB(E_V));
+			}
+
+			if (Phi) {
+				unsigned int Phi_V = 0;
+
+				if (gx_V && gy_V)
+					Phi_V = ((atan2(gx_V, gy_V) + M_PI) * 3)/(2*M_PI);
+
+				gp_putpixel_raw_2BPP_UB(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G2_UB(Phi_V));
+			}
+
+			win_V[0][0] = win_V[1][0];
+			win_V[1][0] = win_V[2][0];
+			win_V[0][1] = win_V[1][1];
+			win_V[1][1] = win_V[2][1];
+			win_V[0][2] = win_V[1][2];
+			win_V[1][2] = win_V[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_G4_UB(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_V[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_4BPP_UB(src, xi, yi[0]);
+			win_V[i][0] = GP_PIXEL_GET_V_G4_UB(pix);
+			pix = gp_getpixel_raw_4BPP_UB(src, xi, yi[1]);
+			win_V[i][1] = GP_PIXEL_GET_V_G4_UB(pix);
+			pix = gp_getpixel_raw_4BPP_UB(src, xi, yi[2]);
+			win_V[i][2] = GP_PIXEL_GET_V_G4_UB(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_4BPP_UB(src, xi, yi[0]);
+			win_V[2][0] = GP_PIXEL_GET_V_G4_UB(pix);
+			pix = gp_getpixel_raw_4BPP_UB(src, xi, yi[1]);
+			win_V[2][1] = GP_PIXEL_GET_V_G4_UB(pix);
+			pix = gp_getpixel_raw_4BPP_UB(src, xi, yi[2]);
+			win_V[2][2] = GP_PIXEL_GET_V_G4_UB(pix);
+
+			int gx_V = win_V[2][0] + cw * win_V[2][1] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[0][1] - win_V[0][2];
+			int gy_V = win_V[0][2] + cw * win_V[1][2] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[1][0] - win_V[2][0];
+
+			if (E) {
+				unsigned int E_V = sqrt(gx_V * gx_V + gy_V * gy_V) + 0.5;
+				E_V = GP_CLAMP_DOWN(E_V, 15);
+
+				gp_putpixel_raw_4BPP_UB(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G4_UB(E_V));
+			}
+
+			if (Phi) {
+				unsigned int Phi_V = 0;
+
+				if (gx_V && gy_V)
+					Phi_V = ((atan2(gx_V, gy_V) + M_PI) * 15)/(2*M_PI);
+
+				gp_putpixel_raw_4BPP_UB(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G4_UB(Phi_V));
+			}
+
+			win_V[0][0] = win_V[1][0];
+			win_V[1][0] = win_V[2][0];
+			win_V[0][1] = win_V[1][1];
+			win_V[1][1] = win_V[2][1];
+			win_V[0][2] = win_V[1][2];
+			win_V[1][2] = win_V[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_G8(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_V[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[0]);
+			win_V[i][0] = GP_PIXEL_GET_V_G8(pix);
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[1]);
+			win_V[i][1] = GP_PIXEL_GET_V_G8(pix);
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[2]);
+			win_V[i][2] = GP_PIXEL_GET_V_G8(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[0]);
+			win_V[2][0] = GP_PIXEL_GET_V_G8(pix);
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[1]);
+			win_V[2][1] = GP_PIXEL_GET_V_G8(pix);
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[2]);
+			win_V[2][2] = GP_PIXEL_GET_V_G8(pix);
+
+			int gx_V = win_V[2][0] + cw * win_V[2][1] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[0][1] - win_V[0][2];
+			int gy_V = win_V[0][2] + cw * win_V[1][2] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[1][0] - win_V[2][0];
+
+			if (E) {
+				unsigned int E_V = sqrt(gx_V * gx_V + gy_V * gy_V) + 0.5;
+				E_V = GP_CLAMP_DOWN(E_V, 255);
+
+				gp_putpixel_raw_8BPP(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G8(E_V));
+			}
+
+			if (Phi) {
+				unsigned int Phi_V = 0;
+
+				if (gx_V && gy_V)
+					Phi_V = ((atan2(gx_V, gy_V) + M_PI) * 255)/(2*M_PI);
+
+				gp_putpixel_raw_8BPP(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G8(Phi_V));
+			}
+
+			win_V[0][0] = win_V[1][0];
+			win_V[1][0] = win_V[2][0];
+			win_V[0][1] = win_V[1][1];
+			win_V[1][1] = win_V[2][1];
+			win_V[0][2] = win_V[1][2];
+			win_V[1][2] = win_V[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_GA88(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_V[3][3];
+	int win_A[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[0]);
+			win_V[i][0] = GP_PIXEL_GET_V_GA88(pix);
+			win_A[i][0] = GP_PIXEL_GET_A_GA88(pix);
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[1]);
+			win_V[i][1] = GP_PIXEL_GET_V_GA88(pix);
+			win_A[i][1] = GP_PIXEL_GET_A_GA88(pix);
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[2]);
+			win_V[i][2] = GP_PIXEL_GET_V_GA88(pix);
+			win_A[i][2] = GP_PIXEL_GET_A_GA88(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[0]);
+			win_V[2][0] = GP_PIXEL_GET_V_GA88(pix);
+			win_A[2][0] = GP_PIXEL_GET_A_GA88(pix);
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[1]);
+			win_V[2][1] = GP_PIXEL_GET_V_GA88(pix);
+			win_A[2][1] = GP_PIXEL_GET_A_GA88(pix);
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[2]);
+			win_V[2][2] = GP_PIXEL_GET_V_GA88(pix);
+			win_A[2][2] = GP_PIXEL_GET_A_GA88(pix);
+
+			int gx_V = win_V[2][0] + cw * win_V[2][1] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[0][1] - win_V[0][2];
+			int gy_V = win_V[0][2] + cw * win_V[1][2] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[1][0] - win_V[2][0];
+			int gx_A = win_A[2][0] + cw * win_A[2][1] + win_A[2][2] -
+			           win_A[0][0] - cw * win_A[0][1] - win_A[0][2];
+			int gy_A = win_A[0][2] + cw * win_A[1][2] + win_A[2][2] -
+			           win_A[0][0] - cw * win_A[1][0] - win_A[2][0];
+
+			if (E) {
+				unsigned int E_V = sqrt(gx_V * gx_V + gy_V * gy_V) + 0.5;
+				E_V = GP_CLAMP_DOWN(E_V, 255);
+				unsigned int E_A = sqrt(gx_A * gx_A + gy_A * gy_A) + 0.5;
+				E_A = GP_CLAMP_DOWN(E_A, 255);
+
+				gp_putpixel_raw_16BPP_LE(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_GA88(E_V, E_A));
+			}
+
+			if (Phi) {
+				unsigned int Phi_V = 0;
+
+				if (gx_V && gy_V)
+					Phi_V = ((atan2(gx_V, gy_V) + M_PI) * 255)/(2*M_PI);
+				unsigned int Phi_A = 0;
+
+				if (gx_A && gy_A)
+					Phi_A = ((atan2(gx_A, gy_A) + M_PI) * 255)/(2*M_PI);
+
+				gp_putpixel_raw_16BPP_LE(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_GA88(Phi_V, Phi_A));
+			}
+
+			win_V[0][0] = win_V[1][0];
+			win_V[1][0] = win_V[2][0];
+			win_V[0][1] = win_V[1][1];
+			win_V[1][1] = win_V[2][1];
+			win_V[0][2] = win_V[1][2];
+			win_V[1][2] = win_V[2][2];
+			win_A[0][0] = win_A[1][0];
+			win_A[1][0] = win_A[2][0];
+			win_A[0][1] = win_A[1][1];
+			win_A[1][1] = win_A[2][1];
+			win_A[0][2] = win_A[1][2];
+			win_A[1][2] = win_A[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge_G16(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_V[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[0]);
+			win_V[i][0] = GP_PIXEL_GET_V_G16(pix);
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[1]);
+			win_V[i][1] = GP_PIXEL_GET_V_G16(pix);
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[2]);
+			win_V[i][2] = GP_PIXEL_GET_V_G16(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[0]);
+			win_V[2][0] = GP_PIXEL_GET_V_G16(pix);
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[1]);
+			win_V[2][1] = GP_PIXEL_GET_V_G16(pix);
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi[2]);
+			win_V[2][2] = GP_PIXEL_GET_V_G16(pix);
+
+			int gx_V = win_V[2][0] + cw * win_V[2][1] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[0][1] - win_V[0][2];
+			int gy_V = win_V[0][2] + cw * win_V[1][2] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[1][0] - win_V[2][0];
+
+			if (E) {
+				unsigned int E_V = sqrt(gx_V * gx_V + gy_V * gy_V) + 0.5;
+				E_V = GP_CLAMP_DOWN(E_V, 65535);
+
+				gp_putpixel_raw_16BPP_LE(E, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G16(E_V));
+			}
+
+			if (Phi) {
+				unsigned int Phi_V = 0;
+
+				if (gx_V && gy_V)
+					Phi_V = ((atan2(gx_V, gy_V) + M_PI) * 65535)/(2*M_PI);
+
+				gp_putpixel_raw_16BPP_LE(Phi, x_dst + x, y_dst + y,
+				                      GP_PIXEL_CREATE_G16(Phi_V));
+			}
+
+			win_V[0][0] = win_V[1][0];
+			win_V[1][0] = win_V[2][0];
+			win_V[0][1] = win_V[1][1];
+			win_V[1][1] = win_V[2][1];
+			win_V[0][2] = win_V[1][2];
+			win_V[1][2] = win_V[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int edge(const gp_pixmap *src,
+                gp_coord x_src, gp_coord y_src,
+                gp_size w_src, gp_size h_src,
+                gp_pixmap *E,
+                gp_coord x_dst, gp_coord y_dst,
+                gp_pixmap *Phi, int cw,
+                gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return edge_RGB101010(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_xRGB8888:
+		return edge_xRGB8888(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_RGBA8888:
+		return edge_RGBA8888(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_RGB888:
+		return edge_RGB888(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_BGR888:
+		return edge_BGR888(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_RGB555:
+		return edge_RGB555(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_RGB565_BE:
+		return edge_RGB565_BE(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_RGB565_LE:
+		return edge_RGB565_LE(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_RGB666:
+		return edge_RGB666(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_RGB332:
+		return edge_RGB332(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_CMYK8888:
+		return edge_CMYK8888(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_G1_DB:
+		return edge_G1_DB(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_G2_DB:
+		return edge_G2_DB(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_G4_DB:
+		return edge_G4_DB(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_G1_UB:
+		return edge_G1_UB(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_G2_UB:
+		return edge_G2_UB(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_G4_UB:
+		return edge_G4_UB(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_G8:
+		return edge_G8(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_GA88:
+		return edge_GA88(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	case GP_PIXEL_G16:
+		return edge_G16(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+#ifdef HAVE_PTHREAD
+struct edge_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	gp_pixmap *Phi;
+	int cw;
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
+
+static void *edge_thread(void *arg)
+{
+	struct edge_args *a = arg;
+
+	a->ret = edge(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  a->Phi, a->cw, a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int edge_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       gp_pixmap *Phi, int cw,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+	t = GP_MIN(t, h_src);
+
+	if (t <= 1) {
+		return edge(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, Phi, cw, callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct edge_args args[t];
+	char started[t];
+	gp_size h = h_src / t;
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct edge_args) {
+			.src = src,
+			.x_src = x_src,
+			.y_src = y_src + i * h,
+			.w_src = w_src,
+			.h_src = i == t - 1 ? h_src - i * h : h,
+			.dst = dst,
+			.x_dst = x_dst,
+			.y_dst = y_dst + i * h,
+			.Phi = Phi,
+			.cw = cw,
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, edge_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			edge_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+#else
+static int edge_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       gp_pixmap *Phi, int cw,
+                       gp_progress_cb *callback)
+{
+	return edge(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, Phi, cw, callback);
+}
+#endif /* HAVE_PTHREAD */
+
+static int op_weight(enum gp_edge_op op)
+{
+	switch (op) {
+	case GP_EDGE_SOBEL:
+		return 2;
+	case GP_EDGE_PREWITT:
+		return 1;
+	}
+
+	return -1;
+}
+
+int gp_filter_edge(const gp_pixmap *src, gp_pixmap *E, gp_pixmap *Phi,
+                   enum gp_edge_op op, gp_progress_cb *callback)
+{
+	int cw = op_weight(op);
+
+	if (cw < 0) {
+		GP_WARN("Invalid edge operator %i", op);
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (E) {
+		GP_CHECK(E->pixel_type == src->pixel_type);
+		GP_CHECK(E->w >= src->w && E->h >= src->h);
+	}
+
+	if (Phi) {
+		GP_CHECK(Phi->pixel_type == src->pixel_type);
+		GP_CHECK(Phi->w >= src->w && Phi->h >= src->h);
+	}
+
+	return edge_mp(src, 0, 0, src->w, src->h, E, 0, 0, Phi, cw, callback);
+}
+
+static int edge_detect(const gp_pixmap *src,
+                       gp_pixmap **E, gp_pixmap **Phi,
+                       enum gp_edge_op op, gp_progress_cb *callback)
+{
+	gp_pixmap *e = NULL, *phi = NULL;
+
+	if (E) {
+		e = gp_pixmap_alloc(src->w, src->h, src->pixel_type);
+		if (!e)
+			goto err0;
+	}
+
+	if (Phi) {
+		phi = gp_pixmap_alloc(src->w, src->h, src->pixel_type);
+		if (!phi)
+			goto err0;
+	}
+
+	if (gp_filter_edge(src, e, phi, op, callback))
+		goto err0;
+
+	if (E)
+		*E = e;
+
+	if (Phi)
+		*Phi = phi;
+
+	return 0;
+err0:
+	gp_pixmap_free(e);
+	gp_pixmap_free(phi);
+	return 1;
+}
+
+int gp_filter_edge_sobel(const gp_pixmap *src,
+                         gp_pixmap **E, gp_pixmap **Phi,
+                         gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Sobel edge detection image %ux%u", src->w, src->h);
+
+	return edge_detect(src, E, Phi, GP_EDGE_SOBEL, callback);
+}
+
+int gp_filter_edge_prewitt(const gp_pixmap *src,
+                           gp_pixmap **E, gp_pixmap **Phi,
+                           gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Prewitt edge detection image %ux%u", src->w, src->h);
+
+	return edge_detect(src, E, Phi, GP_EDGE_PREWITT, callback);
+}
+
+/*
+ * Canny gradient directions quantized to the neighbours the magnitude is
+ * compared with in the non-maximum suppression.
+ */
+enum canny_dir {
+	/* Left and right */
+	CANNY_DIR_H,
+	/* Top left and bottom right */
+	CANNY_DIR_D1,
+	/* Top and bottom */
+	CANNY_DIR_V,
+	/* Top right and bottom left */
+	CANNY_DIR_D2,
+};
+
+static const int8_t canny_dir_off[][2] = {
+	[CANNY_DIR_H] = {1, 0},
+	[CANNY_DIR_D1] = {1, 1},
+	[CANNY_DIR_V] = {0, 1},
+	[CANNY_DIR_D2] = {1, -1},
+};
+
+static enum canny_dir canny_dir(int gx, int gy)
+{
+	unsigned int ax = abs(gx);
+	unsigned int ay = abs(gy);
+
+	/* tan(22.5) = 0.414 */
+	if (1000 * ay <= 414 * ax)
+		return CANNY_DIR_H;
+
+	if (1000 * ax <= 414 * ay)
+		return CANNY_DIR_V;
+
+	return (gx > 0) == (gy > 0) ? CANNY_DIR_D1 : CANNY_DIR_D2;
+}
+
+/*
+ * Fused G8 gradient for Canny, writes the magnitude into a G16 pixmap and the
+ * quantized direction into a G8 pixmap.
+ */
+static int canny_gradient(const gp_pixmap *src,
+                          gp_coord x_src, gp_coord y_src,
+                          gp_size w_src, gp_size h_src,
+                          gp_pixmap *mag,
+                          gp_coord x_dst, gp_coord y_dst,
+                          gp_pixmap *dir, int cw,
+                          gp_progress_cb *callback)
+{
+	gp_coord x, y, i;
+	gp_pixel pix;
+	int win_V[3][3];
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[0]);
+			win_V[i][0] = GP_PIXEL_GET_V_G8(pix);
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[1]);
+			win_V[i][1] = GP_PIXEL_GET_V_G8(pix);
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[2]);
+			win_V[i][2] = GP_PIXEL_GET_V_G8(pix);
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[0]);
+			win_V[2][0] = GP_PIXEL_GET_V_G8(pix);
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[1]);
+			win_V[2][1] = GP_PIXEL_GET_V_G8(pix);
+			pix = gp_getpixel_raw_8BPP(src, xi, yi[2]);
+			win_V[2][2] = GP_PIXEL_GET_V_G8(pix);
+
+			int gx_V = win_V[2][0] + cw * win_V[2][1] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[0][1] - win_V[0][2];
+			int gy_V = win_V[0][2] + cw * win_V[1][2] + win_V[2][2] -
+			           win_V[0][0] - cw * win_V[1][0] - win_V[2][0];
+
+			gp_putpixel_raw_16BPP_LE(mag, x_dst + x, y_dst + y, sqrt(gx_V * gx_V + gy_V * gy_V) + 0.5);
+			gp_putpixel_raw_8BPP(dir, x_dst + x, y_dst + y, canny_dir(gx_V, gy_V));
+
+			win_V[0][0] = win_V[1][0];
+			win_V[1][0] = win_V[2][0];
+			win_V[0][1] = win_V[1][1];
+			win_V[1][1] = win_V[2][1];
+			win_V[0][2] = win_V[1][2];
+			win_V[1][2] = win_V[2][2];
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+struct canny_gradient_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	gp_pixmap *dir;
+	int cw;
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
+
+static void *canny_gradient_thread(void *arg)
+{
+	struct canny_gradient_args *a = arg;
+
+	a->ret = canny_gradient(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  a->dir, a->cw, a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int canny_gradient_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       gp_pixmap *dir, int cw,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+	t = GP_MIN(t, h_src);
+
+	if (t <= 1) {
+		return canny_gradient(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, dir, cw, callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct canny_gradient_args args[t];
+	char started[t];
+	gp_size h = h_src / t;
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct canny_gradient_args) {
+			.src = src,
+			.x_src = x_src,
+			.y_src = y_src + i * h,
+			.w_src = w_src,
+			.h_src = i == t - 1 ? h_src - i * h : h,
+			.dst = dst,
+			.x_dst = x_dst,
+			.y_dst = y_dst + i * h,
+			.dir = dir,
+			.cw = cw,
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, canny_gradient_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			canny_gradient_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+#else
+static int canny_gradient_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       gp_pixmap *dir, int cw,
+                       gp_progress_cb *callback)
+{
+	return canny_gradient(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, dir, cw, callback);
+}
+#endif /* HAVE_PTHREAD */
+
+enum canny_class {
+	CANNY_NONE,
+	CANNY_WEAK,
+	CANNY_STRONG,
+	CANNY_EDGE,
+};
+
+static gp_pixel canny_mag(const gp_pixmap *mag, gp_coord x, gp_coord y)
+{
+	if (x < 0 || y < 0 || x >= (gp_coord)mag->w || y >= (gp_coord)mag->h)
+		return 0;
+
+	return gp_getpixel_raw_16BPP_LE(mag, x, y);
+}
+
+/*
+ * Non-maximum suppression and double thresholding, classifies the magnitude
+ * local maxima into weak and strong edges.
+ */
+static int canny_nms(const gp_pixmap *mag,
+                     gp_coord x_src, gp_coord y_src,
+                     gp_size w_src, gp_size h_src,
+                     gp_pixmap *dst,
+                     gp_coord x_dst, gp_coord y_dst,
+                     gp_pixmap *dir, unsigned int low, unsigned int high,
+                     gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xs = x_src + x;
+			gp_coord ys = y_src + y;
+			gp_pixel m = gp_getpixel_raw_16BPP_LE(mag, xs, ys);
+			const int8_t *off = canny_dir_off[gp_getpixel_raw_8BPP(dir, xs, ys)];
+			enum canny_class class = CANNY_NONE;
+
+			/* Ties are broken to one side so that plateaus stay one pixel thin */
+			if (m >= low &&
+			    m >= canny_mag(mag, xs - off[0], ys - off[1]) &&
+			    m > canny_mag(mag, xs + off[0], ys + off[1]))
+				class = m >= high ? CANNY_STRONG : CANNY_WEAK;
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y, class);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+struct canny_nms_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	gp_pixmap *dir;
+	unsigned int low;
+	unsigned int high;
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
+
+static void *canny_nms_thread(void *arg)
+{
+	struct canny_nms_args *a = arg;
+
+	a->ret = canny_nms(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  a->dir, a->low, a->high, a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int canny_nms_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       gp_pixmap *dir, unsigned int low, unsigned int high,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+	t = GP_MIN(t, h_src);
+
+	if (t <= 1) {
+		return canny_nms(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, dir, low, high, callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct canny_nms_args args[t];
+	char started[t];
+	gp_size h = h_src / t;
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct canny_nms_args) {
+			.src = src,
+			.x_src = x_src,
+			.y_src = y_src + i * h,
+			.w_src = w_src,
+			.h_src = i == t - 1 ? h_src - i * h : h,
+			.dst = dst,
+			.x_dst = x_dst,
+			.y_dst = y_dst + i * h,
+			.dir = dir,
+			.low = low,
+			.high = high,
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, canny_nms_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			canny_nms_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+#else
+static int canny_nms_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       gp_pixmap *dir, unsigned int low, unsigned int high,
+                       gp_progress_cb *callback)
+{
+	return canny_nms(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, dir, low, high, callback);
+}
+#endif /* HAVE_PTHREAD */
+
+/*
+ * Traces the edges from the strong pixels through the connected weak pixels
+ * and converts the result into 0 and 255.
+ */
+static int canny_hysteresis(gp_pixmap *dst, gp_size w, gp_size h)
+{
+	size_t stack_size = 1024, sp = 0;
+	uint32_t *stack = malloc(stack_size * sizeof(*stack));
+	gp_coord x, y, i, j;
+
+	if (!stack) {
+		errno = ENOMEM;
+		return 1;
+	}
+
+	for (y = 0; y < (gp_coord)h; y++) {
+		for (x = 0; x < (gp_coord)w; x++) {
+			if (gp_getpixel_raw_8BPP(dst, x, y) != CANNY_STRONG)
+				continue;
+
+			gp_putpixel_raw_8BPP(dst, x, y, CANNY_EDGE);
+			stack[sp++] = y * w + x;
+
+			while (sp) {
+				uint32_t pos = stack[--sp];
+				gp_coord px = pos % w;
+				gp_coord py = pos / w;
+
+				for (j = GP_MAX(py - 1, 0); j <= GP_MIN(py + 1, (gp_coord)h - 1); j++) {
+					for (i = GP_MAX(px - 1, 0); i <= GP_MIN(px + 1, (gp_coord)w - 1); i++) {
+						gp_pixel class = gp_getpixel_raw_8BPP(dst, i, j);
+
+						if (class != CANNY_WEAK && class != CANNY_STRONG)
+							continue;
+
+						if (sp >= stack_size) {
+							uint32_t *new_stack;
+
+							new_stack = realloc(stack, 2 * stack_size * sizeof(*stack));
+							if (!new_stack) {
+								free(stack);
+								errno = ENOMEM;
+								return 1;
+							}
+
+							stack = new_stack;
+							stack_size *= 2;
+						}
+
+						gp_putpixel_raw_8BPP(dst, i, j, CANNY_EDGE);
+						stack[sp++] = j * w + i;
+					}
+				}
+			}
+		}
+	}
+
+	free(stack);
+
+	for (y = 0; y < (gp_coord)h; y++) {
+		for (x = 0; x < (gp_coord)w; x++) {
+			gp_pixel class = gp_getpixel_raw_8BPP(dst, x, y);
+
+			gp_putpixel_raw_8BPP(dst, x, y, class == CANNY_EDGE ? 255 : 0);
+		}
+	}
+
+	return 0;
+}
+
+int gp_filter_edge_canny(const gp_pixmap *src, gp_pixmap *dst,
+                         enum gp_edge_op op, float low, float high,
+                         gp_progress_cb *callback)
+{
+	gp_pixmap *gray = NULL, *mag = NULL, *dir = NULL;
+	int cw = op_weight(op);
+	int ret = 1;
+
+	GP_DEBUG(1, "Canny edge detection image %ux%u low=%.2f high=%.2f",
+	         src->w, src->h, low, high);
+
+	GP_CHECK(dst->pixel_type == GP_PIXEL_G8);
+	GP_CHECK(dst->w >= src->w && dst->h >= src->h);
+
+	if (cw < 0 || low < 0 || high > 1 || low > high) {
+		GP_WARN("Invalid parameters op=%i low=%.2f high=%.2f", op, low, high);
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (src->pixel_type != GP_PIXEL_G8) {
+		gray = gp_pixmap_convert_alloc(src, GP_PIXEL_G8);
+		if (!gray)
+			return 1;
+	}
+
+	mag = gp_pixmap_alloc(src->w, src->h, GP_PIXEL_G16);
+	dir = gp_pixmap_alloc(src->w, src->h, GP_PIXEL_G8);
+
+	if (!mag || !dir) {
+		errno = ENOMEM;
+		goto exit;
+	}
+
+	/* Maximal gradient is for a step from 0 to 255 along the diagonal */
+	float max = (2 + cw) * 255 * M_SQRT2;
+
+	if (canny_gradient_mp(gray ? gray : src, 0, 0, src->w, src->h,
+	                      mag, 0, 0, dir, cw, callback))
+		goto exit;
+
+	if (canny_nms_mp(mag, 0, 0, src->w, src->h, dst, 0, 0,
+	                 dir, low * max + 0.5, high * max + 0.5, NULL))
+		goto exit;
+
+	ret = canny_hysteresis(dst, src->w, src->h);
+exit:
+	gp_pixmap_free(gray);
+	gp_pixmap_free(mag);
+	gp_pixmap_free(dir);
+	return ret;
+}
+
+gp_pixmap *gp_filter_edge_canny_alloc(const gp_pixmap *src,
+                                      enum gp_edge_op op,
+                                      float low, float high,
+                                      gp_progress_cb *callback)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(src->w, src->h, GP_PIXEL_G8);
+
+	if (!ret)
+		return NULL;
+
+	if (gp_filter_edge_canny(src, ret, op, low, high, callback)) {
+		gp_pixmap_free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
@@ -0,0 +1,510 @@
+@ include source.t
+@ include thread_dispatcher.t
+/*
+ * Edge detection
+ *
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <math.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include "../../config.h"
+
+#include <core/gp_debug.h>
+#include <core/gp_clamp.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+
+#include <filters/gp_edge_detection.h>
+
+@ g16 = [pt for pt in pixeltypes if pt.name == 'G16'][0].pixelpack.suffix
+@
+@ # Loads a column of three pixels into the sliding window
+@ def load_col(pt, col, xi):
+@     for r in range(0, 3):
+pix = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, {{ xi }}, yi[{{ r }}]);
+@         for c in pt.chanslist:
+win_{{ c.name }}[{{ col }}][{{ r }}] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+@         end
+@     end
+@ end
+@
+@ # Computes gx and gy from the window, cw is the center row and column weight
+@ def gradient(c):
+int gx_{{ c.name }} = win_{{ c.name }}[2][0] + cw * win_{{ c.name }}[2][1] + win_{{ c.name }}[2][2] -
+           win_{{ c.name }}[0][0] - cw * win_{{ c.name }}[0][1] - win_{{ c.name }}[0][2];
+int gy_{{ c.name }} = win_{{ c.name }}[0][2] + cw * win_{{ c.name }}[1][2] + win_{{ c.name }}[2][2] -
+           win_{{ c.name }}[0][0] - cw * win_{{ c.name }}[1][0] - win_{{ c.name }}[2][0];
+@ end
+@
+@ def shift_window(pt):
+@     for c in pt.chanslist:
+@         for r in range(0, 3):
+win_{{ c.name }}[0][{{ r }}] = win_{{ c.name }}[1][{{ r }}];
+win_{{ c.name }}[1][{{ r }}] = win_{{ c.name }}[2][{{ r }}];
+@         end
+@     end
+@ end
+@
+@ # The window is filled up to the current pixel and each iteration loads only
+@ # the column on the right, so that each source pixel is read three times
+@ # instead of nine.
+@ def window_loop(pt, body):
+	gp_coord x, y, i;
+	gp_pixel pix;
+@     for c in pt.chanslist:
+	int win_{{ c.name }}[3][3];
+@     end
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi[3] = {
+			GP_CLAMP(y_src + y - 1, 0, (gp_coord)src->h - 1),
+			y_src + y,
+			GP_MIN(y_src + y + 1, (gp_coord)src->h - 1),
+		};
+
+		for (i = 0; i < 2; i++) {
+			gp_coord xi = GP_CLAMP(x_src + i - 1, 0, (gp_coord)src->w - 1);
+
+			{@ load_col(pt, 'i', 'xi') @}
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xi = GP_MIN(x_src + x + 1, (gp_coord)src->w - 1);
+
+			{@ load_col(pt, 2, 'xi') @}
+
+			{@ body(pt) @}
+
+			{@ shift_window(pt) @}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+@ end
+@
+@ def edge_body(pt):
+@     for c in pt.chanslist:
+{@ gradient(c) @}
+@     end
+
+if (E) {
+@     for c in pt.chanslist:
+	unsigned int E_{{ c.name }} = sqrt(gx_{{ c.name }} * gx_{{ c.name }} + gy_{{ c.name }} * gy_{{ c.name }}) + 0.5;
+	E_{{ c.name }} = GP_CLAMP_DOWN(E_{{ c.name }}, {{ c.max }});
+@     end
+
+	gp_putpixel_raw_{{ pt.pixelpack.suffix }}(E, x_dst + x, y_dst + y,
+	                      GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names, 'E_') }}));
+}
+
+if (Phi) {
+@     for c in pt.chanslist:
+	unsigned int Phi_{{ c.name }} = 0;
+
+	if (gx_{{ c.name }} && gy_{{ c.name }})
+		Phi_{{ c.name }} = ((atan2(gx_{{ c.name }}, gy_{{ c.name }}) + M_PI) * {{ c.max }})/(2*M_PI);
+@     end
+
+	gp_putpixel_raw_{{ pt.pixelpack.suffix }}(Phi, x_dst + x, y_dst + y,
+	                      GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names, 'Phi_') }}));
+}
+@ end
+@
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and not pt.is_palette():
+static int edge_{{ pt.name }}(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *E,
+                              gp_coord x_dst, gp_coord y_dst,
+                              gp_pixmap *Phi, int cw,
+                              gp_progress_cb *callback)
+{
+{@ window_loop(pt, edge_body) @}
+}
+
+@ end
+static int edge(const gp_pixmap *src,
+                gp_coord x_src, gp_coord y_src,
+                gp_size w_src, gp_size h_src,
+                gp_pixmap *E,
+                gp_coord x_dst, gp_coord y_dst,
+                gp_pixmap *Phi, int cw,
+                gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and not pt.is_palette():
+	case GP_PIXEL_{{ pt.name }}:
+		return edge_{{ pt.name }}(src, x_src, y_src, w_src, h_src,
+		                          E, x_dst, y_dst, Phi, cw, callback);
+@ end
+	default:
+		errno = EINVAL;
+		return 1;
+	}
+}
+
+{@ dispatcher('edge', [['gp_pixmap *', 'Phi'], ['int', 'cw']]) @}
+
+static int op_weight(enum gp_edge_op op)
+{
+	switch (op) {
+	case GP_EDGE_SOBEL:
+		return 2;
+	case GP_EDGE_PREWITT:
+		return 1;
+	}
+
+	return -1;
+}
+
+int gp_filter_edge(const gp_pixmap *src, gp_pixmap *E, gp_pixmap *Phi,
+                   enum gp_edge_op op, gp_progress_cb *callback)
+{
+	int cw = op_weight(op);
+
+	if (cw < 0) {
+		GP_WARN("Invalid edge operator %i", op);
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (E) {
+		GP_CHECK(E->pixel_type == src->pixel_type);
+		GP_CHECK(E->w >= src->w && E->h >= src->h);
+	}
+
+	if (Phi) {
+		GP_CHECK(Phi->pixel_type == src->pixel_type);
+		GP_CHECK(Phi->w >= src->w && Phi->h >= src->h);
+	}
+
+	return edge_mp(src, 0, 0, src->w, src->h, E, 0, 0, Phi, cw, callback);
+}
+
+static int edge_detect(const gp_pixmap *src,
+                       gp_pixmap **E, gp_pixmap **Phi,
+                       enum gp_edge_op op, gp_progress_cb *callback)
+{
+	gp_pixmap *e = NULL, *phi = NULL;
+
+	if (E) {
+		e = gp_pixmap_alloc(src->w, src->h, src->pixel_type);
+		if (!e)
+			goto err0;
+	}
+
+	if (Phi) {
+		phi = gp_pixmap_alloc(src->w, src->h, src->pixel_type);
+		if (!phi)
+			goto err0;
+	}
+
+	if (gp_filter_edge(src, e, phi, op, callback))
+		goto err0;
+
+	if (E)
+		*E = e;
+
+	if (Phi)
+		*Phi = phi;
+
+	return 0;
+err0:
+	gp_pixmap_free(e);
+	gp_pixmap_free(phi);
+	return 1;
+}
+
+int gp_filter_edge_sobel(const gp_pixmap *src,
+                         gp_pixmap **E, gp_pixmap **Phi,
+                         gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Sobel edge detection image %ux%u", src->w, src->h);
+
+	return edge_detect(src, E, Phi, GP_EDGE_SOBEL, callback);
+}
+
+int gp_filter_edge_prewitt(const gp_pixmap *src,
+                           gp_pixmap **E, gp_pixmap **Phi,
+                           gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Prewitt edge detection image %ux%u", src->w, src->h);
+
+	return edge_detect(src, E, Phi, GP_EDGE_PREWITT, callback);
+}
+
+/*
+ * Canny gradient directions quantized to the neighbours the magnitude is
+ * compared with in the non-maximum suppression.
+ */
+enum canny_dir {
+	/* Left and right */
+	CANNY_DIR_H,
+	/* Top left and bottom right */
+	CANNY_DIR_D1,
+	/* Top and bottom */
+	CANNY_DIR_V,
+	/* Top right and bottom left */
+	CANNY_DIR_D2,
+};
+
+static const int8_t canny_dir_off[][2] = {
+	[CANNY_DIR_H] = {1, 0},
+	[CANNY_DIR_D1] = {1, 1},
+	[CANNY_DIR_V] = {0, 1},
+	[CANNY_DIR_D2] = {1, -1},
+};
+
+static enum canny_dir canny_dir(int gx, int gy)
+{
+	unsigned int ax = abs(gx);
+	unsigned int ay = abs(gy);
+
+	/* tan(22.5) = 0.414 */
+	if (1000 * ay <= 414 * ax)
+		return CANNY_DIR_H;
+
+	if (1000 * ax <= 414 * ay)
+		return CANNY_DIR_V;
+
+	return (gx > 0) == (gy > 0) ? CANNY_DIR_D1 : CANNY_DIR_D2;
+}
+
+@ def canny_body(pt):
+{@ gradient(pt.chanslist[0]) @}
+
+gp_putpixel_raw_{{ g16 }}(mag, x_dst + x, y_dst + y, sqrt(gx_V * gx_V + gy_V * gy_V) + 0.5);
+gp_putpixel_raw_8BPP(dir, x_dst + x, y_dst + y, canny_dir(gx_V, gy_V));
+@ end
+@
+@ for pt in pixeltypes:
+@     if pt.name == 'G8':
+/*
+ * Fused G8 gradient for Canny, writes the magnitude into a G16 pixmap and the
+ * quantized direction into a G8 pixmap.
+ */
+static int canny_gradient(const gp_pixmap *src,
+                          gp_coord x_src, gp_coord y_src,
+                          gp_size w_src, gp_size h_src,
+                          gp_pixmap *mag,
+                          gp_coord x_dst, gp_coord y_dst,
+                          gp_pixmap *dir, int cw,
+                          gp_progress_cb *callback)
+{
+{@ window_loop(pt, canny_body) @}
+}
+
+@ end
+{@ dispatcher('canny_gradient', [['gp_pixmap *', 'dir'], ['int', 'cw']]) @}
+
+enum canny_class {
+	CANNY_NONE,
+	CANNY_WEAK,
+	CANNY_STRONG,
+	CANNY_EDGE,
+};
+
+static gp_pixel canny_mag(const gp_pixmap *mag, gp_coord x, gp_coord y)
+{
+	if (x < 0 || y < 0 || x >= (gp_coord)mag->w || y >= (gp_coord)mag->h)
+		return 0;
+
+	return gp_getpixel_raw_{{ g16 }}(mag, x, y);
+}
+
+/*
+ * Non-maximum suppression and double thresholding, classifies the magnitude
+ * local maxima into weak and strong edges.
+ */
+static int canny_nms(const gp_pixmap *mag,
+                     gp_coord x_src, gp_coord y_src,
+                     gp_size w_src, gp_size h_src,
+                     gp_pixmap *dst,
+                     gp_coord x_dst, gp_coord y_dst,
+                     gp_pixmap *dir, unsigned int low, unsigned int high,
+                     gp_progress_cb *callback)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			gp_coord xs = x_src + x;
+			gp_coord ys = y_src + y;
+			gp_pixel m = gp_getpixel_raw_{{ g16 }}(mag, xs, ys);
+			const int8_t *off = canny_dir_off[gp_getpixel_raw_8BPP(dir, xs, ys)];
+			enum canny_class class = CANNY_NONE;
+
+			/* Ties are broken to one side so that plateaus stay one pixel thin */
+			if (m >= low &&
+			    m >= canny_mag(mag, xs - off[0], ys - off[1]) &&
+			    m > canny_mag(mag, xs + off[0], ys + off[1]))
+				class = m >= high ? CANNY_STRONG : CANNY_WEAK;
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y, class);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+{@ dispatcher('canny_nms', [['gp_pixmap *', 'dir'], ['unsigned int', 'low'], ['unsigned int', 'high']]) @}
+
+/*
+ * Traces the edges from the strong pixels through the connected weak pixels
+ * and converts the result into 0 and 255.
+ */
+static int canny_hysteresis(gp_pixmap *dst, gp_size w, gp_size h)
+{
+	size_t stack_size = 1024, sp = 0;
+	uint32_t *stack = malloc(stack_size * sizeof(*stack));
+	gp_coord x, y, i, j;
+
+	if (!stack) {
+		errno = ENOMEM;
+		return 1;
+	}
+
+	for (y = 0; y < (gp_coord)h; y++) {
+		for (x = 0; x < (gp_coord)w; x++) {
+			if (gp_getpixel_raw_8BPP(dst, x, y) != CANNY_STRONG)
+				continue;
+
+			gp_putpixel_raw_8BPP(dst, x, y, CANNY_EDGE);
+			stack[sp++] = y * w + x;
+
+			while (sp) {
+				uint32_t pos = stack[--sp];
+				gp_coord px = pos % w;
+				gp_coord py = pos / w;
+
+				for (j = GP_MAX(py - 1, 0); j <= GP_MIN(py + 1, (gp_coord)h - 1); j++) {
+					for (i = GP_MAX(px - 1, 0); i <= GP_MIN(px + 1, (gp_coord)w - 1); i++) {
+						gp_pixel class = gp_getpixel_raw_8BPP(dst, i, j);
+
+						if (class != CANNY_WEAK && class != CANNY_STRONG)
+							continue;
+
+						if (sp >= stack_size) {
+							uint32_t *new_stack;
+
+							new_stack = realloc(stack, 2 * stack_size * sizeof(*stack));
+							if (!new_stack) {
+								free(stack);
+								errno = ENOMEM;
+								return 1;
+							}
+
+							stack = new_stack;
+							stack_size *= 2;
+						}
+
+						gp_putpixel_raw_8BPP(dst, i, j, CANNY_EDGE);
+						stack[sp++] = j * w + i;
+					}
+				}
+			}
+		}
+	}
+
+	free(stack);
+
+	for (y = 0; y < (gp_coord)h; y++) {
+		for (x = 0; x < (gp_coord)w; x++) {
+			gp_pixel class = gp_getpixel_raw_8BPP(dst, x, y);
+
+			gp_putpixel_raw_8BPP(dst, x, y, class == CANNY_EDGE ? 255 : 0);
+		}
+	}
+
+	return 0;
+}
+
+int gp_filter_edge_canny(const gp_pixmap *src, gp_pixmap *dst,
+                         enum gp_edge_op op, float low, float high,
+                         gp_progress_cb *callback)
+{
+	gp_pixmap *gray = NULL, *mag = NULL, *dir = NULL;
+	int cw = op_weight(op);
+	int ret = 1;
+
+	GP_DEBUG(1, "Canny edge detection image %ux%u low=%.2f high=%.2f",
+	         src->w, src->h, low, high);
+
+	GP_CHECK(dst->pixel_type == GP_PIXEL_G8);
+	GP_CHECK(dst->w >= src->w && dst->h >= src->h);
+
+	if (cw < 0 || low < 0 || high > 1 || low > high) {
+		GP_WARN("Invalid parameters op=%i low=%.2f high=%.2f", op, low, high);
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (src->pixel_type != GP_PIXEL_G8) {
+		gray = gp_pixmap_convert_alloc(src, GP_PIXEL_G8);
+		if (!gray)
+			return 1;
+	}
+
+	mag = gp_pixmap_alloc(src->w, src->h, GP_PIXEL_G16);
+	dir = gp_pixmap_alloc(src->w, src->h, GP_PIXEL_G8);
+
+	if (!mag || !dir) {
+		errno = ENOMEM;
+		goto exit;
+	}
+
+	/* Maximal gradient is for a step from 0 to 255 along the diagonal */
+	float max = (2 + cw) * 255 * M_SQRT2;
+
+	if (canny_gradient_mp(gray ? gray : src, 0, 0, src->w, src->h,
+	                      mag, 0, 0, dir, cw, callback))
+		goto exit;
+
+	if (canny_nms_mp(mag, 0, 0, src->w, src->h, dst, 0, 0,
+	                 dir, low * max + 0.5, high * max + 0.5, NULL))
+		goto exit;
+
+	ret = canny_hysteresis(dst, src->w, src->h);
+exit:
+	gp_pixmap_free(gray);
+	gp_pixmap_free(mag);
+	gp_pixmap_free(dir);
+	return ret;
+}
+
+gp_pixmap *gp_filter_edge_canny_alloc(const gp_pixmap *src,
+                                      enum gp_edge_op op,
+                                      float low, float high,
+                                      gp_progress_cb *callback)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(src->w, src->h, GP_PIXEL_G8);
+
+	if (!ret)
+		return NULL;
+
+	if (gp_filter_edge_canny(src, ret, op, low, high, callback)) {
+		gp_pixmap_free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
@@ -0,0 +1,486 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include <core/gp_common.h>
+#include <core/gp_debug.h>
+#include <core/gp_pixmap.h>
+#include <core/gp_blit.h>
+
+#include <filters/gp_point.h>
+#include <filters/gp_point_chain.h>
+#include <filters/gp_filter_graph.h>
+
+#define DEFAULT_STRIP_H 128
+
+enum node_type {
+	NODE_BRIGHTNESS,
+	NODE_CONTRAST,
+	NODE_BRIGHTNESS_CONTRAST,
+	NODE_POSTERIZE,
+	NODE_INVERT,
+	NODE_STENCIL,
+	NODE_RESIZE,
+	NODE_DITHER,
+};
+
+struct gp_filter_graph_node {
+	enum node_type type;
+	union {
+		float p[2];
+		unsigned int steps;
+		gp_tiled_filter stencil;
+		struct {
+			gp_size w;
+			gp_size h;
+			gp_interpolation_type interp;
+		} resize;
+		struct {
+			gp_dither_type type;
+			gp_pixel_type pixel_type;
+		} dither;
+	};
+};
+
+void gp_filter_graph_init(gp_filter_graph *self)
+{
+	self->node_cnt = 0;
+	self->node_size = 0;
+	self->nodes = NULL;
+	self->strip_h = 0;
+}
+
+void gp_filter_graph_exit(gp_filter_graph *self)
+{
+	free(self->nodes);
+	gp_filter_graph_init(self);
+}
+
+static struct gp_filter_graph_node *node_add(gp_filter_graph *self,
+                                             enum node_type type)
+{
+	struct gp_filter_graph_node *node;
+
+	if (self->node_cnt >= self->node_size) {
+		unsigned int size = self->node_size ? 2 * self->node_size : 8;
+
+		node = realloc(self->nodes, size * sizeof(*node));
+		if (!node) {
+			GP_WARN("Realloc failed :(");
+			errno = ENOMEM;
+			return NULL;
+		}
+
+		self->nodes = node;
+		self->node_size = size;
+	}
+
+	node = &self->nodes[self->node_cnt++];
+	node->type = type;
+
+	return node;
+}
+
+static int node_add_p(gp_filter_graph *self, enum node_type type,
+                      float p0, float p1)
+{
+	struct gp_filter_graph_node *node = node_add(self, type);
+
+	if (!node)
+		return 1;
+
+	node->p[0] = p0;
+	node->p[1] = p1;
+
+	return 0;
+}
+
+int gp_filter_graph_brightness(gp_filter_graph *self, float p)
+{
+	return node_add_p(self, NODE_BRIGHTNESS, p, 0);
+}
+
+int gp_filter_graph_contrast(gp_filter_graph *self, float p)
+{
+	return node_add_p(self, NODE_CONTRAST, p, 0);
+}
+
+int gp_filter_graph_brightness_contrast(gp_filter_graph *self, float b, float c)
+{
+	return node_add_p(self, NODE_BRIGHTNESS_CONTRAST, b, c);
+}
+
+int gp_filter_graph_posterize(gp_filter_graph *self, unsigned int steps)
+{
+	struct gp_filter_graph_node *node = node_add(self, NODE_POSTERIZE);
+
+	if (!node)
+		return 1;
+
+	node->steps = steps;
+
+	return 0;
+}
+
+int gp_filter_graph_invert(gp_filter_graph *self)
+{
+	return !node_add(self, NODE_INVERT);
+}
+
+int gp_filter_graph_stencil(gp_filter_graph *self, const gp_tiled_filter *filter)
+{
+	struct gp_filter_graph_node *node = node_add(self, NODE_STENCIL);
+
+	if (!node)
+		return 1;
+
+	node->stencil = *filter;
+
+	return 0;
+}
+
+int gp_filter_graph_gaussian_blur(gp_filter_graph *self,
+                                  float x_sigma, float y_sigma)
+{
+	gp_tiled_filter filter;
+
+	gp_tiled_filter_gaussian_blur(&filter, x_sigma, y_sigma);
+
+	return gp_filter_graph_stencil(self, &filter);
+}
+
+int gp_filter_graph_median(gp_filter_graph *self, int xmed, int ymed)
+{
+	gp_tiled_filter filter;
+
+	gp_tiled_filter_median(&filter, xmed, ymed);
+
+	return gp_filter_graph_stencil(self, &filter);
+}
+
+int gp_filter_graph_resize(gp_filter_graph *self, gp_size w, gp_size h,
+                           gp_interpolation_type interp)
+{
+	struct gp_filter_graph_node *node = node_add(self, NODE_RESIZE);
+
+	if (!node)
+		return 1;
+
+	node->resize.w = w;
+	node->resize.h = h;
+	node->resize.interp = interp;
+
+	return 0;
+}
+
+int gp_filter_graph_dither(gp_filter_graph *self, gp_dither_type type,
+                           gp_pixel_type pixel_type)
+{
+	struct gp_filter_graph_node *node = node_add(self, NODE_DITHER);
+
+	if (!node)
+		return 1;
+
+	node->dither.type = type;
+	node->dither.pixel_type = pixel_type;
+
+	return 0;
+}
+
+static int is_barrier(const struct gp_filter_graph_node *node)
+{
+	return node->type == NODE_RESIZE || node->type == NODE_DITHER;
+}
+
+/* Returns an index of the first node after the step starting at i */
+static unsigned int step_end(const gp_filter_graph *self, unsigned int i)
+{
+	if (is_barrier(&self->nodes[i]))
+		return i + 1;
+
+	while (i < self->node_cnt && !is_barrier(&self->nodes[i]))
+		i++;
+
+	return i;
+}
+
+static void chain_add(gp_point_chain *chain, const struct gp_filter_graph_node *node)
+{
+	switch (node->type) {
+	case NODE_BRIGHTNESS:
+		gp_point_chain_brightness(chain, node->p[0]);
+	break;
+	case NODE_CONTRAST:
+		gp_point_chain_contrast(chain, node->p[0]);
+	break;
+	case NODE_BRIGHTNESS_CONTRAST:
+		gp_point_chain_brightness_contrast(chain, node->p[0], node->p[1]);
+	break;
+	case NODE_POSTERIZE:
+		gp_point_chain_posterize(chain, node->steps);
+	break;
+	case NODE_INVERT:
+		gp_point_chain_invert(chain);
+	break;
+	default:
+	break;
+	}
+}
+
+/*
+ * A segment of the graph between barriers. Each stage is a stencil filter
+ * followed by fused point filters, the first stage has no stencil, i.e. it
+ * consists only of the point filters preceding the first stencil.
+ */
+struct stage {
+	const gp_tiled_filter *stencil;
+	gp_point_chain chain;
+	int has_chain;
+};
+
+struct segment {
+	gp_tiled_filter filter;
+	unsigned int stage_cnt;
+	struct stage stages[];
+};
+
+static void segment_free(struct segment *self)
+{
+	unsigned int i;
+
+	for (i = 0; i < self->stage_cnt; i++) {
+		if (self->stages[i].has_chain)
+			gp_point_chain_exit(&self->stages[i].chain);
+	}
+
+	free(self);
+}
+
+static struct segment *segment_alloc(const struct gp_filter_graph_node *nodes,
+                                     unsigned int cnt, gp_pixel_type pixel_type)
+{
+	struct segment *self;
+	struct stage *stage;
+	unsigned int i;
+
+	self = calloc(1, sizeof(*self) + (cnt + 1) * sizeof(struct stage));
+	if (!self) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	stage = &self->stages[0];
+	self->stage_cnt = 1;
+
+	for (i = 0; i < cnt; i++) {
+		if (nodes[i].type == NODE_STENCIL) {
+			stage = &self->stages[self->stage_cnt++];
+			stage->stencil = &nodes[i].stencil;
+			self->filter.halo_x += nodes[i].stencil.halo_x;
+			self->filter.halo_y += nodes[i].stencil.halo_y;
+			continue;
+		}
+
+		if (!stage->has_chain) {
+			if (gp_point_chain_init(&stage->chain, pixel_type)) {
+				segment_free(self);
+				return NULL;
+			}
+
+			stage->has_chain = 1;
+		}
+
+		chain_add(&stage->chain, &nodes[i]);
+	}
+
+	return self;
+}
+
+/*
+ * Runs all stages of a segment on a strip, ping-pongs between the dst and a
+ * scratch buffer.
+ *
+ * The callback is passed down from the tiled worker and limits the filters
+ * to a single thread.
+ */
+static int segment_strip(const gp_pixmap *src, gp_pixmap *dst,
+                         const gp_tiled_filter *filter,
+                         gp_progress_cb *callback)
+{
+	const struct segment *self = filter->priv;
+	const gp_pixmap *in = src;
+	gp_pixmap *scratch = NULL, *out;
+	unsigned int i;
+	int ret = 1;
+
+	if (self->stages[0].has_chain || self->stage_cnt > 2) {
+		scratch = gp_pixmap_alloc(src->w, src->h, src->pixel_type);
+		if (!scratch)
+			return 1;
+	}
+
+	if (self->stages[0].has_chain) {
+		gp_point_chain_apply(in, scratch, &self->stages[0].chain, callback);
+		in = scratch;
+	}
+
+	for (i = 1; i < self->stage_cnt; i++) {
+		const struct stage *stage = &self->stages[i];
+
+		out = in == dst ? scratch : dst;
+
+		if (stage->stencil->filter(in, out, stage->stencil, callback))
+			goto exit;
+
+		if (stage->has_chain)
+			gp_point_chain_apply(out, out, &stage->chain, callback);
+
+		in = out;
+	}
+
+	if (in != dst)
+		gp_blit_xywh_raw(in, 0, 0, in->w, in->h, dst, 0, 0);
+
+	ret = 0;
+exit:
+	gp_pixmap_free(scratch);
+	return ret;
+}
+
+static gp_pixmap *segment_run(const gp_filter_graph *graph,
+                              const struct gp_filter_graph_node *nodes,
+                              unsigned int cnt, const gp_pixmap *src,
+                              gp_progress_cb *callback)
+{
+	struct segment *self;
+	gp_pixmap *ret = NULL;
+	gp_tile_src tsrc;
+	gp_tile_sink tsink;
+	gp_size strip_h;
+
+	self = segment_alloc(nodes, cnt, src->pixel_type);
+	if (!self)
+		return NULL;
+
+	/* Point filters only, no need for strips */
+	if (self->stage_cnt == 1) {
+		ret = gp_point_chain_apply_alloc(src, &self->stages[0].chain, callback);
+		goto exit;
+	}
+
+	ret = gp_pixmap_alloc(src->w, src->h, src->pixel_type);
+	if (!ret)
+		goto exit;
+
+	self->filter.filter = segment_strip;
+	self->filter.priv = self;
+
+	strip_h = graph->strip_h;
+	if (!strip_h)
+		strip_h = GP_MAX((gp_size)DEFAULT_STRIP_H, 4 * self->filter.halo_y);
+
+	GP_DEBUG(1, "Segment %u nodes %u stencils halo %ux%u strip %u",
+	         cnt, self->stage_cnt - 1, self->filter.halo_x,
+	         self->filter.halo_y, strip_h);
+
+	gp_tile_src_pixmap(&tsrc, src);
+	gp_tile_sink_pixmap(&tsink, ret);
+
+	if (gp_filter_tiled(&tsrc, &tsink, &self->filter, src->w, strip_h, callback)) {
+		int err = errno;
+		gp_pixmap_free(ret);
+		errno = err;
+		ret = NULL;
+	}
+
+exit:
+	segment_free(self);
+	return ret;
+}
+
+static gp_pixmap *barrier_run(const struct gp_filter_graph_node *node,
+                              const gp_pixmap *src, gp_progress_cb *callback)
+{
+	switch (node->type) {
+	case NODE_RESIZE:
+		return gp_filter_resize_alloc(src, node->resize.w, node->resize.h,
+		                              node->resize.interp, callback);
+	case NODE_DITHER:
+		return gp_filter_dither_alloc(node->dither.type, src,
+		                              node->dither.pixel_type, callback);
+	default:
+		errno = EINVAL;
+		return NULL;
+	}
+}
+
+/* Maps the progress of a single step into the progress of the whole graph */
+struct step_cb {
+	gp_progress_cb cb;
+	gp_progress_cb *orig;
+	unsigned int step;
+	unsigned int steps;
+};
+
+static int step_callback(gp_progress_cb *self)
+{
+	struct step_cb *step = GP_CONTAINER_OF(self, struct step_cb, cb);
+	gp_progress_cb *orig = step->orig;
+
+	orig->percentage = (100.00 * step->step + self->percentage) / step->steps;
+
+	return orig->callback(orig);
+}
+
+gp_pixmap *gp_filter_graph_run(const gp_filter_graph *self, const gp_pixmap *src,
+                               gp_progress_cb *callback)
+{
+	const struct gp_filter_graph_node *nodes = self->nodes;
+	struct step_cb step = {.orig = callback};
+	const gp_pixmap *cur = src;
+	gp_pixmap *tmp = NULL, *out;
+	unsigned int i, j;
+
+	GP_DEBUG(1, "Running filter graph with %u nodes on %ux%u %s",
+	         self->node_cnt, src->w, src->h,
+	         gp_pixel_type_name(src->pixel_type));
+
+	if (!self->node_cnt)
+		return gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+
+	for (i = 0; i < self->node_cnt; i = step_end(self, i))
+		step.steps++;
+
+	if (callback) {
+		step.cb.callback = step_callback;
+		step.cb.threads = callback->threads;
+	}
+
+	for (i = 0; i < self->node_cnt; i = j) {
+		gp_progress_cb *cb = callback ? &step.cb : NULL;
+
+		j = step_end(self, i);
+
+		if (is_barrier(&nodes[i]))
+			out = barrier_run(&nodes[i], cur, cb);
+		else
+			out = segment_run(self, nodes + i, j - i, cur, cb);
+
+		gp_pixmap_free(tmp);
+
+		if (!out)
+			return NULL;
+
+		cur = tmp = out;
+		step.step++;
+	}
+
+	gp_progress_cb_done(callback);
+
+	return tmp;
+}
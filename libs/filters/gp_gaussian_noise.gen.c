@@ -0,0 +1,1512 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_gaussian_noise.gen.c
+ *
+ * GENERATED on 2026 10 19 20:29:12 from gp_gaussian_noise.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Gaussian Noise
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include "../../config.h"
+
+#ifdef HAVE_PTHREAD
+# include <pthread.h>
+#endif
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_clamp.h>
+#include <core/gp_debug.h>
+#include <core/gp_threads.h>
+
+#include <filters/gp_rand.h>
+#include <filters/gp_gaussian_noise.h>
+
+static int gaussian_noise_add_RGB101010(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_R = 1023 * sigma;
+	int mu_R = 1023 * mu;
+	int sigma_G = 1023 * sigma;
+	int mu_G = 1023 * mu;
+	int sigma_B = 1023 * sigma;
+	int mu_B = 1023 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(R, size, sigma_R, mu_R,
+		                seed, row * 3 + 0);
+		gp_norm_int_ctr(G, size, sigma_G, mu_G,
+		                seed, row * 3 + 1);
+		gp_norm_int_ctr(B, size, sigma_B, mu_B,
+		                seed, row * 3 + 2);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB101010(pix);
+			R[x] = GP_CLAMP(R[x], 0, 1023);
+			G[x] += GP_PIXEL_GET_G_RGB101010(pix);
+			G[x] = GP_CLAMP(G[x], 0, 1023);
+			B[x] += GP_PIXEL_GET_B_RGB101010(pix);
+			B[x] = GP_CLAMP(B[x], 0, 1023);
+
+			pix = GP_PIXEL_CREATE_RGB101010(R[x], G[x], B[x]);
+			gp_putpixel_raw_32BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_xRGB8888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_R = 255 * sigma;
+	int mu_R = 255 * mu;
+	int sigma_G = 255 * sigma;
+	int mu_G = 255 * mu;
+	int sigma_B = 255 * sigma;
+	int mu_B = 255 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(R, size, sigma_R, mu_R,
+		                seed, row * 3 + 0);
+		gp_norm_int_ctr(G, size, sigma_G, mu_G,
+		                seed, row * 3 + 1);
+		gp_norm_int_ctr(B, size, sigma_B, mu_B,
+		                seed, row * 3 + 2);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_xRGB8888(pix);
+			R[x] = GP_CLAMP(R[x], 0, 255);
+			G[x] += GP_PIXEL_GET_G_xRGB8888(pix);
+			G[x] = GP_CLAMP(G[x], 0, 255);
+			B[x] += GP_PIXEL_GET_B_xRGB8888(pix);
+			B[x] = GP_CLAMP(B[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_xRGB8888(R[x], G[x], B[x]);
+			gp_putpixel_raw_32BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGBA8888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_R = 255 * sigma;
+	int mu_R = 255 * mu;
+	int sigma_G = 255 * sigma;
+	int mu_G = 255 * mu;
+	int sigma_B = 255 * sigma;
+	int mu_B = 255 * mu;
+	int sigma_A = 255 * sigma;
+	int mu_A = 255 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 4);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(R, size, sigma_R, mu_R,
+		                seed, row * 4 + 0);
+		gp_norm_int_ctr(G, size, sigma_G, mu_G,
+		                seed, row * 4 + 1);
+		gp_norm_int_ctr(B, size, sigma_B, mu_B,
+		                seed, row * 4 + 2);
+		gp_norm_int_ctr(A, size, sigma_A, mu_A,
+		                seed, row * 4 + 3);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGBA8888(pix);
+			R[x] = GP_CLAMP(R[x], 0, 255);
+			G[x] += GP_PIXEL_GET_G_RGBA8888(pix);
+			G[x] = GP_CLAMP(G[x], 0, 255);
+			B[x] += GP_PIXEL_GET_B_RGBA8888(pix);
+			B[x] = GP_CLAMP(B[x], 0, 255);
+			A[x] += GP_PIXEL_GET_A_RGBA8888(pix);
+			A[x] = GP_CLAMP(A[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_RGBA8888(R[x], G[x], B[x], A[x]);
+			gp_putpixel_raw_32BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGB888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_R = 255 * sigma;
+	int mu_R = 255 * mu;
+	int sigma_G = 255 * sigma;
+	int mu_G = 255 * mu;
+	int sigma_B = 255 * sigma;
+	int mu_B = 255 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(R, size, sigma_R, mu_R,
+		                seed, row * 3 + 0);
+		gp_norm_int_ctr(G, size, sigma_G, mu_G,
+		                seed, row * 3 + 1);
+		gp_norm_int_ctr(B, size, sigma_B, mu_B,
+		                seed, row * 3 + 2);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB888(pix);
+			R[x] = GP_CLAMP(R[x], 0, 255);
+			G[x] += GP_PIXEL_GET_G_RGB888(pix);
+			G[x] = GP_CLAMP(G[x], 0, 255);
+			B[x] += GP_PIXEL_GET_B_RGB888(pix);
+			B[x] = GP_CLAMP(B[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_RGB888(R[x], G[x], B[x]);
+			gp_putpixel_raw_24BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_BGR888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_B = 255 * sigma;
+	int mu_B = 255 * mu;
+	int sigma_G = 255 * sigma;
+	int mu_G = 255 * mu;
+	int sigma_R = 255 * sigma;
+	int mu_R = 255 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(B, size, sigma_B, mu_B,
+		                seed, row * 3 + 0);
+		gp_norm_int_ctr(G, size, sigma_G, mu_G,
+		                seed, row * 3 + 1);
+		gp_norm_int_ctr(R, size, sigma_R, mu_R,
+		                seed, row * 3 + 2);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x + x_src, y + y_src);
+
+			B[x] += GP_PIXEL_GET_B_BGR888(pix);
+			B[x] = GP_CLAMP(B[x], 0, 255);
+			G[x] += GP_PIXEL_GET_G_BGR888(pix);
+			G[x] = GP_CLAMP(G[x], 0, 255);
+			R[x] += GP_PIXEL_GET_R_BGR888(pix);
+			R[x] = GP_CLAMP(R[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_BGR888(B[x], G[x], R[x]);
+			gp_putpixel_raw_24BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGB555(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_R = 31 * sigma;
+	int mu_R = 31 * mu;
+	int sigma_G = 31 * sigma;
+	int mu_G = 31 * mu;
+	int sigma_B = 31 * sigma;
+	int mu_B = 31 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(R, size, sigma_R, mu_R,
+		                seed, row * 3 + 0);
+		gp_norm_int_ctr(G, size, sigma_G, mu_G,
+		                seed, row * 3 + 1);
+		gp_norm_int_ctr(B, size, sigma_B, mu_B,
+		                seed, row * 3 + 2);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB555(pix);
+			R[x] = GP_CLAMP(R[x], 0, 31);
+			G[x] += GP_PIXEL_GET_G_RGB555(pix);
+			G[x] = GP_CLAMP(G[x], 0, 31);
+			B[x] += GP_PIXEL_GET_B_RGB555(pix);
+			B[x] = GP_CLAMP(B[x], 0, 31);
+
+			pix = GP_PIXEL_CREATE_RGB555(R[x], G[x], B[x]);
+			gp_putpixel_raw_16BPP_BE(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGB565_BE(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_R = 31 * sigma;
+	int mu_R = 31 * mu;
+	int sigma_G = 63 * sigma;
+	int mu_G = 63 * mu;
+	int sigma_B = 31 * sigma;
+	int mu_B = 31 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(R, size, sigma_R, mu_R,
+		                seed, row * 3 + 0);
+		gp_norm_int_ctr(G, size, sigma_G, mu_G,
+		                seed, row * 3 + 1);
+		gp_norm_int_ctr(B, size, sigma_B, mu_B,
+		                seed, row * 3 + 2);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB565_BE(pix);
+			R[x] = GP_CLAMP(R[x], 0, 31);
+			G[x] += GP_PIXEL_GET_G_RGB565_BE(pix);
+			G[x] = GP_CLAMP(G[x], 0, 63);
+			B[x] += GP_PIXEL_GET_B_RGB565_BE(pix);
+			B[x] = GP_CLAMP(B[x], 0, 31);
+
+			pix = GP_PIXEL_CREATE_RGB565_BE(R[x], G[x], B[x]);
+			gp_putpixel_raw_16BPP_BE(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGB565_LE(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_R = 31 * sigma;
+	int mu_R = 31 * mu;
+	int sigma_G = 63 * sigma;
+	int mu_G = 63 * mu;
+	int sigma_B = 31 * sigma;
+	int mu_B = 31 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(R, size, sigma_R, mu_R,
+		                seed, row * 3 + 0);
+		gp_norm_int_ctr(G, size, sigma_G, mu_G,
+		                seed, row * 3 + 1);
+		gp_norm_int_ctr(B, size, sigma_B, mu_B,
+		                seed, row * 3 + 2);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB565_LE(pix);
+			R[x] = GP_CLAMP(R[x], 0, 31);
+			G[x] += GP_PIXEL_GET_G_RGB565_LE(pix);
+			G[x] = GP_CLAMP(G[x], 0, 63);
+			B[x] += GP_PIXEL_GET_B_RGB565_LE(pix);
+			B[x] = GP_CLAMP(B[x], 0, 31);
+
+			pix = GP_PIXEL_CREATE_RGB565_LE(R[x], G[x], B[x]);
+			gp_putpixel_raw_16BPP_LE(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGB666(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_R = 63 * sigma;
+	int mu_R = 63 * mu;
+	int sigma_G = 63 * sigma;
+	int mu_G = 63 * mu;
+	int sigma_B = 63 * sigma;
+	int mu_B = 63 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(R, size, sigma_R, mu_R,
+		                seed, row * 3 + 0);
+		gp_norm_int_ctr(G, size, sigma_G, mu_G,
+		                seed, row * 3 + 1);
+		gp_norm_int_ctr(B, size, sigma_B, mu_B,
+		                seed, row * 3 + 2);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB666(pix);
+			R[x] = GP_CLAMP(R[x], 0, 63);
+			G[x] += GP_PIXEL_GET_G_RGB666(pix);
+			G[x] = GP_CLAMP(G[x], 0, 63);
+			B[x] += GP_PIXEL_GET_B_RGB666(pix);
+			B[x] = GP_CLAMP(B[x], 0, 63);
+
+			pix = GP_PIXEL_CREATE_RGB666(R[x], G[x], B[x]);
+			gp_putpixel_raw_18BPP_DB(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_RGB332(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_R = 7 * sigma;
+	int mu_R = 7 * mu;
+	int sigma_G = 7 * sigma;
+	int mu_G = 7 * mu;
+	int sigma_B = 3 * sigma;
+	int mu_B = 3 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 3);
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(R, size, sigma_R, mu_R,
+		                seed, row * 3 + 0);
+		gp_norm_int_ctr(G, size, sigma_G, mu_G,
+		                seed, row * 3 + 1);
+		gp_norm_int_ctr(B, size, sigma_B, mu_B,
+		                seed, row * 3 + 2);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x + x_src, y + y_src);
+
+			R[x] += GP_PIXEL_GET_R_RGB332(pix);
+			R[x] = GP_CLAMP(R[x], 0, 7);
+			G[x] += GP_PIXEL_GET_G_RGB332(pix);
+			G[x] = GP_CLAMP(G[x], 0, 7);
+			B[x] += GP_PIXEL_GET_B_RGB332(pix);
+			B[x] = GP_CLAMP(B[x], 0, 3);
+
+			pix = GP_PIXEL_CREATE_RGB332(R[x], G[x], B[x]);
+			gp_putpixel_raw_8BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_CMYK8888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_K = 255 * sigma;
+	int mu_K = 255 * mu;
+	int sigma_Y = 255 * sigma;
+	int mu_Y = 255 * mu;
+	int sigma_M = 255 * sigma;
+	int mu_M = 255 * mu;
+	int sigma_C = 255 * sigma;
+	int mu_C = 255 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 4);
+
+	int *K = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *Y = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *M = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *C = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(K, size, sigma_K, mu_K,
+		                seed, row * 4 + 0);
+		gp_norm_int_ctr(Y, size, sigma_Y, mu_Y,
+		                seed, row * 4 + 1);
+		gp_norm_int_ctr(M, size, sigma_M, mu_M,
+		                seed, row * 4 + 2);
+		gp_norm_int_ctr(C, size, sigma_C, mu_C,
+		                seed, row * 4 + 3);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x + x_src, y + y_src);
+
+			K[x] += GP_PIXEL_GET_K_CMYK8888(pix);
+			K[x] = GP_CLAMP(K[x], 0, 255);
+			Y[x] += GP_PIXEL_GET_Y_CMYK8888(pix);
+			Y[x] = GP_CLAMP(Y[x], 0, 255);
+			M[x] += GP_PIXEL_GET_M_CMYK8888(pix);
+			M[x] = GP_CLAMP(M[x], 0, 255);
+			C[x] += GP_PIXEL_GET_C_CMYK8888(pix);
+			C[x] = GP_CLAMP(C[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_CMYK8888(K[x], Y[x], M[x], C[x]);
+			gp_putpixel_raw_32BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G1_DB(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_V = 1 * sigma;
+	int mu_V = 1 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(V, size, sigma_V, mu_V,
+		                seed, row * 1 + 0);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G1_DB(pix);
+			V[x] = GP_CLAMP(V[x], 0, 1);
+
+			pix = GP_PIXEL_CREATE_G1_DB(V[x]);
+			gp_putpixel_raw_1BPP_DB(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G2_DB(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_V = 3 * sigma;
+	int mu_V = 3 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(V, size, sigma_V, mu_V,
+		                seed, row * 1 + 0);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G2_DB(pix);
+			V[x] = GP_CLAMP(V[x], 0, 3);
+
+			pix = GP_PIXEL_CREATE_G2_DB(V[x]);
+			gp_putpixel_raw_2BPP_DB(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G4_DB(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_V = 15 * sigma;
+	int mu_V = 15 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(V, size, sigma_V, mu_V,
+		                seed, row * 1 + 0);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G4_DB(pix);
+			V[x] = GP_CLAMP(V[x], 0, 15);
+
+			pix = GP_PIXEL_CREATE_G4_DB(V[x]);
+			gp_putpixel_raw_4BPP_DB(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G1_UB(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_V = 1 * sigma;
+	int mu_V = 1 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(V, size, sigma_V, mu_V,
+		                seed, row * 1 + 0);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G1_UB(pix);
+			V[x] = GP_CLAMP(V[x], 0, 1);
+
+			pix = GP_PIXEL_CREATE_G1_UB(V[x]);
+			gp_putpixel_raw_1BPP_UB(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G2_UB(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_V = 3 * sigma;
+	int mu_V = 3 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(V, size, sigma_V, mu_V,
+		                seed, row * 1 + 0);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G2_UB(pix);
+			V[x] = GP_CLAMP(V[x], 0, 3);
+
+			pix = GP_PIXEL_CREATE_G2_UB(V[x]);
+			gp_putpixel_raw_2BPP_UB(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G4_UB(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_V = 15 * sigma;
+	int mu_V = 15 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(V, size, sigma_V, mu_V,
+		                seed, row * 1 + 0);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G4_UB(pix);
+			V[x] = GP_CLAMP(V[x], 0, 15);
+
+			pix = GP_PIXEL_CREATE_G4_UB(V[x]);
+			gp_putpixel_raw_4BPP_UB(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G8(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_V = 255 * sigma;
+	int mu_V = 255 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(V, size, sigma_V, mu_V,
+		                seed, row * 1 + 0);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G8(pix);
+			V[x] = GP_CLAMP(V[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_G8(V[x]);
+			gp_putpixel_raw_8BPP(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_GA88(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_V = 255 * sigma;
+	int mu_V = 255 * mu;
+	int sigma_A = 255 * sigma;
+	int mu_A = 255 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 2);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(V, size, sigma_V, mu_V,
+		                seed, row * 2 + 0);
+		gp_norm_int_ctr(A, size, sigma_A, mu_A,
+		                seed, row * 2 + 1);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_GA88(pix);
+			V[x] = GP_CLAMP(V[x], 0, 255);
+			A[x] += GP_PIXEL_GET_A_GA88(pix);
+			A[x] = GP_CLAMP(A[x], 0, 255);
+
+			pix = GP_PIXEL_CREATE_GA88(V[x], A[x]);
+			gp_putpixel_raw_16BPP_LE(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add_G16(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float sigma, float mu, uint64_t seed,
+                                gp_progress_cb *callback)
+{
+	int sigma_V = 65535 * sigma;
+	int mu_V = 65535 * mu;
+
+	unsigned int size = (w_src + 3) & ~3u;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, sizeof(int) * size * 1);
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Apply the additive noise filter */
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
+		gp_norm_int_ctr(V, size, sigma_V, mu_V,
+		                seed, row * 1 + 0);
+
+		for (x = 0; x < w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, x + x_src, y + y_src);
+
+			V[x] += GP_PIXEL_GET_V_G16(pix);
+			V[x] = GP_CLAMP(V[x], 0, 65535);
+
+			pix = GP_PIXEL_CREATE_G16(V[x]);
+			gp_putpixel_raw_16BPP_LE(dst, x + x_dst, y + y_dst, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	return 0;
+}
+
+static int gaussian_noise_add(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              float sigma, float mu, uint64_t seed,
+                              gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return gaussian_noise_add_RGB101010(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_xRGB8888:
+		return gaussian_noise_add_xRGB8888(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return gaussian_noise_add_RGBA8888(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return gaussian_noise_add_RGB888(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return gaussian_noise_add_BGR888(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return gaussian_noise_add_RGB555(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_RGB565_BE:
+		return gaussian_noise_add_RGB565_BE(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_RGB565_LE:
+		return gaussian_noise_add_RGB565_LE(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return gaussian_noise_add_RGB666(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return gaussian_noise_add_RGB332(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return gaussian_noise_add_CMYK8888(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_G1_DB:
+		return gaussian_noise_add_G1_DB(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_G2_DB:
+		return gaussian_noise_add_G2_DB(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_G4_DB:
+		return gaussian_noise_add_G4_DB(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_G1_UB:
+		return gaussian_noise_add_G1_UB(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_G2_UB:
+		return gaussian_noise_add_G2_UB(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_G4_UB:
+		return gaussian_noise_add_G4_UB(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_G8:
+		return gaussian_noise_add_G8(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return gaussian_noise_add_GA88(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	case GP_PIXEL_G16:
+		return gaussian_noise_add_G16(src, x_src,
+				y_src, w_src, h_src, dst, x_dst, y_dst,
+				sigma, mu, seed, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+#ifdef HAVE_PTHREAD
+struct gaussian_noise_add_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	float sigma;
+	float mu;
+	uint64_t seed;
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
+
+static void *gaussian_noise_add_thread(void *arg)
+{
+	struct gaussian_noise_add_args *a = arg;
+
+	a->ret = gaussian_noise_add(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  a->sigma, a->mu, a->seed, a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int gaussian_noise_add_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       float sigma, float mu, uint64_t seed,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+	t = GP_MIN(t, h_src);
+
+	if (t <= 1) {
+		return gaussian_noise_add(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, sigma, mu, seed, callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct gaussian_noise_add_args args[t];
+	char started[t];
+	gp_size h = h_src / t;
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct gaussian_noise_add_args) {
+			.src = src,
+			.x_src = x_src,
+			.y_src = y_src + i * h,
+			.w_src = w_src,
+			.h_src = i == t - 1 ? h_src - i * h : h,
+			.dst = dst,
+			.x_dst = x_dst,
+			.y_dst = y_dst + i * h,
+			.sigma = sigma,
+			.mu = mu,
+			.seed = seed,
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, gaussian_noise_add_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			gaussian_noise_add_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+
+	return 0;
+}
+#else
+static int gaussian_noise_add_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       float sigma, float mu, uint64_t seed,
+                       gp_progress_cb *callback)
+{
+	return gaussian_noise_add(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, sigma, mu, seed, callback);
+}
+#endif /* HAVE_PTHREAD */
+
+int gp_filter_gaussian_noise_add_raw(const gp_pixmap *src,
+                                     gp_coord x_src, gp_coord y_src,
+                                     gp_size w_src, gp_size h_src,
+                                     gp_pixmap *dst,
+                                     gp_coord x_dst, gp_coord y_dst,
+                                     float sigma, float mu,
+                                     gp_progress_cb *callback)
+{
+	/*
+	 * The noise is a function of the seed and pixel coordinates, taking
+	 * the seed from random() keeps the output reproducible with srandom().
+	 */
+	uint64_t seed = ((uint64_t)random() << 32) ^ random();
+	int ret;
+
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	ret = gaussian_noise_add_mp(src, x_src, y_src, w_src, h_src,
+	                            dst, x_dst, y_dst, sigma, mu, seed, callback);
+	if (ret)
+		return ret;
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+int gp_filter_gaussian_noise_add_ex(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float sigma, float mu,
+                                    gp_progress_cb *callback)
+{
+	GP_CHECK(src->pixel_type == dst->pixel_type);
+
+	/* Check that destination is large enough */
+	GP_CHECK(x_dst + (gp_coord)w_src <= (gp_coord)dst->w);
+	GP_CHECK(y_dst + (gp_coord)h_src <= (gp_coord)dst->h);
+
+	/* Source is large enough */
+	GP_CHECK(x_src + w_src <= src->w);
+	GP_CHECK(y_src + h_src <= src->h);
+
+	return gp_filter_gaussian_noise_add_raw(src, x_src, y_src, w_src, h_src,
+	                                        dst, x_dst, y_dst,
+	                                        sigma, mu, callback);
+}
+
+gp_pixmap *gp_filter_gaussian_noise_add_ex_alloc(const gp_pixmap *src,
+                                                 gp_coord x_src, gp_coord y_src,
+                                                 gp_size w_src, gp_size h_src,
+                                                 float sigma, float mu,
+                                                 gp_progress_cb *callback)
+{
+	int ret, err;
+
+	gp_pixmap *dst = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (dst == NULL)
+		return NULL;
+
+	ret = gp_filter_gaussian_noise_add_raw(src, x_src, y_src, w_src, h_src,
+	                                      dst, 0, 0, sigma, mu, callback);
+
+	if (ret) {
+		err = errno;
+		gp_pixmap_free(dst);
+		errno = err;
+		return NULL;
+	}
+
+	return dst;
+}
@@ -1,4 +1,5 @@
 @ include source.t
+@ include thread_dispatcher.t
 /*
  * Gaussian Noise
  *
@@ -6,12 +7,20 @@
  */
 
 #include <errno.h>
+#include <stdlib.h>
+
+#include "../../config.h"
+
+#ifdef HAVE_PTHREAD
+# include <pthread.h>
+#endif
 
 #include <core/gp_pixmap.h>
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_temp_alloc.h>
 #include <core/gp_clamp.h>
 #include <core/gp_debug.h>
+#include <core/gp_threads.h>
 
 #include <filters/gp_rand.h>
 #include <filters/gp_gaussian_noise.h>
@@ -23,18 +32,15 @@ static int gaussian_noise_add_{{ pt.name }}(const gp_pixmap *src,
                                 gp_size w_src, gp_size h_src,
                                 gp_pixmap *dst,
                                 gp_coord x_dst, gp_coord y_dst,
-                                float sigma, float mu,
+                                float sigma, float mu, uint64_t seed,
                                 gp_progress_cb *callback)
 {
-	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
-	         w_src, h_src, sigma, mu);
-
 @         for c in pt.chanslist:
 	int sigma_{{ c.name }} = {{ c.max }} * sigma;
 	int mu_{{ c.name }} = {{ c.max }} * mu;
 @         end
 
-	unsigned int size = w_src + w_src%2;
+	unsigned int size = (w_src + 3) & ~3u;
 
 	/* Create temporary buffers */
 	gp_temp_alloc_create(temp, sizeof(int) * size * {{ len(pt.chanslist) }});
@@ -47,8 +53,12 @@ static int gaussian_noise_add_{{ pt.name }}(const gp_pixmap *src,
 	unsigned int x, y;
 
 	for (y = 0; y < h_src; y++) {
+		/* Seeded by the absolute row so that threads do not change the result */
+		uint64_t row = y_src + y;
+
 @         for c in pt.chanslist:
-		gp_norm_int({{ c.name }}, size, sigma_{{ c.name }}, mu_{{ c.name }});
+		gp_norm_int_ctr({{ c.name }}, size, sigma_{{ c.name }}, mu_{{ c.name }},
+		                seed, row * {{ len(pt.chanslist) }} + {{ c.idx }});
 @         end
 
 		for (x = 0; x < w_src; x++) {
@@ -71,20 +81,19 @@ static int gaussian_noise_add_{{ pt.name }}(const gp_pixmap *src,
 	}
 
 	gp_temp_alloc_free(temp);
-	gp_progress_cb_done(callback);
 
 	return 0;
 }
 
 @ end
 @
-int gp_filter_gaussian_noise_add_raw(const gp_pixmap *src,
-                                     gp_coord x_src, gp_coord y_src,
-                                     gp_size w_src, gp_size h_src,
-                                     gp_pixmap *dst,
-                                     gp_coord x_dst, gp_coord y_dst,
-                                     float sigma, float mu,
-                                     gp_progress_cb *callback)
+static int gaussian_noise_add(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              float sigma, float mu, uint64_t seed,
+                              gp_progress_cb *callback)
 {
 	switch (src->pixel_type) {
 @ for pt in pixeltypes:
@@ -92,7 +101,7 @@ int gp_filter_gaussian_noise_add_raw(const gp_pixmap *src,
 	case GP_PIXEL_{{ pt.name }}:
 		return gaussian_noise_add_{{ pt.name }}(src, x_src,
 				y_src, w_src, h_src, dst, x_dst, y_dst,
-				sigma, mu, callback);
+				sigma, mu, seed, callback);
 	break;
 @ end
 	default:
@@ -101,6 +110,36 @@ int gp_filter_gaussian_noise_add_raw(const gp_pixmap *src,
 	}
 }
 
+{@ dispatcher('gaussian_noise_add', [['float', 'sigma'], ['float', 'mu'], ['uint64_t', 'seed']], done=False) @}
+
+int gp_filter_gaussian_noise_add_raw(const gp_pixmap *src,
+                                     gp_coord x_src, gp_coord y_src,
+                                     gp_size w_src, gp_size h_src,
+                                     gp_pixmap *dst,
+                                     gp_coord x_dst, gp_coord y_dst,
+                                     float sigma, float mu,
+                                     gp_progress_cb *callback)
+{
+	/*
+	 * The noise is a function of the seed and pixel coordinates, taking
+	 * the seed from random() keeps the output reproducible with srandom().
+	 */
+	uint64_t seed = ((uint64_t)random() << 32) ^ random();
+	int ret;
+
+	GP_DEBUG(1, "Additive Gaussian noise filter %ux%u sigma=%f mu=%f",
+	         w_src, h_src, sigma, mu);
+
+	ret = gaussian_noise_add_mp(src, x_src, y_src, w_src, h_src,
+	                            dst, x_dst, y_dst, sigma, mu, seed, callback);
+	if (ret)
+		return ret;
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
 int gp_filter_gaussian_noise_add_ex(const gp_pixmap *src,
                                     gp_coord x_src, gp_coord y_src,
                                     gp_size w_src, gp_size h_src,
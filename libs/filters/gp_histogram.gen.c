@@ -0,0 +1,2677 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_histogram.gen.c
+ *
+ * GENERATED on 2026 10 19 20:27:23 from gp_histogram.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Histogram filter -- Compute image histogram
+ *
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "../../config.h"
+
+#ifdef HAVE_PTHREAD
+# include <pthread.h>
+#endif
+
+#include <core/gp_pixmap.h>
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+#include <filters/gp_filter.h>
+#include <filters/gp_stats.h>
+
+struct hist_ctx {
+	gp_histogram *hist;
+	/* Sampling grid origin and step */
+	gp_coord x0, y0;
+	unsigned int step;
+#ifdef HAVE_PTHREAD
+	pthread_mutex_t lock;
+#endif
+};
+
+/*
+ * Consecutive pixels are counted into interleaved sub-histograms, otherwise
+ * each increment on uniform areas would have to wait for the previous one to
+ * be stored. Channels larger than 8 bits use only one, the histograms would
+ * not fit into the cache anyway.
+ */
+#define SUB_HISTS 4
+
+static int histogram_RGB101010(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_R[1];
+	size += 1 * 1024;
+	uint32_t *hist_G[1];
+	size += 1 * 1024;
+	uint32_t *hist_B[1];
+	size += 1 * 1024;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < 1; i++) {
+		hist_R[i] = buf + size;
+		size += 1024;
+	}
+
+	for (i = 0; i < 1; i++) {
+		hist_G[i] = buf + size;
+		size += 1024;
+	}
+
+	for (i = 0; i < 1; i++) {
+		hist_B[i] = buf + size;
+		size += 1024;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_32BPP(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_32BPP(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_32BPP(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_32BPP(src, x_src + x + 3 * step, yi);
+
+			hist_R[0 % 1][GP_PIXEL_GET_R_RGB101010(pix0)]++;
+			hist_G[0 % 1][GP_PIXEL_GET_G_RGB101010(pix0)]++;
+			hist_B[0 % 1][GP_PIXEL_GET_B_RGB101010(pix0)]++;
+			hist_R[1 % 1][GP_PIXEL_GET_R_RGB101010(pix1)]++;
+			hist_G[1 % 1][GP_PIXEL_GET_G_RGB101010(pix1)]++;
+			hist_B[1 % 1][GP_PIXEL_GET_B_RGB101010(pix1)]++;
+			hist_R[2 % 1][GP_PIXEL_GET_R_RGB101010(pix2)]++;
+			hist_G[2 % 1][GP_PIXEL_GET_G_RGB101010(pix2)]++;
+			hist_B[2 % 1][GP_PIXEL_GET_B_RGB101010(pix2)]++;
+			hist_R[3 % 1][GP_PIXEL_GET_R_RGB101010(pix3)]++;
+			hist_G[3 % 1][GP_PIXEL_GET_G_RGB101010(pix3)]++;
+			hist_B[3 % 1][GP_PIXEL_GET_B_RGB101010(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x_src + x, yi);
+
+			hist_R[0][GP_PIXEL_GET_R_RGB101010(pix)]++;
+			hist_G[0][GP_PIXEL_GET_G_RGB101010(pix)]++;
+			hist_B[0][GP_PIXEL_GET_B_RGB101010(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 1024; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < 1; j++)
+			sum += hist_R[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 1024; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < 1; j++)
+			sum += hist_G[j][i];
+
+		ctx->hist->channels[1]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 1024; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < 1; j++)
+			sum += hist_B[j][i];
+
+		ctx->hist->channels[2]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_xRGB8888(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_R[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_G[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_B[SUB_HISTS];
+	size += SUB_HISTS * 256;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_R[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_G[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_B[i] = buf + size;
+		size += 256;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_32BPP(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_32BPP(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_32BPP(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_32BPP(src, x_src + x + 3 * step, yi);
+
+			hist_R[0 % SUB_HISTS][GP_PIXEL_GET_R_xRGB8888(pix0)]++;
+			hist_G[0 % SUB_HISTS][GP_PIXEL_GET_G_xRGB8888(pix0)]++;
+			hist_B[0 % SUB_HISTS][GP_PIXEL_GET_B_xRGB8888(pix0)]++;
+			hist_R[1 % SUB_HISTS][GP_PIXEL_GET_R_xRGB8888(pix1)]++;
+			hist_G[1 % SUB_HISTS][GP_PIXEL_GET_G_xRGB8888(pix1)]++;
+			hist_B[1 % SUB_HISTS][GP_PIXEL_GET_B_xRGB8888(pix1)]++;
+			hist_R[2 % SUB_HISTS][GP_PIXEL_GET_R_xRGB8888(pix2)]++;
+			hist_G[2 % SUB_HISTS][GP_PIXEL_GET_G_xRGB8888(pix2)]++;
+			hist_B[2 % SUB_HISTS][GP_PIXEL_GET_B_xRGB8888(pix2)]++;
+			hist_R[3 % SUB_HISTS][GP_PIXEL_GET_R_xRGB8888(pix3)]++;
+			hist_G[3 % SUB_HISTS][GP_PIXEL_GET_G_xRGB8888(pix3)]++;
+			hist_B[3 % SUB_HISTS][GP_PIXEL_GET_B_xRGB8888(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x_src + x, yi);
+
+			hist_R[0][GP_PIXEL_GET_R_xRGB8888(pix)]++;
+			hist_G[0][GP_PIXEL_GET_G_xRGB8888(pix)]++;
+			hist_B[0][GP_PIXEL_GET_B_xRGB8888(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_R[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_G[j][i];
+
+		ctx->hist->channels[1]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_B[j][i];
+
+		ctx->hist->channels[2]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_RGBA8888(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_R[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_G[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_B[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_A[SUB_HISTS];
+	size += SUB_HISTS * 256;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_R[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_G[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_B[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_A[i] = buf + size;
+		size += 256;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_32BPP(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_32BPP(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_32BPP(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_32BPP(src, x_src + x + 3 * step, yi);
+
+			hist_R[0 % SUB_HISTS][GP_PIXEL_GET_R_RGBA8888(pix0)]++;
+			hist_G[0 % SUB_HISTS][GP_PIXEL_GET_G_RGBA8888(pix0)]++;
+			hist_B[0 % SUB_HISTS][GP_PIXEL_GET_B_RGBA8888(pix0)]++;
+			hist_A[0 % SUB_HISTS][GP_PIXEL_GET_A_RGBA8888(pix0)]++;
+			hist_R[1 % SUB_HISTS][GP_PIXEL_GET_R_RGBA8888(pix1)]++;
+			hist_G[1 % SUB_HISTS][GP_PIXEL_GET_G_RGBA8888(pix1)]++;
+			hist_B[1 % SUB_HISTS][GP_PIXEL_GET_B_RGBA8888(pix1)]++;
+			hist_A[1 % SUB_HISTS][GP_PIXEL_GET_A_RGBA8888(pix1)]++;
+			hist_R[2 % SUB_HISTS][GP_PIXEL_GET_R_RGBA8888(pix2)]++;
+			hist_G[2 % SUB_HISTS][GP_PIXEL_GET_G_RGBA8888(pix2)]++;
+			hist_B[2 % SUB_HISTS][GP_PIXEL_GET_B_RGBA8888(pix2)]++;
+			hist_A[2 % SUB_HISTS][GP_PIXEL_GET_A_RGBA8888(pix2)]++;
+			hist_R[3 % SUB_HISTS][GP_PIXEL_GET_R_RGBA8888(pix3)]++;
+			hist_G[3 % SUB_HISTS][GP_PIXEL_GET_G_RGBA8888(pix3)]++;
+			hist_B[3 % SUB_HISTS][GP_PIXEL_GET_B_RGBA8888(pix3)]++;
+			hist_A[3 % SUB_HISTS][GP_PIXEL_GET_A_RGBA8888(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x_src + x, yi);
+
+			hist_R[0][GP_PIXEL_GET_R_RGBA8888(pix)]++;
+			hist_G[0][GP_PIXEL_GET_G_RGBA8888(pix)]++;
+			hist_B[0][GP_PIXEL_GET_B_RGBA8888(pix)]++;
+			hist_A[0][GP_PIXEL_GET_A_RGBA8888(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_R[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_G[j][i];
+
+		ctx->hist->channels[1]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_B[j][i];
+
+		ctx->hist->channels[2]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_A[j][i];
+
+		ctx->hist->channels[3]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_RGB888(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_R[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_G[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_B[SUB_HISTS];
+	size += SUB_HISTS * 256;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_R[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_G[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_B[i] = buf + size;
+		size += 256;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_24BPP(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_24BPP(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_24BPP(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_24BPP(src, x_src + x + 3 * step, yi);
+
+			hist_R[0 % SUB_HISTS][GP_PIXEL_GET_R_RGB888(pix0)]++;
+			hist_G[0 % SUB_HISTS][GP_PIXEL_GET_G_RGB888(pix0)]++;
+			hist_B[0 % SUB_HISTS][GP_PIXEL_GET_B_RGB888(pix0)]++;
+			hist_R[1 % SUB_HISTS][GP_PIXEL_GET_R_RGB888(pix1)]++;
+			hist_G[1 % SUB_HISTS][GP_PIXEL_GET_G_RGB888(pix1)]++;
+			hist_B[1 % SUB_HISTS][GP_PIXEL_GET_B_RGB888(pix1)]++;
+			hist_R[2 % SUB_HISTS][GP_PIXEL_GET_R_RGB888(pix2)]++;
+			hist_G[2 % SUB_HISTS][GP_PIXEL_GET_G_RGB888(pix2)]++;
+			hist_B[2 % SUB_HISTS][GP_PIXEL_GET_B_RGB888(pix2)]++;
+			hist_R[3 % SUB_HISTS][GP_PIXEL_GET_R_RGB888(pix3)]++;
+			hist_G[3 % SUB_HISTS][GP_PIXEL_GET_G_RGB888(pix3)]++;
+			hist_B[3 % SUB_HISTS][GP_PIXEL_GET_B_RGB888(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x_src + x, yi);
+
+			hist_R[0][GP_PIXEL_GET_R_RGB888(pix)]++;
+			hist_G[0][GP_PIXEL_GET_G_RGB888(pix)]++;
+			hist_B[0][GP_PIXEL_GET_B_RGB888(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_R[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_G[j][i];
+
+		ctx->hist->channels[1]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_B[j][i];
+
+		ctx->hist->channels[2]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_BGR888(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_B[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_G[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_R[SUB_HISTS];
+	size += SUB_HISTS * 256;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_B[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_G[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_R[i] = buf + size;
+		size += 256;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_24BPP(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_24BPP(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_24BPP(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_24BPP(src, x_src + x + 3 * step, yi);
+
+			hist_B[0 % SUB_HISTS][GP_PIXEL_GET_B_BGR888(pix0)]++;
+			hist_G[0 % SUB_HISTS][GP_PIXEL_GET_G_BGR888(pix0)]++;
+			hist_R[0 % SUB_HISTS][GP_PIXEL_GET_R_BGR888(pix0)]++;
+			hist_B[1 % SUB_HISTS][GP_PIXEL_GET_B_BGR888(pix1)]++;
+			hist_G[1 % SUB_HISTS][GP_PIXEL_GET_G_BGR888(pix1)]++;
+			hist_R[1 % SUB_HISTS][GP_PIXEL_GET_R_BGR888(pix1)]++;
+			hist_B[2 % SUB_HISTS][GP_PIXEL_GET_B_BGR888(pix2)]++;
+			hist_G[2 % SUB_HISTS][GP_PIXEL_GET_G_BGR888(pix2)]++;
+			hist_R[2 % SUB_HISTS][GP_PIXEL_GET_R_BGR888(pix2)]++;
+			hist_B[3 % SUB_HISTS][GP_PIXEL_GET_B_BGR888(pix3)]++;
+			hist_G[3 % SUB_HISTS][GP_PIXEL_GET_G_BGR888(pix3)]++;
+			hist_R[3 % SUB_HISTS][GP_PIXEL_GET_R_BGR888(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x_src + x, yi);
+
+			hist_B[0][GP_PIXEL_GET_B_BGR888(pix)]++;
+			hist_G[0][GP_PIXEL_GET_G_BGR888(pix)]++;
+			hist_R[0][GP_PIXEL_GET_R_BGR888(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_B[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_G[j][i];
+
+		ctx->hist->channels[1]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_R[j][i];
+
+		ctx->hist->channels[2]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_RGB555(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_R[SUB_HISTS];
+	size += SUB_HISTS * 32;
+	uint32_t *hist_G[SUB_HISTS];
+	size += SUB_HISTS * 32;
+	uint32_t *hist_B[SUB_HISTS];
+	size += SUB_HISTS * 32;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_R[i] = buf + size;
+		size += 32;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_G[i] = buf + size;
+		size += 32;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_B[i] = buf + size;
+		size += 32;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_16BPP_BE(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_16BPP_BE(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_16BPP_BE(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_16BPP_BE(src, x_src + x + 3 * step, yi);
+
+			hist_R[0 % SUB_HISTS][GP_PIXEL_GET_R_RGB555(pix0)]++;
+			hist_G[0 % SUB_HISTS][GP_PIXEL_GET_G_RGB555(pix0)]++;
+			hist_B[0 % SUB_HISTS][GP_PIXEL_GET_B_RGB555(pix0)]++;
+			hist_R[1 % SUB_HISTS][GP_PIXEL_GET_R_RGB555(pix1)]++;
+			hist_G[1 % SUB_HISTS][GP_PIXEL_GET_G_RGB555(pix1)]++;
+			hist_B[1 % SUB_HISTS][GP_PIXEL_GET_B_RGB555(pix1)]++;
+			hist_R[2 % SUB_HISTS][GP_PIXEL_GET_R_RGB555(pix2)]++;
+			hist_G[2 % SUB_HISTS][GP_PIXEL_GET_G_RGB555(pix2)]++;
+			hist_B[2 % SUB_HISTS][GP_PIXEL_GET_B_RGB555(pix2)]++;
+			hist_R[3 % SUB_HISTS][GP_PIXEL_GET_R_RGB555(pix3)]++;
+			hist_G[3 % SUB_HISTS][GP_PIXEL_GET_G_RGB555(pix3)]++;
+			hist_B[3 % SUB_HISTS][GP_PIXEL_GET_B_RGB555(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, x_src + x, yi);
+
+			hist_R[0][GP_PIXEL_GET_R_RGB555(pix)]++;
+			hist_G[0][GP_PIXEL_GET_G_RGB555(pix)]++;
+			hist_B[0][GP_PIXEL_GET_B_RGB555(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 32; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_R[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 32; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_G[j][i];
+
+		ctx->hist->channels[1]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 32; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_B[j][i];
+
+		ctx->hist->channels[2]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_RGB565_BE(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_R[SUB_HISTS];
+	size += SUB_HISTS * 32;
+	uint32_t *hist_G[SUB_HISTS];
+	size += SUB_HISTS * 64;
+	uint32_t *hist_B[SUB_HISTS];
+	size += SUB_HISTS * 32;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_R[i] = buf + size;
+		size += 32;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_G[i] = buf + size;
+		size += 64;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_B[i] = buf + size;
+		size += 32;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_16BPP_BE(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_16BPP_BE(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_16BPP_BE(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_16BPP_BE(src, x_src + x + 3 * step, yi);
+
+			hist_R[0 % SUB_HISTS][GP_PIXEL_GET_R_RGB565_BE(pix0)]++;
+			hist_G[0 % SUB_HISTS][GP_PIXEL_GET_G_RGB565_BE(pix0)]++;
+			hist_B[0 % SUB_HISTS][GP_PIXEL_GET_B_RGB565_BE(pix0)]++;
+			hist_R[1 % SUB_HISTS][GP_PIXEL_GET_R_RGB565_BE(pix1)]++;
+			hist_G[1 % SUB_HISTS][GP_PIXEL_GET_G_RGB565_BE(pix1)]++;
+			hist_B[1 % SUB_HISTS][GP_PIXEL_GET_B_RGB565_BE(pix1)]++;
+			hist_R[2 % SUB_HISTS][GP_PIXEL_GET_R_RGB565_BE(pix2)]++;
+			hist_G[2 % SUB_HISTS][GP_PIXEL_GET_G_RGB565_BE(pix2)]++;
+			hist_B[2 % SUB_HISTS][GP_PIXEL_GET_B_RGB565_BE(pix2)]++;
+			hist_R[3 % SUB_HISTS][GP_PIXEL_GET_R_RGB565_BE(pix3)]++;
+			hist_G[3 % SUB_HISTS][GP_PIXEL_GET_G_RGB565_BE(pix3)]++;
+			hist_B[3 % SUB_HISTS][GP_PIXEL_GET_B_RGB565_BE(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, x_src + x, yi);
+
+			hist_R[0][GP_PIXEL_GET_R_RGB565_BE(pix)]++;
+			hist_G[0][GP_PIXEL_GET_G_RGB565_BE(pix)]++;
+			hist_B[0][GP_PIXEL_GET_B_RGB565_BE(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 32; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_R[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 64; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_G[j][i];
+
+		ctx->hist->channels[1]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 32; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_B[j][i];
+
+		ctx->hist->channels[2]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_RGB565_LE(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_R[SUB_HISTS];
+	size += SUB_HISTS * 32;
+	uint32_t *hist_G[SUB_HISTS];
+	size += SUB_HISTS * 64;
+	uint32_t *hist_B[SUB_HISTS];
+	size += SUB_HISTS * 32;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_R[i] = buf + size;
+		size += 32;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_G[i] = buf + size;
+		size += 64;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_B[i] = buf + size;
+		size += 32;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_16BPP_LE(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_16BPP_LE(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_16BPP_LE(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_16BPP_LE(src, x_src + x + 3 * step, yi);
+
+			hist_R[0 % SUB_HISTS][GP_PIXEL_GET_R_RGB565_LE(pix0)]++;
+			hist_G[0 % SUB_HISTS][GP_PIXEL_GET_G_RGB565_LE(pix0)]++;
+			hist_B[0 % SUB_HISTS][GP_PIXEL_GET_B_RGB565_LE(pix0)]++;
+			hist_R[1 % SUB_HISTS][GP_PIXEL_GET_R_RGB565_LE(pix1)]++;
+			hist_G[1 % SUB_HISTS][GP_PIXEL_GET_G_RGB565_LE(pix1)]++;
+			hist_B[1 % SUB_HISTS][GP_PIXEL_GET_B_RGB565_LE(pix1)]++;
+			hist_R[2 % SUB_HISTS][GP_PIXEL_GET_R_RGB565_LE(pix2)]++;
+			hist_G[2 % SUB_HISTS][GP_PIXEL_GET_G_RGB565_LE(pix2)]++;
+			hist_B[2 % SUB_HISTS][GP_PIXEL_GET_B_RGB565_LE(pix2)]++;
+			hist_R[3 % SUB_HISTS][GP_PIXEL_GET_R_RGB565_LE(pix3)]++;
+			hist_G[3 % SUB_HISTS][GP_PIXEL_GET_G_RGB565_LE(pix3)]++;
+			hist_B[3 % SUB_HISTS][GP_PIXEL_GET_B_RGB565_LE(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, x_src + x, yi);
+
+			hist_R[0][GP_PIXEL_GET_R_RGB565_LE(pix)]++;
+			hist_G[0][GP_PIXEL_GET_G_RGB565_LE(pix)]++;
+			hist_B[0][GP_PIXEL_GET_B_RGB565_LE(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 32; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_R[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 64; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_G[j][i];
+
+		ctx->hist->channels[1]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 32; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_B[j][i];
+
+		ctx->hist->channels[2]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_RGB666(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_R[SUB_HISTS];
+	size += SUB_HISTS * 64;
+	uint32_t *hist_G[SUB_HISTS];
+	size += SUB_HISTS * 64;
+	uint32_t *hist_B[SUB_HISTS];
+	size += SUB_HISTS * 64;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_R[i] = buf + size;
+		size += 64;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_G[i] = buf + size;
+		size += 64;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_B[i] = buf + size;
+		size += 64;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_18BPP_DB(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_18BPP_DB(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_18BPP_DB(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_18BPP_DB(src, x_src + x + 3 * step, yi);
+
+			hist_R[0 % SUB_HISTS][GP_PIXEL_GET_R_RGB666(pix0)]++;
+			hist_G[0 % SUB_HISTS][GP_PIXEL_GET_G_RGB666(pix0)]++;
+			hist_B[0 % SUB_HISTS][GP_PIXEL_GET_B_RGB666(pix0)]++;
+			hist_R[1 % SUB_HISTS][GP_PIXEL_GET_R_RGB666(pix1)]++;
+			hist_G[1 % SUB_HISTS][GP_PIXEL_GET_G_RGB666(pix1)]++;
+			hist_B[1 % SUB_HISTS][GP_PIXEL_GET_B_RGB666(pix1)]++;
+			hist_R[2 % SUB_HISTS][GP_PIXEL_GET_R_RGB666(pix2)]++;
+			hist_G[2 % SUB_HISTS][GP_PIXEL_GET_G_RGB666(pix2)]++;
+			hist_B[2 % SUB_HISTS][GP_PIXEL_GET_B_RGB666(pix2)]++;
+			hist_R[3 % SUB_HISTS][GP_PIXEL_GET_R_RGB666(pix3)]++;
+			hist_G[3 % SUB_HISTS][GP_PIXEL_GET_G_RGB666(pix3)]++;
+			hist_B[3 % SUB_HISTS][GP_PIXEL_GET_B_RGB666(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, x_src + x, yi);
+
+			hist_R[0][GP_PIXEL_GET_R_RGB666(pix)]++;
+			hist_G[0][GP_PIXEL_GET_G_RGB666(pix)]++;
+			hist_B[0][GP_PIXEL_GET_B_RGB666(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 64; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_R[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 64; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_G[j][i];
+
+		ctx->hist->channels[1]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 64; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_B[j][i];
+
+		ctx->hist->channels[2]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_RGB332(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_R[SUB_HISTS];
+	size += SUB_HISTS * 8;
+	uint32_t *hist_G[SUB_HISTS];
+	size += SUB_HISTS * 8;
+	uint32_t *hist_B[SUB_HISTS];
+	size += SUB_HISTS * 4;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_R[i] = buf + size;
+		size += 8;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_G[i] = buf + size;
+		size += 8;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_B[i] = buf + size;
+		size += 4;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_8BPP(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_8BPP(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_8BPP(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_8BPP(src, x_src + x + 3 * step, yi);
+
+			hist_R[0 % SUB_HISTS][GP_PIXEL_GET_R_RGB332(pix0)]++;
+			hist_G[0 % SUB_HISTS][GP_PIXEL_GET_G_RGB332(pix0)]++;
+			hist_B[0 % SUB_HISTS][GP_PIXEL_GET_B_RGB332(pix0)]++;
+			hist_R[1 % SUB_HISTS][GP_PIXEL_GET_R_RGB332(pix1)]++;
+			hist_G[1 % SUB_HISTS][GP_PIXEL_GET_G_RGB332(pix1)]++;
+			hist_B[1 % SUB_HISTS][GP_PIXEL_GET_B_RGB332(pix1)]++;
+			hist_R[2 % SUB_HISTS][GP_PIXEL_GET_R_RGB332(pix2)]++;
+			hist_G[2 % SUB_HISTS][GP_PIXEL_GET_G_RGB332(pix2)]++;
+			hist_B[2 % SUB_HISTS][GP_PIXEL_GET_B_RGB332(pix2)]++;
+			hist_R[3 % SUB_HISTS][GP_PIXEL_GET_R_RGB332(pix3)]++;
+			hist_G[3 % SUB_HISTS][GP_PIXEL_GET_G_RGB332(pix3)]++;
+			hist_B[3 % SUB_HISTS][GP_PIXEL_GET_B_RGB332(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x_src + x, yi);
+
+			hist_R[0][GP_PIXEL_GET_R_RGB332(pix)]++;
+			hist_G[0][GP_PIXEL_GET_G_RGB332(pix)]++;
+			hist_B[0][GP_PIXEL_GET_B_RGB332(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 8; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_R[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 8; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_G[j][i];
+
+		ctx->hist->channels[1]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 4; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_B[j][i];
+
+		ctx->hist->channels[2]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_CMYK8888(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_K[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_Y[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_M[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_C[SUB_HISTS];
+	size += SUB_HISTS * 256;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_K[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_Y[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_M[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_C[i] = buf + size;
+		size += 256;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_32BPP(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_32BPP(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_32BPP(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_32BPP(src, x_src + x + 3 * step, yi);
+
+			hist_K[0 % SUB_HISTS][GP_PIXEL_GET_K_CMYK8888(pix0)]++;
+			hist_Y[0 % SUB_HISTS][GP_PIXEL_GET_Y_CMYK8888(pix0)]++;
+			hist_M[0 % SUB_HISTS][GP_PIXEL_GET_M_CMYK8888(pix0)]++;
+			hist_C[0 % SUB_HISTS][GP_PIXEL_GET_C_CMYK8888(pix0)]++;
+			hist_K[1 % SUB_HISTS][GP_PIXEL_GET_K_CMYK8888(pix1)]++;
+			hist_Y[1 % SUB_HISTS][GP_PIXEL_GET_Y_CMYK8888(pix1)]++;
+			hist_M[1 % SUB_HISTS][GP_PIXEL_GET_M_CMYK8888(pix1)]++;
+			hist_C[1 % SUB_HISTS][GP_PIXEL_GET_C_CMYK8888(pix1)]++;
+			hist_K[2 % SUB_HISTS][GP_PIXEL_GET_K_CMYK8888(pix2)]++;
+			hist_Y[2 % SUB_HISTS][GP_PIXEL_GET_Y_CMYK8888(pix2)]++;
+			hist_M[2 % SUB_HISTS][GP_PIXEL_GET_M_CMYK8888(pix2)]++;
+			hist_C[2 % SUB_HISTS][GP_PIXEL_GET_C_CMYK8888(pix2)]++;
+			hist_K[3 % SUB_HISTS][GP_PIXEL_GET_K_CMYK8888(pix3)]++;
+			hist_Y[3 % SUB_HISTS][GP_PIXEL_GET_Y_CMYK8888(pix3)]++;
+			hist_M[3 % SUB_HISTS][GP_PIXEL_GET_M_CMYK8888(pix3)]++;
+			hist_C[3 % SUB_HISTS][GP_PIXEL_GET_C_CMYK8888(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x_src + x, yi);
+
+			hist_K[0][GP_PIXEL_GET_K_CMYK8888(pix)]++;
+			hist_Y[0][GP_PIXEL_GET_Y_CMYK8888(pix)]++;
+			hist_M[0][GP_PIXEL_GET_M_CMYK8888(pix)]++;
+			hist_C[0][GP_PIXEL_GET_C_CMYK8888(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_K[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_Y[j][i];
+
+		ctx->hist->channels[1]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_M[j][i];
+
+		ctx->hist->channels[2]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_C[j][i];
+
+		ctx->hist->channels[3]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_G1_DB(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_V[SUB_HISTS];
+	size += SUB_HISTS * 2;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_V[i] = buf + size;
+		size += 2;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_1BPP_DB(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_1BPP_DB(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_1BPP_DB(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_1BPP_DB(src, x_src + x + 3 * step, yi);
+
+			hist_V[0 % SUB_HISTS][GP_PIXEL_GET_V_G1_DB(pix0)]++;
+			hist_V[1 % SUB_HISTS][GP_PIXEL_GET_V_G1_DB(pix1)]++;
+			hist_V[2 % SUB_HISTS][GP_PIXEL_GET_V_G1_DB(pix2)]++;
+			hist_V[3 % SUB_HISTS][GP_PIXEL_GET_V_G1_DB(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, x_src + x, yi);
+
+			hist_V[0][GP_PIXEL_GET_V_G1_DB(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 2; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_V[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_G2_DB(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_V[SUB_HISTS];
+	size += SUB_HISTS * 4;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_V[i] = buf + size;
+		size += 4;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_2BPP_DB(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_2BPP_DB(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_2BPP_DB(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_2BPP_DB(src, x_src + x + 3 * step, yi);
+
+			hist_V[0 % SUB_HISTS][GP_PIXEL_GET_V_G2_DB(pix0)]++;
+			hist_V[1 % SUB_HISTS][GP_PIXEL_GET_V_G2_DB(pix1)]++;
+			hist_V[2 % SUB_HISTS][GP_PIXEL_GET_V_G2_DB(pix2)]++;
+			hist_V[3 % SUB_HISTS][GP_PIXEL_GET_V_G2_DB(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, x_src + x, yi);
+
+			hist_V[0][GP_PIXEL_GET_V_G2_DB(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 4; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_V[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_G4_DB(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_V[SUB_HISTS];
+	size += SUB_HISTS * 16;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_V[i] = buf + size;
+		size += 16;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_4BPP_DB(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_4BPP_DB(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_4BPP_DB(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_4BPP_DB(src, x_src + x + 3 * step, yi);
+
+			hist_V[0 % SUB_HISTS][GP_PIXEL_GET_V_G4_DB(pix0)]++;
+			hist_V[1 % SUB_HISTS][GP_PIXEL_GET_V_G4_DB(pix1)]++;
+			hist_V[2 % SUB_HISTS][GP_PIXEL_GET_V_G4_DB(pix2)]++;
+			hist_V[3 % SUB_HISTS][GP_PIXEL_GET_V_G4_DB(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, x_src + x, yi);
+
+			hist_V[0][GP_PIXEL_GET_V_G4_DB(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 16; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_V[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_G1_UB(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_V[SUB_HISTS];
+	size += SUB_HISTS * 2;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_V[i] = buf + size;
+		size += 2;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_1BPP_UB(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_1BPP_UB(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_1BPP_UB(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_1BPP_UB(src, x_src + x + 3 * step, yi);
+
+			hist_V[0 % SUB_HISTS][GP_PIXEL_GET_V_G1_UB(pix0)]++;
+			hist_V[1 % SUB_HISTS][GP_PIXEL_GET_V_G1_UB(pix1)]++;
+			hist_V[2 % SUB_HISTS][GP_PIXEL_GET_V_G1_UB(pix2)]++;
+			hist_V[3 % SUB_HISTS][GP_PIXEL_GET_V_G1_UB(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, x_src + x, yi);
+
+			hist_V[0][GP_PIXEL_GET_V_G1_UB(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 2; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_V[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_G2_UB(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_V[SUB_HISTS];
+	size += SUB_HISTS * 4;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_V[i] = buf + size;
+		size += 4;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_2BPP_UB(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_2BPP_UB(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_2BPP_UB(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_2BPP_UB(src, x_src + x + 3 * step, yi);
+
+			hist_V[0 % SUB_HISTS][GP_PIXEL_GET_V_G2_UB(pix0)]++;
+			hist_V[1 % SUB_HISTS][GP_PIXEL_GET_V_G2_UB(pix1)]++;
+			hist_V[2 % SUB_HISTS][GP_PIXEL_GET_V_G2_UB(pix2)]++;
+			hist_V[3 % SUB_HISTS][GP_PIXEL_GET_V_G2_UB(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, x_src + x, yi);
+
+			hist_V[0][GP_PIXEL_GET_V_G2_UB(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 4; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_V[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_G4_UB(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_V[SUB_HISTS];
+	size += SUB_HISTS * 16;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_V[i] = buf + size;
+		size += 16;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_4BPP_UB(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_4BPP_UB(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_4BPP_UB(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_4BPP_UB(src, x_src + x + 3 * step, yi);
+
+			hist_V[0 % SUB_HISTS][GP_PIXEL_GET_V_G4_UB(pix0)]++;
+			hist_V[1 % SUB_HISTS][GP_PIXEL_GET_V_G4_UB(pix1)]++;
+			hist_V[2 % SUB_HISTS][GP_PIXEL_GET_V_G4_UB(pix2)]++;
+			hist_V[3 % SUB_HISTS][GP_PIXEL_GET_V_G4_UB(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, x_src + x, yi);
+
+			hist_V[0][GP_PIXEL_GET_V_G4_UB(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 16; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_V[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_G8(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_V[SUB_HISTS];
+	size += SUB_HISTS * 256;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_V[i] = buf + size;
+		size += 256;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_8BPP(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_8BPP(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_8BPP(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_8BPP(src, x_src + x + 3 * step, yi);
+
+			hist_V[0 % SUB_HISTS][GP_PIXEL_GET_V_G8(pix0)]++;
+			hist_V[1 % SUB_HISTS][GP_PIXEL_GET_V_G8(pix1)]++;
+			hist_V[2 % SUB_HISTS][GP_PIXEL_GET_V_G8(pix2)]++;
+			hist_V[3 % SUB_HISTS][GP_PIXEL_GET_V_G8(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x_src + x, yi);
+
+			hist_V[0][GP_PIXEL_GET_V_G8(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_V[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_GA88(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_V[SUB_HISTS];
+	size += SUB_HISTS * 256;
+	uint32_t *hist_A[SUB_HISTS];
+	size += SUB_HISTS * 256;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_V[i] = buf + size;
+		size += 256;
+	}
+
+	for (i = 0; i < SUB_HISTS; i++) {
+		hist_A[i] = buf + size;
+		size += 256;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_16BPP_LE(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_16BPP_LE(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_16BPP_LE(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_16BPP_LE(src, x_src + x + 3 * step, yi);
+
+			hist_V[0 % SUB_HISTS][GP_PIXEL_GET_V_GA88(pix0)]++;
+			hist_A[0 % SUB_HISTS][GP_PIXEL_GET_A_GA88(pix0)]++;
+			hist_V[1 % SUB_HISTS][GP_PIXEL_GET_V_GA88(pix1)]++;
+			hist_A[1 % SUB_HISTS][GP_PIXEL_GET_A_GA88(pix1)]++;
+			hist_V[2 % SUB_HISTS][GP_PIXEL_GET_V_GA88(pix2)]++;
+			hist_A[2 % SUB_HISTS][GP_PIXEL_GET_A_GA88(pix2)]++;
+			hist_V[3 % SUB_HISTS][GP_PIXEL_GET_V_GA88(pix3)]++;
+			hist_A[3 % SUB_HISTS][GP_PIXEL_GET_A_GA88(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, x_src + x, yi);
+
+			hist_V[0][GP_PIXEL_GET_V_GA88(pix)]++;
+			hist_A[0][GP_PIXEL_GET_A_GA88(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_V[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+	for (i = 0; i < 256; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < SUB_HISTS; j++)
+			sum += hist_A[j][i];
+
+		ctx->hist->channels[1]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram_G16(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
+{
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	uint32_t *hist_V[1];
+	size += 1 * 65536;
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	size = 0;
+
+	for (i = 0; i < 1; i++) {
+		hist_V[i] = buf + size;
+		size += 65536;
+	}
+
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
+
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+			gp_pixel pix0 = gp_getpixel_raw_16BPP_LE(src, x_src + x + 0 * step, yi);
+			gp_pixel pix1 = gp_getpixel_raw_16BPP_LE(src, x_src + x + 1 * step, yi);
+			gp_pixel pix2 = gp_getpixel_raw_16BPP_LE(src, x_src + x + 2 * step, yi);
+			gp_pixel pix3 = gp_getpixel_raw_16BPP_LE(src, x_src + x + 3 * step, yi);
+
+			hist_V[0 % 1][GP_PIXEL_GET_V_G16(pix0)]++;
+			hist_V[1 % 1][GP_PIXEL_GET_V_G16(pix1)]++;
+			hist_V[2 % 1][GP_PIXEL_GET_V_G16(pix2)]++;
+			hist_V[3 % 1][GP_PIXEL_GET_V_G16(pix3)]++;
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, x_src + x, yi);
+
+			hist_V[0][GP_PIXEL_GET_V_G16(pix)]++;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
+
+	for (i = 0; i < 65536; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
+
+		for (j = 0; j < 1; j++)
+			sum += hist_V[j][i];
+
+		ctx->hist->channels[0]->hist[i] += sum;
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+static int histogram(const gp_pixmap *src,
+                     gp_coord x_src, gp_coord y_src,
+                     gp_size w_src, gp_size h_src,
+                     gp_pixmap *dst,
+                     gp_coord x_dst, gp_coord y_dst,
+                     struct hist_ctx *ctx,
+                     gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return histogram_RGB101010(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_xRGB8888:
+		return histogram_xRGB8888(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_RGBA8888:
+		return histogram_RGBA8888(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_RGB888:
+		return histogram_RGB888(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_BGR888:
+		return histogram_BGR888(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_RGB555:
+		return histogram_RGB555(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_RGB565_BE:
+		return histogram_RGB565_BE(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_RGB565_LE:
+		return histogram_RGB565_LE(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_RGB666:
+		return histogram_RGB666(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_RGB332:
+		return histogram_RGB332(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_CMYK8888:
+		return histogram_CMYK8888(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_G1_DB:
+		return histogram_G1_DB(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_G2_DB:
+		return histogram_G2_DB(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_G4_DB:
+		return histogram_G4_DB(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_G1_UB:
+		return histogram_G1_UB(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_G2_UB:
+		return histogram_G2_UB(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_G4_UB:
+		return histogram_G4_UB(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_G8:
+		return histogram_G8(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_GA88:
+		return histogram_GA88(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	case GP_PIXEL_G16:
+		return histogram_G16(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
+	default:
+		errno = ENOSYS;
+		return 1;
+	}
+}
+
+/* The min and max are computed after the threads finished, report done then */
+#ifdef HAVE_PTHREAD
+struct histogram_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	struct hist_ctx *ctx;
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
+
+static void *histogram_thread(void *arg)
+{
+	struct histogram_args *a = arg;
+
+	a->ret = histogram(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  a->ctx, a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int histogram_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       struct hist_ctx *ctx,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+	t = GP_MIN(t, h_src);
+
+	if (t <= 1) {
+		return histogram(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, ctx, callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct histogram_args args[t];
+	char started[t];
+	gp_size h = h_src / t;
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct histogram_args) {
+			.src = src,
+			.x_src = x_src,
+			.y_src = y_src + i * h,
+			.w_src = w_src,
+			.h_src = i == t - 1 ? h_src - i * h : h,
+			.dst = dst,
+			.x_dst = x_dst,
+			.y_dst = y_dst + i * h,
+			.ctx = ctx,
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, histogram_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			histogram_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+
+	return 0;
+}
+#else
+static int histogram_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       struct hist_ctx *ctx,
+                       gp_progress_cb *callback)
+{
+	return histogram(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, ctx, callback);
+}
+#endif /* HAVE_PTHREAD */
+
+int gp_filter_histogram_ex(gp_histogram *self, const gp_pixmap *src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           unsigned int step, gp_progress_cb *callback)
+{
+	struct hist_ctx ctx = {
+		.hist = self,
+		.x0 = x_src,
+		.y0 = y_src,
+		.step = step ? step : 1,
+	};
+	unsigned int i, j;
+	int ret;
+
+	GP_DEBUG(1, "Running Histogram filter %ux%u step %u",
+	         w_src, h_src, ctx.step);
+
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	GP_CHECK(x_src >= 0 && y_src >= 0);
+	GP_CHECK((gp_size)x_src + w_src <= src->w &&
+	         (gp_size)y_src + h_src <= src->h);
+
+	for (i = 0; i < gp_pixel_channel_count(self->pixel_type); i++) {
+		gp_histogram_channel *chan = self->channels[i];
+		memset(chan->hist, 0, sizeof(uint32_t) * chan->len);
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_init(&ctx.lock, NULL);
+#endif
+
+	ret = histogram_mp(src, x_src, y_src, w_src, h_src, NULL, 0, 0, &ctx, callback);
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_destroy(&ctx.lock);
+#endif
+
+	if (ret)
+		return ret;
+
+	for (i = 0; i < gp_pixel_channel_count(self->pixel_type); i++) {
+		gp_histogram_channel *chan = self->channels[i];
+
+		chan->max = chan->hist[0];
+		chan->min = chan->hist[0];
+
+		for (j = 1; j < chan->len; j++) {
+			if (chan->hist[j] > chan->max)
+				chan->max = chan->hist[j];
+
+			if (chan->hist[j] < chan->min)
+				chan->min = chan->hist[j];
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+int gp_filter_histogram(gp_histogram *self, const gp_pixmap *src,
+                        gp_progress_cb *callback)
+{
+	return gp_filter_histogram_ex(self, src, 0, 0, src->w, src->h, 1, callback);
+}
@@ -1,85 +1,218 @@
 @ include source.t
+@ include thread_dispatcher.t
 /*
  * Histogram filter -- Compute image histogram
  *
- * Copyright (C) 2009-2015 Cyril Hrubis <metan@ucw.cz>
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 
+#include "../../config.h"
+
+#ifdef HAVE_PTHREAD
+# include <pthread.h>
+#endif
+
 #include <core/gp_pixmap.h>
 #include <core/gp_pixel.h>
 #include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
 #include <core/gp_debug.h>
 #include <filters/gp_filter.h>
 #include <filters/gp_stats.h>
 
+struct hist_ctx {
+	gp_histogram *hist;
+	/* Sampling grid origin and step */
+	gp_coord x0, y0;
+	unsigned int step;
+#ifdef HAVE_PTHREAD
+	pthread_mutex_t lock;
+#endif
+};
+
+/*
+ * Consecutive pixels are counted into interleaved sub-histograms, otherwise
+ * each increment on uniform areas would have to wait for the previous one to
+ * be stored. Channels larger than 8 bits use only one, the histograms would
+ * not fit into the cache anyway.
+ */
+#define SUB_HISTS 4
+
+@ sub_hists = lambda c: 'SUB_HISTS' if c.size <= 8 else '1'
+@
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
-static int histogram_{{ pt.name }}(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+static int histogram_{{ pt.name }}(const gp_pixmap *src,
+                              gp_coord x_src, gp_coord y_src,
+                              gp_size w_src, gp_size h_src,
+                              gp_pixmap *dst,
+                              gp_coord x_dst, gp_coord y_dst,
+                              struct hist_ctx *ctx,
+                              gp_progress_cb *callback)
 {
-	if (self->pixel_type != src->pixel_type) {
-		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
-		        gp_pixel_type_name(self->pixel_type),
-			gp_pixel_type_name(src->pixel_type));
-		errno = EINVAL;
+	unsigned int step = ctx->step;
+	gp_coord x, y, x_start, y_start;
+	size_t i, size = 0;
+	uint32_t *buf;
+
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+@         for c in pt.chanslist:
+	uint32_t *hist_{{ c.name }}[{{ sub_hists(c) }}];
+	size += {{ sub_hists(c) }} * {{ c.max + 1 }};
+@         end
+
+	buf = calloc(size, sizeof(uint32_t));
+	if (!buf) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
 		return 1;
 	}
 
+	size = 0;
 @         for c in pt.chanslist:
-	gp_histogram_channel *chan_{{ c.name }} = self->channels[{{ c.idx }}];
+
+	for (i = 0; i < {{ sub_hists(c) }}; i++) {
+		hist_{{ c.name }}[i] = buf + size;
+		size += {{ c.max + 1 }};
+	}
 @         end
 
-	uint32_t x, y;
+	/* Keep the sampling grid independent of the thread stripes */
+	x_start = (step - (x_src - ctx->x0) % step) % step;
+	y_start = (step - (y_src - ctx->y0) % step) % step;
 
-	for (y = 0; y < src->h; y++) {
-		for (x = 0; x < src->w; x++) {
-			gp_pixel pix = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, x, y);
-@         for c in pt.chanslist:
-			int32_t {{ c.name }} = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+	for (y = y_start; y < (gp_coord)h_src; y += step) {
+		gp_coord yi = y_src + y;
+
+		x = x_start;
+
+		for (; x + (SUB_HISTS - 1) * (gp_coord)step < (gp_coord)w_src; x += SUB_HISTS * step) {
+@         for k in range(0, 4):
+			gp_pixel pix{{ k }} = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, x_src + x + {{ k }} * step, yi);
 @         end
 
+@         for k in range(0, 4):
+@             for c in pt.chanslist:
+			hist_{{ c.name }}[{{ k }} % {{ sub_hists(c) }}][GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix{{ k }})]++;
+@             end
+@         end
+		}
+
+		for (; x < (gp_coord)w_src; x += step) {
+			gp_pixel pix = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, x_src + x, yi);
+
 @         for c in pt.chanslist:
-			chan_{{ c.name }}->hist[{{ c.name }}]++;
+			hist_{{ c.name }}[0][GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix)]++;
 @         end
 		}
 
-		if (gp_progress_cb_report(callback, y, src->h, src->w))
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			free(buf);
+			errno = ECANCELED;
 			return 1;
+		}
 	}
 
-	gp_progress_cb_done(callback);
-	return 0;
-}
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&ctx->lock);
+#endif
 
-@ end
-@
-int gp_filter_histogram(gp_histogram *self, const gp_pixmap *src,
-                       gp_progress_cb *callback)
-{
-	unsigned int i, j;
-	int ret;
+@         for c in pt.chanslist:
+	for (i = 0; i < {{ c.max + 1 }}; i++) {
+		uint32_t sum = 0;
+		unsigned int j;
 
-	GP_DEBUG(1, "Running Histogram filter");
+		for (j = 0; j < {{ sub_hists(c) }}; j++)
+			sum += hist_{{ c.name }}[j][i];
 
-	for (i = 0; i < gp_pixel_channel_count(self->pixel_type); i++) {
-		gp_histogram_channel *chan = self->channels[i];
-		memset(chan->hist, 0, sizeof(uint32_t) * chan->len);
+		ctx->hist->channels[{{ c.idx }}]->hist[i] += sum;
 	}
 
+@         end
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&ctx->lock);
+#endif
+
+	free(buf);
+
+	return 0;
+}
+
+@ end
+static int histogram(const gp_pixmap *src,
+                     gp_coord x_src, gp_coord y_src,
+                     gp_size w_src, gp_size h_src,
+                     gp_pixmap *dst,
+                     gp_coord x_dst, gp_coord y_dst,
+                     struct hist_ctx *ctx,
+                     gp_progress_cb *callback)
+{
 	switch (src->pixel_type) {
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
 	case GP_PIXEL_{{ pt.name }}:
-		ret = histogram_{{ pt.name }}(self, src, callback);
-	break;
+		return histogram_{{ pt.name }}(src, x_src, y_src, w_src, h_src,
+		                      dst, x_dst, y_dst, ctx, callback);
 @ end
 	default:
 		errno = ENOSYS;
 		return 1;
-	break;
 	}
+}
+
+/* The min and max are computed after the threads finished, report done then */
+{@ dispatcher('histogram', [['struct hist_ctx *', 'ctx']], done=False) @}
+
+int gp_filter_histogram_ex(gp_histogram *self, const gp_pixmap *src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           unsigned int step, gp_progress_cb *callback)
+{
+	struct hist_ctx ctx = {
+		.hist = self,
+		.x0 = x_src,
+		.y0 = y_src,
+		.step = step ? step : 1,
+	};
+	unsigned int i, j;
+	int ret;
+
+	GP_DEBUG(1, "Running Histogram filter %ux%u step %u",
+	         w_src, h_src, ctx.step);
+
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	GP_CHECK(x_src >= 0 && y_src >= 0);
+	GP_CHECK((gp_size)x_src + w_src <= src->w &&
+	         (gp_size)y_src + h_src <= src->h);
+
+	for (i = 0; i < gp_pixel_channel_count(self->pixel_type); i++) {
+		gp_histogram_channel *chan = self->channels[i];
+		memset(chan->hist, 0, sizeof(uint32_t) * chan->len);
+	}
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_init(&ctx.lock, NULL);
+#endif
+
+	ret = histogram_mp(src, x_src, y_src, w_src, h_src, NULL, 0, 0, &ctx, callback);
+
+#ifdef HAVE_PTHREAD
+	pthread_mutex_destroy(&ctx.lock);
+#endif
 
 	if (ret)
 		return ret;
@@ -99,5 +232,13 @@ int gp_filter_histogram(gp_histogram *self, const gp_pixmap *src,
 		}
 	}
 
+	gp_progress_cb_done(callback);
+
 	return 0;
 }
+
+int gp_filter_histogram(gp_histogram *self, const gp_pixmap *src,
+                        gp_progress_cb *callback)
+{
+	return gp_filter_histogram_ex(self, src, 0, 0, src->w, src->h, 1, callback);
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_debug.h>
+#include <filters/gp_integral_image.h>
+
+/* Returns non-zero if sum of the whole image may overflow 32 bits */
+static int needs_wide(gp_pixel_type pixel_type, gp_size w, gp_size h)
+{
+	unsigned int i, bits = 0;
+
+	for (i = 0; i < gp_pixel_channel_count(pixel_type); i++)
+		bits = GP_MAX(bits, gp_pixel_channel_bits(pixel_type, i));
+
+	return (uint64_t)w * h * ((1ULL << bits) - 1) > UINT32_MAX;
+}
+
+gp_integral_image *gp_integral_image_alloc(gp_pixel_type pixel_type,
+                                           gp_size w, gp_size h, int flags)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(pixel_type);
+	size_t entries = (size_t)(w + 1) * (h + 1);
+	size_t sum_size, size;
+	gp_integral_image *self;
+	unsigned int i;
+	uint8_t *tables;
+	int wide;
+
+	if (!desc || desc->numchannels == 0 || gp_pixel_has_flags(pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_WARN("Unsupported pixel type %s", gp_pixel_type_name(pixel_type));
+		errno = EINVAL;
+		return NULL;
+	}
+
+	wide = (flags & GP_INTEGRAL_WIDE) || needs_wide(pixel_type, w, h);
+	sum_size = entries * (wide ? sizeof(uint64_t) : sizeof(uint32_t));
+
+	size = sum_size;
+	if (flags & GP_INTEGRAL_SQUARES)
+		size += entries * sizeof(uint64_t);
+
+	GP_DEBUG(1, "Allocating integral image %ux%u %s %s%s",
+	         w, h, gp_pixel_type_name(pixel_type),
+	         wide ? "64bit" : "32bit",
+	         (flags & GP_INTEGRAL_SQUARES) ? " squares" : "");
+
+	self = calloc(1, sizeof(*self));
+	/* The first row and column has to be zeroed */
+	tables = calloc(desc->numchannels, size);
+
+	if (!self || !tables) {
+		GP_WARN("Malloc failed :(");
+		free(self);
+		free(tables);
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	self->pixel_type = pixel_type;
+	self->w = w;
+	self->h = h;
+	self->chan_cnt = desc->numchannels;
+	self->wide = wide;
+
+	for (i = 0; i < desc->numchannels; i++) {
+		uint8_t *table = tables + i * size;
+
+		if (wide)
+			self->sum64[i] = (uint64_t *)table;
+		else
+			self->sum32[i] = (uint32_t *)table;
+
+		if (flags & GP_INTEGRAL_SQUARES)
+			self->sq_sum[i] = (uint64_t *)(table + sum_size);
+	}
+
+	return self;
+}
+
+void gp_integral_image_free(gp_integral_image *self)
+{
+	if (!self)
+		return;
+
+	GP_DEBUG(1, "Freeing integral image %p", self);
+
+	free(self->sum64[0]);
+	free(self);
+}
+
+gp_integral_image *gp_filter_integral_image_alloc(const gp_pixmap *src, int flags,
+                                                  gp_progress_cb *callback)
+{
+	gp_integral_image *self;
+
+	self = gp_integral_image_alloc(src->pixel_type, src->w, src->h, flags);
+	if (!self)
+		return NULL;
+
+	if (gp_filter_integral_image(self, src, callback)) {
+		int err = errno;
+		gp_integral_image_free(self);
+		errno = err;
+		return NULL;
+	}
+
+	return self;
+}
@@ -0,0 +1,2520 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_integral_image.gen.c
+ *
+ * GENERATED on 2026 10 19 20:33:12 from gp_integral_image.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Integral image -- summed-area table
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include "../../config.h"
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_integral_image.h>
+
+static int rows_RGB101010_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_R = self->sum32[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint32_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint32_t *sum_G = self->sum32[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint32_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint32_t *sum_B = self->sum32[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint32_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB101010(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB101010(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB101010(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB101010_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_R = self->sum64[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint64_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint64_t *sum_G = self->sum64[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint64_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint64_t *sum_B = self->sum64[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint64_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB101010(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB101010(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB101010(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_xRGB8888_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_R = self->sum32[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint32_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint32_t *sum_G = self->sum32[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint32_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint32_t *sum_B = self->sum32[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint32_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_xRGB8888(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_xRGB8888(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_xRGB8888(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_xRGB8888_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_R = self->sum64[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint64_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint64_t *sum_G = self->sum64[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint64_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint64_t *sum_B = self->sum64[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint64_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_xRGB8888(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_xRGB8888(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_xRGB8888(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGBA8888_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_R = self->sum32[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint32_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint32_t *sum_G = self->sum32[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint32_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint32_t *sum_B = self->sum32[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint32_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+		uint32_t *sum_A = self->sum32[3] + off;
+		uint64_t *sq_A = self->sq_sum[3];
+		uint32_t acc_A = 0;
+		uint64_t sq_acc_A = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGBA8888(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGBA8888(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGBA8888(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+			uint32_t A = GP_PIXEL_GET_A_RGBA8888(pix);
+
+			acc_A += A;
+			sum_A[x] = acc_A;
+
+			if (sq_A) {
+				sq_acc_A += (uint64_t)A * A;
+				sq_A[off + x] = sq_acc_A;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGBA8888_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_R = self->sum64[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint64_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint64_t *sum_G = self->sum64[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint64_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint64_t *sum_B = self->sum64[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint64_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+		uint64_t *sum_A = self->sum64[3] + off;
+		uint64_t *sq_A = self->sq_sum[3];
+		uint64_t acc_A = 0;
+		uint64_t sq_acc_A = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGBA8888(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGBA8888(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGBA8888(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+			uint32_t A = GP_PIXEL_GET_A_RGBA8888(pix);
+
+			acc_A += A;
+			sum_A[x] = acc_A;
+
+			if (sq_A) {
+				sq_acc_A += (uint64_t)A * A;
+				sq_A[off + x] = sq_acc_A;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB888_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_R = self->sum32[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint32_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint32_t *sum_G = self->sum32[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint32_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint32_t *sum_B = self->sum32[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint32_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB888(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB888(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB888(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB888_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_R = self->sum64[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint64_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint64_t *sum_G = self->sum64[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint64_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint64_t *sum_B = self->sum64[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint64_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB888(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB888(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB888(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_BGR888_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_B = self->sum32[0] + off;
+		uint64_t *sq_B = self->sq_sum[0];
+		uint32_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+		uint32_t *sum_G = self->sum32[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint32_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint32_t *sum_R = self->sum32[2] + off;
+		uint64_t *sq_R = self->sq_sum[2];
+		uint32_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x, y_src + y);
+			uint32_t B = GP_PIXEL_GET_B_BGR888(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+			uint32_t G = GP_PIXEL_GET_G_BGR888(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t R = GP_PIXEL_GET_R_BGR888(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_BGR888_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_B = self->sum64[0] + off;
+		uint64_t *sq_B = self->sq_sum[0];
+		uint64_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+		uint64_t *sum_G = self->sum64[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint64_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint64_t *sum_R = self->sum64[2] + off;
+		uint64_t *sq_R = self->sq_sum[2];
+		uint64_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x, y_src + y);
+			uint32_t B = GP_PIXEL_GET_B_BGR888(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+			uint32_t G = GP_PIXEL_GET_G_BGR888(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t R = GP_PIXEL_GET_R_BGR888(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB555_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_R = self->sum32[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint32_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint32_t *sum_G = self->sum32[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint32_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint32_t *sum_B = self->sum32[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint32_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB555(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB555(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB555(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB555_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_R = self->sum64[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint64_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint64_t *sum_G = self->sum64[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint64_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint64_t *sum_B = self->sum64[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint64_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB555(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB555(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB555(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB565_BE_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_R = self->sum32[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint32_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint32_t *sum_G = self->sum32[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint32_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint32_t *sum_B = self->sum32[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint32_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB565_BE(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB565_BE(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB565_BE(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB565_BE_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_R = self->sum64[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint64_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint64_t *sum_G = self->sum64[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint64_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint64_t *sum_B = self->sum64[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint64_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB565_BE(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB565_BE(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB565_BE(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB565_LE_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_R = self->sum32[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint32_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint32_t *sum_G = self->sum32[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint32_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint32_t *sum_B = self->sum32[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint32_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB565_LE(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB565_LE(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB565_LE(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB565_LE_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_R = self->sum64[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint64_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint64_t *sum_G = self->sum64[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint64_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint64_t *sum_B = self->sum64[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint64_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB565_LE(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB565_LE(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB565_LE(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB666_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_R = self->sum32[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint32_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint32_t *sum_G = self->sum32[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint32_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint32_t *sum_B = self->sum32[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint32_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB666(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB666(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB666(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB666_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_R = self->sum64[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint64_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint64_t *sum_G = self->sum64[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint64_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint64_t *sum_B = self->sum64[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint64_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB666(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB666(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB666(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB332_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_R = self->sum32[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint32_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint32_t *sum_G = self->sum32[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint32_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint32_t *sum_B = self->sum32[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint32_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB332(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB332(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB332(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_RGB332_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_R = self->sum64[0] + off;
+		uint64_t *sq_R = self->sq_sum[0];
+		uint64_t acc_R = 0;
+		uint64_t sq_acc_R = 0;
+		uint64_t *sum_G = self->sum64[1] + off;
+		uint64_t *sq_G = self->sq_sum[1];
+		uint64_t acc_G = 0;
+		uint64_t sq_acc_G = 0;
+		uint64_t *sum_B = self->sum64[2] + off;
+		uint64_t *sq_B = self->sq_sum[2];
+		uint64_t acc_B = 0;
+		uint64_t sq_acc_B = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x, y_src + y);
+			uint32_t R = GP_PIXEL_GET_R_RGB332(pix);
+
+			acc_R += R;
+			sum_R[x] = acc_R;
+
+			if (sq_R) {
+				sq_acc_R += (uint64_t)R * R;
+				sq_R[off + x] = sq_acc_R;
+			}
+			uint32_t G = GP_PIXEL_GET_G_RGB332(pix);
+
+			acc_G += G;
+			sum_G[x] = acc_G;
+
+			if (sq_G) {
+				sq_acc_G += (uint64_t)G * G;
+				sq_G[off + x] = sq_acc_G;
+			}
+			uint32_t B = GP_PIXEL_GET_B_RGB332(pix);
+
+			acc_B += B;
+			sum_B[x] = acc_B;
+
+			if (sq_B) {
+				sq_acc_B += (uint64_t)B * B;
+				sq_B[off + x] = sq_acc_B;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_CMYK8888_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_K = self->sum32[0] + off;
+		uint64_t *sq_K = self->sq_sum[0];
+		uint32_t acc_K = 0;
+		uint64_t sq_acc_K = 0;
+		uint32_t *sum_Y = self->sum32[1] + off;
+		uint64_t *sq_Y = self->sq_sum[1];
+		uint32_t acc_Y = 0;
+		uint64_t sq_acc_Y = 0;
+		uint32_t *sum_M = self->sum32[2] + off;
+		uint64_t *sq_M = self->sq_sum[2];
+		uint32_t acc_M = 0;
+		uint64_t sq_acc_M = 0;
+		uint32_t *sum_C = self->sum32[3] + off;
+		uint64_t *sq_C = self->sq_sum[3];
+		uint32_t acc_C = 0;
+		uint64_t sq_acc_C = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y_src + y);
+			uint32_t K = GP_PIXEL_GET_K_CMYK8888(pix);
+
+			acc_K += K;
+			sum_K[x] = acc_K;
+
+			if (sq_K) {
+				sq_acc_K += (uint64_t)K * K;
+				sq_K[off + x] = sq_acc_K;
+			}
+			uint32_t Y = GP_PIXEL_GET_Y_CMYK8888(pix);
+
+			acc_Y += Y;
+			sum_Y[x] = acc_Y;
+
+			if (sq_Y) {
+				sq_acc_Y += (uint64_t)Y * Y;
+				sq_Y[off + x] = sq_acc_Y;
+			}
+			uint32_t M = GP_PIXEL_GET_M_CMYK8888(pix);
+
+			acc_M += M;
+			sum_M[x] = acc_M;
+
+			if (sq_M) {
+				sq_acc_M += (uint64_t)M * M;
+				sq_M[off + x] = sq_acc_M;
+			}
+			uint32_t C = GP_PIXEL_GET_C_CMYK8888(pix);
+
+			acc_C += C;
+			sum_C[x] = acc_C;
+
+			if (sq_C) {
+				sq_acc_C += (uint64_t)C * C;
+				sq_C[off + x] = sq_acc_C;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_CMYK8888_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_K = self->sum64[0] + off;
+		uint64_t *sq_K = self->sq_sum[0];
+		uint64_t acc_K = 0;
+		uint64_t sq_acc_K = 0;
+		uint64_t *sum_Y = self->sum64[1] + off;
+		uint64_t *sq_Y = self->sq_sum[1];
+		uint64_t acc_Y = 0;
+		uint64_t sq_acc_Y = 0;
+		uint64_t *sum_M = self->sum64[2] + off;
+		uint64_t *sq_M = self->sq_sum[2];
+		uint64_t acc_M = 0;
+		uint64_t sq_acc_M = 0;
+		uint64_t *sum_C = self->sum64[3] + off;
+		uint64_t *sq_C = self->sq_sum[3];
+		uint64_t acc_C = 0;
+		uint64_t sq_acc_C = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y_src + y);
+			uint32_t K = GP_PIXEL_GET_K_CMYK8888(pix);
+
+			acc_K += K;
+			sum_K[x] = acc_K;
+
+			if (sq_K) {
+				sq_acc_K += (uint64_t)K * K;
+				sq_K[off + x] = sq_acc_K;
+			}
+			uint32_t Y = GP_PIXEL_GET_Y_CMYK8888(pix);
+
+			acc_Y += Y;
+			sum_Y[x] = acc_Y;
+
+			if (sq_Y) {
+				sq_acc_Y += (uint64_t)Y * Y;
+				sq_Y[off + x] = sq_acc_Y;
+			}
+			uint32_t M = GP_PIXEL_GET_M_CMYK8888(pix);
+
+			acc_M += M;
+			sum_M[x] = acc_M;
+
+			if (sq_M) {
+				sq_acc_M += (uint64_t)M * M;
+				sq_M[off + x] = sq_acc_M;
+			}
+			uint32_t C = GP_PIXEL_GET_C_CMYK8888(pix);
+
+			acc_C += C;
+			sum_C[x] = acc_C;
+
+			if (sq_C) {
+				sq_acc_C += (uint64_t)C * C;
+				sq_C[off + x] = sq_acc_C;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G1_DB_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_V = self->sum32[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint32_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G1_DB(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G1_DB_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_V = self->sum64[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint64_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G1_DB(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G2_DB_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_V = self->sum32[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint32_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G2_DB(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G2_DB_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_V = self->sum64[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint64_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G2_DB(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G4_DB_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_V = self->sum32[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint32_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G4_DB(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G4_DB_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_V = self->sum64[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint64_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G4_DB(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G1_UB_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_V = self->sum32[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint32_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G1_UB(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G1_UB_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_V = self->sum64[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint64_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G1_UB(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G2_UB_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_V = self->sum32[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint32_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G2_UB(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G2_UB_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_V = self->sum64[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint64_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G2_UB(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G4_UB_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_V = self->sum32[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint32_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G4_UB(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G4_UB_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_V = self->sum64[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint64_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G4_UB(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G8_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_V = self->sum32[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint32_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G8(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G8_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_V = self->sum64[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint64_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G8(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_GA88_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_V = self->sum32[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint32_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+		uint32_t *sum_A = self->sum32[1] + off;
+		uint64_t *sq_A = self->sq_sum[1];
+		uint32_t acc_A = 0;
+		uint64_t sq_acc_A = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_GA88(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+			uint32_t A = GP_PIXEL_GET_A_GA88(pix);
+
+			acc_A += A;
+			sum_A[x] = acc_A;
+
+			if (sq_A) {
+				sq_acc_A += (uint64_t)A * A;
+				sq_A[off + x] = sq_acc_A;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_GA88_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_V = self->sum64[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint64_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+		uint64_t *sum_A = self->sum64[1] + off;
+		uint64_t *sq_A = self->sq_sum[1];
+		uint64_t acc_A = 0;
+		uint64_t sq_acc_A = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_GA88(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+			uint32_t A = GP_PIXEL_GET_A_GA88(pix);
+
+			acc_A += A;
+			sum_A[x] = acc_A;
+
+			if (sq_A) {
+				sq_acc_A += (uint64_t)A * A;
+				sq_A[off + x] = sq_acc_A;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G16_32(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint32_t *sum_V = self->sum32[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint32_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G16(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_G16_64(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+		uint64_t *sum_V = self->sum64[0] + off;
+		uint64_t *sq_V = self->sq_sum[0];
+		uint64_t acc_V = 0;
+		uint64_t sq_acc_V = 0;
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, x, y_src + y);
+			uint32_t V = GP_PIXEL_GET_V_G16(pix);
+
+			acc_V += V;
+			sum_V[x] = acc_V;
+
+			if (sq_V) {
+				sq_acc_V += (uint64_t)V * V;
+				sq_V[off + x] = sq_acc_V;
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows(const gp_pixmap *src,
+                gp_coord x_src, gp_coord y_src,
+                gp_size w_src, gp_size h_src,
+                gp_pixmap *dst,
+                gp_coord x_dst, gp_coord y_dst,
+                gp_integral_image *self,
+                gp_progress_cb *callback)
+{
+	(void) x_src;
+	(void) w_src;
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		if (self->wide)
+			return rows_RGB101010_64(src, y_src, h_src, self, callback);
+		return rows_RGB101010_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_xRGB8888:
+		if (self->wide)
+			return rows_xRGB8888_64(src, y_src, h_src, self, callback);
+		return rows_xRGB8888_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_RGBA8888:
+		if (self->wide)
+			return rows_RGBA8888_64(src, y_src, h_src, self, callback);
+		return rows_RGBA8888_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_RGB888:
+		if (self->wide)
+			return rows_RGB888_64(src, y_src, h_src, self, callback);
+		return rows_RGB888_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_BGR888:
+		if (self->wide)
+			return rows_BGR888_64(src, y_src, h_src, self, callback);
+		return rows_BGR888_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_RGB555:
+		if (self->wide)
+			return rows_RGB555_64(src, y_src, h_src, self, callback);
+		return rows_RGB555_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_RGB565_BE:
+		if (self->wide)
+			return rows_RGB565_BE_64(src, y_src, h_src, self, callback);
+		return rows_RGB565_BE_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_RGB565_LE:
+		if (self->wide)
+			return rows_RGB565_LE_64(src, y_src, h_src, self, callback);
+		return rows_RGB565_LE_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_RGB666:
+		if (self->wide)
+			return rows_RGB666_64(src, y_src, h_src, self, callback);
+		return rows_RGB666_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_RGB332:
+		if (self->wide)
+			return rows_RGB332_64(src, y_src, h_src, self, callback);
+		return rows_RGB332_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_CMYK8888:
+		if (self->wide)
+			return rows_CMYK8888_64(src, y_src, h_src, self, callback);
+		return rows_CMYK8888_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_G1_DB:
+		if (self->wide)
+			return rows_G1_DB_64(src, y_src, h_src, self, callback);
+		return rows_G1_DB_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_G2_DB:
+		if (self->wide)
+			return rows_G2_DB_64(src, y_src, h_src, self, callback);
+		return rows_G2_DB_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_G4_DB:
+		if (self->wide)
+			return rows_G4_DB_64(src, y_src, h_src, self, callback);
+		return rows_G4_DB_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_G1_UB:
+		if (self->wide)
+			return rows_G1_UB_64(src, y_src, h_src, self, callback);
+		return rows_G1_UB_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_G2_UB:
+		if (self->wide)
+			return rows_G2_UB_64(src, y_src, h_src, self, callback);
+		return rows_G2_UB_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_G4_UB:
+		if (self->wide)
+			return rows_G4_UB_64(src, y_src, h_src, self, callback);
+		return rows_G4_UB_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_G8:
+		if (self->wide)
+			return rows_G8_64(src, y_src, h_src, self, callback);
+		return rows_G8_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_GA88:
+		if (self->wide)
+			return rows_GA88_64(src, y_src, h_src, self, callback);
+		return rows_GA88_32(src, y_src, h_src, self, callback);
+	case GP_PIXEL_G16:
+		if (self->wide)
+			return rows_G16_64(src, y_src, h_src, self, callback);
+		return rows_G16_32(src, y_src, h_src, self, callback);
+	default:
+		errno = ENOSYS;
+		return 1;
+	}
+}
+
+#ifdef HAVE_PTHREAD
+struct rows_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	gp_integral_image *self;
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
+
+static void *rows_thread(void *arg)
+{
+	struct rows_args *a = arg;
+
+	a->ret = rows(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  a->self, a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int rows_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       gp_integral_image *self,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+	t = GP_MIN(t, h_src);
+
+	if (t <= 1) {
+		return rows(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, self, callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct rows_args args[t];
+	char started[t];
+	gp_size h = h_src / t;
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct rows_args) {
+			.src = src,
+			.x_src = x_src,
+			.y_src = y_src + i * h,
+			.w_src = w_src,
+			.h_src = i == t - 1 ? h_src - i * h : h,
+			.dst = dst,
+			.x_dst = x_dst,
+			.y_dst = y_dst + i * h,
+			.self = self,
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, rows_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			rows_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+
+	return 0;
+}
+#else
+static int rows_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       gp_integral_image *self,
+                       gp_progress_cb *callback)
+{
+	return rows(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, self, callback);
+}
+#endif /* HAVE_PTHREAD */
+
+static void cols_sum32(uint32_t *t, size_t stride, gp_coord x_src, gp_size w_src, gp_size h)
+{
+	gp_size x, y;
+
+	for (y = 1; y <= h; y++) {
+		uint32_t *row = t + y * stride + x_src + 1;
+		const uint32_t *prev = row - stride;
+
+		for (x = 0; x < w_src; x++)
+			row[x] += prev[x];
+	}
+}
+
+static void cols_sum64(uint64_t *t, size_t stride, gp_coord x_src, gp_size w_src, gp_size h)
+{
+	gp_size x, y;
+
+	for (y = 1; y <= h; y++) {
+		uint64_t *row = t + y * stride + x_src + 1;
+		const uint64_t *prev = row - stride;
+
+		for (x = 0; x < w_src; x++)
+			row[x] += prev[x];
+	}
+}
+
+/*
+ * Accumulates the row sums down the columns, i.e. the second pass. The work is
+ * split into vertical strips so that each thread still walks the rows.
+ */
+static int cols(const gp_pixmap *src,
+                gp_coord x_src, gp_coord y_src,
+                gp_size w_src, gp_size h_src,
+                gp_pixmap *dst,
+                gp_coord x_dst, gp_coord y_dst,
+                gp_integral_image *self,
+                gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	unsigned int i;
+
+	(void) src;
+	(void) y_src;
+	(void) h_src;
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+	(void) callback;
+
+	for (i = 0; i < self->chan_cnt; i++) {
+		if (self->wide)
+			cols_sum64(self->sum64[i], stride, x_src, w_src, self->h);
+		else
+			cols_sum32(self->sum32[i], stride, x_src, w_src, self->h);
+
+		if (self->sq_sum[i])
+			cols_sum64(self->sq_sum[i], stride, x_src, w_src, self->h);
+	}
+
+	return 0;
+}
+
+#ifdef HAVE_PTHREAD
+struct cols_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	gp_integral_image *self;
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
+
+static void *cols_thread(void *arg)
+{
+	struct cols_args *a = arg;
+
+	a->ret = cols(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  a->self, a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int cols_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       gp_integral_image *self,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+	t = GP_MIN(t, w_src);
+
+	if (t <= 1) {
+		return cols(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, self, callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct cols_args args[t];
+	char started[t];
+	gp_size w = w_src / t;
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct cols_args) {
+			.src = src,
+			.x_src = x_src + i * w,
+			.y_src = y_src,
+			.w_src = i == t - 1 ? w_src - i * w : w,
+			.h_src = h_src,
+			.dst = dst,
+			.x_dst = x_dst + i * w,
+			.y_dst = y_dst,
+			.self = self,
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, cols_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			cols_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+
+	return 0;
+}
+#else
+static int cols_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       gp_integral_image *self,
+                       gp_progress_cb *callback)
+{
+	return cols(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, self, callback);
+}
+#endif /* HAVE_PTHREAD */
+
+int gp_filter_integral_image(gp_integral_image *self, const gp_pixmap *src,
+                             gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Integral image %ux%u %s", src->w, src->h,
+	         gp_pixel_type_name(src->pixel_type));
+
+	if (self->pixel_type != src->pixel_type ||
+	    self->w != src->w || self->h != src->h) {
+		GP_WARN("Integral image %ux%u %s does not match pixmap %ux%u %s",
+		        self->w, self->h, gp_pixel_type_name(self->pixel_type),
+		        src->w, src->h, gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (rows_mp(src, 0, 0, src->w, src->h, NULL, 0, 0, self, callback))
+		return 1;
+
+	cols_mp(src, 0, 0, src->w, src->h, NULL, 0, 0, self, callback);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
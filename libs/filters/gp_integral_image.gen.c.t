@@ -0,0 +1,177 @@
+@ include source.t
+@ include thread_dispatcher.t
+/*
+ * Integral image -- summed-area table
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include "../../config.h"
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_integral_image.h>
+
+@ # Computes prefix sums of the rows, i.e. the first pass
+@ def row_sums(pt, bits):
+static int rows_{{ pt.name }}_{{ bits }}(const gp_pixmap *src, gp_coord y_src,
+                              gp_size h_src, gp_integral_image *self,
+                              gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		size_t off = (y_src + y + 1) * stride + 1;
+@     for c in pt.chanslist:
+		uint{{ bits }}_t *sum_{{ c.name }} = self->sum{{ bits }}[{{ c.idx }}] + off;
+		uint64_t *sq_{{ c.name }} = self->sq_sum[{{ c.idx }}];
+		uint{{ bits }}_t acc_{{ c.name }} = 0;
+		uint64_t sq_acc_{{ c.name }} = 0;
+@     end
+
+		for (x = 0; x < (gp_coord)self->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, x, y_src + y);
+@     for c in pt.chanslist:
+			uint32_t {{ c.name }} = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+
+			acc_{{ c.name }} += {{ c.name }};
+			sum_{{ c.name }}[x] = acc_{{ c.name }};
+
+			if (sq_{{ c.name }}) {
+				sq_acc_{{ c.name }} += (uint64_t){{ c.name }} * {{ c.name }};
+				sq_{{ c.name }}[off + x] = sq_acc_{{ c.name }};
+			}
+@     end
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, self->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+@ end
+@
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and not pt.is_palette():
+{@ row_sums(pt, 32) @}
+{@ row_sums(pt, 64) @}
+@ end
+static int rows(const gp_pixmap *src,
+                gp_coord x_src, gp_coord y_src,
+                gp_size w_src, gp_size h_src,
+                gp_pixmap *dst,
+                gp_coord x_dst, gp_coord y_dst,
+                gp_integral_image *self,
+                gp_progress_cb *callback)
+{
+	(void) x_src;
+	(void) w_src;
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+
+	switch (src->pixel_type) {
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and not pt.is_palette():
+	case GP_PIXEL_{{ pt.name }}:
+		if (self->wide)
+			return rows_{{ pt.name }}_64(src, y_src, h_src, self, callback);
+		return rows_{{ pt.name }}_32(src, y_src, h_src, self, callback);
+@ end
+	default:
+		errno = ENOSYS;
+		return 1;
+	}
+}
+
+{@ dispatcher('rows', [['gp_integral_image *', 'self']], done=False) @}
+
+@ def col_sums(bits, table):
+static void cols_{{ table }}(uint{{ bits }}_t *t, size_t stride, gp_coord x_src, gp_size w_src, gp_size h)
+{
+	gp_size x, y;
+
+	for (y = 1; y <= h; y++) {
+		uint{{ bits }}_t *row = t + y * stride + x_src + 1;
+		const uint{{ bits }}_t *prev = row - stride;
+
+		for (x = 0; x < w_src; x++)
+			row[x] += prev[x];
+	}
+}
+
+@ end
+{@ col_sums(32, 'sum32') @}
+{@ col_sums(64, 'sum64') @}
+/*
+ * Accumulates the row sums down the columns, i.e. the second pass. The work is
+ * split into vertical strips so that each thread still walks the rows.
+ */
+static int cols(const gp_pixmap *src,
+                gp_coord x_src, gp_coord y_src,
+                gp_size w_src, gp_size h_src,
+                gp_pixmap *dst,
+                gp_coord x_dst, gp_coord y_dst,
+                gp_integral_image *self,
+                gp_progress_cb *callback)
+{
+	size_t stride = self->w + 1;
+	unsigned int i;
+
+	(void) src;
+	(void) y_src;
+	(void) h_src;
+	(void) dst;
+	(void) x_dst;
+	(void) y_dst;
+	(void) callback;
+
+	for (i = 0; i < self->chan_cnt; i++) {
+		if (self->wide)
+			cols_sum64(self->sum64[i], stride, x_src, w_src, self->h);
+		else
+			cols_sum32(self->sum32[i], stride, x_src, w_src, self->h);
+
+		if (self->sq_sum[i])
+			cols_sum64(self->sq_sum[i], stride, x_src, w_src, self->h);
+	}
+
+	return 0;
+}
+
+{@ dispatcher('cols', [['gp_integral_image *', 'self']], True, done=False) @}
+
+int gp_filter_integral_image(gp_integral_image *self, const gp_pixmap *src,
+                             gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Integral image %ux%u %s", src->w, src->h,
+	         gp_pixel_type_name(src->pixel_type));
+
+	if (self->pixel_type != src->pixel_type ||
+	    self->w != src->w || self->h != src->h) {
+		GP_WARN("Integral image %ux%u %s does not match pixmap %ux%u %s",
+		        self->w, self->h, gp_pixel_type_name(self->pixel_type),
+		        src->w, src->h, gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (rows_mp(src, 0, 0, src->w, src->h, NULL, 0, 0, self, callback))
+		return 1;
+
+	cols_mp(src, 0, 0, src->w, src->h, NULL, 0, 0, self, callback);
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
@@ -0,0 +1,2248 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_median.gen.c
+ *
+ * GENERATED on 2026 10 19 19:42:19 from gp_median.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Constant time median filter
+ *
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "../../config.h"
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_clamp.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_median.h>
+
+struct hist8 {
+	unsigned int coarse[16];
+	unsigned int fine[16][16];
+};
+
+struct hist8u {
+	unsigned int coarse[16];
+	unsigned int fine[16][16];
+	unsigned int lx[16];
+};
+
+static inline void hist8_inc(struct hist8 *h, unsigned int x, unsigned int val)
+{
+	h[x].coarse[val>>4]++;
+	h[x].fine[val>>4][val&0x0f]++;
+}
+
+static inline void hist8_dec(struct hist8 *h, unsigned int x, unsigned int val)
+{
+	h[x].coarse[val>>4]--;
+	h[x].fine[val>>4][val&0x0f]--;
+}
+
+static inline void hist8_add(struct hist8u *out, struct hist8 *in, unsigned int x)
+{
+	int i;
+
+	for (i = 0; i < 16; i += 4) {
+		out->coarse[i + 0] += in[x].coarse[i + 0];
+		out->coarse[i + 1] += in[x].coarse[i + 1];
+		out->coarse[i + 2] += in[x].coarse[i + 2];
+		out->coarse[i + 3] += in[x].coarse[i + 3];
+	}
+}
+
+static inline void hist8_add_fine(struct hist8u *out, struct hist8 *in, unsigned int x)
+{
+	int i, j;
+
+	for (i = 0; i < 16; i += 4) {
+		out->coarse[i + 0] += in[x].coarse[i + 0];
+		out->coarse[i + 1] += in[x].coarse[i + 1];
+		out->coarse[i + 2] += in[x].coarse[i + 2];
+		out->coarse[i + 3] += in[x].coarse[i + 3];
+
+		for (j = 0; j < 16; j++) {
+			out->fine[i + 0][j] += in[x].fine[i + 0][j];
+			out->fine[i + 1][j] += in[x].fine[i + 1][j];
+			out->fine[i + 2][j] += in[x].fine[i + 2][j];
+			out->fine[i + 3][j] += in[x].fine[i + 3][j];
+		}
+	}
+}
+
+static inline void hist8_sub(struct hist8u *out, struct hist8 *in, unsigned int x)
+{
+	int i;
+
+	for (i = 0; i < 16; i += 4) {
+		out->coarse[i + 0] -= in[x].coarse[i + 0];
+		out->coarse[i + 1] -= in[x].coarse[i + 1];
+		out->coarse[i + 2] -= in[x].coarse[i + 2];
+		out->coarse[i + 3] -= in[x].coarse[i + 3];
+	}
+}
+
+/*
+ * Updates only one specified fine part of the histogram.
+ *
+ * The structure hist8u remebers when was particular fine row updated so we either
+ * generate it from scatch or update depending on the number of needed operations.
+ */
+static inline void hist8_update(struct hist8u *h, unsigned int i,
+                                struct hist8  *row, unsigned int x, unsigned int xmed)
+{
+	unsigned int j, k;
+	unsigned int lx = h->lx[i];
+	unsigned int dx = x - lx;
+
+	if (dx > 2*xmed) {
+		/* if last update was long ago clear it and load again */
+		for (j = 0; j < 16; j+=4) {
+			h->fine[i][j + 0] = 0;
+			h->fine[i][j + 1] = 0;
+			h->fine[i][j + 2] = 0;
+			h->fine[i][j + 3] = 0;
+		}
+
+		for (j = 0; j < 16; j++)
+			for (k = 0; k <= 2*xmed; k++)
+				h->fine[i][j + 0] += row[x + k].fine[i][j + 0];
+	} else {
+		/* update only missing bits */
+		for (j = 0; j < 16; j++) {
+			for (k = 0; k < dx; k++) {
+				h->fine[i][j] -= row[lx + k].fine[i][j];
+				h->fine[i][j] += row[lx + k + 2*xmed + 1].fine[i][j];
+			}
+		}
+
+	}
+
+	h->lx[i] = x;
+}
+
+
+static inline unsigned int hist8_median(struct hist8u *h, struct hist8 *row,
+                                        unsigned int x, int xmed, unsigned int trigger)
+{
+	unsigned int i, j;
+	unsigned int acc = 0;
+
+	for (i = 0; i < 16; i++) {
+		acc += h->coarse[i];
+
+		if (acc >= trigger) {
+			acc -= h->coarse[i];
+
+			/* update fine on position i */
+			hist8_update(h, i, row, x, xmed);
+
+			for (j = 0; j < 16; j++) {
+				acc += h->fine[i][j];
+
+				if (acc >= trigger)
+					return (i<<4) | j;
+			}
+		}
+	}
+
+	GP_BUG("Trigger not reached");
+	return 0;
+}
+
+static int median_xRGB8888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 3 * sizeof(struct hist8) * size + 3 * sizeof(struct hist8u));
+
+	struct hist8 *R = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *G = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *B = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(R, 0, sizeof(*R) * size);
+	memset(G, 0, sizeof(*G) * size);
+	memset(B, 0, sizeof(*B) * size);
+
+	struct hist8u *XR = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XG = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XB = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_xRGB8888(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_xRGB8888(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_xRGB8888(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XR, 0, sizeof(*XR));
+		memset(XG, 0, sizeof(*XG));
+		memset(XB, 0, sizeof(*XB));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XR, R, i);
+			hist8_add_fine(XG, G, i);
+			hist8_add_fine(XB, B, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_R = hist8_median(XR, R, x, xmed, trigger);
+			int med_G = hist8_median(XG, G, x, xmed, trigger);
+			int med_B = hist8_median(XB, B, x, xmed, trigger);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_xRGB8888(med_R, med_G, med_B));
+
+			/* Recompute histograms */
+			hist8_sub(XR, R, x);
+			hist8_sub(XG, G, x);
+			hist8_sub(XB, B, x);
+
+			hist8_add(XR, R, (x + 2 * xmed + 1));
+			hist8_add(XG, G, (x + 2 * xmed + 1));
+			hist8_add(XB, B, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			hist8_dec(R, x, GP_PIXEL_GET_R_xRGB8888(pix));
+			hist8_dec(G, x, GP_PIXEL_GET_G_xRGB8888(pix));
+			hist8_dec(B, x, GP_PIXEL_GET_B_xRGB8888(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_xRGB8888(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_xRGB8888(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_xRGB8888(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_RGBA8888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 4 * sizeof(struct hist8) * size + 4 * sizeof(struct hist8u));
+
+	struct hist8 *R = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *G = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *B = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *A = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(R, 0, sizeof(*R) * size);
+	memset(G, 0, sizeof(*G) * size);
+	memset(B, 0, sizeof(*B) * size);
+	memset(A, 0, sizeof(*A) * size);
+
+	struct hist8u *XR = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XG = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XB = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XA = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGBA8888(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGBA8888(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGBA8888(pix));
+			hist8_inc(A, x, GP_PIXEL_GET_A_RGBA8888(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XR, 0, sizeof(*XR));
+		memset(XG, 0, sizeof(*XG));
+		memset(XB, 0, sizeof(*XB));
+		memset(XA, 0, sizeof(*XA));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XR, R, i);
+			hist8_add_fine(XG, G, i);
+			hist8_add_fine(XB, B, i);
+			hist8_add_fine(XA, A, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_R = hist8_median(XR, R, x, xmed, trigger);
+			int med_G = hist8_median(XG, G, x, xmed, trigger);
+			int med_B = hist8_median(XB, B, x, xmed, trigger);
+			int med_A = hist8_median(XA, A, x, xmed, trigger);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGBA8888(med_R, med_G, med_B, med_A));
+
+			/* Recompute histograms */
+			hist8_sub(XR, R, x);
+			hist8_sub(XG, G, x);
+			hist8_sub(XB, B, x);
+			hist8_sub(XA, A, x);
+
+			hist8_add(XR, R, (x + 2 * xmed + 1));
+			hist8_add(XG, G, (x + 2 * xmed + 1));
+			hist8_add(XB, B, (x + 2 * xmed + 1));
+			hist8_add(XA, A, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			hist8_dec(R, x, GP_PIXEL_GET_R_RGBA8888(pix));
+			hist8_dec(G, x, GP_PIXEL_GET_G_RGBA8888(pix));
+			hist8_dec(B, x, GP_PIXEL_GET_B_RGBA8888(pix));
+			hist8_dec(A, x, GP_PIXEL_GET_A_RGBA8888(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGBA8888(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGBA8888(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGBA8888(pix));
+			hist8_inc(A, x, GP_PIXEL_GET_A_RGBA8888(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_RGB888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 3 * sizeof(struct hist8) * size + 3 * sizeof(struct hist8u));
+
+	struct hist8 *R = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *G = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *B = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(R, 0, sizeof(*R) * size);
+	memset(G, 0, sizeof(*G) * size);
+	memset(B, 0, sizeof(*B) * size);
+
+	struct hist8u *XR = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XG = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XB = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGB888(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGB888(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGB888(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XR, 0, sizeof(*XR));
+		memset(XG, 0, sizeof(*XG));
+		memset(XB, 0, sizeof(*XB));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XR, R, i);
+			hist8_add_fine(XG, G, i);
+			hist8_add_fine(XB, B, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_R = hist8_median(XR, R, x, xmed, trigger);
+			int med_G = hist8_median(XG, G, x, xmed, trigger);
+			int med_B = hist8_median(XB, B, x, xmed, trigger);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB888(med_R, med_G, med_B));
+
+			/* Recompute histograms */
+			hist8_sub(XR, R, x);
+			hist8_sub(XG, G, x);
+			hist8_sub(XB, B, x);
+
+			hist8_add(XR, R, (x + 2 * xmed + 1));
+			hist8_add(XG, G, (x + 2 * xmed + 1));
+			hist8_add(XB, B, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			hist8_dec(R, x, GP_PIXEL_GET_R_RGB888(pix));
+			hist8_dec(G, x, GP_PIXEL_GET_G_RGB888(pix));
+			hist8_dec(B, x, GP_PIXEL_GET_B_RGB888(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGB888(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGB888(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGB888(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_BGR888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 3 * sizeof(struct hist8) * size + 3 * sizeof(struct hist8u));
+
+	struct hist8 *B = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *G = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *R = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(B, 0, sizeof(*B) * size);
+	memset(G, 0, sizeof(*G) * size);
+	memset(R, 0, sizeof(*R) * size);
+
+	struct hist8u *XB = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XG = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XR = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			hist8_inc(B, x, GP_PIXEL_GET_B_BGR888(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_BGR888(pix));
+			hist8_inc(R, x, GP_PIXEL_GET_R_BGR888(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XB, 0, sizeof(*XB));
+		memset(XG, 0, sizeof(*XG));
+		memset(XR, 0, sizeof(*XR));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XB, B, i);
+			hist8_add_fine(XG, G, i);
+			hist8_add_fine(XR, R, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_B = hist8_median(XB, B, x, xmed, trigger);
+			int med_G = hist8_median(XG, G, x, xmed, trigger);
+			int med_R = hist8_median(XR, R, x, xmed, trigger);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_BGR888(med_B, med_G, med_R));
+
+			/* Recompute histograms */
+			hist8_sub(XB, B, x);
+			hist8_sub(XG, G, x);
+			hist8_sub(XR, R, x);
+
+			hist8_add(XB, B, (x + 2 * xmed + 1));
+			hist8_add(XG, G, (x + 2 * xmed + 1));
+			hist8_add(XR, R, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			hist8_dec(B, x, GP_PIXEL_GET_B_BGR888(pix));
+			hist8_dec(G, x, GP_PIXEL_GET_G_BGR888(pix));
+			hist8_dec(R, x, GP_PIXEL_GET_R_BGR888(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			hist8_inc(B, x, GP_PIXEL_GET_B_BGR888(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_BGR888(pix));
+			hist8_inc(R, x, GP_PIXEL_GET_R_BGR888(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_RGB555(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 3 * sizeof(struct hist8) * size + 3 * sizeof(struct hist8u));
+
+	struct hist8 *R = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *G = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *B = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(R, 0, sizeof(*R) * size);
+	memset(G, 0, sizeof(*G) * size);
+	memset(B, 0, sizeof(*B) * size);
+
+	struct hist8u *XR = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XG = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XB = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGB555(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGB555(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGB555(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XR, 0, sizeof(*XR));
+		memset(XG, 0, sizeof(*XG));
+		memset(XB, 0, sizeof(*XB));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XR, R, i);
+			hist8_add_fine(XG, G, i);
+			hist8_add_fine(XB, B, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_R = hist8_median(XR, R, x, xmed, trigger);
+			int med_G = hist8_median(XG, G, x, xmed, trigger);
+			int med_B = hist8_median(XB, B, x, xmed, trigger);
+
+			gp_putpixel_raw_16BPP_BE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB555(med_R, med_G, med_B));
+
+			/* Recompute histograms */
+			hist8_sub(XR, R, x);
+			hist8_sub(XG, G, x);
+			hist8_sub(XB, B, x);
+
+			hist8_add(XR, R, (x + 2 * xmed + 1));
+			hist8_add(XG, G, (x + 2 * xmed + 1));
+			hist8_add(XB, B, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+			hist8_dec(R, x, GP_PIXEL_GET_R_RGB555(pix));
+			hist8_dec(G, x, GP_PIXEL_GET_G_RGB555(pix));
+			hist8_dec(B, x, GP_PIXEL_GET_B_RGB555(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGB555(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGB555(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGB555(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_RGB565_BE(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 3 * sizeof(struct hist8) * size + 3 * sizeof(struct hist8u));
+
+	struct hist8 *R = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *G = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *B = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(R, 0, sizeof(*R) * size);
+	memset(G, 0, sizeof(*G) * size);
+	memset(B, 0, sizeof(*B) * size);
+
+	struct hist8u *XR = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XG = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XB = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGB565_BE(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGB565_BE(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGB565_BE(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XR, 0, sizeof(*XR));
+		memset(XG, 0, sizeof(*XG));
+		memset(XB, 0, sizeof(*XB));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XR, R, i);
+			hist8_add_fine(XG, G, i);
+			hist8_add_fine(XB, B, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_R = hist8_median(XR, R, x, xmed, trigger);
+			int med_G = hist8_median(XG, G, x, xmed, trigger);
+			int med_B = hist8_median(XB, B, x, xmed, trigger);
+
+			gp_putpixel_raw_16BPP_BE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB565_BE(med_R, med_G, med_B));
+
+			/* Recompute histograms */
+			hist8_sub(XR, R, x);
+			hist8_sub(XG, G, x);
+			hist8_sub(XB, B, x);
+
+			hist8_add(XR, R, (x + 2 * xmed + 1));
+			hist8_add(XG, G, (x + 2 * xmed + 1));
+			hist8_add(XB, B, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+			hist8_dec(R, x, GP_PIXEL_GET_R_RGB565_BE(pix));
+			hist8_dec(G, x, GP_PIXEL_GET_G_RGB565_BE(pix));
+			hist8_dec(B, x, GP_PIXEL_GET_B_RGB565_BE(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGB565_BE(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGB565_BE(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGB565_BE(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_RGB565_LE(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 3 * sizeof(struct hist8) * size + 3 * sizeof(struct hist8u));
+
+	struct hist8 *R = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *G = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *B = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(R, 0, sizeof(*R) * size);
+	memset(G, 0, sizeof(*G) * size);
+	memset(B, 0, sizeof(*B) * size);
+
+	struct hist8u *XR = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XG = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XB = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGB565_LE(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGB565_LE(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGB565_LE(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XR, 0, sizeof(*XR));
+		memset(XG, 0, sizeof(*XG));
+		memset(XB, 0, sizeof(*XB));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XR, R, i);
+			hist8_add_fine(XG, G, i);
+			hist8_add_fine(XB, B, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_R = hist8_median(XR, R, x, xmed, trigger);
+			int med_G = hist8_median(XG, G, x, xmed, trigger);
+			int med_B = hist8_median(XB, B, x, xmed, trigger);
+
+			gp_putpixel_raw_16BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB565_LE(med_R, med_G, med_B));
+
+			/* Recompute histograms */
+			hist8_sub(XR, R, x);
+			hist8_sub(XG, G, x);
+			hist8_sub(XB, B, x);
+
+			hist8_add(XR, R, (x + 2 * xmed + 1));
+			hist8_add(XG, G, (x + 2 * xmed + 1));
+			hist8_add(XB, B, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			hist8_dec(R, x, GP_PIXEL_GET_R_RGB565_LE(pix));
+			hist8_dec(G, x, GP_PIXEL_GET_G_RGB565_LE(pix));
+			hist8_dec(B, x, GP_PIXEL_GET_B_RGB565_LE(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGB565_LE(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGB565_LE(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGB565_LE(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_RGB666(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 3 * sizeof(struct hist8) * size + 3 * sizeof(struct hist8u));
+
+	struct hist8 *R = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *G = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *B = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(R, 0, sizeof(*R) * size);
+	memset(G, 0, sizeof(*G) * size);
+	memset(B, 0, sizeof(*B) * size);
+
+	struct hist8u *XR = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XG = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XB = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGB666(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGB666(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGB666(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XR, 0, sizeof(*XR));
+		memset(XG, 0, sizeof(*XG));
+		memset(XB, 0, sizeof(*XB));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XR, R, i);
+			hist8_add_fine(XG, G, i);
+			hist8_add_fine(XB, B, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_R = hist8_median(XR, R, x, xmed, trigger);
+			int med_G = hist8_median(XG, G, x, xmed, trigger);
+			int med_B = hist8_median(XB, B, x, xmed, trigger);
+
+			gp_putpixel_raw_18BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB666(med_R, med_G, med_B));
+
+			/* Recompute histograms */
+			hist8_sub(XR, R, x);
+			hist8_sub(XG, G, x);
+			hist8_sub(XB, B, x);
+
+			hist8_add(XR, R, (x + 2 * xmed + 1));
+			hist8_add(XG, G, (x + 2 * xmed + 1));
+			hist8_add(XB, B, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, xi, yi);
+
+			hist8_dec(R, x, GP_PIXEL_GET_R_RGB666(pix));
+			hist8_dec(G, x, GP_PIXEL_GET_G_RGB666(pix));
+			hist8_dec(B, x, GP_PIXEL_GET_B_RGB666(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_18BPP_DB(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGB666(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGB666(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGB666(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_RGB332(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 3 * sizeof(struct hist8) * size + 3 * sizeof(struct hist8u));
+
+	struct hist8 *R = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *G = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *B = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(R, 0, sizeof(*R) * size);
+	memset(G, 0, sizeof(*G) * size);
+	memset(B, 0, sizeof(*B) * size);
+
+	struct hist8u *XR = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XG = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XB = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGB332(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGB332(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGB332(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XR, 0, sizeof(*XR));
+		memset(XG, 0, sizeof(*XG));
+		memset(XB, 0, sizeof(*XB));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XR, R, i);
+			hist8_add_fine(XG, G, i);
+			hist8_add_fine(XB, B, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_R = hist8_median(XR, R, x, xmed, trigger);
+			int med_G = hist8_median(XG, G, x, xmed, trigger);
+			int med_B = hist8_median(XB, B, x, xmed, trigger);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB332(med_R, med_G, med_B));
+
+			/* Recompute histograms */
+			hist8_sub(XR, R, x);
+			hist8_sub(XG, G, x);
+			hist8_sub(XB, B, x);
+
+			hist8_add(XR, R, (x + 2 * xmed + 1));
+			hist8_add(XG, G, (x + 2 * xmed + 1));
+			hist8_add(XB, B, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			hist8_dec(R, x, GP_PIXEL_GET_R_RGB332(pix));
+			hist8_dec(G, x, GP_PIXEL_GET_G_RGB332(pix));
+			hist8_dec(B, x, GP_PIXEL_GET_B_RGB332(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			hist8_inc(R, x, GP_PIXEL_GET_R_RGB332(pix));
+			hist8_inc(G, x, GP_PIXEL_GET_G_RGB332(pix));
+			hist8_inc(B, x, GP_PIXEL_GET_B_RGB332(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_CMYK8888(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 4 * sizeof(struct hist8) * size + 4 * sizeof(struct hist8u));
+
+	struct hist8 *K = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *Y = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *M = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *C = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(K, 0, sizeof(*K) * size);
+	memset(Y, 0, sizeof(*Y) * size);
+	memset(M, 0, sizeof(*M) * size);
+	memset(C, 0, sizeof(*C) * size);
+
+	struct hist8u *XK = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XY = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XM = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XC = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			hist8_inc(K, x, GP_PIXEL_GET_K_CMYK8888(pix));
+			hist8_inc(Y, x, GP_PIXEL_GET_Y_CMYK8888(pix));
+			hist8_inc(M, x, GP_PIXEL_GET_M_CMYK8888(pix));
+			hist8_inc(C, x, GP_PIXEL_GET_C_CMYK8888(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XK, 0, sizeof(*XK));
+		memset(XY, 0, sizeof(*XY));
+		memset(XM, 0, sizeof(*XM));
+		memset(XC, 0, sizeof(*XC));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XK, K, i);
+			hist8_add_fine(XY, Y, i);
+			hist8_add_fine(XM, M, i);
+			hist8_add_fine(XC, C, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_K = hist8_median(XK, K, x, xmed, trigger);
+			int med_Y = hist8_median(XY, Y, x, xmed, trigger);
+			int med_M = hist8_median(XM, M, x, xmed, trigger);
+			int med_C = hist8_median(XC, C, x, xmed, trigger);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_CMYK8888(med_K, med_Y, med_M, med_C));
+
+			/* Recompute histograms */
+			hist8_sub(XK, K, x);
+			hist8_sub(XY, Y, x);
+			hist8_sub(XM, M, x);
+			hist8_sub(XC, C, x);
+
+			hist8_add(XK, K, (x + 2 * xmed + 1));
+			hist8_add(XY, Y, (x + 2 * xmed + 1));
+			hist8_add(XM, M, (x + 2 * xmed + 1));
+			hist8_add(XC, C, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			hist8_dec(K, x, GP_PIXEL_GET_K_CMYK8888(pix));
+			hist8_dec(Y, x, GP_PIXEL_GET_Y_CMYK8888(pix));
+			hist8_dec(M, x, GP_PIXEL_GET_M_CMYK8888(pix));
+			hist8_dec(C, x, GP_PIXEL_GET_C_CMYK8888(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			hist8_inc(K, x, GP_PIXEL_GET_K_CMYK8888(pix));
+			hist8_inc(Y, x, GP_PIXEL_GET_Y_CMYK8888(pix));
+			hist8_inc(M, x, GP_PIXEL_GET_M_CMYK8888(pix));
+			hist8_inc(C, x, GP_PIXEL_GET_C_CMYK8888(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_G1_DB(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 1 * sizeof(struct hist8) * size + 1 * sizeof(struct hist8u));
+
+	struct hist8 *V = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(V, 0, sizeof(*V) * size);
+
+	struct hist8u *XV = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G1_DB(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XV, 0, sizeof(*XV));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XV, V, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_V = hist8_median(XV, V, x, xmed, trigger);
+
+			gp_putpixel_raw_1BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G1_DB(med_V));
+
+			/* Recompute histograms */
+			hist8_sub(XV, V, x);
+
+			hist8_add(XV, V, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, xi, yi);
+
+			hist8_dec(V, x, GP_PIXEL_GET_V_G1_DB(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_1BPP_DB(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G1_DB(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_G2_DB(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 1 * sizeof(struct hist8) * size + 1 * sizeof(struct hist8u));
+
+	struct hist8 *V = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(V, 0, sizeof(*V) * size);
+
+	struct hist8u *XV = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G2_DB(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XV, 0, sizeof(*XV));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XV, V, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_V = hist8_median(XV, V, x, xmed, trigger);
+
+			gp_putpixel_raw_2BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G2_DB(med_V));
+
+			/* Recompute histograms */
+			hist8_sub(XV, V, x);
+
+			hist8_add(XV, V, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, xi, yi);
+
+			hist8_dec(V, x, GP_PIXEL_GET_V_G2_DB(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_2BPP_DB(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G2_DB(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_G4_DB(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 1 * sizeof(struct hist8) * size + 1 * sizeof(struct hist8u));
+
+	struct hist8 *V = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(V, 0, sizeof(*V) * size);
+
+	struct hist8u *XV = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G4_DB(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XV, 0, sizeof(*XV));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XV, V, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_V = hist8_median(XV, V, x, xmed, trigger);
+
+			gp_putpixel_raw_4BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G4_DB(med_V));
+
+			/* Recompute histograms */
+			hist8_sub(XV, V, x);
+
+			hist8_add(XV, V, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, xi, yi);
+
+			hist8_dec(V, x, GP_PIXEL_GET_V_G4_DB(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_4BPP_DB(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G4_DB(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_G1_UB(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 1 * sizeof(struct hist8) * size + 1 * sizeof(struct hist8u));
+
+	struct hist8 *V = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(V, 0, sizeof(*V) * size);
+
+	struct hist8u *XV = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G1_UB(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XV, 0, sizeof(*XV));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XV, V, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_V = hist8_median(XV, V, x, xmed, trigger);
+
+			gp_putpixel_raw_1BPP_UB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G1_UB(med_V));
+
+			/* Recompute histograms */
+			hist8_sub(XV, V, x);
+
+			hist8_add(XV, V, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, xi, yi);
+
+			hist8_dec(V, x, GP_PIXEL_GET_V_G1_UB(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_1BPP_UB(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G1_UB(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_G2_UB(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 1 * sizeof(struct hist8) * size + 1 * sizeof(struct hist8u));
+
+	struct hist8 *V = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(V, 0, sizeof(*V) * size);
+
+	struct hist8u *XV = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G2_UB(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XV, 0, sizeof(*XV));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XV, V, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_V = hist8_median(XV, V, x, xmed, trigger);
+
+			gp_putpixel_raw_2BPP_UB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G2_UB(med_V));
+
+			/* Recompute histograms */
+			hist8_sub(XV, V, x);
+
+			hist8_add(XV, V, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, xi, yi);
+
+			hist8_dec(V, x, GP_PIXEL_GET_V_G2_UB(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_2BPP_UB(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G2_UB(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_G4_UB(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 1 * sizeof(struct hist8) * size + 1 * sizeof(struct hist8u));
+
+	struct hist8 *V = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(V, 0, sizeof(*V) * size);
+
+	struct hist8u *XV = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G4_UB(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XV, 0, sizeof(*XV));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XV, V, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_V = hist8_median(XV, V, x, xmed, trigger);
+
+			gp_putpixel_raw_4BPP_UB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G4_UB(med_V));
+
+			/* Recompute histograms */
+			hist8_sub(XV, V, x);
+
+			hist8_add(XV, V, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, xi, yi);
+
+			hist8_dec(V, x, GP_PIXEL_GET_V_G4_UB(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_4BPP_UB(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G4_UB(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_G8(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 1 * sizeof(struct hist8) * size + 1 * sizeof(struct hist8u));
+
+	struct hist8 *V = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(V, 0, sizeof(*V) * size);
+
+	struct hist8u *XV = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G8(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XV, 0, sizeof(*XV));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XV, V, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_V = hist8_median(XV, V, x, xmed, trigger);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G8(med_V));
+
+			/* Recompute histograms */
+			hist8_sub(XV, V, x);
+
+			hist8_add(XV, V, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			hist8_dec(V, x, GP_PIXEL_GET_V_G8(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_G8(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median_GA88(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+	unsigned int size = (w_src + 2 * xmed + 1);
+
+	/* Create and initalize arrays for row of histograms */
+	gp_temp_alloc_create(temp, 2 * sizeof(struct hist8) * size + 2 * sizeof(struct hist8u));
+
+	struct hist8 *V = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	struct hist8 *A = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+
+	memset(V, 0, sizeof(*V) * size);
+	memset(A, 0, sizeof(*A) * size);
+
+	struct hist8u *XV = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XA = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)w_src + 2*xmed; x++) {
+		int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+
+		for (y = -ymed; y <= ymed; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_GA88(pix));
+			hist8_inc(A, x, GP_PIXEL_GET_A_GA88(pix));
+		}
+	}
+
+	/* Apply the median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		memset(XV, 0, sizeof(*XV));
+		memset(XA, 0, sizeof(*XA));
+
+		/* Compute first histogram */
+		for (i = 0; i <= 2*xmed; i++) {
+			hist8_add_fine(XV, V, i);
+			hist8_add_fine(XA, A, i);
+		}
+
+		/* Generate row */
+		for (x = 0; x < (int)w_src; x++) {
+			int med_V = hist8_median(XV, V, x, xmed, trigger);
+			int med_A = hist8_median(XA, A, x, xmed, trigger);
+
+			gp_putpixel_raw_16BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_GA88(med_V, med_A));
+
+			/* Recompute histograms */
+			hist8_sub(XV, V, x);
+			hist8_sub(XA, A, x);
+
+			hist8_add(XV, V, (x + 2 * xmed + 1));
+			hist8_add(XA, A, (x + 2 * xmed + 1));
+		}
+
+		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
+		for (x = 0; x < (int)w_src + 2*xmed; x++) {
+			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			hist8_dec(V, x, GP_PIXEL_GET_V_GA88(pix));
+			hist8_dec(A, x, GP_PIXEL_GET_A_GA88(pix));
+
+			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			hist8_inc(V, x, GP_PIXEL_GET_V_GA88(pix));
+			hist8_inc(A, x, GP_PIXEL_GET_A_GA88(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int median(const gp_pixmap *src,
+                  gp_coord x_src, gp_coord y_src,
+                  gp_size w_src, gp_size h_src,
+                  gp_pixmap *dst,
+                  gp_coord x_dst, gp_coord y_dst,
+                  int xmed, int ymed,
+                  gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return median_xRGB8888(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_RGBA8888:
+		return median_RGBA8888(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_RGB888:
+		return median_RGB888(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_BGR888:
+		return median_BGR888(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_RGB555:
+		return median_RGB555(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_RGB565_BE:
+		return median_RGB565_BE(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_RGB565_LE:
+		return median_RGB565_LE(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_RGB666:
+		return median_RGB666(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_RGB332:
+		return median_RGB332(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_CMYK8888:
+		return median_CMYK8888(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_G1_DB:
+		return median_G1_DB(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_G2_DB:
+		return median_G2_DB(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_G4_DB:
+		return median_G4_DB(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_G1_UB:
+		return median_G1_UB(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_G2_UB:
+		return median_G2_UB(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_G4_UB:
+		return median_G4_UB(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_G8:
+		return median_G8(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	case GP_PIXEL_GA88:
+		return median_GA88(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	default:
+		errno = ENOSYS;
+		return -1;
+	}
+}
+
+/*
+ * The strips read the halo of 2*xmed columns from the source so the result
+ * does not depend on the number of threads.
+ */
+#ifdef HAVE_PTHREAD
+struct median_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	int xmed;
+	int ymed;
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
+
+static void *median_thread(void *arg)
+{
+	struct median_args *a = arg;
+
+	a->ret = median(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  a->xmed, a->ymed, a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int median_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       int xmed, int ymed,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+	t = GP_MIN(t, w_src);
+
+	if (t <= 1) {
+		return median(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, xmed, ymed, callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct median_args args[t];
+	char started[t];
+	gp_size w = w_src / t;
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct median_args) {
+			.src = src,
+			.x_src = x_src + i * w,
+			.y_src = y_src,
+			.w_src = i == t - 1 ? w_src - i * w : w,
+			.h_src = h_src,
+			.dst = dst,
+			.x_dst = x_dst + i * w,
+			.y_dst = y_dst,
+			.xmed = xmed,
+			.ymed = ymed,
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, median_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			median_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+#else
+static int median_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       int xmed, int ymed,
+                       gp_progress_cb *callback)
+{
+	return median(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, xmed, ymed, callback);
+}
+#endif /* HAVE_PTHREAD */
+
+int gp_filter_median_ex(const gp_pixmap *src,
+                        gp_coord x_src, gp_coord y_src,
+                        gp_size w_src, gp_size h_src,
+                        gp_pixmap *dst,
+                        gp_coord x_dst, gp_coord y_dst,
+		        int xmed, int ymed,
+                        gp_progress_cb *callback)
+{
+	GP_CHECK(src->pixel_type == dst->pixel_type);
+
+	/* Check that destination is large enough */
+	GP_CHECK(x_dst + (gp_coord)w_src <= (gp_coord)dst->w);
+	GP_CHECK(y_dst + (gp_coord)h_src <= (gp_coord)dst->h);
+
+	GP_CHECK(xmed >= 0 && ymed >= 0);
+
+	return median_mp(src, x_src, y_src, w_src, h_src,
+	                 dst, x_dst, y_dst, xmed, ymed, callback);
+}
+
+gp_pixmap *gp_filter_median_ex_alloc(const gp_pixmap *src,
+                                     gp_coord x_src, gp_coord y_src,
+                                     gp_size w_src, gp_size h_src,
+                                     int xmed, int ymed,
+                                     gp_progress_cb *callback)
+{
+	int ret;
+
+	GP_CHECK(xmed >= 0 && ymed >= 0);
+
+	gp_pixmap *dst = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (dst == NULL)
+		return NULL;
+
+	ret = median_mp(src, x_src, y_src, w_src, h_src,
+	                dst, 0, 0, xmed, ymed, callback);
+
+	if (ret) {
+		gp_pixmap_free(dst);
+		return NULL;
+	}
+
+	return dst;
+}
@@ -1,20 +1,25 @@
-// SPDX-License-Identifier: LGPL-2.1-or-later
+@ include source.t
+@ include thread_dispatcher.t
 /*
- * Copyright (C) 2009-2013 Cyril Hrubis <metan@ucw.cz>
+ * Constant time median filter
+ *
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
  */
 
 #include <errno.h>
+#include <string.h>
+
+#include "../../config.h"
 
-#include "core/gp_pixmap.h"
+#include <core/gp_pixmap.h>
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_temp_alloc.h>
-#include "core/gp_clamp.h"
+#include <core/gp_clamp.h>
+#include <core/gp_threads.h>
 #include <core/gp_debug.h>
 
 #include <filters/gp_median.h>
 
-#include <string.h>
-
 struct hist8 {
 	unsigned int coarse[16];
 	unsigned int fine[16][16];
@@ -149,22 +154,29 @@ static inline unsigned int hist8_median(struct hist8u *h, struct hist8 *row,
 	return 0;
 }
 
-static int gp_filter_median_raw(const gp_pixmap *src,
+@ # The histograms are 8 bit, channels up to 8 bits are supported
+@ def median_supported(pt):
+@     if pt.is_unknown() or pt.is_palette():
+@         return False
+@     for c in pt.chanslist:
+@         if c.size > 8:
+@             return False
+@     return True
+@ end
+@
+@ for pt in pixeltypes:
+@     if median_supported(pt):
+static int median_{{ pt.name }}(const gp_pixmap *src,
                                 gp_coord x_src, gp_coord y_src,
                                 gp_size w_src, gp_size h_src,
                                 gp_pixmap *dst,
                                 gp_coord x_dst, gp_coord y_dst,
-		                int xmed, int ymed,
+                                int xmed, int ymed,
                                 gp_progress_cb *callback)
 {
 	int i, x, y;
 	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
 
-	if (src->pixel_type != GP_PIXEL_RGB888 && src->pixel_type != GP_PIXEL_BGR888) {
-		errno = ENOSYS;
-		return -1;
-	}
-
 	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
 	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
 
@@ -172,19 +184,19 @@ static int gp_filter_median_raw(const gp_pixmap *src,
 	unsigned int size = (w_src + 2 * xmed + 1);
 
 	/* Create and initalize arrays for row of histograms */
-	gp_temp_alloc_create(temp, 3 * sizeof(struct hist8) * size + 3 * sizeof(struct hist8u));
+	gp_temp_alloc_create(temp, {{ pt.chan_cnt }} * sizeof(struct hist8) * size + {{ pt.chan_cnt }} * sizeof(struct hist8u));
 
-	struct hist8 *R = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
-	struct hist8 *G = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
-	struct hist8 *B = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+@         for c in pt.chanslist:
+	struct hist8 *{{ c.name }} = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+@         end
 
-	memset(R, 0, sizeof(*R) * size);
-	memset(G, 0, sizeof(*G) * size);
-	memset(B, 0, sizeof(*B) * size);
+@         for c in pt.chanslist:
+	memset({{ c.name }}, 0, sizeof(*{{ c.name }}) * size);
+@         end
 
-	struct hist8u *XR = gp_temp_alloc_get(temp, sizeof(struct hist8u));
-	struct hist8u *XG = gp_temp_alloc_get(temp, sizeof(struct hist8u));
-	struct hist8u *XB = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+@         for c in pt.chanslist:
+	struct hist8u *X{{ c.name }} = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+@         end
 
 	/* Prefill row of histograms */
 	for (x = 0; x < (int)w_src + 2*xmed; x++) {
@@ -193,44 +205,44 @@ static int gp_filter_median_raw(const gp_pixmap *src,
 		for (y = -ymed; y <= ymed; y++) {
 			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
 
-			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+			gp_pixel pix = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, xi, yi);
 
-			hist8_inc(R, x, GP_PIXEL_GET_R_RGB888(pix));
-			hist8_inc(G, x, GP_PIXEL_GET_G_RGB888(pix));
-			hist8_inc(B, x, GP_PIXEL_GET_B_RGB888(pix));
+@         for c in pt.chanslist:
+			hist8_inc({{ c.name }}, x, GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix));
+@         end
 		}
 	}
 
 	/* Apply the median filter */
 	for (y = 0; y < (int)h_src; y++) {
-		memset(XR, 0, sizeof(*XR));
-		memset(XG, 0, sizeof(*XG));
-		memset(XB, 0, sizeof(*XB));
+@         for c in pt.chanslist:
+		memset(X{{ c.name }}, 0, sizeof(*X{{ c.name }}));
+@         end
 
 		/* Compute first histogram */
 		for (i = 0; i <= 2*xmed; i++) {
-			hist8_add_fine(XR, R, i);
-			hist8_add_fine(XG, G, i);
-			hist8_add_fine(XB, B, i);
+@         for c in pt.chanslist:
+			hist8_add_fine(X{{ c.name }}, {{ c.name }}, i);
+@         end
 		}
 
 		/* Generate row */
 		for (x = 0; x < (int)w_src; x++) {
-			int r = hist8_median(XR, R, x, xmed, trigger);
-			int g = hist8_median(XG, G, x, xmed, trigger);
-			int b = hist8_median(XB, B, x, xmed, trigger);
+@         for c in pt.chanslist:
+			int med_{{ c.name }} = hist8_median(X{{ c.name }}, {{ c.name }}, x, xmed, trigger);
+@         end
 
-			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
-			                      GP_PIXEL_CREATE_RGB888(r, g, b));
+			gp_putpixel_raw_{{ pt.pixelpack.suffix }}(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names, 'med_') }}));
 
 			/* Recompute histograms */
-			hist8_sub(XR, R, x);
-			hist8_sub(XG, G, x);
-			hist8_sub(XB, B, x);
+@         for c in pt.chanslist:
+			hist8_sub(X{{ c.name }}, {{ c.name }}, x);
+@         end
 
-			hist8_add(XR, R, (x + 2 * xmed + 1));
-			hist8_add(XG, G, (x + 2 * xmed + 1));
-			hist8_add(XB, B, (x + 2 * xmed + 1));
+@         for c in pt.chanslist:
+			hist8_add(X{{ c.name }}, {{ c.name }}, (x + 2 * xmed + 1));
+@         end
 		}
 
 		/* Recompute histograms, remove y - ymed pixel add y + ymed + 1 */
@@ -238,19 +250,19 @@ static int gp_filter_median_raw(const gp_pixmap *src,
 			int xi = GP_CLAMP(x_src + x - xmed, 0, (int)src->w - 1);
 			int yi = GP_CLAMP(y_src + y - ymed, 0, (int)src->h - 1);
 
-			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+			gp_pixel pix = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, xi, yi);
 
-			hist8_dec(R, x, GP_PIXEL_GET_R_RGB888(pix));
-			hist8_dec(G, x, GP_PIXEL_GET_G_RGB888(pix));
-			hist8_dec(B, x, GP_PIXEL_GET_B_RGB888(pix));
+@         for c in pt.chanslist:
+			hist8_dec({{ c.name }}, x, GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix));
+@         end
 
 			yi = GP_MIN(y_src + y + ymed + 1, (int)src->h - 1);
 
-			pix = gp_getpixel_raw_24BPP(src, xi, yi);
+			pix = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, xi, yi);
 
-			hist8_inc(R, x, GP_PIXEL_GET_R_RGB888(pix));
-			hist8_inc(G, x, GP_PIXEL_GET_G_RGB888(pix));
-			hist8_inc(B, x, GP_PIXEL_GET_B_RGB888(pix));
+@         for c in pt.chanslist:
+			hist8_inc({{ c.name }}, x, GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix));
+@         end
 		}
 
 		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
@@ -265,6 +277,34 @@ static int gp_filter_median_raw(const gp_pixmap *src,
 	return 0;
 }
 
+@ end
+static int median(const gp_pixmap *src,
+                  gp_coord x_src, gp_coord y_src,
+                  gp_size w_src, gp_size h_src,
+                  gp_pixmap *dst,
+                  gp_coord x_dst, gp_coord y_dst,
+                  int xmed, int ymed,
+                  gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+@ for pt in pixeltypes:
+@     if median_supported(pt):
+	case GP_PIXEL_{{ pt.name }}:
+		return median_{{ pt.name }}(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+@ end
+	default:
+		errno = ENOSYS;
+		return -1;
+	}
+}
+
+/*
+ * The strips read the halo of 2*xmed columns from the source so the result
+ * does not depend on the number of threads.
+ */
+{@ dispatcher('median', [['int', 'xmed'], ['int', 'ymed']], True) @}
+
 int gp_filter_median_ex(const gp_pixmap *src,
                         gp_coord x_src, gp_coord y_src,
                         gp_size w_src, gp_size h_src,
@@ -281,8 +321,8 @@ int gp_filter_median_ex(const gp_pixmap *src,
 
 	GP_CHECK(xmed >= 0 && ymed >= 0);
 
-	return gp_filter_median_raw(src, x_src, y_src, w_src, h_src,
-	                            dst, x_dst, y_dst, xmed, ymed, callback);
+	return median_mp(src, x_src, y_src, w_src, h_src,
+	                 dst, x_dst, y_dst, xmed, ymed, callback);
 }
 
 gp_pixmap *gp_filter_median_ex_alloc(const gp_pixmap *src,
@@ -300,8 +340,8 @@ gp_pixmap *gp_filter_median_ex_alloc(const gp_pixmap *src,
 	if (dst == NULL)
 		return NULL;
 
-	ret = gp_filter_median_raw(src, x_src, y_src, w_src, h_src,
-	                          dst, 0, 0, xmed, ymed, callback);
+	ret = median_mp(src, x_src, y_src, w_src, h_src,
+	                dst, 0, 0, xmed, ymed, callback);
 
 	if (ret) {
 		gp_pixmap_free(dst);
@@ -0,0 +1,1255 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_multi_tone.gen.c
+ *
+ * GENERATED on 2026 10 19 20:26:18 from gp_multi_tone.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Generic Point filer
+ *
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include "../../config.h"
+
+#include "core/gp_pixmap.h"
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_threads.h>
+#include <core/gp_mix_pixels.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_multi_tone.h>
+
+static void init_table_RGB101010(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB101010(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB101010);
+	}
+}
+
+static void init_table_xRGB8888(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_xRGB8888(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_xRGB8888);
+	}
+}
+
+static void init_table_RGBA8888(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGBA8888(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGBA8888);
+	}
+}
+
+static void init_table_RGB888(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB888(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB888);
+	}
+}
+
+static void init_table_BGR888(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_BGR888(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_BGR888);
+	}
+}
+
+static void init_table_RGB555(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB555(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB555);
+	}
+}
+
+static void init_table_RGB565_BE(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB565_BE(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB565_BE);
+	}
+}
+
+static void init_table_RGB565_LE(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB565_LE(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB565_LE);
+	}
+}
+
+static void init_table_RGB666(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB666(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB666);
+	}
+}
+
+static void init_table_RGB332(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_RGB332(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_RGB332);
+	}
+}
+
+static void init_table_CMYK8888(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_CMYK8888(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_CMYK8888);
+	}
+}
+
+static void init_table_G1_DB(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G1_DB(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G1_DB);
+	}
+}
+
+static void init_table_G2_DB(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G2_DB(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G2_DB);
+	}
+}
+
+static void init_table_G4_DB(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G4_DB(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G4_DB);
+	}
+}
+
+static void init_table_G1_UB(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G1_UB(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G1_UB);
+	}
+}
+
+static void init_table_G2_UB(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G2_UB(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G2_UB);
+	}
+}
+
+static void init_table_G4_UB(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G4_UB(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G4_UB);
+	}
+}
+
+static void init_table_G8(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G8(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G8);
+	}
+}
+
+static void init_table_GA88(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_GA88(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_GA88);
+	}
+}
+
+static void init_table_G16(gp_pixel table[],
+                                     gp_size table_size,
+                                     gp_pixel pixels[],
+                                     gp_size pixels_size)
+{
+	unsigned int i;
+	unsigned int p = 0;
+	float perc;
+	float step = 1.00 * table_size / (pixels_size - 1);
+
+	GP_DEBUG(2, "Preparing pixel table %u steps %u pixels, step %.2f",
+	         table_size, pixels_size, step);
+
+	for (i = 0; i < table_size; i++) {
+		p = 1.00 * i / step;
+		perc = i+1;
+
+		while (perc > step)
+			perc -= step;
+
+		perc = perc / step;
+
+		table[i] = GP_MIX_PIXELS_G16(pixels[p+1], pixels[p], 255 * perc);
+//		printf("p = %u i = %u PERC %.2f\n", p, i, perc);
+//		gp_pixel_print(table[i], GP_PIXEL_G16);
+	}
+}
+
+static void init_table(gp_pixel_type type,
+                       gp_pixel table[], gp_size table_size,
+                       gp_pixel pixels[], gp_size pixels_size)
+{
+	switch (type) {
+	case GP_PIXEL_RGB101010:
+		init_table_RGB101010(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_xRGB8888:
+		init_table_xRGB8888(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGBA8888:
+		init_table_RGBA8888(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGB888:
+		init_table_RGB888(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_BGR888:
+		init_table_BGR888(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGB555:
+		init_table_RGB555(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGB565_BE:
+		init_table_RGB565_BE(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGB565_LE:
+		init_table_RGB565_LE(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGB666:
+		init_table_RGB666(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_RGB332:
+		init_table_RGB332(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_CMYK8888:
+		init_table_CMYK8888(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G1_DB:
+		init_table_G1_DB(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G2_DB:
+		init_table_G2_DB(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G4_DB:
+		init_table_G4_DB(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G1_UB:
+		init_table_G1_UB(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G2_UB:
+		init_table_G2_UB(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G4_UB:
+		init_table_G4_UB(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G8:
+		init_table_G8(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_GA88:
+		init_table_GA88(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	case GP_PIXEL_G16:
+		init_table_G16(table, table_size,
+		                         pixels, pixels_size);
+	break;
+	default:
+		GP_BUG("Should not be reached");
+	break;
+	}
+}
+
+static int multitone_G1_DB(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   const gp_pixel *table,
+                                   gp_progress_cb *callback)
+{
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_G2_DB(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   const gp_pixel *table,
+                                   gp_progress_cb *callback)
+{
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_G4_DB(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   const gp_pixel *table,
+                                   gp_progress_cb *callback)
+{
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_G1_UB(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   const gp_pixel *table,
+                                   gp_progress_cb *callback)
+{
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_G2_UB(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   const gp_pixel *table,
+                                   gp_progress_cb *callback)
+{
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_G4_UB(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   const gp_pixel *table,
+                                   gp_progress_cb *callback)
+{
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_G8(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   const gp_pixel *table,
+                                   gp_progress_cb *callback)
+{
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_GA88(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   const gp_pixel *table,
+                                   gp_progress_cb *callback)
+{
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone_G16(const gp_pixmap *const src,
+                                   gp_coord x_src, gp_coord y_src,
+                                   gp_size w_src, gp_size h_src,
+                                   gp_pixmap *dst,
+                                   gp_coord x_dst, gp_coord y_dst,
+                                   const gp_pixel *table,
+                                   gp_progress_cb *callback)
+{
+	unsigned int x, y;
+
+	for (y = 0; y < h_src; y++) {
+		for (x = 0; x < w_src; x++) {
+			unsigned int src_x = x_src + x;
+			unsigned int src_y = y_src + y;
+			unsigned int dst_x = x_dst + x;
+			unsigned int dst_y = y_dst + y;
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, src_x, src_y);
+
+			pix = table[pix];
+
+			gp_putpixel_raw(dst, dst_x, dst_y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int multitone(const gp_pixmap *const src,
+                     gp_coord x_src, gp_coord y_src,
+                     gp_size w_src, gp_size h_src,
+                     gp_pixmap *dst,
+                     gp_coord x_dst, gp_coord y_dst,
+                     const gp_pixel *table,
+                     gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_G1_DB:
+		return multitone_G1_DB(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               table, callback);
+	case GP_PIXEL_G2_DB:
+		return multitone_G2_DB(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               table, callback);
+	case GP_PIXEL_G4_DB:
+		return multitone_G4_DB(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               table, callback);
+	case GP_PIXEL_G1_UB:
+		return multitone_G1_UB(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               table, callback);
+	case GP_PIXEL_G2_UB:
+		return multitone_G2_UB(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               table, callback);
+	case GP_PIXEL_G4_UB:
+		return multitone_G4_UB(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               table, callback);
+	case GP_PIXEL_G8:
+		return multitone_G8(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               table, callback);
+	case GP_PIXEL_GA88:
+		return multitone_GA88(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               table, callback);
+	case GP_PIXEL_G16:
+		return multitone_G16(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               table, callback);
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+#ifdef HAVE_PTHREAD
+struct multitone_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	const gp_pixel *table;
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
+
+static void *multitone_thread(void *arg)
+{
+	struct multitone_args *a = arg;
+
+	a->ret = multitone(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  a->table, a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int multitone_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       const gp_pixel *table,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+	t = GP_MIN(t, h_src);
+
+	if (t <= 1) {
+		return multitone(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, table, callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct multitone_args args[t];
+	char started[t];
+	gp_size h = h_src / t;
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct multitone_args) {
+			.src = src,
+			.x_src = x_src,
+			.y_src = y_src + i * h,
+			.w_src = w_src,
+			.h_src = i == t - 1 ? h_src - i * h : h,
+			.dst = dst,
+			.x_dst = x_dst,
+			.y_dst = y_dst + i * h,
+			.table = table,
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, multitone_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			multitone_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+#else
+static int multitone_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       const gp_pixel *table,
+                       gp_progress_cb *callback)
+{
+	return multitone(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, table, callback);
+}
+#endif /* HAVE_PTHREAD */
+
+int gp_filter_multitone_ex(const gp_pixmap *const src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           gp_pixmap *dst,
+                           gp_coord x_dst, gp_coord y_dst,
+                           gp_pixel pixels[], gp_size pixels_size,
+                           gp_progress_cb *callback)
+{
+	gp_size size;
+	int ret;
+
+	//CHECK DST IS NOT PALETTE PixelHasFlags
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_G1_DB:
+		size = 2;
+	break;
+	case GP_PIXEL_G2_DB:
+		size = 4;
+	break;
+	case GP_PIXEL_G4_DB:
+		size = 16;
+	break;
+	case GP_PIXEL_G1_UB:
+		size = 2;
+	break;
+	case GP_PIXEL_G2_UB:
+		size = 4;
+	break;
+	case GP_PIXEL_G4_UB:
+		size = 16;
+	break;
+	case GP_PIXEL_G8:
+		size = 256;
+	break;
+	case GP_PIXEL_GA88:
+		size = 256;
+	break;
+	case GP_PIXEL_G16:
+		size = 65536;
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+
+	/* The table is shared read only by all the threads */
+	gp_temp_alloc_create(tmp, size * sizeof(gp_pixel));
+	gp_pixel *table = gp_temp_alloc_get(tmp, size * sizeof(gp_pixel));
+
+	GP_DEBUG(1, "Multitone filter %ux%u %s -> %s", w_src, h_src,
+	         gp_pixel_type_name(src->pixel_type),
+	         gp_pixel_type_name(dst->pixel_type));
+
+	init_table(dst->pixel_type, table, size, pixels, pixels_size);
+
+	ret = multitone_mp(src, x_src, y_src, w_src, h_src,
+	                   dst, x_dst, y_dst, table, callback);
+
+	gp_temp_alloc_free(tmp);
+
+	return ret;
+}
+
+gp_pixmap *gp_filter_multitone_ex_alloc(const gp_pixmap *const src,
+                                        gp_coord x_src, gp_coord y_src,
+                                        gp_size w_src, gp_size h_src,
+                                        gp_pixel_type dst_pixel_type,
+                                        gp_pixel pixels[], gp_size pixels_size,
+                                        gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+	int err;
+
+	res = gp_pixmap_alloc(w_src, h_src, dst_pixel_type);
+
+	if (!res) {
+		GP_DEBUG(1, "Malloc failed :(");
+		return NULL;
+	}
+
+	if (gp_filter_multitone_ex(src, x_src, y_src, w_src, h_src, res, 0, 0,
+	                         pixels, pixels_size, callback)) {
+		err = errno;
+		gp_pixmap_free(res);
+		errno = err;
+		return NULL;
+	}
+
+	return res;
+}
@@ -1,15 +1,19 @@
 @ include source.t
+@ include thread_dispatcher.t
 /*
  * Generic Point filer
  *
- * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
  */
 
 #include <errno.h>
 
+#include "../../config.h"
+
 #include "core/gp_pixmap.h"
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_temp_alloc.h>
+#include <core/gp_threads.h>
 #include <core/gp_mix_pixels.h>
 #include <core/gp_debug.h>
 
@@ -65,8 +69,6 @@ static void init_table(gp_pixel_type type,
 	}
 }
 
-#include <assert.h>
-
 @ for pt in pixeltypes:
 @     if pt.is_gray():
 static int multitone_{{ pt.name }}(const gp_pixmap *const src,
@@ -74,18 +76,9 @@ static int multitone_{{ pt.name }}(const gp_pixmap *const src,
                                    gp_size w_src, gp_size h_src,
                                    gp_pixmap *dst,
                                    gp_coord x_dst, gp_coord y_dst,
-                                   gp_pixel pixels[], gp_size pixels_size,
+                                   const gp_pixel *table,
                                    gp_progress_cb *callback)
 {
-@         size = pt.chanslist[0].max + 1
-	gp_temp_alloc_create(tmp, {{ size }} * sizeof(gp_pixel));
-	gp_pixel *table = gp_temp_alloc_get(tmp, {{ size }} * sizeof(gp_pixel));
-
-	GP_DEBUG(1, "Duotone filter %ux%u {{ pt.name }} -> %s",
-	         w_src, h_src, gp_pixel_type_name(dst->pixel_type));
-
-	init_table(dst->pixel_type, table, {{ size }}, pixels, pixels_size);
-
 	unsigned int x, y;
 
 	for (y = 0; y < h_src; y++) {
@@ -103,13 +96,11 @@ static int multitone_{{ pt.name }}(const gp_pixmap *const src,
 		}
 
 		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
-			gp_temp_alloc_free(tmp);
 			errno = ECANCELED;
 			return 1;
 		}
 	}
 
-	gp_temp_alloc_free(tmp);
 	gp_progress_cb_done(callback);
 
 	return 0;
@@ -117,6 +108,31 @@ static int multitone_{{ pt.name }}(const gp_pixmap *const src,
 
 @ end
 @
+static int multitone(const gp_pixmap *const src,
+                     gp_coord x_src, gp_coord y_src,
+                     gp_size w_src, gp_size h_src,
+                     gp_pixmap *dst,
+                     gp_coord x_dst, gp_coord y_dst,
+                     const gp_pixel *table,
+                     gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+@ for pt in pixeltypes:
+@     if pt.is_gray():
+	case GP_PIXEL_{{ pt.name }}:
+		return multitone_{{ pt.name }}(src, x_src, y_src,
+		                               w_src, h_src, dst,
+		                               x_dst, y_dst,
+		                               table, callback);
+@ end
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+{@ dispatcher('multitone', [['const gp_pixel *', 'table']]) @}
+
 int gp_filter_multitone_ex(const gp_pixmap *const src,
                            gp_coord x_src, gp_coord y_src,
                            gp_size w_src, gp_size h_src,
@@ -125,23 +141,39 @@ int gp_filter_multitone_ex(const gp_pixmap *const src,
                            gp_pixel pixels[], gp_size pixels_size,
                            gp_progress_cb *callback)
 {
+	gp_size size;
+	int ret;
+
 	//CHECK DST IS NOT PALETTE PixelHasFlags
 
 	switch (src->pixel_type) {
 @ for pt in pixeltypes:
 @     if pt.is_gray():
 	case GP_PIXEL_{{ pt.name }}:
-		return multitone_{{ pt.name }}(src, x_src, y_src,
-		                               w_src, h_src, dst,
-		                               x_dst, y_dst,
-		                               pixels, pixels_size,
-		                               callback);
+		size = {{ pt.chanslist[0].max + 1 }};
 	break;
 @ end
 	default:
 		errno = EINVAL;
 		return -1;
 	}
+
+	/* The table is shared read only by all the threads */
+	gp_temp_alloc_create(tmp, size * sizeof(gp_pixel));
+	gp_pixel *table = gp_temp_alloc_get(tmp, size * sizeof(gp_pixel));
+
+	GP_DEBUG(1, "Multitone filter %ux%u %s -> %s", w_src, h_src,
+	         gp_pixel_type_name(src->pixel_type),
+	         gp_pixel_type_name(dst->pixel_type));
+
+	init_table(dst->pixel_type, table, size, pixels, pixels_size);
+
+	ret = multitone_mp(src, x_src, y_src, w_src, h_src,
+	                   dst, x_dst, y_dst, table, callback);
+
+	gp_temp_alloc_free(tmp);
+
+	return ret;
 }
 
 gp_pixmap *gp_filter_multitone_ex_alloc(const gp_pixmap *const src,
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixmap.h>
+
+#include <filters/gp_point_chain.h>
+
+int gp_point_chain_init(gp_point_chain *self, gp_pixel_type pixel_type)
+{
+	GP_DEBUG(1, "Initializing point filter chain for %s",
+	         gp_pixel_type_name(pixel_type));
+
+	self->pixel_type = pixel_type;
+
+	return gp_filter_tables_init_type(&self->tables, pixel_type);
+}
+
+void gp_point_chain_exit(gp_point_chain *self)
+{
+	gp_filter_tables_free(&self->tables);
+}
+
+void gp_point_chain_reset(gp_point_chain *self)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(self->pixel_type);
+	unsigned int i;
+	gp_pixel j;
+
+	for (i = 0; i < desc->numchannels; i++) {
+		gp_pixel chan_max = (1 << desc->channels[i].size);
+		gp_pixel *table = self->tables.table[i];
+
+		for (j = 0; j < chan_max; j++)
+			table[j] = j;
+	}
+}
+
+static gp_pixel table_get(const gp_gamma_table *table, gp_pixel idx)
+{
+	if (table->out_bits > 8)
+		return table->u16[idx];
+
+	return table->u8[idx];
+}
+
+/* Rescales a value between channel sizes with rounding */
+static gp_pixel rescale(gp_pixel val, unsigned int from_bits, unsigned int to_bits)
+{
+	uint32_t from_max = (1U << from_bits) - 1;
+	uint32_t to_max = (1U << to_bits) - 1;
+
+	return ((uint64_t)val * to_max + from_max/2) / from_max;
+}
+
+int gp_point_chain_correction(gp_point_chain *self,
+                              gp_correction_desc *desc, int encode)
+{
+	const gp_pixel_type_desc *pdesc = gp_pixel_desc(self->pixel_type);
+	gp_gamma *gamma;
+	unsigned int i;
+	gp_pixel j;
+
+	gamma = gp_correction_acquire(self->pixel_type, desc);
+	if (!gamma)
+		return 1;
+
+	for (i = 0; i < pdesc->numchannels; i++) {
+		gp_pixel chan_max = (1 << pdesc->channels[i].size);
+		gp_pixel *table = self->tables.table[i];
+		const gp_gamma_table *lin = gamma->lin[i];
+		const gp_gamma_table *enc = gamma->enc[i];
+
+		/* Linear channels, e.g. alpha, have no tables */
+		if (!lin || !enc)
+			continue;
+
+		for (j = 0; j < chan_max; j++) {
+			gp_pixel val = table[j];
+
+			if (encode) {
+				val = rescale(val, lin->in_bits, lin->out_bits);
+				table[j] = table_get(enc, val);
+			} else {
+				val = table_get(lin, val);
+				table[j] = rescale(val, lin->out_bits, lin->in_bits);
+			}
+		}
+	}
+
+	gp_gamma_decref(gamma);
+
+	return 0;
+}
+
+int gp_point_chain_apply_ex(const gp_pixmap *src,
+                            gp_coord x_src, gp_coord y_src,
+                            gp_size w_src, gp_size h_src,
+                            gp_pixmap *dst,
+                            gp_coord x_dst, gp_coord y_dst,
+                            const gp_point_chain *self,
+                            gp_progress_cb *callback)
+{
+	if (src->pixel_type != self->pixel_type ||
+	    dst->pixel_type != self->pixel_type) {
+		GP_WARN("Chain for %s applied on %s -> %s",
+		        gp_pixel_type_name(self->pixel_type),
+		        gp_pixel_type_name(src->pixel_type),
+		        gp_pixel_type_name(dst->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	return gp_filter_tables_apply(src, x_src, y_src, w_src, h_src,
+	                              dst, x_dst, y_dst, &self->tables, callback);
+}
+
+gp_pixmap *gp_point_chain_apply_ex_alloc(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         const gp_point_chain *self,
+                                         gp_progress_cb *callback)
+{
+	gp_pixmap *new = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (!new)
+		return NULL;
+
+	if (gp_point_chain_apply_ex(src, x_src, y_src, w_src, h_src,
+	                            new, 0, 0, self, callback)) {
+		int err = errno;
+		gp_pixmap_free(new);
+		errno = err;
+		return NULL;
+	}
+
+	return new;
+}
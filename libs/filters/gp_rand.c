@@ -4,6 +4,7 @@
  */
 
 #include <math.h>
+#include <stdint.h>
 
 #include "core/gp_common.h"
 #include <filters/gp_rand.h>
@@ -32,3 +33,37 @@ void gp_norm_int(int *arr, unsigned int size, int sigma, int mu)
 		arr[i++] = mu + sigma * b * mul;
 	}
 }
+
+/* Maps upper 24 bits into (0, 1] and [0, 1) respectively */
+#define U24_OPEN0(r) ((((r) >> 8) + 1) * (1.0f / 16777216))
+#define U24_OPEN1(r) (((r) >> 8) * (1.0f / 16777216))
+
+void gp_norm_int_ctr(int *arr, unsigned int size, int sigma, int mu,
+                     uint64_t seed, uint64_t stream)
+{
+	const uint32_t key[2] = {seed, seed >> 32};
+	unsigned int i;
+
+	GP_ASSERT(size%4 == 0);
+
+	/*
+	 * Basic form of the Box-Muller transformation, unlike the polar form
+	 * it does not reject samples so that each counter gives exactly four
+	 * numbers and the loop has no data dependent branches.
+	 */
+	for (i = 0; i < size; i += 4) {
+		uint32_t r[4] = {i / 4, 0, stream, stream >> 32};
+
+		gp_rand_philox(r, key);
+
+		float m0 = sigma * sqrtf(-2.0f * logf(U24_OPEN0(r[0])));
+		float m1 = sigma * sqrtf(-2.0f * logf(U24_OPEN0(r[2])));
+		float a0 = 2 * (float)M_PI * U24_OPEN1(r[1]);
+		float a1 = 2 * (float)M_PI * U24_OPEN1(r[3]);
+
+		arr[i+0] = mu + m0 * cosf(a0);
+		arr[i+1] = mu + m0 * sinf(a0);
+		arr[i+2] = mu + m1 * cosf(a1);
+		arr[i+3] = mu + m1 * sinf(a1);
+	}
+}
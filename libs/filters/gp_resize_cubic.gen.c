@@ -0,0 +1,2736 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_resize_cubic.gen.c
+ *
+ * GENERATED on 2026 10 19 16:36:01 from gp_resize_cubic.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Cubic resampling
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <math.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_gamma_correction.h>
+#include <core/gp_clamp.h>
+#include <core/gp_debug.h>
+#include <filters/gp_resize.h>
+#include "gp_cubic.h"
+
+#define MUL_I(a, b) ({ \
+	a[0] *= b[0]; \
+	a[1] *= b[1]; \
+	a[2] *= b[2]; \
+	a[3] *= b[3]; \
+})
+
+#define SUM_I(a) \
+	((a)[0] + (a)[1] + (a)[2] + (a)[3])
+
+static int resize_cubic_RGB101010(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB101010_B(src);
+	uint16_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_R(dst);
+	uint16_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_G(dst);
+	uint16_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB101010_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB101010_B(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_32BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_32BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_32BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_32BPP(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGB101010_LIN(pix[0], R_gamma_lin);
+			Rv[1] = GP_PIXEL_GET_R_RGB101010_LIN(pix[1], R_gamma_lin);
+			Rv[2] = GP_PIXEL_GET_R_RGB101010_LIN(pix[2], R_gamma_lin);
+			Rv[3] = GP_PIXEL_GET_R_RGB101010_LIN(pix[3], R_gamma_lin);
+			Gv[0] = GP_PIXEL_GET_G_RGB101010_LIN(pix[0], G_gamma_lin);
+			Gv[1] = GP_PIXEL_GET_G_RGB101010_LIN(pix[1], G_gamma_lin);
+			Gv[2] = GP_PIXEL_GET_G_RGB101010_LIN(pix[2], G_gamma_lin);
+			Gv[3] = GP_PIXEL_GET_G_RGB101010_LIN(pix[3], G_gamma_lin);
+			Bv[0] = GP_PIXEL_GET_B_RGB101010_LIN(pix[0], B_gamma_lin);
+			Bv[1] = GP_PIXEL_GET_B_RGB101010_LIN(pix[1], B_gamma_lin);
+			Bv[2] = GP_PIXEL_GET_B_RGB101010_LIN(pix[2], B_gamma_lin);
+			Bv[3] = GP_PIXEL_GET_B_RGB101010_LIN(pix[3], B_gamma_lin);
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			G = (SUM_I(Gv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			B = (SUM_I(Bv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				R = GP_CLAMP(R, 0, (int32_t)R_lin_max);
+				G = GP_CLAMP(G, 0, (int32_t)G_lin_max);
+				B = GP_CLAMP(B, 0, (int32_t)B_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGB101010_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+			gp_putpixel_raw_32BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_xRGB8888(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_xRGB8888_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_xRGB8888_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_xRGB8888_B(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_32BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_32BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_32BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_32BPP(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_xRGB8888_LIN(pix[0], R_gamma_lin);
+			Rv[1] = GP_PIXEL_GET_R_xRGB8888_LIN(pix[1], R_gamma_lin);
+			Rv[2] = GP_PIXEL_GET_R_xRGB8888_LIN(pix[2], R_gamma_lin);
+			Rv[3] = GP_PIXEL_GET_R_xRGB8888_LIN(pix[3], R_gamma_lin);
+			Gv[0] = GP_PIXEL_GET_G_xRGB8888_LIN(pix[0], G_gamma_lin);
+			Gv[1] = GP_PIXEL_GET_G_xRGB8888_LIN(pix[1], G_gamma_lin);
+			Gv[2] = GP_PIXEL_GET_G_xRGB8888_LIN(pix[2], G_gamma_lin);
+			Gv[3] = GP_PIXEL_GET_G_xRGB8888_LIN(pix[3], G_gamma_lin);
+			Bv[0] = GP_PIXEL_GET_B_xRGB8888_LIN(pix[0], B_gamma_lin);
+			Bv[1] = GP_PIXEL_GET_B_xRGB8888_LIN(pix[1], B_gamma_lin);
+			Bv[2] = GP_PIXEL_GET_B_xRGB8888_LIN(pix[2], B_gamma_lin);
+			Bv[3] = GP_PIXEL_GET_B_xRGB8888_LIN(pix[3], B_gamma_lin);
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			G = (SUM_I(Gv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			B = (SUM_I(Bv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				R = GP_CLAMP(R, 0, (int32_t)R_lin_max);
+				G = GP_CLAMP(G, 0, (int32_t)G_lin_max);
+				B = GP_CLAMP(B, 0, (int32_t)B_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_xRGB8888_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+			gp_putpixel_raw_32BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGBA8888(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+	int32_t col_A[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_B(src);
+	uint8_t *A_gamma_lin = GP_CHAN_TO_LIN_TBL_RGBA8888_A(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_B(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_RGBA8888_A(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_B(src);
+	gp_pixel A_lin_max = GP_CHAN_LIN_MAX_VAL_RGBA8888_A(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			int32_t Av[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_32BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_32BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_32BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_32BPP(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGBA8888_LIN(pix[0], R_gamma_lin);
+			Rv[1] = GP_PIXEL_GET_R_RGBA8888_LIN(pix[1], R_gamma_lin);
+			Rv[2] = GP_PIXEL_GET_R_RGBA8888_LIN(pix[2], R_gamma_lin);
+			Rv[3] = GP_PIXEL_GET_R_RGBA8888_LIN(pix[3], R_gamma_lin);
+			Gv[0] = GP_PIXEL_GET_G_RGBA8888_LIN(pix[0], G_gamma_lin);
+			Gv[1] = GP_PIXEL_GET_G_RGBA8888_LIN(pix[1], G_gamma_lin);
+			Gv[2] = GP_PIXEL_GET_G_RGBA8888_LIN(pix[2], G_gamma_lin);
+			Gv[3] = GP_PIXEL_GET_G_RGBA8888_LIN(pix[3], G_gamma_lin);
+			Bv[0] = GP_PIXEL_GET_B_RGBA8888_LIN(pix[0], B_gamma_lin);
+			Bv[1] = GP_PIXEL_GET_B_RGBA8888_LIN(pix[1], B_gamma_lin);
+			Bv[2] = GP_PIXEL_GET_B_RGBA8888_LIN(pix[2], B_gamma_lin);
+			Bv[3] = GP_PIXEL_GET_B_RGBA8888_LIN(pix[3], B_gamma_lin);
+			Av[0] = GP_PIXEL_GET_A_RGBA8888_LIN(pix[0], A_gamma_lin);
+			Av[1] = GP_PIXEL_GET_A_RGBA8888_LIN(pix[1], A_gamma_lin);
+			Av[2] = GP_PIXEL_GET_A_RGBA8888_LIN(pix[2], A_gamma_lin);
+			Av[3] = GP_PIXEL_GET_A_RGBA8888_LIN(pix[3], A_gamma_lin);
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+			MUL_I(Av, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+			col_A[j] = SUM_I(Av);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+			int32_t Av[4];
+			int32_t A;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+			Av[0] = col_A[xmap[j][0]];
+			Av[1] = col_A[xmap[j][1]];
+			Av[2] = col_A[xmap[j][2]];
+			Av[3] = col_A[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+			MUL_I(Av, xmap_c[j]);
+
+			R = (SUM_I(Rv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			G = (SUM_I(Gv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			B = (SUM_I(Bv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			A = (SUM_I(Av) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				R = GP_CLAMP(R, 0, (int32_t)R_lin_max);
+				G = GP_CLAMP(G, 0, (int32_t)G_lin_max);
+				B = GP_CLAMP(B, 0, (int32_t)B_lin_max);
+				A = GP_CLAMP(A, 0, (int32_t)A_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGBA8888_ENC(R, G, B, A, R_gamma_enc, G_gamma_enc, B_gamma_enc, A_gamma_enc);
+			gp_putpixel_raw_32BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGB888(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_R(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_G(src);
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB888_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB888_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB888_B(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_24BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_24BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_24BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_24BPP(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGB888_LIN(pix[0], R_gamma_lin);
+			Rv[1] = GP_PIXEL_GET_R_RGB888_LIN(pix[1], R_gamma_lin);
+			Rv[2] = GP_PIXEL_GET_R_RGB888_LIN(pix[2], R_gamma_lin);
+			Rv[3] = GP_PIXEL_GET_R_RGB888_LIN(pix[3], R_gamma_lin);
+			Gv[0] = GP_PIXEL_GET_G_RGB888_LIN(pix[0], G_gamma_lin);
+			Gv[1] = GP_PIXEL_GET_G_RGB888_LIN(pix[1], G_gamma_lin);
+			Gv[2] = GP_PIXEL_GET_G_RGB888_LIN(pix[2], G_gamma_lin);
+			Gv[3] = GP_PIXEL_GET_G_RGB888_LIN(pix[3], G_gamma_lin);
+			Bv[0] = GP_PIXEL_GET_B_RGB888_LIN(pix[0], B_gamma_lin);
+			Bv[1] = GP_PIXEL_GET_B_RGB888_LIN(pix[1], B_gamma_lin);
+			Bv[2] = GP_PIXEL_GET_B_RGB888_LIN(pix[2], B_gamma_lin);
+			Bv[3] = GP_PIXEL_GET_B_RGB888_LIN(pix[3], B_gamma_lin);
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			G = (SUM_I(Gv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			B = (SUM_I(Bv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				R = GP_CLAMP(R, 0, (int32_t)R_lin_max);
+				G = GP_CLAMP(G, 0, (int32_t)G_lin_max);
+				B = GP_CLAMP(B, 0, (int32_t)B_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGB888_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+			gp_putpixel_raw_24BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_BGR888(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_B[src->w];
+	int32_t col_G[src->w];
+	int32_t col_R[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint16_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_B(src);
+	uint16_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_G(src);
+	uint16_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_BGR888_R(src);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_B(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_G(dst);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_BGR888_R(dst);
+
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_B(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_G(src);
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_BGR888_R(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Bv[4];
+			int32_t Gv[4];
+			int32_t Rv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_24BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_24BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_24BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_24BPP(src, j, yi[3]);
+
+			Bv[0] = GP_PIXEL_GET_B_BGR888_LIN(pix[0], B_gamma_lin);
+			Bv[1] = GP_PIXEL_GET_B_BGR888_LIN(pix[1], B_gamma_lin);
+			Bv[2] = GP_PIXEL_GET_B_BGR888_LIN(pix[2], B_gamma_lin);
+			Bv[3] = GP_PIXEL_GET_B_BGR888_LIN(pix[3], B_gamma_lin);
+			Gv[0] = GP_PIXEL_GET_G_BGR888_LIN(pix[0], G_gamma_lin);
+			Gv[1] = GP_PIXEL_GET_G_BGR888_LIN(pix[1], G_gamma_lin);
+			Gv[2] = GP_PIXEL_GET_G_BGR888_LIN(pix[2], G_gamma_lin);
+			Gv[3] = GP_PIXEL_GET_G_BGR888_LIN(pix[3], G_gamma_lin);
+			Rv[0] = GP_PIXEL_GET_R_BGR888_LIN(pix[0], R_gamma_lin);
+			Rv[1] = GP_PIXEL_GET_R_BGR888_LIN(pix[1], R_gamma_lin);
+			Rv[2] = GP_PIXEL_GET_R_BGR888_LIN(pix[2], R_gamma_lin);
+			Rv[3] = GP_PIXEL_GET_R_BGR888_LIN(pix[3], R_gamma_lin);
+
+			MUL_I(Bv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Rv, cvy);
+
+			col_B[j] = SUM_I(Bv);
+			col_G[j] = SUM_I(Gv);
+			col_R[j] = SUM_I(Rv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Bv[4];
+			int32_t B;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Rv[4];
+			int32_t R;
+
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+
+			MUL_I(Bv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Rv, xmap_c[j]);
+
+			B = (SUM_I(Bv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			G = (SUM_I(Gv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			R = (SUM_I(Rv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				B = GP_CLAMP(B, 0, (int32_t)B_lin_max);
+				G = GP_CLAMP(G, 0, (int32_t)G_lin_max);
+				R = GP_CLAMP(R, 0, (int32_t)R_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_BGR888_ENC(B, G, R, B_gamma_enc, G_gamma_enc, R_gamma_enc);
+			gp_putpixel_raw_24BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGB555(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB555_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB555_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB555_B(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_16BPP_BE(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_16BPP_BE(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_16BPP_BE(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_16BPP_BE(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGB555_LIN(pix[0], R_gamma_lin);
+			Rv[1] = GP_PIXEL_GET_R_RGB555_LIN(pix[1], R_gamma_lin);
+			Rv[2] = GP_PIXEL_GET_R_RGB555_LIN(pix[2], R_gamma_lin);
+			Rv[3] = GP_PIXEL_GET_R_RGB555_LIN(pix[3], R_gamma_lin);
+			Gv[0] = GP_PIXEL_GET_G_RGB555_LIN(pix[0], G_gamma_lin);
+			Gv[1] = GP_PIXEL_GET_G_RGB555_LIN(pix[1], G_gamma_lin);
+			Gv[2] = GP_PIXEL_GET_G_RGB555_LIN(pix[2], G_gamma_lin);
+			Gv[3] = GP_PIXEL_GET_G_RGB555_LIN(pix[3], G_gamma_lin);
+			Bv[0] = GP_PIXEL_GET_B_RGB555_LIN(pix[0], B_gamma_lin);
+			Bv[1] = GP_PIXEL_GET_B_RGB555_LIN(pix[1], B_gamma_lin);
+			Bv[2] = GP_PIXEL_GET_B_RGB555_LIN(pix[2], B_gamma_lin);
+			Bv[3] = GP_PIXEL_GET_B_RGB555_LIN(pix[3], B_gamma_lin);
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			G = (SUM_I(Gv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			B = (SUM_I(Bv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				R = GP_CLAMP(R, 0, (int32_t)R_lin_max);
+				G = GP_CLAMP(G, 0, (int32_t)G_lin_max);
+				B = GP_CLAMP(B, 0, (int32_t)B_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGB555_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+			gp_putpixel_raw_16BPP_BE(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGB565_BE(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_BE_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_BE_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_BE_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_BE_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_BE_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_BE_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_BE_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_BE_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_BE_B(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_16BPP_BE(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_16BPP_BE(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_16BPP_BE(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_16BPP_BE(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGB565_BE_LIN(pix[0], R_gamma_lin);
+			Rv[1] = GP_PIXEL_GET_R_RGB565_BE_LIN(pix[1], R_gamma_lin);
+			Rv[2] = GP_PIXEL_GET_R_RGB565_BE_LIN(pix[2], R_gamma_lin);
+			Rv[3] = GP_PIXEL_GET_R_RGB565_BE_LIN(pix[3], R_gamma_lin);
+			Gv[0] = GP_PIXEL_GET_G_RGB565_BE_LIN(pix[0], G_gamma_lin);
+			Gv[1] = GP_PIXEL_GET_G_RGB565_BE_LIN(pix[1], G_gamma_lin);
+			Gv[2] = GP_PIXEL_GET_G_RGB565_BE_LIN(pix[2], G_gamma_lin);
+			Gv[3] = GP_PIXEL_GET_G_RGB565_BE_LIN(pix[3], G_gamma_lin);
+			Bv[0] = GP_PIXEL_GET_B_RGB565_BE_LIN(pix[0], B_gamma_lin);
+			Bv[1] = GP_PIXEL_GET_B_RGB565_BE_LIN(pix[1], B_gamma_lin);
+			Bv[2] = GP_PIXEL_GET_B_RGB565_BE_LIN(pix[2], B_gamma_lin);
+			Bv[3] = GP_PIXEL_GET_B_RGB565_BE_LIN(pix[3], B_gamma_lin);
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			G = (SUM_I(Gv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			B = (SUM_I(Bv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				R = GP_CLAMP(R, 0, (int32_t)R_lin_max);
+				G = GP_CLAMP(G, 0, (int32_t)G_lin_max);
+				B = GP_CLAMP(B, 0, (int32_t)B_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGB565_BE_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+			gp_putpixel_raw_16BPP_BE(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGB565_LE(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_LE_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_LE_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB565_LE_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_LE_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_LE_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB565_LE_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_LE_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_LE_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB565_LE_B(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_16BPP_LE(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_16BPP_LE(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_16BPP_LE(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_16BPP_LE(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGB565_LE_LIN(pix[0], R_gamma_lin);
+			Rv[1] = GP_PIXEL_GET_R_RGB565_LE_LIN(pix[1], R_gamma_lin);
+			Rv[2] = GP_PIXEL_GET_R_RGB565_LE_LIN(pix[2], R_gamma_lin);
+			Rv[3] = GP_PIXEL_GET_R_RGB565_LE_LIN(pix[3], R_gamma_lin);
+			Gv[0] = GP_PIXEL_GET_G_RGB565_LE_LIN(pix[0], G_gamma_lin);
+			Gv[1] = GP_PIXEL_GET_G_RGB565_LE_LIN(pix[1], G_gamma_lin);
+			Gv[2] = GP_PIXEL_GET_G_RGB565_LE_LIN(pix[2], G_gamma_lin);
+			Gv[3] = GP_PIXEL_GET_G_RGB565_LE_LIN(pix[3], G_gamma_lin);
+			Bv[0] = GP_PIXEL_GET_B_RGB565_LE_LIN(pix[0], B_gamma_lin);
+			Bv[1] = GP_PIXEL_GET_B_RGB565_LE_LIN(pix[1], B_gamma_lin);
+			Bv[2] = GP_PIXEL_GET_B_RGB565_LE_LIN(pix[2], B_gamma_lin);
+			Bv[3] = GP_PIXEL_GET_B_RGB565_LE_LIN(pix[3], B_gamma_lin);
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			G = (SUM_I(Gv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			B = (SUM_I(Bv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				R = GP_CLAMP(R, 0, (int32_t)R_lin_max);
+				G = GP_CLAMP(G, 0, (int32_t)G_lin_max);
+				B = GP_CLAMP(B, 0, (int32_t)B_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGB565_LE_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+			gp_putpixel_raw_16BPP_LE(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGB666(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB666_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB666_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB666_B(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_18BPP_DB(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_18BPP_DB(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_18BPP_DB(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_18BPP_DB(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGB666_LIN(pix[0], R_gamma_lin);
+			Rv[1] = GP_PIXEL_GET_R_RGB666_LIN(pix[1], R_gamma_lin);
+			Rv[2] = GP_PIXEL_GET_R_RGB666_LIN(pix[2], R_gamma_lin);
+			Rv[3] = GP_PIXEL_GET_R_RGB666_LIN(pix[3], R_gamma_lin);
+			Gv[0] = GP_PIXEL_GET_G_RGB666_LIN(pix[0], G_gamma_lin);
+			Gv[1] = GP_PIXEL_GET_G_RGB666_LIN(pix[1], G_gamma_lin);
+			Gv[2] = GP_PIXEL_GET_G_RGB666_LIN(pix[2], G_gamma_lin);
+			Gv[3] = GP_PIXEL_GET_G_RGB666_LIN(pix[3], G_gamma_lin);
+			Bv[0] = GP_PIXEL_GET_B_RGB666_LIN(pix[0], B_gamma_lin);
+			Bv[1] = GP_PIXEL_GET_B_RGB666_LIN(pix[1], B_gamma_lin);
+			Bv[2] = GP_PIXEL_GET_B_RGB666_LIN(pix[2], B_gamma_lin);
+			Bv[3] = GP_PIXEL_GET_B_RGB666_LIN(pix[3], B_gamma_lin);
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			G = (SUM_I(Gv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			B = (SUM_I(Bv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				R = GP_CLAMP(R, 0, (int32_t)R_lin_max);
+				G = GP_CLAMP(G, 0, (int32_t)G_lin_max);
+				B = GP_CLAMP(B, 0, (int32_t)B_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGB666_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+			gp_putpixel_raw_18BPP_DB(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGB332(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint8_t *R_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_R(src);
+	uint8_t *G_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_G(src);
+	uint8_t *B_gamma_lin = GP_CHAN_TO_LIN_TBL_RGB332_B(src);
+	uint8_t *R_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_R(dst);
+	uint8_t *G_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_G(dst);
+	uint8_t *B_gamma_enc = GP_CHAN_TO_ENC_TBL_RGB332_B(dst);
+
+	gp_pixel R_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_R(src);
+	gp_pixel G_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_G(src);
+	gp_pixel B_lin_max = GP_CHAN_LIN_MAX_VAL_RGB332_B(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_8BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_8BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_8BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_8BPP(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGB332_LIN(pix[0], R_gamma_lin);
+			Rv[1] = GP_PIXEL_GET_R_RGB332_LIN(pix[1], R_gamma_lin);
+			Rv[2] = GP_PIXEL_GET_R_RGB332_LIN(pix[2], R_gamma_lin);
+			Rv[3] = GP_PIXEL_GET_R_RGB332_LIN(pix[3], R_gamma_lin);
+			Gv[0] = GP_PIXEL_GET_G_RGB332_LIN(pix[0], G_gamma_lin);
+			Gv[1] = GP_PIXEL_GET_G_RGB332_LIN(pix[1], G_gamma_lin);
+			Gv[2] = GP_PIXEL_GET_G_RGB332_LIN(pix[2], G_gamma_lin);
+			Gv[3] = GP_PIXEL_GET_G_RGB332_LIN(pix[3], G_gamma_lin);
+			Bv[0] = GP_PIXEL_GET_B_RGB332_LIN(pix[0], B_gamma_lin);
+			Bv[1] = GP_PIXEL_GET_B_RGB332_LIN(pix[1], B_gamma_lin);
+			Bv[2] = GP_PIXEL_GET_B_RGB332_LIN(pix[2], B_gamma_lin);
+			Bv[3] = GP_PIXEL_GET_B_RGB332_LIN(pix[3], B_gamma_lin);
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			G = (SUM_I(Gv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			B = (SUM_I(Bv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				R = GP_CLAMP(R, 0, (int32_t)R_lin_max);
+				G = GP_CLAMP(G, 0, (int32_t)G_lin_max);
+				B = GP_CLAMP(B, 0, (int32_t)B_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGB332_ENC(R, G, B, R_gamma_enc, G_gamma_enc, B_gamma_enc);
+			gp_putpixel_raw_8BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_CMYK8888(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_K[src->w];
+	int32_t col_Y[src->w];
+	int32_t col_M[src->w];
+	int32_t col_C[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint8_t *K_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_K(src);
+	uint8_t *Y_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_Y(src);
+	uint8_t *M_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_M(src);
+	uint8_t *C_gamma_lin = GP_CHAN_TO_LIN_TBL_CMYK8888_C(src);
+	uint8_t *K_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_K(dst);
+	uint8_t *Y_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_Y(dst);
+	uint8_t *M_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_M(dst);
+	uint8_t *C_gamma_enc = GP_CHAN_TO_ENC_TBL_CMYK8888_C(dst);
+
+	gp_pixel K_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_K(src);
+	gp_pixel Y_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_Y(src);
+	gp_pixel M_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_M(src);
+	gp_pixel C_lin_max = GP_CHAN_LIN_MAX_VAL_CMYK8888_C(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Kv[4];
+			int32_t Yv[4];
+			int32_t Mv[4];
+			int32_t Cv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_32BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_32BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_32BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_32BPP(src, j, yi[3]);
+
+			Kv[0] = GP_PIXEL_GET_K_CMYK8888_LIN(pix[0], K_gamma_lin);
+			Kv[1] = GP_PIXEL_GET_K_CMYK8888_LIN(pix[1], K_gamma_lin);
+			Kv[2] = GP_PIXEL_GET_K_CMYK8888_LIN(pix[2], K_gamma_lin);
+			Kv[3] = GP_PIXEL_GET_K_CMYK8888_LIN(pix[3], K_gamma_lin);
+			Yv[0] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix[0], Y_gamma_lin);
+			Yv[1] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix[1], Y_gamma_lin);
+			Yv[2] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix[2], Y_gamma_lin);
+			Yv[3] = GP_PIXEL_GET_Y_CMYK8888_LIN(pix[3], Y_gamma_lin);
+			Mv[0] = GP_PIXEL_GET_M_CMYK8888_LIN(pix[0], M_gamma_lin);
+			Mv[1] = GP_PIXEL_GET_M_CMYK8888_LIN(pix[1], M_gamma_lin);
+			Mv[2] = GP_PIXEL_GET_M_CMYK8888_LIN(pix[2], M_gamma_lin);
+			Mv[3] = GP_PIXEL_GET_M_CMYK8888_LIN(pix[3], M_gamma_lin);
+			Cv[0] = GP_PIXEL_GET_C_CMYK8888_LIN(pix[0], C_gamma_lin);
+			Cv[1] = GP_PIXEL_GET_C_CMYK8888_LIN(pix[1], C_gamma_lin);
+			Cv[2] = GP_PIXEL_GET_C_CMYK8888_LIN(pix[2], C_gamma_lin);
+			Cv[3] = GP_PIXEL_GET_C_CMYK8888_LIN(pix[3], C_gamma_lin);
+
+			MUL_I(Kv, cvy);
+			MUL_I(Yv, cvy);
+			MUL_I(Mv, cvy);
+			MUL_I(Cv, cvy);
+
+			col_K[j] = SUM_I(Kv);
+			col_Y[j] = SUM_I(Yv);
+			col_M[j] = SUM_I(Mv);
+			col_C[j] = SUM_I(Cv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Kv[4];
+			int32_t K;
+			int32_t Yv[4];
+			int32_t Y;
+			int32_t Mv[4];
+			int32_t M;
+			int32_t Cv[4];
+			int32_t C;
+
+			Kv[0] = col_K[xmap[j][0]];
+			Kv[1] = col_K[xmap[j][1]];
+			Kv[2] = col_K[xmap[j][2]];
+			Kv[3] = col_K[xmap[j][3]];
+			Yv[0] = col_Y[xmap[j][0]];
+			Yv[1] = col_Y[xmap[j][1]];
+			Yv[2] = col_Y[xmap[j][2]];
+			Yv[3] = col_Y[xmap[j][3]];
+			Mv[0] = col_M[xmap[j][0]];
+			Mv[1] = col_M[xmap[j][1]];
+			Mv[2] = col_M[xmap[j][2]];
+			Mv[3] = col_M[xmap[j][3]];
+			Cv[0] = col_C[xmap[j][0]];
+			Cv[1] = col_C[xmap[j][1]];
+			Cv[2] = col_C[xmap[j][2]];
+			Cv[3] = col_C[xmap[j][3]];
+
+			MUL_I(Kv, xmap_c[j]);
+			MUL_I(Yv, xmap_c[j]);
+			MUL_I(Mv, xmap_c[j]);
+			MUL_I(Cv, xmap_c[j]);
+
+			K = (SUM_I(Kv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			Y = (SUM_I(Yv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			M = (SUM_I(Mv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			C = (SUM_I(Cv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				K = GP_CLAMP(K, 0, (int32_t)K_lin_max);
+				Y = GP_CLAMP(Y, 0, (int32_t)Y_lin_max);
+				M = GP_CLAMP(M, 0, (int32_t)M_lin_max);
+				C = GP_CLAMP(C, 0, (int32_t)C_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_CMYK8888_ENC(K, Y, M, C, K_gamma_enc, Y_gamma_enc, M_gamma_enc, C_gamma_enc);
+			gp_putpixel_raw_32BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G1_DB(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_DB_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G1_DB_V(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_1BPP_DB(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_1BPP_DB(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_1BPP_DB(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_1BPP_DB(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G1_DB_LIN(pix[0], V_gamma_lin);
+			Vv[1] = GP_PIXEL_GET_V_G1_DB_LIN(pix[1], V_gamma_lin);
+			Vv[2] = GP_PIXEL_GET_V_G1_DB_LIN(pix[2], V_gamma_lin);
+			Vv[3] = GP_PIXEL_GET_V_G1_DB_LIN(pix[3], V_gamma_lin);
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				V = GP_CLAMP(V, 0, (int32_t)V_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_G1_DB_ENC(V, V_gamma_enc);
+			gp_putpixel_raw_1BPP_DB(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G2_DB(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_DB_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G2_DB_V(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_2BPP_DB(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_2BPP_DB(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_2BPP_DB(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_2BPP_DB(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G2_DB_LIN(pix[0], V_gamma_lin);
+			Vv[1] = GP_PIXEL_GET_V_G2_DB_LIN(pix[1], V_gamma_lin);
+			Vv[2] = GP_PIXEL_GET_V_G2_DB_LIN(pix[2], V_gamma_lin);
+			Vv[3] = GP_PIXEL_GET_V_G2_DB_LIN(pix[3], V_gamma_lin);
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				V = GP_CLAMP(V, 0, (int32_t)V_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_G2_DB_ENC(V, V_gamma_enc);
+			gp_putpixel_raw_2BPP_DB(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G4_DB(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_DB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_DB_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G4_DB_V(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_4BPP_DB(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_4BPP_DB(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_4BPP_DB(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_4BPP_DB(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G4_DB_LIN(pix[0], V_gamma_lin);
+			Vv[1] = GP_PIXEL_GET_V_G4_DB_LIN(pix[1], V_gamma_lin);
+			Vv[2] = GP_PIXEL_GET_V_G4_DB_LIN(pix[2], V_gamma_lin);
+			Vv[3] = GP_PIXEL_GET_V_G4_DB_LIN(pix[3], V_gamma_lin);
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				V = GP_CLAMP(V, 0, (int32_t)V_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_G4_DB_ENC(V, V_gamma_enc);
+			gp_putpixel_raw_4BPP_DB(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G1_UB(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G1_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G1_UB_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G1_UB_V(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_1BPP_UB(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_1BPP_UB(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_1BPP_UB(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_1BPP_UB(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G1_UB_LIN(pix[0], V_gamma_lin);
+			Vv[1] = GP_PIXEL_GET_V_G1_UB_LIN(pix[1], V_gamma_lin);
+			Vv[2] = GP_PIXEL_GET_V_G1_UB_LIN(pix[2], V_gamma_lin);
+			Vv[3] = GP_PIXEL_GET_V_G1_UB_LIN(pix[3], V_gamma_lin);
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				V = GP_CLAMP(V, 0, (int32_t)V_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_G1_UB_ENC(V, V_gamma_enc);
+			gp_putpixel_raw_1BPP_UB(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G2_UB(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G2_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G2_UB_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G2_UB_V(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_2BPP_UB(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_2BPP_UB(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_2BPP_UB(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_2BPP_UB(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G2_UB_LIN(pix[0], V_gamma_lin);
+			Vv[1] = GP_PIXEL_GET_V_G2_UB_LIN(pix[1], V_gamma_lin);
+			Vv[2] = GP_PIXEL_GET_V_G2_UB_LIN(pix[2], V_gamma_lin);
+			Vv[3] = GP_PIXEL_GET_V_G2_UB_LIN(pix[3], V_gamma_lin);
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				V = GP_CLAMP(V, 0, (int32_t)V_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_G2_UB_ENC(V, V_gamma_enc);
+			gp_putpixel_raw_2BPP_UB(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G4_UB(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint8_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G4_UB_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G4_UB_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G4_UB_V(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_4BPP_UB(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_4BPP_UB(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_4BPP_UB(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_4BPP_UB(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G4_UB_LIN(pix[0], V_gamma_lin);
+			Vv[1] = GP_PIXEL_GET_V_G4_UB_LIN(pix[1], V_gamma_lin);
+			Vv[2] = GP_PIXEL_GET_V_G4_UB_LIN(pix[2], V_gamma_lin);
+			Vv[3] = GP_PIXEL_GET_V_G4_UB_LIN(pix[3], V_gamma_lin);
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				V = GP_CLAMP(V, 0, (int32_t)V_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_G4_UB_ENC(V, V_gamma_enc);
+			gp_putpixel_raw_4BPP_UB(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G8(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G8_V(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G8_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G8_V(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_8BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_8BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_8BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_8BPP(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G8_LIN(pix[0], V_gamma_lin);
+			Vv[1] = GP_PIXEL_GET_V_G8_LIN(pix[1], V_gamma_lin);
+			Vv[2] = GP_PIXEL_GET_V_G8_LIN(pix[2], V_gamma_lin);
+			Vv[3] = GP_PIXEL_GET_V_G8_LIN(pix[3], V_gamma_lin);
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				V = GP_CLAMP(V, 0, (int32_t)V_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_G8_ENC(V, V_gamma_enc);
+			gp_putpixel_raw_8BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_GA88(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+	int32_t col_A[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_V(src);
+	uint8_t *A_gamma_lin = GP_CHAN_TO_LIN_TBL_GA88_A(src);
+	uint8_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_V(dst);
+	uint8_t *A_gamma_enc = GP_CHAN_TO_ENC_TBL_GA88_A(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_GA88_V(src);
+	gp_pixel A_lin_max = GP_CHAN_LIN_MAX_VAL_GA88_A(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			int32_t Av[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_16BPP_LE(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_16BPP_LE(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_16BPP_LE(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_16BPP_LE(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_GA88_LIN(pix[0], V_gamma_lin);
+			Vv[1] = GP_PIXEL_GET_V_GA88_LIN(pix[1], V_gamma_lin);
+			Vv[2] = GP_PIXEL_GET_V_GA88_LIN(pix[2], V_gamma_lin);
+			Vv[3] = GP_PIXEL_GET_V_GA88_LIN(pix[3], V_gamma_lin);
+			Av[0] = GP_PIXEL_GET_A_GA88_LIN(pix[0], A_gamma_lin);
+			Av[1] = GP_PIXEL_GET_A_GA88_LIN(pix[1], A_gamma_lin);
+			Av[2] = GP_PIXEL_GET_A_GA88_LIN(pix[2], A_gamma_lin);
+			Av[3] = GP_PIXEL_GET_A_GA88_LIN(pix[3], A_gamma_lin);
+
+			MUL_I(Vv, cvy);
+			MUL_I(Av, cvy);
+
+			col_V[j] = SUM_I(Vv);
+			col_A[j] = SUM_I(Av);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+			int32_t Av[4];
+			int32_t A;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+			Av[0] = col_A[xmap[j][0]];
+			Av[1] = col_A[xmap[j][1]];
+			Av[2] = col_A[xmap[j][2]];
+			Av[3] = col_A[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+			MUL_I(Av, xmap_c[j]);
+
+			V = (SUM_I(Vv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+			A = (SUM_I(Av) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				V = GP_CLAMP(V, 0, (int32_t)V_lin_max);
+				A = GP_CLAMP(A, 0, (int32_t)A_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_GA88_ENC(V, A, V_gamma_enc, A_gamma_enc);
+			gp_putpixel_raw_16BPP_LE(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G16(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	uint16_t *V_gamma_lin = GP_CHAN_TO_LIN_TBL_G16_V(src);
+	uint16_t *V_gamma_enc = GP_CHAN_TO_ENC_TBL_G16_V(dst);
+
+	gp_pixel V_lin_max = GP_CHAN_LIN_MAX_VAL_G16_V(src);
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / GP_MAX(dst->w - 1, 1u)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * GP_CUBIC_MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * GP_CUBIC_MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / GP_MAX(dst->h - 1, 1u)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * GP_CUBIC_MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * GP_CUBIC_MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_16BPP_LE(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_16BPP_LE(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_16BPP_LE(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_16BPP_LE(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G16_LIN(pix[0], V_gamma_lin);
+			Vv[1] = GP_PIXEL_GET_V_G16_LIN(pix[1], V_gamma_lin);
+			Vv[2] = GP_PIXEL_GET_V_G16_LIN(pix[2], V_gamma_lin);
+			Vv[3] = GP_PIXEL_GET_V_G16_LIN(pix[3], V_gamma_lin);
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + GP_CUBIC_MUL * GP_CUBIC_MUL / 2) / (GP_CUBIC_MUL * GP_CUBIC_MUL);
+
+				V = GP_CLAMP(V, 0, (int32_t)V_lin_max);
+
+			gp_pixel pix = GP_PIXEL_CREATE_G16_ENC(V, V_gamma_enc);
+			gp_putpixel_raw_16BPP_LE(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic(const gp_pixmap *src, gp_pixmap *dst,
+                        gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return resize_cubic_RGB101010(src, dst, callback);
+	break;
+	case GP_PIXEL_xRGB8888:
+		return resize_cubic_xRGB8888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return resize_cubic_RGBA8888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return resize_cubic_RGB888(src, dst, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return resize_cubic_BGR888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return resize_cubic_RGB555(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB565_BE:
+		return resize_cubic_RGB565_BE(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB565_LE:
+		return resize_cubic_RGB565_LE(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return resize_cubic_RGB666(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return resize_cubic_RGB332(src, dst, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return resize_cubic_CMYK8888(src, dst, callback);
+	break;
+	case GP_PIXEL_G1_DB:
+		return resize_cubic_G1_DB(src, dst, callback);
+	break;
+	case GP_PIXEL_G2_DB:
+		return resize_cubic_G2_DB(src, dst, callback);
+	break;
+	case GP_PIXEL_G4_DB:
+		return resize_cubic_G4_DB(src, dst, callback);
+	break;
+	case GP_PIXEL_G1_UB:
+		return resize_cubic_G1_UB(src, dst, callback);
+	break;
+	case GP_PIXEL_G2_UB:
+		return resize_cubic_G2_UB(src, dst, callback);
+	break;
+	case GP_PIXEL_G4_UB:
+		return resize_cubic_G4_UB(src, dst, callback);
+	break;
+	case GP_PIXEL_G8:
+		return resize_cubic_G8(src, dst, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return resize_cubic_GA88(src, dst, callback);
+	break;
+	case GP_PIXEL_G16:
+		return resize_cubic_G16(src, dst, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+int gp_filter_resize_cubic_int(const gp_pixmap *src, gp_pixmap *dst,
+                               gp_progress_cb *callback)
+{
+	if (src->pixel_type != dst->pixel_type) {
+		GP_WARN("The src and dst pixel types must match");
+		errno = EINVAL;
+		return 1;
+	}
+
+	return resize_cubic(src, dst, callback);
+}
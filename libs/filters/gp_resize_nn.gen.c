@@ -0,0 +1,961 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_resize_nn.gen.c
+ *
+ * GENERATED on 2026 10 19 16:36:01 from gp_resize_nn.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Nearest Neighbour resampling
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_debug.h>
+#include <filters/gp_resize_nn.h>
+
+static int resize_nn_RGB101010(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_32BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_xRGB8888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_32BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_RGBA8888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_32BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_RGB888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_24BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_BGR888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_24BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_RGB555(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_RGB565_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_16BPP_BE(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_RGB565_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_RGB666(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_18BPP_DB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_RGB332(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_8BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_CMYK8888(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_32BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_P2(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_P4(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_P8(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_8BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_G1_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_1BPP_DB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_G2_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_2BPP_DB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_G4_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_4BPP_DB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_G1_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_1BPP_UB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_G2_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_2BPP_UB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_G4_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_4BPP_UB(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_G8(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_8BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_GA88(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn_G16(const gp_pixmap *src, gp_pixmap *dst,
+                                   gp_progress_cb *callback)
+{
+	uint32_t xmap[dst->w];
+	uint32_t ymap[dst->h];
+	uint32_t i;
+	gp_coord x, y;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* Pre-compute mapping for interpolation */
+	for (i = 0; i < dst->w; i++)
+		xmap[i] = ((i<<8) + (1<<7)) * src->w / (dst->w<<8);
+
+	for (i = 0; i < dst->h; i++)
+		ymap[i] = ((i<<8) + (1<<7)) * src->h / (dst->h<<8);
+
+	/* Interpolate */
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xmap[x], ymap[y]);
+
+			gp_putpixel_raw_16BPP_LE(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y, dst->h, dst->w)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_nn(const gp_pixmap *src, gp_pixmap *dst,
+                     gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return resize_nn_RGB101010(src, dst, callback);
+	break;
+	case GP_PIXEL_xRGB8888:
+		return resize_nn_xRGB8888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return resize_nn_RGBA8888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return resize_nn_RGB888(src, dst, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return resize_nn_BGR888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return resize_nn_RGB555(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB565_BE:
+		return resize_nn_RGB565_BE(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB565_LE:
+		return resize_nn_RGB565_LE(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return resize_nn_RGB666(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return resize_nn_RGB332(src, dst, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return resize_nn_CMYK8888(src, dst, callback);
+	break;
+	case GP_PIXEL_P2:
+		return resize_nn_P2(src, dst, callback);
+	break;
+	case GP_PIXEL_P4:
+		return resize_nn_P4(src, dst, callback);
+	break;
+	case GP_PIXEL_P8:
+		return resize_nn_P8(src, dst, callback);
+	break;
+	case GP_PIXEL_G1_DB:
+		return resize_nn_G1_DB(src, dst, callback);
+	break;
+	case GP_PIXEL_G2_DB:
+		return resize_nn_G2_DB(src, dst, callback);
+	break;
+	case GP_PIXEL_G4_DB:
+		return resize_nn_G4_DB(src, dst, callback);
+	break;
+	case GP_PIXEL_G1_UB:
+		return resize_nn_G1_UB(src, dst, callback);
+	break;
+	case GP_PIXEL_G2_UB:
+		return resize_nn_G2_UB(src, dst, callback);
+	break;
+	case GP_PIXEL_G4_UB:
+		return resize_nn_G4_UB(src, dst, callback);
+	break;
+	case GP_PIXEL_G8:
+		return resize_nn_G8(src, dst, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return resize_nn_GA88(src, dst, callback);
+	break;
+	case GP_PIXEL_G16:
+		return resize_nn_G16(src, dst, callback);
+	break;
+	default:
+		return -1;
+	}
+}
+
+int gp_filter_resize_nn(const gp_pixmap *src, gp_pixmap *dst,
+                        gp_progress_cb *callback)
+{
+	if (src->pixel_type != dst->pixel_type) {
+		GP_WARN("The src and dst pixel types must match");
+		errno = EINVAL;
+		return 1;
+	}
+
+	return resize_nn(src, dst, callback);
+}
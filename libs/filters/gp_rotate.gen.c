@@ -0,0 +1,961 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_rotate.gen.c
+ *
+ * GENERATED on 2026 10 19 16:36:04 from gp_rotate.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Vertical Mirror alogorithm
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_debug.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixel_pack.gen.h>
+
+#include <filters/gp_rotate.h>
+
+static int rotate_90_1BPP_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_1BPP_DB(dst, yr, x, gp_getpixel_raw_1BPP_DB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_1BPP_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_1BPP_UB(dst, yr, x, gp_getpixel_raw_1BPP_UB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_2BPP_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_2BPP_DB(dst, yr, x, gp_getpixel_raw_2BPP_DB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_2BPP_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_2BPP_UB(dst, yr, x, gp_getpixel_raw_2BPP_UB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_4BPP_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_4BPP_DB(dst, yr, x, gp_getpixel_raw_4BPP_DB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_4BPP_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_4BPP_UB(dst, yr, x, gp_getpixel_raw_4BPP_UB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_8BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_8BPP(dst, yr, x, gp_getpixel_raw_8BPP(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_16BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_16BPP_LE(dst, yr, x, gp_getpixel_raw_16BPP_LE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_16BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_16BPP_BE(dst, yr, x, gp_getpixel_raw_16BPP_BE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_24BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_24BPP(dst, yr, x, gp_getpixel_raw_24BPP(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_32BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_32BPP(dst, yr, x, gp_getpixel_raw_32BPP(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_18BPP_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_18BPP_DB(dst, yr, x, gp_getpixel_raw_18BPP_DB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90(const gp_pixmap *src, gp_pixmap *dst,
+                     gp_progress_cb *callback)
+{
+	GP_FN_RET_PER_PACK_PIXMAP(rotate_90, src, src, dst, callback);
+	return 1;
+}
+
+int gp_filter_rotate_90(const gp_pixmap *src, gp_pixmap *dst,
+                        gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w <= dst->h && src->h <= dst->w,
+	          "Destination is not large enough");
+
+	if (rotate_90(src, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_filter_rotate_90_alloc(const gp_pixmap *src,
+                                     gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	res = gp_pixmap_alloc(src->h, src->w, src->pixel_type);
+
+	if (res == NULL)
+		return NULL;
+
+	if (rotate_90(src, res, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		gp_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
+
+static int rotate_180_1BPP_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_1BPP_DB(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_1BPP_DB(src, xr, yr);
+			gp_putpixel_raw_1BPP_DB(dst, x, y, pix1);
+			gp_putpixel_raw_1BPP_DB(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_1BPP_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_1BPP_UB(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_1BPP_UB(src, xr, yr);
+			gp_putpixel_raw_1BPP_UB(dst, x, y, pix1);
+			gp_putpixel_raw_1BPP_UB(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_2BPP_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_2BPP_DB(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_2BPP_DB(src, xr, yr);
+			gp_putpixel_raw_2BPP_DB(dst, x, y, pix1);
+			gp_putpixel_raw_2BPP_DB(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_2BPP_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_2BPP_UB(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_2BPP_UB(src, xr, yr);
+			gp_putpixel_raw_2BPP_UB(dst, x, y, pix1);
+			gp_putpixel_raw_2BPP_UB(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_4BPP_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_4BPP_DB(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_4BPP_DB(src, xr, yr);
+			gp_putpixel_raw_4BPP_DB(dst, x, y, pix1);
+			gp_putpixel_raw_4BPP_DB(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_4BPP_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_4BPP_UB(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_4BPP_UB(src, xr, yr);
+			gp_putpixel_raw_4BPP_UB(dst, x, y, pix1);
+			gp_putpixel_raw_4BPP_UB(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_8BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_8BPP(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_8BPP(src, xr, yr);
+			gp_putpixel_raw_8BPP(dst, x, y, pix1);
+			gp_putpixel_raw_8BPP(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_16BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_16BPP_LE(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_16BPP_LE(src, xr, yr);
+			gp_putpixel_raw_16BPP_LE(dst, x, y, pix1);
+			gp_putpixel_raw_16BPP_LE(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_16BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_16BPP_BE(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_16BPP_BE(src, xr, yr);
+			gp_putpixel_raw_16BPP_BE(dst, x, y, pix1);
+			gp_putpixel_raw_16BPP_BE(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_24BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_24BPP(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_24BPP(src, xr, yr);
+			gp_putpixel_raw_24BPP(dst, x, y, pix1);
+			gp_putpixel_raw_24BPP(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_32BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_32BPP(src, xr, yr);
+			gp_putpixel_raw_32BPP(dst, x, y, pix1);
+			gp_putpixel_raw_32BPP(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_18BPP_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_18BPP_DB(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_18BPP_DB(src, xr, yr);
+			gp_putpixel_raw_18BPP_DB(dst, x, y, pix1);
+			gp_putpixel_raw_18BPP_DB(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180(const gp_pixmap *src, gp_pixmap *dst,
+                      gp_progress_cb *callback)
+{
+	GP_FN_RET_PER_PACK_PIXMAP(rotate_180, src, src, dst, callback);
+	return 1;
+}
+
+int gp_filter_rotate_180(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w <= dst->w && src->h <= dst->h,
+	          "Destination is not large enough");
+
+	if (rotate_180(src, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_filter_rotate_180_alloc(const gp_pixmap *src,
+                                      gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	res = gp_pixmap_copy(src, 0);
+
+	if (res == NULL)
+		return NULL;
+
+	if (rotate_180(src, res, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		gp_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
+
+static int rotate_270_1BPP_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_1BPP_DB(dst, y, xr, gp_getpixel_raw_1BPP_DB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_1BPP_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_1BPP_UB(dst, y, xr, gp_getpixel_raw_1BPP_UB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_2BPP_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_2BPP_DB(dst, y, xr, gp_getpixel_raw_2BPP_DB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_2BPP_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_2BPP_UB(dst, y, xr, gp_getpixel_raw_2BPP_UB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_4BPP_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_4BPP_DB(dst, y, xr, gp_getpixel_raw_4BPP_DB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_4BPP_UB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_4BPP_UB(dst, y, xr, gp_getpixel_raw_4BPP_UB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_8BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_8BPP(dst, y, xr, gp_getpixel_raw_8BPP(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_16BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_16BPP_LE(dst, y, xr, gp_getpixel_raw_16BPP_LE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_16BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_16BPP_BE(dst, y, xr, gp_getpixel_raw_16BPP_BE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_24BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_24BPP(dst, y, xr, gp_getpixel_raw_24BPP(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_32BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_32BPP(dst, y, xr, gp_getpixel_raw_32BPP(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_18BPP_DB(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_18BPP_DB(dst, y, xr, gp_getpixel_raw_18BPP_DB(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270(const gp_pixmap *src, gp_pixmap *dst,
+                      gp_progress_cb *callback)
+{
+	GP_FN_RET_PER_PACK_PIXMAP(rotate_270, src, src, dst, callback);
+	return 1;
+}
+
+int gp_filter_rotate_270(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w <= dst->h && src->h <= dst->w,
+	          "Destination is not large enough");
+
+	if (rotate_270(src, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_filter_rotate_270_alloc(const gp_pixmap *src,
+                                      gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	res = gp_pixmap_alloc(src->h, src->w, src->pixel_type);
+
+	if (res == NULL)
+		return NULL;
+
+	if (rotate_270(src, res, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		gp_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
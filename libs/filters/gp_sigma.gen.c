@@ -0,0 +1,3254 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_sigma.gen.c
+ *
+ * GENERATED on 2026 10 19 19:42:18 from gp_sigma.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Sigma mean filter
+ *
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "../../config.h"
+
+#include <core/gp_common.h>
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_clamp.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+#include <filters/gp_sigma.h>
+
+static int sigma_RGB101010(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int R_sigma = 1023 * sigma;
+	unsigned int G_sigma = 1023 * sigma;
+	unsigned int B_sigma = 1023 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB101010(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB101010(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB101010(pix);
+		}
+	}
+
+	unsigned int R_sum;
+	unsigned int R_ssum;
+	unsigned int R_cnt;
+	unsigned int G_sum;
+	unsigned int G_ssum;
+	unsigned int G_cnt;
+	unsigned int B_sum;
+	unsigned int B_ssum;
+	unsigned int B_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int R_center = R[yc * w + x + xrad];
+			int G_center = G[yc * w + x + xrad];
+			int B_center = B[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			R_sum = 0;
+			R_ssum = 0;
+			R_cnt = 0;
+			G_sum = 0;
+			G_ssum = 0;
+			G_cnt = 0;
+			B_sum = 0;
+			B_ssum = 0;
+			B_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int R_cur = R[y1 * w + x + x1];
+
+					R_sum += R_cur;
+
+					if (abs(R_cur - R_center) < R_sigma) {
+						R_ssum += R_cur;
+						R_cnt++;
+					}
+					int G_cur = G[y1 * w + x + x1];
+
+					G_sum += G_cur;
+
+					if (abs(G_cur - G_center) < G_sigma) {
+						G_ssum += G_cur;
+						G_cnt++;
+					}
+					int B_cur = B[y1 * w + x + x1];
+
+					B_sum += B_cur;
+
+					if (abs(B_cur - B_center) < B_sigma) {
+						B_ssum += B_cur;
+						B_cnt++;
+					}
+				}
+			}
+
+			R_sum -= R_center;
+
+			unsigned int res_R;
+
+			if (R_cnt >= min)
+				res_R = R_ssum / R_cnt;
+			else
+				res_R = R_sum / cnt;
+
+			G_sum -= G_center;
+
+			unsigned int res_G;
+
+			if (G_cnt >= min)
+				res_G = G_ssum / G_cnt;
+			else
+				res_G = G_sum / cnt;
+
+			B_sum -= B_center;
+
+			unsigned int res_B;
+
+			if (B_cnt >= min)
+				res_B = B_ssum / B_cnt;
+			else
+				res_B = B_sum / cnt;
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB101010(res_R, res_G, res_B));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[yl * w + x] = GP_PIXEL_GET_R_RGB101010(pix);
+			G[yl * w + x] = GP_PIXEL_GET_G_RGB101010(pix);
+			B[yl * w + x] = GP_PIXEL_GET_B_RGB101010(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_xRGB8888(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int R_sigma = 255 * sigma;
+	unsigned int G_sigma = 255 * sigma;
+	unsigned int B_sigma = 255 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_xRGB8888(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_xRGB8888(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_xRGB8888(pix);
+		}
+	}
+
+	unsigned int R_sum;
+	unsigned int R_ssum;
+	unsigned int R_cnt;
+	unsigned int G_sum;
+	unsigned int G_ssum;
+	unsigned int G_cnt;
+	unsigned int B_sum;
+	unsigned int B_ssum;
+	unsigned int B_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int R_center = R[yc * w + x + xrad];
+			int G_center = G[yc * w + x + xrad];
+			int B_center = B[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			R_sum = 0;
+			R_ssum = 0;
+			R_cnt = 0;
+			G_sum = 0;
+			G_ssum = 0;
+			G_cnt = 0;
+			B_sum = 0;
+			B_ssum = 0;
+			B_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int R_cur = R[y1 * w + x + x1];
+
+					R_sum += R_cur;
+
+					if (abs(R_cur - R_center) < R_sigma) {
+						R_ssum += R_cur;
+						R_cnt++;
+					}
+					int G_cur = G[y1 * w + x + x1];
+
+					G_sum += G_cur;
+
+					if (abs(G_cur - G_center) < G_sigma) {
+						G_ssum += G_cur;
+						G_cnt++;
+					}
+					int B_cur = B[y1 * w + x + x1];
+
+					B_sum += B_cur;
+
+					if (abs(B_cur - B_center) < B_sigma) {
+						B_ssum += B_cur;
+						B_cnt++;
+					}
+				}
+			}
+
+			R_sum -= R_center;
+
+			unsigned int res_R;
+
+			if (R_cnt >= min)
+				res_R = R_ssum / R_cnt;
+			else
+				res_R = R_sum / cnt;
+
+			G_sum -= G_center;
+
+			unsigned int res_G;
+
+			if (G_cnt >= min)
+				res_G = G_ssum / G_cnt;
+			else
+				res_G = G_sum / cnt;
+
+			B_sum -= B_center;
+
+			unsigned int res_B;
+
+			if (B_cnt >= min)
+				res_B = B_ssum / B_cnt;
+			else
+				res_B = B_sum / cnt;
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_xRGB8888(res_R, res_G, res_B));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[yl * w + x] = GP_PIXEL_GET_R_xRGB8888(pix);
+			G[yl * w + x] = GP_PIXEL_GET_G_xRGB8888(pix);
+			B[yl * w + x] = GP_PIXEL_GET_B_xRGB8888(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_RGBA8888(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int R_sigma = 255 * sigma;
+	unsigned int G_sigma = 255 * sigma;
+	unsigned int B_sigma = 255 * sigma;
+	unsigned int A_sigma = 255 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 4 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *A = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGBA8888(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGBA8888(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGBA8888(pix);
+			A[y * w + x] = GP_PIXEL_GET_A_RGBA8888(pix);
+		}
+	}
+
+	unsigned int R_sum;
+	unsigned int R_ssum;
+	unsigned int R_cnt;
+	unsigned int G_sum;
+	unsigned int G_ssum;
+	unsigned int G_cnt;
+	unsigned int B_sum;
+	unsigned int B_ssum;
+	unsigned int B_cnt;
+	unsigned int A_sum;
+	unsigned int A_ssum;
+	unsigned int A_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int R_center = R[yc * w + x + xrad];
+			int G_center = G[yc * w + x + xrad];
+			int B_center = B[yc * w + x + xrad];
+			int A_center = A[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			R_sum = 0;
+			R_ssum = 0;
+			R_cnt = 0;
+			G_sum = 0;
+			G_ssum = 0;
+			G_cnt = 0;
+			B_sum = 0;
+			B_ssum = 0;
+			B_cnt = 0;
+			A_sum = 0;
+			A_ssum = 0;
+			A_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int R_cur = R[y1 * w + x + x1];
+
+					R_sum += R_cur;
+
+					if (abs(R_cur - R_center) < R_sigma) {
+						R_ssum += R_cur;
+						R_cnt++;
+					}
+					int G_cur = G[y1 * w + x + x1];
+
+					G_sum += G_cur;
+
+					if (abs(G_cur - G_center) < G_sigma) {
+						G_ssum += G_cur;
+						G_cnt++;
+					}
+					int B_cur = B[y1 * w + x + x1];
+
+					B_sum += B_cur;
+
+					if (abs(B_cur - B_center) < B_sigma) {
+						B_ssum += B_cur;
+						B_cnt++;
+					}
+					int A_cur = A[y1 * w + x + x1];
+
+					A_sum += A_cur;
+
+					if (abs(A_cur - A_center) < A_sigma) {
+						A_ssum += A_cur;
+						A_cnt++;
+					}
+				}
+			}
+
+			R_sum -= R_center;
+
+			unsigned int res_R;
+
+			if (R_cnt >= min)
+				res_R = R_ssum / R_cnt;
+			else
+				res_R = R_sum / cnt;
+
+			G_sum -= G_center;
+
+			unsigned int res_G;
+
+			if (G_cnt >= min)
+				res_G = G_ssum / G_cnt;
+			else
+				res_G = G_sum / cnt;
+
+			B_sum -= B_center;
+
+			unsigned int res_B;
+
+			if (B_cnt >= min)
+				res_B = B_ssum / B_cnt;
+			else
+				res_B = B_sum / cnt;
+
+			A_sum -= A_center;
+
+			unsigned int res_A;
+
+			if (A_cnt >= min)
+				res_A = A_ssum / A_cnt;
+			else
+				res_A = A_sum / cnt;
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGBA8888(res_R, res_G, res_B, res_A));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[yl * w + x] = GP_PIXEL_GET_R_RGBA8888(pix);
+			G[yl * w + x] = GP_PIXEL_GET_G_RGBA8888(pix);
+			B[yl * w + x] = GP_PIXEL_GET_B_RGBA8888(pix);
+			A[yl * w + x] = GP_PIXEL_GET_A_RGBA8888(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_RGB888(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int R_sigma = 255 * sigma;
+	unsigned int G_sigma = 255 * sigma;
+	unsigned int B_sigma = 255 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB888(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB888(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB888(pix);
+		}
+	}
+
+	unsigned int R_sum;
+	unsigned int R_ssum;
+	unsigned int R_cnt;
+	unsigned int G_sum;
+	unsigned int G_ssum;
+	unsigned int G_cnt;
+	unsigned int B_sum;
+	unsigned int B_ssum;
+	unsigned int B_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int R_center = R[yc * w + x + xrad];
+			int G_center = G[yc * w + x + xrad];
+			int B_center = B[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			R_sum = 0;
+			R_ssum = 0;
+			R_cnt = 0;
+			G_sum = 0;
+			G_ssum = 0;
+			G_cnt = 0;
+			B_sum = 0;
+			B_ssum = 0;
+			B_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int R_cur = R[y1 * w + x + x1];
+
+					R_sum += R_cur;
+
+					if (abs(R_cur - R_center) < R_sigma) {
+						R_ssum += R_cur;
+						R_cnt++;
+					}
+					int G_cur = G[y1 * w + x + x1];
+
+					G_sum += G_cur;
+
+					if (abs(G_cur - G_center) < G_sigma) {
+						G_ssum += G_cur;
+						G_cnt++;
+					}
+					int B_cur = B[y1 * w + x + x1];
+
+					B_sum += B_cur;
+
+					if (abs(B_cur - B_center) < B_sigma) {
+						B_ssum += B_cur;
+						B_cnt++;
+					}
+				}
+			}
+
+			R_sum -= R_center;
+
+			unsigned int res_R;
+
+			if (R_cnt >= min)
+				res_R = R_ssum / R_cnt;
+			else
+				res_R = R_sum / cnt;
+
+			G_sum -= G_center;
+
+			unsigned int res_G;
+
+			if (G_cnt >= min)
+				res_G = G_ssum / G_cnt;
+			else
+				res_G = G_sum / cnt;
+
+			B_sum -= B_center;
+
+			unsigned int res_B;
+
+			if (B_cnt >= min)
+				res_B = B_ssum / B_cnt;
+			else
+				res_B = B_sum / cnt;
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB888(res_R, res_G, res_B));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			R[yl * w + x] = GP_PIXEL_GET_R_RGB888(pix);
+			G[yl * w + x] = GP_PIXEL_GET_G_RGB888(pix);
+			B[yl * w + x] = GP_PIXEL_GET_B_RGB888(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_BGR888(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int B_sigma = 255 * sigma;
+	unsigned int G_sigma = 255 * sigma;
+	unsigned int R_sigma = 255 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			B[y * w + x] = GP_PIXEL_GET_B_BGR888(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_BGR888(pix);
+			R[y * w + x] = GP_PIXEL_GET_R_BGR888(pix);
+		}
+	}
+
+	unsigned int B_sum;
+	unsigned int B_ssum;
+	unsigned int B_cnt;
+	unsigned int G_sum;
+	unsigned int G_ssum;
+	unsigned int G_cnt;
+	unsigned int R_sum;
+	unsigned int R_ssum;
+	unsigned int R_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int B_center = B[yc * w + x + xrad];
+			int G_center = G[yc * w + x + xrad];
+			int R_center = R[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			B_sum = 0;
+			B_ssum = 0;
+			B_cnt = 0;
+			G_sum = 0;
+			G_ssum = 0;
+			G_cnt = 0;
+			R_sum = 0;
+			R_ssum = 0;
+			R_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int B_cur = B[y1 * w + x + x1];
+
+					B_sum += B_cur;
+
+					if (abs(B_cur - B_center) < B_sigma) {
+						B_ssum += B_cur;
+						B_cnt++;
+					}
+					int G_cur = G[y1 * w + x + x1];
+
+					G_sum += G_cur;
+
+					if (abs(G_cur - G_center) < G_sigma) {
+						G_ssum += G_cur;
+						G_cnt++;
+					}
+					int R_cur = R[y1 * w + x + x1];
+
+					R_sum += R_cur;
+
+					if (abs(R_cur - R_center) < R_sigma) {
+						R_ssum += R_cur;
+						R_cnt++;
+					}
+				}
+			}
+
+			B_sum -= B_center;
+
+			unsigned int res_B;
+
+			if (B_cnt >= min)
+				res_B = B_ssum / B_cnt;
+			else
+				res_B = B_sum / cnt;
+
+			G_sum -= G_center;
+
+			unsigned int res_G;
+
+			if (G_cnt >= min)
+				res_G = G_ssum / G_cnt;
+			else
+				res_G = G_sum / cnt;
+
+			R_sum -= R_center;
+
+			unsigned int res_R;
+
+			if (R_cnt >= min)
+				res_R = R_ssum / R_cnt;
+			else
+				res_R = R_sum / cnt;
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_BGR888(res_B, res_G, res_R));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			B[yl * w + x] = GP_PIXEL_GET_B_BGR888(pix);
+			G[yl * w + x] = GP_PIXEL_GET_G_BGR888(pix);
+			R[yl * w + x] = GP_PIXEL_GET_R_BGR888(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_RGB555(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int R_sigma = 31 * sigma;
+	unsigned int G_sigma = 31 * sigma;
+	unsigned int B_sigma = 31 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB555(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB555(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB555(pix);
+		}
+	}
+
+	unsigned int R_sum;
+	unsigned int R_ssum;
+	unsigned int R_cnt;
+	unsigned int G_sum;
+	unsigned int G_ssum;
+	unsigned int G_cnt;
+	unsigned int B_sum;
+	unsigned int B_ssum;
+	unsigned int B_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int R_center = R[yc * w + x + xrad];
+			int G_center = G[yc * w + x + xrad];
+			int B_center = B[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			R_sum = 0;
+			R_ssum = 0;
+			R_cnt = 0;
+			G_sum = 0;
+			G_ssum = 0;
+			G_cnt = 0;
+			B_sum = 0;
+			B_ssum = 0;
+			B_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int R_cur = R[y1 * w + x + x1];
+
+					R_sum += R_cur;
+
+					if (abs(R_cur - R_center) < R_sigma) {
+						R_ssum += R_cur;
+						R_cnt++;
+					}
+					int G_cur = G[y1 * w + x + x1];
+
+					G_sum += G_cur;
+
+					if (abs(G_cur - G_center) < G_sigma) {
+						G_ssum += G_cur;
+						G_cnt++;
+					}
+					int B_cur = B[y1 * w + x + x1];
+
+					B_sum += B_cur;
+
+					if (abs(B_cur - B_center) < B_sigma) {
+						B_ssum += B_cur;
+						B_cnt++;
+					}
+				}
+			}
+
+			R_sum -= R_center;
+
+			unsigned int res_R;
+
+			if (R_cnt >= min)
+				res_R = R_ssum / R_cnt;
+			else
+				res_R = R_sum / cnt;
+
+			G_sum -= G_center;
+
+			unsigned int res_G;
+
+			if (G_cnt >= min)
+				res_G = G_ssum / G_cnt;
+			else
+				res_G = G_sum / cnt;
+
+			B_sum -= B_center;
+
+			unsigned int res_B;
+
+			if (B_cnt >= min)
+				res_B = B_ssum / B_cnt;
+			else
+				res_B = B_sum / cnt;
+
+			gp_putpixel_raw_16BPP_BE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB555(res_R, res_G, res_B));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+			R[yl * w + x] = GP_PIXEL_GET_R_RGB555(pix);
+			G[yl * w + x] = GP_PIXEL_GET_G_RGB555(pix);
+			B[yl * w + x] = GP_PIXEL_GET_B_RGB555(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_RGB565_BE(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int R_sigma = 31 * sigma;
+	unsigned int G_sigma = 63 * sigma;
+	unsigned int B_sigma = 31 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB565_BE(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB565_BE(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB565_BE(pix);
+		}
+	}
+
+	unsigned int R_sum;
+	unsigned int R_ssum;
+	unsigned int R_cnt;
+	unsigned int G_sum;
+	unsigned int G_ssum;
+	unsigned int G_cnt;
+	unsigned int B_sum;
+	unsigned int B_ssum;
+	unsigned int B_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int R_center = R[yc * w + x + xrad];
+			int G_center = G[yc * w + x + xrad];
+			int B_center = B[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			R_sum = 0;
+			R_ssum = 0;
+			R_cnt = 0;
+			G_sum = 0;
+			G_ssum = 0;
+			G_cnt = 0;
+			B_sum = 0;
+			B_ssum = 0;
+			B_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int R_cur = R[y1 * w + x + x1];
+
+					R_sum += R_cur;
+
+					if (abs(R_cur - R_center) < R_sigma) {
+						R_ssum += R_cur;
+						R_cnt++;
+					}
+					int G_cur = G[y1 * w + x + x1];
+
+					G_sum += G_cur;
+
+					if (abs(G_cur - G_center) < G_sigma) {
+						G_ssum += G_cur;
+						G_cnt++;
+					}
+					int B_cur = B[y1 * w + x + x1];
+
+					B_sum += B_cur;
+
+					if (abs(B_cur - B_center) < B_sigma) {
+						B_ssum += B_cur;
+						B_cnt++;
+					}
+				}
+			}
+
+			R_sum -= R_center;
+
+			unsigned int res_R;
+
+			if (R_cnt >= min)
+				res_R = R_ssum / R_cnt;
+			else
+				res_R = R_sum / cnt;
+
+			G_sum -= G_center;
+
+			unsigned int res_G;
+
+			if (G_cnt >= min)
+				res_G = G_ssum / G_cnt;
+			else
+				res_G = G_sum / cnt;
+
+			B_sum -= B_center;
+
+			unsigned int res_B;
+
+			if (B_cnt >= min)
+				res_B = B_ssum / B_cnt;
+			else
+				res_B = B_sum / cnt;
+
+			gp_putpixel_raw_16BPP_BE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB565_BE(res_R, res_G, res_B));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+			R[yl * w + x] = GP_PIXEL_GET_R_RGB565_BE(pix);
+			G[yl * w + x] = GP_PIXEL_GET_G_RGB565_BE(pix);
+			B[yl * w + x] = GP_PIXEL_GET_B_RGB565_BE(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_RGB565_LE(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int R_sigma = 31 * sigma;
+	unsigned int G_sigma = 63 * sigma;
+	unsigned int B_sigma = 31 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB565_LE(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB565_LE(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB565_LE(pix);
+		}
+	}
+
+	unsigned int R_sum;
+	unsigned int R_ssum;
+	unsigned int R_cnt;
+	unsigned int G_sum;
+	unsigned int G_ssum;
+	unsigned int G_cnt;
+	unsigned int B_sum;
+	unsigned int B_ssum;
+	unsigned int B_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int R_center = R[yc * w + x + xrad];
+			int G_center = G[yc * w + x + xrad];
+			int B_center = B[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			R_sum = 0;
+			R_ssum = 0;
+			R_cnt = 0;
+			G_sum = 0;
+			G_ssum = 0;
+			G_cnt = 0;
+			B_sum = 0;
+			B_ssum = 0;
+			B_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int R_cur = R[y1 * w + x + x1];
+
+					R_sum += R_cur;
+
+					if (abs(R_cur - R_center) < R_sigma) {
+						R_ssum += R_cur;
+						R_cnt++;
+					}
+					int G_cur = G[y1 * w + x + x1];
+
+					G_sum += G_cur;
+
+					if (abs(G_cur - G_center) < G_sigma) {
+						G_ssum += G_cur;
+						G_cnt++;
+					}
+					int B_cur = B[y1 * w + x + x1];
+
+					B_sum += B_cur;
+
+					if (abs(B_cur - B_center) < B_sigma) {
+						B_ssum += B_cur;
+						B_cnt++;
+					}
+				}
+			}
+
+			R_sum -= R_center;
+
+			unsigned int res_R;
+
+			if (R_cnt >= min)
+				res_R = R_ssum / R_cnt;
+			else
+				res_R = R_sum / cnt;
+
+			G_sum -= G_center;
+
+			unsigned int res_G;
+
+			if (G_cnt >= min)
+				res_G = G_ssum / G_cnt;
+			else
+				res_G = G_sum / cnt;
+
+			B_sum -= B_center;
+
+			unsigned int res_B;
+
+			if (B_cnt >= min)
+				res_B = B_ssum / B_cnt;
+			else
+				res_B = B_sum / cnt;
+
+			gp_putpixel_raw_16BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB565_LE(res_R, res_G, res_B));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			R[yl * w + x] = GP_PIXEL_GET_R_RGB565_LE(pix);
+			G[yl * w + x] = GP_PIXEL_GET_G_RGB565_LE(pix);
+			B[yl * w + x] = GP_PIXEL_GET_B_RGB565_LE(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_RGB666(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int R_sigma = 63 * sigma;
+	unsigned int G_sigma = 63 * sigma;
+	unsigned int B_sigma = 63 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB666(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB666(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB666(pix);
+		}
+	}
+
+	unsigned int R_sum;
+	unsigned int R_ssum;
+	unsigned int R_cnt;
+	unsigned int G_sum;
+	unsigned int G_ssum;
+	unsigned int G_cnt;
+	unsigned int B_sum;
+	unsigned int B_ssum;
+	unsigned int B_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int R_center = R[yc * w + x + xrad];
+			int G_center = G[yc * w + x + xrad];
+			int B_center = B[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			R_sum = 0;
+			R_ssum = 0;
+			R_cnt = 0;
+			G_sum = 0;
+			G_ssum = 0;
+			G_cnt = 0;
+			B_sum = 0;
+			B_ssum = 0;
+			B_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int R_cur = R[y1 * w + x + x1];
+
+					R_sum += R_cur;
+
+					if (abs(R_cur - R_center) < R_sigma) {
+						R_ssum += R_cur;
+						R_cnt++;
+					}
+					int G_cur = G[y1 * w + x + x1];
+
+					G_sum += G_cur;
+
+					if (abs(G_cur - G_center) < G_sigma) {
+						G_ssum += G_cur;
+						G_cnt++;
+					}
+					int B_cur = B[y1 * w + x + x1];
+
+					B_sum += B_cur;
+
+					if (abs(B_cur - B_center) < B_sigma) {
+						B_ssum += B_cur;
+						B_cnt++;
+					}
+				}
+			}
+
+			R_sum -= R_center;
+
+			unsigned int res_R;
+
+			if (R_cnt >= min)
+				res_R = R_ssum / R_cnt;
+			else
+				res_R = R_sum / cnt;
+
+			G_sum -= G_center;
+
+			unsigned int res_G;
+
+			if (G_cnt >= min)
+				res_G = G_ssum / G_cnt;
+			else
+				res_G = G_sum / cnt;
+
+			B_sum -= B_center;
+
+			unsigned int res_B;
+
+			if (B_cnt >= min)
+				res_B = B_ssum / B_cnt;
+			else
+				res_B = B_sum / cnt;
+
+			gp_putpixel_raw_18BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB666(res_R, res_G, res_B));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, xi, yi);
+
+			R[yl * w + x] = GP_PIXEL_GET_R_RGB666(pix);
+			G[yl * w + x] = GP_PIXEL_GET_G_RGB666(pix);
+			B[yl * w + x] = GP_PIXEL_GET_B_RGB666(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_RGB332(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int R_sigma = 7 * sigma;
+	unsigned int G_sigma = 7 * sigma;
+	unsigned int B_sigma = 3 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB332(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB332(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB332(pix);
+		}
+	}
+
+	unsigned int R_sum;
+	unsigned int R_ssum;
+	unsigned int R_cnt;
+	unsigned int G_sum;
+	unsigned int G_ssum;
+	unsigned int G_cnt;
+	unsigned int B_sum;
+	unsigned int B_ssum;
+	unsigned int B_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int R_center = R[yc * w + x + xrad];
+			int G_center = G[yc * w + x + xrad];
+			int B_center = B[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			R_sum = 0;
+			R_ssum = 0;
+			R_cnt = 0;
+			G_sum = 0;
+			G_ssum = 0;
+			G_cnt = 0;
+			B_sum = 0;
+			B_ssum = 0;
+			B_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int R_cur = R[y1 * w + x + x1];
+
+					R_sum += R_cur;
+
+					if (abs(R_cur - R_center) < R_sigma) {
+						R_ssum += R_cur;
+						R_cnt++;
+					}
+					int G_cur = G[y1 * w + x + x1];
+
+					G_sum += G_cur;
+
+					if (abs(G_cur - G_center) < G_sigma) {
+						G_ssum += G_cur;
+						G_cnt++;
+					}
+					int B_cur = B[y1 * w + x + x1];
+
+					B_sum += B_cur;
+
+					if (abs(B_cur - B_center) < B_sigma) {
+						B_ssum += B_cur;
+						B_cnt++;
+					}
+				}
+			}
+
+			R_sum -= R_center;
+
+			unsigned int res_R;
+
+			if (R_cnt >= min)
+				res_R = R_ssum / R_cnt;
+			else
+				res_R = R_sum / cnt;
+
+			G_sum -= G_center;
+
+			unsigned int res_G;
+
+			if (G_cnt >= min)
+				res_G = G_ssum / G_cnt;
+			else
+				res_G = G_sum / cnt;
+
+			B_sum -= B_center;
+
+			unsigned int res_B;
+
+			if (B_cnt >= min)
+				res_B = B_ssum / B_cnt;
+			else
+				res_B = B_sum / cnt;
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB332(res_R, res_G, res_B));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			R[yl * w + x] = GP_PIXEL_GET_R_RGB332(pix);
+			G[yl * w + x] = GP_PIXEL_GET_G_RGB332(pix);
+			B[yl * w + x] = GP_PIXEL_GET_B_RGB332(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_CMYK8888(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int K_sigma = 255 * sigma;
+	unsigned int Y_sigma = 255 * sigma;
+	unsigned int M_sigma = 255 * sigma;
+	unsigned int C_sigma = 255 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 4 * size * sizeof(unsigned int));
+
+	unsigned int *K = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *Y = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *M = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *C = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			K[y * w + x] = GP_PIXEL_GET_K_CMYK8888(pix);
+			Y[y * w + x] = GP_PIXEL_GET_Y_CMYK8888(pix);
+			M[y * w + x] = GP_PIXEL_GET_M_CMYK8888(pix);
+			C[y * w + x] = GP_PIXEL_GET_C_CMYK8888(pix);
+		}
+	}
+
+	unsigned int K_sum;
+	unsigned int K_ssum;
+	unsigned int K_cnt;
+	unsigned int Y_sum;
+	unsigned int Y_ssum;
+	unsigned int Y_cnt;
+	unsigned int M_sum;
+	unsigned int M_ssum;
+	unsigned int M_cnt;
+	unsigned int C_sum;
+	unsigned int C_ssum;
+	unsigned int C_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int K_center = K[yc * w + x + xrad];
+			int Y_center = Y[yc * w + x + xrad];
+			int M_center = M[yc * w + x + xrad];
+			int C_center = C[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			K_sum = 0;
+			K_ssum = 0;
+			K_cnt = 0;
+			Y_sum = 0;
+			Y_ssum = 0;
+			Y_cnt = 0;
+			M_sum = 0;
+			M_ssum = 0;
+			M_cnt = 0;
+			C_sum = 0;
+			C_ssum = 0;
+			C_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int K_cur = K[y1 * w + x + x1];
+
+					K_sum += K_cur;
+
+					if (abs(K_cur - K_center) < K_sigma) {
+						K_ssum += K_cur;
+						K_cnt++;
+					}
+					int Y_cur = Y[y1 * w + x + x1];
+
+					Y_sum += Y_cur;
+
+					if (abs(Y_cur - Y_center) < Y_sigma) {
+						Y_ssum += Y_cur;
+						Y_cnt++;
+					}
+					int M_cur = M[y1 * w + x + x1];
+
+					M_sum += M_cur;
+
+					if (abs(M_cur - M_center) < M_sigma) {
+						M_ssum += M_cur;
+						M_cnt++;
+					}
+					int C_cur = C[y1 * w + x + x1];
+
+					C_sum += C_cur;
+
+					if (abs(C_cur - C_center) < C_sigma) {
+						C_ssum += C_cur;
+						C_cnt++;
+					}
+				}
+			}
+
+			K_sum -= K_center;
+
+			unsigned int res_K;
+
+			if (K_cnt >= min)
+				res_K = K_ssum / K_cnt;
+			else
+				res_K = K_sum / cnt;
+
+			Y_sum -= Y_center;
+
+			unsigned int res_Y;
+
+			if (Y_cnt >= min)
+				res_Y = Y_ssum / Y_cnt;
+			else
+				res_Y = Y_sum / cnt;
+
+			M_sum -= M_center;
+
+			unsigned int res_M;
+
+			if (M_cnt >= min)
+				res_M = M_ssum / M_cnt;
+			else
+				res_M = M_sum / cnt;
+
+			C_sum -= C_center;
+
+			unsigned int res_C;
+
+			if (C_cnt >= min)
+				res_C = C_ssum / C_cnt;
+			else
+				res_C = C_sum / cnt;
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_CMYK8888(res_K, res_Y, res_M, res_C));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			K[yl * w + x] = GP_PIXEL_GET_K_CMYK8888(pix);
+			Y[yl * w + x] = GP_PIXEL_GET_Y_CMYK8888(pix);
+			M[yl * w + x] = GP_PIXEL_GET_M_CMYK8888(pix);
+			C[yl * w + x] = GP_PIXEL_GET_C_CMYK8888(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_G1_DB(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int V_sigma = 1 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G1_DB(pix);
+		}
+	}
+
+	unsigned int V_sum;
+	unsigned int V_ssum;
+	unsigned int V_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int V_center = V[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			V_sum = 0;
+			V_ssum = 0;
+			V_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int V_cur = V[y1 * w + x + x1];
+
+					V_sum += V_cur;
+
+					if (abs(V_cur - V_center) < V_sigma) {
+						V_ssum += V_cur;
+						V_cnt++;
+					}
+				}
+			}
+
+			V_sum -= V_center;
+
+			unsigned int res_V;
+
+			if (V_cnt >= min)
+				res_V = V_ssum / V_cnt;
+			else
+				res_V = V_sum / cnt;
+
+			gp_putpixel_raw_1BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G1_DB(res_V));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, xi, yi);
+
+			V[yl * w + x] = GP_PIXEL_GET_V_G1_DB(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_G2_DB(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int V_sigma = 3 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G2_DB(pix);
+		}
+	}
+
+	unsigned int V_sum;
+	unsigned int V_ssum;
+	unsigned int V_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int V_center = V[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			V_sum = 0;
+			V_ssum = 0;
+			V_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int V_cur = V[y1 * w + x + x1];
+
+					V_sum += V_cur;
+
+					if (abs(V_cur - V_center) < V_sigma) {
+						V_ssum += V_cur;
+						V_cnt++;
+					}
+				}
+			}
+
+			V_sum -= V_center;
+
+			unsigned int res_V;
+
+			if (V_cnt >= min)
+				res_V = V_ssum / V_cnt;
+			else
+				res_V = V_sum / cnt;
+
+			gp_putpixel_raw_2BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G2_DB(res_V));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, xi, yi);
+
+			V[yl * w + x] = GP_PIXEL_GET_V_G2_DB(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_G4_DB(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int V_sigma = 15 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G4_DB(pix);
+		}
+	}
+
+	unsigned int V_sum;
+	unsigned int V_ssum;
+	unsigned int V_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int V_center = V[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			V_sum = 0;
+			V_ssum = 0;
+			V_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int V_cur = V[y1 * w + x + x1];
+
+					V_sum += V_cur;
+
+					if (abs(V_cur - V_center) < V_sigma) {
+						V_ssum += V_cur;
+						V_cnt++;
+					}
+				}
+			}
+
+			V_sum -= V_center;
+
+			unsigned int res_V;
+
+			if (V_cnt >= min)
+				res_V = V_ssum / V_cnt;
+			else
+				res_V = V_sum / cnt;
+
+			gp_putpixel_raw_4BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G4_DB(res_V));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, xi, yi);
+
+			V[yl * w + x] = GP_PIXEL_GET_V_G4_DB(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_G1_UB(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int V_sigma = 1 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G1_UB(pix);
+		}
+	}
+
+	unsigned int V_sum;
+	unsigned int V_ssum;
+	unsigned int V_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int V_center = V[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			V_sum = 0;
+			V_ssum = 0;
+			V_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int V_cur = V[y1 * w + x + x1];
+
+					V_sum += V_cur;
+
+					if (abs(V_cur - V_center) < V_sigma) {
+						V_ssum += V_cur;
+						V_cnt++;
+					}
+				}
+			}
+
+			V_sum -= V_center;
+
+			unsigned int res_V;
+
+			if (V_cnt >= min)
+				res_V = V_ssum / V_cnt;
+			else
+				res_V = V_sum / cnt;
+
+			gp_putpixel_raw_1BPP_UB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G1_UB(res_V));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, xi, yi);
+
+			V[yl * w + x] = GP_PIXEL_GET_V_G1_UB(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_G2_UB(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int V_sigma = 3 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G2_UB(pix);
+		}
+	}
+
+	unsigned int V_sum;
+	unsigned int V_ssum;
+	unsigned int V_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int V_center = V[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			V_sum = 0;
+			V_ssum = 0;
+			V_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int V_cur = V[y1 * w + x + x1];
+
+					V_sum += V_cur;
+
+					if (abs(V_cur - V_center) < V_sigma) {
+						V_ssum += V_cur;
+						V_cnt++;
+					}
+				}
+			}
+
+			V_sum -= V_center;
+
+			unsigned int res_V;
+
+			if (V_cnt >= min)
+				res_V = V_ssum / V_cnt;
+			else
+				res_V = V_sum / cnt;
+
+			gp_putpixel_raw_2BPP_UB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G2_UB(res_V));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, xi, yi);
+
+			V[yl * w + x] = GP_PIXEL_GET_V_G2_UB(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_G4_UB(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int V_sigma = 15 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G4_UB(pix);
+		}
+	}
+
+	unsigned int V_sum;
+	unsigned int V_ssum;
+	unsigned int V_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int V_center = V[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			V_sum = 0;
+			V_ssum = 0;
+			V_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int V_cur = V[y1 * w + x + x1];
+
+					V_sum += V_cur;
+
+					if (abs(V_cur - V_center) < V_sigma) {
+						V_ssum += V_cur;
+						V_cnt++;
+					}
+				}
+			}
+
+			V_sum -= V_center;
+
+			unsigned int res_V;
+
+			if (V_cnt >= min)
+				res_V = V_ssum / V_cnt;
+			else
+				res_V = V_sum / cnt;
+
+			gp_putpixel_raw_4BPP_UB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G4_UB(res_V));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, xi, yi);
+
+			V[yl * w + x] = GP_PIXEL_GET_V_G4_UB(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_G8(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int V_sigma = 255 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G8(pix);
+		}
+	}
+
+	unsigned int V_sum;
+	unsigned int V_ssum;
+	unsigned int V_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int V_center = V[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			V_sum = 0;
+			V_ssum = 0;
+			V_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int V_cur = V[y1 * w + x + x1];
+
+					V_sum += V_cur;
+
+					if (abs(V_cur - V_center) < V_sigma) {
+						V_ssum += V_cur;
+						V_cnt++;
+					}
+				}
+			}
+
+			V_sum -= V_center;
+
+			unsigned int res_V;
+
+			if (V_cnt >= min)
+				res_V = V_ssum / V_cnt;
+			else
+				res_V = V_sum / cnt;
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G8(res_V));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			V[yl * w + x] = GP_PIXEL_GET_V_G8(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_GA88(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int V_sigma = 255 * sigma;
+	unsigned int A_sigma = 255 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 2 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *A = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_GA88(pix);
+			A[y * w + x] = GP_PIXEL_GET_A_GA88(pix);
+		}
+	}
+
+	unsigned int V_sum;
+	unsigned int V_ssum;
+	unsigned int V_cnt;
+	unsigned int A_sum;
+	unsigned int A_ssum;
+	unsigned int A_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int V_center = V[yc * w + x + xrad];
+			int A_center = A[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			V_sum = 0;
+			V_ssum = 0;
+			V_cnt = 0;
+			A_sum = 0;
+			A_ssum = 0;
+			A_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int V_cur = V[y1 * w + x + x1];
+
+					V_sum += V_cur;
+
+					if (abs(V_cur - V_center) < V_sigma) {
+						V_ssum += V_cur;
+						V_cnt++;
+					}
+					int A_cur = A[y1 * w + x + x1];
+
+					A_sum += A_cur;
+
+					if (abs(A_cur - A_center) < A_sigma) {
+						A_ssum += A_cur;
+						A_cnt++;
+					}
+				}
+			}
+
+			V_sum -= V_center;
+
+			unsigned int res_V;
+
+			if (V_cnt >= min)
+				res_V = V_ssum / V_cnt;
+			else
+				res_V = V_sum / cnt;
+
+			A_sum -= A_center;
+
+			unsigned int res_A;
+
+			if (A_cnt >= min)
+				res_A = A_ssum / A_cnt;
+			else
+				res_A = A_sum / cnt;
+
+			gp_putpixel_raw_16BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_GA88(res_V, res_A));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			V[yl * w + x] = GP_PIXEL_GET_V_GA88(pix);
+			A[yl * w + x] = GP_PIXEL_GET_A_GA88(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_G16(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+	unsigned int V_sigma = 65535 * sigma;
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G16(pix);
+		}
+	}
+
+	unsigned int V_sum;
+	unsigned int V_ssum;
+	unsigned int V_cnt;
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+			int V_center = V[yc * w + x + xrad];
+
+			/* Reset sum counters */
+			V_sum = 0;
+			V_ssum = 0;
+			V_cnt = 0;
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+					int V_cur = V[y1 * w + x + x1];
+
+					V_sum += V_cur;
+
+					if (abs(V_cur - V_center) < V_sigma) {
+						V_ssum += V_cur;
+						V_cnt++;
+					}
+				}
+			}
+
+			V_sum -= V_center;
+
+			unsigned int res_V;
+
+			if (V_cnt >= min)
+				res_V = V_ssum / V_cnt;
+			else
+				res_V = V_sum / cnt;
+
+			gp_putpixel_raw_16BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G16(res_V));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			V[yl * w + x] = GP_PIXEL_GET_V_G16(pix);
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int sigma_filter(const gp_pixmap *src,
+                        gp_coord x_src, gp_coord y_src,
+                        gp_size w_src, gp_size h_src,
+                        gp_pixmap *dst,
+                        gp_coord x_dst, gp_coord y_dst,
+                        int xrad, int yrad,
+                        unsigned int min, float sigma,
+                        gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_RGB101010:
+		return sigma_RGB101010(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_xRGB8888:
+		return sigma_xRGB8888(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_RGBA8888:
+		return sigma_RGBA8888(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_RGB888:
+		return sigma_RGB888(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_BGR888:
+		return sigma_BGR888(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_RGB555:
+		return sigma_RGB555(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_RGB565_BE:
+		return sigma_RGB565_BE(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_RGB565_LE:
+		return sigma_RGB565_LE(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_RGB666:
+		return sigma_RGB666(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_RGB332:
+		return sigma_RGB332(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_CMYK8888:
+		return sigma_CMYK8888(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_G1_DB:
+		return sigma_G1_DB(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_G2_DB:
+		return sigma_G2_DB(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_G4_DB:
+		return sigma_G4_DB(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_G1_UB:
+		return sigma_G1_UB(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_G2_UB:
+		return sigma_G2_UB(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_G4_UB:
+		return sigma_G4_UB(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_G8:
+		return sigma_G8(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_GA88:
+		return sigma_GA88(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	case GP_PIXEL_G16:
+		return sigma_G16(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+	default:
+		errno = ENOSYS;
+		return -1;
+	}
+}
+
+/*
+ * The strips read the halo of xrad columns on each side from the source so
+ * the result does not depend on the number of threads.
+ */
+#ifdef HAVE_PTHREAD
+struct sigma_filter_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	int xrad;
+	int yrad;
+	unsigned int min;
+	float sigma;
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
+
+static void *sigma_filter_thread(void *arg)
+{
+	struct sigma_filter_args *a = arg;
+
+	a->ret = sigma_filter(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  a->xrad, a->yrad, a->min, a->sigma, a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int sigma_filter_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       int xrad, int yrad, unsigned int min, float sigma,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+	t = GP_MIN(t, w_src);
+
+	if (t <= 1) {
+		return sigma_filter(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, xrad, yrad, min, sigma, callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct sigma_filter_args args[t];
+	char started[t];
+	gp_size w = w_src / t;
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct sigma_filter_args) {
+			.src = src,
+			.x_src = x_src + i * w,
+			.y_src = y_src,
+			.w_src = i == t - 1 ? w_src - i * w : w,
+			.h_src = h_src,
+			.dst = dst,
+			.x_dst = x_dst + i * w,
+			.y_dst = y_dst,
+			.xrad = xrad,
+			.yrad = yrad,
+			.min = min,
+			.sigma = sigma,
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, sigma_filter_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			sigma_filter_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+#else
+static int sigma_filter_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       int xrad, int yrad, unsigned int min, float sigma,
+                       gp_progress_cb *callback)
+{
+	return sigma_filter(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, xrad, yrad, min, sigma, callback);
+}
+#endif /* HAVE_PTHREAD */
+
+int gp_filter_sigma_ex(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       int xrad, int yrad,
+                       unsigned int min, float sigma,
+                       gp_progress_cb *callback)
+{
+	GP_CHECK(src->pixel_type == dst->pixel_type);
+
+	/* Check that destination is large enough */
+	GP_CHECK(x_dst + (gp_coord)w_src <= (gp_coord)dst->w);
+	GP_CHECK(y_dst + (gp_coord)h_src <= (gp_coord)dst->h);
+
+	GP_CHECK(xrad >= 0 && yrad >= 0);
+
+	return sigma_filter_mp(src, x_src, y_src, w_src, h_src,
+	                       dst, x_dst, y_dst, xrad, yrad, min, sigma,
+	                       callback);
+}
+
+gp_pixmap *gp_filter_sigma_ex_alloc(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    int xrad, int yrad,
+                                    unsigned int min, float sigma,
+                                    gp_progress_cb *callback)
+{
+	int ret;
+
+	GP_CHECK(xrad >= 0 && yrad >= 0);
+
+	gp_pixmap *dst = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (dst == NULL)
+		return NULL;
+
+	ret = sigma_filter_mp(src, x_src, y_src, w_src, h_src,
+	                      dst, 0, 0, xrad, yrad, min, sigma, callback);
+
+	if (ret) {
+		gp_pixmap_free(dst);
+		return NULL;
+	}
+
+	return dst;
+}
@@ -0,0 +1,238 @@
+@ include source.t
+@ include thread_dispatcher.t
+/*
+ * Sigma mean filter
+ *
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "../../config.h"
+
+#include <core/gp_common.h>
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_clamp.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+#include <filters/gp_sigma.h>
+
+@ def sigma_supported(pt):
+@     return not pt.is_unknown() and not pt.is_palette()
+@ end
+@
+@ for pt in pixeltypes:
+@     if sigma_supported(pt):
+static int sigma_{{ pt.name }}(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	int x, y;
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
+	         w_src, h_src, xrad, yrad, sigma);
+
+@         for c in pt.chanslist:
+	unsigned int {{ c.name }}_sigma = {{ c.max }} * sigma;
+@         end
+
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int ydiam = 2 * yrad + 1;
+
+	unsigned int w = w_src + xdiam;
+	unsigned int size = w * ydiam;
+
+	gp_temp_alloc_create(temp, {{ pt.chan_cnt }} * size * sizeof(unsigned int));
+
+@         for c in pt.chanslist:
+	unsigned int *{{ c.name }} = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+@         end
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)ydiam; y++) {
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, xi, yi);
+
+@         for c in pt.chanslist:
+			{{ c.name }}[y * w + x] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+@         end
+		}
+	}
+
+@         for c in pt.chanslist:
+	unsigned int {{ c.name }}_sum;
+	unsigned int {{ c.name }}_ssum;
+	unsigned int {{ c.name }}_cnt;
+@         end
+
+	unsigned int cnt = xdiam * ydiam - 1;
+
+	/* center pixel ypsilon in the buffer */
+	unsigned int yc = yrad;
+	/* last sampled ypsilon in the buffer */
+	unsigned int yl = 0;
+
+	/* Apply the sigma mean filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* Get center pixel */
+@         for c in pt.chanslist:
+			int {{ c.name }}_center = {{ c.name }}[yc * w + x + xrad];
+@         end
+
+			/* Reset sum counters */
+@         for c in pt.chanslist:
+			{{ c.name }}_sum = 0;
+			{{ c.name }}_ssum = 0;
+			{{ c.name }}_cnt = 0;
+@         end
+
+			for (x1 = 0; x1 < xdiam; x1++) {
+				for (y1 = 0; y1 < ydiam; y1++) {
+@         for c in pt.chanslist:
+					int {{ c.name }}_cur = {{ c.name }}[y1 * w + x + x1];
+
+					{{ c.name }}_sum += {{ c.name }}_cur;
+
+					if (abs({{ c.name }}_cur - {{ c.name }}_center) < {{ c.name }}_sigma) {
+						{{ c.name }}_ssum += {{ c.name }}_cur;
+						{{ c.name }}_cnt++;
+					}
+@         end
+				}
+			}
+
+@         for c in pt.chanslist:
+			{{ c.name }}_sum -= {{ c.name }}_center;
+
+			unsigned int res_{{ c.name }};
+
+			if ({{ c.name }}_cnt >= min)
+				res_{{ c.name }} = {{ c.name }}_ssum / {{ c.name }}_cnt;
+			else
+				res_{{ c.name }} = {{ c.name }}_sum / cnt;
+
+@         end
+			gp_putpixel_raw_{{ pt.pixelpack.suffix }}(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names, 'res_') }}));
+		}
+
+		int yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+			gp_pixel pix = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, xi, yi);
+
+@         for c in pt.chanslist:
+			{{ c.name }}[yl * w + x] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+@         end
+		}
+
+		yc = (yc+1) % ydiam;
+		yl = (yl+1) % ydiam;
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+@ end
+static int sigma_filter(const gp_pixmap *src,
+                        gp_coord x_src, gp_coord y_src,
+                        gp_size w_src, gp_size h_src,
+                        gp_pixmap *dst,
+                        gp_coord x_dst, gp_coord y_dst,
+                        int xrad, int yrad,
+                        unsigned int min, float sigma,
+                        gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+@ for pt in pixeltypes:
+@     if sigma_supported(pt):
+	case GP_PIXEL_{{ pt.name }}:
+		return sigma_{{ pt.name }}(src, x_src, y_src, w_src, h_src,
+		                           dst, x_dst, y_dst, xrad, yrad,
+		                           min, sigma, callback);
+@ end
+	default:
+		errno = ENOSYS;
+		return -1;
+	}
+}
+
+/*
+ * The strips read the halo of xrad columns on each side from the source so
+ * the result does not depend on the number of threads.
+ */
+{@ dispatcher('sigma_filter', [['int', 'xrad'], ['int', 'yrad'], ['unsigned int', 'min'], ['float', 'sigma']], True) @}
+
+int gp_filter_sigma_ex(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       int xrad, int yrad,
+                       unsigned int min, float sigma,
+                       gp_progress_cb *callback)
+{
+	GP_CHECK(src->pixel_type == dst->pixel_type);
+
+	/* Check that destination is large enough */
+	GP_CHECK(x_dst + (gp_coord)w_src <= (gp_coord)dst->w);
+	GP_CHECK(y_dst + (gp_coord)h_src <= (gp_coord)dst->h);
+
+	GP_CHECK(xrad >= 0 && yrad >= 0);
+
+	return sigma_filter_mp(src, x_src, y_src, w_src, h_src,
+	                       dst, x_dst, y_dst, xrad, yrad, min, sigma,
+	                       callback);
+}
+
+gp_pixmap *gp_filter_sigma_ex_alloc(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    int xrad, int yrad,
+                                    unsigned int min, float sigma,
+                                    gp_progress_cb *callback)
+{
+	int ret;
+
+	GP_CHECK(xrad >= 0 && yrad >= 0);
+
+	gp_pixmap *dst = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (dst == NULL)
+		return NULL;
+
+	ret = sigma_filter_mp(src, x_src, y_src, w_src, h_src,
+	                      dst, 0, 0, xrad, yrad, min, sigma, callback);
+
+	if (ret) {
+		gp_pixmap_free(dst);
+		return NULL;
+	}
+
+	return dst;
+}
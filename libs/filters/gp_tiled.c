@@ -0,0 +1,427 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "../../config.h"
+
+#ifdef HAVE_PTHREAD
+# include <pthread.h>
+#endif
+
+#include <core/gp_common.h>
+#include <core/gp_debug.h>
+#include <core/gp_pixmap.h>
+#include <core/gp_blit.h>
+#include <core/gp_threads.h>
+
+#include <filters/gp_blur.h>
+#include <filters/gp_median.h>
+#include <filters/gp_tiled.h>
+
+#define DEFAULT_TILE_SIZE 512
+
+struct tiled {
+	gp_tile_src *src;
+	gp_tile_sink *sink;
+	const gp_tiled_filter *filter;
+	gp_size tile_w;
+	gp_size tile_h;
+	unsigned int tiles_x;
+	unsigned int tiles;
+	unsigned int next;
+	unsigned int done;
+	int ret;
+	int err;
+	gp_progress_cb *callback;
+#ifdef HAVE_PTHREAD
+	pthread_mutex_t lock;
+#endif
+};
+
+static void tiled_lock(struct tiled *self)
+{
+#ifdef HAVE_PTHREAD
+	pthread_mutex_lock(&self->lock);
+#else
+	(void) self;
+#endif
+}
+
+static void tiled_unlock(struct tiled *self)
+{
+#ifdef HAVE_PTHREAD
+	pthread_mutex_unlock(&self->lock);
+#else
+	(void) self;
+#endif
+}
+
+/* Has to be called with the lock held */
+static void tiled_fail(struct tiled *self, int err)
+{
+	if (self->ret)
+		return;
+
+	self->ret = 1;
+	self->err = err;
+}
+
+/*
+ * Picks a next tile and reads it along with the halo clipped to the image
+ * size into the tile buffer. Returns non-zero when there is nothing more to
+ * do.
+ */
+static int tile_read(struct tiled *self, gp_pixmap *buf, gp_pixmap *tile,
+                     gp_coord *x, gp_coord *y, gp_size *w, gp_size *h,
+                     gp_coord *hx, gp_coord *hy)
+{
+	const gp_tiled_filter *filter = self->filter;
+	gp_tile_src *src = self->src;
+	gp_coord x0, y0, x1, y1;
+	unsigned int i;
+	int ret = 1;
+
+	tiled_lock(self);
+
+	if (self->ret || self->next >= self->tiles)
+		goto exit;
+
+	i = self->next++;
+
+	*x = (i % self->tiles_x) * self->tile_w;
+	*y = (i / self->tiles_x) * self->tile_h;
+	*w = GP_MIN(self->tile_w, src->w - *x);
+	*h = GP_MIN(self->tile_h, src->h - *y);
+
+	x0 = GP_MAX(*x - (gp_coord)filter->halo_x, 0);
+	y0 = GP_MAX(*y - (gp_coord)filter->halo_y, 0);
+	x1 = GP_MIN(*x + *w + filter->halo_x, src->w);
+	y1 = GP_MIN(*y + *h + filter->halo_y, src->h);
+
+	*hx = *x - x0;
+	*hy = *y - y0;
+
+	gp_pixmap_init_ex(tile, x1 - x0, y1 - y0, buf->pixel_type,
+	                  buf->bytes_per_row, buf->pixels, 0);
+
+	if (src->read(src, x0, y0, tile)) {
+		tiled_fail(self, errno);
+		goto exit;
+	}
+
+	ret = 0;
+exit:
+	tiled_unlock(self);
+	return ret;
+}
+
+static void tile_write(struct tiled *self, const gp_pixmap *tile,
+                       gp_coord x, gp_coord y, gp_size w, gp_size h,
+                       gp_coord hx, gp_coord hy)
+{
+	gp_progress_cb *callback = self->callback;
+
+	tiled_lock(self);
+
+	if (self->ret)
+		goto exit;
+
+	if (self->sink->write(self->sink, x, y, tile, hx, hy, w, h)) {
+		tiled_fail(self, errno);
+		goto exit;
+	}
+
+	self->done++;
+
+	if (callback) {
+		callback->percentage = 100.00 * self->done / self->tiles;
+
+		if (callback->callback(callback))
+			tiled_fail(self, ECANCELED);
+	}
+
+exit:
+	tiled_unlock(self);
+}
+
+static int tile_progress(gp_progress_cb *self)
+{
+	(void) self;
+	return 0;
+}
+
+static void *tiled_worker(void *arg)
+{
+	struct tiled *self = arg;
+	const gp_tiled_filter *filter = self->filter;
+	gp_size max_w = self->tile_w + 2 * filter->halo_x;
+	gp_size max_h = self->tile_h + 2 * filter->halo_y;
+	gp_pixmap *in_buf, *out_buf;
+	gp_pixmap in, out;
+	gp_coord x, y, hx, hy;
+	gp_size w, h;
+
+	/*
+	 * Tiles are already processed in parallel, the filter must not start
+	 * threads on its own. The progress is reported per tile.
+	 */
+	gp_progress_cb tile_callback = {
+		.callback = tile_progress,
+		.threads = 1,
+	};
+
+	max_w = GP_MIN(max_w, self->src->w);
+	max_h = GP_MIN(max_h, self->src->h);
+
+	in_buf = gp_pixmap_alloc(max_w, max_h, self->src->pixel_type);
+	out_buf = gp_pixmap_alloc(max_w, max_h, self->src->pixel_type);
+
+	if (!in_buf || !out_buf) {
+		tiled_lock(self);
+		tiled_fail(self, ENOMEM);
+		tiled_unlock(self);
+		goto exit;
+	}
+
+	while (!tile_read(self, in_buf, &in, &x, &y, &w, &h, &hx, &hy)) {
+		gp_pixmap_init_ex(&out, in.w, in.h, out_buf->pixel_type,
+		                  out_buf->bytes_per_row, out_buf->pixels, 0);
+
+		if (filter->filter(&in, &out, filter, &tile_callback)) {
+			tiled_lock(self);
+			tiled_fail(self, errno);
+			tiled_unlock(self);
+			break;
+		}
+
+		tile_write(self, &out, x, y, w, h, hx, hy);
+	}
+
+exit:
+	gp_pixmap_free(in_buf);
+	gp_pixmap_free(out_buf);
+	return NULL;
+}
+
+#ifdef HAVE_PTHREAD
+static void tiled_run(struct tiled *self, unsigned int t)
+{
+	pthread_t threads[t];
+	char started[t];
+	unsigned int i;
+
+	pthread_mutex_init(&self->lock, NULL);
+
+	for (i = 0; i < t; i++) {
+		started[i] = !pthread_create(&threads[i], NULL, tiled_worker, self);
+
+		if (!started[i])
+			GP_DEBUG(1, "pthread_create() failed, using less threads");
+	}
+
+	/* Make sure the tiles are processed even if no thread was started */
+	tiled_worker(self);
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+	}
+
+	pthread_mutex_destroy(&self->lock);
+}
+#else
+static void tiled_run(struct tiled *self, unsigned int t)
+{
+	(void) t;
+
+	tiled_worker(self);
+}
+#endif /* HAVE_PTHREAD */
+
+int gp_filter_tiled(gp_tile_src *src, gp_tile_sink *sink,
+                    const gp_tiled_filter *filter,
+                    gp_size tile_w, gp_size tile_h,
+                    gp_progress_cb *callback)
+{
+	struct tiled self = {
+		.src = src,
+		.sink = sink,
+		.filter = filter,
+		.tile_w = tile_w ? tile_w : DEFAULT_TILE_SIZE,
+		.tile_h = tile_h ? tile_h : DEFAULT_TILE_SIZE,
+		.callback = callback,
+	};
+	unsigned int t;
+
+	if (!src->w || !src->h)
+		return 0;
+
+	self.tiles_x = (src->w + self.tile_w - 1) / self.tile_w;
+	self.tiles = self.tiles_x * ((src->h + self.tile_h - 1) / self.tile_h);
+
+	t = gp_nr_threads(src->w, src->h, callback);
+	t = GP_MIN(t, self.tiles);
+
+	GP_DEBUG(1, "Tiled filter image %ux%u tiles %ux%u halo %ux%u %u tiles %u threads",
+	         src->w, src->h, self.tile_w, self.tile_h,
+	         filter->halo_x, filter->halo_y, self.tiles, t);
+
+	/* The caller thread works as well */
+	tiled_run(&self, t - 1);
+
+	if (self.ret) {
+		errno = self.err;
+		return 1;
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int pixmap_read(gp_tile_src *self, gp_coord x, gp_coord y, gp_pixmap *tile)
+{
+	gp_blit_xywh_raw(self->priv, x, y, tile->w, tile->h, tile, 0, 0);
+
+	return 0;
+}
+
+void gp_tile_src_pixmap(gp_tile_src *self, const gp_pixmap *pixmap)
+{
+	self->pixel_type = pixmap->pixel_type;
+	self->w = pixmap->w;
+	self->h = pixmap->h;
+	self->read = pixmap_read;
+	self->priv = (void *)pixmap;
+}
+
+static int pixmap_write(gp_tile_sink *self, gp_coord x, gp_coord y,
+                        const gp_pixmap *tile, gp_coord x_tile, gp_coord y_tile,
+                        gp_size w, gp_size h)
+{
+	gp_blit_xywh_raw(tile, x_tile, y_tile, w, h, self->priv, x, y);
+
+	return 0;
+}
+
+void gp_tile_sink_pixmap(gp_tile_sink *self, gp_pixmap *pixmap)
+{
+	self->write = pixmap_write;
+	self->priv = pixmap;
+}
+
+gp_pixmap *gp_tile_raw_map(const char *path, gp_size w, gp_size h,
+                           gp_pixel_type pixel_type, int flags)
+{
+	int create = flags & GP_TILE_RAW_CREATE;
+	gp_pixmap *ret;
+	size_t size;
+	void *pixels;
+	int fd, err;
+
+	ret = malloc(sizeof(gp_pixmap));
+	if (!ret) {
+		GP_WARN("Malloc failed :(");
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	gp_pixmap_init(ret, w, h, pixel_type, NULL, 0);
+
+	size = (size_t)ret->bytes_per_row * h;
+
+	fd = open(path, create ? O_RDWR | O_CREAT | O_TRUNC : O_RDWR, 0644);
+	if (fd < 0) {
+		err = errno;
+		GP_WARN("Failed to open '%s': %s", path, strerror(err));
+		goto err0;
+	}
+
+	if (create && ftruncate(fd, size)) {
+		err = errno;
+		GP_WARN("Failed to resize '%s': %s", path, strerror(err));
+		goto err1;
+	}
+
+	if (!create && lseek(fd, 0, SEEK_END) < (off_t)size) {
+		err = EINVAL;
+		GP_WARN("File '%s' is smaller than %ux%u %s", path, w, h,
+		        gp_pixel_type_name(pixel_type));
+		goto err1;
+	}
+
+	pixels = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (pixels == MAP_FAILED) {
+		err = errno;
+		GP_WARN("Failed to mmap '%s': %s", path, strerror(err));
+		goto err1;
+	}
+
+	close(fd);
+
+	ret->pixels = pixels;
+
+	GP_DEBUG(1, "Mapped '%s' as %ux%u %s", path, w, h,
+	         gp_pixel_type_name(pixel_type));
+
+	return ret;
+err1:
+	close(fd);
+err0:
+	free(ret);
+	errno = err;
+	return NULL;
+}
+
+void gp_tile_raw_unmap(gp_pixmap *self)
+{
+	if (!self)
+		return;
+
+	munmap(self->pixels, (size_t)self->bytes_per_row * self->h);
+	free(self);
+}
+
+static int gaussian_blur(const gp_pixmap *src, gp_pixmap *dst,
+                         const gp_tiled_filter *self,
+                         gp_progress_cb *callback)
+{
+	return gp_filter_gaussian_blur(src, dst, self->blur.x_sigma,
+	                               self->blur.y_sigma, callback);
+}
+
+void gp_tiled_filter_gaussian_blur(gp_tiled_filter *self,
+                                   float x_sigma, float y_sigma)
+{
+	/* Has to match the gaussian kernel size */
+	self->halo_x = 3 * x_sigma;
+	self->halo_y = 3 * y_sigma;
+	self->filter = gaussian_blur;
+	self->blur.x_sigma = x_sigma;
+	self->blur.y_sigma = y_sigma;
+}
+
+static int median(const gp_pixmap *src, gp_pixmap *dst,
+                  const gp_tiled_filter *self,
+                  gp_progress_cb *callback)
+{
+	return gp_filter_median(src, dst, self->median.xmed,
+	                        self->median.ymed, callback);
+}
+
+void gp_tiled_filter_median(gp_tiled_filter *self, int xmed, int ymed)
+{
+	self->halo_x = xmed;
+	self->halo_y = ymed;
+	self->filter = median;
+	self->median.xmed = xmed;
+	self->median.ymed = ymed;
+}
@@ -0,0 +1,1942 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_weighted_median.gen.c
+ *
+ * GENERATED on 2026 10 19 19:42:18 from gp_weighted_median.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Weighted median filter
+ *
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "../../config.h"
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_clamp.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+#include <filters/gp_weighted_median.h>
+
+static unsigned int sum_weights(gp_median_weights *weights)
+{
+	unsigned int i;
+	unsigned int sum = 0;
+
+	for (i = 0; i < weights->w * weights->h; i++)
+		sum += weights->weights[i];
+
+	return sum;
+}
+
+static inline void hist_add(unsigned int *hist, unsigned int val,
+                            unsigned int count)
+{
+	hist[val] += count;
+}
+
+static inline unsigned int hist_med(unsigned int *hist, unsigned int size,
+                                    unsigned int threshold)
+{
+	unsigned int i;
+	unsigned int acc = 0;
+
+	for (i = 0; i < size; i++) {
+		acc += hist[i];
+		if (acc >= threshold)
+			return i;
+	}
+
+	GP_BUG("Threshold not reached");
+	return 0;
+}
+
+static inline void hist_clear(unsigned int *hist, unsigned int size)
+{
+	memset(hist, 0, sizeof(unsigned int) * size);
+}
+
+static inline unsigned int get_weight(gp_median_weights *weights,
+                                      unsigned int x, unsigned int y)
+{
+	return weights->weights[y * weights->w + x];
+}
+
+static int weighted_median_xRGB8888(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_xRGB8888(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_xRGB8888(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_xRGB8888(pix);
+		}
+	}
+
+	unsigned int hist_R[256];
+	unsigned int hist_G[256];
+	unsigned int hist_B[256];
+
+	hist_clear(hist_R, 256);
+	hist_clear(hist_G, 256);
+	hist_clear(hist_B, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_R, R[y1 * w + x + x1], weight);
+					hist_add(hist_G, G[y1 * w + x + x1], weight);
+					hist_add(hist_B, B[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_R = hist_med(hist_R, 256, sum/2);
+			unsigned int med_G = hist_med(hist_G, 256, sum/2);
+			unsigned int med_B = hist_med(hist_B, 256, sum/2);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_xRGB8888(med_R, med_G, med_B));
+
+			hist_clear(hist_R, 256);
+			hist_clear(hist_G, 256);
+			hist_clear(hist_B, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[y1 * w + x] = GP_PIXEL_GET_R_xRGB8888(pix);
+				G[y1 * w + x] = GP_PIXEL_GET_G_xRGB8888(pix);
+				B[y1 * w + x] = GP_PIXEL_GET_B_xRGB8888(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_RGBA8888(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 4 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *A = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGBA8888(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGBA8888(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGBA8888(pix);
+			A[y * w + x] = GP_PIXEL_GET_A_RGBA8888(pix);
+		}
+	}
+
+	unsigned int hist_R[256];
+	unsigned int hist_G[256];
+	unsigned int hist_B[256];
+	unsigned int hist_A[256];
+
+	hist_clear(hist_R, 256);
+	hist_clear(hist_G, 256);
+	hist_clear(hist_B, 256);
+	hist_clear(hist_A, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_R, R[y1 * w + x + x1], weight);
+					hist_add(hist_G, G[y1 * w + x + x1], weight);
+					hist_add(hist_B, B[y1 * w + x + x1], weight);
+					hist_add(hist_A, A[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_R = hist_med(hist_R, 256, sum/2);
+			unsigned int med_G = hist_med(hist_G, 256, sum/2);
+			unsigned int med_B = hist_med(hist_B, 256, sum/2);
+			unsigned int med_A = hist_med(hist_A, 256, sum/2);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGBA8888(med_R, med_G, med_B, med_A));
+
+			hist_clear(hist_R, 256);
+			hist_clear(hist_G, 256);
+			hist_clear(hist_B, 256);
+			hist_clear(hist_A, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[y1 * w + x] = GP_PIXEL_GET_R_RGBA8888(pix);
+				G[y1 * w + x] = GP_PIXEL_GET_G_RGBA8888(pix);
+				B[y1 * w + x] = GP_PIXEL_GET_B_RGBA8888(pix);
+				A[y1 * w + x] = GP_PIXEL_GET_A_RGBA8888(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_RGB888(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB888(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB888(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB888(pix);
+		}
+	}
+
+	unsigned int hist_R[256];
+	unsigned int hist_G[256];
+	unsigned int hist_B[256];
+
+	hist_clear(hist_R, 256);
+	hist_clear(hist_G, 256);
+	hist_clear(hist_B, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_R, R[y1 * w + x + x1], weight);
+					hist_add(hist_G, G[y1 * w + x + x1], weight);
+					hist_add(hist_B, B[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_R = hist_med(hist_R, 256, sum/2);
+			unsigned int med_G = hist_med(hist_G, 256, sum/2);
+			unsigned int med_B = hist_med(hist_B, 256, sum/2);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB888(med_R, med_G, med_B));
+
+			hist_clear(hist_R, 256);
+			hist_clear(hist_G, 256);
+			hist_clear(hist_B, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+				R[y1 * w + x] = GP_PIXEL_GET_R_RGB888(pix);
+				G[y1 * w + x] = GP_PIXEL_GET_G_RGB888(pix);
+				B[y1 * w + x] = GP_PIXEL_GET_B_RGB888(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_BGR888(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			B[y * w + x] = GP_PIXEL_GET_B_BGR888(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_BGR888(pix);
+			R[y * w + x] = GP_PIXEL_GET_R_BGR888(pix);
+		}
+	}
+
+	unsigned int hist_B[256];
+	unsigned int hist_G[256];
+	unsigned int hist_R[256];
+
+	hist_clear(hist_B, 256);
+	hist_clear(hist_G, 256);
+	hist_clear(hist_R, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_B, B[y1 * w + x + x1], weight);
+					hist_add(hist_G, G[y1 * w + x + x1], weight);
+					hist_add(hist_R, R[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_B = hist_med(hist_B, 256, sum/2);
+			unsigned int med_G = hist_med(hist_G, 256, sum/2);
+			unsigned int med_R = hist_med(hist_R, 256, sum/2);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_BGR888(med_B, med_G, med_R));
+
+			hist_clear(hist_B, 256);
+			hist_clear(hist_G, 256);
+			hist_clear(hist_R, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+				B[y1 * w + x] = GP_PIXEL_GET_B_BGR888(pix);
+				G[y1 * w + x] = GP_PIXEL_GET_G_BGR888(pix);
+				R[y1 * w + x] = GP_PIXEL_GET_R_BGR888(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_RGB555(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB555(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB555(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB555(pix);
+		}
+	}
+
+	unsigned int hist_R[256];
+	unsigned int hist_G[256];
+	unsigned int hist_B[256];
+
+	hist_clear(hist_R, 256);
+	hist_clear(hist_G, 256);
+	hist_clear(hist_B, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_R, R[y1 * w + x + x1], weight);
+					hist_add(hist_G, G[y1 * w + x + x1], weight);
+					hist_add(hist_B, B[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_R = hist_med(hist_R, 256, sum/2);
+			unsigned int med_G = hist_med(hist_G, 256, sum/2);
+			unsigned int med_B = hist_med(hist_B, 256, sum/2);
+
+			gp_putpixel_raw_16BPP_BE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB555(med_R, med_G, med_B));
+
+			hist_clear(hist_R, 256);
+			hist_clear(hist_G, 256);
+			hist_clear(hist_B, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+				R[y1 * w + x] = GP_PIXEL_GET_R_RGB555(pix);
+				G[y1 * w + x] = GP_PIXEL_GET_G_RGB555(pix);
+				B[y1 * w + x] = GP_PIXEL_GET_B_RGB555(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_RGB565_BE(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB565_BE(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB565_BE(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB565_BE(pix);
+		}
+	}
+
+	unsigned int hist_R[256];
+	unsigned int hist_G[256];
+	unsigned int hist_B[256];
+
+	hist_clear(hist_R, 256);
+	hist_clear(hist_G, 256);
+	hist_clear(hist_B, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_R, R[y1 * w + x + x1], weight);
+					hist_add(hist_G, G[y1 * w + x + x1], weight);
+					hist_add(hist_B, B[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_R = hist_med(hist_R, 256, sum/2);
+			unsigned int med_G = hist_med(hist_G, 256, sum/2);
+			unsigned int med_B = hist_med(hist_B, 256, sum/2);
+
+			gp_putpixel_raw_16BPP_BE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB565_BE(med_R, med_G, med_B));
+
+			hist_clear(hist_R, 256);
+			hist_clear(hist_G, 256);
+			hist_clear(hist_B, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_16BPP_BE(src, xi, yi);
+
+				R[y1 * w + x] = GP_PIXEL_GET_R_RGB565_BE(pix);
+				G[y1 * w + x] = GP_PIXEL_GET_G_RGB565_BE(pix);
+				B[y1 * w + x] = GP_PIXEL_GET_B_RGB565_BE(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_RGB565_LE(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB565_LE(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB565_LE(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB565_LE(pix);
+		}
+	}
+
+	unsigned int hist_R[256];
+	unsigned int hist_G[256];
+	unsigned int hist_B[256];
+
+	hist_clear(hist_R, 256);
+	hist_clear(hist_G, 256);
+	hist_clear(hist_B, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_R, R[y1 * w + x + x1], weight);
+					hist_add(hist_G, G[y1 * w + x + x1], weight);
+					hist_add(hist_B, B[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_R = hist_med(hist_R, 256, sum/2);
+			unsigned int med_G = hist_med(hist_G, 256, sum/2);
+			unsigned int med_B = hist_med(hist_B, 256, sum/2);
+
+			gp_putpixel_raw_16BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB565_LE(med_R, med_G, med_B));
+
+			hist_clear(hist_R, 256);
+			hist_clear(hist_G, 256);
+			hist_clear(hist_B, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+				R[y1 * w + x] = GP_PIXEL_GET_R_RGB565_LE(pix);
+				G[y1 * w + x] = GP_PIXEL_GET_G_RGB565_LE(pix);
+				B[y1 * w + x] = GP_PIXEL_GET_B_RGB565_LE(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_RGB666(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB666(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB666(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB666(pix);
+		}
+	}
+
+	unsigned int hist_R[256];
+	unsigned int hist_G[256];
+	unsigned int hist_B[256];
+
+	hist_clear(hist_R, 256);
+	hist_clear(hist_G, 256);
+	hist_clear(hist_B, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_R, R[y1 * w + x + x1], weight);
+					hist_add(hist_G, G[y1 * w + x + x1], weight);
+					hist_add(hist_B, B[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_R = hist_med(hist_R, 256, sum/2);
+			unsigned int med_G = hist_med(hist_G, 256, sum/2);
+			unsigned int med_B = hist_med(hist_B, 256, sum/2);
+
+			gp_putpixel_raw_18BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB666(med_R, med_G, med_B));
+
+			hist_clear(hist_R, 256);
+			hist_clear(hist_G, 256);
+			hist_clear(hist_B, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_18BPP_DB(src, xi, yi);
+
+				R[y1 * w + x] = GP_PIXEL_GET_R_RGB666(pix);
+				G[y1 * w + x] = GP_PIXEL_GET_G_RGB666(pix);
+				B[y1 * w + x] = GP_PIXEL_GET_B_RGB666(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_RGB332(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+
+	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			R[y * w + x] = GP_PIXEL_GET_R_RGB332(pix);
+			G[y * w + x] = GP_PIXEL_GET_G_RGB332(pix);
+			B[y * w + x] = GP_PIXEL_GET_B_RGB332(pix);
+		}
+	}
+
+	unsigned int hist_R[256];
+	unsigned int hist_G[256];
+	unsigned int hist_B[256];
+
+	hist_clear(hist_R, 256);
+	hist_clear(hist_G, 256);
+	hist_clear(hist_B, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_R, R[y1 * w + x + x1], weight);
+					hist_add(hist_G, G[y1 * w + x + x1], weight);
+					hist_add(hist_B, B[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_R = hist_med(hist_R, 256, sum/2);
+			unsigned int med_G = hist_med(hist_G, 256, sum/2);
+			unsigned int med_B = hist_med(hist_B, 256, sum/2);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB332(med_R, med_G, med_B));
+
+			hist_clear(hist_R, 256);
+			hist_clear(hist_G, 256);
+			hist_clear(hist_B, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+				R[y1 * w + x] = GP_PIXEL_GET_R_RGB332(pix);
+				G[y1 * w + x] = GP_PIXEL_GET_G_RGB332(pix);
+				B[y1 * w + x] = GP_PIXEL_GET_B_RGB332(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_CMYK8888(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 4 * size * sizeof(unsigned int));
+
+	unsigned int *K = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *Y = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *M = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *C = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			K[y * w + x] = GP_PIXEL_GET_K_CMYK8888(pix);
+			Y[y * w + x] = GP_PIXEL_GET_Y_CMYK8888(pix);
+			M[y * w + x] = GP_PIXEL_GET_M_CMYK8888(pix);
+			C[y * w + x] = GP_PIXEL_GET_C_CMYK8888(pix);
+		}
+	}
+
+	unsigned int hist_K[256];
+	unsigned int hist_Y[256];
+	unsigned int hist_M[256];
+	unsigned int hist_C[256];
+
+	hist_clear(hist_K, 256);
+	hist_clear(hist_Y, 256);
+	hist_clear(hist_M, 256);
+	hist_clear(hist_C, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_K, K[y1 * w + x + x1], weight);
+					hist_add(hist_Y, Y[y1 * w + x + x1], weight);
+					hist_add(hist_M, M[y1 * w + x + x1], weight);
+					hist_add(hist_C, C[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_K = hist_med(hist_K, 256, sum/2);
+			unsigned int med_Y = hist_med(hist_Y, 256, sum/2);
+			unsigned int med_M = hist_med(hist_M, 256, sum/2);
+			unsigned int med_C = hist_med(hist_C, 256, sum/2);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_CMYK8888(med_K, med_Y, med_M, med_C));
+
+			hist_clear(hist_K, 256);
+			hist_clear(hist_Y, 256);
+			hist_clear(hist_M, 256);
+			hist_clear(hist_C, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				K[y1 * w + x] = GP_PIXEL_GET_K_CMYK8888(pix);
+				Y[y1 * w + x] = GP_PIXEL_GET_Y_CMYK8888(pix);
+				M[y1 * w + x] = GP_PIXEL_GET_M_CMYK8888(pix);
+				C[y1 * w + x] = GP_PIXEL_GET_C_CMYK8888(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_G1_DB(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G1_DB(pix);
+		}
+	}
+
+	unsigned int hist_V[256];
+
+	hist_clear(hist_V, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_V, V[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_V = hist_med(hist_V, 256, sum/2);
+
+			gp_putpixel_raw_1BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G1_DB(med_V));
+
+			hist_clear(hist_V, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_1BPP_DB(src, xi, yi);
+
+				V[y1 * w + x] = GP_PIXEL_GET_V_G1_DB(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_G2_DB(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G2_DB(pix);
+		}
+	}
+
+	unsigned int hist_V[256];
+
+	hist_clear(hist_V, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_V, V[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_V = hist_med(hist_V, 256, sum/2);
+
+			gp_putpixel_raw_2BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G2_DB(med_V));
+
+			hist_clear(hist_V, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_2BPP_DB(src, xi, yi);
+
+				V[y1 * w + x] = GP_PIXEL_GET_V_G2_DB(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_G4_DB(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G4_DB(pix);
+		}
+	}
+
+	unsigned int hist_V[256];
+
+	hist_clear(hist_V, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_V, V[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_V = hist_med(hist_V, 256, sum/2);
+
+			gp_putpixel_raw_4BPP_DB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G4_DB(med_V));
+
+			hist_clear(hist_V, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_4BPP_DB(src, xi, yi);
+
+				V[y1 * w + x] = GP_PIXEL_GET_V_G4_DB(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_G1_UB(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G1_UB(pix);
+		}
+	}
+
+	unsigned int hist_V[256];
+
+	hist_clear(hist_V, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_V, V[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_V = hist_med(hist_V, 256, sum/2);
+
+			gp_putpixel_raw_1BPP_UB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G1_UB(med_V));
+
+			hist_clear(hist_V, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_1BPP_UB(src, xi, yi);
+
+				V[y1 * w + x] = GP_PIXEL_GET_V_G1_UB(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_G2_UB(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G2_UB(pix);
+		}
+	}
+
+	unsigned int hist_V[256];
+
+	hist_clear(hist_V, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_V, V[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_V = hist_med(hist_V, 256, sum/2);
+
+			gp_putpixel_raw_2BPP_UB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G2_UB(med_V));
+
+			hist_clear(hist_V, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_2BPP_UB(src, xi, yi);
+
+				V[y1 * w + x] = GP_PIXEL_GET_V_G2_UB(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_G4_UB(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G4_UB(pix);
+		}
+	}
+
+	unsigned int hist_V[256];
+
+	hist_clear(hist_V, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_V, V[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_V = hist_med(hist_V, 256, sum/2);
+
+			gp_putpixel_raw_4BPP_UB(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G4_UB(med_V));
+
+			hist_clear(hist_V, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_4BPP_UB(src, xi, yi);
+
+				V[y1 * w + x] = GP_PIXEL_GET_V_G4_UB(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_G8(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 1 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_G8(pix);
+		}
+	}
+
+	unsigned int hist_V[256];
+
+	hist_clear(hist_V, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_V, V[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_V = hist_med(hist_V, 256, sum/2);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G8(med_V));
+
+			hist_clear(hist_V, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+				V[y1 * w + x] = GP_PIXEL_GET_V_G8(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median_GA88(const gp_pixmap *src,
+                                         gp_coord x_src, gp_coord y_src,
+                                         gp_size w_src, gp_size h_src,
+                                         gp_pixmap *dst,
+                                         gp_coord x_dst, gp_coord y_dst,
+                                         gp_median_weights *weights,
+                                         gp_progress_cb *callback)
+{
+	int x, y, sum = sum_weights(weights);
+	unsigned int x1, y1;
+
+	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
+	            w_src, h_src, weights->w, weights->h, sum);
+
+	unsigned int w = w_src +  weights->w;
+	unsigned int size = w * weights->h;
+
+	gp_temp_alloc_create(temp, 2 * size * sizeof(unsigned int));
+
+	unsigned int *V = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+	unsigned int *A = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+
+	/* prefil the sampled array */
+	for (x = 0; x < (int)w; x++) {
+		int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+		for (y = 0; y < (int)weights->h; y++) {
+			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+			V[y * w + x] = GP_PIXEL_GET_V_GA88(pix);
+			A[y * w + x] = GP_PIXEL_GET_A_GA88(pix);
+		}
+	}
+
+	unsigned int hist_V[256];
+	unsigned int hist_A[256];
+
+	hist_clear(hist_V, 256);
+	hist_clear(hist_A, 256);
+
+	/* Apply the weighted median filter */
+	for (y = 0; y < (int)h_src; y++) {
+		for (x = 0; x < (int)w_src; x++) {
+			/* compute weighted histogram and then median */
+			for (x1 = 0; x1 < weights->w; x1++) {
+				for (y1 = 0; y1 < weights->h; y1++) {
+					unsigned int weight = get_weight(weights, x1, y1);
+					hist_add(hist_V, V[y1 * w + x + x1], weight);
+					hist_add(hist_A, A[y1 * w + x + x1], weight);
+				}
+			}
+
+			unsigned int med_V = hist_med(hist_V, 256, sum/2);
+			unsigned int med_A = hist_med(hist_A, 256, sum/2);
+
+			gp_putpixel_raw_16BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_GA88(med_V, med_A));
+
+			hist_clear(hist_V, 256);
+			hist_clear(hist_A, 256);
+		}
+
+		for (x = 0; x < (int)w; x++) {
+			int xi = GP_CLAMP(x_src + x - (int)weights->w/2, 0, (int)src->w - 1);
+
+			for (y1 = 0; y1 < weights->h; y1++) {
+				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
+
+				gp_pixel pix = gp_getpixel_raw_16BPP_LE(src, xi, yi);
+
+				V[y1 * w + x] = GP_PIXEL_GET_V_GA88(pix);
+				A[y1 * w + x] = GP_PIXEL_GET_A_GA88(pix);
+			}
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+static int weighted_median(const gp_pixmap *src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           gp_pixmap *dst,
+                           gp_coord x_dst, gp_coord y_dst,
+                           gp_median_weights *weights,
+                           gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return weighted_median_xRGB8888(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_RGBA8888:
+		return weighted_median_RGBA8888(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_RGB888:
+		return weighted_median_RGB888(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_BGR888:
+		return weighted_median_BGR888(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_RGB555:
+		return weighted_median_RGB555(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_RGB565_BE:
+		return weighted_median_RGB565_BE(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_RGB565_LE:
+		return weighted_median_RGB565_LE(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_RGB666:
+		return weighted_median_RGB666(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_RGB332:
+		return weighted_median_RGB332(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_CMYK8888:
+		return weighted_median_CMYK8888(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_G1_DB:
+		return weighted_median_G1_DB(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_G2_DB:
+		return weighted_median_G2_DB(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_G4_DB:
+		return weighted_median_G4_DB(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_G1_UB:
+		return weighted_median_G1_UB(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_G2_UB:
+		return weighted_median_G2_UB(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_G4_UB:
+		return weighted_median_G4_UB(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_G8:
+		return weighted_median_G8(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	case GP_PIXEL_GA88:
+		return weighted_median_GA88(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+	default:
+		errno = ENOSYS;
+		return -1;
+	}
+}
+
+/*
+ * The strips read the halo of weights->w columns from the source so the
+ * result does not depend on the number of threads.
+ */
+#ifdef HAVE_PTHREAD
+struct weighted_median_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	gp_median_weights *weights;
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
+
+static void *weighted_median_thread(void *arg)
+{
+	struct weighted_median_args *a = arg;
+
+	a->ret = weighted_median(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  a->weights, a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int weighted_median_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       gp_median_weights *weights,
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+	t = GP_MIN(t, w_src);
+
+	if (t <= 1) {
+		return weighted_median(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, weights, callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct weighted_median_args args[t];
+	char started[t];
+	gp_size w = w_src / t;
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct weighted_median_args) {
+			.src = src,
+			.x_src = x_src + i * w,
+			.y_src = y_src,
+			.w_src = i == t - 1 ? w_src - i * w : w,
+			.h_src = h_src,
+			.dst = dst,
+			.x_dst = x_dst + i * w,
+			.y_dst = y_dst,
+			.weights = weights,
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, weighted_median_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			weighted_median_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+#else
+static int weighted_median_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       gp_median_weights *weights,
+                       gp_progress_cb *callback)
+{
+	return weighted_median(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, weights, callback);
+}
+#endif /* HAVE_PTHREAD */
+
+int gp_filter_weighted_median_ex(const gp_pixmap *src,
+                                 gp_coord x_src, gp_coord y_src,
+                                 gp_size w_src, gp_size h_src,
+                                 gp_pixmap *dst,
+                                 gp_coord x_dst, gp_coord y_dst,
+                                 gp_median_weights *weights,
+                                 gp_progress_cb *callback)
+{
+	GP_CHECK(src->pixel_type == dst->pixel_type);
+
+	/* Check that destination is large enough */
+	GP_CHECK(x_dst + (gp_coord)w_src <= (gp_coord)dst->w);
+	GP_CHECK(y_dst + (gp_coord)h_src <= (gp_coord)dst->h);
+
+	//GP_CHECK(xmed >= 0 && ymed >= 0);
+
+	return weighted_median_mp(src, x_src, y_src, w_src, h_src,
+	                          dst, x_dst, y_dst, weights, callback);
+}
+
+gp_pixmap *gp_filter_weighted_median_ex_alloc(const gp_pixmap *src,
+                                              gp_coord x_src, gp_coord y_src,
+                                              gp_size w_src, gp_size h_src,
+                                              gp_median_weights *weights,
+                                              gp_progress_cb *callback)
+{
+	int ret;
+
+	//GP_CHECK(xmed >= 0 && ymed >= 0);
+
+	gp_pixmap *dst = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (dst == NULL)
+		return NULL;
+
+	ret = weighted_median_mp(src, x_src, y_src, w_src, h_src,
+	                         dst, 0, 0, weights, callback);
+
+	if (ret) {
+		gp_pixmap_free(dst);
+		return NULL;
+	}
+
+	return dst;
+}
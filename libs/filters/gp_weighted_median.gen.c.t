@@ -1,19 +1,24 @@
-// SPDX-License-Identifier: LGPL-2.1-or-later
+@ include source.t
+@ include thread_dispatcher.t
 /*
- * Copyright (C) 2009-2013 Cyril Hrubis <metan@ucw.cz>
+ * Weighted median filter
+ *
+ * Copyright (C) 2009-2026 Cyril Hrubis <metan@ucw.cz>
  */
 
 #include <errno.h>
 #include <string.h>
 
-#include "core/gp_pixmap.h"
+#include "../../config.h"
+
+#include <core/gp_pixmap.h>
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_temp_alloc.h>
 #include <core/gp_clamp.h>
+#include <core/gp_threads.h>
 #include <core/gp_debug.h>
 #include <filters/gp_weighted_median.h>
 
-
 static unsigned int sum_weights(gp_median_weights *weights)
 {
 	unsigned int i;
@@ -58,7 +63,19 @@ static inline unsigned int get_weight(gp_median_weights *weights,
 	return weights->weights[y * weights->w + x];
 }
 
-static int gp_filter_weighted_median_raw(const gp_pixmap *src,
+@ # The histograms have 256 entries, channels up to 8 bits are supported
+@ def median_supported(pt):
+@     if pt.is_unknown() or pt.is_palette():
+@         return False
+@     for c in pt.chanslist:
+@         if c.size > 8:
+@             return False
+@     return True
+@ end
+@
+@ for pt in pixeltypes:
+@     if median_supported(pt):
+static int weighted_median_{{ pt.name }}(const gp_pixmap *src,
                                          gp_coord x_src, gp_coord y_src,
                                          gp_size w_src, gp_size h_src,
                                          gp_pixmap *dst,
@@ -69,22 +86,17 @@ static int gp_filter_weighted_median_raw(const gp_pixmap *src,
 	int x, y, sum = sum_weights(weights);
 	unsigned int x1, y1;
 
-	if (src->pixel_type != GP_PIXEL_RGB888) {
-		errno = ENOSYS;
-		return -1;
-	}
-
 	GP_DEBUG(1, "Weighted Median filter size %ux%u xmed=%u ymed=%u sum=%u",
 	            w_src, h_src, weights->w, weights->h, sum);
 
 	unsigned int w = w_src +  weights->w;
 	unsigned int size = w * weights->h;
 
-	gp_temp_alloc_create(temp, 3 * size * sizeof(unsigned int));
+	gp_temp_alloc_create(temp, {{ pt.chan_cnt }} * size * sizeof(unsigned int));
 
-	unsigned int *R = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
-	unsigned int *G = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
-	unsigned int *B = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+@         for c in pt.chanslist:
+	unsigned int *{{ c.name }} = gp_temp_alloc_get(temp, size * sizeof(unsigned int));
+@         end
 
 	/* prefil the sampled array */
 	for (x = 0; x < (int)w; x++) {
@@ -93,21 +105,21 @@ static int gp_filter_weighted_median_raw(const gp_pixmap *src,
 		for (y = 0; y < (int)weights->h; y++) {
 			int yi = GP_CLAMP(y_src + y - (int)weights->h, 0, (int)src->h - 1);
 
-			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+			gp_pixel pix = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, xi, yi);
 
-			R[y * w + x] = GP_PIXEL_GET_R_RGB888(pix);
-			G[y * w + x] = GP_PIXEL_GET_G_RGB888(pix);
-			B[y * w + x] = GP_PIXEL_GET_B_RGB888(pix);
+@         for c in pt.chanslist:
+			{{ c.name }}[y * w + x] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+@         end
 		}
 	}
 
-	unsigned int hist_R[256];
-	unsigned int hist_G[256];
-	unsigned int hist_B[256];
+@         for c in pt.chanslist:
+	unsigned int hist_{{ c.name }}[256];
+@         end
 
-	hist_clear(hist_R, 256);
-	hist_clear(hist_G, 256);
-	hist_clear(hist_B, 256);
+@         for c in pt.chanslist:
+	hist_clear(hist_{{ c.name }}, 256);
+@         end
 
 	/* Apply the weighted median filter */
 	for (y = 0; y < (int)h_src; y++) {
@@ -116,22 +128,22 @@ static int gp_filter_weighted_median_raw(const gp_pixmap *src,
 			for (x1 = 0; x1 < weights->w; x1++) {
 				for (y1 = 0; y1 < weights->h; y1++) {
 					unsigned int weight = get_weight(weights, x1, y1);
-					hist_add(hist_R, R[y1 * w + x + x1], weight);
-					hist_add(hist_G, G[y1 * w + x + x1], weight);
-					hist_add(hist_B, B[y1 * w + x + x1], weight);
+@         for c in pt.chanslist:
+					hist_add(hist_{{ c.name }}, {{ c.name }}[y1 * w + x + x1], weight);
+@         end
 				}
 			}
 
-			unsigned int r = hist_med(hist_R, 256, sum/2);
-			unsigned int g = hist_med(hist_G, 256, sum/2);
-			unsigned int b = hist_med(hist_B, 256, sum/2);
+@         for c in pt.chanslist:
+			unsigned int med_{{ c.name }} = hist_med(hist_{{ c.name }}, 256, sum/2);
+@         end
 
-			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
-			                      GP_PIXEL_CREATE_RGB888(r, g, b));
+			gp_putpixel_raw_{{ pt.pixelpack.suffix }}(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names, 'med_') }}));
 
-			hist_clear(hist_R, 256);
-			hist_clear(hist_G, 256);
-			hist_clear(hist_B, 256);
+@         for c in pt.chanslist:
+			hist_clear(hist_{{ c.name }}, 256);
+@         end
 		}
 
 		for (x = 0; x < (int)w; x++) {
@@ -140,11 +152,11 @@ static int gp_filter_weighted_median_raw(const gp_pixmap *src,
 			for (y1 = 0; y1 < weights->h; y1++) {
 				int yi = GP_CLAMP(y_src + y + (int)y1 - (int)weights->h/2, 0, (int)src->h - 1);
 
-				gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+				gp_pixel pix = gp_getpixel_raw_{{ pt.pixelpack.suffix }}(src, xi, yi);
 
-				R[y1 * w + x] = GP_PIXEL_GET_R_RGB888(pix);
-				G[y1 * w + x] = GP_PIXEL_GET_G_RGB888(pix);
-				B[y1 * w + x] = GP_PIXEL_GET_B_RGB888(pix);
+@         for c in pt.chanslist:
+				{{ c.name }}[y1 * w + x] = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+@         end
 			}
 		}
 
@@ -160,6 +172,34 @@ static int gp_filter_weighted_median_raw(const gp_pixmap *src,
 	return 0;
 }
 
+@ end
+static int weighted_median(const gp_pixmap *src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           gp_pixmap *dst,
+                           gp_coord x_dst, gp_coord y_dst,
+                           gp_median_weights *weights,
+                           gp_progress_cb *callback)
+{
+	switch (src->pixel_type) {
+@ for pt in pixeltypes:
+@     if median_supported(pt):
+	case GP_PIXEL_{{ pt.name }}:
+		return weighted_median_{{ pt.name }}(src, x_src, y_src, w_src, h_src,
+		                                     dst, x_dst, y_dst, weights, callback);
+@ end
+	default:
+		errno = ENOSYS;
+		return -1;
+	}
+}
+
+/*
+ * The strips read the halo of weights->w columns from the source so the
+ * result does not depend on the number of threads.
+ */
+{@ dispatcher('weighted_median', [['gp_median_weights *', 'weights']], True) @}
+
 int gp_filter_weighted_median_ex(const gp_pixmap *src,
                                  gp_coord x_src, gp_coord y_src,
                                  gp_size w_src, gp_size h_src,
@@ -176,8 +216,8 @@ int gp_filter_weighted_median_ex(const gp_pixmap *src,
 
 	//GP_CHECK(xmed >= 0 && ymed >= 0);
 
-	return gp_filter_weighted_median_raw(src, x_src, y_src, w_src, h_src,
-	                                     dst, x_dst, y_dst, weights, callback);
+	return weighted_median_mp(src, x_src, y_src, w_src, h_src,
+	                          dst, x_dst, y_dst, weights, callback);
 }
 
 gp_pixmap *gp_filter_weighted_median_ex_alloc(const gp_pixmap *src,
@@ -195,8 +235,8 @@ gp_pixmap *gp_filter_weighted_median_ex_alloc(const gp_pixmap *src,
 	if (dst == NULL)
 		return NULL;
 
-	ret = gp_filter_weighted_median_raw(src, x_src, y_src, w_src, h_src,
-	                                    dst, 0, 0, weights, callback);
+	ret = weighted_median_mp(src, x_src, y_src, w_src, h_src,
+	                         dst, 0, 0, weights, callback);
 
 	if (ret) {
 		gp_pixmap_free(dst);
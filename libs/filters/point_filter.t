@@ -1,4 +1,20 @@
-@ def filter_point_ex(op_name, filter_op, fopts):
+@ def filter_point_chain(op_name, filter_op, fopts):
+void gp_point_chain_{{ op_name }}(gp_point_chain *self{{ maybe_opts_l(fopts) }})
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(self->pixel_type);
+	unsigned int i;
+	gp_pixel j;
+
+	for (i = 0; i < desc->numchannels; i++) {
+		gp_pixel chan_max = (1 << desc->channels[i].size);
+		gp_pixel *table = self->tables.table[i];
+
+		for (j = 0; j < chan_max; j++)
+			table[j] = {@ filter_op('((signed)table[j])', '((signed)chan_max - 1)') @};
+	}
+}
+@
+@ def filter_point_ex(op_name, fopts, opts):
 int gp_filter_{{ op_name }}_ex(const gp_pixmap *const src,
                                gp_coord x_src, gp_coord y_src,
                                gp_size w_src, gp_size h_src,
@@ -7,35 +23,23 @@ int gp_filter_{{ op_name }}_ex(const gp_pixmap *const src,
                                {{ maybe_opts_r(fopts) }}
                                gp_progress_cb *callback)
 {
-	const gp_pixel_type_desc *desc;
-	gp_filter_tables tables;
-	unsigned int i;
-	gp_pixel j;
+	gp_point_chain chain;
 	int ret, err;
 
-	if (gp_filter_tables_init(&tables, src))
+	if (gp_point_chain_init(&chain, src->pixel_type))
 		return 1;
 
-	desc = gp_pixel_desc(src->pixel_type);
-
-	for (i = 0; i < desc->numchannels; i++) {
-		gp_pixel chan_max = (1 << desc->channels[i].size);
-		gp_pixel *table = tables.table[i];
-
-		for (j = 0; j < chan_max; j++)
-			table[j] = {@ filter_op('((signed)j)', '((signed)chan_max - 1)') @};
-	}
+	gp_point_chain_{{ op_name }}(&chain{{ maybe_opts_l(opts) }});
 
-	ret = gp_filter_tables_apply(src, x_src, y_src, w_src, h_src,
-	                             dst, x_dst, y_dst, &tables, callback);
+	ret = gp_point_chain_apply_ex(src, x_src, y_src, w_src, h_src,
+	                              dst, x_dst, y_dst, &chain, callback);
 
 	err = errno;
-	gp_filter_tables_free(&tables);
+	gp_point_chain_exit(&chain);
 	errno = err;
 
 	return ret;
 }
-@
 @ def filter_point_ex_alloc(op_name, fopts, opts):
 gp_pixmap *gp_filter_{{ op_name }}_ex_alloc(const gp_pixmap *const src,
                                             gp_coord x_src, gp_coord y_src,
@@ -61,9 +65,10 @@ gp_pixmap *gp_filter_{{ op_name }}_ex_alloc(const gp_pixmap *const src,
 
 #include <core/gp_debug.h>
 
-#include <filters/gp_apply_tables.h>
+#include <filters/gp_point_chain.h>
 #include <filters/gp_point.h>
 
-{@ filter_point_ex(op_name, filter_op, fopts) @}
+{@ filter_point_chain(op_name, filter_op, fopts) @}
+{@ filter_point_ex(op_name, fopts, opts) @}
 {@ filter_point_ex_alloc(op_name, fopts, opts) @}
 @ end
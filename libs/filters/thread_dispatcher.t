@@ -1,8 +1,158 @@
-#
-# Generator for filter thread dispatcher code, licenced under LGPLv2+
-#
-# Copyright (c) 2018 Cyril Hrubis <metan@ucw.cz>
-#
-@ def dispatcher(fn_params):
+@ # Generator for filter thread dispatcher code, licenced under LGPLv2+
+@ #
+@ # Copyright (c) 2018-2026 Cyril Hrubis <metan@ucw.cz>
+@ #
+@ # Generates a fn_mp() function that splits the rectangle into horizontal
+@ # stripes, or vertical strips if vertical is set, and runs fn() on each of
+@ # them in a separate thread.
+@ #
+@ # The fn() has to have the point filter signature, i.e.
+@ #
+@ # fn(src, x_src, y_src, w_src, h_src, dst, x_dst, y_dst, opts..., callback)
+@ #
+@ # and has to read the source pixels it needs outside of the rectangle, i.e.
+@ # the halo, on its own. The opts is a list of [type, name] pairs. Needs
+@ # config.h and core/gp_threads.h included.
+@ #
+@ # If done is False the fn_mp() does not call gp_progress_cb_done() after the
+@ # threads finished, the fn() does not call it either and the caller has to
+@ # call it once the whole operation is finished.
+@ #
+@ def dispatcher(fn, opts=[], vertical=False, done=True):
+@     opt_names = [o[1] for o in opts]
+@     opt_decls = [(o[0] + ' ' + o[1]).replace('* ', '*') for o in opts]
+#ifdef HAVE_PTHREAD
+struct {{ fn }}_args {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+@     for o in opts:
+	{{ (o[0] + ' ' + o[1]).replace('* ', '*') }};
+@     end
+	gp_progress_cb *callback;
+	int ret;
+	int err;
+};
 
+static void *{{ fn }}_thread(void *arg)
+{
+	struct {{ fn }}_args *a = arg;
 
+	a->ret = {{ fn }}(a->src, a->x_src, a->y_src, a->w_src, a->h_src,
+	                  a->dst, a->x_dst, a->y_dst,
+	                  {{ maybe_opts_r(arr_to_params(opt_names, 'a->')) }} a->callback);
+	a->err = errno;
+
+	return NULL;
+}
+
+static int {{ fn }}_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       {{ maybe_opts_r(', '.join(opt_decls)) }}
+                       gp_progress_cb *callback)
+{
+	unsigned int i, t = gp_nr_threads(w_src, h_src, callback);
+	int ret = 0, err = 0;
+
+	/* Threads would overwrite rows that other threads have yet to read */
+	if (src == dst && (x_src != x_dst || y_src != y_dst)) {
+		GP_DEBUG(1, "Overlapping in-place filter, running in one thread.");
+		t = 1;
+	}
+
+@     if vertical:
+	t = GP_MIN(t, w_src);
+@     else:
+	t = GP_MIN(t, h_src);
+@     end
+
+	if (t <= 1) {
+		return {{ fn }}(src, x_src, y_src, w_src, h_src,
+		                dst, x_dst, y_dst, {{ maybe_opts_r(arr_to_params(opt_names)) }} callback);
+	}
+
+	GP_PROGRESS_CALLBACK_MP(callback_mp, callback);
+
+	pthread_t threads[t];
+	struct {{ fn }}_args args[t];
+	char started[t];
+@     if vertical:
+	gp_size w = w_src / t;
+@     else:
+	gp_size h = h_src / t;
+@     end
+
+	for (i = 0; i < t; i++) {
+		args[i] = (struct {{ fn }}_args) {
+			.src = src,
+@     if vertical:
+			.x_src = x_src + i * w,
+			.y_src = y_src,
+			.w_src = i == t - 1 ? w_src - i * w : w,
+			.h_src = h_src,
+			.dst = dst,
+			.x_dst = x_dst + i * w,
+			.y_dst = y_dst,
+@     else:
+			.x_src = x_src,
+			.y_src = y_src + i * h,
+			.w_src = w_src,
+			.h_src = i == t - 1 ? h_src - i * h : h,
+			.dst = dst,
+			.x_dst = x_dst,
+			.y_dst = y_dst + i * h,
+@     end
+@     for name in opt_names:
+			.{{ name }} = {{ name }},
+@     end
+			.callback = callback ? &callback_mp : NULL,
+		};
+
+		started[i] = !pthread_create(&threads[i], NULL, {{ fn }}_thread, &args[i]);
+
+		if (!started[i]) {
+			GP_DEBUG(1, "pthread_create() failed, running in the caller");
+			{{ fn }}_thread(&args[i]);
+		}
+	}
+
+	for (i = 0; i < t; i++) {
+		if (started[i])
+			pthread_join(threads[i], NULL);
+
+		if (args[i].ret) {
+			ret = args[i].ret;
+			err = args[i].err;
+		}
+	}
+
+	if (ret) {
+		errno = err;
+		return ret;
+	}
+@     if done:
+
+	gp_progress_cb_done(callback);
+@     end
+
+	return 0;
+}
+#else
+static int {{ fn }}_mp(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       {{ maybe_opts_r(', '.join(opt_decls)) }}
+                       gp_progress_cb *callback)
+{
+	return {{ fn }}(src, x_src, y_src, w_src, h_src,
+	                dst, x_dst, y_dst, {{ maybe_opts_r(arr_to_params(opt_names)) }} callback);
+}
+#endif /* HAVE_PTHREAD */
+@ end
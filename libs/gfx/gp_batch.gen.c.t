@@ -0,0 +1,170 @@
+@ include source.t
+/*
+ * Batch drawing functions.
+ *
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_common.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_pixel_pack.gen.h>
+
+#include <gfx/gp_hline.h>
+#include <gfx/gp_batch.h>
+
+/*
+ * The pixmap transformation flags are resolved once per batch, the
+ * coordinates are then transformed with a handful of local variables.
+ */
+struct batch_transform {
+	int axes_swap;
+	int x_swap;
+	int y_swap;
+	gp_coord w;
+	gp_coord h;
+};
+
+static inline void batch_transform_init(struct batch_transform *tr,
+                                        const gp_pixmap *pixmap)
+{
+	tr->axes_swap = pixmap->axes_swap;
+	tr->x_swap = pixmap->x_swap;
+	tr->y_swap = pixmap->y_swap;
+	tr->w = pixmap->w;
+	tr->h = pixmap->h;
+}
+
+static inline void batch_transform(const struct batch_transform *tr,
+                                   gp_coord *x, gp_coord *y)
+{
+	if (tr->axes_swap)
+		GP_SWAP(*x, *y);
+
+	if (tr->x_swap)
+		*x = tr->w - *x - 1;
+
+	if (tr->y_swap)
+		*y = tr->h - *y - 1;
+}
+
+@ for ps in pixelpacks:
+void gp_line_raw_{{ ps.suffix }}(gp_pixmap *pixmap, int x0, int y0,
+	int x1, int y1, gp_pixel pixval);
+
+static void putpixels_{{ ps.suffix }}(gp_pixmap *pixmap, size_t cnt,
+                          const gp_coord *xy, gp_pixel pixel)
+{
+	struct batch_transform tr;
+	size_t i;
+
+	batch_transform_init(&tr, pixmap);
+
+	if (!tr.axes_swap && !tr.x_swap && !tr.y_swap) {
+		for (i = 0; i < cnt; i++) {
+			gp_coord x = xy[2*i];
+			gp_coord y = xy[2*i+1];
+
+			if ((gp_size)x >= (gp_size)tr.w || (gp_size)y >= (gp_size)tr.h)
+				continue;
+
+			gp_putpixel_raw_{{ ps.suffix }}(pixmap, x, y, pixel);
+		}
+		return;
+	}
+
+	for (i = 0; i < cnt; i++) {
+		gp_coord x = xy[2*i];
+		gp_coord y = xy[2*i+1];
+
+		batch_transform(&tr, &x, &y);
+
+		if ((gp_size)x >= (gp_size)tr.w || (gp_size)y >= (gp_size)tr.h)
+			continue;
+
+		gp_putpixel_raw_{{ ps.suffix }}(pixmap, x, y, pixel);
+	}
+}
+
+static void lines_{{ ps.suffix }}(gp_pixmap *pixmap, size_t cnt,
+                      const gp_coord *xyxy, gp_pixel pixel)
+{
+	struct batch_transform tr;
+	size_t i;
+
+	batch_transform_init(&tr, pixmap);
+
+	for (i = 0; i < cnt; i++) {
+		gp_coord x0 = xyxy[4*i];
+		gp_coord y0 = xyxy[4*i+1];
+		gp_coord x1 = xyxy[4*i+2];
+		gp_coord y1 = xyxy[4*i+3];
+
+		batch_transform(&tr, &x0, &y0);
+		batch_transform(&tr, &x1, &y1);
+
+		gp_line_raw_{{ ps.suffix }}(pixmap, x0, y0, x1, y1, pixel);
+	}
+}
+
+static void fill_rects_{{ ps.suffix }}(gp_pixmap *pixmap, size_t cnt,
+                           const gp_coord *xyxy, gp_pixel pixel)
+{
+	struct batch_transform tr;
+	size_t i;
+
+	batch_transform_init(&tr, pixmap);
+
+	for (i = 0; i < cnt; i++) {
+		gp_coord x0 = xyxy[4*i];
+		gp_coord y0 = xyxy[4*i+1];
+		gp_coord x1 = xyxy[4*i+2];
+		gp_coord y1 = xyxy[4*i+3];
+		gp_coord y;
+
+		batch_transform(&tr, &x0, &y0);
+		batch_transform(&tr, &x1, &y1);
+
+		if (x0 > x1)
+			GP_SWAP(x0, x1);
+
+		if (y0 > y1)
+			GP_SWAP(y0, y1);
+
+		if (x1 < 0 || y1 < 0 || x0 >= tr.w || y0 >= tr.h)
+			continue;
+
+		x0 = GP_MAX(x0, 0);
+		y0 = GP_MAX(y0, 0);
+		x1 = GP_MIN(x1, tr.w - 1);
+		y1 = GP_MIN(y1, tr.h - 1);
+
+		for (y = y0; y <= y1; y++)
+			gp_hline_raw_{{ ps.suffix }}(pixmap, x0, x1, y, pixel);
+	}
+}
+
+@ end
+
+void gp_putpixels(gp_pixmap *pixmap, size_t cnt, const gp_coord *xy,
+                  gp_pixel pixel)
+{
+	GP_CHECK_PIXMAP(pixmap);
+
+	GP_FN_PER_PACK_PIXMAP(putpixels, pixmap, pixmap, cnt, xy, pixel);
+}
+
+void gp_lines(gp_pixmap *pixmap, size_t cnt, const gp_coord *xyxy,
+              gp_pixel pixel)
+{
+	GP_CHECK_PIXMAP(pixmap);
+
+	GP_FN_PER_PACK_PIXMAP(lines, pixmap, pixmap, cnt, xyxy, pixel);
+}
+
+void gp_fill_rects(gp_pixmap *pixmap, size_t cnt, const gp_coord *xyxy,
+                   gp_pixel pixel)
+{
+	GP_CHECK_PIXMAP(pixmap);
+
+	GP_FN_PER_PACK_PIXMAP(fill_rects, pixmap, pixmap, cnt, xyxy, pixel);
+}
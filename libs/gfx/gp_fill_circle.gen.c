@@ -0,0 +1,697 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_fill_circle.gen.c
+ *
+ * GENERATED on 2026 10 19 16:35:33 from gp_fill_circle.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * A filled circle drawing algorithm.
+ *
+ * Copyright (C) 2009-2012 Jiri "BlueBear" Dluhos
+ *                         <jiri.bluebear.dluhos@gmail.com>
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_transform.h>
+#include <core/gp_pixel_pack.gen.h>
+
+#include <gfx/gp_hline.h>
+#include <gfx/gp_circle.h>
+#include <gfx/gp_circle_seg.h>
+
+/*
+ * A filled circle drawing algorithm.
+ *
+ * A filled circle is drawn in the same way as an unfilled one,
+ * in a top-down, line per line manner, except that we don't need to draw
+ * four points in each X step. Instead, we just iterate X
+ * until we accumulate enough Y changes to reach the next line,
+ * and then draw the full line. The top and bottom half are mirrored.
+ */
+
+static void fill_circle_1BPP_DB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_clipped_1BPP_DB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+		gp_hline_raw_1BPP_DB(pixmap, xcenter-x+1, xcenter+x-1, ycenter-y, pixel);
+		gp_hline_raw_1BPP_DB(pixmap, xcenter-x+1, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+static void fill_circle_seg_1BPP_DB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_1BPP_DB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+
+		if (seg_flag & GP_CIRCLE_SEG1)
+			gp_hline_raw_1BPP_DB(pixmap, xcenter, xcenter+x-1, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG2)
+			gp_hline_raw_1BPP_DB(pixmap, xcenter-x+1, xcenter, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG3)
+			gp_hline_raw_1BPP_DB(pixmap, xcenter-x+1, xcenter, ycenter+y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG4)
+			gp_hline_raw_1BPP_DB(pixmap, xcenter, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+
+static void fill_circle_1BPP_UB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_clipped_1BPP_UB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+		gp_hline_raw_1BPP_UB(pixmap, xcenter-x+1, xcenter+x-1, ycenter-y, pixel);
+		gp_hline_raw_1BPP_UB(pixmap, xcenter-x+1, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+static void fill_circle_seg_1BPP_UB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_1BPP_UB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+
+		if (seg_flag & GP_CIRCLE_SEG1)
+			gp_hline_raw_1BPP_UB(pixmap, xcenter, xcenter+x-1, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG2)
+			gp_hline_raw_1BPP_UB(pixmap, xcenter-x+1, xcenter, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG3)
+			gp_hline_raw_1BPP_UB(pixmap, xcenter-x+1, xcenter, ycenter+y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG4)
+			gp_hline_raw_1BPP_UB(pixmap, xcenter, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+
+static void fill_circle_2BPP_DB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_clipped_2BPP_DB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+		gp_hline_raw_2BPP_DB(pixmap, xcenter-x+1, xcenter+x-1, ycenter-y, pixel);
+		gp_hline_raw_2BPP_DB(pixmap, xcenter-x+1, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+static void fill_circle_seg_2BPP_DB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_2BPP_DB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+
+		if (seg_flag & GP_CIRCLE_SEG1)
+			gp_hline_raw_2BPP_DB(pixmap, xcenter, xcenter+x-1, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG2)
+			gp_hline_raw_2BPP_DB(pixmap, xcenter-x+1, xcenter, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG3)
+			gp_hline_raw_2BPP_DB(pixmap, xcenter-x+1, xcenter, ycenter+y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG4)
+			gp_hline_raw_2BPP_DB(pixmap, xcenter, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+
+static void fill_circle_2BPP_UB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_clipped_2BPP_UB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+		gp_hline_raw_2BPP_UB(pixmap, xcenter-x+1, xcenter+x-1, ycenter-y, pixel);
+		gp_hline_raw_2BPP_UB(pixmap, xcenter-x+1, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+static void fill_circle_seg_2BPP_UB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_2BPP_UB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+
+		if (seg_flag & GP_CIRCLE_SEG1)
+			gp_hline_raw_2BPP_UB(pixmap, xcenter, xcenter+x-1, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG2)
+			gp_hline_raw_2BPP_UB(pixmap, xcenter-x+1, xcenter, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG3)
+			gp_hline_raw_2BPP_UB(pixmap, xcenter-x+1, xcenter, ycenter+y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG4)
+			gp_hline_raw_2BPP_UB(pixmap, xcenter, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+
+static void fill_circle_4BPP_DB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_clipped_4BPP_DB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+		gp_hline_raw_4BPP_DB(pixmap, xcenter-x+1, xcenter+x-1, ycenter-y, pixel);
+		gp_hline_raw_4BPP_DB(pixmap, xcenter-x+1, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+static void fill_circle_seg_4BPP_DB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_4BPP_DB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+
+		if (seg_flag & GP_CIRCLE_SEG1)
+			gp_hline_raw_4BPP_DB(pixmap, xcenter, xcenter+x-1, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG2)
+			gp_hline_raw_4BPP_DB(pixmap, xcenter-x+1, xcenter, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG3)
+			gp_hline_raw_4BPP_DB(pixmap, xcenter-x+1, xcenter, ycenter+y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG4)
+			gp_hline_raw_4BPP_DB(pixmap, xcenter, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+
+static void fill_circle_4BPP_UB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_clipped_4BPP_UB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+		gp_hline_raw_4BPP_UB(pixmap, xcenter-x+1, xcenter+x-1, ycenter-y, pixel);
+		gp_hline_raw_4BPP_UB(pixmap, xcenter-x+1, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+static void fill_circle_seg_4BPP_UB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_4BPP_UB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+
+		if (seg_flag & GP_CIRCLE_SEG1)
+			gp_hline_raw_4BPP_UB(pixmap, xcenter, xcenter+x-1, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG2)
+			gp_hline_raw_4BPP_UB(pixmap, xcenter-x+1, xcenter, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG3)
+			gp_hline_raw_4BPP_UB(pixmap, xcenter-x+1, xcenter, ycenter+y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG4)
+			gp_hline_raw_4BPP_UB(pixmap, xcenter, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+
+static void fill_circle_8BPP(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_clipped_8BPP(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+		gp_hline_raw_8BPP(pixmap, xcenter-x+1, xcenter+x-1, ycenter-y, pixel);
+		gp_hline_raw_8BPP(pixmap, xcenter-x+1, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+static void fill_circle_seg_8BPP(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_8BPP(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+
+		if (seg_flag & GP_CIRCLE_SEG1)
+			gp_hline_raw_8BPP(pixmap, xcenter, xcenter+x-1, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG2)
+			gp_hline_raw_8BPP(pixmap, xcenter-x+1, xcenter, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG3)
+			gp_hline_raw_8BPP(pixmap, xcenter-x+1, xcenter, ycenter+y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG4)
+			gp_hline_raw_8BPP(pixmap, xcenter, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+
+static void fill_circle_16BPP_LE(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_clipped_16BPP_LE(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+		gp_hline_raw_16BPP_LE(pixmap, xcenter-x+1, xcenter+x-1, ycenter-y, pixel);
+		gp_hline_raw_16BPP_LE(pixmap, xcenter-x+1, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+static void fill_circle_seg_16BPP_LE(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_16BPP_LE(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+
+		if (seg_flag & GP_CIRCLE_SEG1)
+			gp_hline_raw_16BPP_LE(pixmap, xcenter, xcenter+x-1, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG2)
+			gp_hline_raw_16BPP_LE(pixmap, xcenter-x+1, xcenter, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG3)
+			gp_hline_raw_16BPP_LE(pixmap, xcenter-x+1, xcenter, ycenter+y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG4)
+			gp_hline_raw_16BPP_LE(pixmap, xcenter, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+
+static void fill_circle_16BPP_BE(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_clipped_16BPP_BE(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+		gp_hline_raw_16BPP_BE(pixmap, xcenter-x+1, xcenter+x-1, ycenter-y, pixel);
+		gp_hline_raw_16BPP_BE(pixmap, xcenter-x+1, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+static void fill_circle_seg_16BPP_BE(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_16BPP_BE(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+
+		if (seg_flag & GP_CIRCLE_SEG1)
+			gp_hline_raw_16BPP_BE(pixmap, xcenter, xcenter+x-1, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG2)
+			gp_hline_raw_16BPP_BE(pixmap, xcenter-x+1, xcenter, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG3)
+			gp_hline_raw_16BPP_BE(pixmap, xcenter-x+1, xcenter, ycenter+y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG4)
+			gp_hline_raw_16BPP_BE(pixmap, xcenter, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+
+static void fill_circle_24BPP(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_clipped_24BPP(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+		gp_hline_raw_24BPP(pixmap, xcenter-x+1, xcenter+x-1, ycenter-y, pixel);
+		gp_hline_raw_24BPP(pixmap, xcenter-x+1, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+static void fill_circle_seg_24BPP(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_24BPP(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+
+		if (seg_flag & GP_CIRCLE_SEG1)
+			gp_hline_raw_24BPP(pixmap, xcenter, xcenter+x-1, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG2)
+			gp_hline_raw_24BPP(pixmap, xcenter-x+1, xcenter, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG3)
+			gp_hline_raw_24BPP(pixmap, xcenter-x+1, xcenter, ycenter+y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG4)
+			gp_hline_raw_24BPP(pixmap, xcenter, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+
+static void fill_circle_32BPP(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_clipped_32BPP(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+		gp_hline_raw_32BPP(pixmap, xcenter-x+1, xcenter+x-1, ycenter-y, pixel);
+		gp_hline_raw_32BPP(pixmap, xcenter-x+1, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+static void fill_circle_seg_32BPP(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_32BPP(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+
+		if (seg_flag & GP_CIRCLE_SEG1)
+			gp_hline_raw_32BPP(pixmap, xcenter, xcenter+x-1, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG2)
+			gp_hline_raw_32BPP(pixmap, xcenter-x+1, xcenter, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG3)
+			gp_hline_raw_32BPP(pixmap, xcenter-x+1, xcenter, ycenter+y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG4)
+			gp_hline_raw_32BPP(pixmap, xcenter, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+
+static void fill_circle_18BPP_DB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_clipped_18BPP_DB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+		gp_hline_raw_18BPP_DB(pixmap, xcenter-x+1, xcenter+x-1, ycenter-y, pixel);
+		gp_hline_raw_18BPP_DB(pixmap, xcenter-x+1, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+static void fill_circle_seg_18BPP_DB(gp_pixmap *pixmap,
+	gp_coord xcenter, gp_coord ycenter, gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	/* for r == 0, circle degenerates to a point */
+	if (r == 0) {
+		gp_putpixel_raw_18BPP_DB(pixmap, xcenter, ycenter, pixel);
+		return;
+	}
+
+	int x, y, error;
+	for (x = 0, error = -r, y = r; y >= 0; y--) {
+		while (error < 0) {
+			error += 2*x + 1;
+			x++;
+		}
+		error += -2*y + 1;
+
+		if (seg_flag & GP_CIRCLE_SEG1)
+			gp_hline_raw_18BPP_DB(pixmap, xcenter, xcenter+x-1, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG2)
+			gp_hline_raw_18BPP_DB(pixmap, xcenter-x+1, xcenter, ycenter-y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG3)
+			gp_hline_raw_18BPP_DB(pixmap, xcenter-x+1, xcenter, ycenter+y, pixel);
+
+		if (seg_flag & GP_CIRCLE_SEG4)
+			gp_hline_raw_18BPP_DB(pixmap, xcenter, xcenter+x-1, ycenter+y, pixel);
+	}
+}
+
+
+void gp_fill_circle_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
+                        gp_size r, gp_pixel pixel)
+{
+	GP_CHECK_PIXMAP(pixmap);
+
+	GP_FN_PER_PACK_PIXMAP(fill_circle, pixmap, pixmap,
+	                      xcenter, ycenter, r, pixel);
+}
+
+void gp_fill_circle_seg_raw(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
+                            gp_size r, uint8_t seg_flag, gp_pixel pixel)
+{
+	GP_CHECK_PIXMAP(pixmap);
+
+	GP_FN_PER_PACK_PIXMAP(fill_circle_seg, pixmap, pixmap,
+	                      xcenter, ycenter, r, seg_flag, pixel);
+}
+
+void gp_fill_circle(gp_pixmap *pixmap, gp_coord xcenter, gp_coord ycenter,
+                    gp_size r, gp_pixel pixel)
+{
+	GP_CHECK_PIXMAP(pixmap);
+
+	GP_TRANSFORM_POINT(pixmap, xcenter, ycenter);
+
+	gp_fill_circle_raw(pixmap, xcenter, ycenter, r, pixel);
+}
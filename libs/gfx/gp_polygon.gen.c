@@ -0,0 +1,1505 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_polygon.gen.c
+ *
+ * GENERATED on 2026 10 19 16:44:22 from gp_polygon.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Copyright (C) 2009 - 2012 Jiri Dluhos <jiri.bluebear.dluhos@gmail.com>
+ * Copyright (C) 2009 - 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <limits.h>
+#include <stdint.h>
+
+#include <core/gp_transform.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_debug.h>
+
+#include <gfx/gp_line.h>
+#include <gfx/gp_hline.h>
+#include <gfx/gp_polygon.h>
+
+/*
+ * Polygon edge, the edge spans scanlines [y1, y2].
+ *
+ * The intersections with a scanline are computed incrementally with an
+ * integer DDA, i.e. we keep a quotient and reminder of a division for the
+ * left and right intersection and step them by dx/dy for each scanline.
+ *
+ * The left and right intersection are x1 + round(dx * (ry -+ 0.49999) / dy),
+ * in order to do the math in integers we multiply both the numerator and the
+ * denominator by EDGE_SCALE.
+ */
+struct gp_edge {
+	gp_coord y1, y2;
+	gp_coord x1;
+	gp_coord dx;
+	gp_coord dy;
+	/* +1 for edges going down, -1 for edges going up */
+	int dir;
+
+	/* DDA state */
+	int64_t den;
+	int64_t lq, lr;
+	int64_t rq, rr;
+	int64_t sq, sr;
+
+	/* intersection with current scanline */
+	gp_coord lx, rx;
+};
+
+#define EDGE_SCALE 100000
+#define EDGE_HALF 49999
+
+/* Number of edges we can process without allocating memory */
+#define EDGES_ON_STACK 64
+
+static inline gp_coord get_x(const gp_coord *points, unsigned int i)
+{
+	return points[2*i];
+}
+
+static inline gp_coord get_y(const gp_coord *points, unsigned int i)
+{
+	return points[2*i+1];
+}
+
+/*
+ * We shorten all lines by 1px at the end in order to get odd number of edges
+ * on each scanline.
+ */
+static unsigned int init_edges(const gp_coord *points, unsigned int nvert,
+                               struct gp_edge *edges)
+{
+	gp_coord lx = get_x(points, nvert-1);
+	gp_coord ly = get_y(points, nvert-1);
+	unsigned int i, c = 0;
+
+	for (i = 0; i < nvert; i++) {
+		gp_coord cx = get_x(points, i);
+		gp_coord cy = get_y(points, i);
+
+		if (cy == ly)
+			goto next;
+
+		if (cy > ly) {
+			edges[c].y1 = ly;
+			edges[c].y2 = cy;
+			edges[c].x1 = lx;
+			edges[c].dx = cx - lx;
+			edges[c].dy = cy - ly;
+			edges[c].dir = 1;
+		} else {
+			edges[c].y1 = cy;
+			edges[c].y2 = ly;
+			edges[c].x1 = cx;
+			edges[c].dx = lx - cx;
+			edges[c].dy = ly - cy;
+			edges[c].dir = -1;
+		}
+
+		edges[c].y2--;
+
+		c++;
+	next:
+		lx = cx;
+		ly = cy;
+	}
+
+	return c;
+}
+
+/* Floor division for positive den */
+static inline void div_floor(int64_t num, int64_t den, int64_t *q, int64_t *r)
+{
+	*q = num / den;
+	*r = num % den;
+
+	if (*r < 0) {
+		(*q)--;
+		*r += den;
+	}
+}
+
+/* Rounds q + r/den half away from zero */
+static inline gp_coord round_qr(int64_t q, int64_t r, int64_t den)
+{
+	if (q >= 0)
+		return q + (2 * r >= den);
+
+	return q + (2 * r > den);
+}
+
+/*
+ * Sets up the DDA for scanline y when the edge is inserted into the active
+ * edge list.
+ */
+static void edge_activate(struct gp_edge *e, gp_coord y)
+{
+	int64_t ry = y - e->y1;
+
+	e->den = (int64_t)e->dy * EDGE_SCALE;
+
+	div_floor((int64_t)e->dx * (EDGE_SCALE * ry - EDGE_HALF), e->den, &e->lq, &e->lr);
+	div_floor((int64_t)e->dx * (EDGE_SCALE * ry + EDGE_HALF), e->den, &e->rq, &e->rr);
+	div_floor((int64_t)e->dx * EDGE_SCALE, e->den, &e->sq, &e->sr);
+}
+
+/*
+ * Computes intersections for a given Y and steps the DDA to the next scanline.
+ *
+ * For each edge we find left and right intersection. These two points can be
+ * quite far for lines that are nearly horizontal.
+ *
+ * There is also a special case, we have to make sure that start of each line
+ * does not overshoot out of the polygon, which happens for lines that are
+ * nearly horizontal. In this case we choose the exact middle of the pixel for
+ * both coordinates, which means that we omit a few pixels which is fixed later
+ * on.
+ */
+static inline void edge_step(struct gp_edge *e, gp_coord y)
+{
+	if (y == e->y1) {
+		e->lx = e->x1;
+		e->rx = e->x1;
+	} else {
+		gp_coord lx = e->x1 + round_qr(e->lq, e->lr, e->den);
+		gp_coord rx = e->x1 + round_qr(e->rq, e->rr, e->den);
+
+		e->lx = GP_MIN(lx, rx);
+		e->rx = GP_MAX(lx, rx);
+	}
+
+	e->lq += e->sq;
+	e->lr += e->sr;
+	if (e->lr >= e->den) {
+		e->lr -= e->den;
+		e->lq++;
+	}
+
+	e->rq += e->sq;
+	e->rr += e->sr;
+	if (e->rr >= e->den) {
+		e->rr -= e->den;
+		e->rq++;
+	}
+}
+
+static int edge_cmp(const void *a, const void *b)
+{
+	const struct gp_edge *ea = a;
+	const struct gp_edge *eb = b;
+
+	return (ea->y1 > eb->y1) - (ea->y1 < eb->y1);
+}
+
+static inline int edge_gt(const struct gp_edge *a, const struct gp_edge *b)
+{
+	return a->lx > b->lx || (a->lx == b->lx && a->rx > b->rx);
+}
+
+/*
+ * The order of the intersections changes only slightly between scanlines so
+ * an insertion sort is close to linear here.
+ */
+static inline void sort_active(struct gp_edge **active, unsigned int cnt)
+{
+	unsigned int i, j;
+
+	for (i = 1; i < cnt; i++) {
+		struct gp_edge *e = active[i];
+
+		for (j = i; j > 0 && edge_gt(active[j-1], e); j--)
+			active[j] = active[j-1];
+
+		active[j] = e;
+	}
+}
+
+/*
+ * This is more or less Bresenham that only draws line segment on a single
+ * scanline y0.
+ */
+static gp_coord find_edge(gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1)
+{
+	gp_coord dx = GP_ABS(x1 - x0);
+	gp_coord dy = GP_ABS(y1 - y0);
+	gp_coord ex = x0;
+	gp_coord x_dir = x1 < x0 ? -1 : 1;
+
+	int err = 2*dy - dx - dy/2;
+
+	while (err <= 0) {
+		err += 2*dy;
+		ex += x_dir;
+	}
+
+	return ex;
+}
+
+/*
+ * Draw horizontal lines and edges around corner points separatelly.
+ *
+ * - Horizontal lines are removed from the list of edges
+ * - We shorten the edges on each side of the Y axis
+ */
+static void draw_edges_hlines(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                              const gp_coord *points, unsigned int nvert, gp_pixel pixel)
+{
+	gp_coord lx = get_x(points, nvert-1);
+	gp_coord ly = get_y(points, nvert-1);
+	unsigned int i;
+
+	for (i = 0; i < nvert; i++) {
+		gp_coord cx = get_x(points, i);
+		gp_coord cy = get_y(points, i);
+
+		if (cy == ly) {
+			gp_hline_raw(pixmap, cx + x_off, lx + x_off, cy + y_off, pixel);
+		} else {
+			gp_coord ex;
+
+			ex = find_edge(cx, cy, lx, ly);
+			gp_hline_raw(pixmap, cx + x_off, ex + x_off, cy + y_off, pixel);
+
+			ex = find_edge(lx, ly, cx, cy);
+			gp_hline_raw(pixmap, lx + x_off, ex + x_off, ly + y_off, pixel);
+		}
+
+		lx = cx;
+		ly = cy;
+	}
+}
+
+static void draw_spans_1BPP_DB(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
+                           gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
+{
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_1BPP_DB(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+		}
+		return;
+	}
+
+	int winding = 0;
+	gp_coord lx = 0;
+
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_1BPP_DB(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
+	}
+}
+
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_1BPP_DB(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int next = 0, cnt = 0, i, j;
+	gp_coord y;
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
+
+		sort_active(active, cnt);
+
+		draw_spans_1BPP_DB(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
+}
+
+static void draw_spans_1BPP_UB(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
+                           gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
+{
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_1BPP_UB(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+		}
+		return;
+	}
+
+	int winding = 0;
+	gp_coord lx = 0;
+
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_1BPP_UB(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
+	}
+}
+
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_1BPP_UB(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int next = 0, cnt = 0, i, j;
+	gp_coord y;
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
+
+		sort_active(active, cnt);
+
+		draw_spans_1BPP_UB(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
+}
+
+static void draw_spans_2BPP_DB(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
+                           gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
+{
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_2BPP_DB(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+		}
+		return;
+	}
+
+	int winding = 0;
+	gp_coord lx = 0;
+
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_2BPP_DB(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
+	}
+}
+
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_2BPP_DB(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int next = 0, cnt = 0, i, j;
+	gp_coord y;
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
+
+		sort_active(active, cnt);
+
+		draw_spans_2BPP_DB(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
+}
+
+static void draw_spans_2BPP_UB(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
+                           gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
+{
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_2BPP_UB(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+		}
+		return;
+	}
+
+	int winding = 0;
+	gp_coord lx = 0;
+
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_2BPP_UB(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
+	}
+}
+
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_2BPP_UB(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int next = 0, cnt = 0, i, j;
+	gp_coord y;
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
+
+		sort_active(active, cnt);
+
+		draw_spans_2BPP_UB(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
+}
+
+static void draw_spans_4BPP_DB(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
+                           gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
+{
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_4BPP_DB(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+		}
+		return;
+	}
+
+	int winding = 0;
+	gp_coord lx = 0;
+
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_4BPP_DB(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
+	}
+}
+
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_4BPP_DB(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int next = 0, cnt = 0, i, j;
+	gp_coord y;
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
+
+		sort_active(active, cnt);
+
+		draw_spans_4BPP_DB(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
+}
+
+static void draw_spans_4BPP_UB(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
+                           gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
+{
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_4BPP_UB(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+		}
+		return;
+	}
+
+	int winding = 0;
+	gp_coord lx = 0;
+
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_4BPP_UB(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
+	}
+}
+
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_4BPP_UB(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int next = 0, cnt = 0, i, j;
+	gp_coord y;
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
+
+		sort_active(active, cnt);
+
+		draw_spans_4BPP_UB(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
+}
+
+static void draw_spans_8BPP(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
+                           gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
+{
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_8BPP(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+		}
+		return;
+	}
+
+	int winding = 0;
+	gp_coord lx = 0;
+
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_8BPP(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
+	}
+}
+
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_8BPP(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int next = 0, cnt = 0, i, j;
+	gp_coord y;
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
+
+		sort_active(active, cnt);
+
+		draw_spans_8BPP(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
+}
+
+static void draw_spans_16BPP_LE(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
+                           gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
+{
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_16BPP_LE(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+		}
+		return;
+	}
+
+	int winding = 0;
+	gp_coord lx = 0;
+
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_16BPP_LE(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
+	}
+}
+
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_16BPP_LE(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int next = 0, cnt = 0, i, j;
+	gp_coord y;
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
+
+		sort_active(active, cnt);
+
+		draw_spans_16BPP_LE(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
+}
+
+static void draw_spans_16BPP_BE(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
+                           gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
+{
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_16BPP_BE(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+		}
+		return;
+	}
+
+	int winding = 0;
+	gp_coord lx = 0;
+
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_16BPP_BE(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
+	}
+}
+
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_16BPP_BE(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int next = 0, cnt = 0, i, j;
+	gp_coord y;
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
+
+		sort_active(active, cnt);
+
+		draw_spans_16BPP_BE(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
+}
+
+static void draw_spans_24BPP(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
+                           gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
+{
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_24BPP(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+		}
+		return;
+	}
+
+	int winding = 0;
+	gp_coord lx = 0;
+
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_24BPP(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
+	}
+}
+
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_24BPP(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int next = 0, cnt = 0, i, j;
+	gp_coord y;
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
+
+		sort_active(active, cnt);
+
+		draw_spans_24BPP(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
+}
+
+static void draw_spans_32BPP(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
+                           gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
+{
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_32BPP(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+		}
+		return;
+	}
+
+	int winding = 0;
+	gp_coord lx = 0;
+
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_32BPP(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
+	}
+}
+
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_32BPP(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int next = 0, cnt = 0, i, j;
+	gp_coord y;
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
+
+		sort_active(active, cnt);
+
+		draw_spans_32BPP(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
+}
+
+static void draw_spans_18BPP_DB(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
+                           gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
+{
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_18BPP_DB(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+		}
+		return;
+	}
+
+	int winding = 0;
+	gp_coord lx = 0;
+
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_18BPP_DB(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
+	}
+}
+
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_18BPP_DB(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int next = 0, cnt = 0, i, j;
+	gp_coord y;
+
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
+
+		sort_active(active, cnt);
+
+		draw_spans_18BPP_DB(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
+}
+
+static unsigned int count_edges(unsigned int poly_count,
+                                const unsigned int *vertex_counts)
+{
+	unsigned int i, ret = 0;
+
+	for (i = 0; i < poly_count; i++) {
+		if (vertex_counts[i] > 2)
+			ret += vertex_counts[i];
+	}
+
+	return ret;
+}
+
+void gp_fill_polygons_raw(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                          unsigned int poly_count, const unsigned int *vertex_counts,
+                          const gp_coord *xy, enum gp_fill_rule rule, gp_pixel pixel)
+{
+	struct gp_edge edges_stack[EDGES_ON_STACK];
+	struct gp_edge *active_stack[EDGES_ON_STACK];
+	struct gp_edge *edges = edges_stack;
+	struct gp_edge **active = active_stack;
+	unsigned int i, nedges = 0, max_edges;
+	gp_coord ymin = INT_MAX, ymax = INT_MIN;
+	const gp_coord *poly;
+
+	max_edges = count_edges(poly_count, vertex_counts);
+
+	if (max_edges > EDGES_ON_STACK) {
+		edges = malloc(max_edges * (sizeof(*edges) + sizeof(*active)));
+		if (!edges) {
+			GP_WARN("Malloc failed :(");
+			return;
+		}
+		active = (void*)(edges + max_edges);
+	}
+
+	for (poly = xy, i = 0; i < poly_count; poly += 2 * vertex_counts[i++]) {
+		unsigned int j, nvert = vertex_counts[i];
+
+		switch (nvert) {
+		case 0:
+			continue;
+		case 1:
+			gp_putpixel_raw_clipped(pixmap, poly[0]+x_off, poly[1]+y_off, pixel);
+			continue;
+		case 2:
+			gp_line_raw(pixmap, poly[0]+x_off, poly[1]+y_off, poly[2]+x_off, poly[3]+y_off, pixel);
+			continue;
+		}
+
+		for (j = 0; j < nvert; j++) {
+			ymax = GP_MAX(ymax, get_y(poly, j));
+			ymin = GP_MIN(ymin, get_y(poly, j));
+		}
+
+		nedges += init_edges(poly, nvert, edges + nedges);
+	}
+
+	if (nedges) {
+		GP_FN_PER_PACK_PIXMAP(fill_edges, pixmap, pixmap, x_off, y_off,
+		                      edges, nedges, active, ymin+1, ymax-1,
+		                      rule, pixel);
+	}
+
+	for (poly = xy, i = 0; i < poly_count; poly += 2 * vertex_counts[i++]) {
+		if (vertex_counts[i] > 2)
+			draw_edges_hlines(pixmap, x_off, y_off, poly, vertex_counts[i], pixel);
+	}
+
+	if (edges != edges_stack)
+		free(edges);
+}
+
+void gp_fill_polygons(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                      unsigned int poly_count, const unsigned int *vertex_counts,
+                      const gp_coord *xy, enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int i, vertex_count = 0;
+
+	for (i = 0; i < poly_count; i++)
+		vertex_count += vertex_counts[i];
+
+	gp_coord *xy_copy = malloc(2 * vertex_count * sizeof(gp_coord));
+
+	if (!xy_copy) {
+		GP_WARN("Malloc failed :(");
+		return;
+	}
+
+	for (i = 0; i < vertex_count; i++) {
+		unsigned int x = 2 * i;
+		unsigned int y = 2 * i + 1;
+
+		xy_copy[x] = xy[x];
+		xy_copy[y] = xy[y];
+		GP_TRANSFORM_POINT(pixmap, xy_copy[x], xy_copy[y]);
+	}
+
+	GP_TRANSFORM_POINT(pixmap, x_off, y_off);
+
+	gp_fill_polygons_raw(pixmap, x_off, y_off, poly_count, vertex_counts,
+	                     xy_copy, rule, pixel);
+
+	free(xy_copy);
+}
+
+void gp_fill_polygon_raw(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         unsigned int nvert, const gp_coord *xy, gp_pixel pixel)
+{
+	gp_fill_polygons_raw(pixmap, x_off, y_off, 1, &nvert, xy,
+	                     GP_FILL_EVEN_ODD, pixel);
+}
+
+void gp_fill_polygon(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                     unsigned int vertex_count, const gp_coord *xy, gp_pixel pixel)
+{
+	unsigned int i;
+	gp_coord xy_copy[2 * vertex_count];
+
+	for (i = 0; i < vertex_count; i++) {
+		unsigned int x = 2 * i;
+		unsigned int y = 2 * i + 1;
+
+		xy_copy[x] = xy[x];
+		xy_copy[y] = xy[y];
+		GP_TRANSFORM_POINT(pixmap, xy_copy[x], xy_copy[y]);
+	}
+
+	GP_TRANSFORM_POINT(pixmap, x_off, y_off);
+
+	gp_fill_polygon_raw(pixmap, x_off, y_off, vertex_count, xy_copy, pixel);
+}
+
+void gp_polygon_raw(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                    unsigned int vertex_count, const gp_coord *xy, gp_pixel pixel)
+{
+	unsigned int i;
+
+	gp_coord prev_x = xy[2 * vertex_count - 2] + x_off;
+	gp_coord prev_y = xy[2 * vertex_count - 1] + y_off;
+
+	for (i = 0; i < vertex_count; i++) {
+		gp_coord x = xy[2 * i] + x_off;
+		gp_coord y = xy[2 * i + 1] + y_off;
+
+		gp_line_raw(pixmap, prev_x, prev_y, x, y, pixel);
+
+		prev_x = x;
+		prev_y = y;
+	}
+}
+
+void gp_polygon(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                unsigned int vertex_count, const gp_coord *xy, gp_pixel pixel)
+{
+	unsigned int i;
+
+	gp_coord prev_x = xy[2 * vertex_count - 2] + x_off;
+	gp_coord prev_y = xy[2 * vertex_count - 1] + y_off;
+
+	GP_TRANSFORM_POINT(pixmap, prev_x, prev_y);
+
+	for (i = 0; i < vertex_count; i++) {
+		gp_coord x = xy[2 * i] + x_off;
+		gp_coord y = xy[2 * i + 1] + y_off;
+
+		GP_TRANSFORM_POINT(pixmap, x, y);
+
+		gp_line_raw(pixmap, prev_x, prev_y, x, y, pixel);
+
+		prev_x = x;
+		prev_y = y;
+	}
+}
+
+void gp_polygon_th_raw(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                       unsigned int vertex_count, const gp_coord *xy,
+		       gp_size r, gp_pixel pixel)
+{
+	unsigned int i;
+
+	gp_coord prev_x = xy[2 * vertex_count - 2] + x_off;
+	gp_coord prev_y = xy[2 * vertex_count - 1] + y_off;
+
+	for (i = 0; i < vertex_count; i++) {
+		gp_coord x = xy[2 * i] + x_off;
+		gp_coord y = xy[2 * i + 1] + y_off;
+
+		gp_line_th_raw(pixmap, prev_x, prev_y, x, y, r, pixel);
+
+		prev_x = x;
+		prev_y = y;
+	}
+}
+
+void gp_polygon_th(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                   unsigned int vertex_count, const gp_coord *xy,
+                   gp_size r, gp_pixel pixel)
+{
+	unsigned int i;
+
+	gp_coord prev_x = xy[2 * vertex_count - 2] + x_off;
+	gp_coord prev_y = xy[2 * vertex_count - 1] + y_off;
+
+	GP_TRANSFORM_POINT(pixmap, prev_x, prev_y);
+
+	for (i = 0; i < vertex_count; i++) {
+		gp_coord x = xy[2 * i] + x_off;
+		gp_coord y = xy[2 * i + 1] + y_off;
+
+		GP_TRANSFORM_POINT(pixmap, x, y);
+
+		gp_line_th_raw(pixmap, prev_x, prev_y, x, y, r, pixel);
+
+		prev_x = x;
+		prev_y = y;
+	}
+}
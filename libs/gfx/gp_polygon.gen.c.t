@@ -1,31 +1,58 @@
 @ include source.t
 /*
  * Copyright (C) 2009 - 2012 Jiri Dluhos <jiri.bluebear.dluhos@gmail.com>
- * Copyright (C) 2009 - 2021 Cyril Hrubis <metan@ucw.cz>
+ * Copyright (C) 2009 - 2026 Cyril Hrubis <metan@ucw.cz>
  */
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
 #include <limits.h>
+#include <stdint.h>
 
 #include <core/gp_transform.h>
 #include <core/gp_get_put_pixel.h>
+#include <core/gp_debug.h>
 
 #include <gfx/gp_line.h>
 #include <gfx/gp_hline.h>
 #include <gfx/gp_polygon.h>
 
 /*
- * Line endpoints and slope dx/dy.
+ * Polygon edge, the edge spans scanlines [y1, y2].
+ *
+ * The intersections with a scanline are computed incrementally with an
+ * integer DDA, i.e. we keep a quotient and reminder of a division for the
+ * left and right intersection and step them by dx/dy for each scanline.
+ *
+ * The left and right intersection are x1 + round(dx * (ry -+ 0.49999) / dy),
+ * in order to do the math in integers we multiply both the numerator and the
+ * denominator by EDGE_SCALE.
  */
-struct gp_line {
+struct gp_edge {
 	gp_coord y1, y2;
-	gp_coord x1, x2;
+	gp_coord x1;
 	gp_coord dx;
 	gp_coord dy;
+	/* +1 for edges going down, -1 for edges going up */
+	int dir;
+
+	/* DDA state */
+	int64_t den;
+	int64_t lq, lr;
+	int64_t rq, rr;
+	int64_t sq, sr;
+
+	/* intersection with current scanline */
+	gp_coord lx, rx;
 };
 
+#define EDGE_SCALE 100000
+#define EDGE_HALF 49999
+
+/* Number of edges we can process without allocating memory */
+#define EDGES_ON_STACK 64
+
 static inline gp_coord get_x(const gp_coord *points, unsigned int i)
 {
 	return points[2*i];
@@ -40,8 +67,8 @@ static inline gp_coord get_y(const gp_coord *points, unsigned int i)
  * We shorten all lines by 1px at the end in order to get odd number of edges
  * on each scanline.
  */
-static unsigned int init_lines(const gp_coord *points, unsigned int nvert,
-                               struct gp_line *lines)
+static unsigned int init_edges(const gp_coord *points, unsigned int nvert,
+                               struct gp_edge *edges)
 {
 	gp_coord lx = get_x(points, nvert-1);
 	gp_coord ly = get_y(points, nvert-1);
@@ -55,26 +82,22 @@ static unsigned int init_lines(const gp_coord *points, unsigned int nvert,
 			goto next;
 
 		if (cy > ly) {
-			lines[c].y1 = ly;
-			lines[c].y2 = cy;
-
-			lines[c].x1 = lx;
-			lines[c].x2 = cx;
-
-			lines[c].dx = cx - lx;
-			lines[c].dy = cy - ly;
+			edges[c].y1 = ly;
+			edges[c].y2 = cy;
+			edges[c].x1 = lx;
+			edges[c].dx = cx - lx;
+			edges[c].dy = cy - ly;
+			edges[c].dir = 1;
 		} else {
-			lines[c].y1 = cy;
-			lines[c].y2 = ly;
-
-			lines[c].x1 = cx;
-			lines[c].x2 = lx;
-
-			lines[c].dx = lx - cx;
-			lines[c].dy = ly - cy;
+			edges[c].y1 = cy;
+			edges[c].y2 = ly;
+			edges[c].x1 = cx;
+			edges[c].dx = lx - cx;
+			edges[c].dy = ly - cy;
+			edges[c].dir = -1;
 		}
 
-		lines[c].y2--;
+		edges[c].y2--;
 
 		c++;
 	next:
@@ -85,74 +108,111 @@ static unsigned int init_lines(const gp_coord *points, unsigned int nvert,
 	return c;
 }
 
-struct hline {
-	gp_coord lx;
-	gp_coord rx;
-};
+/* Floor division for positive den */
+static inline void div_floor(int64_t num, int64_t den, int64_t *q, int64_t *r)
+{
+	*q = num / den;
+	*r = num % den;
+
+	if (*r < 0) {
+		(*q)--;
+		*r += den;
+	}
+}
+
+/* Rounds q + r/den half away from zero */
+static inline gp_coord round_qr(int64_t q, int64_t r, int64_t den)
+{
+	if (q >= 0)
+		return q + (2 * r >= den);
+
+	return q + (2 * r > den);
+}
 
-static inline gp_coord round_coord(float f)
+/*
+ * Sets up the DDA for scanline y when the edge is inserted into the active
+ * edge list.
+ */
+static void edge_activate(struct gp_edge *e, gp_coord y)
 {
-	return f < 0 ? f - 0.5 : f + 0.5;
+	int64_t ry = y - e->y1;
+
+	e->den = (int64_t)e->dy * EDGE_SCALE;
+
+	div_floor((int64_t)e->dx * (EDGE_SCALE * ry - EDGE_HALF), e->den, &e->lq, &e->lr);
+	div_floor((int64_t)e->dx * (EDGE_SCALE * ry + EDGE_HALF), e->den, &e->rq, &e->rr);
+	div_floor((int64_t)e->dx * EDGE_SCALE, e->den, &e->sq, &e->sr);
 }
 
 /*
- * Algorithm to find intersections for a given Y and a set of lines.
+ * Computes intersections for a given Y and steps the DDA to the next scanline.
  *
- * For each line we find left and right intersection. These two points can be
+ * For each edge we find left and right intersection. These two points can be
  * quite far for lines that are nearly horizontal.
  *
- * This is easily computed as:
- *
- * - find Y relative to the line start
- * - for a given line we increase and decrease the given Y by a bit less than 0.5
- *   which yiels two points on Y that are then mapped to two points on a line on X
- *
  * There is also a special case, we have to make sure that start of each line
  * does not overshoot out of the polygon, which happens for lines that are
  * nearly horizontal. In this case we choose the exact middle of the pixel for
  * both coordinates, which means that we omit a few pixels which is fixed later
  * on.
  */
-static unsigned int find_intersections(const struct gp_line *lines, unsigned int nvert,
-                                       gp_coord y, struct hline *hlines)
+static inline void edge_step(struct gp_edge *e, gp_coord y)
 {
-	unsigned int i;
-	unsigned int c = 0;
+	if (y == e->y1) {
+		e->lx = e->x1;
+		e->rx = e->x1;
+	} else {
+		gp_coord lx = e->x1 + round_qr(e->lq, e->lr, e->den);
+		gp_coord rx = e->x1 + round_qr(e->rq, e->rr, e->den);
 
-	for (i = 0; i < nvert; i++) {
+		e->lx = GP_MIN(lx, rx);
+		e->rx = GP_MAX(lx, rx);
+	}
 
-		if (y < lines[i].y1 || y > lines[i].y2)
-			continue;
+	e->lq += e->sq;
+	e->lr += e->sr;
+	if (e->lr >= e->den) {
+		e->lr -= e->den;
+		e->lq++;
+	}
 
-		gp_coord ry = y - lines[i].y1;
-
-		/*
-		 * With this we effectively shorten the upper part of the edge
-		 * so that it does not overshoot out of the polygon.
-		 */
-		if (y == lines[i].y1) {
-			gp_coord mx = round_coord(lines[i].x1 + 1.00 * lines[i].dx * ry / lines[i].dy);
-			hlines[c].lx = mx;
-			hlines[c].rx = mx;
-			c++;
-			continue;
-		}
+	e->rq += e->sq;
+	e->rr += e->sr;
+	if (e->rr >= e->den) {
+		e->rr -= e->den;
+		e->rq++;
+	}
+}
 
-		gp_coord lx = lines[i].x1 + round_coord(1.00 * lines[i].dx * (ry - 0.49999) / lines[i].dy);
-		gp_coord rx = lines[i].x1 + round_coord(1.00 * lines[i].dx * (ry + 0.49999) / lines[i].dy);
+static int edge_cmp(const void *a, const void *b)
+{
+	const struct gp_edge *ea = a;
+	const struct gp_edge *eb = b;
 
-		if (lx < rx) {
-			hlines[c].lx = lx;
-			hlines[c].rx = rx;
-		} else {
-			hlines[c].lx = rx;
-			hlines[c].rx = lx;
-		}
+	return (ea->y1 > eb->y1) - (ea->y1 < eb->y1);
+}
 
-		c++;
-	}
+static inline int edge_gt(const struct gp_edge *a, const struct gp_edge *b)
+{
+	return a->lx > b->lx || (a->lx == b->lx && a->rx > b->rx);
+}
 
-	return c;
+/*
+ * The order of the intersections changes only slightly between scanlines so
+ * an insertion sort is close to linear here.
+ */
+static inline void sort_active(struct gp_edge **active, unsigned int cnt)
+{
+	unsigned int i, j;
+
+	for (i = 1; i < cnt; i++) {
+		struct gp_edge *e = active[i];
+
+		for (j = i; j > 0 && edge_gt(active[j-1], e); j--)
+			active[j] = active[j-1];
+
+		active[j] = e;
+	}
 }
 
 /*
@@ -210,88 +270,204 @@ static void draw_edges_hlines(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
 	}
 }
 
-static int comp_hlines(const void *a, const void *b)
-{
-	const struct hline *ha = a;
-	const struct hline *hb = b;
-
-	return ha->lx <= hb->lx || ((ha->lx == hb->lx) && ha->rx <= hb->rx);
-}
-
 @ for ps in pixelpacks:
-static void draw_scanlines_{{ ps.suffix }}(const struct gp_line *lines, unsigned int nvert,
-                           gp_coord y,
+static void draw_spans_{{ ps.suffix }}(struct gp_edge **active, unsigned int cnt,
+                           enum gp_fill_rule rule, gp_coord y,
                            gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off, gp_pixel pixel)
 {
-	struct hline hlines[nvert];
-	unsigned int i, j, cnt = find_intersections(lines, nvert, y, hlines);
-
-	if (cnt < 50) {
-		/* Bubble sort */
-		for (i = 0; i < cnt; i++) {
-			for (j = i+1; j < cnt; j++) {
-				if (hlines[i].lx > hlines[j].lx ||
-				    ((hlines[i].lx == hlines[j].lx) &&
-				    (hlines[i].rx > hlines[j].rx))) {
-					struct hline l = hlines[i];
-					hlines[i] = hlines[j];
-					hlines[j] = l;
-				}
-			}
+	unsigned int i;
+
+	if (rule == GP_FILL_EVEN_ODD) {
+		for (i = 0; i + 1 < cnt; i += 2) {
+			gp_coord lx = active[i]->lx;
+			gp_coord rx = active[i+1]->rx;
+
+			gp_hline_raw_{{ ps.suffix }}(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
 		}
-	} else {
-		qsort(hlines, cnt, sizeof(struct hline), comp_hlines);
+		return;
 	}
 
-	for (i = 0; i < cnt-1; i+=2) {
-		gp_coord lx = hlines[i].lx;
-		gp_coord rx = hlines[i+1].rx;
+	int winding = 0;
+	gp_coord lx = 0;
 
-		gp_hline_raw_{{ ps.suffix }}(pixmap, lx+x_off, rx+x_off, y+y_off, pixel);
+	for (i = 0; i < cnt; i++) {
+		if (!winding)
+			lx = active[i]->lx;
+
+		winding += active[i]->dir;
+
+		if (!winding)
+			gp_hline_raw_{{ ps.suffix }}(pixmap, lx+x_off, active[i]->rx+x_off, y+y_off, pixel);
 	}
 }
 
-static void fill_inner_polygon_{{ ps.suffix }}(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
-				unsigned int nvert, const gp_coord *xy, gp_pixel pixel)
+/*
+ * Scanline fill with a sorted edge table and an active edge list.
+ *
+ * The edges are sorted by the starting scanline, edges are moved into the
+ * active list once the scanline reaches them and are removed once they end.
+ */
+static void fill_edges_{{ ps.suffix }}(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         struct gp_edge *edges, unsigned int nedges,
+                         struct gp_edge **active, gp_coord ymin, gp_coord ymax,
+                         enum gp_fill_rule rule, gp_pixel pixel)
 {
-	unsigned int i;
-	struct gp_line lines[nvert];
+	unsigned int next = 0, cnt = 0, i, j;
 	gp_coord y;
 
-	gp_coord ymin, ymax;
-	ymin = ymax = get_y(xy, 0);
-	for (i = 0; i < nvert; i++) {
-		ymax = GP_MAX(ymax, get_y(xy, i));
-		ymin = GP_MIN(ymin, get_y(xy, i));
-	}
+	qsort(edges, nedges, sizeof(*edges), edge_cmp);
+
+	/* Skip scanlines that are out of the pixmap */
+	ymin = GP_MAX(ymin, -y_off);
+	ymax = GP_MIN(ymax, (gp_coord)pixmap->h - 1 - y_off);
+
+	for (y = ymin; y <= ymax; y++) {
+		for (; next < nedges && edges[next].y1 <= y; next++) {
+			if (edges[next].y2 < y)
+				continue;
+
+			edge_activate(&edges[next], y);
+			active[cnt++] = &edges[next];
+		}
+
+		for (i = 0, j = 0; i < cnt; i++) {
+			if (active[i]->y2 < y)
+				continue;
+
+			edge_step(active[i], y);
+			active[j++] = active[i];
+		}
+
+		cnt = j;
+
+		if (!cnt) {
+			if (next >= nedges)
+				return;
+
+			/* Jump over an empty gap between polygons */
+			y = edges[next].y1 - 1;
+			continue;
+		}
 
-	unsigned int nlines = init_lines(xy, nvert, lines);
+		sort_active(active, cnt);
 
-	for (y = ymin+1; y < ymax; y++)
-		draw_scanlines_{{ ps.suffix }}(lines, nlines, y, pixmap, x_off, y_off, pixel);
+		draw_spans_{{ ps.suffix }}(active, cnt, rule, y, pixmap, x_off, y_off, pixel);
+	}
 }
 
 @ end
 @
-void gp_fill_polygon_raw(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
-                         unsigned int nvert, const gp_coord *xy, gp_pixel pixel)
+static unsigned int count_edges(unsigned int poly_count,
+                                const unsigned int *vertex_counts)
 {
+	unsigned int i, ret = 0;
 
-	switch (nvert) {
-	case 1:
-		gp_putpixel_raw(pixmap, xy[0]+x_off, xy[1]+y_off, pixel);
-		return;
-	case 2:
-		gp_line_raw(pixmap, xy[0]+x_off, xy[1]+y_off, xy[2]+x_off, xy[3]+y_off, pixel);
+	for (i = 0; i < poly_count; i++) {
+		if (vertex_counts[i] > 2)
+			ret += vertex_counts[i];
+	}
+
+	return ret;
+}
+
+void gp_fill_polygons_raw(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                          unsigned int poly_count, const unsigned int *vertex_counts,
+                          const gp_coord *xy, enum gp_fill_rule rule, gp_pixel pixel)
+{
+	struct gp_edge edges_stack[EDGES_ON_STACK];
+	struct gp_edge *active_stack[EDGES_ON_STACK];
+	struct gp_edge *edges = edges_stack;
+	struct gp_edge **active = active_stack;
+	unsigned int i, nedges = 0, max_edges;
+	gp_coord ymin = INT_MAX, ymax = INT_MIN;
+	const gp_coord *poly;
+
+	max_edges = count_edges(poly_count, vertex_counts);
+
+	if (max_edges > EDGES_ON_STACK) {
+		edges = malloc(max_edges * (sizeof(*edges) + sizeof(*active)));
+		if (!edges) {
+			GP_WARN("Malloc failed :(");
+			return;
+		}
+		active = (void*)(edges + max_edges);
+	}
+
+	for (poly = xy, i = 0; i < poly_count; poly += 2 * vertex_counts[i++]) {
+		unsigned int j, nvert = vertex_counts[i];
+
+		switch (nvert) {
+		case 0:
+			continue;
+		case 1:
+			gp_putpixel_raw_clipped(pixmap, poly[0]+x_off, poly[1]+y_off, pixel);
+			continue;
+		case 2:
+			gp_line_raw(pixmap, poly[0]+x_off, poly[1]+y_off, poly[2]+x_off, poly[3]+y_off, pixel);
+			continue;
+		}
+
+		for (j = 0; j < nvert; j++) {
+			ymax = GP_MAX(ymax, get_y(poly, j));
+			ymin = GP_MIN(ymin, get_y(poly, j));
+		}
+
+		nedges += init_edges(poly, nvert, edges + nedges);
+	}
+
+	if (nedges) {
+		GP_FN_PER_PACK_PIXMAP(fill_edges, pixmap, pixmap, x_off, y_off,
+		                      edges, nedges, active, ymin+1, ymax-1,
+		                      rule, pixel);
+	}
+
+	for (poly = xy, i = 0; i < poly_count; poly += 2 * vertex_counts[i++]) {
+		if (vertex_counts[i] > 2)
+			draw_edges_hlines(pixmap, x_off, y_off, poly, vertex_counts[i], pixel);
+	}
+
+	if (edges != edges_stack)
+		free(edges);
+}
+
+void gp_fill_polygons(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                      unsigned int poly_count, const unsigned int *vertex_counts,
+                      const gp_coord *xy, enum gp_fill_rule rule, gp_pixel pixel)
+{
+	unsigned int i, vertex_count = 0;
+
+	for (i = 0; i < poly_count; i++)
+		vertex_count += vertex_counts[i];
+
+	gp_coord *xy_copy = malloc(2 * vertex_count * sizeof(gp_coord));
+
+	if (!xy_copy) {
+		GP_WARN("Malloc failed :(");
 		return;
-	default:
-	break;
 	}
 
-	GP_FN_PER_PACK_PIXMAP(fill_inner_polygon, pixmap, pixmap,
-                              x_off, y_off, nvert, xy, pixel);
+	for (i = 0; i < vertex_count; i++) {
+		unsigned int x = 2 * i;
+		unsigned int y = 2 * i + 1;
+
+		xy_copy[x] = xy[x];
+		xy_copy[y] = xy[y];
+		GP_TRANSFORM_POINT(pixmap, xy_copy[x], xy_copy[y]);
+	}
 
-	draw_edges_hlines(pixmap, x_off, y_off, xy, nvert, pixel);
+	GP_TRANSFORM_POINT(pixmap, x_off, y_off);
+
+	gp_fill_polygons_raw(pixmap, x_off, y_off, poly_count, vertex_counts,
+	                     xy_copy, rule, pixel);
+
+	free(xy_copy);
+}
+
+void gp_fill_polygon_raw(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
+                         unsigned int nvert, const gp_coord *xy, gp_pixel pixel)
+{
+	gp_fill_polygons_raw(pixmap, x_off, y_off, 1, &nvert, xy,
+	                     GP_FILL_EVEN_ODD, pixel);
 }
 
 void gp_fill_polygon(gp_pixmap *pixmap, gp_coord x_off, gp_coord y_off,
@@ -146,6 +146,9 @@ void gp_ev_dump(const gp_event *ev)
 	case GP_EV_TMR:
 		printf("Timer %s expired\n", ev->tmr->id);
 	break;
+	case GP_EV_USR:
+		printf("User code %u ptr %p\n", (unsigned int)ev->code, ev->ptr);
+	break;
 	default:
 		printf("Unknown %u\n", ev->type);
 	}
@@ -105,7 +105,7 @@ void gp_task_queue_rem(gp_task_queue *self, gp_task *task)
 
 	GP_DEBUG(3, "Removing task '%s' prio %i", task->id, task->prio);
 
-	gp_dlist_rem(&self->queues[task->prio], &task->head);
+	gp_dlist_rem(queue, &task->head);
 
 	self->task_cnt--;
 	self->min_prio = find_queue_min_prio(self);
@@ -122,17 +122,18 @@ int gp_task_queue_process(gp_task_queue *self)
 	gp_dlist_head *task_head = gp_dlist_pop_head(task_list);
 	gp_task *task = GP_LIST_ENTRY(task_head, gp_task, head);
 
-	GP_DEBUG(3, "Running task '%s' prio %i", task->id, task->prio);
+	/*
+	 * The task is removed from the queue before the callback is called,
+	 * so that the callback can free the task or queue it again.
+	 */
+	self->task_cnt--;
+	self->min_prio = find_queue_min_prio(self);
+	task->queued = 0;
 
-	int ret = task->callback(task);
+	GP_DEBUG(3, "Running task '%s' prio %i", task->id, task->prio);
 
-	if (ret) {
-		gp_dlist_push_tail(task_list, task_head);
-	} else {
-		self->task_cnt--;
-		self->min_prio = find_queue_min_prio(self);
-		task->queued = 0;
-	}
+	if (task->callback(task))
+		gp_task_queue_ins(self, task);
 
 	return 1;
 }
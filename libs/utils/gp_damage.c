@@ -0,0 +1,125 @@
+//SPDX-License-Identifier: LGPL-2.0-or-later
+
+/*
+
+   Copyright (c) 2026 Cyril Hrubis <metan@ucw.cz>
+
+ */
+
+#include <stdint.h>
+#include <utils/gp_damage.h>
+
+static uint64_t area(gp_bbox box)
+{
+	return (uint64_t)box.w * box.h;
+}
+
+static int overlaps(gp_bbox a, gp_bbox b)
+{
+	if (a.x >= b.x + (gp_coord)b.w || b.x >= a.x + (gp_coord)a.w)
+		return 0;
+
+	if (a.y >= b.y + (gp_coord)b.h || b.y >= a.y + (gp_coord)a.h)
+		return 0;
+
+	return 1;
+}
+
+/*
+ * Returns the area that is added by merging two non-overlapping rectangles.
+ */
+static uint64_t waste(gp_bbox a, gp_bbox b)
+{
+	uint64_t merged = area(gp_bbox_merge(a, b));
+	uint64_t sum = area(a) + area(b);
+
+	return merged > sum ? merged - sum : 0;
+}
+
+static gp_bbox rect_rem(gp_damage *self, unsigned int i)
+{
+	gp_bbox ret = self->rects[i];
+
+	self->rects[i] = self->rects[--self->cnt];
+
+	return ret;
+}
+
+/*
+ * Merges the pair of rectangles that adds the smallest area, the box that is
+ * being added is at the index self->cnt.
+ */
+static void merge_best(gp_damage *self, gp_bbox *box)
+{
+	unsigned int i, j, best_i = 0, best_j = self->cnt;
+	uint64_t best_waste = UINT64_MAX;
+
+	for (i = 0; i < self->cnt; i++) {
+		for (j = i + 1; j <= self->cnt; j++) {
+			gp_bbox b = j < self->cnt ? self->rects[j] : *box;
+			uint64_t w = waste(self->rects[i], b);
+
+			if (w < best_waste) {
+				best_waste = w;
+				best_i = i;
+				best_j = j;
+			}
+		}
+	}
+
+	if (best_j == self->cnt) {
+		*box = gp_bbox_merge(*box, rect_rem(self, best_i));
+		return;
+	}
+
+	gp_bbox merged = gp_bbox_merge(self->rects[best_i], self->rects[best_j]);
+
+	/* Remove the higher index first, the last rect is moved on removal */
+	rect_rem(self, best_j);
+	rect_rem(self, best_i);
+
+	gp_damage_add(self, merged);
+}
+
+void gp_damage_add(gp_damage *self, gp_bbox box)
+{
+	unsigned int i;
+
+	if (gp_bbox_empty(box))
+		return;
+
+	for (;;) {
+		for (i = 0; i < self->cnt; i++) {
+			if (overlaps(box, self->rects[i]) || !waste(box, self->rects[i]))
+				break;
+		}
+
+		if (i < self->cnt) {
+			box = gp_bbox_merge(box, rect_rem(self, i));
+			continue;
+		}
+
+		if (self->cnt < GP_DAMAGE_RECTS_MAX) {
+			self->rects[self->cnt++] = box;
+			return;
+		}
+
+		merge_best(self, &box);
+	}
+}
+
+gp_bbox gp_damage_bbox(const gp_damage *self)
+{
+	gp_bbox ret = {};
+	unsigned int i;
+
+	if (!self->cnt)
+		return ret;
+
+	ret = self->rects[0];
+
+	for (i = 1; i < self->cnt; i++)
+		ret = gp_bbox_merge(ret, self->rects[i]);
+
+	return ret;
+}
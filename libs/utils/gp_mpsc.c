@@ -0,0 +1,69 @@
+//SPDX-License-Identifier: LGPL-2.0-or-later
+
+/*
+
+   Copyright (c) 2026 Cyril Hrubis <metan@ucw.cz>
+
+ */
+
+/*
+ * The queue is a singly linked list where producers atomically swap the head
+ * pointer and then link the previous head to the new node. The consumer walks
+ * the list from the tail. The stub node makes sure that the list is never
+ * empty, so that producers never touch the tail.
+ */
+
+#include <utils/gp_mpsc.h>
+
+void gp_mpsc_init(gp_mpsc *self)
+{
+	self->stub.next = NULL;
+	self->tail = &self->stub;
+	__atomic_store_n(&self->head, &self->stub, __ATOMIC_RELEASE);
+}
+
+void gp_mpsc_push(gp_mpsc *self, gp_mpsc_node *node)
+{
+	gp_mpsc_node *prev;
+
+	__atomic_store_n(&node->next, NULL, __ATOMIC_RELAXED);
+
+	prev = __atomic_exchange_n(&self->head, node, __ATOMIC_ACQ_REL);
+
+	__atomic_store_n(&prev->next, node, __ATOMIC_RELEASE);
+}
+
+gp_mpsc_node *gp_mpsc_pop(gp_mpsc *self)
+{
+	gp_mpsc_node *tail = self->tail;
+	gp_mpsc_node *next = __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+
+	if (tail == &self->stub) {
+		if (!next)
+			return NULL;
+
+		self->tail = next;
+		tail = next;
+		next = __atomic_load_n(&next->next, __ATOMIC_ACQUIRE);
+	}
+
+	if (next) {
+		self->tail = next;
+		return tail;
+	}
+
+	/* Producer is in the middle of a push */
+	if (tail != __atomic_load_n(&self->head, __ATOMIC_ACQUIRE))
+		return NULL;
+
+	/* Tail is the last node, push the stub so that we can pop it */
+	gp_mpsc_push(self, &self->stub);
+
+	next = __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+	if (next) {
+		self->tail = next;
+		return tail;
+	}
+
+	return NULL;
+}
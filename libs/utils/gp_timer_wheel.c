@@ -0,0 +1,290 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <inttypes.h>
+#include <string.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_common.h>
+#include <utils/gp_timer_wheel.h>
+
+#define SLOT_MASK (GP_TIMER_WHEEL_SLOTS - 1)
+#define LEVEL_SHIFT(level) ((level) * GP_TIMER_WHEEL_BITS)
+#define MAX_DELTA (1ULL << LEVEL_SHIFT(GP_TIMER_WHEEL_LEVELS))
+
+void gp_timer_wheel_init(gp_timer_wheel *self, uint64_t now)
+{
+	memset(self, 0, sizeof(*self));
+	self->clk = now;
+}
+
+static void place(gp_timer_wheel *self, gp_timer *timer)
+{
+	uint64_t expires = GP_MAX(timer->expires, self->clk);
+	uint64_t delta = expires - self->clk;
+	unsigned int level, slot;
+
+	/* Too far in the future, will be placed again once the wheel turns */
+	if (delta >= MAX_DELTA) {
+		delta = MAX_DELTA - 1;
+		expires = self->clk + delta;
+	}
+
+	for (level = 0; level < GP_TIMER_WHEEL_LEVELS - 1; level++) {
+		if (delta < (1ULL << LEVEL_SHIFT(level + 1)))
+			break;
+	}
+
+	slot = (expires >> LEVEL_SHIFT(level)) & SLOT_MASK;
+
+	timer->slot = level * GP_TIMER_WHEEL_SLOTS + slot;
+
+	gp_dlist_push_tail(&self->slots[level][slot], &timer->list);
+	self->used[level] |= 1ULL << slot;
+}
+
+static void unplace(gp_timer_wheel *self, gp_timer *timer)
+{
+	unsigned int level = timer->slot / GP_TIMER_WHEEL_SLOTS;
+	unsigned int slot = timer->slot % GP_TIMER_WHEEL_SLOTS;
+	gp_dlist *list = &self->slots[level][slot];
+
+	gp_dlist_rem(list, &timer->list);
+
+	if (!list->cnt)
+		self->used[level] &= ~(1ULL << slot);
+}
+
+void gp_timer_wheel_ins(gp_timer_wheel *self, uint64_t now, gp_timer *timer)
+{
+	uint32_t after = timer->expires;
+	uint64_t expires = now + after;
+
+	GP_DEBUG(3, "Inserting timer %s (now is %"PRIu64") expires after %"
+	         PRIu32" at %"PRIu64" in_callback=%i",
+		 timer->id, now, after, expires, timer->in_callback);
+
+	if (timer->in_callback) {
+		timer->expires = expires;
+		timer->res_in_callback = 1;
+		return;
+	}
+
+	if (timer->running) {
+		GP_DEBUG(3, "Timer %s already running!", timer->id);
+		return;
+	}
+
+	timer->expires = expires;
+	timer->running = 1;
+
+	place(self, timer);
+	self->cnt++;
+}
+
+void gp_timer_wheel_rem(gp_timer_wheel *self, gp_timer *timer)
+{
+	GP_DEBUG(3, "Removing timer %s from wheel in_callback=%i",
+	         timer->id, timer->in_callback);
+
+	if (!timer->running) {
+		GP_DEBUG(3, "Timer %s is not running!", timer->id);
+		return;
+	}
+
+	if (timer->in_callback) {
+		timer->expires = GP_TIMER_STOP;
+		timer->res_in_callback = 1;
+		return;
+	}
+
+	unplace(self, timer);
+	self->cnt--;
+
+	timer->running = 0;
+	timer->expires = 0;
+
+	if (timer->stopped)
+		timer->stopped(timer);
+}
+
+static void run_timer(gp_timer *timer, gp_timer **reschedule, uint64_t now)
+{
+	uint64_t expires;
+	uint32_t ret;
+
+	GP_DEBUG(3, "Timer %s expired at %"PRIu64" now is %"PRIu64,
+	         timer->id, timer->expires, now);
+
+	timer->in_callback = 1;
+
+	ret = timer->callback(timer);
+	expires = now + ret;
+
+	if (timer->res_in_callback) {
+		GP_DEBUG(3, "Timer '%s' changed from callback", timer->id);
+		timer->res_in_callback = 0;
+		ret = timer->expires == GP_TIMER_STOP ? GP_TIMER_STOP : 0;
+		expires = timer->expires;
+	}
+
+	timer->in_callback = 0;
+
+	if (ret == GP_TIMER_STOP) {
+		timer->running = 0;
+		timer->expires = 0;
+
+		if (timer->stopped)
+			timer->stopped(timer);
+
+		if (timer->free_on_stop)
+			gp_timer_free(timer);
+
+		return;
+	}
+
+	timer->expires = expires;
+	GP_DEBUG(3, "Rescheduling timer '%s' expires at %"PRIu64,
+	         timer->id, timer->expires);
+	timer->next = *reschedule;
+	*reschedule = timer;
+}
+
+static int run_slot(gp_timer_wheel *self, gp_timer **reschedule, uint64_t now)
+{
+	unsigned int slot = self->clk & SLOT_MASK;
+	gp_dlist *list = &self->slots[0][slot];
+	gp_dlist_head *head;
+	int ret = 0;
+
+	/*
+	 * Timers inserted from a callback with expiration <= clk end up in the
+	 * very same slot and are processed in this loop as well.
+	 */
+	while ((head = gp_dlist_pop_head(list))) {
+		gp_timer *timer = GP_LIST_ENTRY(head, gp_timer, list);
+
+		self->cnt--;
+		run_timer(timer, reschedule, now);
+		ret++;
+	}
+
+	self->used[0] &= ~(1ULL << slot);
+
+	return ret;
+}
+
+/*
+ * Moves timers from an upper level slot into lower levels.
+ */
+static void cascade(gp_timer_wheel *self, unsigned int level)
+{
+	unsigned int slot = (self->clk >> LEVEL_SHIFT(level)) & SLOT_MASK;
+	gp_dlist_head *head = self->slots[level][slot].head;
+	gp_dlist_head *next;
+
+	/* Detach the list first, timers may be placed into the same slot */
+	self->slots[level][slot] = (gp_dlist) {};
+	self->used[level] &= ~(1ULL << slot);
+
+	for (; head; head = next) {
+		next = head->next;
+		place(self, GP_LIST_ENTRY(head, gp_timer, list));
+	}
+}
+
+static void cascade_all(gp_timer_wheel *self)
+{
+	unsigned int level;
+
+	for (level = 1; level < GP_TIMER_WHEEL_LEVELS; level++) {
+		if (self->clk & ((1ULL << LEVEL_SHIFT(level)) - 1))
+			return;
+
+		cascade(self, level);
+	}
+}
+
+static inline uint64_t rotr(uint64_t val, unsigned int r)
+{
+	if (!r)
+		return val;
+
+	return (val >> r) | (val << (64 - r));
+}
+
+/*
+ * Returns the closest time after clk when a lowest level slot has to be
+ * processed or an upper level slot has to be cascaded.
+ */
+static uint64_t next_event(const gp_timer_wheel *self)
+{
+	uint64_t ret = UINT64_MAX;
+	unsigned int level;
+
+	for (level = 0; level < GP_TIMER_WHEEL_LEVELS; level++) {
+		unsigned int shift = LEVEL_SHIFT(level);
+		unsigned int idx = (self->clk >> shift) & SLOT_MASK;
+		uint64_t used = self->used[level];
+		uint64_t dist, t;
+
+		if (!used)
+			continue;
+
+		dist = __builtin_ctzll(rotr(used, (idx + 1) & SLOT_MASK)) + 1;
+		t = ((self->clk >> shift) + dist) << shift;
+
+		ret = GP_MIN(ret, t);
+	}
+
+	return ret;
+}
+
+int gp_timer_wheel_process(gp_timer_wheel *self, uint64_t now)
+{
+	gp_timer *reschedule = NULL, *tmp;
+	int ret = 0;
+
+	if (now < self->clk)
+		return 0;
+
+	for (;;) {
+		ret += run_slot(self, &reschedule, now);
+
+		if (self->clk >= now)
+			break;
+
+		if (!self->cnt) {
+			self->clk = now;
+			break;
+		}
+
+		/* Skip empty slots */
+		self->clk = GP_MIN(next_event(self), now);
+
+		if (!(self->clk & SLOT_MASK))
+			cascade_all(self);
+	}
+
+	while (reschedule) {
+		tmp = reschedule->next;
+		place(self, reschedule);
+		self->cnt++;
+		reschedule = tmp;
+	}
+
+	return ret;
+}
+
+uint64_t gp_timer_wheel_expires(const gp_timer_wheel *self)
+{
+	if (!self->cnt)
+		return UINT64_MAX;
+
+	if (self->used[0] & (1ULL << (self->clk & SLOT_MASK)))
+		return self->clk;
+
+	return next_event(self);
+}
@@ -0,0 +1,201 @@
+//SPDX-License-Identifier: LGPL-2.0-or-later
+
+/*
+
+   Copyright (c) 2026 Cyril Hrubis <metan@ucw.cz>
+
+ */
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include <core/gp_common.h>
+#include <core/gp_clamp.h>
+#include <core/gp_debug.h>
+#include <widgets/gp_app_task.h>
+#include <widgets/gp_app_job.h>
+
+#include "gp_widgets_internal.h"
+
+/*
+ * The queue of pending jobs, shared between the main loop and the workers,
+ * protected by the lock.
+ */
+static gp_task_queue pending;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+static unsigned int threads_cnt;
+
+static int job_done(gp_task *task)
+{
+	gp_app_job *self = task->priv;
+
+	pthread_mutex_lock(&lock);
+	self->state = GP_APP_JOB_IDLE;
+	pthread_mutex_unlock(&lock);
+
+	GP_DEBUG(3, "Job '%s' done ret %i canceled %i",
+	         self->id, self->ret, self->canceled);
+
+	if (self->done)
+		self->done(self);
+
+	return 0;
+}
+
+static gp_app_job *pop_job(void)
+{
+	unsigned int prio = gp_task_queue_head_prio(&pending);
+	gp_dlist_head *head = pending.queues[prio - GP_TASK_MIN_PRIO].head;
+	gp_task *task = GP_LIST_ENTRY(head, gp_task, head);
+
+	gp_task_queue_rem(&pending, task);
+
+	return task->priv;
+}
+
+static void *worker(void *arg)
+{
+	(void) arg;
+
+	for (;;) {
+		gp_app_job *job;
+
+		pthread_mutex_lock(&lock);
+
+		while (!gp_task_queue_tasks(&pending))
+			pthread_cond_wait(&cond, &lock);
+
+		job = pop_job();
+		job->state = GP_APP_JOB_RUNNING;
+
+		pthread_mutex_unlock(&lock);
+
+		GP_DEBUG(3, "Running job '%s'", job->id);
+
+		job->ret = job->run(job);
+
+		pthread_mutex_lock(&lock);
+		job->state = GP_APP_JOB_DONE;
+		pthread_mutex_unlock(&lock);
+
+		job->task.callback = job_done;
+
+		if (gp_app_task_post(&job->task))
+			GP_WARN("Failed to post job '%s' completion", job->id);
+	}
+
+	return NULL;
+}
+
+static int start_threads(void)
+{
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	unsigned int i, cnt;
+
+	cnt = GP_CLAMP(cpus, 1, GP_APP_JOB_THREADS_MAX);
+
+	for (i = 0; i < cnt; i++) {
+		pthread_t thread;
+
+		if (pthread_create(&thread, NULL, worker, NULL)) {
+			GP_WARN("Failed to start a worker thread");
+			break;
+		}
+
+		pthread_detach(thread);
+	}
+
+	GP_DEBUG(1, "Started %u job worker threads", i);
+
+	threads_cnt = i;
+
+	return !threads_cnt;
+}
+
+static void run_sync(gp_app_job *self)
+{
+	GP_DEBUG(3, "Running job '%s' synchronously", self->id);
+
+	self->state = GP_APP_JOB_RUNNING;
+	pthread_mutex_unlock(&lock);
+
+	self->ret = self->run(self);
+
+	job_done(&self->task);
+}
+
+int gp_app_job_submit(gp_app_job *self)
+{
+	pthread_mutex_lock(&lock);
+
+	if (self->state != GP_APP_JOB_IDLE) {
+		pthread_mutex_unlock(&lock);
+		GP_WARN("Job '%s' already in progress", self->id);
+		return 1;
+	}
+
+	__atomic_store_n(&self->canceled, 0, __ATOMIC_RELAXED);
+	self->ret = 0;
+
+	self->task = (gp_task) {
+		.id = (char*)self->id,
+		.prio = self->prio ? self->prio : GP_TASK_MIN_PRIO,
+		.priv = self,
+	};
+
+	/*
+	 * Completion cannot be delivered without the main loop, e.g. in tests,
+	 * or when threads are not available, fall back to a synchronous run.
+	 */
+	if (!widgets_main_loop_running() ||
+	    (!threads_cnt && start_threads())) {
+		run_sync(self);
+		return 0;
+	}
+
+	self->state = GP_APP_JOB_QUEUED;
+	gp_task_queue_ins(&pending, &self->task);
+
+	pthread_cond_signal(&cond);
+	pthread_mutex_unlock(&lock);
+
+	GP_DEBUG(3, "Job '%s' submitted", self->id);
+
+	return 0;
+}
+
+void gp_app_job_cancel(gp_app_job *self)
+{
+	pthread_mutex_lock(&lock);
+
+	if (self->state == GP_APP_JOB_IDLE) {
+		pthread_mutex_unlock(&lock);
+		return;
+	}
+
+	__atomic_store_n(&self->canceled, 1, __ATOMIC_RELAXED);
+
+	if (self->state == GP_APP_JOB_QUEUED) {
+		gp_task_queue_rem(&pending, &self->task);
+		self->state = GP_APP_JOB_DONE;
+		pthread_mutex_unlock(&lock);
+
+		self->task.callback = job_done;
+		gp_app_task_start(&self->task);
+		return;
+	}
+
+	pthread_mutex_unlock(&lock);
+}
+
+int gp_app_job_busy(gp_app_job *self)
+{
+	int ret;
+
+	pthread_mutex_lock(&lock);
+	ret = self->state != GP_APP_JOB_IDLE;
+	pthread_mutex_unlock(&lock);
+
+	return ret;
+}
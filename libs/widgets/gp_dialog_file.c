@@ -22,10 +22,13 @@
 #include <widgets/gp_dialog.h>
 #include <widgets/gp_dialog_file.h>
 #include <widgets/gp_app_poll.h>
+#include <widgets/gp_app_job.h>
 
 #include "dialog_file_open.json.h"
 #include "dialog_file_save.json.h"
 
+struct dir_job;
+
 struct file_dialog {
 	gp_widget *show_hidden;
 	gp_widget *filter;
@@ -34,6 +37,9 @@ struct file_dialog {
 	gp_widget *file_table;
 	gp_widget *open_save_btn;
 
+	/* A directory that is being loaded in the background */
+	struct dir_job *dir_job;
+
 	const gp_dialog_file_opts *opts;
 };
 
@@ -109,14 +115,46 @@ static enum gp_poll_event_ret notify_callback(gp_fd *self)
 	return 0;
 }
 
-static gp_dir_cache *load_dir_cache(struct file_dialog *dialog)
-{
+/*
+ * Large directories take a while to be listed, the cache is created in a
+ * background job so that the dialog stays responsive.
+ */
+struct dir_job {
+	gp_app_job job;
+	struct file_dialog *dialog;
 	gp_dir_cache *cache;
+	char path[];
+};
+
+static int dir_job_run(gp_app_job *self)
+{
+	struct dir_job *job = GP_CONTAINER_OF(self, struct dir_job, job);
+
+	job->cache = gp_dir_cache_new(job->path);
+
+	return 0;
+}
+
+static void dir_job_done(gp_app_job *self)
+{
+	struct dir_job *job = GP_CONTAINER_OF(self, struct dir_job, job);
+	struct file_dialog *dialog = job->dialog;
+	gp_dir_cache *cache = job->cache;
 	gp_fd *notify_fd;
 
-	cache = gp_dir_cache_new(gp_widget_tbox_text(dialog->dir_path));
+	free(job);
+
+	/* Dialog has exited or a different directory was requested */
+	if (!dialog) {
+		if (cache)
+			gp_dir_cache_destroy(cache);
+		return;
+	}
+
+	dialog->dir_job = NULL;
+
 	if (!cache)
-		return NULL;
+		return;
 
 	notify_fd = gp_dir_cache_notify_fd(cache);
 	if (notify_fd) {
@@ -125,7 +163,36 @@ static gp_dir_cache *load_dir_cache(struct file_dialog *dialog)
 		gp_app_poll_add(notify_fd);
 	}
 
-	return cache;
+	gp_widget_table_priv_get(dialog->file_table)->priv = cache;
+	gp_widget_redraw(dialog->file_table);
+}
+
+static void load_dir_cache(struct file_dialog *dialog)
+{
+	const char *path = gp_widget_tbox_text(dialog->dir_path);
+	size_t path_len = strlen(path);
+	struct dir_job *job;
+
+	if (dialog->dir_job)
+		return;
+
+	job = malloc(sizeof(*job) + path_len + 1);
+	if (!job) {
+		GP_WARN("Malloc failed :(");
+		return;
+	}
+
+	memset(job, 0, sizeof(*job));
+	memcpy(job->path, path, path_len + 1);
+
+	job->job.id = "dir cache";
+	job->job.run = dir_job_run;
+	job->job.done = dir_job_done;
+	job->dialog = dialog;
+
+	dialog->dir_job = job;
+
+	gp_app_job_submit(&job->job);
 }
 
 static void free_dir_cache(struct file_dialog *dialog)
@@ -134,6 +201,12 @@ static void free_dir_cache(struct file_dialog *dialog)
 	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(dialog->file_table);
 	gp_dir_cache *self = tbl_priv->priv;
 
+	if (dialog->dir_job) {
+		dialog->dir_job->dialog = NULL;
+		gp_app_job_cancel(&dialog->dir_job->job);
+		dialog->dir_job = NULL;
+	}
+
 	if (!self)
 		return;
 
@@ -152,8 +225,10 @@ static int files_seek_row(gp_widget *self, int op, unsigned int pos)
 	gp_dir_cache *cache = tbl_priv->priv;
 	unsigned int i;
 
-	if (!cache)
-		cache = tbl_priv->priv = load_dir_cache(self->priv);
+	if (!cache) {
+		load_dir_cache(self->priv);
+		cache = tbl_priv->priv;
+	}
 
 	if (!cache)
 		return 0;
@@ -237,6 +312,9 @@ static void files_sort(gp_widget *self, int desc, unsigned int col)
 	else
 		sort_type |= GP_DIR_SORT_ASC;
 
+	if (!tbl_priv->priv)
+		return;
+
 	gp_dir_cache_sort(tbl_priv->priv, sort_type);
 }
 
@@ -378,12 +456,10 @@ static void set_path(struct file_dialog *dialog, const char *path)
 	if (access(path, X_OK))
 		return;
 
-	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(dialog->file_table);
-
 	gp_widget_tbox_printf(dialog->dir_path, "%s", path);
 
 	free_dir_cache(dialog);
-	tbl_priv->priv = load_dir_cache(dialog);
+	load_dir_cache(dialog);
 	if (dialog->filter)
 		gp_widget_tbox_clear(dialog->filter);
 	gp_widget_table_off_set(dialog->file_table, 0);
@@ -559,6 +635,9 @@ static int new_dir_on_event(gp_widget_event *ev)
 	gp_widget_table_priv *tbl_priv = gp_widget_table_priv_get(dialog->file_table);
 	gp_dir_cache *cache = tbl_priv->priv;
 
+	if (!cache)
+		return 0;
+
 	dir_name = gp_dialog_input_run("Enter directory name");
 	if (!dir_name)
 		goto ret0;
@@ -619,6 +698,9 @@ static int filter_on_event(gp_widget_event *ev)
 
 	switch (ev->sub_type) {
 	case GP_WIDGET_TBOX_POST_FILTER:
+		if (!cache)
+			return 0;
+
 		return !gp_dir_cache_entry_name_contains(cache, gp_widget_tbox_text(ev->self));
 	break;
 	case GP_WIDGET_TBOX_EDIT:
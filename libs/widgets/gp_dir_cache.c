@@ -13,78 +13,17 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <errno.h>
+#include <limits.h>
 
+#include <core/gp_common.h>
 #include <core/gp_debug.h>
 #include <utils/gp_block_alloc.h>
+#include <utils/gp_htable.h>
 #include <widgets/gp_dir_cache.h>
 
-static void add_entry(gp_dir_cache *self, gp_dir_entry *entry)
+static int cmp_names(const gp_dir_entry *a, const gp_dir_entry *b)
 {
-	if (self->used >= self->size) {
-		size_t new_size = self->size + 50;
-		void *entries;
-
-		entries = realloc(self->entries, new_size * sizeof(void*));
-		if (!entries) {
-			GP_DEBUG(1, "Realloc failed :-(");
-			return;
-		}
-
-		self->size = new_size;
-		self->entries = entries;
-	}
-
-	self->entries[self->used++] = entry;
-}
-
-gp_dir_entry *gp_dir_cache_add_entry(gp_dir_cache *self, size_t size,
-                                     const char *name, mode_t mode, time_t mtime)
-{
-	size_t name_len = strlen(name);
-	size_t entry_size;
-	int is_dir = 0;
-	gp_dir_entry *entry;
-
-	if ((mode & S_IFMT) == S_IFDIR)
-		is_dir = 1;
-
-	entry_size = sizeof(gp_dir_entry) + name_len + is_dir + 1;
-
-	entry = gp_balloc(&self->allocator, entry_size);
-	if (!entry)
-		return NULL;
-
-	entry->size = size;
-	entry->is_dir = is_dir;
-	entry->name_len = name_len;
-	entry->mtime = mtime;
-	sprintf(entry->name, "%s%s", name, is_dir ? "/" : "");
-
-	GP_DEBUG(3, "Dir Cache %p new entry '%s' size %zuB", self, entry->name, size);
-
-	add_entry(self, entry);
-
-	return entry;
-}
-
-int gp_dir_cache_rem_entry_by_name(gp_dir_cache *self, const char *name)
-{
-	size_t i;
-
-	for (i = 0; i < self->used; i++) {
-		if (!strcmp(self->entries[i]->name, name)) {
-			self->entries[i] = self->entries[--self->used];
-			return 0;
-		}
-	}
-
-	return 1;
-}
-
-void gp_dir_cache_free_entries(gp_dir_cache *self)
-{
-	gp_bfree(&self->allocator);
-	free(self->entries);
+	return strcmp(a->name, b->name);
 }
 
 static int cmp_asc_name(const void *a, const void *b)
@@ -92,7 +31,7 @@ static int cmp_asc_name(const void *a, const void *b)
 	const gp_dir_entry *const *ea = a;
 	const gp_dir_entry *const *eb = b;
 
-	return strcmp((*ea)->name, (*eb)->name);
+	return cmp_names(*ea, *eb);
 }
 
 static int cmp_desc_name(const void *a, const void *b)
@@ -100,18 +39,22 @@ static int cmp_desc_name(const void *a, const void *b)
 	const gp_dir_entry *const *ea = a;
 	const gp_dir_entry *const *eb = b;
 
-	return strcmp((*eb)->name, (*ea)->name);
+	return cmp_names(*eb, *ea);
 }
 
+/*
+ * Entries with the same size or mtime are ordered by name so that the order
+ * is total and an entry position can be found by a binary search.
+ */
 static int cmp_asc_size(const void *a, const void *b)
 {
 	const gp_dir_entry *const *ea = a;
 	const gp_dir_entry *const *eb = b;
 
 	if ((*ea)->size == (*eb)->size)
-		return 0;
+		return cmp_names(*ea, *eb);
 
-	return (*ea)->size > (*eb)->size;
+	return (*ea)->size > (*eb)->size ? 1 : -1;
 }
 
 static int cmp_desc_size(const void *a, const void *b)
@@ -120,9 +63,9 @@ static int cmp_desc_size(const void *a, const void *b)
 	const gp_dir_entry *const *eb = b;
 
 	if ((*ea)->size == (*eb)->size)
-		return 0;
+		return cmp_names(*ea, *eb);
 
-	return (*ea)->size < (*eb)->size;
+	return (*ea)->size < (*eb)->size ? 1 : -1;
 }
 
 static int cmp_asc_time(const void *a, const void *b)
@@ -131,9 +74,9 @@ static int cmp_asc_time(const void *a, const void *b)
 	const gp_dir_entry *const *eb = b;
 
 	if ((*ea)->mtime == (*eb)->mtime)
-		return 0;
+		return cmp_names(*ea, *eb);
 
-	return (*ea)->mtime > (*eb)->mtime;
+	return (*ea)->mtime > (*eb)->mtime ? 1 : -1;
 }
 
 static int cmp_desc_time(const void *a, const void *b)
@@ -142,9 +85,9 @@ static int cmp_desc_time(const void *a, const void *b)
 	const gp_dir_entry *const *eb = b;
 
 	if ((*ea)->mtime == (*eb)->mtime)
-		return 0;
+		return cmp_names(*ea, *eb);
 
-	return (*ea)->mtime < (*eb)->mtime;
+	return (*ea)->mtime < (*eb)->mtime ? 1 : -1;
 }
 
 static int (*cmp_funcs[])(const void *, const void *) = {
@@ -156,6 +99,238 @@ static int (*cmp_funcs[])(const void *, const void *) = {
 	[GP_DIR_SORT_DESC | GP_DIR_SORT_BY_MTIME] = cmp_desc_time,
 };
 
+static int is_parent(const gp_dir_entry *entry)
+{
+	return !strcmp(entry->name, "../");
+}
+
+/*
+ * Returns a position the entry belongs to in a sorted array, the parent
+ * directory is always kept at the start.
+ */
+static size_t sorted_pos(gp_dir_cache *self, gp_dir_entry **arr, size_t len,
+                         gp_dir_entry *entry)
+{
+	int (*cmp_func)(const void *, const void *) = cmp_funcs[self->sort_type];
+	size_t l = 0, r = len;
+
+	if (is_parent(entry))
+		return 0;
+
+	if (len && is_parent(arr[0]))
+		l = 1;
+
+	while (l < r) {
+		size_t mid = l + (r - l)/2;
+
+		if (cmp_func(&arr[mid], &entry) < 0)
+			l = mid + 1;
+		else
+			r = mid;
+	}
+
+	return l;
+}
+
+static size_t entry_pos(gp_dir_cache *self, gp_dir_entry **arr, size_t len,
+                        gp_dir_entry *entry)
+{
+	size_t pos;
+
+	if (self->sorted) {
+		pos = sorted_pos(self, arr, len, entry);
+		if (pos < len && arr[pos] == entry)
+			return pos;
+	}
+
+	for (pos = 0; pos < len; pos++) {
+		if (arr[pos] == entry)
+			return pos;
+	}
+
+	return len;
+}
+
+static void arr_ins(gp_dir_entry **arr, size_t len, size_t pos, gp_dir_entry *entry)
+{
+	memmove(arr + pos + 1, arr + pos, (len - pos) * sizeof(void*));
+	arr[pos] = entry;
+}
+
+static void arr_rem(gp_dir_entry **arr, size_t len, size_t pos)
+{
+	memmove(arr + pos, arr + pos + 1, (len - pos - 1) * sizeof(void*));
+}
+
+static void filter_rebuild(gp_dir_cache *self)
+{
+	size_t i, j = 0;
+
+	for (i = 0; i < self->used; i++) {
+		if (!self->entries[i]->filtered)
+			self->entries_filter[j++] = self->entries[i];
+	}
+
+	self->filter_dirty = 0;
+}
+
+static int grow(gp_dir_cache *self)
+{
+	size_t new_size = GP_MAX(2 * self->size, (size_t)64);
+	void *entries, *entries_filter;
+
+	entries = realloc(self->entries, new_size * sizeof(void*));
+	if (!entries)
+		goto err;
+
+	self->entries = entries;
+
+	entries_filter = realloc(self->entries_filter, new_size * sizeof(void*));
+	if (!entries_filter)
+		goto err;
+
+	self->entries_filter = entries_filter;
+	self->size = new_size;
+
+	return 0;
+err:
+	GP_DEBUG(1, "Realloc failed :-(");
+	return 1;
+}
+
+static int add_entry(gp_dir_cache *self, gp_dir_entry *entry)
+{
+	size_t pos = self->used;
+
+	if (self->used >= self->size && grow(self))
+		return 1;
+
+	if (!self->names) {
+		self->names = gp_htable_new(0, 0);
+		if (!self->names)
+			return 1;
+	}
+
+	if (!self->sorted) {
+		self->entries[self->used++] = entry;
+		self->filter_dirty = 1;
+		goto exit;
+	}
+
+	pos = sorted_pos(self, self->entries, self->used, entry);
+	arr_ins(self->entries, self->used, pos, entry);
+
+	if (!self->filter_dirty) {
+		size_t used_filter = self->used - self->filtered;
+
+		pos = sorted_pos(self, self->entries_filter, used_filter, entry);
+		arr_ins(self->entries_filter, used_filter, pos, entry);
+	}
+
+	self->used++;
+exit:
+	gp_htable_put(self->names, entry, entry->name);
+	return 0;
+}
+
+gp_dir_entry *gp_dir_cache_add_entry(gp_dir_cache *self, size_t size,
+                                     const char *name, mode_t mode, time_t mtime)
+{
+	size_t name_len = strlen(name);
+	size_t entry_size;
+	int is_dir = 0;
+	gp_dir_entry *entry;
+
+	if ((mode & S_IFMT) == S_IFDIR)
+		is_dir = 1;
+
+	entry_size = sizeof(gp_dir_entry) + name_len + is_dir + 1;
+
+	entry = gp_balloc(&self->allocator, entry_size);
+	if (!entry)
+		return NULL;
+
+	entry->size = size;
+	entry->is_dir = is_dir;
+	entry->filtered = 0;
+	entry->name_len = name_len;
+	entry->mtime = mtime;
+	sprintf(entry->name, "%s%s", name, is_dir ? "/" : "");
+
+	GP_DEBUG(3, "Dir Cache %p new entry '%s' size %zuB", self, entry->name, size);
+
+	/* E.g. file moved over an existing file */
+	if (self->names && gp_htable_get(self->names, entry->name))
+		gp_dir_cache_rem_entry_by_name(self, entry->name);
+
+	if (add_entry(self, entry))
+		return NULL;
+
+	return entry;
+}
+
+int gp_dir_cache_rem_entry_by_name(gp_dir_cache *self, const char *name)
+{
+	gp_dir_entry *entry;
+	size_t pos;
+
+	if (!self->names)
+		return 1;
+
+	entry = gp_htable_rem(self->names, name);
+	if (!entry)
+		return 1;
+
+	pos = entry_pos(self, self->entries, self->used, entry);
+	arr_rem(self->entries, self->used, pos);
+
+	if (entry->filtered) {
+		self->filtered--;
+	} else if (!self->filter_dirty) {
+		size_t used_filter = self->used - self->filtered;
+
+		pos = entry_pos(self, self->entries_filter, used_filter, entry);
+		arr_rem(self->entries_filter, used_filter, pos);
+	}
+
+	self->used--;
+
+	return 0;
+}
+
+gp_dir_entry *gp_dir_cache_entry_lookup(gp_dir_cache *self, const char *name)
+{
+	char buf[NAME_MAX + 2];
+	gp_dir_entry *entry;
+	size_t len;
+
+	if (!self->names)
+		return NULL;
+
+	entry = gp_htable_get(self->names, name);
+	if (entry)
+		return entry;
+
+	/* Directories are stored with a trailing slash */
+	len = strlen(name);
+	if (!len || len > NAME_MAX || name[len-1] == '/')
+		return NULL;
+
+	memcpy(buf, name, len);
+	buf[len] = '/';
+	buf[len+1] = 0;
+
+	return gp_htable_get(self->names, buf);
+}
+
+void gp_dir_cache_free_entries(gp_dir_cache *self)
+{
+	gp_bfree(&self->allocator);
+	gp_htable_free(self->names);
+	free(self->entries);
+	free(self->entries_filter);
+}
+
 void gp_dir_cache_sort(gp_dir_cache *self, gp_dir_cache_sort_type  sort_type)
 {
 	int (*cmp_func)(const void *, const void *) = cmp_funcs[sort_type];
@@ -164,8 +339,13 @@ void gp_dir_cache_sort(gp_dir_cache *self, gp_dir_cache_sort_type  sort_type)
 		return;
 
 	self->sort_type = sort_type;
+	self->sorted = 1;
+	self->filter_dirty = 1;
+
+	if (!self->used)
+		return;
 
-	if (strcmp(self->entries[0]->name, "../"))
+	if (!is_parent(self->entries[0]))
 		qsort(self->entries, self->used, sizeof(void*), cmp_func);
 	else
 		qsort(self->entries+1, self->used-1, sizeof(void*), cmp_func);
@@ -173,36 +353,32 @@ void gp_dir_cache_sort(gp_dir_cache *self, gp_dir_cache_sort_type  sort_type)
 
 gp_dir_entry *gp_dir_cache_get_filtered(gp_dir_cache *self, unsigned int pos)
 {
-	unsigned int n, cur_pos = 0;
-
-	for (n = 0; n < self->used; n++) {
-		if (self->entries[n]->filtered)
-			continue;
+	if (pos >= self->used - self->filtered)
+		return NULL;
 
-		if (cur_pos++ == pos)
-			return self->entries[n];
-	}
+	if (self->filter_dirty)
+		filter_rebuild(self);
 
-	return NULL;
+	return self->entries_filter[pos];
 }
 
 unsigned int gp_dir_cache_pos_by_name_filtered(gp_dir_cache *self, const char *name)
 {
-	unsigned int n, cur_pos = 0;
-	size_t len = strlen(name);
+	gp_dir_entry *entry = gp_dir_cache_entry_lookup(self, name);
+	size_t used_filter = self->used - self->filtered;
+	size_t pos;
 
-	for (n = 0; n < self->used; n++) {
-		if (self->entries[n]->filtered)
-			continue;
+	if (!entry || entry->filtered)
+		return (unsigned int)-1;
 
-		if (len == self->entries[n]->name_len &&
-		    !strncmp(self->entries[n]->name, name, len))
-			return cur_pos;
+	if (self->filter_dirty)
+		filter_rebuild(self);
 
-		cur_pos++;
-	}
+	pos = entry_pos(self, self->entries_filter, used_filter, entry);
+	if (pos >= used_filter)
+		return (unsigned int)-1;
 
-	return (unsigned int)-1;
+	return pos;
 }
 
 int gp_dir_cache_entry_name_contains(gp_dir_cache *self, const char *needle)
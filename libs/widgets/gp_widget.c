@@ -77,6 +77,9 @@ void gp_widget_free(gp_widget *self)
 
 	gp_widget_ops_for_each_child(self, gp_widget_free);
 
+	if (self->timer)
+		gp_widget_render_timer_cancel(self);
+
 	ops = gp_widget_ops(self);
 	if (ops->free)
 		ops->free(self);
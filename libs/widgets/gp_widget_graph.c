@@ -2,11 +2,12 @@
 
 /*
 
-   Copyright (c) 2014-2023 Cyril Hrubis <metan@ucw.cz>
+   Copyright (c) 2014-2026 Cyril Hrubis <metan@ucw.cz>
 
  */
 
 #include <math.h>
+#include <limits.h>
 #include <string.h>
 
 #include <widgets/gp_widgets.h>
@@ -14,6 +15,28 @@
 #include <widgets/gp_widget_render.h>
 #include <widgets/gp_widget_json.h>
 
+/*
+ * Monotonic deque for a sliding window minimum/maximum.
+ *
+ * We store sequence numbers of the appended points, the point index in the
+ * data array is seq % max_data_points since the circular buffer appends
+ * sequentially. The deque values are monotonic, hence the front is always
+ * the minimum (maximum) over the window.
+ */
+struct minmax_deque {
+	size_t head;
+	size_t cnt;
+	size_t *seq;
+};
+
+enum minmax_idx {
+	MIN_X,
+	MAX_X,
+	MIN_Y,
+	MAX_Y,
+	MINMAX_CNT,
+};
+
 struct gp_widget_graph {
 	gp_widget_size min_w;
 	gp_widget_size min_h;
@@ -35,6 +58,10 @@ struct gp_widget_graph {
 	enum gp_widgets_color color;
 	gp_cbuffer data_idx;
 	struct gp_widget_graph_point *data;
+
+	/* Sliding window min/max */
+	size_t seq;
+	struct minmax_deque minmax[MINMAX_CNT];
 };
 
 static unsigned int min_w(gp_widget *self, const gp_widget_render_ctx *ctx)
@@ -142,6 +169,99 @@ static void render_fill_graph(struct gp_widget_graph *graph,
 	gp_fill_polygon(pix, 0, 0, pos, poly, col);
 }
 
+/*
+ * Level of detail rendering for graphs with more points than pixels.
+ *
+ * Points are binned into output pixel columns and only the minimum and
+ * maximum in each column is drawn.
+ */
+struct graph_column {
+	gp_coord min_y;
+	gp_coord max_y;
+	gp_coord first_y;
+	gp_coord last_y;
+};
+
+static int graph_use_lod(struct gp_widget_graph *graph, gp_size w)
+{
+	return gp_cbuffer_used(&graph->data_idx) > w;
+}
+
+static void graph_columns(struct gp_widget_graph *graph, struct graph_column *cols,
+                          gp_coord w, gp_coord h)
+{
+	gp_cbuffer_iter iter;
+	gp_coord x;
+
+	for (x = 0; x <= w; x++)
+		cols[x].min_y = INT_MAX;
+
+	GP_CBUFFER_FOREACH(&graph->data_idx, &iter) {
+		gp_coord dx = transform_x(graph, graph->data[iter.idx].x, w);
+		gp_coord dy = transform_y(graph, graph->data[iter.idx].y, h);
+
+		dx = GP_MAX(0, GP_MIN(dx, w));
+
+		if (cols[dx].min_y == INT_MAX) {
+			cols[dx].min_y = dy;
+			cols[dx].max_y = dy;
+			cols[dx].first_y = dy;
+		} else {
+			cols[dx].min_y = GP_MIN(cols[dx].min_y, dy);
+			cols[dx].max_y = GP_MAX(cols[dx].max_y, dy);
+		}
+
+		cols[dx].last_y = dy;
+	}
+}
+
+static void render_lod_graph(struct gp_widget_graph *graph,
+                             gp_pixmap *pix, gp_size w, gp_size h,
+                             const gp_widget_render_ctx *ctx)
+{
+	gp_size line_th = (ctx->fr_thick+1)/2;
+	gp_size r = graph->graph_style == GP_WIDGET_GRAPH_FILL ? 0 : line_th;
+	gp_coord cw = w - 2*r - 1;
+	gp_coord ch = h - 2*r - 1;
+	struct graph_column cols[cw + 1];
+	gp_pixel col = ctx->colors[graph->color];
+	gp_coord x, px = -1;
+
+	graph_columns(graph, cols, cw, ch);
+
+	for (x = 0; x <= cw; x++) {
+		if (cols[x].min_y == INT_MAX)
+			continue;
+
+		switch (graph->graph_style) {
+		case GP_WIDGET_GRAPH_FILL:
+			if (px >= 0 && x - px > 1) {
+				gp_coord poly[] = {
+					px, h - 1,
+					px, cols[px].last_y,
+					x, cols[x].first_y,
+					x, h - 1,
+				};
+				gp_fill_polygon(pix, 0, 0, 4, poly, col);
+			}
+			gp_vline_xyy(pix, x, cols[x].min_y, h - 1, col);
+		break;
+		case GP_WIDGET_GRAPH_LINE:
+			if (px >= 0) {
+				gp_line_th(pix, px + r, cols[px].last_y + r,
+				           x + r, cols[x].first_y + r, line_th, col);
+			}
+		/* fallthrough */
+		default:
+			gp_fill_rect_xyxy(pix, x, cols[x].min_y,
+			                  x + 2*r, cols[x].max_y + 2*r, col);
+		break;
+		}
+
+		px = x;
+	}
+}
+
 static void render(gp_widget *self, const gp_offset *offset,
                    const gp_widget_render_ctx *ctx, int flags)
 {
@@ -159,6 +279,14 @@ static void render(gp_widget *self, const gp_offset *offset,
 
 	gp_sub_pixmap(ctx->buf, &pix, x, y, w, h);
 
+	if (!gp_cbuffer_used(&graph->data_idx))
+		return;
+
+	if (graph_use_lod(graph, w)) {
+		render_lod_graph(graph, &pix, w, h, ctx);
+		return;
+	}
+
 	switch (graph->graph_style) {
 	case GP_WIDGET_GRAPH_POINT:
 		render_point_graph(graph, &pix, w, h, ctx);
@@ -293,10 +421,20 @@ static gp_widget *json_to_graph(gp_json_reader *json, gp_json_val *val, gp_widge
 	return ret;
 }
 
+static void free_(gp_widget *self)
+{
+	struct gp_widget_graph *graph = GP_WIDGET_PAYLOAD(self);
+
+	free((void*)graph->x_label);
+	free((void*)graph->y_label);
+	free(graph->data);
+}
+
 struct gp_widget_ops gp_widget_graph_ops = {
 	.min_w = min_w,
 	.min_h = min_h,
 	.render = render,
+	.free = free_,
 	.from_json = json_to_graph,
 	.id = "graph",
 };
@@ -313,12 +451,26 @@ gp_widget *gp_widget_graph_new(gp_widget_size min_w, gp_widget_size min_h,
 
 	struct gp_widget_graph *graph = GP_WIDGET_PAYLOAD(ret);
 
-	graph->data = malloc(sizeof(struct gp_widget_graph_point) * max_data_points);
+	if (!max_data_points) {
+		GP_WARN("Invalid max_data_points = 0");
+		free(ret);
+		return NULL;
+	}
+
+	/* Data and min/max deques are allocated in one block */
+	graph->data = malloc((sizeof(struct gp_widget_graph_point) +
+	                      MINMAX_CNT * sizeof(size_t)) * max_data_points);
 	if (!graph->data) {
 		free(ret);
 		return NULL;
 	}
 
+	size_t *seqs = (void*)(graph->data + max_data_points);
+	int i;
+
+	for (i = 0; i < MINMAX_CNT; i++)
+		graph->minmax[i].seq = seqs + i * max_data_points;
+
 	if (x_label)
 		graph->x_label = strdup(x_label);
 
@@ -333,32 +485,104 @@ gp_widget *gp_widget_graph_new(gp_widget_size min_w, gp_widget_size min_h,
 	return ret;
 }
 
-static void new_min_max(struct gp_widget_graph *graph)
+static inline double point_val(struct gp_widget_graph *graph,
+                               enum minmax_idx idx, size_t seq)
 {
-	gp_cbuffer_iter iter;
+	struct gp_widget_graph_point *point = &graph->data[seq % graph->data_idx.size];
 
-	size_t first = gp_cbuffer_first(&graph->data_idx);
+	return idx < MIN_Y ? point->x : point->y;
+}
 
-	graph->min_x = graph->data[first].x;
-	graph->max_x = graph->data[first].x;
+static inline size_t deque_pos(struct gp_widget_graph *graph,
+                               struct minmax_deque *deque, size_t i)
+{
+	return (deque->head + i) % graph->data_idx.size;
+}
+
+/*
+ * Removes points that were pushed out of the circular buffer.
+ *
+ * Must be called before the oldest point is overwritten.
+ */
+static void minmax_evict(struct gp_widget_graph *graph)
+{
+	size_t size = graph->data_idx.size;
+	int i;
+
+	if (graph->seq < size)
+		return;
+
+	for (i = 0; i < MINMAX_CNT; i++) {
+		struct minmax_deque *deque = &graph->minmax[i];
+
+		if (deque->cnt && deque->seq[deque->head] <= graph->seq - size) {
+			deque->head = gp_cbuffer_next(&graph->data_idx, deque->head);
+			deque->cnt--;
+		}
+	}
+}
+
+static void minmax_push(struct gp_widget_graph *graph)
+{
+	size_t seq = graph->seq;
+	int i;
+
+	for (i = 0; i < MINMAX_CNT; i++) {
+		struct minmax_deque *deque = &graph->minmax[i];
+		double val = point_val(graph, i, seq);
+
+		while (deque->cnt) {
+			size_t back = deque->seq[deque_pos(graph, deque, deque->cnt - 1)];
+			double back_val = point_val(graph, i, back);
+
+			if (i == MIN_X || i == MIN_Y) {
+				if (back_val < val)
+					break;
+			} else {
+				if (back_val > val)
+					break;
+			}
+
+			deque->cnt--;
+		}
+
+		deque->seq[deque_pos(graph, deque, deque->cnt)] = seq;
+		deque->cnt++;
+	}
+
+	graph->seq++;
+}
+
+static inline double minmax_get(struct gp_widget_graph *graph, enum minmax_idx idx)
+{
+	return point_val(graph, idx, graph->minmax[idx].seq[graph->minmax[idx].head]);
+}
+
+static void new_min_max(struct gp_widget_graph *graph)
+{
+	if (!gp_cbuffer_used(&graph->data_idx))
+		return;
+
+	graph->min_x = minmax_get(graph, MIN_X);
+	graph->max_x = minmax_get(graph, MAX_X);
 
 	if (!graph->min_y_fixed)
-		graph->min_y = graph->data[first].y;
+		graph->min_y = minmax_get(graph, MIN_Y);
 
 	if (!graph->max_y_fixed)
-		graph->max_y = graph->data[first].y;
+		graph->max_y = minmax_get(graph, MAX_Y);
+}
 
-	GP_CBUFFER_FOREACH(&graph->data_idx, &iter) {
-		double x = graph->data[iter.idx].x;
-		double y = graph->data[iter.idx].y;
-
-		graph->min_x = GP_MIN(graph->min_x, x);
-		graph->max_x = GP_MAX(graph->max_x, x);
-		if (!graph->min_y_fixed)
-			graph->min_y = GP_MIN(graph->min_y, y);
-		if (!graph->max_y_fixed)
-			graph->max_y = GP_MAX(graph->max_y, y);
-	}
+static void point_add(struct gp_widget_graph *graph, double x, double y)
+{
+	minmax_evict(graph);
+
+	size_t pos = gp_cbuffer_append(&graph->data_idx);
+
+	graph->data[pos].x = x;
+	graph->data[pos].y = y;
+
+	minmax_push(graph);
 }
 
 void gp_widget_graph_style_set(gp_widget *self, enum gp_widget_graph_style style)
@@ -384,10 +608,32 @@ void gp_widget_graph_point_add(gp_widget *self, double x, double y)
 	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_GRAPH, );
 	struct gp_widget_graph *graph = GP_WIDGET_PAYLOAD(self);
 
-	size_t pos = gp_cbuffer_append(&graph->data_idx);
+	point_add(graph, x, y);
 
-	graph->data[pos].x = x;
-	graph->data[pos].y = y;
+	new_min_max(graph);
+
+	gp_widget_redraw(self);
+}
+
+void gp_widget_graph_points_add(gp_widget *self,
+                                const struct gp_widget_graph_point *points,
+                                size_t points_cnt)
+{
+	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_GRAPH, );
+	struct gp_widget_graph *graph = GP_WIDGET_PAYLOAD(self);
+	size_t i, size = graph->data_idx.size;
+
+	if (!points_cnt)
+		return;
+
+	/* Only the last max_data_points would stay in the buffer */
+	if (points_cnt > size) {
+		points += points_cnt - size;
+		points_cnt = size;
+	}
+
+	for (i = 0; i < points_cnt; i++)
+		point_add(graph, points[i].x, points[i].y);
 
 	new_min_max(graph);
 
@@ -437,6 +683,25 @@ void gp_widget_graph_yrange_clear(gp_widget *self)
 	new_min_max(graph);
 }
 
+void gp_widget_graph_range_get(gp_widget *self, double *min_x, double *max_x,
+                               double *min_y, double *max_y)
+{
+	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_GRAPH, );
+	struct gp_widget_graph *graph = GP_WIDGET_PAYLOAD(self);
+
+	if (min_x)
+		*min_x = graph->min_x;
+
+	if (max_x)
+		*max_x = graph->max_x;
+
+	if (min_y)
+		*min_y = graph->min_y;
+
+	if (max_y)
+		*max_y = graph->max_y;
+}
+
 void gp_widget_graph_color_set(gp_widget *self, enum gp_widgets_color color)
 {
 	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_GRAPH, );
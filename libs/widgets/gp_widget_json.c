@@ -101,41 +101,73 @@ struct on_event_addr {
 	void *priv;
 };
 
+/*
+ * Loader private context, the widget from_json() callbacks get a pointer to
+ * the public part and pass it down to gp_widget_from_json() and the address
+ * lookup functions.
+ */
+struct json_load_ctx {
+	gp_widget_json_ctx ctx;
+	/* Number of callbacks, counted when the order is checked */
+	size_t addrs_cnt;
+};
+
+/*
+ * The callbacks are sorted by id, which is checked when layout is loaded, so
+ * we can do a binary search here.
+ */
+static const gp_widget_json_addr *addr_lookup(const char *name,
+                                              const gp_widget_json_ctx *ctx)
+{
+	const struct json_load_ctx *load_ctx = GP_CONTAINER_OF(ctx, struct json_load_ctx, ctx);
+	const gp_widget_json_addr *addrs = ctx->callbacks->addrs;
+	size_t l = 0, r = load_ctx->addrs_cnt;
+
+	while (l < r) {
+		size_t mid = l + (r - l)/2;
+		int cmp = strcmp(name, addrs[mid].id);
+
+		if (!cmp)
+			return &addrs[mid];
+
+		if (cmp < 0)
+			r = mid;
+		else
+			l = mid + 1;
+	}
+
+	return NULL;
+}
+
 static void on_event_from_callbacks(const char *name,
-                                    const gp_widget_json_callbacks *const callbacks,
+                                    const gp_widget_json_ctx *ctx,
                                     struct on_event_addr *ret)
 {
-	size_t i;
+	const gp_widget_json_addr *addr = addr_lookup(name, ctx);
 
-	//TODO: Interval divison!
-	for (i = 0; callbacks->addrs[i].id; i++) {
-		if (!strcmp(callbacks->addrs[i].id, name)) {
-			GP_DEBUG(3, "Function '%s' addres is %p", name , callbacks->addrs[i].addr);
-			ret->on_event = callbacks->addrs[i].addr;
-			ret->priv = callbacks->default_priv;
-			return;
-		}
+	if (!addr) {
+		GP_WARN("Failed to lookup %s in callbacks", name);
+		return;
 	}
 
-	GP_WARN("Failed to lookup %s in callbacks", name);
+	GP_DEBUG(3, "Function '%s' addres is %p", name, addr->addr);
+	ret->on_event = addr->on_event;
+	ret->priv = ctx->callbacks->default_priv;
 }
 
 static void *struct_from_callbacks(const char *name,
-                                   const gp_widget_json_callbacks *const callbacks)
+                                   const gp_widget_json_ctx *ctx)
 {
-	size_t i;
+	const gp_widget_json_addr *addr = addr_lookup(name, ctx);
 
-	//TODO: Interval divison!
-	for (i = 0; callbacks->addrs[i].id; i++) {
-		if (!strcmp(callbacks->addrs[i].id, name)) {
-			GP_DEBUG(3, "Structure '%s' addres is %p", name , callbacks->addrs[i].addr);
-			return callbacks->addrs[i].addr;
-		}
+	if (!addr) {
+		GP_WARN("Failed to lookup %s in structures", name);
+		return NULL;
 	}
 
-	GP_WARN("Failed to lookup %s in structures", name);
+	GP_DEBUG(3, "Structure '%s' addres is %p", name, addr->addr);
 
-	return NULL;
+	return addr->addr;
 }
 
 void gp_widget_on_event_addr(const char *fn_name,
@@ -143,7 +175,7 @@ void gp_widget_on_event_addr(const char *fn_name,
 			     struct on_event_addr *ret)
 {
 	if (ctx && ctx->callbacks) {
-		on_event_from_callbacks(fn_name, ctx->callbacks, ret);
+		on_event_from_callbacks(fn_name, ctx, ret);
 		return;
 	}
 
@@ -171,7 +203,7 @@ static void *addr_from_callbacks(const char *struct_name,
                                 const gp_widget_json_ctx *ctx)
 {
 	if (ctx && ctx->callbacks)
-		return struct_from_callbacks(struct_name, ctx->callbacks);
+		return struct_from_callbacks(struct_name, ctx);
 
 	if (!ld_handle)
 		return NULL;
@@ -395,15 +427,15 @@ skip:
 	return NULL;
 }
 
-static void check_callback_addrs_sorted(const gp_widget_json_callbacks *const callbacks)
+/*
+ * Checks that the callbacks are sorted and returns their count.
+ */
+static size_t check_callback_addrs_sorted(const gp_widget_json_callbacks *const callbacks)
 {
 	size_t i;
 
-	if (!callbacks)
-		return;
-
-	if (!callbacks->addrs[1].id)
-		return;
+	if (!callbacks || !callbacks->addrs[0].id)
+		return 0;
 
 	for (i = 1; callbacks->addrs[i].id; i++) {
 		int cmp;
@@ -419,6 +451,8 @@ static void check_callback_addrs_sorted(const gp_widget_json_callbacks *const ca
 			         callbacks->addrs[i].id);
 		}
 	}
+
+	return i;
 }
 
 enum info_keys {
@@ -469,13 +503,15 @@ static gp_widget *gp_widgets_from_json(gp_json_reader *json,
                                        const gp_widget_json_callbacks *const callbacks,
                                        gp_htable **uids)
 {
-	gp_widget_json_ctx ctx = {.uids = uids, .callbacks = callbacks};
+	struct json_load_ctx load_ctx = {
+		.ctx = {.uids = uids, .callbacks = callbacks},
+		.addrs_cnt = check_callback_addrs_sorted(callbacks),
+	};
+	gp_widget_json_ctx *ctx = &load_ctx.ctx;
 	gp_widget *ret;
 	char buf[1024];
 	gp_json_val val = {.buf = buf, .buf_size = sizeof(buf)};
 
-	check_callback_addrs_sorted(callbacks);
-
 	if (!gp_json_obj_first(json, &val) ||
 	    strcmp(val.id, "info") ||
 	    val.type != GP_JSON_OBJ) {
@@ -502,11 +538,11 @@ static gp_widget *gp_widgets_from_json(gp_json_reader *json,
 		return NULL;
 	}
 
-	ret = gp_widget_from_json(json, &val, &ctx);
-	if (ret && ctx.focused) {
-		if (!gp_widget_focus_set(ctx.focused)) {
+	ret = gp_widget_from_json(json, &val, ctx);
+	if (ret && ctx->focused) {
+		if (!gp_widget_focus_set(ctx->focused)) {
 			GP_WARN("Failed to focus %p (%s)",
-			        ctx.focused, gp_widget_type_id(ctx.focused));
+			        ctx->focused, gp_widget_type_id(ctx->focused));
 		}
 	}
 
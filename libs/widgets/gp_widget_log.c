@@ -8,19 +8,49 @@
 
 #include <string.h>
 
-#include <utils/gp_vec.h>
+#include <utils/gp_utf.h>
 
 #include <widgets/gp_widgets.h>
 #include <widgets/gp_widget_ops.h>
 #include <widgets/gp_widget_render.h>
 
+/* Default text buffer size per log line for gp_widget_log_new() */
+#define LOG_AVG_LINE_BYTES 128
+/* Minimal text buffer size per log line, used to size the line index */
+#define LOG_MIN_LINE_BYTES 16
+
+struct log_line {
+	/* Offset to the text buffer */
+	size_t off;
+	/* Text length without the terminating null */
+	unsigned int len;
+	/* Cached number of screen lines, valid if wrap_gen matches */
+	unsigned int wrap_gen;
+	unsigned int wrap_lines;
+};
+
 struct gp_widget_log {
 	gp_widget_tattr tattr;
 	unsigned int min_width;
 	unsigned int min_lines;
 
+	/*
+	 * Text is stored in a byte ring, each line is stored continuously and
+	 * null terminated, if it does not fit at the end of the buffer it
+	 * starts at the start of the buffer. The head == tail happens for
+	 * both empty and full log, the number of lines tells them apart.
+	 */
+	char *buf;
+	size_t buf_size;
+	size_t head;
+
 	gp_cbuffer log;
-	char **logs;
+	struct log_line *lines;
+
+	/* Line wrapping cache is invalidated on width and font change */
+	unsigned int wrap_gen;
+	unsigned int wrap_w;
+	const gp_text_style *wrap_font;
 };
 
 static unsigned int min_w(gp_widget *self, const gp_widget_render_ctx *ctx)
@@ -39,6 +69,40 @@ static unsigned int min_h(gp_widget *self, const gp_widget_render_ctx *ctx)
 	return log->min_lines * (ctx->padd + gp_text_ascent(font)) + ctx->padd;
 }
 
+static size_t fit_width(const gp_text_style *font, const char *text, unsigned int line_w)
+{
+	size_t chars = gp_text_fit_width(font, text, line_w);
+
+	/* Make sure we advance even if a single character does not fit */
+	if (!chars && *text)
+		chars = GP_MAX(1, gp_utf8_next_chsz(text, 0));
+
+	return chars;
+}
+
+static unsigned int line_wraps(struct gp_widget_log *log, struct log_line *line)
+{
+	const char *text = log->buf + line->off;
+	size_t len = line->len;
+
+	if (line->wrap_gen == log->wrap_gen)
+		return line->wrap_lines;
+
+	line->wrap_lines = 0;
+
+	do {
+		size_t chars = fit_width(log->wrap_font, text, log->wrap_w);
+
+		text += chars;
+		len -= chars;
+		line->wrap_lines++;
+	} while (len);
+
+	line->wrap_gen = log->wrap_gen;
+
+	return line->wrap_lines;
+}
+
 static void render(gp_widget *self, const gp_offset *offset,
                    const gp_widget_render_ctx *ctx, int flags)
 {
@@ -63,7 +127,14 @@ static void render(gp_widget *self, const gp_offset *offset,
 	if (!gp_cbuffer_used(&log->log))
 		return;
 
-	/* Figure out how many lines we can fit into the box first */
+	if (log->wrap_w != line_w || log->wrap_font != font) {
+		log->wrap_w = line_w;
+		log->wrap_font = font;
+		if (!++log->wrap_gen)
+			log->wrap_gen = 1;
+	}
+
+	/* Figure out how many log lines we need to fill the box first */
 	size_t box_lines = (h - ctx->padd) / line_h;
 	size_t cur_line = 0;
 
@@ -73,12 +144,7 @@ static void render(gp_widget *self, const gp_offset *offset,
 		if (cur_line >= box_lines)
 			break;
 
-		const char *text = log->logs[iter.idx];
-
-		size_t str_width = gp_text_wbbox(font, text);
-		size_t lines_per_str = GP_MAX((size_t)1, str_width / line_w + !!(str_width % line_w));
-
-		cur_line += lines_per_str;
+		cur_line += line_wraps(log, &log->lines[iter.idx]);
 	}
 
 	size_t render_lines = GP_MIN(cur_line, box_lines);
@@ -92,14 +158,14 @@ static void render(gp_widget *self, const gp_offset *offset,
 	size_t first = gp_cbuffer_used(&log->log) - count;
 
 	GP_CBUFFER_FORRANGE(&log->log, &iter, first, count) {
-		const char *line = log->logs[iter.idx];
-		size_t line_len = strlen(line);
+		const char *line = log->buf + log->lines[iter.idx].off;
+		size_t line_len = log->lines[iter.idx].len;
 
 		for (;;) {
 			if (!render_lines)
 				return;
 
-			size_t chars = gp_text_fit_width(font, line, line_w);
+			size_t chars = fit_width(font, line, line_w);
 
 			if (off_lines) {
 				line_len -= chars;
@@ -126,6 +192,7 @@ static void render(gp_widget *self, const gp_offset *offset,
 }
 
 enum keys {
+	MAX_BYTES,
 	MAX_LOGS,
 	MIN_LINES,
 	MIN_WIDTH,
@@ -133,6 +200,7 @@ enum keys {
 };
 
 static const gp_json_obj_attr attrs[] = {
+	GP_JSON_OBJ_ATTR_IDX(MAX_BYTES, "max_bytes", GP_JSON_INT),
 	GP_JSON_OBJ_ATTR_IDX(MAX_LOGS, "max_logs", GP_JSON_INT),
 	GP_JSON_OBJ_ATTR_IDX(MIN_LINES, "min_lines", GP_JSON_INT),
 	GP_JSON_OBJ_ATTR_IDX(MIN_WIDTH, "min_width", GP_JSON_INT),
@@ -149,12 +217,20 @@ static gp_widget *json_to_log(gp_json_reader *json, gp_json_val *val, gp_widget_
 	int width = 80;
 	int lines = 25;
 	int max_logs = 0;
+	int max_bytes = 0;
 	gp_widget_tattr attr = 0;
 
 	(void)ctx;
 
 	GP_JSON_OBJ_FOREACH_FILTER(json, val, &obj_filter, gp_widget_json_attrs) {
 		switch (val->idx) {
+		case MAX_BYTES:
+			max_bytes = val->val_int;
+			if (max_bytes <= 0) {
+				gp_json_warn(json, "Invalid max bytes %i", max_bytes);
+				return NULL;
+			}
+		break;
 		case MAX_LOGS:
 			max_logs = val->val_int;
 			if (lines <= 0) {
@@ -183,7 +259,7 @@ static gp_widget *json_to_log(gp_json_reader *json, gp_json_val *val, gp_widget_
 		}
 	}
 
-	gp_widget *ret = gp_widget_log_new(attr, width, lines, max_logs);
+	gp_widget *ret = gp_widget_log_new_ex(attr, width, lines, max_logs, max_bytes);
 
 	return ret;
 }
@@ -191,15 +267,9 @@ static gp_widget *json_to_log(gp_json_reader *json, gp_json_val *val, gp_widget_
 static void free_(gp_widget *self)
 {
 	struct gp_widget_log *log = GP_WIDGET_PAYLOAD(self);
-	gp_cbuffer_iter iter;
-
-	if (!log->logs)
-		return;
-
-	GP_CBUFFER_FOREACH(&log->log, &iter)
-		free(log->logs[iter.idx]);
 
-	free(log->logs);
+	free(log->lines);
+	free(log->buf);
 }
 
 struct gp_widget_ops gp_widget_log_ops = {
@@ -211,31 +281,125 @@ struct gp_widget_ops gp_widget_log_ops = {
 	.id = "log",
 };
 
+static void evict_first(struct gp_widget_log *log)
+{
+	gp_cbuffer_remove_first(&log->log);
+
+	if (!gp_cbuffer_used(&log->log))
+		log->head = 0;
+}
+
+/*
+ * Finds a continuous space for len bytes in the text buffer, evicting the
+ * oldest lines as needed, and returns an offset to it.
+ */
+static size_t reserve(struct gp_widget_log *log, size_t len)
+{
+	if (gp_cbuffer_used(&log->log) == log->log.size)
+		evict_first(log);
+
+	while (gp_cbuffer_used(&log->log)) {
+		size_t tail = log->lines[gp_cbuffer_first(&log->log)].off;
+
+		if (log->head > tail) {
+			if (log->head + len <= log->buf_size)
+				break;
+
+			if (len <= tail) {
+				log->head = 0;
+				break;
+			}
+		} else {
+			if (log->head + len <= tail)
+				break;
+		}
+
+		evict_first(log);
+	}
+
+	size_t ret = log->head;
+
+	log->head += len;
+
+	return ret;
+}
+
+static void log_append(struct gp_widget_log *log, const char *text)
+{
+	size_t len = strlen(text);
+
+	/* Lines longer than the whole buffer are truncated */
+	if (len >= log->buf_size)
+		len = log->buf_size - 1;
+
+	size_t off = reserve(log, len + 1);
+	size_t idx = gp_cbuffer_append(&log->log);
+
+	memcpy(log->buf + off, text, len);
+	log->buf[off + len] = 0;
+
+	log->lines[idx].off = off;
+	log->lines[idx].len = len;
+	log->lines[idx].wrap_gen = 0;
+}
+
 void gp_widget_log_append(gp_widget *self, const char *text)
 {
 	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_LOG, );
 	struct gp_widget_log *log = GP_WIDGET_PAYLOAD(self);
-	char *str;
 
 	GP_DEBUG(3, "Appending to log widget (%p) '%s'", self, text);
 
-	str = strdup(text);
-	if (!str) {
-		GP_DEBUG(3, "Malloc failed :(");
-		return;
-	}
+	log_append(log, text);
 
-	size_t idx = gp_cbuffer_append(&log->log);
+	gp_widget_redraw(self);
+}
+
+void gp_widget_log_append_lines(gp_widget *self, const char *const lines[],
+                                size_t lines_cnt)
+{
+	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_LOG, );
+	struct gp_widget_log *log = GP_WIDGET_PAYLOAD(self);
+	size_t i;
+
+	GP_DEBUG(3, "Appending %zu lines to log widget (%p)", lines_cnt, self);
+
+	/* Lines that would be evicted by this call are not copied at all */
+	if (lines_cnt > log->log.size) {
+		lines += lines_cnt - log->log.size;
+		lines_cnt = log->log.size;
+	}
 
-	free(log->logs[idx]);
-	log->logs[idx] = str;
+	for (i = 0; i < lines_cnt; i++)
+		log_append(log, lines[i]);
 
 	gp_widget_redraw(self);
 }
 
-gp_widget *gp_widget_log_new(gp_widget_tattr tattr,
-                             unsigned int min_width, unsigned int min_lines,
-			     size_t max_logs)
+size_t gp_widget_log_lines(gp_widget *self)
+{
+	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_LOG, 0);
+	struct gp_widget_log *log = GP_WIDGET_PAYLOAD(self);
+
+	return gp_cbuffer_used(&log->log);
+}
+
+const char *gp_widget_log_line(gp_widget *self, size_t idx)
+{
+	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_LOG, NULL);
+	struct gp_widget_log *log = GP_WIDGET_PAYLOAD(self);
+
+	if (idx >= gp_cbuffer_used(&log->log))
+		return NULL;
+
+	idx = (gp_cbuffer_first(&log->log) + idx) % log->log.size;
+
+	return log->buf + log->lines[idx].off;
+}
+
+gp_widget *gp_widget_log_new_ex(gp_widget_tattr tattr,
+                                unsigned int min_width, unsigned int min_lines,
+                                size_t max_logs, size_t max_bytes)
 {
 	gp_widget *ret;
 
@@ -244,11 +408,23 @@ gp_widget *gp_widget_log_new(gp_widget_tattr tattr,
 		return NULL;
 	}
 
+	if (!max_logs && max_bytes) {
+		max_logs = GP_MAX((size_t)1, max_bytes / LOG_MIN_LINE_BYTES);
+		GP_DEBUG(1, "Defaulting to max logs = max_bytes / %i = %zu",
+		         LOG_MIN_LINE_BYTES, max_logs);
+	}
+
 	if (!max_logs) {
 		max_logs = (size_t)10 * min_lines;
 		GP_DEBUG(1, "Defaulting to max logs = 10 * min_lines = %zu", max_logs);
 	}
 
+	if (!max_bytes) {
+		max_bytes = max_logs * LOG_AVG_LINE_BYTES;
+		GP_DEBUG(1, "Defaulting to max bytes = max_logs * %i = %zu",
+		         LOG_AVG_LINE_BYTES, max_bytes);
+	}
+
 	ret = gp_widget_new(GP_WIDGET_LOG, GP_WIDGET_CLASS_NONE, sizeof(struct gp_widget_log));
 	if (!ret)
 		return NULL;
@@ -258,15 +434,24 @@ gp_widget *gp_widget_log_new(gp_widget_tattr tattr,
 	log->tattr = tattr;
 	log->min_width = min_width;
 	log->min_lines = min_lines;
-	log->logs = malloc(sizeof(char **) * max_logs);
+	log->wrap_gen = 1;
+	log->buf_size = max_bytes;
+	log->buf = malloc(max_bytes);
+	log->lines = malloc(sizeof(struct log_line) * max_logs);
 
-	if (!log->logs) {
+	if (!log->buf || !log->lines) {
 		gp_widget_free(ret);
 		return NULL;
 	}
 
-	memset(log->logs, 0, sizeof(char **) * max_logs);
 	gp_cbuffer_init(&log->log, max_logs);
 
 	return ret;
 }
+
+gp_widget *gp_widget_log_new(gp_widget_tattr tattr,
+                             unsigned int min_width, unsigned int min_lines,
+			     size_t max_logs)
+{
+	return gp_widget_log_new_ex(tattr, min_width, min_lines, max_logs, 0);
+}
@@ -211,8 +211,6 @@ static void widget_resize_w(gp_widget *self, unsigned int w)
 {
 	unsigned int dw = w - self->min_w;
 
-	self->redraw = 1;
-
 	switch (GP_HALIGN_MASK & self->align) {
 	case GP_HCENTER_WEAK:
 	case GP_HCENTER:
@@ -241,8 +239,6 @@ static void widget_resize_h(gp_widget *self, unsigned int h)
 {
 	unsigned int dh = h - self->min_h;
 
-	self->redraw = 1;
-
 	switch (GP_VALIGN_MASK & self->align) {
 	case GP_VCENTER_WEAK:
 	case GP_VCENTER:
@@ -267,14 +263,27 @@ static void widget_resize_h(gp_widget *self, unsigned int h)
 		 h, self->y, self->h);
 }
 
+/*
+ * Widget has been moved or resized. The parent has to repaint the space around
+ * the widget and since the offsets of the siblings may have changed as well
+ * all of its children are redrawn.
+ */
+static void layout_changed(gp_widget *self, int new_wh)
+{
+	self->redraw = 1;
+
+	if (new_wh || !self->parent)
+		return;
+
+	gp_widget_redraw(self->parent);
+	gp_widget_redraw_children(self->parent);
+}
+
 void gp_widget_ops_distribute_w(gp_widget *self, const gp_widget_render_ctx *ctx,
                                 unsigned int w, int new_wh)
 {
 	const struct gp_widget_ops *ops = gp_widget_ops(self);
 
-	if (self->no_resize && !new_wh)
-		return;
-
 	if (self->min_w > w) {
 		GP_WARN("%p (%s) min_w=%u > w=%u",
 			self, gp_widget_type_id(self),
@@ -282,6 +291,7 @@ void gp_widget_ops_distribute_w(gp_widget *self, const gp_widget_render_ctx *ctx
 		w = self->min_w;
 	}
 
+	unsigned int old_x = self->x;
 	unsigned int old_w = self->w;
 
 	widget_resize_w(self, w);
@@ -289,17 +299,23 @@ void gp_widget_ops_distribute_w(gp_widget *self, const gp_widget_render_ctx *ctx
 	if (self->w != old_w)
 		self->resized = 1;
 
+	if (self->x != old_x || self->w != old_w || new_wh) {
+		layout_changed(self, new_wh);
+	} else if (self->no_resize) {
+		GP_DEBUG(4, "Widget %p (%s) layout unchanged, skipping",
+		         self, gp_widget_type_id(self));
+		return;
+	}
+
 	if (ops->distribute_w)
-		ops->distribute_w(self, ctx, 1);
+		ops->distribute_w(self, ctx, new_wh);
 }
 
 void gp_widget_ops_distribute_h(gp_widget *self, const gp_widget_render_ctx *ctx,
                                 unsigned int h, int new_wh)
 {
 	const struct gp_widget_ops *ops = gp_widget_ops(self);
-
-	if (self->no_resize && !new_wh)
-		return;
+	int no_resize = self->no_resize;
 
 	self->no_resize = 1;
 
@@ -310,6 +326,7 @@ void gp_widget_ops_distribute_h(gp_widget *self, const gp_widget_render_ctx *ctx
 		h = self->min_h;
 	}
 
+	unsigned int old_y = self->y;
 	unsigned int old_h = self->h;
 
 	widget_resize_h(self, h);
@@ -317,8 +334,16 @@ void gp_widget_ops_distribute_h(gp_widget *self, const gp_widget_render_ctx *ctx
 	if (self->h != old_h)
 		self->resized = 1;
 
+	if (self->y != old_y || self->h != old_h || new_wh) {
+		layout_changed(self, new_wh);
+	} else if (no_resize && !self->resized) {
+		GP_DEBUG(4, "Widget %p (%s) layout unchanged, skipping",
+		         self, gp_widget_type_id(self));
+		return;
+	}
+
 	if (ops->distribute_h)
-		ops->distribute_h(self, ctx, 1);
+		ops->distribute_h(self, ctx, new_wh);
 
 	if (self->resized) {
 		gp_widget_send_event(self, GP_WIDGET_EVENT_RESIZE, ctx);
@@ -418,8 +443,10 @@ void gp_widget_ops_render(gp_widget *self, const gp_offset *offset,
 
 	ops->render(self, offset, ctx, flags);
 
-	if (ctx->flip)
-		GP_DEBUG(3, "render bbox " GP_BBOX_FMT, GP_BBOX_PARS(*ctx->flip));
+	if (ctx->flip) {
+		GP_DEBUG(3, "render bbox " GP_BBOX_FMT " rects %u",
+		         GP_BBOX_PARS(gp_damage_bbox(ctx->flip)), ctx->flip->cnt);
+	}
 
 	self->redraw = 0;
 	self->redraw_child = 0;
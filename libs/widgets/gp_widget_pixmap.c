@@ -6,6 +6,7 @@
 
  */
 
+#include <stdlib.h>
 #include <string.h>
 
 #include <widgets/gp_widgets.h>
@@ -13,12 +14,27 @@
 #include <widgets/gp_widget_render.h>
 #include <widgets/gp_widget_json.h>
 
+struct pixmap_job {
+	gp_app_job job;
+	gp_widget *widget;
+	gp_pixmap *(*render)(gp_size w, gp_size h, gp_pixel_type type, void *priv);
+	void *priv;
+	gp_size w;
+	gp_size h;
+	gp_pixel_type type;
+	gp_pixmap *res;
+};
+
 struct pixmap_payload {
 	gp_widget_size min_w;
 	gp_widget_size min_h;
 	gp_pixmap *pixmap;
+	/** Background render job, if any */
+	struct pixmap_job *job;
 	int bbox_set:1;
 	int redraw_all:1;
+	/** Set if pixmap was rendered by a job and is owned by the widget */
+	int owns_pixmap:1;
 	/** Bounding box */
 	gp_bbox bbox;
 };
@@ -173,6 +189,20 @@ static int event(gp_widget *self, const gp_widget_render_ctx *ctx, gp_event *ev)
 	return 0;
 }
 
+static void free_(gp_widget *self)
+{
+	struct pixmap_payload *pixmap = GP_WIDGET_PAYLOAD(self);
+
+	if (pixmap->job) {
+		/* The job is freed in the done callback */
+		pixmap->job->widget = NULL;
+		gp_app_job_cancel(&pixmap->job->job);
+	}
+
+	if (pixmap->owns_pixmap)
+		gp_pixmap_free(pixmap->pixmap);
+}
+
 enum keys {
 	H,
 	W,
@@ -240,6 +270,7 @@ struct gp_widget_ops gp_widget_pixmap_ops = {
 	.min_h = min_h,
 	.render = render,
 	.event = event,
+	.free = free_,
 	.from_json = json_to_pixmap,
 	.id = "pixmap",
 };
@@ -319,6 +350,102 @@ gp_pixmap *gp_widget_pixmap_set(gp_widget *self, gp_pixmap *pix)
 	gp_pixmap *ret = pixmap->pixmap;
 
 	pixmap->pixmap = pix;
+	pixmap->owns_pixmap = 0;
 
 	return ret;
 }
+
+static int pixmap_job_run(gp_app_job *self)
+{
+	struct pixmap_job *job = GP_CONTAINER_OF(self, struct pixmap_job, job);
+
+	job->res = job->render(job->w, job->h, job->type, job->priv);
+
+	return !job->res;
+}
+
+static void pixmap_job_done(gp_app_job *self)
+{
+	struct pixmap_job *job = GP_CONTAINER_OF(self, struct pixmap_job, job);
+	gp_widget *widget = job->widget;
+	struct pixmap_payload *pixmap;
+
+	/* Widget was freed or a new job was started */
+	if (!widget) {
+		gp_pixmap_free(job->res);
+		free(job);
+		return;
+	}
+
+	pixmap = GP_WIDGET_PAYLOAD(widget);
+
+	if (!job->res) {
+		GP_WARN("Pixmap (%p) render job failed", widget);
+		pixmap->job = NULL;
+		free(job);
+		return;
+	}
+
+	/* Widget has been resized while we were rendering, start over */
+	if (job->w != widget->w || job->h != widget->h) {
+		GP_DEBUG(2, "Pixmap (%p) resized while rendering, restarting",
+		         widget);
+		gp_pixmap_free(job->res);
+		job->w = widget->w;
+		job->h = widget->h;
+		gp_app_job_submit(self);
+		return;
+	}
+
+	if (pixmap->owns_pixmap)
+		gp_pixmap_free(pixmap->pixmap);
+
+	pixmap->pixmap = job->res;
+	pixmap->owns_pixmap = 1;
+	pixmap->job = NULL;
+	free(job);
+
+	gp_widget_pixmap_redraw_all(widget);
+}
+
+int gp_widget_pixmap_render_async(gp_widget *self,
+                                  gp_pixmap *(*render)(gp_size w, gp_size h,
+                                                       gp_pixel_type type,
+                                                       void *priv),
+                                  void *priv)
+{
+	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_PIXMAP, 1);
+	struct pixmap_payload *pixmap = GP_WIDGET_PAYLOAD(self);
+	const gp_widget_render_ctx *ctx = gp_widgets_render_ctx();
+	struct pixmap_job *job;
+
+	if (pixmap->job) {
+		pixmap->job->widget = NULL;
+		gp_app_job_cancel(&pixmap->job->job);
+		pixmap->job = NULL;
+	}
+
+	job = malloc(sizeof(*job));
+	if (!job) {
+		GP_WARN("Malloc failed :(");
+		return 1;
+	}
+
+	*job = (struct pixmap_job) {
+		.job = {
+			.id = "pixmap render",
+			.run = pixmap_job_run,
+			.done = pixmap_job_done,
+		},
+		.widget = self,
+		.render = render,
+		.priv = priv,
+		.w = self->w,
+		.h = self->h,
+		.type = ctx->pixel_type,
+	};
+
+	pixmap->job = job;
+
+	return gp_app_job_submit(&job->job);
+}
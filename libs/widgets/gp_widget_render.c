@@ -12,6 +12,8 @@
 #include <core/gp_debug.h>
 #include <core/gp_common.h>
 #include <utils/gp_poll.h>
+#include <utils/gp_timer_wheel.h>
+#include <input/gp_time_stamp.h>
 #include <utils/gp_user_path.h>
 #include <backends/gp_backends.h>
 
@@ -275,7 +277,7 @@ static void gp_widget_render_ctx_init(void)
 
 static void render_and_flip(gp_widget *layout, int render_flags)
 {
-	gp_bbox flip = {};
+	gp_damage flip = {};
 
 	ctx.flip = &flip;
 	gp_widget_render(layout, &ctx, render_flags);
@@ -284,12 +286,16 @@ static void render_and_flip(gp_widget *layout, int render_flags)
 	if (cur_dialog)
 		gp_rect_xywh(ctx.buf, layout->x, layout->y, layout->w, layout->h, ctx.text_color);
 
-	if (gp_bbox_empty(flip))
+	if (gp_damage_empty(&flip))
 		return;
 
-	GP_DEBUG(1, "Updating area " GP_BBOX_FMT, GP_BBOX_PARS(flip));
+	GP_DEBUG(1, "Updating %u rects in area " GP_BBOX_FMT,
+	         flip.cnt, GP_BBOX_PARS(gp_damage_bbox(&flip)));
 
-	gp_backend_update_rect_xywh(backend, flip.x, flip.y, flip.w, flip.h);
+	gp_backend_update_damage(backend, &flip);
+
+	if (backend->flip_presents)
+		gp_backend_flip(backend);
 }
 
 void __attribute__ ((visibility ("hidden"))) widget_render_refresh(void)
@@ -310,66 +316,169 @@ void gp_widget_render_zoom(int zoom_inc)
 	gp_widget_render(app_layout, &ctx, GP_WIDGET_RESIZE);
 }
 
+/*
+ * Widget timers are kept in a timer wheel that is driven by a single backend
+ * timer, since there may be many of them and they are restarted frequently.
+ */
+static gp_timer_wheel widget_timers;
+static gp_timer *free_timers;
+
+static uint32_t widget_timers_callback(gp_timer *self)
+{
+	uint64_t now = gp_time_stamp();
+	uint64_t expires;
+
+	(void) self;
+
+	gp_timer_wheel_process(&widget_timers, now);
+
+	expires = gp_timer_wheel_expires(&widget_timers);
+	if (expires == UINT64_MAX)
+		return GP_TIMER_STOP;
+
+	return expires > now ? expires - now : 0;
+}
+
+static gp_timer widget_timers_tmr = {
+	.id = "Widget timers",
+	.callback = widget_timers_callback,
+};
+
+static void widget_timers_update(void)
+{
+	uint64_t now = gp_time_stamp();
+	uint64_t expires = gp_timer_wheel_expires(&widget_timers);
+
+	if (!backend || expires == UINT64_MAX)
+		return;
+
+	if (gp_timer_is_running(&widget_timers_tmr) &&
+	    widget_timers_tmr.expires <= expires)
+		return;
+
+	gp_backend_timer_reschedule(backend, &widget_timers_tmr,
+	                            expires > now ? expires - now : 0);
+}
+
+static uint32_t widget_timer_callback(gp_timer *self)
+{
+	gp_event ev = {
+		.type = GP_EV_TMR,
+		.time = gp_time_stamp(),
+		.tmr = self,
+	};
+
+	gp_ev_queue_put(backend->event_queue, &ev);
+
+	return GP_TIMER_STOP;
+}
+
+static gp_timer *widget_timer_get(void)
+{
+	gp_timer *ret = free_timers;
+
+	if (ret) {
+		free_timers = ret->next;
+		return ret;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (!ret)
+		GP_WARN("Malloc failed :(");
+
+	return ret;
+}
+
+static void widget_timer_put(gp_timer *self)
+{
+	self->next = free_timers;
+	free_timers = self;
+}
+
 static void timer_event(gp_event *ev)
 {
-	struct gp_widget *widget = ev->tmr->priv;
+	gp_timer *timer = ev->tmr;
+	struct gp_widget *widget = timer->priv;
 
-	ev->tmr->priv = NULL;
+	if (timer->callback != widget_timer_callback) {
+		GP_WARN("Unexpected timer event for '%s'", timer->id);
+		return;
+	}
+
+	widget_timer_put(timer);
+
+	/* Timer was canceled after it has expired */
+	if (!widget)
+		return;
+
+	widget->timer = NULL;
 
 	gp_widget_ops_event(widget, &ctx, ev);
 }
 
-static struct gp_timer timers[10];
-
 void gp_widget_render_timer(gp_widget *self, int flags, unsigned int timeout_ms)
 {
-	unsigned int i;
-
-	for (i = 0; i < GP_ARRAY_SIZE(timers); i++) {
-		if (timers[i].priv == self) {
-			if (flags & GP_TIMER_RESCHEDULE) {
-				gp_backend_timer_stop(backend, &timers[i]);
-				timers[i].expires = timeout_ms;
-				gp_backend_timer_start(backend, &timers[i]);
-				return;
-			}
+	gp_timer *timer = self->timer;
 
+	if (timer) {
+		if (!(flags & GP_TIMER_RESCHEDULE)) {
 			GP_WARN("Timer for widget %p (%s) allready running!",
 			        self, gp_widget_type_id(self));
 			return;
 		}
 
-		if (!timers[i].priv)
-			break;
+		if (gp_timer_is_running(timer)) {
+			gp_timer_wheel_rem(&widget_timers, timer);
+			timer->expires = timeout_ms;
+			gp_timer_wheel_ins(&widget_timers, gp_time_stamp(), timer);
+			widget_timers_update();
+			return;
+		}
+
+		/* Timer has expired and the event is queued, start a new one */
+		timer->priv = NULL;
 	}
 
-	if (i >= GP_ARRAY_SIZE(timers)) {
-		GP_WARN("All %zu timers used!", GP_ARRAY_SIZE(timers));
-		gp_timer_queue_dump(backend->timers);
+	timer = widget_timer_get();
+	if (!timer) {
+		self->timer = NULL;
+		return;
 	}
 
-	timers[i].expires = timeout_ms;
-	timers[i].period = GP_TIMER_STOP;
-	timers[i].id = gp_widget_type_id(self);
-	timers[i].priv = self;
+	*timer = (gp_timer) {
+		.expires = timeout_ms,
+		.period = GP_TIMER_STOP,
+		.id = gp_widget_type_id(self),
+		.callback = widget_timer_callback,
+		.priv = self,
+	};
 
-	gp_backend_timer_start(backend, &timers[i]);
+	self->timer = timer;
+
+	if (!gp_timer_wheel_size(&widget_timers))
+		gp_timer_wheel_init(&widget_timers, gp_time_stamp());
+
+	gp_timer_wheel_ins(&widget_timers, gp_time_stamp(), timer);
+	widget_timers_update();
 }
 
 void gp_widget_render_timer_cancel(gp_widget *self)
 {
-	unsigned int i;
+	gp_timer *timer = self->timer;
 
-	for (i = 0; i < GP_ARRAY_SIZE(timers); i++) {
-		if (timers[i].priv == self) {
-			gp_backend_timer_stop(backend, &timers[i]);
-			timers[i].priv = NULL;
-			return;
-		}
+	if (!timer)
+		return;
 
-		if (!timers[i].priv)
-			break;
+	self->timer = NULL;
+
+	if (gp_timer_is_running(timer)) {
+		gp_timer_wheel_rem(&widget_timers, timer);
+		widget_timer_put(timer);
+		return;
 	}
+
+	/* Timer has expired and the event is queued, freed in timer_event() */
+	timer->priv = NULL;
 }
 
 void gp_widgets_redraw(struct gp_widget *layout)
@@ -426,6 +535,31 @@ void gp_app_task_stop(gp_task *task)
 		gp_task_queue_rem(&task_queue, task);
 }
 
+int widgets_main_loop_running(void)
+{
+	return backend && backend->post;
+}
+
+int gp_app_task_post(gp_task *task)
+{
+	if (!backend) {
+		GP_WARN("Tasks cannot be posted before the app main loop starts");
+		return 1;
+	}
+
+	return gp_backend_task_post(backend, task);
+}
+
+int gp_app_ev_post(const gp_event *ev)
+{
+	if (!backend) {
+		GP_WARN("Events cannot be posted before the app main loop starts");
+		return 1;
+	}
+
+	return gp_backend_ev_post(backend, ev);
+}
+
 static gp_dlist fds;
 
 void gp_app_poll_add(gp_fd *fd)
@@ -477,6 +611,9 @@ void gp_widgets_layout_init(gp_widget *layout, const char *win_tittle)
 
 	move_poll(backend);
 
+	if (gp_backend_post_init(backend))
+		GP_WARN("Failed to initialize post queue");
+
 	gp_app_timer_queue_switch(&backend->timers);
 	gp_backend_task_queue_set(backend, &task_queue);
 
@@ -637,6 +774,14 @@ int gp_widgets_event(gp_event *ev, gp_widget *layout)
 		timer_event(ev);
 		handled = 1;
 	break;
+	case GP_EV_USR:
+		/* User events are not meant for widgets */
+		if (gp_app_send_event(GP_WIDGET_EVENT_INPUT, ev))
+			return 0;
+
+		if (app_event_callback)
+			app_event_callback(ev);
+	return 0;
 	}
 
 	if (handled)
@@ -828,8 +973,16 @@ void gp_widgets_main_loop(gp_widget *layout,
 
 void gp_widgets_backend_set(gp_backend *new_backend)
 {
-	if (!backend)
-		backend = new_backend;
+	if (backend)
+		return;
+
+	backend = new_backend;
+
+	if (!backend->pixmap)
+		return;
+
+	ctx.buf = backend->pixmap;
+	ctx.pixel_type = backend->pixmap->pixel_type;
 }
 
 void gp_widgets_quit(void)
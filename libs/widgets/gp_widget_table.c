@@ -22,6 +22,28 @@ static int col_is_sortable(gp_widget_table *tbl, unsigned int head_idx)
 	return col->sortable;
 }
 
+static int sort_task_callback(gp_task *task)
+{
+	gp_widget *self = task->priv;
+	gp_widget_table *tbl = GP_WIDGET_PAYLOAD(self);
+	gp_widget_table_col_desc *col = tbl->header[tbl->sorted_by_col].col_desc;
+	unsigned int progress;
+
+	progress = tbl->col_ops.sort_step(self, tbl->sorted_desc, col->idx,
+	                                  tbl->sort_restart);
+
+	tbl->sort_restart = 0;
+	tbl->sort_progress = GP_MIN(progress, 100u);
+
+	gp_widget_redraw(self);
+
+	if (progress < 100)
+		return 1;
+
+	tbl->sort_running = 0;
+	return 0;
+}
+
 static void sort_by_col(gp_widget *self, int desc, unsigned int head_idx)
 {
 	gp_widget_table *tbl = GP_WIDGET_PAYLOAD(self);
@@ -33,7 +55,19 @@ static void sort_by_col(gp_widget *self, int desc, unsigned int head_idx)
 	if (!col->sortable)
 		return;
 
-	tbl->col_ops.sort(self, desc, col->idx);
+	if (!tbl->col_ops.sort_step) {
+		tbl->col_ops.sort(self, desc, col->idx);
+		return;
+	}
+
+	/* The task callback picks up the column and order from the widget */
+	tbl->sort_restart = 1;
+	tbl->sort_progress = 0;
+
+	if (!tbl->sort_running) {
+		tbl->sort_running = 1;
+		gp_app_task_start(&tbl->sort_task);
+	}
 }
 
 static inline int get_cell(gp_widget *self, gp_widget_table_cell *ret, unsigned int head_idx)
@@ -71,16 +105,60 @@ static unsigned int header_min_w(gp_widget_table *tbl,
 	return text_size;
 }
 
+/*
+ * Maximal number of rows and maximal width in letters used when column widths
+ * are measured from the table data.
+ */
+#define SAMPLE_ROWS 64
+#define SAMPLE_MAX_LETTERS 32
+
+/*
+ * Measures cells in a window of rows starting at the first displayed row so
+ * that the cost does not depend on the table size.
+ */
+static void sample_cols_w(gp_widget *self, const gp_widget_render_ctx *ctx)
+{
+	gp_widget_table *tbl = GP_WIDGET_PAYLOAD(self);
+	unsigned int max_w = gp_text_max_width(ctx->font, SAMPLE_MAX_LETTERS);
+	unsigned int i, j, start_row, rows;
+
+	if (!tbl->col_ops.get_cell || !tbl->rows)
+		return;
+
+	start_row = GP_MIN(tbl->start_row, tbl->rows - 1);
+	rows = GP_MIN(tbl->rows - start_row, (unsigned int)SAMPLE_ROWS);
+
+	if (!seek_row(self, GP_TABLE_ROW_RESET, 0))
+		return;
+
+	if (start_row && !seek_row(self, GP_TABLE_ROW_ADVANCE, start_row))
+		return;
+
+	for (i = 0; i < rows; i++) {
+		for (j = 0; j < tbl->cols; j++) {
+			gp_widget_table_cell cell = {};
+			const gp_text_style *font;
+			unsigned int cell_w;
+
+			if (!get_cell(self, &cell, j) || !cell.text)
+				continue;
+
+			font = gp_widget_tattr_font(cell.tattr & ~GP_TATTR_LARGE, ctx);
+			cell_w = GP_MIN(gp_text_wbbox(font, cell.text), max_w);
+
+			tbl->cols_w[j].min_size = GP_MAX(tbl->cols_w[j].min_size, cell_w);
+		}
+
+		if (!seek_row(self, GP_TABLE_ROW_ADVANCE, 1))
+			break;
+	}
+}
+
 static unsigned int min_w(gp_widget *self, const gp_widget_render_ctx *ctx)
 {
 	struct gp_widget_table *tbl = GP_WIDGET_PAYLOAD(self);
 	unsigned int i, sum_cols_w = 0;
 
-	if (tbl->header) {
-		for (i = 0; i < tbl->cols; i++)
-			tbl->cols_w[i].min_size = header_min_w(tbl, ctx, i);
-	}
-
 	for (i = 0; i < tbl->cols; i++) {
 		unsigned int col_size;
 
@@ -90,9 +168,14 @@ static unsigned int min_w(gp_widget *self, const gp_widget_render_ctx *ctx)
 			col_size = GP_MAX(col_size, header_min_w(tbl, ctx, i));
 
 		tbl->cols_w[i].min_size = col_size;
-		sum_cols_w += col_size;
 	}
 
+	if (tbl->rows_set)
+		sample_cols_w(self, ctx);
+
+	for (i = 0; i < tbl->cols; i++)
+		sum_cols_w += tbl->cols_w[i].min_size;
+
 	return sum_cols_w + (2 * tbl->cols) * ctx->padd;
 }
 
@@ -221,13 +304,23 @@ static unsigned int header_render(gp_widget *self, gp_coord x, gp_coord y,
 
 	gp_hline_xyw(ctx->buf, x, cy, self->w, color);
 
+	if (tbl->sort_running) {
+		gp_size pw = (self->w * tbl->sort_progress) / 100;
+
+		gp_fill_rect_xywh(ctx->buf, x, cy - 1, pw, 3, ctx->accept_color);
+	}
+
 	return header_h(self, ctx);
 }
 
 static unsigned int last_row(gp_widget *self)
 {
+	gp_widget_table *tbl = GP_WIDGET_PAYLOAD(self);
 	int ret;
 
+	if (tbl->rows_set)
+		return tbl->rows;
+
 	ret = seek_row(self, GP_TABLE_ROW_MAX, 0);
 	if (ret >= 0)
 		return ret;
@@ -966,6 +1059,9 @@ static void free_(gp_widget *self)
 {
 	gp_widget_table *tbl = GP_WIDGET_PAYLOAD(self);
 
+	if (tbl->sort_running)
+		gp_app_task_stop(&tbl->sort_task);
+
 	if (!tbl->free)
 		return;
 
@@ -1027,6 +1123,12 @@ gp_widget *gp_widget_table_new(unsigned int cols, unsigned int min_rows,
 	tbl->col_ops.sort = col_ops->sort;
 	tbl->col_ops.get_cell = col_ops->get_cell;
 	tbl->col_ops.seek_row = col_ops->seek_row;
+	tbl->col_ops.sort_step = col_ops->sort_step;
+
+	tbl->sort_task.id = "table sort";
+	tbl->sort_task.prio = GP_TASK_MAX_PRIO;
+	tbl->sort_task.callback = sort_task_callback;
+	tbl->sort_task.priv = ret;
 
 	if (col_ops->on_event)
 		gp_widget_on_event_set(ret, col_ops->on_event, col_ops->on_event_priv);
@@ -1041,6 +1143,25 @@ void gp_widget_table_refresh(gp_widget *self)
 	gp_widget_redraw(self);
 }
 
+void gp_widget_table_rows_set(gp_widget *self, unsigned int rows)
+{
+	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_TABLE, );
+	gp_widget_table *tbl = GP_WIDGET_PAYLOAD(self);
+
+	tbl->rows = rows;
+	tbl->rows_set = 1;
+
+	gp_widget_redraw(self);
+}
+
+bool gp_widget_table_sorting(gp_widget *self)
+{
+	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_TABLE, 0);
+	gp_widget_table *tbl = GP_WIDGET_PAYLOAD(self);
+
+	return tbl->sort_running;
+}
+
 void gp_widget_table_off_set(gp_widget *self, unsigned int off)
 {
 	GP_WIDGET_TYPE_ASSERT(self, GP_WIDGET_TABLE, );
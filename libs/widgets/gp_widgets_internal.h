@@ -27,4 +27,10 @@ void widget_render_refresh(void);
  */
 void widgets_color_scheme_load(void);
 
+/*
+ * Returns true if the app main loop is running and tasks can be posted from
+ * other threads.
+ */
+int widgets_main_loop_running(void);
+
 #endif /* GP_WIDGETS_INTERNAL_H */
@@ -158,7 +158,7 @@ static int parse_inotify_event(gp_dir_cache_linux *self, const char *new_dir, st
 static int dir_cache_inotify(gp_dir_cache_linux *self, const char *new_dir)
 {
 	char buf[2048];
-	int sort = 0;
+	int changed = 0;
 	ssize_t len;
 
 	if (self->inotify_fd.fd <= 0)
@@ -170,16 +170,14 @@ static int dir_cache_inotify(gp_dir_cache_linux *self, const char *new_dir)
 		while (i < len) {
 			struct inotify_event *ev = (void*)(buf+i);
 
-			sort |= parse_inotify_event(self, new_dir, ev);
+			changed |= parse_inotify_event(self, new_dir, ev);
 
 			i += sizeof(struct inotify_event) + ev->len;
 		}
 	}
 
-	if (sort)
-		gp_dir_cache_sort(&self->dir_cache, self->dir_cache.sort_type);
-
-	return sort;
+	/* Entries are inserted and removed in the sort order, no need to resort */
+	return changed;
 }
 
 int gp_dir_cache_notify(gp_dir_cache *cache)
@@ -0,0 +1,285 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+
+  Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+
+ */
+
+/*
+ * Tests the SPI transfer engine against a fake spidev, which is a socket
+ * that preserves message boundaries so that we can check the SPI message
+ * sizes as well as the data.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <core/gp_common.h>
+
+#include "gp_linux_spi.h"
+
+#include "tst_test.h"
+
+#define BUFSIZ_FAKE 1000
+
+struct fake_spi {
+	int fds[2];
+	pthread_t thread;
+	uint8_t data[65536];
+	size_t len;
+	unsigned int msgs;
+	size_t max_msg;
+};
+
+static void *fake_spi_reader(void *arg)
+{
+	struct fake_spi *self = arg;
+	uint8_t buf[BUFSIZ_FAKE * 4];
+	ssize_t ret;
+
+	while ((ret = recv(self->fds[1], buf, sizeof(buf), 0)) > 0) {
+		size_t len = GP_MIN((size_t)ret, sizeof(self->data) - self->len);
+
+		memcpy(self->data + self->len, buf, len);
+		self->len += len;
+		self->msgs++;
+		self->max_msg = GP_MAX(self->max_msg, (size_t)ret);
+	}
+
+	return NULL;
+}
+
+static int fake_spi_open(struct fake_spi *self, struct gp_spi_xfer *xfer)
+{
+	memset(self, 0, sizeof(*self));
+
+	if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, self->fds)) {
+		tst_msg("socketpair() failed");
+		return 1;
+	}
+
+	if (pthread_create(&self->thread, NULL, fake_spi_reader, self)) {
+		tst_msg("pthread_create() failed");
+		goto err;
+	}
+
+	if (gp_spi_xfer_init(xfer, self->fds[0], BUFSIZ_FAKE)) {
+		tst_msg("gp_spi_xfer_init() failed");
+		shutdown(self->fds[0], SHUT_WR);
+		pthread_join(self->thread, NULL);
+		goto err;
+	}
+
+	return 0;
+err:
+	close(self->fds[0]);
+	close(self->fds[1]);
+	return 1;
+}
+
+static void fake_spi_close(struct fake_spi *self, struct gp_spi_xfer *xfer)
+{
+	gp_spi_xfer_exit(xfer);
+
+	shutdown(self->fds[0], SHUT_WR);
+	pthread_join(self->thread, NULL);
+
+	close(self->fds[0]);
+	close(self->fds[1]);
+}
+
+static uint8_t pattern(unsigned int line, unsigned int i)
+{
+	return (line * 7 + i * 13) & 0xff;
+}
+
+static void pattern_conv(uint8_t *buf, unsigned int line, void *priv)
+{
+	size_t i, line_bytes = *(size_t*)priv;
+
+	for (i = 0; i < line_bytes; i++)
+		buf[i] = pattern(line, i);
+}
+
+static int check_data(struct fake_spi *spi, const uint8_t *exp, size_t exp_len,
+                      unsigned int exp_msgs)
+{
+	if (spi->len != exp_len) {
+		tst_msg("Wrong data size %zu expected %zu", spi->len, exp_len);
+		return TST_FAILED;
+	}
+
+	if (memcmp(spi->data, exp, exp_len)) {
+		tst_msg("Data differ");
+		return TST_FAILED;
+	}
+
+	if (spi->max_msg > BUFSIZ_FAKE) {
+		tst_msg("SPI message too large %zu", spi->max_msg);
+		return TST_FAILED;
+	}
+
+	if (spi->msgs != exp_msgs) {
+		tst_msg("Wrong number of SPI messages %u expected %u",
+		        spi->msgs, exp_msgs);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int test_lines(unsigned int lines, size_t line_bytes, unsigned int exp_msgs)
+{
+	struct gp_spi_xfer xfer;
+	struct fake_spi *spi;
+	uint8_t *exp;
+	unsigned int i, j;
+	int ret;
+
+	spi = malloc(sizeof(*spi));
+	exp = malloc(lines * line_bytes);
+	if (!spi || !exp) {
+		tst_msg("Malloc failed");
+		free(spi);
+		free(exp);
+		return TST_UNTESTED;
+	}
+
+	for (i = 0; i < lines; i++) {
+		for (j = 0; j < line_bytes; j++)
+			exp[i * line_bytes + j] = pattern(i, j);
+	}
+
+	if (fake_spi_open(spi, &xfer)) {
+		free(spi);
+		free(exp);
+		return TST_UNTESTED;
+	}
+
+	ret = gp_spi_xfer_lines(&xfer, lines, line_bytes, pattern_conv, &line_bytes);
+
+	fake_spi_close(spi, &xfer);
+
+	if (ret) {
+		tst_msg("gp_spi_xfer_lines() failed");
+		ret = TST_FAILED;
+	} else {
+		ret = check_data(spi, exp, lines * line_bytes, exp_msgs);
+	}
+
+	free(spi);
+	free(exp);
+
+	return ret;
+}
+
+static int xfer_lines_single(void)
+{
+	/* 10 * 37 bytes fits into a single message */
+	return test_lines(10, 37, 1);
+}
+
+static int xfer_lines_double_buffer(void)
+{
+	/* 27 lines per buffer, 100 lines needs 4 buffers */
+	return test_lines(100, 37, 4);
+}
+
+static int xfer_lines_long(void)
+{
+	/* Each line is split into messages of 1000, 1000 and 500 bytes */
+	return test_lines(5, 2500, 15);
+}
+
+static int test_rect(size_t stride, unsigned int lines, size_t line_bytes,
+                     unsigned int exp_msgs)
+{
+	struct gp_spi_xfer xfer;
+	struct fake_spi *spi;
+	uint8_t *src, *exp;
+	unsigned int i, j;
+	int ret;
+
+	spi = malloc(sizeof(*spi));
+	src = malloc(lines * stride);
+	exp = malloc(lines * line_bytes);
+	if (!spi || !src || !exp) {
+		tst_msg("Malloc failed");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	for (i = 0; i < lines; i++) {
+		for (j = 0; j < stride; j++)
+			src[i * stride + j] = pattern(i, j);
+
+		memcpy(exp + i * line_bytes, src + i * stride, line_bytes);
+	}
+
+	if (fake_spi_open(spi, &xfer)) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	ret = gp_spi_xfer_rect(&xfer, src, stride, lines, line_bytes);
+
+	fake_spi_close(spi, &xfer);
+
+	if (ret) {
+		tst_msg("gp_spi_xfer_rect() failed");
+		ret = TST_FAILED;
+	} else {
+		ret = check_data(spi, exp, lines * line_bytes, exp_msgs);
+	}
+
+exit:
+	free(spi);
+	free(src);
+	free(exp);
+	return ret;
+}
+
+static int xfer_rect_continuous(void)
+{
+	/* Sent directly from the source buffer in 1000 bytes messages */
+	return test_rect(50, 100, 50, 5);
+}
+
+static int xfer_rect_stride(void)
+{
+	/* 100 lines per buffer, 350 lines needs 4 buffers */
+	return test_rect(64, 350, 10, 4);
+}
+
+static int xfer_rect_gather(void)
+{
+	/* Single byte from each line, as the st7565 does */
+	return test_rect(8, 128, 1, 1);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "SPI transfer testsuite",
+	.tests = {
+		{.name = "SPI xfer lines single buffer",
+		 .tst_fn = xfer_lines_single},
+
+		{.name = "SPI xfer lines double buffer",
+		 .tst_fn = xfer_lines_double_buffer},
+
+		{.name = "SPI xfer lines larger than bufsiz",
+		 .tst_fn = xfer_lines_long},
+
+		{.name = "SPI xfer rect continuous",
+		 .tst_fn = xfer_rect_continuous},
+
+		{.name = "SPI xfer rect stride",
+		 .tst_fn = xfer_rect_stride},
+
+		{.name = "SPI xfer rect gather",
+		 .tst_fn = xfer_rect_gather},
+
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,25752 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * blit_conv.gen.c
+ *
+ * GENERATED on 2026 10 19 16:37:01 from blit_conv.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Blit conversions tests.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_convert.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_blit.h>
+
+#include "tst_test.h"
+
+static void fill_pixmap(gp_pixmap *c, gp_pixel p)
+{
+	gp_coord x, y;
+
+	for (x = 0; x < (gp_coord)c->w; x++)
+		for (y = 0; y < (gp_coord)c->h; y++)
+			gp_putpixel(c, x, y, p);
+}
+
+static void mess_pixmap(gp_pixmap *c)
+{
+	gp_coord y;
+	unsigned int i;
+
+	for (y = 0; y < (gp_coord)c->h; y++) {
+		uint8_t *row = GP_PIXEL_ADDR(c, 0, y);
+		for (i = 0; i < c->bytes_per_row; i++) {
+			row[i] = y ^ i;
+		}
+	}
+}
+
+static int check_filled(gp_pixmap *c, gp_pixel p)
+{
+	gp_coord x, y;
+	gp_pixel pc;
+
+	for (x = 0; x < (gp_coord)c->w; x++) {
+		for (y = 0; y < (gp_coord)c->h; y++) {
+			pc = gp_getpixel(c, x, y);
+			if (p != pc) {
+				tst_msg("Pixels different %08x %08x", p, pc);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static gp_pixel rgb_to_pixel(int r, int g, int b, gp_pixmap *c)
+{
+	if (gp_pixel_has_flags(c->pixel_type, GP_PIXEL_HAS_ALPHA))
+		return gp_rgba_to_pixmap_pixel(r, g, b, 0xff, c);
+
+	return gp_rgb_to_pixmap_pixel(r, g, b, c);
+}
+
+static int blit_black_RGB101010_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB101010_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_xRGB8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGBA8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_BGR888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB555_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_BE_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB565_LE_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB666_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_RGB332_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_CMYK8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_DB_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_DB_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_DB_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G1_UB_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G2_UB_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G4_UB_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G8_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_GA88_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_black_G16_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB101010_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_xRGB8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGBA8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_BGR888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB555_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_BE_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB565_LE_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB666_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_RGB332_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_CMYK8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_DB_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_DB_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_DB_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G1_UB_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G2_UB_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G4_UB_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G8_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_GA88_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_white_G16_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+
+static int blit_equal_pixel_RGB101010_to_RGB101010(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB101010);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_xRGB8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_RGBA8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_RGB888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_BGR888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_RGB555_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_RGB565_BE_to_RGB565_BE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_BE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_RGB565_LE_to_RGB565_LE(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565_LE);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_RGB666_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_RGB332_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_CMYK8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_G1_DB_to_G1_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_G2_DB_to_G2_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_G4_DB_to_G4_DB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_DB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_G1_UB_to_G1_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_G2_UB_to_G2_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_G4_UB_to_G4_UB(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4_UB);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_G8_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_GA88_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_equal_pixel_G16_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+
+
+static int blit_red_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_green_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_blue_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_gray_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xef, 0xef, 0xef, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xef, 0xef, 0xef, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_red_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_green_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_blue_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int blit_gray_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xef, 0xef, 0xef, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xef, 0xef, 0xef, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Blit Conversions Testsuite",
+	.tests = {
+		{.name = "Blit black RGB101010 to RGB101010",
+		 .tst_fn = blit_black_RGB101010_to_RGB101010},
+		{.name = "Blit white RGB101010 to RGB101010",
+		 .tst_fn = blit_white_RGB101010_to_RGB101010},
+		{.name = "Blit black RGB101010 to xRGB8888",
+		 .tst_fn = blit_black_RGB101010_to_xRGB8888},
+		{.name = "Blit white RGB101010 to xRGB8888",
+		 .tst_fn = blit_white_RGB101010_to_xRGB8888},
+		{.name = "Blit black RGB101010 to RGBA8888",
+		 .tst_fn = blit_black_RGB101010_to_RGBA8888},
+		{.name = "Blit white RGB101010 to RGBA8888",
+		 .tst_fn = blit_white_RGB101010_to_RGBA8888},
+		{.name = "Blit black RGB101010 to RGB888",
+		 .tst_fn = blit_black_RGB101010_to_RGB888},
+		{.name = "Blit white RGB101010 to RGB888",
+		 .tst_fn = blit_white_RGB101010_to_RGB888},
+		{.name = "Blit black RGB101010 to BGR888",
+		 .tst_fn = blit_black_RGB101010_to_BGR888},
+		{.name = "Blit white RGB101010 to BGR888",
+		 .tst_fn = blit_white_RGB101010_to_BGR888},
+		{.name = "Blit black RGB101010 to RGB555",
+		 .tst_fn = blit_black_RGB101010_to_RGB555},
+		{.name = "Blit white RGB101010 to RGB555",
+		 .tst_fn = blit_white_RGB101010_to_RGB555},
+		{.name = "Blit black RGB101010 to RGB565_BE",
+		 .tst_fn = blit_black_RGB101010_to_RGB565_BE},
+		{.name = "Blit white RGB101010 to RGB565_BE",
+		 .tst_fn = blit_white_RGB101010_to_RGB565_BE},
+		{.name = "Blit black RGB101010 to RGB565_LE",
+		 .tst_fn = blit_black_RGB101010_to_RGB565_LE},
+		{.name = "Blit white RGB101010 to RGB565_LE",
+		 .tst_fn = blit_white_RGB101010_to_RGB565_LE},
+		{.name = "Blit black RGB101010 to RGB666",
+		 .tst_fn = blit_black_RGB101010_to_RGB666},
+		{.name = "Blit white RGB101010 to RGB666",
+		 .tst_fn = blit_white_RGB101010_to_RGB666},
+		{.name = "Blit black RGB101010 to RGB332",
+		 .tst_fn = blit_black_RGB101010_to_RGB332},
+		{.name = "Blit white RGB101010 to RGB332",
+		 .tst_fn = blit_white_RGB101010_to_RGB332},
+		{.name = "Blit black RGB101010 to CMYK8888",
+		 .tst_fn = blit_black_RGB101010_to_CMYK8888},
+		{.name = "Blit white RGB101010 to CMYK8888",
+		 .tst_fn = blit_white_RGB101010_to_CMYK8888},
+		{.name = "Blit black RGB101010 to G1_DB",
+		 .tst_fn = blit_black_RGB101010_to_G1_DB},
+		{.name = "Blit white RGB101010 to G1_DB",
+		 .tst_fn = blit_white_RGB101010_to_G1_DB},
+		{.name = "Blit black RGB101010 to G2_DB",
+		 .tst_fn = blit_black_RGB101010_to_G2_DB},
+		{.name = "Blit white RGB101010 to G2_DB",
+		 .tst_fn = blit_white_RGB101010_to_G2_DB},
+		{.name = "Blit black RGB101010 to G4_DB",
+		 .tst_fn = blit_black_RGB101010_to_G4_DB},
+		{.name = "Blit white RGB101010 to G4_DB",
+		 .tst_fn = blit_white_RGB101010_to_G4_DB},
+		{.name = "Blit black RGB101010 to G1_UB",
+		 .tst_fn = blit_black_RGB101010_to_G1_UB},
+		{.name = "Blit white RGB101010 to G1_UB",
+		 .tst_fn = blit_white_RGB101010_to_G1_UB},
+		{.name = "Blit black RGB101010 to G2_UB",
+		 .tst_fn = blit_black_RGB101010_to_G2_UB},
+		{.name = "Blit white RGB101010 to G2_UB",
+		 .tst_fn = blit_white_RGB101010_to_G2_UB},
+		{.name = "Blit black RGB101010 to G4_UB",
+		 .tst_fn = blit_black_RGB101010_to_G4_UB},
+		{.name = "Blit white RGB101010 to G4_UB",
+		 .tst_fn = blit_white_RGB101010_to_G4_UB},
+		{.name = "Blit black RGB101010 to G8",
+		 .tst_fn = blit_black_RGB101010_to_G8},
+		{.name = "Blit white RGB101010 to G8",
+		 .tst_fn = blit_white_RGB101010_to_G8},
+		{.name = "Blit black RGB101010 to GA88",
+		 .tst_fn = blit_black_RGB101010_to_GA88},
+		{.name = "Blit white RGB101010 to GA88",
+		 .tst_fn = blit_white_RGB101010_to_GA88},
+		{.name = "Blit black RGB101010 to G16",
+		 .tst_fn = blit_black_RGB101010_to_G16},
+		{.name = "Blit white RGB101010 to G16",
+		 .tst_fn = blit_white_RGB101010_to_G16},
+		{.name = "Blit black xRGB8888 to RGB101010",
+		 .tst_fn = blit_black_xRGB8888_to_RGB101010},
+		{.name = "Blit white xRGB8888 to RGB101010",
+		 .tst_fn = blit_white_xRGB8888_to_RGB101010},
+		{.name = "Blit black xRGB8888 to xRGB8888",
+		 .tst_fn = blit_black_xRGB8888_to_xRGB8888},
+		{.name = "Blit white xRGB8888 to xRGB8888",
+		 .tst_fn = blit_white_xRGB8888_to_xRGB8888},
+		{.name = "Blit black xRGB8888 to RGBA8888",
+		 .tst_fn = blit_black_xRGB8888_to_RGBA8888},
+		{.name = "Blit white xRGB8888 to RGBA8888",
+		 .tst_fn = blit_white_xRGB8888_to_RGBA8888},
+		{.name = "Blit black xRGB8888 to RGB888",
+		 .tst_fn = blit_black_xRGB8888_to_RGB888},
+		{.name = "Blit white xRGB8888 to RGB888",
+		 .tst_fn = blit_white_xRGB8888_to_RGB888},
+		{.name = "Blit black xRGB8888 to BGR888",
+		 .tst_fn = blit_black_xRGB8888_to_BGR888},
+		{.name = "Blit white xRGB8888 to BGR888",
+		 .tst_fn = blit_white_xRGB8888_to_BGR888},
+		{.name = "Blit black xRGB8888 to RGB555",
+		 .tst_fn = blit_black_xRGB8888_to_RGB555},
+		{.name = "Blit white xRGB8888 to RGB555",
+		 .tst_fn = blit_white_xRGB8888_to_RGB555},
+		{.name = "Blit black xRGB8888 to RGB565_BE",
+		 .tst_fn = blit_black_xRGB8888_to_RGB565_BE},
+		{.name = "Blit white xRGB8888 to RGB565_BE",
+		 .tst_fn = blit_white_xRGB8888_to_RGB565_BE},
+		{.name = "Blit black xRGB8888 to RGB565_LE",
+		 .tst_fn = blit_black_xRGB8888_to_RGB565_LE},
+		{.name = "Blit white xRGB8888 to RGB565_LE",
+		 .tst_fn = blit_white_xRGB8888_to_RGB565_LE},
+		{.name = "Blit black xRGB8888 to RGB666",
+		 .tst_fn = blit_black_xRGB8888_to_RGB666},
+		{.name = "Blit white xRGB8888 to RGB666",
+		 .tst_fn = blit_white_xRGB8888_to_RGB666},
+		{.name = "Blit black xRGB8888 to RGB332",
+		 .tst_fn = blit_black_xRGB8888_to_RGB332},
+		{.name = "Blit white xRGB8888 to RGB332",
+		 .tst_fn = blit_white_xRGB8888_to_RGB332},
+		{.name = "Blit black xRGB8888 to CMYK8888",
+		 .tst_fn = blit_black_xRGB8888_to_CMYK8888},
+		{.name = "Blit white xRGB8888 to CMYK8888",
+		 .tst_fn = blit_white_xRGB8888_to_CMYK8888},
+		{.name = "Blit black xRGB8888 to G1_DB",
+		 .tst_fn = blit_black_xRGB8888_to_G1_DB},
+		{.name = "Blit white xRGB8888 to G1_DB",
+		 .tst_fn = blit_white_xRGB8888_to_G1_DB},
+		{.name = "Blit black xRGB8888 to G2_DB",
+		 .tst_fn = blit_black_xRGB8888_to_G2_DB},
+		{.name = "Blit white xRGB8888 to G2_DB",
+		 .tst_fn = blit_white_xRGB8888_to_G2_DB},
+		{.name = "Blit black xRGB8888 to G4_DB",
+		 .tst_fn = blit_black_xRGB8888_to_G4_DB},
+		{.name = "Blit white xRGB8888 to G4_DB",
+		 .tst_fn = blit_white_xRGB8888_to_G4_DB},
+		{.name = "Blit black xRGB8888 to G1_UB",
+		 .tst_fn = blit_black_xRGB8888_to_G1_UB},
+		{.name = "Blit white xRGB8888 to G1_UB",
+		 .tst_fn = blit_white_xRGB8888_to_G1_UB},
+		{.name = "Blit black xRGB8888 to G2_UB",
+		 .tst_fn = blit_black_xRGB8888_to_G2_UB},
+		{.name = "Blit white xRGB8888 to G2_UB",
+		 .tst_fn = blit_white_xRGB8888_to_G2_UB},
+		{.name = "Blit black xRGB8888 to G4_UB",
+		 .tst_fn = blit_black_xRGB8888_to_G4_UB},
+		{.name = "Blit white xRGB8888 to G4_UB",
+		 .tst_fn = blit_white_xRGB8888_to_G4_UB},
+		{.name = "Blit black xRGB8888 to G8",
+		 .tst_fn = blit_black_xRGB8888_to_G8},
+		{.name = "Blit white xRGB8888 to G8",
+		 .tst_fn = blit_white_xRGB8888_to_G8},
+		{.name = "Blit black xRGB8888 to GA88",
+		 .tst_fn = blit_black_xRGB8888_to_GA88},
+		{.name = "Blit white xRGB8888 to GA88",
+		 .tst_fn = blit_white_xRGB8888_to_GA88},
+		{.name = "Blit black xRGB8888 to G16",
+		 .tst_fn = blit_black_xRGB8888_to_G16},
+		{.name = "Blit white xRGB8888 to G16",
+		 .tst_fn = blit_white_xRGB8888_to_G16},
+		{.name = "Blit black RGBA8888 to RGB101010",
+		 .tst_fn = blit_black_RGBA8888_to_RGB101010},
+		{.name = "Blit white RGBA8888 to RGB101010",
+		 .tst_fn = blit_white_RGBA8888_to_RGB101010},
+		{.name = "Blit black RGBA8888 to xRGB8888",
+		 .tst_fn = blit_black_RGBA8888_to_xRGB8888},
+		{.name = "Blit white RGBA8888 to xRGB8888",
+		 .tst_fn = blit_white_RGBA8888_to_xRGB8888},
+		{.name = "Blit black RGBA8888 to RGBA8888",
+		 .tst_fn = blit_black_RGBA8888_to_RGBA8888},
+		{.name = "Blit white RGBA8888 to RGBA8888",
+		 .tst_fn = blit_white_RGBA8888_to_RGBA8888},
+		{.name = "Blit black RGBA8888 to RGB888",
+		 .tst_fn = blit_black_RGBA8888_to_RGB888},
+		{.name = "Blit white RGBA8888 to RGB888",
+		 .tst_fn = blit_white_RGBA8888_to_RGB888},
+		{.name = "Blit black RGBA8888 to BGR888",
+		 .tst_fn = blit_black_RGBA8888_to_BGR888},
+		{.name = "Blit white RGBA8888 to BGR888",
+		 .tst_fn = blit_white_RGBA8888_to_BGR888},
+		{.name = "Blit black RGBA8888 to RGB555",
+		 .tst_fn = blit_black_RGBA8888_to_RGB555},
+		{.name = "Blit white RGBA8888 to RGB555",
+		 .tst_fn = blit_white_RGBA8888_to_RGB555},
+		{.name = "Blit black RGBA8888 to RGB565_BE",
+		 .tst_fn = blit_black_RGBA8888_to_RGB565_BE},
+		{.name = "Blit white RGBA8888 to RGB565_BE",
+		 .tst_fn = blit_white_RGBA8888_to_RGB565_BE},
+		{.name = "Blit black RGBA8888 to RGB565_LE",
+		 .tst_fn = blit_black_RGBA8888_to_RGB565_LE},
+		{.name = "Blit white RGBA8888 to RGB565_LE",
+		 .tst_fn = blit_white_RGBA8888_to_RGB565_LE},
+		{.name = "Blit black RGBA8888 to RGB666",
+		 .tst_fn = blit_black_RGBA8888_to_RGB666},
+		{.name = "Blit white RGBA8888 to RGB666",
+		 .tst_fn = blit_white_RGBA8888_to_RGB666},
+		{.name = "Blit black RGBA8888 to RGB332",
+		 .tst_fn = blit_black_RGBA8888_to_RGB332},
+		{.name = "Blit white RGBA8888 to RGB332",
+		 .tst_fn = blit_white_RGBA8888_to_RGB332},
+		{.name = "Blit black RGBA8888 to CMYK8888",
+		 .tst_fn = blit_black_RGBA8888_to_CMYK8888},
+		{.name = "Blit white RGBA8888 to CMYK8888",
+		 .tst_fn = blit_white_RGBA8888_to_CMYK8888},
+		{.name = "Blit black RGBA8888 to G1_DB",
+		 .tst_fn = blit_black_RGBA8888_to_G1_DB},
+		{.name = "Blit white RGBA8888 to G1_DB",
+		 .tst_fn = blit_white_RGBA8888_to_G1_DB},
+		{.name = "Blit black RGBA8888 to G2_DB",
+		 .tst_fn = blit_black_RGBA8888_to_G2_DB},
+		{.name = "Blit white RGBA8888 to G2_DB",
+		 .tst_fn = blit_white_RGBA8888_to_G2_DB},
+		{.name = "Blit black RGBA8888 to G4_DB",
+		 .tst_fn = blit_black_RGBA8888_to_G4_DB},
+		{.name = "Blit white RGBA8888 to G4_DB",
+		 .tst_fn = blit_white_RGBA8888_to_G4_DB},
+		{.name = "Blit black RGBA8888 to G1_UB",
+		 .tst_fn = blit_black_RGBA8888_to_G1_UB},
+		{.name = "Blit white RGBA8888 to G1_UB",
+		 .tst_fn = blit_white_RGBA8888_to_G1_UB},
+		{.name = "Blit black RGBA8888 to G2_UB",
+		 .tst_fn = blit_black_RGBA8888_to_G2_UB},
+		{.name = "Blit white RGBA8888 to G2_UB",
+		 .tst_fn = blit_white_RGBA8888_to_G2_UB},
+		{.name = "Blit black RGBA8888 to G4_UB",
+		 .tst_fn = blit_black_RGBA8888_to_G4_UB},
+		{.name = "Blit white RGBA8888 to G4_UB",
+		 .tst_fn = blit_white_RGBA8888_to_G4_UB},
+		{.name = "Blit black RGBA8888 to G8",
+		 .tst_fn = blit_black_RGBA8888_to_G8},
+		{.name = "Blit white RGBA8888 to G8",
+		 .tst_fn = blit_white_RGBA8888_to_G8},
+		{.name = "Blit black RGBA8888 to GA88",
+		 .tst_fn = blit_black_RGBA8888_to_GA88},
+		{.name = "Blit white RGBA8888 to GA88",
+		 .tst_fn = blit_white_RGBA8888_to_GA88},
+		{.name = "Blit black RGBA8888 to G16",
+		 .tst_fn = blit_black_RGBA8888_to_G16},
+		{.name = "Blit white RGBA8888 to G16",
+		 .tst_fn = blit_white_RGBA8888_to_G16},
+		{.name = "Blit black RGB888 to RGB101010",
+		 .tst_fn = blit_black_RGB888_to_RGB101010},
+		{.name = "Blit white RGB888 to RGB101010",
+		 .tst_fn = blit_white_RGB888_to_RGB101010},
+		{.name = "Blit black RGB888 to xRGB8888",
+		 .tst_fn = blit_black_RGB888_to_xRGB8888},
+		{.name = "Blit white RGB888 to xRGB8888",
+		 .tst_fn = blit_white_RGB888_to_xRGB8888},
+		{.name = "Blit black RGB888 to RGBA8888",
+		 .tst_fn = blit_black_RGB888_to_RGBA8888},
+		{.name = "Blit white RGB888 to RGBA8888",
+		 .tst_fn = blit_white_RGB888_to_RGBA8888},
+		{.name = "Blit black RGB888 to RGB888",
+		 .tst_fn = blit_black_RGB888_to_RGB888},
+		{.name = "Blit white RGB888 to RGB888",
+		 .tst_fn = blit_white_RGB888_to_RGB888},
+		{.name = "Blit black RGB888 to BGR888",
+		 .tst_fn = blit_black_RGB888_to_BGR888},
+		{.name = "Blit white RGB888 to BGR888",
+		 .tst_fn = blit_white_RGB888_to_BGR888},
+		{.name = "Blit black RGB888 to RGB555",
+		 .tst_fn = blit_black_RGB888_to_RGB555},
+		{.name = "Blit white RGB888 to RGB555",
+		 .tst_fn = blit_white_RGB888_to_RGB555},
+		{.name = "Blit black RGB888 to RGB565_BE",
+		 .tst_fn = blit_black_RGB888_to_RGB565_BE},
+		{.name = "Blit white RGB888 to RGB565_BE",
+		 .tst_fn = blit_white_RGB888_to_RGB565_BE},
+		{.name = "Blit black RGB888 to RGB565_LE",
+		 .tst_fn = blit_black_RGB888_to_RGB565_LE},
+		{.name = "Blit white RGB888 to RGB565_LE",
+		 .tst_fn = blit_white_RGB888_to_RGB565_LE},
+		{.name = "Blit black RGB888 to RGB666",
+		 .tst_fn = blit_black_RGB888_to_RGB666},
+		{.name = "Blit white RGB888 to RGB666",
+		 .tst_fn = blit_white_RGB888_to_RGB666},
+		{.name = "Blit black RGB888 to RGB332",
+		 .tst_fn = blit_black_RGB888_to_RGB332},
+		{.name = "Blit white RGB888 to RGB332",
+		 .tst_fn = blit_white_RGB888_to_RGB332},
+		{.name = "Blit black RGB888 to CMYK8888",
+		 .tst_fn = blit_black_RGB888_to_CMYK8888},
+		{.name = "Blit white RGB888 to CMYK8888",
+		 .tst_fn = blit_white_RGB888_to_CMYK8888},
+		{.name = "Blit black RGB888 to G1_DB",
+		 .tst_fn = blit_black_RGB888_to_G1_DB},
+		{.name = "Blit white RGB888 to G1_DB",
+		 .tst_fn = blit_white_RGB888_to_G1_DB},
+		{.name = "Blit black RGB888 to G2_DB",
+		 .tst_fn = blit_black_RGB888_to_G2_DB},
+		{.name = "Blit white RGB888 to G2_DB",
+		 .tst_fn = blit_white_RGB888_to_G2_DB},
+		{.name = "Blit black RGB888 to G4_DB",
+		 .tst_fn = blit_black_RGB888_to_G4_DB},
+		{.name = "Blit white RGB888 to G4_DB",
+		 .tst_fn = blit_white_RGB888_to_G4_DB},
+		{.name = "Blit black RGB888 to G1_UB",
+		 .tst_fn = blit_black_RGB888_to_G1_UB},
+		{.name = "Blit white RGB888 to G1_UB",
+		 .tst_fn = blit_white_RGB888_to_G1_UB},
+		{.name = "Blit black RGB888 to G2_UB",
+		 .tst_fn = blit_black_RGB888_to_G2_UB},
+		{.name = "Blit white RGB888 to G2_UB",
+		 .tst_fn = blit_white_RGB888_to_G2_UB},
+		{.name = "Blit black RGB888 to G4_UB",
+		 .tst_fn = blit_black_RGB888_to_G4_UB},
+		{.name = "Blit white RGB888 to G4_UB",
+		 .tst_fn = blit_white_RGB888_to_G4_UB},
+		{.name = "Blit black RGB888 to G8",
+		 .tst_fn = blit_black_RGB888_to_G8},
+		{.name = "Blit white RGB888 to G8",
+		 .tst_fn = blit_white_RGB888_to_G8},
+		{.name = "Blit black RGB888 to GA88",
+		 .tst_fn = blit_black_RGB888_to_GA88},
+		{.name = "Blit white RGB888 to GA88",
+		 .tst_fn = blit_white_RGB888_to_GA88},
+		{.name = "Blit black RGB888 to G16",
+		 .tst_fn = blit_black_RGB888_to_G16},
+		{.name = "Blit white RGB888 to G16",
+		 .tst_fn = blit_white_RGB888_to_G16},
+		{.name = "Blit black BGR888 to RGB101010",
+		 .tst_fn = blit_black_BGR888_to_RGB101010},
+		{.name = "Blit white BGR888 to RGB101010",
+		 .tst_fn = blit_white_BGR888_to_RGB101010},
+		{.name = "Blit black BGR888 to xRGB8888",
+		 .tst_fn = blit_black_BGR888_to_xRGB8888},
+		{.name = "Blit white BGR888 to xRGB8888",
+		 .tst_fn = blit_white_BGR888_to_xRGB8888},
+		{.name = "Blit black BGR888 to RGBA8888",
+		 .tst_fn = blit_black_BGR888_to_RGBA8888},
+		{.name = "Blit white BGR888 to RGBA8888",
+		 .tst_fn = blit_white_BGR888_to_RGBA8888},
+		{.name = "Blit black BGR888 to RGB888",
+		 .tst_fn = blit_black_BGR888_to_RGB888},
+		{.name = "Blit white BGR888 to RGB888",
+		 .tst_fn = blit_white_BGR888_to_RGB888},
+		{.name = "Blit black BGR888 to BGR888",
+		 .tst_fn = blit_black_BGR888_to_BGR888},
+		{.name = "Blit white BGR888 to BGR888",
+		 .tst_fn = blit_white_BGR888_to_BGR888},
+		{.name = "Blit black BGR888 to RGB555",
+		 .tst_fn = blit_black_BGR888_to_RGB555},
+		{.name = "Blit white BGR888 to RGB555",
+		 .tst_fn = blit_white_BGR888_to_RGB555},
+		{.name = "Blit black BGR888 to RGB565_BE",
+		 .tst_fn = blit_black_BGR888_to_RGB565_BE},
+		{.name = "Blit white BGR888 to RGB565_BE",
+		 .tst_fn = blit_white_BGR888_to_RGB565_BE},
+		{.name = "Blit black BGR888 to RGB565_LE",
+		 .tst_fn = blit_black_BGR888_to_RGB565_LE},
+		{.name = "Blit white BGR888 to RGB565_LE",
+		 .tst_fn = blit_white_BGR888_to_RGB565_LE},
+		{.name = "Blit black BGR888 to RGB666",
+		 .tst_fn = blit_black_BGR888_to_RGB666},
+		{.name = "Blit white BGR888 to RGB666",
+		 .tst_fn = blit_white_BGR888_to_RGB666},
+		{.name = "Blit black BGR888 to RGB332",
+		 .tst_fn = blit_black_BGR888_to_RGB332},
+		{.name = "Blit white BGR888 to RGB332",
+		 .tst_fn = blit_white_BGR888_to_RGB332},
+		{.name = "Blit black BGR888 to CMYK8888",
+		 .tst_fn = blit_black_BGR888_to_CMYK8888},
+		{.name = "Blit white BGR888 to CMYK8888",
+		 .tst_fn = blit_white_BGR888_to_CMYK8888},
+		{.name = "Blit black BGR888 to G1_DB",
+		 .tst_fn = blit_black_BGR888_to_G1_DB},
+		{.name = "Blit white BGR888 to G1_DB",
+		 .tst_fn = blit_white_BGR888_to_G1_DB},
+		{.name = "Blit black BGR888 to G2_DB",
+		 .tst_fn = blit_black_BGR888_to_G2_DB},
+		{.name = "Blit white BGR888 to G2_DB",
+		 .tst_fn = blit_white_BGR888_to_G2_DB},
+		{.name = "Blit black BGR888 to G4_DB",
+		 .tst_fn = blit_black_BGR888_to_G4_DB},
+		{.name = "Blit white BGR888 to G4_DB",
+		 .tst_fn = blit_white_BGR888_to_G4_DB},
+		{.name = "Blit black BGR888 to G1_UB",
+		 .tst_fn = blit_black_BGR888_to_G1_UB},
+		{.name = "Blit white BGR888 to G1_UB",
+		 .tst_fn = blit_white_BGR888_to_G1_UB},
+		{.name = "Blit black BGR888 to G2_UB",
+		 .tst_fn = blit_black_BGR888_to_G2_UB},
+		{.name = "Blit white BGR888 to G2_UB",
+		 .tst_fn = blit_white_BGR888_to_G2_UB},
+		{.name = "Blit black BGR888 to G4_UB",
+		 .tst_fn = blit_black_BGR888_to_G4_UB},
+		{.name = "Blit white BGR888 to G4_UB",
+		 .tst_fn = blit_white_BGR888_to_G4_UB},
+		{.name = "Blit black BGR888 to G8",
+		 .tst_fn = blit_black_BGR888_to_G8},
+		{.name = "Blit white BGR888 to G8",
+		 .tst_fn = blit_white_BGR888_to_G8},
+		{.name = "Blit black BGR888 to GA88",
+		 .tst_fn = blit_black_BGR888_to_GA88},
+		{.name = "Blit white BGR888 to GA88",
+		 .tst_fn = blit_white_BGR888_to_GA88},
+		{.name = "Blit black BGR888 to G16",
+		 .tst_fn = blit_black_BGR888_to_G16},
+		{.name = "Blit white BGR888 to G16",
+		 .tst_fn = blit_white_BGR888_to_G16},
+		{.name = "Blit black RGB555 to RGB101010",
+		 .tst_fn = blit_black_RGB555_to_RGB101010},
+		{.name = "Blit white RGB555 to RGB101010",
+		 .tst_fn = blit_white_RGB555_to_RGB101010},
+		{.name = "Blit black RGB555 to xRGB8888",
+		 .tst_fn = blit_black_RGB555_to_xRGB8888},
+		{.name = "Blit white RGB555 to xRGB8888",
+		 .tst_fn = blit_white_RGB555_to_xRGB8888},
+		{.name = "Blit black RGB555 to RGBA8888",
+		 .tst_fn = blit_black_RGB555_to_RGBA8888},
+		{.name = "Blit white RGB555 to RGBA8888",
+		 .tst_fn = blit_white_RGB555_to_RGBA8888},
+		{.name = "Blit black RGB555 to RGB888",
+		 .tst_fn = blit_black_RGB555_to_RGB888},
+		{.name = "Blit white RGB555 to RGB888",
+		 .tst_fn = blit_white_RGB555_to_RGB888},
+		{.name = "Blit black RGB555 to BGR888",
+		 .tst_fn = blit_black_RGB555_to_BGR888},
+		{.name = "Blit white RGB555 to BGR888",
+		 .tst_fn = blit_white_RGB555_to_BGR888},
+		{.name = "Blit black RGB555 to RGB555",
+		 .tst_fn = blit_black_RGB555_to_RGB555},
+		{.name = "Blit white RGB555 to RGB555",
+		 .tst_fn = blit_white_RGB555_to_RGB555},
+		{.name = "Blit black RGB555 to RGB565_BE",
+		 .tst_fn = blit_black_RGB555_to_RGB565_BE},
+		{.name = "Blit white RGB555 to RGB565_BE",
+		 .tst_fn = blit_white_RGB555_to_RGB565_BE},
+		{.name = "Blit black RGB555 to RGB565_LE",
+		 .tst_fn = blit_black_RGB555_to_RGB565_LE},
+		{.name = "Blit white RGB555 to RGB565_LE",
+		 .tst_fn = blit_white_RGB555_to_RGB565_LE},
+		{.name = "Blit black RGB555 to RGB666",
+		 .tst_fn = blit_black_RGB555_to_RGB666},
+		{.name = "Blit white RGB555 to RGB666",
+		 .tst_fn = blit_white_RGB555_to_RGB666},
+		{.name = "Blit black RGB555 to RGB332",
+		 .tst_fn = blit_black_RGB555_to_RGB332},
+		{.name = "Blit white RGB555 to RGB332",
+		 .tst_fn = blit_white_RGB555_to_RGB332},
+		{.name = "Blit black RGB555 to CMYK8888",
+		 .tst_fn = blit_black_RGB555_to_CMYK8888},
+		{.name = "Blit white RGB555 to CMYK8888",
+		 .tst_fn = blit_white_RGB555_to_CMYK8888},
+		{.name = "Blit black RGB555 to G1_DB",
+		 .tst_fn = blit_black_RGB555_to_G1_DB},
+		{.name = "Blit white RGB555 to G1_DB",
+		 .tst_fn = blit_white_RGB555_to_G1_DB},
+		{.name = "Blit black RGB555 to G2_DB",
+		 .tst_fn = blit_black_RGB555_to_G2_DB},
+		{.name = "Blit white RGB555 to G2_DB",
+		 .tst_fn = blit_white_RGB555_to_G2_DB},
+		{.name = "Blit black RGB555 to G4_DB",
+		 .tst_fn = blit_black_RGB555_to_G4_DB},
+		{.name = "Blit white RGB555 to G4_DB",
+		 .tst_fn = blit_white_RGB555_to_G4_DB},
+		{.name = "Blit black RGB555 to G1_UB",
+		 .tst_fn = blit_black_RGB555_to_G1_UB},
+		{.name = "Blit white RGB555 to G1_UB",
+		 .tst_fn = blit_white_RGB555_to_G1_UB},
+		{.name = "Blit black RGB555 to G2_UB",
+		 .tst_fn = blit_black_RGB555_to_G2_UB},
+		{.name = "Blit white RGB555 to G2_UB",
+		 .tst_fn = blit_white_RGB555_to_G2_UB},
+		{.name = "Blit black RGB555 to G4_UB",
+		 .tst_fn = blit_black_RGB555_to_G4_UB},
+		{.name = "Blit white RGB555 to G4_UB",
+		 .tst_fn = blit_white_RGB555_to_G4_UB},
+		{.name = "Blit black RGB555 to G8",
+		 .tst_fn = blit_black_RGB555_to_G8},
+		{.name = "Blit white RGB555 to G8",
+		 .tst_fn = blit_white_RGB555_to_G8},
+		{.name = "Blit black RGB555 to GA88",
+		 .tst_fn = blit_black_RGB555_to_GA88},
+		{.name = "Blit white RGB555 to GA88",
+		 .tst_fn = blit_white_RGB555_to_GA88},
+		{.name = "Blit black RGB555 to G16",
+		 .tst_fn = blit_black_RGB555_to_G16},
+		{.name = "Blit white RGB555 to G16",
+		 .tst_fn = blit_white_RGB555_to_G16},
+		{.name = "Blit black RGB565_BE to RGB101010",
+		 .tst_fn = blit_black_RGB565_BE_to_RGB101010},
+		{.name = "Blit white RGB565_BE to RGB101010",
+		 .tst_fn = blit_white_RGB565_BE_to_RGB101010},
+		{.name = "Blit black RGB565_BE to xRGB8888",
+		 .tst_fn = blit_black_RGB565_BE_to_xRGB8888},
+		{.name = "Blit white RGB565_BE to xRGB8888",
+		 .tst_fn = blit_white_RGB565_BE_to_xRGB8888},
+		{.name = "Blit black RGB565_BE to RGBA8888",
+		 .tst_fn = blit_black_RGB565_BE_to_RGBA8888},
+		{.name = "Blit white RGB565_BE to RGBA8888",
+		 .tst_fn = blit_white_RGB565_BE_to_RGBA8888},
+		{.name = "Blit black RGB565_BE to RGB888",
+		 .tst_fn = blit_black_RGB565_BE_to_RGB888},
+		{.name = "Blit white RGB565_BE to RGB888",
+		 .tst_fn = blit_white_RGB565_BE_to_RGB888},
+		{.name = "Blit black RGB565_BE to BGR888",
+		 .tst_fn = blit_black_RGB565_BE_to_BGR888},
+		{.name = "Blit white RGB565_BE to BGR888",
+		 .tst_fn = blit_white_RGB565_BE_to_BGR888},
+		{.name = "Blit black RGB565_BE to RGB555",
+		 .tst_fn = blit_black_RGB565_BE_to_RGB555},
+		{.name = "Blit white RGB565_BE to RGB555",
+		 .tst_fn = blit_white_RGB565_BE_to_RGB555},
+		{.name = "Blit black RGB565_BE to RGB565_BE",
+		 .tst_fn = blit_black_RGB565_BE_to_RGB565_BE},
+		{.name = "Blit white RGB565_BE to RGB565_BE",
+		 .tst_fn = blit_white_RGB565_BE_to_RGB565_BE},
+		{.name = "Blit black RGB565_BE to RGB565_LE",
+		 .tst_fn = blit_black_RGB565_BE_to_RGB565_LE},
+		{.name = "Blit white RGB565_BE to RGB565_LE",
+		 .tst_fn = blit_white_RGB565_BE_to_RGB565_LE},
+		{.name = "Blit black RGB565_BE to RGB666",
+		 .tst_fn = blit_black_RGB565_BE_to_RGB666},
+		{.name = "Blit white RGB565_BE to RGB666",
+		 .tst_fn = blit_white_RGB565_BE_to_RGB666},
+		{.name = "Blit black RGB565_BE to RGB332",
+		 .tst_fn = blit_black_RGB565_BE_to_RGB332},
+		{.name = "Blit white RGB565_BE to RGB332",
+		 .tst_fn = blit_white_RGB565_BE_to_RGB332},
+		{.name = "Blit black RGB565_BE to CMYK8888",
+		 .tst_fn = blit_black_RGB565_BE_to_CMYK8888},
+		{.name = "Blit white RGB565_BE to CMYK8888",
+		 .tst_fn = blit_white_RGB565_BE_to_CMYK8888},
+		{.name = "Blit black RGB565_BE to G1_DB",
+		 .tst_fn = blit_black_RGB565_BE_to_G1_DB},
+		{.name = "Blit white RGB565_BE to G1_DB",
+		 .tst_fn = blit_white_RGB565_BE_to_G1_DB},
+		{.name = "Blit black RGB565_BE to G2_DB",
+		 .tst_fn = blit_black_RGB565_BE_to_G2_DB},
+		{.name = "Blit white RGB565_BE to G2_DB",
+		 .tst_fn = blit_white_RGB565_BE_to_G2_DB},
+		{.name = "Blit black RGB565_BE to G4_DB",
+		 .tst_fn = blit_black_RGB565_BE_to_G4_DB},
+		{.name = "Blit white RGB565_BE to G4_DB",
+		 .tst_fn = blit_white_RGB565_BE_to_G4_DB},
+		{.name = "Blit black RGB565_BE to G1_UB",
+		 .tst_fn = blit_black_RGB565_BE_to_G1_UB},
+		{.name = "Blit white RGB565_BE to G1_UB",
+		 .tst_fn = blit_white_RGB565_BE_to_G1_UB},
+		{.name = "Blit black RGB565_BE to G2_UB",
+		 .tst_fn = blit_black_RGB565_BE_to_G2_UB},
+		{.name = "Blit white RGB565_BE to G2_UB",
+		 .tst_fn = blit_white_RGB565_BE_to_G2_UB},
+		{.name = "Blit black RGB565_BE to G4_UB",
+		 .tst_fn = blit_black_RGB565_BE_to_G4_UB},
+		{.name = "Blit white RGB565_BE to G4_UB",
+		 .tst_fn = blit_white_RGB565_BE_to_G4_UB},
+		{.name = "Blit black RGB565_BE to G8",
+		 .tst_fn = blit_black_RGB565_BE_to_G8},
+		{.name = "Blit white RGB565_BE to G8",
+		 .tst_fn = blit_white_RGB565_BE_to_G8},
+		{.name = "Blit black RGB565_BE to GA88",
+		 .tst_fn = blit_black_RGB565_BE_to_GA88},
+		{.name = "Blit white RGB565_BE to GA88",
+		 .tst_fn = blit_white_RGB565_BE_to_GA88},
+		{.name = "Blit black RGB565_BE to G16",
+		 .tst_fn = blit_black_RGB565_BE_to_G16},
+		{.name = "Blit white RGB565_BE to G16",
+		 .tst_fn = blit_white_RGB565_BE_to_G16},
+		{.name = "Blit black RGB565_LE to RGB101010",
+		 .tst_fn = blit_black_RGB565_LE_to_RGB101010},
+		{.name = "Blit white RGB565_LE to RGB101010",
+		 .tst_fn = blit_white_RGB565_LE_to_RGB101010},
+		{.name = "Blit black RGB565_LE to xRGB8888",
+		 .tst_fn = blit_black_RGB565_LE_to_xRGB8888},
+		{.name = "Blit white RGB565_LE to xRGB8888",
+		 .tst_fn = blit_white_RGB565_LE_to_xRGB8888},
+		{.name = "Blit black RGB565_LE to RGBA8888",
+		 .tst_fn = blit_black_RGB565_LE_to_RGBA8888},
+		{.name = "Blit white RGB565_LE to RGBA8888",
+		 .tst_fn = blit_white_RGB565_LE_to_RGBA8888},
+		{.name = "Blit black RGB565_LE to RGB888",
+		 .tst_fn = blit_black_RGB565_LE_to_RGB888},
+		{.name = "Blit white RGB565_LE to RGB888",
+		 .tst_fn = blit_white_RGB565_LE_to_RGB888},
+		{.name = "Blit black RGB565_LE to BGR888",
+		 .tst_fn = blit_black_RGB565_LE_to_BGR888},
+		{.name = "Blit white RGB565_LE to BGR888",
+		 .tst_fn = blit_white_RGB565_LE_to_BGR888},
+		{.name = "Blit black RGB565_LE to RGB555",
+		 .tst_fn = blit_black_RGB565_LE_to_RGB555},
+		{.name = "Blit white RGB565_LE to RGB555",
+		 .tst_fn = blit_white_RGB565_LE_to_RGB555},
+		{.name = "Blit black RGB565_LE to RGB565_BE",
+		 .tst_fn = blit_black_RGB565_LE_to_RGB565_BE},
+		{.name = "Blit white RGB565_LE to RGB565_BE",
+		 .tst_fn = blit_white_RGB565_LE_to_RGB565_BE},
+		{.name = "Blit black RGB565_LE to RGB565_LE",
+		 .tst_fn = blit_black_RGB565_LE_to_RGB565_LE},
+		{.name = "Blit white RGB565_LE to RGB565_LE",
+		 .tst_fn = blit_white_RGB565_LE_to_RGB565_LE},
+		{.name = "Blit black RGB565_LE to RGB666",
+		 .tst_fn = blit_black_RGB565_LE_to_RGB666},
+		{.name = "Blit white RGB565_LE to RGB666",
+		 .tst_fn = blit_white_RGB565_LE_to_RGB666},
+		{.name = "Blit black RGB565_LE to RGB332",
+		 .tst_fn = blit_black_RGB565_LE_to_RGB332},
+		{.name = "Blit white RGB565_LE to RGB332",
+		 .tst_fn = blit_white_RGB565_LE_to_RGB332},
+		{.name = "Blit black RGB565_LE to CMYK8888",
+		 .tst_fn = blit_black_RGB565_LE_to_CMYK8888},
+		{.name = "Blit white RGB565_LE to CMYK8888",
+		 .tst_fn = blit_white_RGB565_LE_to_CMYK8888},
+		{.name = "Blit black RGB565_LE to G1_DB",
+		 .tst_fn = blit_black_RGB565_LE_to_G1_DB},
+		{.name = "Blit white RGB565_LE to G1_DB",
+		 .tst_fn = blit_white_RGB565_LE_to_G1_DB},
+		{.name = "Blit black RGB565_LE to G2_DB",
+		 .tst_fn = blit_black_RGB565_LE_to_G2_DB},
+		{.name = "Blit white RGB565_LE to G2_DB",
+		 .tst_fn = blit_white_RGB565_LE_to_G2_DB},
+		{.name = "Blit black RGB565_LE to G4_DB",
+		 .tst_fn = blit_black_RGB565_LE_to_G4_DB},
+		{.name = "Blit white RGB565_LE to G4_DB",
+		 .tst_fn = blit_white_RGB565_LE_to_G4_DB},
+		{.name = "Blit black RGB565_LE to G1_UB",
+		 .tst_fn = blit_black_RGB565_LE_to_G1_UB},
+		{.name = "Blit white RGB565_LE to G1_UB",
+		 .tst_fn = blit_white_RGB565_LE_to_G1_UB},
+		{.name = "Blit black RGB565_LE to G2_UB",
+		 .tst_fn = blit_black_RGB565_LE_to_G2_UB},
+		{.name = "Blit white RGB565_LE to G2_UB",
+		 .tst_fn = blit_white_RGB565_LE_to_G2_UB},
+		{.name = "Blit black RGB565_LE to G4_UB",
+		 .tst_fn = blit_black_RGB565_LE_to_G4_UB},
+		{.name = "Blit white RGB565_LE to G4_UB",
+		 .tst_fn = blit_white_RGB565_LE_to_G4_UB},
+		{.name = "Blit black RGB565_LE to G8",
+		 .tst_fn = blit_black_RGB565_LE_to_G8},
+		{.name = "Blit white RGB565_LE to G8",
+		 .tst_fn = blit_white_RGB565_LE_to_G8},
+		{.name = "Blit black RGB565_LE to GA88",
+		 .tst_fn = blit_black_RGB565_LE_to_GA88},
+		{.name = "Blit white RGB565_LE to GA88",
+		 .tst_fn = blit_white_RGB565_LE_to_GA88},
+		{.name = "Blit black RGB565_LE to G16",
+		 .tst_fn = blit_black_RGB565_LE_to_G16},
+		{.name = "Blit white RGB565_LE to G16",
+		 .tst_fn = blit_white_RGB565_LE_to_G16},
+		{.name = "Blit black RGB666 to RGB101010",
+		 .tst_fn = blit_black_RGB666_to_RGB101010},
+		{.name = "Blit white RGB666 to RGB101010",
+		 .tst_fn = blit_white_RGB666_to_RGB101010},
+		{.name = "Blit black RGB666 to xRGB8888",
+		 .tst_fn = blit_black_RGB666_to_xRGB8888},
+		{.name = "Blit white RGB666 to xRGB8888",
+		 .tst_fn = blit_white_RGB666_to_xRGB8888},
+		{.name = "Blit black RGB666 to RGBA8888",
+		 .tst_fn = blit_black_RGB666_to_RGBA8888},
+		{.name = "Blit white RGB666 to RGBA8888",
+		 .tst_fn = blit_white_RGB666_to_RGBA8888},
+		{.name = "Blit black RGB666 to RGB888",
+		 .tst_fn = blit_black_RGB666_to_RGB888},
+		{.name = "Blit white RGB666 to RGB888",
+		 .tst_fn = blit_white_RGB666_to_RGB888},
+		{.name = "Blit black RGB666 to BGR888",
+		 .tst_fn = blit_black_RGB666_to_BGR888},
+		{.name = "Blit white RGB666 to BGR888",
+		 .tst_fn = blit_white_RGB666_to_BGR888},
+		{.name = "Blit black RGB666 to RGB555",
+		 .tst_fn = blit_black_RGB666_to_RGB555},
+		{.name = "Blit white RGB666 to RGB555",
+		 .tst_fn = blit_white_RGB666_to_RGB555},
+		{.name = "Blit black RGB666 to RGB565_BE",
+		 .tst_fn = blit_black_RGB666_to_RGB565_BE},
+		{.name = "Blit white RGB666 to RGB565_BE",
+		 .tst_fn = blit_white_RGB666_to_RGB565_BE},
+		{.name = "Blit black RGB666 to RGB565_LE",
+		 .tst_fn = blit_black_RGB666_to_RGB565_LE},
+		{.name = "Blit white RGB666 to RGB565_LE",
+		 .tst_fn = blit_white_RGB666_to_RGB565_LE},
+		{.name = "Blit black RGB666 to RGB666",
+		 .tst_fn = blit_black_RGB666_to_RGB666},
+		{.name = "Blit white RGB666 to RGB666",
+		 .tst_fn = blit_white_RGB666_to_RGB666},
+		{.name = "Blit black RGB666 to RGB332",
+		 .tst_fn = blit_black_RGB666_to_RGB332},
+		{.name = "Blit white RGB666 to RGB332",
+		 .tst_fn = blit_white_RGB666_to_RGB332},
+		{.name = "Blit black RGB666 to CMYK8888",
+		 .tst_fn = blit_black_RGB666_to_CMYK8888},
+		{.name = "Blit white RGB666 to CMYK8888",
+		 .tst_fn = blit_white_RGB666_to_CMYK8888},
+		{.name = "Blit black RGB666 to G1_DB",
+		 .tst_fn = blit_black_RGB666_to_G1_DB},
+		{.name = "Blit white RGB666 to G1_DB",
+		 .tst_fn = blit_white_RGB666_to_G1_DB},
+		{.name = "Blit black RGB666 to G2_DB",
+		 .tst_fn = blit_black_RGB666_to_G2_DB},
+		{.name = "Blit white RGB666 to G2_DB",
+		 .tst_fn = blit_white_RGB666_to_G2_DB},
+		{.name = "Blit black RGB666 to G4_DB",
+		 .tst_fn = blit_black_RGB666_to_G4_DB},
+		{.name = "Blit white RGB666 to G4_DB",
+		 .tst_fn = blit_white_RGB666_to_G4_DB},
+		{.name = "Blit black RGB666 to G1_UB",
+		 .tst_fn = blit_black_RGB666_to_G1_UB},
+		{.name = "Blit white RGB666 to G1_UB",
+		 .tst_fn = blit_white_RGB666_to_G1_UB},
+		{.name = "Blit black RGB666 to G2_UB",
+		 .tst_fn = blit_black_RGB666_to_G2_UB},
+		{.name = "Blit white RGB666 to G2_UB",
+		 .tst_fn = blit_white_RGB666_to_G2_UB},
+		{.name = "Blit black RGB666 to G4_UB",
+		 .tst_fn = blit_black_RGB666_to_G4_UB},
+		{.name = "Blit white RGB666 to G4_UB",
+		 .tst_fn = blit_white_RGB666_to_G4_UB},
+		{.name = "Blit black RGB666 to G8",
+		 .tst_fn = blit_black_RGB666_to_G8},
+		{.name = "Blit white RGB666 to G8",
+		 .tst_fn = blit_white_RGB666_to_G8},
+		{.name = "Blit black RGB666 to GA88",
+		 .tst_fn = blit_black_RGB666_to_GA88},
+		{.name = "Blit white RGB666 to GA88",
+		 .tst_fn = blit_white_RGB666_to_GA88},
+		{.name = "Blit black RGB666 to G16",
+		 .tst_fn = blit_black_RGB666_to_G16},
+		{.name = "Blit white RGB666 to G16",
+		 .tst_fn = blit_white_RGB666_to_G16},
+		{.name = "Blit black RGB332 to RGB101010",
+		 .tst_fn = blit_black_RGB332_to_RGB101010},
+		{.name = "Blit white RGB332 to RGB101010",
+		 .tst_fn = blit_white_RGB332_to_RGB101010},
+		{.name = "Blit black RGB332 to xRGB8888",
+		 .tst_fn = blit_black_RGB332_to_xRGB8888},
+		{.name = "Blit white RGB332 to xRGB8888",
+		 .tst_fn = blit_white_RGB332_to_xRGB8888},
+		{.name = "Blit black RGB332 to RGBA8888",
+		 .tst_fn = blit_black_RGB332_to_RGBA8888},
+		{.name = "Blit white RGB332 to RGBA8888",
+		 .tst_fn = blit_white_RGB332_to_RGBA8888},
+		{.name = "Blit black RGB332 to RGB888",
+		 .tst_fn = blit_black_RGB332_to_RGB888},
+		{.name = "Blit white RGB332 to RGB888",
+		 .tst_fn = blit_white_RGB332_to_RGB888},
+		{.name = "Blit black RGB332 to BGR888",
+		 .tst_fn = blit_black_RGB332_to_BGR888},
+		{.name = "Blit white RGB332 to BGR888",
+		 .tst_fn = blit_white_RGB332_to_BGR888},
+		{.name = "Blit black RGB332 to RGB555",
+		 .tst_fn = blit_black_RGB332_to_RGB555},
+		{.name = "Blit white RGB332 to RGB555",
+		 .tst_fn = blit_white_RGB332_to_RGB555},
+		{.name = "Blit black RGB332 to RGB565_BE",
+		 .tst_fn = blit_black_RGB332_to_RGB565_BE},
+		{.name = "Blit white RGB332 to RGB565_BE",
+		 .tst_fn = blit_white_RGB332_to_RGB565_BE},
+		{.name = "Blit black RGB332 to RGB565_LE",
+		 .tst_fn = blit_black_RGB332_to_RGB565_LE},
+		{.name = "Blit white RGB332 to RGB565_LE",
+		 .tst_fn = blit_white_RGB332_to_RGB565_LE},
+		{.name = "Blit black RGB332 to RGB666",
+		 .tst_fn = blit_black_RGB332_to_RGB666},
+		{.name = "Blit white RGB332 to RGB666",
+		 .tst_fn = blit_white_RGB332_to_RGB666},
+		{.name = "Blit black RGB332 to RGB332",
+		 .tst_fn = blit_black_RGB332_to_RGB332},
+		{.name = "Blit white RGB332 to RGB332",
+		 .tst_fn = blit_white_RGB332_to_RGB332},
+		{.name = "Blit black RGB332 to CMYK8888",
+		 .tst_fn = blit_black_RGB332_to_CMYK8888},
+		{.name = "Blit white RGB332 to CMYK8888",
+		 .tst_fn = blit_white_RGB332_to_CMYK8888},
+		{.name = "Blit black RGB332 to G1_DB",
+		 .tst_fn = blit_black_RGB332_to_G1_DB},
+		{.name = "Blit white RGB332 to G1_DB",
+		 .tst_fn = blit_white_RGB332_to_G1_DB},
+		{.name = "Blit black RGB332 to G2_DB",
+		 .tst_fn = blit_black_RGB332_to_G2_DB},
+		{.name = "Blit white RGB332 to G2_DB",
+		 .tst_fn = blit_white_RGB332_to_G2_DB},
+		{.name = "Blit black RGB332 to G4_DB",
+		 .tst_fn = blit_black_RGB332_to_G4_DB},
+		{.name = "Blit white RGB332 to G4_DB",
+		 .tst_fn = blit_white_RGB332_to_G4_DB},
+		{.name = "Blit black RGB332 to G1_UB",
+		 .tst_fn = blit_black_RGB332_to_G1_UB},
+		{.name = "Blit white RGB332 to G1_UB",
+		 .tst_fn = blit_white_RGB332_to_G1_UB},
+		{.name = "Blit black RGB332 to G2_UB",
+		 .tst_fn = blit_black_RGB332_to_G2_UB},
+		{.name = "Blit white RGB332 to G2_UB",
+		 .tst_fn = blit_white_RGB332_to_G2_UB},
+		{.name = "Blit black RGB332 to G4_UB",
+		 .tst_fn = blit_black_RGB332_to_G4_UB},
+		{.name = "Blit white RGB332 to G4_UB",
+		 .tst_fn = blit_white_RGB332_to_G4_UB},
+		{.name = "Blit black RGB332 to G8",
+		 .tst_fn = blit_black_RGB332_to_G8},
+		{.name = "Blit white RGB332 to G8",
+		 .tst_fn = blit_white_RGB332_to_G8},
+		{.name = "Blit black RGB332 to GA88",
+		 .tst_fn = blit_black_RGB332_to_GA88},
+		{.name = "Blit white RGB332 to GA88",
+		 .tst_fn = blit_white_RGB332_to_GA88},
+		{.name = "Blit black RGB332 to G16",
+		 .tst_fn = blit_black_RGB332_to_G16},
+		{.name = "Blit white RGB332 to G16",
+		 .tst_fn = blit_white_RGB332_to_G16},
+		{.name = "Blit black CMYK8888 to RGB101010",
+		 .tst_fn = blit_black_CMYK8888_to_RGB101010},
+		{.name = "Blit white CMYK8888 to RGB101010",
+		 .tst_fn = blit_white_CMYK8888_to_RGB101010},
+		{.name = "Blit black CMYK8888 to xRGB8888",
+		 .tst_fn = blit_black_CMYK8888_to_xRGB8888},
+		{.name = "Blit white CMYK8888 to xRGB8888",
+		 .tst_fn = blit_white_CMYK8888_to_xRGB8888},
+		{.name = "Blit black CMYK8888 to RGBA8888",
+		 .tst_fn = blit_black_CMYK8888_to_RGBA8888},
+		{.name = "Blit white CMYK8888 to RGBA8888",
+		 .tst_fn = blit_white_CMYK8888_to_RGBA8888},
+		{.name = "Blit black CMYK8888 to RGB888",
+		 .tst_fn = blit_black_CMYK8888_to_RGB888},
+		{.name = "Blit white CMYK8888 to RGB888",
+		 .tst_fn = blit_white_CMYK8888_to_RGB888},
+		{.name = "Blit black CMYK8888 to BGR888",
+		 .tst_fn = blit_black_CMYK8888_to_BGR888},
+		{.name = "Blit white CMYK8888 to BGR888",
+		 .tst_fn = blit_white_CMYK8888_to_BGR888},
+		{.name = "Blit black CMYK8888 to RGB555",
+		 .tst_fn = blit_black_CMYK8888_to_RGB555},
+		{.name = "Blit white CMYK8888 to RGB555",
+		 .tst_fn = blit_white_CMYK8888_to_RGB555},
+		{.name = "Blit black CMYK8888 to RGB565_BE",
+		 .tst_fn = blit_black_CMYK8888_to_RGB565_BE},
+		{.name = "Blit white CMYK8888 to RGB565_BE",
+		 .tst_fn = blit_white_CMYK8888_to_RGB565_BE},
+		{.name = "Blit black CMYK8888 to RGB565_LE",
+		 .tst_fn = blit_black_CMYK8888_to_RGB565_LE},
+		{.name = "Blit white CMYK8888 to RGB565_LE",
+		 .tst_fn = blit_white_CMYK8888_to_RGB565_LE},
+		{.name = "Blit black CMYK8888 to RGB666",
+		 .tst_fn = blit_black_CMYK8888_to_RGB666},
+		{.name = "Blit white CMYK8888 to RGB666",
+		 .tst_fn = blit_white_CMYK8888_to_RGB666},
+		{.name = "Blit black CMYK8888 to RGB332",
+		 .tst_fn = blit_black_CMYK8888_to_RGB332},
+		{.name = "Blit white CMYK8888 to RGB332",
+		 .tst_fn = blit_white_CMYK8888_to_RGB332},
+		{.name = "Blit black CMYK8888 to CMYK8888",
+		 .tst_fn = blit_black_CMYK8888_to_CMYK8888},
+		{.name = "Blit white CMYK8888 to CMYK8888",
+		 .tst_fn = blit_white_CMYK8888_to_CMYK8888},
+		{.name = "Blit black CMYK8888 to G1_DB",
+		 .tst_fn = blit_black_CMYK8888_to_G1_DB},
+		{.name = "Blit white CMYK8888 to G1_DB",
+		 .tst_fn = blit_white_CMYK8888_to_G1_DB},
+		{.name = "Blit black CMYK8888 to G2_DB",
+		 .tst_fn = blit_black_CMYK8888_to_G2_DB},
+		{.name = "Blit white CMYK8888 to G2_DB",
+		 .tst_fn = blit_white_CMYK8888_to_G2_DB},
+		{.name = "Blit black CMYK8888 to G4_DB",
+		 .tst_fn = blit_black_CMYK8888_to_G4_DB},
+		{.name = "Blit white CMYK8888 to G4_DB",
+		 .tst_fn = blit_white_CMYK8888_to_G4_DB},
+		{.name = "Blit black CMYK8888 to G1_UB",
+		 .tst_fn = blit_black_CMYK8888_to_G1_UB},
+		{.name = "Blit white CMYK8888 to G1_UB",
+		 .tst_fn = blit_white_CMYK8888_to_G1_UB},
+		{.name = "Blit black CMYK8888 to G2_UB",
+		 .tst_fn = blit_black_CMYK8888_to_G2_UB},
+		{.name = "Blit white CMYK8888 to G2_UB",
+		 .tst_fn = blit_white_CMYK8888_to_G2_UB},
+		{.name = "Blit black CMYK8888 to G4_UB",
+		 .tst_fn = blit_black_CMYK8888_to_G4_UB},
+		{.name = "Blit white CMYK8888 to G4_UB",
+		 .tst_fn = blit_white_CMYK8888_to_G4_UB},
+		{.name = "Blit black CMYK8888 to G8",
+		 .tst_fn = blit_black_CMYK8888_to_G8},
+		{.name = "Blit white CMYK8888 to G8",
+		 .tst_fn = blit_white_CMYK8888_to_G8},
+		{.name = "Blit black CMYK8888 to GA88",
+		 .tst_fn = blit_black_CMYK8888_to_GA88},
+		{.name = "Blit white CMYK8888 to GA88",
+		 .tst_fn = blit_white_CMYK8888_to_GA88},
+		{.name = "Blit black CMYK8888 to G16",
+		 .tst_fn = blit_black_CMYK8888_to_G16},
+		{.name = "Blit white CMYK8888 to G16",
+		 .tst_fn = blit_white_CMYK8888_to_G16},
+		{.name = "Blit black G1_DB to RGB101010",
+		 .tst_fn = blit_black_G1_DB_to_RGB101010},
+		{.name = "Blit white G1_DB to RGB101010",
+		 .tst_fn = blit_white_G1_DB_to_RGB101010},
+		{.name = "Blit black G1_DB to xRGB8888",
+		 .tst_fn = blit_black_G1_DB_to_xRGB8888},
+		{.name = "Blit white G1_DB to xRGB8888",
+		 .tst_fn = blit_white_G1_DB_to_xRGB8888},
+		{.name = "Blit black G1_DB to RGBA8888",
+		 .tst_fn = blit_black_G1_DB_to_RGBA8888},
+		{.name = "Blit white G1_DB to RGBA8888",
+		 .tst_fn = blit_white_G1_DB_to_RGBA8888},
+		{.name = "Blit black G1_DB to RGB888",
+		 .tst_fn = blit_black_G1_DB_to_RGB888},
+		{.name = "Blit white G1_DB to RGB888",
+		 .tst_fn = blit_white_G1_DB_to_RGB888},
+		{.name = "Blit black G1_DB to BGR888",
+		 .tst_fn = blit_black_G1_DB_to_BGR888},
+		{.name = "Blit white G1_DB to BGR888",
+		 .tst_fn = blit_white_G1_DB_to_BGR888},
+		{.name = "Blit black G1_DB to RGB555",
+		 .tst_fn = blit_black_G1_DB_to_RGB555},
+		{.name = "Blit white G1_DB to RGB555",
+		 .tst_fn = blit_white_G1_DB_to_RGB555},
+		{.name = "Blit black G1_DB to RGB565_BE",
+		 .tst_fn = blit_black_G1_DB_to_RGB565_BE},
+		{.name = "Blit white G1_DB to RGB565_BE",
+		 .tst_fn = blit_white_G1_DB_to_RGB565_BE},
+		{.name = "Blit black G1_DB to RGB565_LE",
+		 .tst_fn = blit_black_G1_DB_to_RGB565_LE},
+		{.name = "Blit white G1_DB to RGB565_LE",
+		 .tst_fn = blit_white_G1_DB_to_RGB565_LE},
+		{.name = "Blit black G1_DB to RGB666",
+		 .tst_fn = blit_black_G1_DB_to_RGB666},
+		{.name = "Blit white G1_DB to RGB666",
+		 .tst_fn = blit_white_G1_DB_to_RGB666},
+		{.name = "Blit black G1_DB to RGB332",
+		 .tst_fn = blit_black_G1_DB_to_RGB332},
+		{.name = "Blit white G1_DB to RGB332",
+		 .tst_fn = blit_white_G1_DB_to_RGB332},
+		{.name = "Blit black G1_DB to CMYK8888",
+		 .tst_fn = blit_black_G1_DB_to_CMYK8888},
+		{.name = "Blit white G1_DB to CMYK8888",
+		 .tst_fn = blit_white_G1_DB_to_CMYK8888},
+		{.name = "Blit black G1_DB to G1_DB",
+		 .tst_fn = blit_black_G1_DB_to_G1_DB},
+		{.name = "Blit white G1_DB to G1_DB",
+		 .tst_fn = blit_white_G1_DB_to_G1_DB},
+		{.name = "Blit black G1_DB to G2_DB",
+		 .tst_fn = blit_black_G1_DB_to_G2_DB},
+		{.name = "Blit white G1_DB to G2_DB",
+		 .tst_fn = blit_white_G1_DB_to_G2_DB},
+		{.name = "Blit black G1_DB to G4_DB",
+		 .tst_fn = blit_black_G1_DB_to_G4_DB},
+		{.name = "Blit white G1_DB to G4_DB",
+		 .tst_fn = blit_white_G1_DB_to_G4_DB},
+		{.name = "Blit black G1_DB to G1_UB",
+		 .tst_fn = blit_black_G1_DB_to_G1_UB},
+		{.name = "Blit white G1_DB to G1_UB",
+		 .tst_fn = blit_white_G1_DB_to_G1_UB},
+		{.name = "Blit black G1_DB to G2_UB",
+		 .tst_fn = blit_black_G1_DB_to_G2_UB},
+		{.name = "Blit white G1_DB to G2_UB",
+		 .tst_fn = blit_white_G1_DB_to_G2_UB},
+		{.name = "Blit black G1_DB to G4_UB",
+		 .tst_fn = blit_black_G1_DB_to_G4_UB},
+		{.name = "Blit white G1_DB to G4_UB",
+		 .tst_fn = blit_white_G1_DB_to_G4_UB},
+		{.name = "Blit black G1_DB to G8",
+		 .tst_fn = blit_black_G1_DB_to_G8},
+		{.name = "Blit white G1_DB to G8",
+		 .tst_fn = blit_white_G1_DB_to_G8},
+		{.name = "Blit black G1_DB to GA88",
+		 .tst_fn = blit_black_G1_DB_to_GA88},
+		{.name = "Blit white G1_DB to GA88",
+		 .tst_fn = blit_white_G1_DB_to_GA88},
+		{.name = "Blit black G1_DB to G16",
+		 .tst_fn = blit_black_G1_DB_to_G16},
+		{.name = "Blit white G1_DB to G16",
+		 .tst_fn = blit_white_G1_DB_to_G16},
+		{.name = "Blit black G2_DB to RGB101010",
+		 .tst_fn = blit_black_G2_DB_to_RGB101010},
+		{.name = "Blit white G2_DB to RGB101010",
+		 .tst_fn = blit_white_G2_DB_to_RGB101010},
+		{.name = "Blit black G2_DB to xRGB8888",
+		 .tst_fn = blit_black_G2_DB_to_xRGB8888},
+		{.name = "Blit white G2_DB to xRGB8888",
+		 .tst_fn = blit_white_G2_DB_to_xRGB8888},
+		{.name = "Blit black G2_DB to RGBA8888",
+		 .tst_fn = blit_black_G2_DB_to_RGBA8888},
+		{.name = "Blit white G2_DB to RGBA8888",
+		 .tst_fn = blit_white_G2_DB_to_RGBA8888},
+		{.name = "Blit black G2_DB to RGB888",
+		 .tst_fn = blit_black_G2_DB_to_RGB888},
+		{.name = "Blit white G2_DB to RGB888",
+		 .tst_fn = blit_white_G2_DB_to_RGB888},
+		{.name = "Blit black G2_DB to BGR888",
+		 .tst_fn = blit_black_G2_DB_to_BGR888},
+		{.name = "Blit white G2_DB to BGR888",
+		 .tst_fn = blit_white_G2_DB_to_BGR888},
+		{.name = "Blit black G2_DB to RGB555",
+		 .tst_fn = blit_black_G2_DB_to_RGB555},
+		{.name = "Blit white G2_DB to RGB555",
+		 .tst_fn = blit_white_G2_DB_to_RGB555},
+		{.name = "Blit black G2_DB to RGB565_BE",
+		 .tst_fn = blit_black_G2_DB_to_RGB565_BE},
+		{.name = "Blit white G2_DB to RGB565_BE",
+		 .tst_fn = blit_white_G2_DB_to_RGB565_BE},
+		{.name = "Blit black G2_DB to RGB565_LE",
+		 .tst_fn = blit_black_G2_DB_to_RGB565_LE},
+		{.name = "Blit white G2_DB to RGB565_LE",
+		 .tst_fn = blit_white_G2_DB_to_RGB565_LE},
+		{.name = "Blit black G2_DB to RGB666",
+		 .tst_fn = blit_black_G2_DB_to_RGB666},
+		{.name = "Blit white G2_DB to RGB666",
+		 .tst_fn = blit_white_G2_DB_to_RGB666},
+		{.name = "Blit black G2_DB to RGB332",
+		 .tst_fn = blit_black_G2_DB_to_RGB332},
+		{.name = "Blit white G2_DB to RGB332",
+		 .tst_fn = blit_white_G2_DB_to_RGB332},
+		{.name = "Blit black G2_DB to CMYK8888",
+		 .tst_fn = blit_black_G2_DB_to_CMYK8888},
+		{.name = "Blit white G2_DB to CMYK8888",
+		 .tst_fn = blit_white_G2_DB_to_CMYK8888},
+		{.name = "Blit black G2_DB to G1_DB",
+		 .tst_fn = blit_black_G2_DB_to_G1_DB},
+		{.name = "Blit white G2_DB to G1_DB",
+		 .tst_fn = blit_white_G2_DB_to_G1_DB},
+		{.name = "Blit black G2_DB to G2_DB",
+		 .tst_fn = blit_black_G2_DB_to_G2_DB},
+		{.name = "Blit white G2_DB to G2_DB",
+		 .tst_fn = blit_white_G2_DB_to_G2_DB},
+		{.name = "Blit black G2_DB to G4_DB",
+		 .tst_fn = blit_black_G2_DB_to_G4_DB},
+		{.name = "Blit white G2_DB to G4_DB",
+		 .tst_fn = blit_white_G2_DB_to_G4_DB},
+		{.name = "Blit black G2_DB to G1_UB",
+		 .tst_fn = blit_black_G2_DB_to_G1_UB},
+		{.name = "Blit white G2_DB to G1_UB",
+		 .tst_fn = blit_white_G2_DB_to_G1_UB},
+		{.name = "Blit black G2_DB to G2_UB",
+		 .tst_fn = blit_black_G2_DB_to_G2_UB},
+		{.name = "Blit white G2_DB to G2_UB",
+		 .tst_fn = blit_white_G2_DB_to_G2_UB},
+		{.name = "Blit black G2_DB to G4_UB",
+		 .tst_fn = blit_black_G2_DB_to_G4_UB},
+		{.name = "Blit white G2_DB to G4_UB",
+		 .tst_fn = blit_white_G2_DB_to_G4_UB},
+		{.name = "Blit black G2_DB to G8",
+		 .tst_fn = blit_black_G2_DB_to_G8},
+		{.name = "Blit white G2_DB to G8",
+		 .tst_fn = blit_white_G2_DB_to_G8},
+		{.name = "Blit black G2_DB to GA88",
+		 .tst_fn = blit_black_G2_DB_to_GA88},
+		{.name = "Blit white G2_DB to GA88",
+		 .tst_fn = blit_white_G2_DB_to_GA88},
+		{.name = "Blit black G2_DB to G16",
+		 .tst_fn = blit_black_G2_DB_to_G16},
+		{.name = "Blit white G2_DB to G16",
+		 .tst_fn = blit_white_G2_DB_to_G16},
+		{.name = "Blit black G4_DB to RGB101010",
+		 .tst_fn = blit_black_G4_DB_to_RGB101010},
+		{.name = "Blit white G4_DB to RGB101010",
+		 .tst_fn = blit_white_G4_DB_to_RGB101010},
+		{.name = "Blit black G4_DB to xRGB8888",
+		 .tst_fn = blit_black_G4_DB_to_xRGB8888},
+		{.name = "Blit white G4_DB to xRGB8888",
+		 .tst_fn = blit_white_G4_DB_to_xRGB8888},
+		{.name = "Blit black G4_DB to RGBA8888",
+		 .tst_fn = blit_black_G4_DB_to_RGBA8888},
+		{.name = "Blit white G4_DB to RGBA8888",
+		 .tst_fn = blit_white_G4_DB_to_RGBA8888},
+		{.name = "Blit black G4_DB to RGB888",
+		 .tst_fn = blit_black_G4_DB_to_RGB888},
+		{.name = "Blit white G4_DB to RGB888",
+		 .tst_fn = blit_white_G4_DB_to_RGB888},
+		{.name = "Blit black G4_DB to BGR888",
+		 .tst_fn = blit_black_G4_DB_to_BGR888},
+		{.name = "Blit white G4_DB to BGR888",
+		 .tst_fn = blit_white_G4_DB_to_BGR888},
+		{.name = "Blit black G4_DB to RGB555",
+		 .tst_fn = blit_black_G4_DB_to_RGB555},
+		{.name = "Blit white G4_DB to RGB555",
+		 .tst_fn = blit_white_G4_DB_to_RGB555},
+		{.name = "Blit black G4_DB to RGB565_BE",
+		 .tst_fn = blit_black_G4_DB_to_RGB565_BE},
+		{.name = "Blit white G4_DB to RGB565_BE",
+		 .tst_fn = blit_white_G4_DB_to_RGB565_BE},
+		{.name = "Blit black G4_DB to RGB565_LE",
+		 .tst_fn = blit_black_G4_DB_to_RGB565_LE},
+		{.name = "Blit white G4_DB to RGB565_LE",
+		 .tst_fn = blit_white_G4_DB_to_RGB565_LE},
+		{.name = "Blit black G4_DB to RGB666",
+		 .tst_fn = blit_black_G4_DB_to_RGB666},
+		{.name = "Blit white G4_DB to RGB666",
+		 .tst_fn = blit_white_G4_DB_to_RGB666},
+		{.name = "Blit black G4_DB to RGB332",
+		 .tst_fn = blit_black_G4_DB_to_RGB332},
+		{.name = "Blit white G4_DB to RGB332",
+		 .tst_fn = blit_white_G4_DB_to_RGB332},
+		{.name = "Blit black G4_DB to CMYK8888",
+		 .tst_fn = blit_black_G4_DB_to_CMYK8888},
+		{.name = "Blit white G4_DB to CMYK8888",
+		 .tst_fn = blit_white_G4_DB_to_CMYK8888},
+		{.name = "Blit black G4_DB to G1_DB",
+		 .tst_fn = blit_black_G4_DB_to_G1_DB},
+		{.name = "Blit white G4_DB to G1_DB",
+		 .tst_fn = blit_white_G4_DB_to_G1_DB},
+		{.name = "Blit black G4_DB to G2_DB",
+		 .tst_fn = blit_black_G4_DB_to_G2_DB},
+		{.name = "Blit white G4_DB to G2_DB",
+		 .tst_fn = blit_white_G4_DB_to_G2_DB},
+		{.name = "Blit black G4_DB to G4_DB",
+		 .tst_fn = blit_black_G4_DB_to_G4_DB},
+		{.name = "Blit white G4_DB to G4_DB",
+		 .tst_fn = blit_white_G4_DB_to_G4_DB},
+		{.name = "Blit black G4_DB to G1_UB",
+		 .tst_fn = blit_black_G4_DB_to_G1_UB},
+		{.name = "Blit white G4_DB to G1_UB",
+		 .tst_fn = blit_white_G4_DB_to_G1_UB},
+		{.name = "Blit black G4_DB to G2_UB",
+		 .tst_fn = blit_black_G4_DB_to_G2_UB},
+		{.name = "Blit white G4_DB to G2_UB",
+		 .tst_fn = blit_white_G4_DB_to_G2_UB},
+		{.name = "Blit black G4_DB to G4_UB",
+		 .tst_fn = blit_black_G4_DB_to_G4_UB},
+		{.name = "Blit white G4_DB to G4_UB",
+		 .tst_fn = blit_white_G4_DB_to_G4_UB},
+		{.name = "Blit black G4_DB to G8",
+		 .tst_fn = blit_black_G4_DB_to_G8},
+		{.name = "Blit white G4_DB to G8",
+		 .tst_fn = blit_white_G4_DB_to_G8},
+		{.name = "Blit black G4_DB to GA88",
+		 .tst_fn = blit_black_G4_DB_to_GA88},
+		{.name = "Blit white G4_DB to GA88",
+		 .tst_fn = blit_white_G4_DB_to_GA88},
+		{.name = "Blit black G4_DB to G16",
+		 .tst_fn = blit_black_G4_DB_to_G16},
+		{.name = "Blit white G4_DB to G16",
+		 .tst_fn = blit_white_G4_DB_to_G16},
+		{.name = "Blit black G1_UB to RGB101010",
+		 .tst_fn = blit_black_G1_UB_to_RGB101010},
+		{.name = "Blit white G1_UB to RGB101010",
+		 .tst_fn = blit_white_G1_UB_to_RGB101010},
+		{.name = "Blit black G1_UB to xRGB8888",
+		 .tst_fn = blit_black_G1_UB_to_xRGB8888},
+		{.name = "Blit white G1_UB to xRGB8888",
+		 .tst_fn = blit_white_G1_UB_to_xRGB8888},
+		{.name = "Blit black G1_UB to RGBA8888",
+		 .tst_fn = blit_black_G1_UB_to_RGBA8888},
+		{.name = "Blit white G1_UB to RGBA8888",
+		 .tst_fn = blit_white_G1_UB_to_RGBA8888},
+		{.name = "Blit black G1_UB to RGB888",
+		 .tst_fn = blit_black_G1_UB_to_RGB888},
+		{.name = "Blit white G1_UB to RGB888",
+		 .tst_fn = blit_white_G1_UB_to_RGB888},
+		{.name = "Blit black G1_UB to BGR888",
+		 .tst_fn = blit_black_G1_UB_to_BGR888},
+		{.name = "Blit white G1_UB to BGR888",
+		 .tst_fn = blit_white_G1_UB_to_BGR888},
+		{.name = "Blit black G1_UB to RGB555",
+		 .tst_fn = blit_black_G1_UB_to_RGB555},
+		{.name = "Blit white G1_UB to RGB555",
+		 .tst_fn = blit_white_G1_UB_to_RGB555},
+		{.name = "Blit black G1_UB to RGB565_BE",
+		 .tst_fn = blit_black_G1_UB_to_RGB565_BE},
+		{.name = "Blit white G1_UB to RGB565_BE",
+		 .tst_fn = blit_white_G1_UB_to_RGB565_BE},
+		{.name = "Blit black G1_UB to RGB565_LE",
+		 .tst_fn = blit_black_G1_UB_to_RGB565_LE},
+		{.name = "Blit white G1_UB to RGB565_LE",
+		 .tst_fn = blit_white_G1_UB_to_RGB565_LE},
+		{.name = "Blit black G1_UB to RGB666",
+		 .tst_fn = blit_black_G1_UB_to_RGB666},
+		{.name = "Blit white G1_UB to RGB666",
+		 .tst_fn = blit_white_G1_UB_to_RGB666},
+		{.name = "Blit black G1_UB to RGB332",
+		 .tst_fn = blit_black_G1_UB_to_RGB332},
+		{.name = "Blit white G1_UB to RGB332",
+		 .tst_fn = blit_white_G1_UB_to_RGB332},
+		{.name = "Blit black G1_UB to CMYK8888",
+		 .tst_fn = blit_black_G1_UB_to_CMYK8888},
+		{.name = "Blit white G1_UB to CMYK8888",
+		 .tst_fn = blit_white_G1_UB_to_CMYK8888},
+		{.name = "Blit black G1_UB to G1_DB",
+		 .tst_fn = blit_black_G1_UB_to_G1_DB},
+		{.name = "Blit white G1_UB to G1_DB",
+		 .tst_fn = blit_white_G1_UB_to_G1_DB},
+		{.name = "Blit black G1_UB to G2_DB",
+		 .tst_fn = blit_black_G1_UB_to_G2_DB},
+		{.name = "Blit white G1_UB to G2_DB",
+		 .tst_fn = blit_white_G1_UB_to_G2_DB},
+		{.name = "Blit black G1_UB to G4_DB",
+		 .tst_fn = blit_black_G1_UB_to_G4_DB},
+		{.name = "Blit white G1_UB to G4_DB",
+		 .tst_fn = blit_white_G1_UB_to_G4_DB},
+		{.name = "Blit black G1_UB to G1_UB",
+		 .tst_fn = blit_black_G1_UB_to_G1_UB},
+		{.name = "Blit white G1_UB to G1_UB",
+		 .tst_fn = blit_white_G1_UB_to_G1_UB},
+		{.name = "Blit black G1_UB to G2_UB",
+		 .tst_fn = blit_black_G1_UB_to_G2_UB},
+		{.name = "Blit white G1_UB to G2_UB",
+		 .tst_fn = blit_white_G1_UB_to_G2_UB},
+		{.name = "Blit black G1_UB to G4_UB",
+		 .tst_fn = blit_black_G1_UB_to_G4_UB},
+		{.name = "Blit white G1_UB to G4_UB",
+		 .tst_fn = blit_white_G1_UB_to_G4_UB},
+		{.name = "Blit black G1_UB to G8",
+		 .tst_fn = blit_black_G1_UB_to_G8},
+		{.name = "Blit white G1_UB to G8",
+		 .tst_fn = blit_white_G1_UB_to_G8},
+		{.name = "Blit black G1_UB to GA88",
+		 .tst_fn = blit_black_G1_UB_to_GA88},
+		{.name = "Blit white G1_UB to GA88",
+		 .tst_fn = blit_white_G1_UB_to_GA88},
+		{.name = "Blit black G1_UB to G16",
+		 .tst_fn = blit_black_G1_UB_to_G16},
+		{.name = "Blit white G1_UB to G16",
+		 .tst_fn = blit_white_G1_UB_to_G16},
+		{.name = "Blit black G2_UB to RGB101010",
+		 .tst_fn = blit_black_G2_UB_to_RGB101010},
+		{.name = "Blit white G2_UB to RGB101010",
+		 .tst_fn = blit_white_G2_UB_to_RGB101010},
+		{.name = "Blit black G2_UB to xRGB8888",
+		 .tst_fn = blit_black_G2_UB_to_xRGB8888},
+		{.name = "Blit white G2_UB to xRGB8888",
+		 .tst_fn = blit_white_G2_UB_to_xRGB8888},
+		{.name = "Blit black G2_UB to RGBA8888",
+		 .tst_fn = blit_black_G2_UB_to_RGBA8888},
+		{.name = "Blit white G2_UB to RGBA8888",
+		 .tst_fn = blit_white_G2_UB_to_RGBA8888},
+		{.name = "Blit black G2_UB to RGB888",
+		 .tst_fn = blit_black_G2_UB_to_RGB888},
+		{.name = "Blit white G2_UB to RGB888",
+		 .tst_fn = blit_white_G2_UB_to_RGB888},
+		{.name = "Blit black G2_UB to BGR888",
+		 .tst_fn = blit_black_G2_UB_to_BGR888},
+		{.name = "Blit white G2_UB to BGR888",
+		 .tst_fn = blit_white_G2_UB_to_BGR888},
+		{.name = "Blit black G2_UB to RGB555",
+		 .tst_fn = blit_black_G2_UB_to_RGB555},
+		{.name = "Blit white G2_UB to RGB555",
+		 .tst_fn = blit_white_G2_UB_to_RGB555},
+		{.name = "Blit black G2_UB to RGB565_BE",
+		 .tst_fn = blit_black_G2_UB_to_RGB565_BE},
+		{.name = "Blit white G2_UB to RGB565_BE",
+		 .tst_fn = blit_white_G2_UB_to_RGB565_BE},
+		{.name = "Blit black G2_UB to RGB565_LE",
+		 .tst_fn = blit_black_G2_UB_to_RGB565_LE},
+		{.name = "Blit white G2_UB to RGB565_LE",
+		 .tst_fn = blit_white_G2_UB_to_RGB565_LE},
+		{.name = "Blit black G2_UB to RGB666",
+		 .tst_fn = blit_black_G2_UB_to_RGB666},
+		{.name = "Blit white G2_UB to RGB666",
+		 .tst_fn = blit_white_G2_UB_to_RGB666},
+		{.name = "Blit black G2_UB to RGB332",
+		 .tst_fn = blit_black_G2_UB_to_RGB332},
+		{.name = "Blit white G2_UB to RGB332",
+		 .tst_fn = blit_white_G2_UB_to_RGB332},
+		{.name = "Blit black G2_UB to CMYK8888",
+		 .tst_fn = blit_black_G2_UB_to_CMYK8888},
+		{.name = "Blit white G2_UB to CMYK8888",
+		 .tst_fn = blit_white_G2_UB_to_CMYK8888},
+		{.name = "Blit black G2_UB to G1_DB",
+		 .tst_fn = blit_black_G2_UB_to_G1_DB},
+		{.name = "Blit white G2_UB to G1_DB",
+		 .tst_fn = blit_white_G2_UB_to_G1_DB},
+		{.name = "Blit black G2_UB to G2_DB",
+		 .tst_fn = blit_black_G2_UB_to_G2_DB},
+		{.name = "Blit white G2_UB to G2_DB",
+		 .tst_fn = blit_white_G2_UB_to_G2_DB},
+		{.name = "Blit black G2_UB to G4_DB",
+		 .tst_fn = blit_black_G2_UB_to_G4_DB},
+		{.name = "Blit white G2_UB to G4_DB",
+		 .tst_fn = blit_white_G2_UB_to_G4_DB},
+		{.name = "Blit black G2_UB to G1_UB",
+		 .tst_fn = blit_black_G2_UB_to_G1_UB},
+		{.name = "Blit white G2_UB to G1_UB",
+		 .tst_fn = blit_white_G2_UB_to_G1_UB},
+		{.name = "Blit black G2_UB to G2_UB",
+		 .tst_fn = blit_black_G2_UB_to_G2_UB},
+		{.name = "Blit white G2_UB to G2_UB",
+		 .tst_fn = blit_white_G2_UB_to_G2_UB},
+		{.name = "Blit black G2_UB to G4_UB",
+		 .tst_fn = blit_black_G2_UB_to_G4_UB},
+		{.name = "Blit white G2_UB to G4_UB",
+		 .tst_fn = blit_white_G2_UB_to_G4_UB},
+		{.name = "Blit black G2_UB to G8",
+		 .tst_fn = blit_black_G2_UB_to_G8},
+		{.name = "Blit white G2_UB to G8",
+		 .tst_fn = blit_white_G2_UB_to_G8},
+		{.name = "Blit black G2_UB to GA88",
+		 .tst_fn = blit_black_G2_UB_to_GA88},
+		{.name = "Blit white G2_UB to GA88",
+		 .tst_fn = blit_white_G2_UB_to_GA88},
+		{.name = "Blit black G2_UB to G16",
+		 .tst_fn = blit_black_G2_UB_to_G16},
+		{.name = "Blit white G2_UB to G16",
+		 .tst_fn = blit_white_G2_UB_to_G16},
+		{.name = "Blit black G4_UB to RGB101010",
+		 .tst_fn = blit_black_G4_UB_to_RGB101010},
+		{.name = "Blit white G4_UB to RGB101010",
+		 .tst_fn = blit_white_G4_UB_to_RGB101010},
+		{.name = "Blit black G4_UB to xRGB8888",
+		 .tst_fn = blit_black_G4_UB_to_xRGB8888},
+		{.name = "Blit white G4_UB to xRGB8888",
+		 .tst_fn = blit_white_G4_UB_to_xRGB8888},
+		{.name = "Blit black G4_UB to RGBA8888",
+		 .tst_fn = blit_black_G4_UB_to_RGBA8888},
+		{.name = "Blit white G4_UB to RGBA8888",
+		 .tst_fn = blit_white_G4_UB_to_RGBA8888},
+		{.name = "Blit black G4_UB to RGB888",
+		 .tst_fn = blit_black_G4_UB_to_RGB888},
+		{.name = "Blit white G4_UB to RGB888",
+		 .tst_fn = blit_white_G4_UB_to_RGB888},
+		{.name = "Blit black G4_UB to BGR888",
+		 .tst_fn = blit_black_G4_UB_to_BGR888},
+		{.name = "Blit white G4_UB to BGR888",
+		 .tst_fn = blit_white_G4_UB_to_BGR888},
+		{.name = "Blit black G4_UB to RGB555",
+		 .tst_fn = blit_black_G4_UB_to_RGB555},
+		{.name = "Blit white G4_UB to RGB555",
+		 .tst_fn = blit_white_G4_UB_to_RGB555},
+		{.name = "Blit black G4_UB to RGB565_BE",
+		 .tst_fn = blit_black_G4_UB_to_RGB565_BE},
+		{.name = "Blit white G4_UB to RGB565_BE",
+		 .tst_fn = blit_white_G4_UB_to_RGB565_BE},
+		{.name = "Blit black G4_UB to RGB565_LE",
+		 .tst_fn = blit_black_G4_UB_to_RGB565_LE},
+		{.name = "Blit white G4_UB to RGB565_LE",
+		 .tst_fn = blit_white_G4_UB_to_RGB565_LE},
+		{.name = "Blit black G4_UB to RGB666",
+		 .tst_fn = blit_black_G4_UB_to_RGB666},
+		{.name = "Blit white G4_UB to RGB666",
+		 .tst_fn = blit_white_G4_UB_to_RGB666},
+		{.name = "Blit black G4_UB to RGB332",
+		 .tst_fn = blit_black_G4_UB_to_RGB332},
+		{.name = "Blit white G4_UB to RGB332",
+		 .tst_fn = blit_white_G4_UB_to_RGB332},
+		{.name = "Blit black G4_UB to CMYK8888",
+		 .tst_fn = blit_black_G4_UB_to_CMYK8888},
+		{.name = "Blit white G4_UB to CMYK8888",
+		 .tst_fn = blit_white_G4_UB_to_CMYK8888},
+		{.name = "Blit black G4_UB to G1_DB",
+		 .tst_fn = blit_black_G4_UB_to_G1_DB},
+		{.name = "Blit white G4_UB to G1_DB",
+		 .tst_fn = blit_white_G4_UB_to_G1_DB},
+		{.name = "Blit black G4_UB to G2_DB",
+		 .tst_fn = blit_black_G4_UB_to_G2_DB},
+		{.name = "Blit white G4_UB to G2_DB",
+		 .tst_fn = blit_white_G4_UB_to_G2_DB},
+		{.name = "Blit black G4_UB to G4_DB",
+		 .tst_fn = blit_black_G4_UB_to_G4_DB},
+		{.name = "Blit white G4_UB to G4_DB",
+		 .tst_fn = blit_white_G4_UB_to_G4_DB},
+		{.name = "Blit black G4_UB to G1_UB",
+		 .tst_fn = blit_black_G4_UB_to_G1_UB},
+		{.name = "Blit white G4_UB to G1_UB",
+		 .tst_fn = blit_white_G4_UB_to_G1_UB},
+		{.name = "Blit black G4_UB to G2_UB",
+		 .tst_fn = blit_black_G4_UB_to_G2_UB},
+		{.name = "Blit white G4_UB to G2_UB",
+		 .tst_fn = blit_white_G4_UB_to_G2_UB},
+		{.name = "Blit black G4_UB to G4_UB",
+		 .tst_fn = blit_black_G4_UB_to_G4_UB},
+		{.name = "Blit white G4_UB to G4_UB",
+		 .tst_fn = blit_white_G4_UB_to_G4_UB},
+		{.name = "Blit black G4_UB to G8",
+		 .tst_fn = blit_black_G4_UB_to_G8},
+		{.name = "Blit white G4_UB to G8",
+		 .tst_fn = blit_white_G4_UB_to_G8},
+		{.name = "Blit black G4_UB to GA88",
+		 .tst_fn = blit_black_G4_UB_to_GA88},
+		{.name = "Blit white G4_UB to GA88",
+		 .tst_fn = blit_white_G4_UB_to_GA88},
+		{.name = "Blit black G4_UB to G16",
+		 .tst_fn = blit_black_G4_UB_to_G16},
+		{.name = "Blit white G4_UB to G16",
+		 .tst_fn = blit_white_G4_UB_to_G16},
+		{.name = "Blit black G8 to RGB101010",
+		 .tst_fn = blit_black_G8_to_RGB101010},
+		{.name = "Blit white G8 to RGB101010",
+		 .tst_fn = blit_white_G8_to_RGB101010},
+		{.name = "Blit black G8 to xRGB8888",
+		 .tst_fn = blit_black_G8_to_xRGB8888},
+		{.name = "Blit white G8 to xRGB8888",
+		 .tst_fn = blit_white_G8_to_xRGB8888},
+		{.name = "Blit black G8 to RGBA8888",
+		 .tst_fn = blit_black_G8_to_RGBA8888},
+		{.name = "Blit white G8 to RGBA8888",
+		 .tst_fn = blit_white_G8_to_RGBA8888},
+		{.name = "Blit black G8 to RGB888",
+		 .tst_fn = blit_black_G8_to_RGB888},
+		{.name = "Blit white G8 to RGB888",
+		 .tst_fn = blit_white_G8_to_RGB888},
+		{.name = "Blit black G8 to BGR888",
+		 .tst_fn = blit_black_G8_to_BGR888},
+		{.name = "Blit white G8 to BGR888",
+		 .tst_fn = blit_white_G8_to_BGR888},
+		{.name = "Blit black G8 to RGB555",
+		 .tst_fn = blit_black_G8_to_RGB555},
+		{.name = "Blit white G8 to RGB555",
+		 .tst_fn = blit_white_G8_to_RGB555},
+		{.name = "Blit black G8 to RGB565_BE",
+		 .tst_fn = blit_black_G8_to_RGB565_BE},
+		{.name = "Blit white G8 to RGB565_BE",
+		 .tst_fn = blit_white_G8_to_RGB565_BE},
+		{.name = "Blit black G8 to RGB565_LE",
+		 .tst_fn = blit_black_G8_to_RGB565_LE},
+		{.name = "Blit white G8 to RGB565_LE",
+		 .tst_fn = blit_white_G8_to_RGB565_LE},
+		{.name = "Blit black G8 to RGB666",
+		 .tst_fn = blit_black_G8_to_RGB666},
+		{.name = "Blit white G8 to RGB666",
+		 .tst_fn = blit_white_G8_to_RGB666},
+		{.name = "Blit black G8 to RGB332",
+		 .tst_fn = blit_black_G8_to_RGB332},
+		{.name = "Blit white G8 to RGB332",
+		 .tst_fn = blit_white_G8_to_RGB332},
+		{.name = "Blit black G8 to CMYK8888",
+		 .tst_fn = blit_black_G8_to_CMYK8888},
+		{.name = "Blit white G8 to CMYK8888",
+		 .tst_fn = blit_white_G8_to_CMYK8888},
+		{.name = "Blit black G8 to G1_DB",
+		 .tst_fn = blit_black_G8_to_G1_DB},
+		{.name = "Blit white G8 to G1_DB",
+		 .tst_fn = blit_white_G8_to_G1_DB},
+		{.name = "Blit black G8 to G2_DB",
+		 .tst_fn = blit_black_G8_to_G2_DB},
+		{.name = "Blit white G8 to G2_DB",
+		 .tst_fn = blit_white_G8_to_G2_DB},
+		{.name = "Blit black G8 to G4_DB",
+		 .tst_fn = blit_black_G8_to_G4_DB},
+		{.name = "Blit white G8 to G4_DB",
+		 .tst_fn = blit_white_G8_to_G4_DB},
+		{.name = "Blit black G8 to G1_UB",
+		 .tst_fn = blit_black_G8_to_G1_UB},
+		{.name = "Blit white G8 to G1_UB",
+		 .tst_fn = blit_white_G8_to_G1_UB},
+		{.name = "Blit black G8 to G2_UB",
+		 .tst_fn = blit_black_G8_to_G2_UB},
+		{.name = "Blit white G8 to G2_UB",
+		 .tst_fn = blit_white_G8_to_G2_UB},
+		{.name = "Blit black G8 to G4_UB",
+		 .tst_fn = blit_black_G8_to_G4_UB},
+		{.name = "Blit white G8 to G4_UB",
+		 .tst_fn = blit_white_G8_to_G4_UB},
+		{.name = "Blit black G8 to G8",
+		 .tst_fn = blit_black_G8_to_G8},
+		{.name = "Blit white G8 to G8",
+		 .tst_fn = blit_white_G8_to_G8},
+		{.name = "Blit black G8 to GA88",
+		 .tst_fn = blit_black_G8_to_GA88},
+		{.name = "Blit white G8 to GA88",
+		 .tst_fn = blit_white_G8_to_GA88},
+		{.name = "Blit black G8 to G16",
+		 .tst_fn = blit_black_G8_to_G16},
+		{.name = "Blit white G8 to G16",
+		 .tst_fn = blit_white_G8_to_G16},
+		{.name = "Blit black GA88 to RGB101010",
+		 .tst_fn = blit_black_GA88_to_RGB101010},
+		{.name = "Blit white GA88 to RGB101010",
+		 .tst_fn = blit_white_GA88_to_RGB101010},
+		{.name = "Blit black GA88 to xRGB8888",
+		 .tst_fn = blit_black_GA88_to_xRGB8888},
+		{.name = "Blit white GA88 to xRGB8888",
+		 .tst_fn = blit_white_GA88_to_xRGB8888},
+		{.name = "Blit black GA88 to RGBA8888",
+		 .tst_fn = blit_black_GA88_to_RGBA8888},
+		{.name = "Blit white GA88 to RGBA8888",
+		 .tst_fn = blit_white_GA88_to_RGBA8888},
+		{.name = "Blit black GA88 to RGB888",
+		 .tst_fn = blit_black_GA88_to_RGB888},
+		{.name = "Blit white GA88 to RGB888",
+		 .tst_fn = blit_white_GA88_to_RGB888},
+		{.name = "Blit black GA88 to BGR888",
+		 .tst_fn = blit_black_GA88_to_BGR888},
+		{.name = "Blit white GA88 to BGR888",
+		 .tst_fn = blit_white_GA88_to_BGR888},
+		{.name = "Blit black GA88 to RGB555",
+		 .tst_fn = blit_black_GA88_to_RGB555},
+		{.name = "Blit white GA88 to RGB555",
+		 .tst_fn = blit_white_GA88_to_RGB555},
+		{.name = "Blit black GA88 to RGB565_BE",
+		 .tst_fn = blit_black_GA88_to_RGB565_BE},
+		{.name = "Blit white GA88 to RGB565_BE",
+		 .tst_fn = blit_white_GA88_to_RGB565_BE},
+		{.name = "Blit black GA88 to RGB565_LE",
+		 .tst_fn = blit_black_GA88_to_RGB565_LE},
+		{.name = "Blit white GA88 to RGB565_LE",
+		 .tst_fn = blit_white_GA88_to_RGB565_LE},
+		{.name = "Blit black GA88 to RGB666",
+		 .tst_fn = blit_black_GA88_to_RGB666},
+		{.name = "Blit white GA88 to RGB666",
+		 .tst_fn = blit_white_GA88_to_RGB666},
+		{.name = "Blit black GA88 to RGB332",
+		 .tst_fn = blit_black_GA88_to_RGB332},
+		{.name = "Blit white GA88 to RGB332",
+		 .tst_fn = blit_white_GA88_to_RGB332},
+		{.name = "Blit black GA88 to CMYK8888",
+		 .tst_fn = blit_black_GA88_to_CMYK8888},
+		{.name = "Blit white GA88 to CMYK8888",
+		 .tst_fn = blit_white_GA88_to_CMYK8888},
+		{.name = "Blit black GA88 to G1_DB",
+		 .tst_fn = blit_black_GA88_to_G1_DB},
+		{.name = "Blit white GA88 to G1_DB",
+		 .tst_fn = blit_white_GA88_to_G1_DB},
+		{.name = "Blit black GA88 to G2_DB",
+		 .tst_fn = blit_black_GA88_to_G2_DB},
+		{.name = "Blit white GA88 to G2_DB",
+		 .tst_fn = blit_white_GA88_to_G2_DB},
+		{.name = "Blit black GA88 to G4_DB",
+		 .tst_fn = blit_black_GA88_to_G4_DB},
+		{.name = "Blit white GA88 to G4_DB",
+		 .tst_fn = blit_white_GA88_to_G4_DB},
+		{.name = "Blit black GA88 to G1_UB",
+		 .tst_fn = blit_black_GA88_to_G1_UB},
+		{.name = "Blit white GA88 to G1_UB",
+		 .tst_fn = blit_white_GA88_to_G1_UB},
+		{.name = "Blit black GA88 to G2_UB",
+		 .tst_fn = blit_black_GA88_to_G2_UB},
+		{.name = "Blit white GA88 to G2_UB",
+		 .tst_fn = blit_white_GA88_to_G2_UB},
+		{.name = "Blit black GA88 to G4_UB",
+		 .tst_fn = blit_black_GA88_to_G4_UB},
+		{.name = "Blit white GA88 to G4_UB",
+		 .tst_fn = blit_white_GA88_to_G4_UB},
+		{.name = "Blit black GA88 to G8",
+		 .tst_fn = blit_black_GA88_to_G8},
+		{.name = "Blit white GA88 to G8",
+		 .tst_fn = blit_white_GA88_to_G8},
+		{.name = "Blit black GA88 to GA88",
+		 .tst_fn = blit_black_GA88_to_GA88},
+		{.name = "Blit white GA88 to GA88",
+		 .tst_fn = blit_white_GA88_to_GA88},
+		{.name = "Blit black GA88 to G16",
+		 .tst_fn = blit_black_GA88_to_G16},
+		{.name = "Blit white GA88 to G16",
+		 .tst_fn = blit_white_GA88_to_G16},
+		{.name = "Blit black G16 to RGB101010",
+		 .tst_fn = blit_black_G16_to_RGB101010},
+		{.name = "Blit white G16 to RGB101010",
+		 .tst_fn = blit_white_G16_to_RGB101010},
+		{.name = "Blit black G16 to xRGB8888",
+		 .tst_fn = blit_black_G16_to_xRGB8888},
+		{.name = "Blit white G16 to xRGB8888",
+		 .tst_fn = blit_white_G16_to_xRGB8888},
+		{.name = "Blit black G16 to RGBA8888",
+		 .tst_fn = blit_black_G16_to_RGBA8888},
+		{.name = "Blit white G16 to RGBA8888",
+		 .tst_fn = blit_white_G16_to_RGBA8888},
+		{.name = "Blit black G16 to RGB888",
+		 .tst_fn = blit_black_G16_to_RGB888},
+		{.name = "Blit white G16 to RGB888",
+		 .tst_fn = blit_white_G16_to_RGB888},
+		{.name = "Blit black G16 to BGR888",
+		 .tst_fn = blit_black_G16_to_BGR888},
+		{.name = "Blit white G16 to BGR888",
+		 .tst_fn = blit_white_G16_to_BGR888},
+		{.name = "Blit black G16 to RGB555",
+		 .tst_fn = blit_black_G16_to_RGB555},
+		{.name = "Blit white G16 to RGB555",
+		 .tst_fn = blit_white_G16_to_RGB555},
+		{.name = "Blit black G16 to RGB565_BE",
+		 .tst_fn = blit_black_G16_to_RGB565_BE},
+		{.name = "Blit white G16 to RGB565_BE",
+		 .tst_fn = blit_white_G16_to_RGB565_BE},
+		{.name = "Blit black G16 to RGB565_LE",
+		 .tst_fn = blit_black_G16_to_RGB565_LE},
+		{.name = "Blit white G16 to RGB565_LE",
+		 .tst_fn = blit_white_G16_to_RGB565_LE},
+		{.name = "Blit black G16 to RGB666",
+		 .tst_fn = blit_black_G16_to_RGB666},
+		{.name = "Blit white G16 to RGB666",
+		 .tst_fn = blit_white_G16_to_RGB666},
+		{.name = "Blit black G16 to RGB332",
+		 .tst_fn = blit_black_G16_to_RGB332},
+		{.name = "Blit white G16 to RGB332",
+		 .tst_fn = blit_white_G16_to_RGB332},
+		{.name = "Blit black G16 to CMYK8888",
+		 .tst_fn = blit_black_G16_to_CMYK8888},
+		{.name = "Blit white G16 to CMYK8888",
+		 .tst_fn = blit_white_G16_to_CMYK8888},
+		{.name = "Blit black G16 to G1_DB",
+		 .tst_fn = blit_black_G16_to_G1_DB},
+		{.name = "Blit white G16 to G1_DB",
+		 .tst_fn = blit_white_G16_to_G1_DB},
+		{.name = "Blit black G16 to G2_DB",
+		 .tst_fn = blit_black_G16_to_G2_DB},
+		{.name = "Blit white G16 to G2_DB",
+		 .tst_fn = blit_white_G16_to_G2_DB},
+		{.name = "Blit black G16 to G4_DB",
+		 .tst_fn = blit_black_G16_to_G4_DB},
+		{.name = "Blit white G16 to G4_DB",
+		 .tst_fn = blit_white_G16_to_G4_DB},
+		{.name = "Blit black G16 to G1_UB",
+		 .tst_fn = blit_black_G16_to_G1_UB},
+		{.name = "Blit white G16 to G1_UB",
+		 .tst_fn = blit_white_G16_to_G1_UB},
+		{.name = "Blit black G16 to G2_UB",
+		 .tst_fn = blit_black_G16_to_G2_UB},
+		{.name = "Blit white G16 to G2_UB",
+		 .tst_fn = blit_white_G16_to_G2_UB},
+		{.name = "Blit black G16 to G4_UB",
+		 .tst_fn = blit_black_G16_to_G4_UB},
+		{.name = "Blit white G16 to G4_UB",
+		 .tst_fn = blit_white_G16_to_G4_UB},
+		{.name = "Blit black G16 to G8",
+		 .tst_fn = blit_black_G16_to_G8},
+		{.name = "Blit white G16 to G8",
+		 .tst_fn = blit_white_G16_to_G8},
+		{.name = "Blit black G16 to GA88",
+		 .tst_fn = blit_black_G16_to_GA88},
+		{.name = "Blit white G16 to GA88",
+		 .tst_fn = blit_white_G16_to_GA88},
+		{.name = "Blit black G16 to G16",
+		 .tst_fn = blit_black_G16_to_G16},
+		{.name = "Blit white G16 to G16",
+		 .tst_fn = blit_white_G16_to_G16},
+		{.name = "Blit RGB101010 to RGB101010",
+		 .tst_fn = blit_equal_pixel_RGB101010_to_RGB101010},
+		{.name = "Blit xRGB8888 to xRGB8888",
+		 .tst_fn = blit_equal_pixel_xRGB8888_to_xRGB8888},
+		{.name = "Blit RGBA8888 to RGBA8888",
+		 .tst_fn = blit_equal_pixel_RGBA8888_to_RGBA8888},
+		{.name = "Blit RGB888 to RGB888",
+		 .tst_fn = blit_equal_pixel_RGB888_to_RGB888},
+		{.name = "Blit BGR888 to BGR888",
+		 .tst_fn = blit_equal_pixel_BGR888_to_BGR888},
+		{.name = "Blit RGB555 to RGB555",
+		 .tst_fn = blit_equal_pixel_RGB555_to_RGB555},
+		{.name = "Blit RGB565_BE to RGB565_BE",
+		 .tst_fn = blit_equal_pixel_RGB565_BE_to_RGB565_BE},
+		{.name = "Blit RGB565_LE to RGB565_LE",
+		 .tst_fn = blit_equal_pixel_RGB565_LE_to_RGB565_LE},
+		{.name = "Blit RGB666 to RGB666",
+		 .tst_fn = blit_equal_pixel_RGB666_to_RGB666},
+		{.name = "Blit RGB332 to RGB332",
+		 .tst_fn = blit_equal_pixel_RGB332_to_RGB332},
+		{.name = "Blit CMYK8888 to CMYK8888",
+		 .tst_fn = blit_equal_pixel_CMYK8888_to_CMYK8888},
+		{.name = "Blit G1_DB to G1_DB",
+		 .tst_fn = blit_equal_pixel_G1_DB_to_G1_DB},
+		{.name = "Blit G2_DB to G2_DB",
+		 .tst_fn = blit_equal_pixel_G2_DB_to_G2_DB},
+		{.name = "Blit G4_DB to G4_DB",
+		 .tst_fn = blit_equal_pixel_G4_DB_to_G4_DB},
+		{.name = "Blit G1_UB to G1_UB",
+		 .tst_fn = blit_equal_pixel_G1_UB_to_G1_UB},
+		{.name = "Blit G2_UB to G2_UB",
+		 .tst_fn = blit_equal_pixel_G2_UB_to_G2_UB},
+		{.name = "Blit G4_UB to G4_UB",
+		 .tst_fn = blit_equal_pixel_G4_UB_to_G4_UB},
+		{.name = "Blit G8 to G8",
+		 .tst_fn = blit_equal_pixel_G8_to_G8},
+		{.name = "Blit GA88 to GA88",
+		 .tst_fn = blit_equal_pixel_GA88_to_GA88},
+		{.name = "Blit G16 to G16",
+		 .tst_fn = blit_equal_pixel_G16_to_G16},
+
+		{.name = "Blit RGB888 to CMYK8888",
+		 .tst_fn = blit_red_RGB888_to_CMYK8888},
+		{.name = "Blit RGB888 to CMYK8888",
+		 .tst_fn = blit_green_RGB888_to_CMYK8888},
+		{.name = "Blit RGB888 to CMYK8888",
+		 .tst_fn = blit_blue_RGB888_to_CMYK8888},
+		{.name = "Blit RGB888 to CMYK8888",
+		 .tst_fn = blit_gray_RGB888_to_CMYK8888},
+		{.name = "Blit CMYK8888 to RGB888",
+		 .tst_fn = blit_red_CMYK8888_to_RGB888},
+		{.name = "Blit CMYK8888 to RGB888",
+		 .tst_fn = blit_green_CMYK8888_to_RGB888},
+		{.name = "Blit CMYK8888 to RGB888",
+		 .tst_fn = blit_blue_CMYK8888_to_RGB888},
+		{.name = "Blit CMYK8888 to RGB888",
+		 .tst_fn = blit_gray_CMYK8888_to_RGB888},
+
+		{.name = NULL}
+	}
+};
@@ -0,0 +1,6492 @@
+/*
+ * write_pixel tests.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <core/gp_write_pixels.gen.h>
+
+#include "tst_test.h"
+
+static void dump_buffer(const char *name, char *buf, unsigned int buf_len)
+{
+	unsigned int i;
+
+	printf("%s:\n{", name);
+
+	for (i = 0; i < buf_len; i++) {
+		printf("%i", !!buf[i]);
+
+		if (i != buf_len - 1)
+			printf(", ");
+
+		if (i % 26 == 25)
+			printf("\n ");
+	}
+
+	printf("}\n");
+}
+
+/*
+ * Compares two statically defined buffers
+ */
+#define COMPARE_BUFFERS(id, buf1, buf2) do {                  \
+	unsigned int buf_len = sizeof(buf2)/sizeof(*buf2);    \
+	unsigned int i;                                       \
+                                                              \
+	                                                      \
+	for (i = 0; i < buf_len; i++)                         \
+		if(buf1[i] != buf2[i]) {	              \
+			printf("%s\n", id);                   \
+			dump_buffer("wrote", buf1, buf_len);  \
+			dump_buffer("gen", buf2, buf_len);    \
+			tst_msg("Buffers are different");     \
+			return TST_FAILED;                    \
+		}                                             \
+	                                                      \
+	return TST_PASSED;                                   \
+} while (0)
+
+static int write_pixel_8_0_0_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 0, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_0_0_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 0, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_0_0_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 4, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=0 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_0_0_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 4, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=0 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_0_1_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_0_1_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 0, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_0_1_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=1 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_0_1_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 4, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=1 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_0_2_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_0_2_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 0, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_0_2_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=2 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_0_2_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 4, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=2 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_0_3_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_0_3_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 0, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_0_3_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=3 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_0_3_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 4, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=3 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_0_4_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_0_4_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 0, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_0_4_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=4 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_0_4_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 4, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=4 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_0_5_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_0_5_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 0, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_0_5_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=5 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_0_5_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 4, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=5 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_1_0_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 1, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_1_0_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 1, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_1_0_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 5, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=0 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_1_0_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 5, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=0 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_1_1_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_1_1_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 1, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_1_1_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=1 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_1_1_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 5, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=1 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_1_2_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_1_2_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 1, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_1_2_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=2 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_1_2_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 5, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=2 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_1_3_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_1_3_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 1, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_1_3_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=3 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_1_3_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 5, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=3 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_1_4_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_1_4_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 1, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_1_4_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=4 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_1_4_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 5, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=4 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_1_5_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_1_5_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 1, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_1_5_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=5 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_1_5_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 5, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=5 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_2_0_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 2, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_2_0_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 2, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_2_0_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 6, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=0 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_2_0_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 6, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=0 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_2_1_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_2_1_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 2, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_2_1_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=1 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_2_1_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 6, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=1 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_2_2_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_2_2_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 2, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_2_2_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=2 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_2_2_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 6, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=2 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_2_3_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_2_3_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 2, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_2_3_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=3 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_2_3_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 6, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=3 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_2_4_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_2_4_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 2, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_2_4_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=4 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_2_4_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 6, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=4 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_2_5_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_2_5_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 2, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_2_5_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=5 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_2_5_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 6, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=5 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_3_0_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 3, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_3_0_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 3, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_3_0_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 7, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=0 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_3_0_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 7, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=0 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_3_1_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_3_1_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 3, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_3_1_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=1 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_3_1_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 7, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=1 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_3_2_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_3_2_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 3, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_3_2_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=2 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_3_2_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 7, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=2 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_3_3_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_3_3_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 3, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_3_3_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=3 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_3_3_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 7, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=3 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_3_4_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_3_4_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 3, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_3_4_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=4 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_3_4_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 7, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=4 a=4", write_buf, gen_buf);
+}
+static int write_pixel_8_3_5_0(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_8_3_5_0_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 3, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_8_3_5_4(void)
+{
+	char write_buf[25] = {};
+	char gen_buf[25] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=5 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_8_3_5_4_alloc(void)
+{
+	char gen_buf[25] = {};
+	char *write_buf = malloc(25);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	memset(write_buf, 0, 25);
+
+	gp_write_pixels_8BPP(write_buf + 7, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=5 a=4", write_buf, gen_buf);
+}
+static int write_pixel_16_0_0_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_16BPP(write_buf + 0, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_0_0_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 0, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_0_1_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_0_1_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 0, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_0_2_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_0_2_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 0, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_0_3_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_0_3_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 0, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_0_4_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_0_4_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 0, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_0_5_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_0_5_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 0, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_1_0_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_16BPP(write_buf + 2, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_1_0_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 2, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_1_1_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_1_1_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 2, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_1_2_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_1_2_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 2, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_1_3_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_1_3_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 2, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_1_4_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_1_4_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 2, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_1_5_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_1_5_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 2, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_2_0_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_16BPP(write_buf + 4, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_2_0_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 4, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_2_1_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_2_1_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 4, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_2_2_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_2_2_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 4, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_2_3_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_2_3_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 4, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_2_4_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_2_4_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 4, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_2_5_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_2_5_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 4, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_3_0_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_16BPP(write_buf + 6, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_3_0_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 6, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_3_1_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_3_1_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 6, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_3_2_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_3_2_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 6, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_3_3_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_3_3_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 6, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_3_4_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_3_4_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 6, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_16_3_5_0(void)
+{
+	char write_buf[50] = {};
+	char gen_buf[50] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_16_3_5_0_alloc(void)
+{
+	char gen_buf[50] = {};
+	char *write_buf = malloc(50);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	memset(write_buf, 0, 50);
+
+	gp_write_pixels_16BPP(write_buf + 6, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_0_0_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 0, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_0_0_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 0, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_0_0_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 4, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=0 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_0_0_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 4, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=0 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_0_1_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_0_1_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 0, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_0_1_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=1 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_0_1_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 4, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=1 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_0_2_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_0_2_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 0, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_0_2_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=2 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_0_2_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 4, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=2 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_0_3_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_0_3_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 0, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_0_3_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=3 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_0_3_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 4, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=3 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_0_4_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_0_4_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 0, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_0_4_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=4 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_0_4_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 4, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=4 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_0_5_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_0_5_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 0, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_0_5_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=5 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_0_5_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 4, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=5 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_1_0_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 3, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_1_0_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 3, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_1_0_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 7, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=0 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_1_0_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 7, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=0 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_1_1_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_1_1_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 3, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_1_1_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=1 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_1_1_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 7, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=1 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_1_2_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_1_2_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 3, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_1_2_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=2 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_1_2_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 7, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=2 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_1_3_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_1_3_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 3, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_1_3_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=3 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_1_3_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 7, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=3 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_1_4_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_1_4_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 3, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_1_4_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=4 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_1_4_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 7, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=4 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_1_5_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_1_5_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 3, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_1_5_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=5 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_1_5_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 7, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=5 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_2_0_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 6, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_2_0_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 6, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_2_0_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 10, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=0 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_2_0_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 10, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=0 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_2_1_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_2_1_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 6, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_2_1_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=1 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_2_1_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 10, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=1 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_2_2_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_2_2_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 6, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_2_2_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=2 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_2_2_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 10, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=2 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_2_3_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_2_3_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 6, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_2_3_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=3 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_2_3_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 10, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=3 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_2_4_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_2_4_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 6, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_2_4_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=4 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_2_4_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 10, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=4 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_2_5_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_2_5_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 6, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_2_5_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=5 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_2_5_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 10, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=5 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_3_0_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 9, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_3_0_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 9, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_3_0_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 13, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=0 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_3_0_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 13, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=0 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_3_1_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_3_1_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 9, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_3_1_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=1 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_3_1_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 13, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=1 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_3_2_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_3_2_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 9, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_3_2_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=2 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_3_2_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 13, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=2 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_3_3_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_3_3_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 9, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_3_3_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=3 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_3_3_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 13, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=3 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_3_4_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_3_4_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 9, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_3_4_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=4 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_3_4_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 13, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=4 a=4", write_buf, gen_buf);
+}
+static int write_pixel_24_3_5_0(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_24_3_5_0_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 9, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_24_3_5_4(void)
+{
+	char write_buf[75] = {};
+	char gen_buf[75] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=5 a=4", write_buf, gen_buf);
+}
+
+static int write_pixel_24_3_5_4_alloc(void)
+{
+	char gen_buf[75] = {};
+	char *write_buf = malloc(75);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+
+	memset(write_buf, 0, 75);
+
+	gp_write_pixels_24BPP(write_buf + 13, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=5 a=4", write_buf, gen_buf);
+}
+static int write_pixel_32_0_0_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_32BPP(write_buf + 0, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_0_0_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 0, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_0_1_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_0_1_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 0, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_0_2_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_0_2_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 0, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_0_3_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_0_3_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 0, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_0_4_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_0_4_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 0, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_0_5_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_0_5_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 0, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_1_0_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_32BPP(write_buf + 4, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_1_0_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 4, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_1_1_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_1_1_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 4, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_1_2_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_1_2_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 4, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_1_3_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_1_3_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 4, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_1_4_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_1_4_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 4, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_1_5_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_1_5_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 4, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_2_0_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_32BPP(write_buf + 8, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_2_0_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 8, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_2_1_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_2_1_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 8, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_2_2_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_2_2_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 8, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_2_3_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_2_3_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 8, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_2_4_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_2_4_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 8, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_2_5_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_2_5_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 8, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=5 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_3_0_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_32BPP(write_buf + 12, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=0 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_3_0_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 12, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=0 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_3_1_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=1 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_3_1_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 12, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=1 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_3_2_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=2 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_3_2_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 12, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=2 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_3_3_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=3 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_3_3_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 12, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=3 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_3_4_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=4 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_3_4_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 12, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=4 a=0", write_buf, gen_buf);
+}
+static int write_pixel_32_3_5_0(void)
+{
+	char write_buf[100] = {};
+	char gen_buf[100] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=5 a=0", write_buf, gen_buf);
+}
+
+static int write_pixel_32_3_5_0_alloc(void)
+{
+	char gen_buf[100] = {};
+	char *write_buf = malloc(100);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+
+	memset(write_buf, 0, 100);
+
+	gp_write_pixels_32BPP(write_buf + 12, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=5 a=0", write_buf, gen_buf);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "write_pixel Testsuite",
+	.tests = {
+		{.name = "write_pixel 8 0 0 0 stack",
+		 .tst_fn = write_pixel_8_0_0_0},
+		{.name = "write_pixel 8 0 0 0 alloc",
+		 .tst_fn = write_pixel_8_0_0_0_alloc},
+		{.name = "write_pixel 8 0 0 4 stack",
+		 .tst_fn = write_pixel_8_0_0_4},
+		{.name = "write_pixel 8 0 0 4 alloc",
+		 .tst_fn = write_pixel_8_0_0_4_alloc},
+		{.name = "write_pixel 8 0 1 0 stack",
+		 .tst_fn = write_pixel_8_0_1_0},
+		{.name = "write_pixel 8 0 1 0 alloc",
+		 .tst_fn = write_pixel_8_0_1_0_alloc},
+		{.name = "write_pixel 8 0 1 4 stack",
+		 .tst_fn = write_pixel_8_0_1_4},
+		{.name = "write_pixel 8 0 1 4 alloc",
+		 .tst_fn = write_pixel_8_0_1_4_alloc},
+		{.name = "write_pixel 8 0 2 0 stack",
+		 .tst_fn = write_pixel_8_0_2_0},
+		{.name = "write_pixel 8 0 2 0 alloc",
+		 .tst_fn = write_pixel_8_0_2_0_alloc},
+		{.name = "write_pixel 8 0 2 4 stack",
+		 .tst_fn = write_pixel_8_0_2_4},
+		{.name = "write_pixel 8 0 2 4 alloc",
+		 .tst_fn = write_pixel_8_0_2_4_alloc},
+		{.name = "write_pixel 8 0 3 0 stack",
+		 .tst_fn = write_pixel_8_0_3_0},
+		{.name = "write_pixel 8 0 3 0 alloc",
+		 .tst_fn = write_pixel_8_0_3_0_alloc},
+		{.name = "write_pixel 8 0 3 4 stack",
+		 .tst_fn = write_pixel_8_0_3_4},
+		{.name = "write_pixel 8 0 3 4 alloc",
+		 .tst_fn = write_pixel_8_0_3_4_alloc},
+		{.name = "write_pixel 8 0 4 0 stack",
+		 .tst_fn = write_pixel_8_0_4_0},
+		{.name = "write_pixel 8 0 4 0 alloc",
+		 .tst_fn = write_pixel_8_0_4_0_alloc},
+		{.name = "write_pixel 8 0 4 4 stack",
+		 .tst_fn = write_pixel_8_0_4_4},
+		{.name = "write_pixel 8 0 4 4 alloc",
+		 .tst_fn = write_pixel_8_0_4_4_alloc},
+		{.name = "write_pixel 8 0 5 0 stack",
+		 .tst_fn = write_pixel_8_0_5_0},
+		{.name = "write_pixel 8 0 5 0 alloc",
+		 .tst_fn = write_pixel_8_0_5_0_alloc},
+		{.name = "write_pixel 8 0 5 4 stack",
+		 .tst_fn = write_pixel_8_0_5_4},
+		{.name = "write_pixel 8 0 5 4 alloc",
+		 .tst_fn = write_pixel_8_0_5_4_alloc},
+		{.name = "write_pixel 8 1 0 0 stack",
+		 .tst_fn = write_pixel_8_1_0_0},
+		{.name = "write_pixel 8 1 0 0 alloc",
+		 .tst_fn = write_pixel_8_1_0_0_alloc},
+		{.name = "write_pixel 8 1 0 4 stack",
+		 .tst_fn = write_pixel_8_1_0_4},
+		{.name = "write_pixel 8 1 0 4 alloc",
+		 .tst_fn = write_pixel_8_1_0_4_alloc},
+		{.name = "write_pixel 8 1 1 0 stack",
+		 .tst_fn = write_pixel_8_1_1_0},
+		{.name = "write_pixel 8 1 1 0 alloc",
+		 .tst_fn = write_pixel_8_1_1_0_alloc},
+		{.name = "write_pixel 8 1 1 4 stack",
+		 .tst_fn = write_pixel_8_1_1_4},
+		{.name = "write_pixel 8 1 1 4 alloc",
+		 .tst_fn = write_pixel_8_1_1_4_alloc},
+		{.name = "write_pixel 8 1 2 0 stack",
+		 .tst_fn = write_pixel_8_1_2_0},
+		{.name = "write_pixel 8 1 2 0 alloc",
+		 .tst_fn = write_pixel_8_1_2_0_alloc},
+		{.name = "write_pixel 8 1 2 4 stack",
+		 .tst_fn = write_pixel_8_1_2_4},
+		{.name = "write_pixel 8 1 2 4 alloc",
+		 .tst_fn = write_pixel_8_1_2_4_alloc},
+		{.name = "write_pixel 8 1 3 0 stack",
+		 .tst_fn = write_pixel_8_1_3_0},
+		{.name = "write_pixel 8 1 3 0 alloc",
+		 .tst_fn = write_pixel_8_1_3_0_alloc},
+		{.name = "write_pixel 8 1 3 4 stack",
+		 .tst_fn = write_pixel_8_1_3_4},
+		{.name = "write_pixel 8 1 3 4 alloc",
+		 .tst_fn = write_pixel_8_1_3_4_alloc},
+		{.name = "write_pixel 8 1 4 0 stack",
+		 .tst_fn = write_pixel_8_1_4_0},
+		{.name = "write_pixel 8 1 4 0 alloc",
+		 .tst_fn = write_pixel_8_1_4_0_alloc},
+		{.name = "write_pixel 8 1 4 4 stack",
+		 .tst_fn = write_pixel_8_1_4_4},
+		{.name = "write_pixel 8 1 4 4 alloc",
+		 .tst_fn = write_pixel_8_1_4_4_alloc},
+		{.name = "write_pixel 8 1 5 0 stack",
+		 .tst_fn = write_pixel_8_1_5_0},
+		{.name = "write_pixel 8 1 5 0 alloc",
+		 .tst_fn = write_pixel_8_1_5_0_alloc},
+		{.name = "write_pixel 8 1 5 4 stack",
+		 .tst_fn = write_pixel_8_1_5_4},
+		{.name = "write_pixel 8 1 5 4 alloc",
+		 .tst_fn = write_pixel_8_1_5_4_alloc},
+		{.name = "write_pixel 8 2 0 0 stack",
+		 .tst_fn = write_pixel_8_2_0_0},
+		{.name = "write_pixel 8 2 0 0 alloc",
+		 .tst_fn = write_pixel_8_2_0_0_alloc},
+		{.name = "write_pixel 8 2 0 4 stack",
+		 .tst_fn = write_pixel_8_2_0_4},
+		{.name = "write_pixel 8 2 0 4 alloc",
+		 .tst_fn = write_pixel_8_2_0_4_alloc},
+		{.name = "write_pixel 8 2 1 0 stack",
+		 .tst_fn = write_pixel_8_2_1_0},
+		{.name = "write_pixel 8 2 1 0 alloc",
+		 .tst_fn = write_pixel_8_2_1_0_alloc},
+		{.name = "write_pixel 8 2 1 4 stack",
+		 .tst_fn = write_pixel_8_2_1_4},
+		{.name = "write_pixel 8 2 1 4 alloc",
+		 .tst_fn = write_pixel_8_2_1_4_alloc},
+		{.name = "write_pixel 8 2 2 0 stack",
+		 .tst_fn = write_pixel_8_2_2_0},
+		{.name = "write_pixel 8 2 2 0 alloc",
+		 .tst_fn = write_pixel_8_2_2_0_alloc},
+		{.name = "write_pixel 8 2 2 4 stack",
+		 .tst_fn = write_pixel_8_2_2_4},
+		{.name = "write_pixel 8 2 2 4 alloc",
+		 .tst_fn = write_pixel_8_2_2_4_alloc},
+		{.name = "write_pixel 8 2 3 0 stack",
+		 .tst_fn = write_pixel_8_2_3_0},
+		{.name = "write_pixel 8 2 3 0 alloc",
+		 .tst_fn = write_pixel_8_2_3_0_alloc},
+		{.name = "write_pixel 8 2 3 4 stack",
+		 .tst_fn = write_pixel_8_2_3_4},
+		{.name = "write_pixel 8 2 3 4 alloc",
+		 .tst_fn = write_pixel_8_2_3_4_alloc},
+		{.name = "write_pixel 8 2 4 0 stack",
+		 .tst_fn = write_pixel_8_2_4_0},
+		{.name = "write_pixel 8 2 4 0 alloc",
+		 .tst_fn = write_pixel_8_2_4_0_alloc},
+		{.name = "write_pixel 8 2 4 4 stack",
+		 .tst_fn = write_pixel_8_2_4_4},
+		{.name = "write_pixel 8 2 4 4 alloc",
+		 .tst_fn = write_pixel_8_2_4_4_alloc},
+		{.name = "write_pixel 8 2 5 0 stack",
+		 .tst_fn = write_pixel_8_2_5_0},
+		{.name = "write_pixel 8 2 5 0 alloc",
+		 .tst_fn = write_pixel_8_2_5_0_alloc},
+		{.name = "write_pixel 8 2 5 4 stack",
+		 .tst_fn = write_pixel_8_2_5_4},
+		{.name = "write_pixel 8 2 5 4 alloc",
+		 .tst_fn = write_pixel_8_2_5_4_alloc},
+		{.name = "write_pixel 8 3 0 0 stack",
+		 .tst_fn = write_pixel_8_3_0_0},
+		{.name = "write_pixel 8 3 0 0 alloc",
+		 .tst_fn = write_pixel_8_3_0_0_alloc},
+		{.name = "write_pixel 8 3 0 4 stack",
+		 .tst_fn = write_pixel_8_3_0_4},
+		{.name = "write_pixel 8 3 0 4 alloc",
+		 .tst_fn = write_pixel_8_3_0_4_alloc},
+		{.name = "write_pixel 8 3 1 0 stack",
+		 .tst_fn = write_pixel_8_3_1_0},
+		{.name = "write_pixel 8 3 1 0 alloc",
+		 .tst_fn = write_pixel_8_3_1_0_alloc},
+		{.name = "write_pixel 8 3 1 4 stack",
+		 .tst_fn = write_pixel_8_3_1_4},
+		{.name = "write_pixel 8 3 1 4 alloc",
+		 .tst_fn = write_pixel_8_3_1_4_alloc},
+		{.name = "write_pixel 8 3 2 0 stack",
+		 .tst_fn = write_pixel_8_3_2_0},
+		{.name = "write_pixel 8 3 2 0 alloc",
+		 .tst_fn = write_pixel_8_3_2_0_alloc},
+		{.name = "write_pixel 8 3 2 4 stack",
+		 .tst_fn = write_pixel_8_3_2_4},
+		{.name = "write_pixel 8 3 2 4 alloc",
+		 .tst_fn = write_pixel_8_3_2_4_alloc},
+		{.name = "write_pixel 8 3 3 0 stack",
+		 .tst_fn = write_pixel_8_3_3_0},
+		{.name = "write_pixel 8 3 3 0 alloc",
+		 .tst_fn = write_pixel_8_3_3_0_alloc},
+		{.name = "write_pixel 8 3 3 4 stack",
+		 .tst_fn = write_pixel_8_3_3_4},
+		{.name = "write_pixel 8 3 3 4 alloc",
+		 .tst_fn = write_pixel_8_3_3_4_alloc},
+		{.name = "write_pixel 8 3 4 0 stack",
+		 .tst_fn = write_pixel_8_3_4_0},
+		{.name = "write_pixel 8 3 4 0 alloc",
+		 .tst_fn = write_pixel_8_3_4_0_alloc},
+		{.name = "write_pixel 8 3 4 4 stack",
+		 .tst_fn = write_pixel_8_3_4_4},
+		{.name = "write_pixel 8 3 4 4 alloc",
+		 .tst_fn = write_pixel_8_3_4_4_alloc},
+		{.name = "write_pixel 8 3 5 0 stack",
+		 .tst_fn = write_pixel_8_3_5_0},
+		{.name = "write_pixel 8 3 5 0 alloc",
+		 .tst_fn = write_pixel_8_3_5_0_alloc},
+		{.name = "write_pixel 8 3 5 4 stack",
+		 .tst_fn = write_pixel_8_3_5_4},
+		{.name = "write_pixel 8 3 5 4 alloc",
+		 .tst_fn = write_pixel_8_3_5_4_alloc},
+		{.name = "write_pixel 16 0 0 0 stack",
+		 .tst_fn = write_pixel_16_0_0_0},
+		{.name = "write_pixel 16 0 0 0 alloc",
+		 .tst_fn = write_pixel_16_0_0_0_alloc},
+		{.name = "write_pixel 16 0 1 0 stack",
+		 .tst_fn = write_pixel_16_0_1_0},
+		{.name = "write_pixel 16 0 1 0 alloc",
+		 .tst_fn = write_pixel_16_0_1_0_alloc},
+		{.name = "write_pixel 16 0 2 0 stack",
+		 .tst_fn = write_pixel_16_0_2_0},
+		{.name = "write_pixel 16 0 2 0 alloc",
+		 .tst_fn = write_pixel_16_0_2_0_alloc},
+		{.name = "write_pixel 16 0 3 0 stack",
+		 .tst_fn = write_pixel_16_0_3_0},
+		{.name = "write_pixel 16 0 3 0 alloc",
+		 .tst_fn = write_pixel_16_0_3_0_alloc},
+		{.name = "write_pixel 16 0 4 0 stack",
+		 .tst_fn = write_pixel_16_0_4_0},
+		{.name = "write_pixel 16 0 4 0 alloc",
+		 .tst_fn = write_pixel_16_0_4_0_alloc},
+		{.name = "write_pixel 16 0 5 0 stack",
+		 .tst_fn = write_pixel_16_0_5_0},
+		{.name = "write_pixel 16 0 5 0 alloc",
+		 .tst_fn = write_pixel_16_0_5_0_alloc},
+		{.name = "write_pixel 16 1 0 0 stack",
+		 .tst_fn = write_pixel_16_1_0_0},
+		{.name = "write_pixel 16 1 0 0 alloc",
+		 .tst_fn = write_pixel_16_1_0_0_alloc},
+		{.name = "write_pixel 16 1 1 0 stack",
+		 .tst_fn = write_pixel_16_1_1_0},
+		{.name = "write_pixel 16 1 1 0 alloc",
+		 .tst_fn = write_pixel_16_1_1_0_alloc},
+		{.name = "write_pixel 16 1 2 0 stack",
+		 .tst_fn = write_pixel_16_1_2_0},
+		{.name = "write_pixel 16 1 2 0 alloc",
+		 .tst_fn = write_pixel_16_1_2_0_alloc},
+		{.name = "write_pixel 16 1 3 0 stack",
+		 .tst_fn = write_pixel_16_1_3_0},
+		{.name = "write_pixel 16 1 3 0 alloc",
+		 .tst_fn = write_pixel_16_1_3_0_alloc},
+		{.name = "write_pixel 16 1 4 0 stack",
+		 .tst_fn = write_pixel_16_1_4_0},
+		{.name = "write_pixel 16 1 4 0 alloc",
+		 .tst_fn = write_pixel_16_1_4_0_alloc},
+		{.name = "write_pixel 16 1 5 0 stack",
+		 .tst_fn = write_pixel_16_1_5_0},
+		{.name = "write_pixel 16 1 5 0 alloc",
+		 .tst_fn = write_pixel_16_1_5_0_alloc},
+		{.name = "write_pixel 16 2 0 0 stack",
+		 .tst_fn = write_pixel_16_2_0_0},
+		{.name = "write_pixel 16 2 0 0 alloc",
+		 .tst_fn = write_pixel_16_2_0_0_alloc},
+		{.name = "write_pixel 16 2 1 0 stack",
+		 .tst_fn = write_pixel_16_2_1_0},
+		{.name = "write_pixel 16 2 1 0 alloc",
+		 .tst_fn = write_pixel_16_2_1_0_alloc},
+		{.name = "write_pixel 16 2 2 0 stack",
+		 .tst_fn = write_pixel_16_2_2_0},
+		{.name = "write_pixel 16 2 2 0 alloc",
+		 .tst_fn = write_pixel_16_2_2_0_alloc},
+		{.name = "write_pixel 16 2 3 0 stack",
+		 .tst_fn = write_pixel_16_2_3_0},
+		{.name = "write_pixel 16 2 3 0 alloc",
+		 .tst_fn = write_pixel_16_2_3_0_alloc},
+		{.name = "write_pixel 16 2 4 0 stack",
+		 .tst_fn = write_pixel_16_2_4_0},
+		{.name = "write_pixel 16 2 4 0 alloc",
+		 .tst_fn = write_pixel_16_2_4_0_alloc},
+		{.name = "write_pixel 16 2 5 0 stack",
+		 .tst_fn = write_pixel_16_2_5_0},
+		{.name = "write_pixel 16 2 5 0 alloc",
+		 .tst_fn = write_pixel_16_2_5_0_alloc},
+		{.name = "write_pixel 16 3 0 0 stack",
+		 .tst_fn = write_pixel_16_3_0_0},
+		{.name = "write_pixel 16 3 0 0 alloc",
+		 .tst_fn = write_pixel_16_3_0_0_alloc},
+		{.name = "write_pixel 16 3 1 0 stack",
+		 .tst_fn = write_pixel_16_3_1_0},
+		{.name = "write_pixel 16 3 1 0 alloc",
+		 .tst_fn = write_pixel_16_3_1_0_alloc},
+		{.name = "write_pixel 16 3 2 0 stack",
+		 .tst_fn = write_pixel_16_3_2_0},
+		{.name = "write_pixel 16 3 2 0 alloc",
+		 .tst_fn = write_pixel_16_3_2_0_alloc},
+		{.name = "write_pixel 16 3 3 0 stack",
+		 .tst_fn = write_pixel_16_3_3_0},
+		{.name = "write_pixel 16 3 3 0 alloc",
+		 .tst_fn = write_pixel_16_3_3_0_alloc},
+		{.name = "write_pixel 16 3 4 0 stack",
+		 .tst_fn = write_pixel_16_3_4_0},
+		{.name = "write_pixel 16 3 4 0 alloc",
+		 .tst_fn = write_pixel_16_3_4_0_alloc},
+		{.name = "write_pixel 16 3 5 0 stack",
+		 .tst_fn = write_pixel_16_3_5_0},
+		{.name = "write_pixel 16 3 5 0 alloc",
+		 .tst_fn = write_pixel_16_3_5_0_alloc},
+		{.name = "write_pixel 24 0 0 0 stack",
+		 .tst_fn = write_pixel_24_0_0_0},
+		{.name = "write_pixel 24 0 0 0 alloc",
+		 .tst_fn = write_pixel_24_0_0_0_alloc},
+		{.name = "write_pixel 24 0 0 4 stack",
+		 .tst_fn = write_pixel_24_0_0_4},
+		{.name = "write_pixel 24 0 0 4 alloc",
+		 .tst_fn = write_pixel_24_0_0_4_alloc},
+		{.name = "write_pixel 24 0 1 0 stack",
+		 .tst_fn = write_pixel_24_0_1_0},
+		{.name = "write_pixel 24 0 1 0 alloc",
+		 .tst_fn = write_pixel_24_0_1_0_alloc},
+		{.name = "write_pixel 24 0 1 4 stack",
+		 .tst_fn = write_pixel_24_0_1_4},
+		{.name = "write_pixel 24 0 1 4 alloc",
+		 .tst_fn = write_pixel_24_0_1_4_alloc},
+		{.name = "write_pixel 24 0 2 0 stack",
+		 .tst_fn = write_pixel_24_0_2_0},
+		{.name = "write_pixel 24 0 2 0 alloc",
+		 .tst_fn = write_pixel_24_0_2_0_alloc},
+		{.name = "write_pixel 24 0 2 4 stack",
+		 .tst_fn = write_pixel_24_0_2_4},
+		{.name = "write_pixel 24 0 2 4 alloc",
+		 .tst_fn = write_pixel_24_0_2_4_alloc},
+		{.name = "write_pixel 24 0 3 0 stack",
+		 .tst_fn = write_pixel_24_0_3_0},
+		{.name = "write_pixel 24 0 3 0 alloc",
+		 .tst_fn = write_pixel_24_0_3_0_alloc},
+		{.name = "write_pixel 24 0 3 4 stack",
+		 .tst_fn = write_pixel_24_0_3_4},
+		{.name = "write_pixel 24 0 3 4 alloc",
+		 .tst_fn = write_pixel_24_0_3_4_alloc},
+		{.name = "write_pixel 24 0 4 0 stack",
+		 .tst_fn = write_pixel_24_0_4_0},
+		{.name = "write_pixel 24 0 4 0 alloc",
+		 .tst_fn = write_pixel_24_0_4_0_alloc},
+		{.name = "write_pixel 24 0 4 4 stack",
+		 .tst_fn = write_pixel_24_0_4_4},
+		{.name = "write_pixel 24 0 4 4 alloc",
+		 .tst_fn = write_pixel_24_0_4_4_alloc},
+		{.name = "write_pixel 24 0 5 0 stack",
+		 .tst_fn = write_pixel_24_0_5_0},
+		{.name = "write_pixel 24 0 5 0 alloc",
+		 .tst_fn = write_pixel_24_0_5_0_alloc},
+		{.name = "write_pixel 24 0 5 4 stack",
+		 .tst_fn = write_pixel_24_0_5_4},
+		{.name = "write_pixel 24 0 5 4 alloc",
+		 .tst_fn = write_pixel_24_0_5_4_alloc},
+		{.name = "write_pixel 24 1 0 0 stack",
+		 .tst_fn = write_pixel_24_1_0_0},
+		{.name = "write_pixel 24 1 0 0 alloc",
+		 .tst_fn = write_pixel_24_1_0_0_alloc},
+		{.name = "write_pixel 24 1 0 4 stack",
+		 .tst_fn = write_pixel_24_1_0_4},
+		{.name = "write_pixel 24 1 0 4 alloc",
+		 .tst_fn = write_pixel_24_1_0_4_alloc},
+		{.name = "write_pixel 24 1 1 0 stack",
+		 .tst_fn = write_pixel_24_1_1_0},
+		{.name = "write_pixel 24 1 1 0 alloc",
+		 .tst_fn = write_pixel_24_1_1_0_alloc},
+		{.name = "write_pixel 24 1 1 4 stack",
+		 .tst_fn = write_pixel_24_1_1_4},
+		{.name = "write_pixel 24 1 1 4 alloc",
+		 .tst_fn = write_pixel_24_1_1_4_alloc},
+		{.name = "write_pixel 24 1 2 0 stack",
+		 .tst_fn = write_pixel_24_1_2_0},
+		{.name = "write_pixel 24 1 2 0 alloc",
+		 .tst_fn = write_pixel_24_1_2_0_alloc},
+		{.name = "write_pixel 24 1 2 4 stack",
+		 .tst_fn = write_pixel_24_1_2_4},
+		{.name = "write_pixel 24 1 2 4 alloc",
+		 .tst_fn = write_pixel_24_1_2_4_alloc},
+		{.name = "write_pixel 24 1 3 0 stack",
+		 .tst_fn = write_pixel_24_1_3_0},
+		{.name = "write_pixel 24 1 3 0 alloc",
+		 .tst_fn = write_pixel_24_1_3_0_alloc},
+		{.name = "write_pixel 24 1 3 4 stack",
+		 .tst_fn = write_pixel_24_1_3_4},
+		{.name = "write_pixel 24 1 3 4 alloc",
+		 .tst_fn = write_pixel_24_1_3_4_alloc},
+		{.name = "write_pixel 24 1 4 0 stack",
+		 .tst_fn = write_pixel_24_1_4_0},
+		{.name = "write_pixel 24 1 4 0 alloc",
+		 .tst_fn = write_pixel_24_1_4_0_alloc},
+		{.name = "write_pixel 24 1 4 4 stack",
+		 .tst_fn = write_pixel_24_1_4_4},
+		{.name = "write_pixel 24 1 4 4 alloc",
+		 .tst_fn = write_pixel_24_1_4_4_alloc},
+		{.name = "write_pixel 24 1 5 0 stack",
+		 .tst_fn = write_pixel_24_1_5_0},
+		{.name = "write_pixel 24 1 5 0 alloc",
+		 .tst_fn = write_pixel_24_1_5_0_alloc},
+		{.name = "write_pixel 24 1 5 4 stack",
+		 .tst_fn = write_pixel_24_1_5_4},
+		{.name = "write_pixel 24 1 5 4 alloc",
+		 .tst_fn = write_pixel_24_1_5_4_alloc},
+		{.name = "write_pixel 24 2 0 0 stack",
+		 .tst_fn = write_pixel_24_2_0_0},
+		{.name = "write_pixel 24 2 0 0 alloc",
+		 .tst_fn = write_pixel_24_2_0_0_alloc},
+		{.name = "write_pixel 24 2 0 4 stack",
+		 .tst_fn = write_pixel_24_2_0_4},
+		{.name = "write_pixel 24 2 0 4 alloc",
+		 .tst_fn = write_pixel_24_2_0_4_alloc},
+		{.name = "write_pixel 24 2 1 0 stack",
+		 .tst_fn = write_pixel_24_2_1_0},
+		{.name = "write_pixel 24 2 1 0 alloc",
+		 .tst_fn = write_pixel_24_2_1_0_alloc},
+		{.name = "write_pixel 24 2 1 4 stack",
+		 .tst_fn = write_pixel_24_2_1_4},
+		{.name = "write_pixel 24 2 1 4 alloc",
+		 .tst_fn = write_pixel_24_2_1_4_alloc},
+		{.name = "write_pixel 24 2 2 0 stack",
+		 .tst_fn = write_pixel_24_2_2_0},
+		{.name = "write_pixel 24 2 2 0 alloc",
+		 .tst_fn = write_pixel_24_2_2_0_alloc},
+		{.name = "write_pixel 24 2 2 4 stack",
+		 .tst_fn = write_pixel_24_2_2_4},
+		{.name = "write_pixel 24 2 2 4 alloc",
+		 .tst_fn = write_pixel_24_2_2_4_alloc},
+		{.name = "write_pixel 24 2 3 0 stack",
+		 .tst_fn = write_pixel_24_2_3_0},
+		{.name = "write_pixel 24 2 3 0 alloc",
+		 .tst_fn = write_pixel_24_2_3_0_alloc},
+		{.name = "write_pixel 24 2 3 4 stack",
+		 .tst_fn = write_pixel_24_2_3_4},
+		{.name = "write_pixel 24 2 3 4 alloc",
+		 .tst_fn = write_pixel_24_2_3_4_alloc},
+		{.name = "write_pixel 24 2 4 0 stack",
+		 .tst_fn = write_pixel_24_2_4_0},
+		{.name = "write_pixel 24 2 4 0 alloc",
+		 .tst_fn = write_pixel_24_2_4_0_alloc},
+		{.name = "write_pixel 24 2 4 4 stack",
+		 .tst_fn = write_pixel_24_2_4_4},
+		{.name = "write_pixel 24 2 4 4 alloc",
+		 .tst_fn = write_pixel_24_2_4_4_alloc},
+		{.name = "write_pixel 24 2 5 0 stack",
+		 .tst_fn = write_pixel_24_2_5_0},
+		{.name = "write_pixel 24 2 5 0 alloc",
+		 .tst_fn = write_pixel_24_2_5_0_alloc},
+		{.name = "write_pixel 24 2 5 4 stack",
+		 .tst_fn = write_pixel_24_2_5_4},
+		{.name = "write_pixel 24 2 5 4 alloc",
+		 .tst_fn = write_pixel_24_2_5_4_alloc},
+		{.name = "write_pixel 24 3 0 0 stack",
+		 .tst_fn = write_pixel_24_3_0_0},
+		{.name = "write_pixel 24 3 0 0 alloc",
+		 .tst_fn = write_pixel_24_3_0_0_alloc},
+		{.name = "write_pixel 24 3 0 4 stack",
+		 .tst_fn = write_pixel_24_3_0_4},
+		{.name = "write_pixel 24 3 0 4 alloc",
+		 .tst_fn = write_pixel_24_3_0_4_alloc},
+		{.name = "write_pixel 24 3 1 0 stack",
+		 .tst_fn = write_pixel_24_3_1_0},
+		{.name = "write_pixel 24 3 1 0 alloc",
+		 .tst_fn = write_pixel_24_3_1_0_alloc},
+		{.name = "write_pixel 24 3 1 4 stack",
+		 .tst_fn = write_pixel_24_3_1_4},
+		{.name = "write_pixel 24 3 1 4 alloc",
+		 .tst_fn = write_pixel_24_3_1_4_alloc},
+		{.name = "write_pixel 24 3 2 0 stack",
+		 .tst_fn = write_pixel_24_3_2_0},
+		{.name = "write_pixel 24 3 2 0 alloc",
+		 .tst_fn = write_pixel_24_3_2_0_alloc},
+		{.name = "write_pixel 24 3 2 4 stack",
+		 .tst_fn = write_pixel_24_3_2_4},
+		{.name = "write_pixel 24 3 2 4 alloc",
+		 .tst_fn = write_pixel_24_3_2_4_alloc},
+		{.name = "write_pixel 24 3 3 0 stack",
+		 .tst_fn = write_pixel_24_3_3_0},
+		{.name = "write_pixel 24 3 3 0 alloc",
+		 .tst_fn = write_pixel_24_3_3_0_alloc},
+		{.name = "write_pixel 24 3 3 4 stack",
+		 .tst_fn = write_pixel_24_3_3_4},
+		{.name = "write_pixel 24 3 3 4 alloc",
+		 .tst_fn = write_pixel_24_3_3_4_alloc},
+		{.name = "write_pixel 24 3 4 0 stack",
+		 .tst_fn = write_pixel_24_3_4_0},
+		{.name = "write_pixel 24 3 4 0 alloc",
+		 .tst_fn = write_pixel_24_3_4_0_alloc},
+		{.name = "write_pixel 24 3 4 4 stack",
+		 .tst_fn = write_pixel_24_3_4_4},
+		{.name = "write_pixel 24 3 4 4 alloc",
+		 .tst_fn = write_pixel_24_3_4_4_alloc},
+		{.name = "write_pixel 24 3 5 0 stack",
+		 .tst_fn = write_pixel_24_3_5_0},
+		{.name = "write_pixel 24 3 5 0 alloc",
+		 .tst_fn = write_pixel_24_3_5_0_alloc},
+		{.name = "write_pixel 24 3 5 4 stack",
+		 .tst_fn = write_pixel_24_3_5_4},
+		{.name = "write_pixel 24 3 5 4 alloc",
+		 .tst_fn = write_pixel_24_3_5_4_alloc},
+		{.name = "write_pixel 32 0 0 0 stack",
+		 .tst_fn = write_pixel_32_0_0_0},
+		{.name = "write_pixel 32 0 0 0 alloc",
+		 .tst_fn = write_pixel_32_0_0_0_alloc},
+		{.name = "write_pixel 32 0 1 0 stack",
+		 .tst_fn = write_pixel_32_0_1_0},
+		{.name = "write_pixel 32 0 1 0 alloc",
+		 .tst_fn = write_pixel_32_0_1_0_alloc},
+		{.name = "write_pixel 32 0 2 0 stack",
+		 .tst_fn = write_pixel_32_0_2_0},
+		{.name = "write_pixel 32 0 2 0 alloc",
+		 .tst_fn = write_pixel_32_0_2_0_alloc},
+		{.name = "write_pixel 32 0 3 0 stack",
+		 .tst_fn = write_pixel_32_0_3_0},
+		{.name = "write_pixel 32 0 3 0 alloc",
+		 .tst_fn = write_pixel_32_0_3_0_alloc},
+		{.name = "write_pixel 32 0 4 0 stack",
+		 .tst_fn = write_pixel_32_0_4_0},
+		{.name = "write_pixel 32 0 4 0 alloc",
+		 .tst_fn = write_pixel_32_0_4_0_alloc},
+		{.name = "write_pixel 32 0 5 0 stack",
+		 .tst_fn = write_pixel_32_0_5_0},
+		{.name = "write_pixel 32 0 5 0 alloc",
+		 .tst_fn = write_pixel_32_0_5_0_alloc},
+		{.name = "write_pixel 32 1 0 0 stack",
+		 .tst_fn = write_pixel_32_1_0_0},
+		{.name = "write_pixel 32 1 0 0 alloc",
+		 .tst_fn = write_pixel_32_1_0_0_alloc},
+		{.name = "write_pixel 32 1 1 0 stack",
+		 .tst_fn = write_pixel_32_1_1_0},
+		{.name = "write_pixel 32 1 1 0 alloc",
+		 .tst_fn = write_pixel_32_1_1_0_alloc},
+		{.name = "write_pixel 32 1 2 0 stack",
+		 .tst_fn = write_pixel_32_1_2_0},
+		{.name = "write_pixel 32 1 2 0 alloc",
+		 .tst_fn = write_pixel_32_1_2_0_alloc},
+		{.name = "write_pixel 32 1 3 0 stack",
+		 .tst_fn = write_pixel_32_1_3_0},
+		{.name = "write_pixel 32 1 3 0 alloc",
+		 .tst_fn = write_pixel_32_1_3_0_alloc},
+		{.name = "write_pixel 32 1 4 0 stack",
+		 .tst_fn = write_pixel_32_1_4_0},
+		{.name = "write_pixel 32 1 4 0 alloc",
+		 .tst_fn = write_pixel_32_1_4_0_alloc},
+		{.name = "write_pixel 32 1 5 0 stack",
+		 .tst_fn = write_pixel_32_1_5_0},
+		{.name = "write_pixel 32 1 5 0 alloc",
+		 .tst_fn = write_pixel_32_1_5_0_alloc},
+		{.name = "write_pixel 32 2 0 0 stack",
+		 .tst_fn = write_pixel_32_2_0_0},
+		{.name = "write_pixel 32 2 0 0 alloc",
+		 .tst_fn = write_pixel_32_2_0_0_alloc},
+		{.name = "write_pixel 32 2 1 0 stack",
+		 .tst_fn = write_pixel_32_2_1_0},
+		{.name = "write_pixel 32 2 1 0 alloc",
+		 .tst_fn = write_pixel_32_2_1_0_alloc},
+		{.name = "write_pixel 32 2 2 0 stack",
+		 .tst_fn = write_pixel_32_2_2_0},
+		{.name = "write_pixel 32 2 2 0 alloc",
+		 .tst_fn = write_pixel_32_2_2_0_alloc},
+		{.name = "write_pixel 32 2 3 0 stack",
+		 .tst_fn = write_pixel_32_2_3_0},
+		{.name = "write_pixel 32 2 3 0 alloc",
+		 .tst_fn = write_pixel_32_2_3_0_alloc},
+		{.name = "write_pixel 32 2 4 0 stack",
+		 .tst_fn = write_pixel_32_2_4_0},
+		{.name = "write_pixel 32 2 4 0 alloc",
+		 .tst_fn = write_pixel_32_2_4_0_alloc},
+		{.name = "write_pixel 32 2 5 0 stack",
+		 .tst_fn = write_pixel_32_2_5_0},
+		{.name = "write_pixel 32 2 5 0 alloc",
+		 .tst_fn = write_pixel_32_2_5_0_alloc},
+		{.name = "write_pixel 32 3 0 0 stack",
+		 .tst_fn = write_pixel_32_3_0_0},
+		{.name = "write_pixel 32 3 0 0 alloc",
+		 .tst_fn = write_pixel_32_3_0_0_alloc},
+		{.name = "write_pixel 32 3 1 0 stack",
+		 .tst_fn = write_pixel_32_3_1_0},
+		{.name = "write_pixel 32 3 1 0 alloc",
+		 .tst_fn = write_pixel_32_3_1_0_alloc},
+		{.name = "write_pixel 32 3 2 0 stack",
+		 .tst_fn = write_pixel_32_3_2_0},
+		{.name = "write_pixel 32 3 2 0 alloc",
+		 .tst_fn = write_pixel_32_3_2_0_alloc},
+		{.name = "write_pixel 32 3 3 0 stack",
+		 .tst_fn = write_pixel_32_3_3_0},
+		{.name = "write_pixel 32 3 3 0 alloc",
+		 .tst_fn = write_pixel_32_3_3_0_alloc},
+		{.name = "write_pixel 32 3 4 0 stack",
+		 .tst_fn = write_pixel_32_3_4_0},
+		{.name = "write_pixel 32 3 4 0 alloc",
+		 .tst_fn = write_pixel_32_3_4_0_alloc},
+		{.name = "write_pixel 32 3 5 0 stack",
+		 .tst_fn = write_pixel_32_3_5_0},
+		{.name = "write_pixel 32 3 5 0 alloc",
+		 .tst_fn = write_pixel_32_3_5_0_alloc},
+		{.name = NULL}
+	}
+};
@@ -0,0 +1,272 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <errno.h>
+#include <core/gp_core.h>
+#include <filters/gp_filters.h>
+#include "tst_test.h"
+
+static void fill_random(gp_pixmap *pixmap)
+{
+	gp_coord x, y;
+
+	srandom(42);
+
+	for (y = 0; y < (gp_coord)pixmap->h; y++) {
+		for (x = 0; x < (gp_coord)pixmap->w; x++)
+			gp_putpixel_raw(pixmap, x, y, random());
+	}
+}
+
+static void tables_random(gp_filter_tables *tables, gp_pixel_type pixel_type)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(pixel_type);
+	unsigned int i;
+	gp_pixel j;
+
+	srandom(7);
+
+	for (i = 0; i < desc->numchannels; i++) {
+		gp_pixel chan_max = (1 << desc->channels[i].size);
+
+		for (j = 0; j < chan_max; j++)
+			tables->table[i][j] = random() % chan_max;
+	}
+}
+
+/* Straightforward per channel application to compare against */
+static gp_pixel apply_pixel(gp_pixel pix, const gp_pixel_type_desc *desc,
+                            const gp_filter_tables *tables)
+{
+	gp_pixel ret = pix;
+	unsigned int i;
+
+	for (i = 0; i < desc->numchannels; i++) {
+		unsigned int off = desc->channels[i].offset;
+		gp_pixel mask = (1 << desc->channels[i].size) - 1;
+		gp_pixel val = (pix >> off) & mask;
+
+		ret &= ~(mask << off);
+		ret |= tables->table[i][val] << off;
+	}
+
+	return ret;
+}
+
+static int progress(gp_progress_cb *self)
+{
+	(void) self;
+	return 0;
+}
+
+static int apply_vs_reference(gp_pixel_type pixel_type, unsigned int threads)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(pixel_type);
+	gp_pixmap *src = gp_pixmap_alloc(123, 371, pixel_type);
+	gp_pixmap *dst = gp_pixmap_alloc(123, 371, pixel_type);
+	gp_progress_cb callback = {.callback = progress, .threads = threads};
+	gp_filter_tables tables;
+	gp_coord x, y;
+	int ret = TST_PASSED;
+
+	if (!src || !dst || gp_filter_tables_init_type(&tables, pixel_type)) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		return TST_UNTESTED;
+	}
+
+	fill_random(src);
+	tables_random(&tables, pixel_type);
+
+	/* Leaves a one pixel border in dst untouched */
+	if (gp_filter_tables_apply(src, 1, 1, src->w - 2, src->h - 2,
+	                           dst, 1, 1, &tables, &callback)) {
+		tst_msg("gp_filter_tables_apply() failed");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (callback.percentage != 100) {
+		tst_msg("Wrong final percentage %f", callback.percentage);
+		ret = TST_FAILED;
+	}
+
+	for (y = 1; y < (gp_coord)src->h - 1; y++) {
+		for (x = 1; x < (gp_coord)src->w - 1; x++) {
+			gp_pixel exp = apply_pixel(gp_getpixel_raw(src, x, y), desc, &tables);
+			gp_pixel pix = gp_getpixel_raw(dst, x, y);
+
+			if (exp != pix) {
+				tst_msg("Pixels differ at %i %i 0x%08x != 0x%08x",
+				        x, y, pix, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+	/* The in-place result has to be the same */
+	if (gp_filter_tables_apply(src, 1, 1, src->w - 2, src->h - 2,
+	                           src, 1, 1, &tables, &callback)) {
+		tst_msg("In-place gp_filter_tables_apply() failed");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	for (y = 1; y < (gp_coord)src->h - 1; y++) {
+		for (x = 1; x < (gp_coord)src->w - 1; x++) {
+			if (gp_getpixel_raw(src, x, y) != gp_getpixel_raw(dst, x, y)) {
+				tst_msg("In-place pixels differ at %i %i", x, y);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_filter_tables_free(&tables);
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+
+	return ret;
+}
+
+static int apply_rgb888(void)
+{
+	return apply_vs_reference(GP_PIXEL_RGB888, 1);
+}
+
+static int apply_bgr888(void)
+{
+	return apply_vs_reference(GP_PIXEL_BGR888, 1);
+}
+
+static int apply_xrgb8888(void)
+{
+	return apply_vs_reference(GP_PIXEL_xRGB8888, 1);
+}
+
+static int apply_rgba8888(void)
+{
+	return apply_vs_reference(GP_PIXEL_RGBA8888, 1);
+}
+
+static int apply_g8(void)
+{
+	return apply_vs_reference(GP_PIXEL_G8, 1);
+}
+
+static int apply_rgb565(void)
+{
+	return apply_vs_reference(GP_PIXEL_RGB565, 1);
+}
+
+static int apply_rgb888_mp(void)
+{
+	return apply_vs_reference(GP_PIXEL_RGB888, 4);
+}
+
+static int apply_rgb565_mp(void)
+{
+	return apply_vs_reference(GP_PIXEL_RGB565, 4);
+}
+
+static int apply_g4_mp(void)
+{
+	return apply_vs_reference(GP_PIXEL_G4, 3);
+}
+
+static gp_pixmap *bench_pixmap;
+static gp_filter_tables bench_tables;
+
+static int bench_init(void)
+{
+	bench_pixmap = gp_pixmap_alloc(2000, 2000, GP_PIXEL_RGB888);
+
+	if (!bench_pixmap)
+		return 1;
+
+	if (gp_filter_tables_init_type(&bench_tables, GP_PIXEL_RGB888))
+		return 1;
+
+	fill_random(bench_pixmap);
+	tables_random(&bench_tables, GP_PIXEL_RGB888);
+
+	return 0;
+}
+
+static int bench_apply(unsigned int threads)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = threads};
+
+	if (!bench_pixmap && bench_init())
+		return TST_UNTESTED;
+
+	if (gp_filter_tables_apply(bench_pixmap, 0, 0, bench_pixmap->w,
+	                           bench_pixmap->h, bench_pixmap, 0, 0,
+	                           &bench_tables, &callback))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int bench_apply_1(void)
+{
+	return bench_apply(1);
+}
+
+static int bench_apply_4(void)
+{
+	return bench_apply(4);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Apply tables testsuite",
+	.tests = {
+		{.name = "Apply tables RGB888",
+		 .tst_fn = apply_rgb888,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Apply tables BGR888",
+		 .tst_fn = apply_bgr888,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Apply tables xRGB8888",
+		 .tst_fn = apply_xrgb8888,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Apply tables RGBA8888",
+		 .tst_fn = apply_rgba8888,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Apply tables G8",
+		 .tst_fn = apply_g8,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Apply tables RGB565",
+		 .tst_fn = apply_rgb565,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Apply tables RGB888 4 threads",
+		 .tst_fn = apply_rgb888_mp},
+
+		{.name = "Apply tables RGB565 4 threads",
+		 .tst_fn = apply_rgb565_mp},
+
+		{.name = "Apply tables G4 3 threads",
+		 .tst_fn = apply_g4_mp},
+
+		{.name = "Apply tables 2000x2000 1 thread",
+		 .tst_fn = bench_apply_1,
+		 .bench_iter = 10},
+
+		{.name = "Apply tables 2000x2000 4 threads",
+		 .tst_fn = bench_apply_4,
+		 .bench_iter = 10},
+
+		{},
+	}
+};
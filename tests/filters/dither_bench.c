@@ -1,9 +1,14 @@
 // SPDX-License-Identifier: GPL-2.1-or-later
 /*
- * Copyright (C) 2023 Cyril Hrubis <metan@ucw.cz>
+ * Copyright (C) 2023-2026 Cyril Hrubis <metan@ucw.cz>
  */
 
+#define _GNU_SOURCE
 #include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <dlfcn.h>
+#include <pthread.h>
 #include <core/gp_core.h>
 #include <filters/gp_filters.h>
 #include "tst_test.h"
@@ -60,6 +65,170 @@ static int dither_bench_G8_to_G1(void)
 	return TST_PASSED;
 }
 
+static int progress(gp_progress_cb *self)
+{
+	(void) self;
+	return 0;
+}
+
+/* Number of pthread_create() calls that succeed before it starts to fail */
+static int threads_fail_after = -1;
+
+int pthread_create(pthread_t *thread, const pthread_attr_t *attr,
+                   void *(*fn)(void *), void *arg)
+{
+	static int (*real_create)(pthread_t *, const pthread_attr_t *,
+	                          void *(*)(void *), void *);
+
+	if (!threads_fail_after)
+		return EAGAIN;
+
+	if (threads_fail_after > 0)
+		threads_fail_after--;
+
+	if (!real_create)
+		real_create = dlsym(RTLD_NEXT, "pthread_create");
+
+	return real_create(thread, attr, fn, arg);
+}
+
+static gp_pixmap *random_pixmap(gp_size w, gp_size h, gp_pixel_type pixel_type)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(w, h, pixel_type);
+	gp_coord x, y;
+
+	if (!ret)
+		return NULL;
+
+	srandom(42);
+
+	for (y = 0; y < (gp_coord)h; y++) {
+		for (x = 0; x < (gp_coord)w; x++)
+			gp_putpixel_raw(ret, x, y, random());
+	}
+
+	return ret;
+}
+
+/*
+ * The wavefront parallel error diffusion has to produce exactly the same
+ * result as the sequential one.
+ */
+static int dither_threads_compare(gp_dither_type type, gp_pixel_type src_type,
+                                  gp_pixel_type dst_type, unsigned int threads)
+{
+	gp_pixmap *src = random_pixmap(333, 217, src_type);
+	gp_pixmap *seq = gp_pixmap_alloc(333, 217, dst_type);
+	gp_pixmap *par = gp_pixmap_alloc(333, 217, dst_type);
+	gp_progress_cb callback = {.callback = progress, .threads = threads};
+	gp_coord x, y;
+	int ret = TST_PASSED;
+
+	if (!src || !seq || !par) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	if (gp_filter_dither(type, src, seq, NULL) ||
+	    gp_filter_dither(type, src, par, &callback)) {
+		tst_msg("gp_filter_dither() failed");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (callback.percentage != 100) {
+		tst_msg("Wrong final percentage %f", callback.percentage);
+		ret = TST_FAILED;
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel ps = gp_getpixel_raw(seq, x, y);
+			gp_pixel pp = gp_getpixel_raw(par, x, y);
+
+			if (ps != pp) {
+				tst_msg("%s pixels differ at %i %i 0x%x != 0x%x",
+				        gp_dither_type_name(type), x, y, pp, ps);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(seq);
+	gp_pixmap_free(par);
+
+	return ret;
+}
+
+static int dither_threads_G8_to_G1(void)
+{
+	return dither_threads_compare(GP_DITHER_FLOYD_STEINBERG, GP_PIXEL_G8, GP_PIXEL_G1, 4);
+}
+
+static int dither_threads_atkinson(void)
+{
+	return dither_threads_compare(GP_DITHER_ATKINSON, GP_PIXEL_RGB888, GP_PIXEL_G2, 3);
+}
+
+static int dither_threads_sierra(void)
+{
+	return dither_threads_compare(GP_DITHER_SIERRA, GP_PIXEL_RGB888, GP_PIXEL_RGB565, 5);
+}
+
+static int dither_threads_sierra_lite(void)
+{
+	return dither_threads_compare(GP_DITHER_SIERRA_LITE, GP_PIXEL_RGB888, GP_PIXEL_G4, 2);
+}
+
+/* Falls back to the sequential dithering when a thread cannot be started */
+static int dither_threads_create_fail(void)
+{
+	threads_fail_after = 2;
+
+	return dither_threads_compare(GP_DITHER_FLOYD_STEINBERG, GP_PIXEL_RGB888, GP_PIXEL_G1, 4);
+}
+
+static gp_pixmap *bench_src, *bench_dst;
+
+static int bench_init(void)
+{
+	bench_src = random_pixmap(1000, 1000, GP_PIXEL_G8);
+	bench_dst = gp_pixmap_alloc(1000, 1000, GP_PIXEL_G1);
+
+	return !bench_src || !bench_dst;
+}
+
+static int dither_bench(gp_dither_type type, unsigned int threads)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = threads};
+
+	if (!bench_src && bench_init())
+		return TST_UNTESTED;
+
+	if (gp_filter_dither(type, bench_src, bench_dst, &callback))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int dither_bench_fs_4(void)
+{
+	return dither_bench(GP_DITHER_FLOYD_STEINBERG, 4);
+}
+
+static int dither_bench_bayer_4(void)
+{
+	return dither_bench(GP_DITHER_BAYER_4, 1);
+}
+
+static int dither_bench_bayer_8(void)
+{
+	return dither_bench(GP_DITHER_BAYER_8, 1);
+}
+
 const struct tst_suite tst_suite = {
 	.suite_name = "Dithering benchmark",
 	.tests = {
@@ -71,6 +240,33 @@ const struct tst_suite tst_suite = {
 		 .tst_fn = dither_bench_G8_to_G1,
 		 .bench_iter = 100},
 
+		{.name = "Floyd Steinberg G8 -> G1 4 threads",
+		 .tst_fn = dither_bench_fs_4,
+		 .bench_iter = 100},
+
+		{.name = "Bayer 4x4 G8 -> G1",
+		 .tst_fn = dither_bench_bayer_4,
+		 .bench_iter = 100},
+
+		{.name = "Bayer 8x8 G8 -> G1",
+		 .tst_fn = dither_bench_bayer_8,
+		 .bench_iter = 100},
+
+		{.name = "Floyd Steinberg G8 -> G1 threads",
+		 .tst_fn = dither_threads_G8_to_G1},
+
+		{.name = "Atkinson RGB888 -> G2 threads",
+		 .tst_fn = dither_threads_atkinson},
+
+		{.name = "Sierra RGB888 -> RGB565 threads",
+		 .tst_fn = dither_threads_sierra},
+
+		{.name = "Sierra Lite RGB888 -> G4 threads",
+		 .tst_fn = dither_threads_sierra_lite},
+
+		{.name = "Floyd Steinberg thread create failure",
+		 .tst_fn = dither_threads_create_fail},
+
 		{},
 	}
 };
@@ -0,0 +1,338 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include <errno.h>
+#include <core/gp_core.h>
+#include <gfx/gp_gfx.h>
+#include <filters/gp_filters.h>
+#include "tst_test.h"
+
+static gp_pixmap *random_pixmap(gp_size w, gp_size h, gp_pixel_type pixel_type)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(w, h, pixel_type);
+	gp_coord x, y;
+
+	if (!ret)
+		return NULL;
+
+	srandom(42);
+
+	for (y = 0; y < (gp_coord)h; y++) {
+		for (x = 0; x < (gp_coord)w; x++)
+			gp_putpixel_raw(ret, x, y, random());
+	}
+
+	return ret;
+}
+
+static int compare(const gp_pixmap *a, const gp_pixmap *b)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)a->h; y++) {
+		for (x = 0; x < (gp_coord)a->w; x++) {
+			gp_pixel pa = gp_getpixel_raw(a, x, y);
+			gp_pixel pb = gp_getpixel_raw(b, x, y);
+
+			if (pa != pb) {
+				tst_msg("Pixels differ at %i %i 0x%08x != 0x%08x",
+				        x, y, pa, pb);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int progress(gp_progress_cb *self)
+{
+	(void) self;
+	return 0;
+}
+
+static int get_clamped(const gp_pixmap *src, gp_coord x, gp_coord y)
+{
+	x = GP_CLAMP(x, 0, (gp_coord)src->w - 1);
+	y = GP_CLAMP(y, 0, (gp_coord)src->h - 1);
+
+	return gp_getpixel_raw(src, x, y);
+}
+
+static int sobel_G8_ref(void)
+{
+	gp_pixmap *src = random_pixmap(57, 31, GP_PIXEL_G8);
+	gp_pixmap *E = NULL;
+	gp_coord x, y;
+	int ret = TST_PASSED;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	if (gp_filter_edge_sobel(src, &E, NULL, NULL)) {
+		tst_msg("gp_filter_edge_sobel() failed");
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			int gx = get_clamped(src, x+1, y-1) + 2 * get_clamped(src, x+1, y) + get_clamped(src, x+1, y+1)
+			       - get_clamped(src, x-1, y-1) - 2 * get_clamped(src, x-1, y) - get_clamped(src, x-1, y+1);
+			int gy = get_clamped(src, x-1, y+1) + 2 * get_clamped(src, x, y+1) + get_clamped(src, x+1, y+1)
+			       - get_clamped(src, x-1, y-1) - 2 * get_clamped(src, x, y-1) - get_clamped(src, x+1, y-1);
+			gp_pixel exp = GP_MIN((gp_pixel)(sqrt(gx*gx + gy*gy) + 0.5), 255u);
+			gp_pixel pix = gp_getpixel_raw(E, x, y);
+
+			if (pix != exp) {
+				tst_msg("Wrong magnitude at %i %i %u != %u",
+				        x, y, pix, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(E);
+	return ret;
+}
+
+static int edge_threads(void)
+{
+	gp_pixmap *src = random_pixmap(113, 97, GP_PIXEL_RGB888);
+	gp_progress_cb callback = {.callback = progress, .threads = 4};
+	gp_pixmap *E1 = NULL, *Phi1 = NULL, *E4 = NULL, *Phi4 = NULL;
+	int ret = TST_PASSED;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	if (gp_filter_edge_prewitt(src, &E1, &Phi1, NULL) ||
+	    gp_filter_edge_prewitt(src, &E4, &Phi4, &callback)) {
+		tst_msg("gp_filter_edge_prewitt() failed");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (compare(E1, E4) || compare(Phi1, Phi4))
+		ret = TST_FAILED;
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(E1);
+	gp_pixmap_free(Phi1);
+	gp_pixmap_free(E4);
+	gp_pixmap_free(Phi4);
+	return ret;
+}
+
+/*
+ * A white rectangle on a black background has to produce a closed, one pixel
+ * thin, contour.
+ */
+static int canny_rect(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(64, 48, GP_PIXEL_RGB888);
+	gp_pixmap *dst;
+	gp_coord x, y;
+	int ret = TST_PASSED;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	gp_fill(src, 0);
+	gp_fill_rect_xyxy(src, 16, 12, 47, 35, 0xffffff);
+
+	dst = gp_filter_edge_canny_alloc(src, GP_EDGE_SOBEL, 0.1, 0.3, NULL);
+	if (!dst) {
+		tst_msg("gp_filter_edge_canny_alloc() failed %s", tst_strerr(errno));
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		unsigned int cnt = 0;
+
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			gp_pixel pix = gp_getpixel_raw(dst, x, y);
+
+			if (pix != 0 && pix != 255) {
+				tst_msg("Wrong value %u at %i %i", pix, x, y);
+				ret = TST_FAILED;
+				goto exit;
+			}
+
+			if (!pix)
+				continue;
+
+			cnt++;
+
+			if (x < 14 || x > 49 || y < 10 || y > 37) {
+				tst_msg("Edge outside of the rectangle at %i %i", x, y);
+				ret = TST_FAILED;
+				goto exit;
+			}
+
+			if (x > 18 && x < 45 && y > 14 && y < 33) {
+				tst_msg("Edge inside of the rectangle at %i %i", x, y);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+
+		/* Rows crossing the rectangle sides have exactly two edge pixels */
+		if (y > 14 && y < 33 && cnt != 2) {
+			tst_msg("Row %i has %u edge pixels", y, cnt);
+			ret = TST_FAILED;
+			goto exit;
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+static int canny_threads(void)
+{
+	gp_pixmap *src = random_pixmap(201, 133, GP_PIXEL_G8);
+	gp_progress_cb callback = {.callback = progress, .threads = 3};
+	gp_pixmap *blur, *dst1 = NULL, *dst3 = NULL;
+	int ret = TST_PASSED;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	blur = gp_filter_gaussian_blur_alloc(src, 2, 2, NULL);
+	if (!blur) {
+		gp_pixmap_free(src);
+		return TST_UNTESTED;
+	}
+
+	dst1 = gp_filter_edge_canny_alloc(blur, GP_EDGE_SOBEL, 0.02, 0.05, NULL);
+	dst3 = gp_filter_edge_canny_alloc(blur, GP_EDGE_SOBEL, 0.02, 0.05, &callback);
+
+	if (!dst1 || !dst3) {
+		tst_msg("gp_filter_edge_canny_alloc() failed");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (compare(dst1, dst3))
+		ret = TST_FAILED;
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(blur);
+	gp_pixmap_free(dst1);
+	gp_pixmap_free(dst3);
+	return ret;
+}
+
+static int canny_invalid(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(10, 10, GP_PIXEL_G8);
+	gp_pixmap *dst;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	errno = 0;
+	dst = gp_filter_edge_canny_alloc(src, GP_EDGE_SOBEL, 0.5, 0.1, NULL);
+	gp_pixmap_free(src);
+
+	if (dst) {
+		tst_msg("Canny succeeded with low > high");
+		gp_pixmap_free(dst);
+		return TST_FAILED;
+	}
+
+	if (errno != EINVAL) {
+		tst_msg("Wrong errno %s", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static gp_pixmap *bench_src;
+
+static int bench_init(void)
+{
+	if (!bench_src)
+		bench_src = random_pixmap(1000, 1000, GP_PIXEL_RGB888);
+
+	return !bench_src;
+}
+
+static int bench_sobel(void)
+{
+	gp_pixmap *E, *Phi;
+
+	if (bench_init())
+		return TST_UNTESTED;
+
+	if (gp_filter_edge_sobel(bench_src, &E, &Phi, NULL))
+		return TST_FAILED;
+
+	gp_pixmap_free(E);
+	gp_pixmap_free(Phi);
+
+	return TST_PASSED;
+}
+
+static int bench_canny(void)
+{
+	gp_pixmap *dst;
+
+	if (bench_init())
+		return TST_UNTESTED;
+
+	dst = gp_filter_edge_canny_alloc(bench_src, GP_EDGE_SOBEL, 0.1, 0.2, NULL);
+	if (!dst)
+		return TST_FAILED;
+
+	gp_pixmap_free(dst);
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Edge detection testsuite",
+	.tests = {
+		{.name = "Sobel G8 reference",
+		 .tst_fn = sobel_G8_ref,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Prewitt RGB888 threads",
+		 .tst_fn = edge_threads},
+
+		{.name = "Canny rectangle",
+		 .tst_fn = canny_rect,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Canny threads",
+		 .tst_fn = canny_threads},
+
+		{.name = "Canny invalid thresholds",
+		 .tst_fn = canny_invalid,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Sobel RGB888 1000x1000",
+		 .tst_fn = bench_sobel,
+		 .bench_iter = 10},
+
+		{.name = "Canny RGB888 1000x1000",
+		 .tst_fn = bench_canny,
+		 .bench_iter = 10},
+
+		{},
+	}
+};
@@ -0,0 +1,335 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <errno.h>
+#include <core/gp_core.h>
+#include <filters/gp_filters.h>
+#include "tst_test.h"
+
+static gp_pixmap *random_pixmap(gp_size w, gp_size h, gp_pixel_type pixel_type)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(w, h, pixel_type);
+	gp_coord x, y;
+
+	if (!ret)
+		return NULL;
+
+	srandom(42);
+
+	for (y = 0; y < (gp_coord)h; y++) {
+		for (x = 0; x < (gp_coord)w; x++)
+			gp_putpixel_raw(ret, x, y, random());
+	}
+
+	return ret;
+}
+
+static int compare(const gp_pixmap *a, const gp_pixmap *b)
+{
+	gp_coord x, y;
+
+	if (a->w != b->w || a->h != b->h || a->pixel_type != b->pixel_type) {
+		tst_msg("Pixmaps differ %ux%u %s != %ux%u %s",
+		        a->w, a->h, gp_pixel_type_name(a->pixel_type),
+		        b->w, b->h, gp_pixel_type_name(b->pixel_type));
+		return 1;
+	}
+
+	for (y = 0; y < (gp_coord)a->h; y++) {
+		for (x = 0; x < (gp_coord)a->w; x++) {
+			gp_pixel pa = gp_getpixel_raw(a, x, y);
+			gp_pixel pb = gp_getpixel_raw(b, x, y);
+
+			if (pa != pb) {
+				tst_msg("Pixels differ at %i %i 0x%08x != 0x%08x",
+				        x, y, pa, pb);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int progress(gp_progress_cb *self)
+{
+	(void) self;
+	return 0;
+}
+
+/* Runs the graph and compares it with the result of the sequential filters */
+static int graph_vs_sequential(gp_filter_graph *graph, const gp_pixmap *src,
+                               gp_pixmap *seq, unsigned int threads)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = threads};
+	gp_pixmap *res;
+	int ret = TST_PASSED;
+
+	res = gp_filter_graph_run(graph, src, &callback);
+	if (!res) {
+		tst_msg("gp_filter_graph_run() failed %s", tst_strerr(errno));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (compare(seq, res))
+		ret = TST_FAILED;
+
+exit:
+	gp_pixmap_free(res);
+	gp_pixmap_free(seq);
+	gp_filter_graph_exit(graph);
+	return ret;
+}
+
+static int graph_stencils(void)
+{
+	gp_pixmap *src = random_pixmap(123, 97, GP_PIXEL_RGB888);
+	gp_pixmap *tmp, *seq;
+	gp_filter_graph graph;
+	int ret;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	tmp = gp_filter_gaussian_blur_alloc(src, 1.5, 1.5, NULL);
+	gp_filter_brightness(tmp, tmp, 0.1, NULL);
+	seq = gp_filter_median_alloc(tmp, 2, 1, NULL);
+	gp_filter_invert(seq, seq, NULL);
+	gp_pixmap_free(tmp);
+
+	gp_filter_graph_init(&graph);
+	graph.strip_h = 16;
+
+	gp_filter_graph_gaussian_blur(&graph, 1.5, 1.5);
+	gp_filter_graph_brightness(&graph, 0.1);
+	gp_filter_graph_median(&graph, 2, 1);
+	gp_filter_graph_invert(&graph);
+
+	ret = graph_vs_sequential(&graph, src, seq, 3);
+
+	gp_pixmap_free(src);
+
+	return ret;
+}
+
+static int graph_point_first(void)
+{
+	gp_pixmap *src = random_pixmap(80, 60, GP_PIXEL_G8);
+	gp_pixmap *tmp, *seq;
+	gp_filter_graph graph;
+	int ret;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	tmp = gp_filter_contrast_alloc(src, 1.5, NULL);
+	seq = gp_filter_median_alloc(tmp, 1, 1, NULL);
+	gp_filter_posterize(seq, seq, 4, NULL);
+	gp_pixmap_free(tmp);
+
+	gp_filter_graph_init(&graph);
+	graph.strip_h = 7;
+
+	gp_filter_graph_contrast(&graph, 1.5);
+	gp_filter_graph_median(&graph, 1, 1);
+	gp_filter_graph_posterize(&graph, 4);
+
+	ret = graph_vs_sequential(&graph, src, seq, 1);
+
+	gp_pixmap_free(src);
+
+	return ret;
+}
+
+static int graph_points(void)
+{
+	gp_pixmap *src = random_pixmap(80, 60, GP_PIXEL_RGB565);
+	gp_pixmap *seq;
+	gp_filter_graph graph;
+	int ret;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	seq = gp_filter_brightness_contrast_alloc(src, 0.2, 0.8, NULL);
+	gp_filter_invert(seq, seq, NULL);
+
+	gp_filter_graph_init(&graph);
+
+	gp_filter_graph_brightness_contrast(&graph, 0.2, 0.8);
+	gp_filter_graph_invert(&graph);
+
+	ret = graph_vs_sequential(&graph, src, seq, 2);
+
+	gp_pixmap_free(src);
+
+	return ret;
+}
+
+static int graph_barriers(void)
+{
+	gp_pixmap *src = random_pixmap(200, 150, GP_PIXEL_RGB888);
+	gp_pixmap *tmp, *seq;
+	gp_filter_graph graph;
+	int ret;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	tmp = gp_filter_resize_alloc(src, 100, 70, GP_INTERP_LINEAR_INT, NULL);
+	gp_filter_gaussian_blur(tmp, tmp, 1, 1, NULL);
+	gp_filter_brightness(tmp, tmp, -0.1, NULL);
+	seq = gp_filter_floyd_steinberg_alloc(tmp, GP_PIXEL_G1, NULL);
+	gp_pixmap_free(tmp);
+
+	gp_filter_graph_init(&graph);
+
+	gp_filter_graph_resize(&graph, 100, 70, GP_INTERP_LINEAR_INT);
+	gp_filter_graph_gaussian_blur(&graph, 1, 1);
+	gp_filter_graph_brightness(&graph, -0.1);
+	gp_filter_graph_dither(&graph, GP_DITHER_FLOYD_STEINBERG, GP_PIXEL_G1);
+
+	ret = graph_vs_sequential(&graph, src, seq, 2);
+
+	gp_pixmap_free(src);
+
+	return ret;
+}
+
+static int graph_empty(void)
+{
+	gp_pixmap *src = random_pixmap(20, 20, GP_PIXEL_RGB888);
+	gp_filter_graph graph;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	gp_filter_graph_init(&graph);
+
+	return graph_vs_sequential(&graph, src, src, 1);
+}
+
+static int graph_fail(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(20, 20, GP_PIXEL_G16);
+	gp_pixmap *res;
+	gp_filter_graph graph;
+	int ret = TST_PASSED;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	gp_filter_graph_init(&graph);
+	gp_filter_graph_invert(&graph);
+	gp_filter_graph_median(&graph, 1, 1);
+
+	errno = 0;
+	res = gp_filter_graph_run(&graph, src, NULL);
+
+	if (res) {
+		tst_msg("Median on G16 succeeded");
+		gp_pixmap_free(res);
+		ret = TST_FAILED;
+	} else if (errno != ENOSYS) {
+		tst_msg("Wrong errno %s", tst_strerr(errno));
+		ret = TST_FAILED;
+	}
+
+	gp_filter_graph_exit(&graph);
+	gp_pixmap_free(src);
+
+	return ret;
+}
+
+static gp_pixmap *bench_src;
+
+static int bench_init(void)
+{
+	if (!bench_src)
+		bench_src = random_pixmap(1000, 1000, GP_PIXEL_RGB888);
+
+	return !bench_src;
+}
+
+static int bench_sequential(void)
+{
+	gp_pixmap *res, *tmp;
+
+	if (bench_init())
+		return TST_UNTESTED;
+
+	res = gp_filter_gaussian_blur_alloc(bench_src, 1, 1, NULL);
+	gp_filter_brightness(res, res, 0.1, NULL);
+	gp_filter_contrast(res, res, 1.2, NULL);
+	tmp = gp_filter_median_alloc(res, 1, 1, NULL);
+	gp_filter_invert(tmp, tmp, NULL);
+	gp_pixmap_free(res);
+	gp_pixmap_free(tmp);
+
+	return TST_PASSED;
+}
+
+static int bench_graph(void)
+{
+	gp_filter_graph graph;
+	gp_pixmap *res;
+
+	if (bench_init())
+		return TST_UNTESTED;
+
+	gp_filter_graph_init(&graph);
+	gp_filter_graph_gaussian_blur(&graph, 1, 1);
+	gp_filter_graph_brightness(&graph, 0.1);
+	gp_filter_graph_contrast(&graph, 1.2);
+	gp_filter_graph_median(&graph, 1, 1);
+	gp_filter_graph_invert(&graph);
+
+	res = gp_filter_graph_run(&graph, bench_src, NULL);
+	gp_filter_graph_exit(&graph);
+
+	if (!res)
+		return TST_FAILED;
+
+	gp_pixmap_free(res);
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Filter graph testsuite",
+	.tests = {
+		{.name = "Filter graph stencils RGB888",
+		 .tst_fn = graph_stencils},
+
+		{.name = "Filter graph leading point filters G8",
+		 .tst_fn = graph_point_first},
+
+		{.name = "Filter graph point filters RGB565",
+		 .tst_fn = graph_points},
+
+		{.name = "Filter graph resize and dither",
+		 .tst_fn = graph_barriers},
+
+		{.name = "Filter graph empty",
+		 .tst_fn = graph_empty,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Filter graph failure",
+		 .tst_fn = graph_fail,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Sequential filters 1000x1000",
+		 .tst_fn = bench_sequential,
+		 .bench_iter = 10},
+
+		{.name = "Filter graph 1000x1000",
+		 .tst_fn = bench_graph,
+		 .bench_iter = 10},
+
+		{},
+	}
+};
@@ -0,0 +1,4166 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * filters_compare.gen.c
+ *
+ * GENERATED on 2026 10 19 16:37:56 from filters_compare.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ *
+ * Calls different API for the same filter (_alloc vs In-place, etc.) and copares
+ * the results (which must be the same).
+ */
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_threads.h>
+#include <filters/gp_filters.h>
+
+#include "tst_test.h"
+
+//TODO: Fix the library to enable malloc() tracking on demand
+__attribute__((weak)) void gp_nr_threads_set(unsigned int nr)
+{
+	(void) nr;
+}
+
+static int compare_brightness(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_brightness(dst, dst, 0.1, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_brightness_alloc(src, 0.1, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for brightness and brightness_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_contrast(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_contrast(dst, dst, 1.2, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_contrast_alloc(src, 1.2, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for contrast and contrast_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_invert(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_invert(dst, dst, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_invert_alloc(src, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for invert and invert_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_mirror_h(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_mirror_h(dst, dst, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_mirror_h_alloc(src, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for mirror_h and mirror_h_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_symmetry(dst, dst, GP_MIRROR_H, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for mirror_h and symmetry differs");
+	}
+
+	gp_pixmap_free(dst);
+	dst = gp_filter_symmetry_alloc(src, GP_MIRROR_H, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for mirror_h and symmetry_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_mirror_v(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_mirror_v(dst, dst, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_mirror_v_alloc(src, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for mirror_v and mirror_v_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_symmetry(dst, dst, GP_MIRROR_V, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for mirror_v and symmetry differs");
+	}
+
+	gp_pixmap_free(dst);
+	dst = gp_filter_symmetry_alloc(src, GP_MIRROR_V, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for mirror_v and symmetry_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_rotate_90(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_filter_rotate_90_alloc(src, NULL);
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_symmetry_alloc(src, GP_ROTATE_90, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for rotate_90_alloc and symmetry_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_rotate_180(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_rotate_180(src, dst, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_rotate_180_alloc(src, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for rotate_180 and rotate_180_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_symmetry(src, dst, GP_ROTATE_180, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for rotate_180 and symmetry differs");
+	}
+
+	gp_pixmap_free(dst);
+	dst = gp_filter_symmetry_alloc(src, GP_ROTATE_180, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for rotate_180 and symmetry_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_rotate_270(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_filter_rotate_270_alloc(src, NULL);
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_symmetry_alloc(src, GP_ROTATE_270, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for rotate_270_alloc and symmetry_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_resize_nn(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_resize(dst, dst, GP_INTERP_NN, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_resize_alloc(src, src->w, src->h, GP_INTERP_NN, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for resize and resize_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_resize_linear_int(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_resize(dst, dst, GP_INTERP_LINEAR_INT, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_resize_alloc(src, src->w, src->h, GP_INTERP_LINEAR_INT, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for resize and resize_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_resize_linear_lf_int(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_resize(dst, dst, GP_INTERP_LINEAR_LF_INT, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_resize_alloc(src, src->w, src->h, GP_INTERP_LINEAR_LF_INT, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for resize and resize_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_resize_cubic_int(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_resize(dst, dst, GP_INTERP_CUBIC_INT, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_resize_alloc(src, src->w, src->h, GP_INTERP_CUBIC_INT, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for resize and resize_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_resize_cubic(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_resize(dst, dst, GP_INTERP_CUBIC, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_resize_alloc(src, src->w, src->h, GP_INTERP_CUBIC, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for resize and resize_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_laplace(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_laplace(src, dst, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_laplace_alloc(src, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for laplace and laplace_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_edge_sharpening(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_edge_sharpening(src, dst, 0.2, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_edge_sharpening_alloc(src, 0.2, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for edge_sharpening and edge_sharpening_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_median(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_median(src, dst, 3, 2, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_median_alloc(src, 3, 2, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for median and median_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_sigma(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_sigma(dst, dst, 3, 2, 4, 0.5, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_sigma_alloc(src, 3, 2, 4, 0.5, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for sigma and sigma_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_gaussian_blur(gp_pixel_type pt)
+{
+	gp_pixmap *src = gp_pixmap_alloc(134, 1072, pt);
+	gp_pixmap *dst, *ref;
+	int fail = 0;
+
+	/* disable threads, causes memleaks due to glibc tls caching */
+	gp_nr_threads_set(1);
+
+	errno = 0;
+
+	if (!src) {
+		tst_msg("Malloc Failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* randomize pixmap content */
+	gp_filter_gaussian_noise_add(src, src, 10, 0, NULL);
+
+	/* Create reference result */
+	dst = gp_pixmap_copy(src, GP_PIXMAP_COPY_PIXELS);
+	if (gp_filter_gaussian_blur(dst, dst, 10, 12, NULL)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		dst = NULL;
+		errno = err;
+	}
+
+	ref = dst;
+
+	if (ref == NULL) {
+		gp_pixmap_free(src);
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not implemented");
+			return TST_SKIPPED;
+		case EINVAL:
+			tst_msg("Couldn't be implemented");
+			return TST_SKIPPED;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+	dst = gp_filter_gaussian_blur_alloc(src, 10, 12, NULL);
+
+
+	if (!gp_pixmap_equal(ref, dst)) {
+		fail++;
+		tst_msg("Results for gaussian_blur and gaussian_blur_alloc differs");
+	}
+
+	gp_pixmap_free(dst);
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+
+	if (fail) {
+		tst_msg("%i failure(s)", fail);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int compare_brightness_RGB101010(void)
+{
+	return compare_brightness(GP_PIXEL_RGB101010);
+}
+static int compare_brightness_xRGB8888(void)
+{
+	return compare_brightness(GP_PIXEL_xRGB8888);
+}
+static int compare_brightness_RGBA8888(void)
+{
+	return compare_brightness(GP_PIXEL_RGBA8888);
+}
+static int compare_brightness_RGB888(void)
+{
+	return compare_brightness(GP_PIXEL_RGB888);
+}
+static int compare_brightness_BGR888(void)
+{
+	return compare_brightness(GP_PIXEL_BGR888);
+}
+static int compare_brightness_RGB555(void)
+{
+	return compare_brightness(GP_PIXEL_RGB555);
+}
+static int compare_brightness_RGB565_BE(void)
+{
+	return compare_brightness(GP_PIXEL_RGB565_BE);
+}
+static int compare_brightness_RGB565_LE(void)
+{
+	return compare_brightness(GP_PIXEL_RGB565_LE);
+}
+static int compare_brightness_RGB666(void)
+{
+	return compare_brightness(GP_PIXEL_RGB666);
+}
+static int compare_brightness_RGB332(void)
+{
+	return compare_brightness(GP_PIXEL_RGB332);
+}
+static int compare_brightness_CMYK8888(void)
+{
+	return compare_brightness(GP_PIXEL_CMYK8888);
+}
+static int compare_brightness_P2(void)
+{
+	return compare_brightness(GP_PIXEL_P2);
+}
+static int compare_brightness_P4(void)
+{
+	return compare_brightness(GP_PIXEL_P4);
+}
+static int compare_brightness_P8(void)
+{
+	return compare_brightness(GP_PIXEL_P8);
+}
+static int compare_brightness_G1_DB(void)
+{
+	return compare_brightness(GP_PIXEL_G1_DB);
+}
+static int compare_brightness_G2_DB(void)
+{
+	return compare_brightness(GP_PIXEL_G2_DB);
+}
+static int compare_brightness_G4_DB(void)
+{
+	return compare_brightness(GP_PIXEL_G4_DB);
+}
+static int compare_brightness_G1_UB(void)
+{
+	return compare_brightness(GP_PIXEL_G1_UB);
+}
+static int compare_brightness_G2_UB(void)
+{
+	return compare_brightness(GP_PIXEL_G2_UB);
+}
+static int compare_brightness_G4_UB(void)
+{
+	return compare_brightness(GP_PIXEL_G4_UB);
+}
+static int compare_brightness_G8(void)
+{
+	return compare_brightness(GP_PIXEL_G8);
+}
+static int compare_brightness_GA88(void)
+{
+	return compare_brightness(GP_PIXEL_GA88);
+}
+static int compare_brightness_G16(void)
+{
+	return compare_brightness(GP_PIXEL_G16);
+}
+static int compare_contrast_RGB101010(void)
+{
+	return compare_contrast(GP_PIXEL_RGB101010);
+}
+static int compare_contrast_xRGB8888(void)
+{
+	return compare_contrast(GP_PIXEL_xRGB8888);
+}
+static int compare_contrast_RGBA8888(void)
+{
+	return compare_contrast(GP_PIXEL_RGBA8888);
+}
+static int compare_contrast_RGB888(void)
+{
+	return compare_contrast(GP_PIXEL_RGB888);
+}
+static int compare_contrast_BGR888(void)
+{
+	return compare_contrast(GP_PIXEL_BGR888);
+}
+static int compare_contrast_RGB555(void)
+{
+	return compare_contrast(GP_PIXEL_RGB555);
+}
+static int compare_contrast_RGB565_BE(void)
+{
+	return compare_contrast(GP_PIXEL_RGB565_BE);
+}
+static int compare_contrast_RGB565_LE(void)
+{
+	return compare_contrast(GP_PIXEL_RGB565_LE);
+}
+static int compare_contrast_RGB666(void)
+{
+	return compare_contrast(GP_PIXEL_RGB666);
+}
+static int compare_contrast_RGB332(void)
+{
+	return compare_contrast(GP_PIXEL_RGB332);
+}
+static int compare_contrast_CMYK8888(void)
+{
+	return compare_contrast(GP_PIXEL_CMYK8888);
+}
+static int compare_contrast_P2(void)
+{
+	return compare_contrast(GP_PIXEL_P2);
+}
+static int compare_contrast_P4(void)
+{
+	return compare_contrast(GP_PIXEL_P4);
+}
+static int compare_contrast_P8(void)
+{
+	return compare_contrast(GP_PIXEL_P8);
+}
+static int compare_contrast_G1_DB(void)
+{
+	return compare_contrast(GP_PIXEL_G1_DB);
+}
+static int compare_contrast_G2_DB(void)
+{
+	return compare_contrast(GP_PIXEL_G2_DB);
+}
+static int compare_contrast_G4_DB(void)
+{
+	return compare_contrast(GP_PIXEL_G4_DB);
+}
+static int compare_contrast_G1_UB(void)
+{
+	return compare_contrast(GP_PIXEL_G1_UB);
+}
+static int compare_contrast_G2_UB(void)
+{
+	return compare_contrast(GP_PIXEL_G2_UB);
+}
+static int compare_contrast_G4_UB(void)
+{
+	return compare_contrast(GP_PIXEL_G4_UB);
+}
+static int compare_contrast_G8(void)
+{
+	return compare_contrast(GP_PIXEL_G8);
+}
+static int compare_contrast_GA88(void)
+{
+	return compare_contrast(GP_PIXEL_GA88);
+}
+static int compare_contrast_G16(void)
+{
+	return compare_contrast(GP_PIXEL_G16);
+}
+static int compare_invert_RGB101010(void)
+{
+	return compare_invert(GP_PIXEL_RGB101010);
+}
+static int compare_invert_xRGB8888(void)
+{
+	return compare_invert(GP_PIXEL_xRGB8888);
+}
+static int compare_invert_RGBA8888(void)
+{
+	return compare_invert(GP_PIXEL_RGBA8888);
+}
+static int compare_invert_RGB888(void)
+{
+	return compare_invert(GP_PIXEL_RGB888);
+}
+static int compare_invert_BGR888(void)
+{
+	return compare_invert(GP_PIXEL_BGR888);
+}
+static int compare_invert_RGB555(void)
+{
+	return compare_invert(GP_PIXEL_RGB555);
+}
+static int compare_invert_RGB565_BE(void)
+{
+	return compare_invert(GP_PIXEL_RGB565_BE);
+}
+static int compare_invert_RGB565_LE(void)
+{
+	return compare_invert(GP_PIXEL_RGB565_LE);
+}
+static int compare_invert_RGB666(void)
+{
+	return compare_invert(GP_PIXEL_RGB666);
+}
+static int compare_invert_RGB332(void)
+{
+	return compare_invert(GP_PIXEL_RGB332);
+}
+static int compare_invert_CMYK8888(void)
+{
+	return compare_invert(GP_PIXEL_CMYK8888);
+}
+static int compare_invert_P2(void)
+{
+	return compare_invert(GP_PIXEL_P2);
+}
+static int compare_invert_P4(void)
+{
+	return compare_invert(GP_PIXEL_P4);
+}
+static int compare_invert_P8(void)
+{
+	return compare_invert(GP_PIXEL_P8);
+}
+static int compare_invert_G1_DB(void)
+{
+	return compare_invert(GP_PIXEL_G1_DB);
+}
+static int compare_invert_G2_DB(void)
+{
+	return compare_invert(GP_PIXEL_G2_DB);
+}
+static int compare_invert_G4_DB(void)
+{
+	return compare_invert(GP_PIXEL_G4_DB);
+}
+static int compare_invert_G1_UB(void)
+{
+	return compare_invert(GP_PIXEL_G1_UB);
+}
+static int compare_invert_G2_UB(void)
+{
+	return compare_invert(GP_PIXEL_G2_UB);
+}
+static int compare_invert_G4_UB(void)
+{
+	return compare_invert(GP_PIXEL_G4_UB);
+}
+static int compare_invert_G8(void)
+{
+	return compare_invert(GP_PIXEL_G8);
+}
+static int compare_invert_GA88(void)
+{
+	return compare_invert(GP_PIXEL_GA88);
+}
+static int compare_invert_G16(void)
+{
+	return compare_invert(GP_PIXEL_G16);
+}
+static int compare_mirror_h_RGB101010(void)
+{
+	return compare_mirror_h(GP_PIXEL_RGB101010);
+}
+static int compare_mirror_h_xRGB8888(void)
+{
+	return compare_mirror_h(GP_PIXEL_xRGB8888);
+}
+static int compare_mirror_h_RGBA8888(void)
+{
+	return compare_mirror_h(GP_PIXEL_RGBA8888);
+}
+static int compare_mirror_h_RGB888(void)
+{
+	return compare_mirror_h(GP_PIXEL_RGB888);
+}
+static int compare_mirror_h_BGR888(void)
+{
+	return compare_mirror_h(GP_PIXEL_BGR888);
+}
+static int compare_mirror_h_RGB555(void)
+{
+	return compare_mirror_h(GP_PIXEL_RGB555);
+}
+static int compare_mirror_h_RGB565_BE(void)
+{
+	return compare_mirror_h(GP_PIXEL_RGB565_BE);
+}
+static int compare_mirror_h_RGB565_LE(void)
+{
+	return compare_mirror_h(GP_PIXEL_RGB565_LE);
+}
+static int compare_mirror_h_RGB666(void)
+{
+	return compare_mirror_h(GP_PIXEL_RGB666);
+}
+static int compare_mirror_h_RGB332(void)
+{
+	return compare_mirror_h(GP_PIXEL_RGB332);
+}
+static int compare_mirror_h_CMYK8888(void)
+{
+	return compare_mirror_h(GP_PIXEL_CMYK8888);
+}
+static int compare_mirror_h_P2(void)
+{
+	return compare_mirror_h(GP_PIXEL_P2);
+}
+static int compare_mirror_h_P4(void)
+{
+	return compare_mirror_h(GP_PIXEL_P4);
+}
+static int compare_mirror_h_P8(void)
+{
+	return compare_mirror_h(GP_PIXEL_P8);
+}
+static int compare_mirror_h_G1_DB(void)
+{
+	return compare_mirror_h(GP_PIXEL_G1_DB);
+}
+static int compare_mirror_h_G2_DB(void)
+{
+	return compare_mirror_h(GP_PIXEL_G2_DB);
+}
+static int compare_mirror_h_G4_DB(void)
+{
+	return compare_mirror_h(GP_PIXEL_G4_DB);
+}
+static int compare_mirror_h_G1_UB(void)
+{
+	return compare_mirror_h(GP_PIXEL_G1_UB);
+}
+static int compare_mirror_h_G2_UB(void)
+{
+	return compare_mirror_h(GP_PIXEL_G2_UB);
+}
+static int compare_mirror_h_G4_UB(void)
+{
+	return compare_mirror_h(GP_PIXEL_G4_UB);
+}
+static int compare_mirror_h_G8(void)
+{
+	return compare_mirror_h(GP_PIXEL_G8);
+}
+static int compare_mirror_h_GA88(void)
+{
+	return compare_mirror_h(GP_PIXEL_GA88);
+}
+static int compare_mirror_h_G16(void)
+{
+	return compare_mirror_h(GP_PIXEL_G16);
+}
+static int compare_mirror_v_RGB101010(void)
+{
+	return compare_mirror_v(GP_PIXEL_RGB101010);
+}
+static int compare_mirror_v_xRGB8888(void)
+{
+	return compare_mirror_v(GP_PIXEL_xRGB8888);
+}
+static int compare_mirror_v_RGBA8888(void)
+{
+	return compare_mirror_v(GP_PIXEL_RGBA8888);
+}
+static int compare_mirror_v_RGB888(void)
+{
+	return compare_mirror_v(GP_PIXEL_RGB888);
+}
+static int compare_mirror_v_BGR888(void)
+{
+	return compare_mirror_v(GP_PIXEL_BGR888);
+}
+static int compare_mirror_v_RGB555(void)
+{
+	return compare_mirror_v(GP_PIXEL_RGB555);
+}
+static int compare_mirror_v_RGB565_BE(void)
+{
+	return compare_mirror_v(GP_PIXEL_RGB565_BE);
+}
+static int compare_mirror_v_RGB565_LE(void)
+{
+	return compare_mirror_v(GP_PIXEL_RGB565_LE);
+}
+static int compare_mirror_v_RGB666(void)
+{
+	return compare_mirror_v(GP_PIXEL_RGB666);
+}
+static int compare_mirror_v_RGB332(void)
+{
+	return compare_mirror_v(GP_PIXEL_RGB332);
+}
+static int compare_mirror_v_CMYK8888(void)
+{
+	return compare_mirror_v(GP_PIXEL_CMYK8888);
+}
+static int compare_mirror_v_P2(void)
+{
+	return compare_mirror_v(GP_PIXEL_P2);
+}
+static int compare_mirror_v_P4(void)
+{
+	return compare_mirror_v(GP_PIXEL_P4);
+}
+static int compare_mirror_v_P8(void)
+{
+	return compare_mirror_v(GP_PIXEL_P8);
+}
+static int compare_mirror_v_G1_DB(void)
+{
+	return compare_mirror_v(GP_PIXEL_G1_DB);
+}
+static int compare_mirror_v_G2_DB(void)
+{
+	return compare_mirror_v(GP_PIXEL_G2_DB);
+}
+static int compare_mirror_v_G4_DB(void)
+{
+	return compare_mirror_v(GP_PIXEL_G4_DB);
+}
+static int compare_mirror_v_G1_UB(void)
+{
+	return compare_mirror_v(GP_PIXEL_G1_UB);
+}
+static int compare_mirror_v_G2_UB(void)
+{
+	return compare_mirror_v(GP_PIXEL_G2_UB);
+}
+static int compare_mirror_v_G4_UB(void)
+{
+	return compare_mirror_v(GP_PIXEL_G4_UB);
+}
+static int compare_mirror_v_G8(void)
+{
+	return compare_mirror_v(GP_PIXEL_G8);
+}
+static int compare_mirror_v_GA88(void)
+{
+	return compare_mirror_v(GP_PIXEL_GA88);
+}
+static int compare_mirror_v_G16(void)
+{
+	return compare_mirror_v(GP_PIXEL_G16);
+}
+static int compare_rotate_90_RGB101010(void)
+{
+	return compare_rotate_90(GP_PIXEL_RGB101010);
+}
+static int compare_rotate_90_xRGB8888(void)
+{
+	return compare_rotate_90(GP_PIXEL_xRGB8888);
+}
+static int compare_rotate_90_RGBA8888(void)
+{
+	return compare_rotate_90(GP_PIXEL_RGBA8888);
+}
+static int compare_rotate_90_RGB888(void)
+{
+	return compare_rotate_90(GP_PIXEL_RGB888);
+}
+static int compare_rotate_90_BGR888(void)
+{
+	return compare_rotate_90(GP_PIXEL_BGR888);
+}
+static int compare_rotate_90_RGB555(void)
+{
+	return compare_rotate_90(GP_PIXEL_RGB555);
+}
+static int compare_rotate_90_RGB565_BE(void)
+{
+	return compare_rotate_90(GP_PIXEL_RGB565_BE);
+}
+static int compare_rotate_90_RGB565_LE(void)
+{
+	return compare_rotate_90(GP_PIXEL_RGB565_LE);
+}
+static int compare_rotate_90_RGB666(void)
+{
+	return compare_rotate_90(GP_PIXEL_RGB666);
+}
+static int compare_rotate_90_RGB332(void)
+{
+	return compare_rotate_90(GP_PIXEL_RGB332);
+}
+static int compare_rotate_90_CMYK8888(void)
+{
+	return compare_rotate_90(GP_PIXEL_CMYK8888);
+}
+static int compare_rotate_90_P2(void)
+{
+	return compare_rotate_90(GP_PIXEL_P2);
+}
+static int compare_rotate_90_P4(void)
+{
+	return compare_rotate_90(GP_PIXEL_P4);
+}
+static int compare_rotate_90_P8(void)
+{
+	return compare_rotate_90(GP_PIXEL_P8);
+}
+static int compare_rotate_90_G1_DB(void)
+{
+	return compare_rotate_90(GP_PIXEL_G1_DB);
+}
+static int compare_rotate_90_G2_DB(void)
+{
+	return compare_rotate_90(GP_PIXEL_G2_DB);
+}
+static int compare_rotate_90_G4_DB(void)
+{
+	return compare_rotate_90(GP_PIXEL_G4_DB);
+}
+static int compare_rotate_90_G1_UB(void)
+{
+	return compare_rotate_90(GP_PIXEL_G1_UB);
+}
+static int compare_rotate_90_G2_UB(void)
+{
+	return compare_rotate_90(GP_PIXEL_G2_UB);
+}
+static int compare_rotate_90_G4_UB(void)
+{
+	return compare_rotate_90(GP_PIXEL_G4_UB);
+}
+static int compare_rotate_90_G8(void)
+{
+	return compare_rotate_90(GP_PIXEL_G8);
+}
+static int compare_rotate_90_GA88(void)
+{
+	return compare_rotate_90(GP_PIXEL_GA88);
+}
+static int compare_rotate_90_G16(void)
+{
+	return compare_rotate_90(GP_PIXEL_G16);
+}
+static int compare_rotate_180_RGB101010(void)
+{
+	return compare_rotate_180(GP_PIXEL_RGB101010);
+}
+static int compare_rotate_180_xRGB8888(void)
+{
+	return compare_rotate_180(GP_PIXEL_xRGB8888);
+}
+static int compare_rotate_180_RGBA8888(void)
+{
+	return compare_rotate_180(GP_PIXEL_RGBA8888);
+}
+static int compare_rotate_180_RGB888(void)
+{
+	return compare_rotate_180(GP_PIXEL_RGB888);
+}
+static int compare_rotate_180_BGR888(void)
+{
+	return compare_rotate_180(GP_PIXEL_BGR888);
+}
+static int compare_rotate_180_RGB555(void)
+{
+	return compare_rotate_180(GP_PIXEL_RGB555);
+}
+static int compare_rotate_180_RGB565_BE(void)
+{
+	return compare_rotate_180(GP_PIXEL_RGB565_BE);
+}
+static int compare_rotate_180_RGB565_LE(void)
+{
+	return compare_rotate_180(GP_PIXEL_RGB565_LE);
+}
+static int compare_rotate_180_RGB666(void)
+{
+	return compare_rotate_180(GP_PIXEL_RGB666);
+}
+static int compare_rotate_180_RGB332(void)
+{
+	return compare_rotate_180(GP_PIXEL_RGB332);
+}
+static int compare_rotate_180_CMYK8888(void)
+{
+	return compare_rotate_180(GP_PIXEL_CMYK8888);
+}
+static int compare_rotate_180_P2(void)
+{
+	return compare_rotate_180(GP_PIXEL_P2);
+}
+static int compare_rotate_180_P4(void)
+{
+	return compare_rotate_180(GP_PIXEL_P4);
+}
+static int compare_rotate_180_P8(void)
+{
+	return compare_rotate_180(GP_PIXEL_P8);
+}
+static int compare_rotate_180_G1_DB(void)
+{
+	return compare_rotate_180(GP_PIXEL_G1_DB);
+}
+static int compare_rotate_180_G2_DB(void)
+{
+	return compare_rotate_180(GP_PIXEL_G2_DB);
+}
+static int compare_rotate_180_G4_DB(void)
+{
+	return compare_rotate_180(GP_PIXEL_G4_DB);
+}
+static int compare_rotate_180_G1_UB(void)
+{
+	return compare_rotate_180(GP_PIXEL_G1_UB);
+}
+static int compare_rotate_180_G2_UB(void)
+{
+	return compare_rotate_180(GP_PIXEL_G2_UB);
+}
+static int compare_rotate_180_G4_UB(void)
+{
+	return compare_rotate_180(GP_PIXEL_G4_UB);
+}
+static int compare_rotate_180_G8(void)
+{
+	return compare_rotate_180(GP_PIXEL_G8);
+}
+static int compare_rotate_180_GA88(void)
+{
+	return compare_rotate_180(GP_PIXEL_GA88);
+}
+static int compare_rotate_180_G16(void)
+{
+	return compare_rotate_180(GP_PIXEL_G16);
+}
+static int compare_rotate_270_RGB101010(void)
+{
+	return compare_rotate_270(GP_PIXEL_RGB101010);
+}
+static int compare_rotate_270_xRGB8888(void)
+{
+	return compare_rotate_270(GP_PIXEL_xRGB8888);
+}
+static int compare_rotate_270_RGBA8888(void)
+{
+	return compare_rotate_270(GP_PIXEL_RGBA8888);
+}
+static int compare_rotate_270_RGB888(void)
+{
+	return compare_rotate_270(GP_PIXEL_RGB888);
+}
+static int compare_rotate_270_BGR888(void)
+{
+	return compare_rotate_270(GP_PIXEL_BGR888);
+}
+static int compare_rotate_270_RGB555(void)
+{
+	return compare_rotate_270(GP_PIXEL_RGB555);
+}
+static int compare_rotate_270_RGB565_BE(void)
+{
+	return compare_rotate_270(GP_PIXEL_RGB565_BE);
+}
+static int compare_rotate_270_RGB565_LE(void)
+{
+	return compare_rotate_270(GP_PIXEL_RGB565_LE);
+}
+static int compare_rotate_270_RGB666(void)
+{
+	return compare_rotate_270(GP_PIXEL_RGB666);
+}
+static int compare_rotate_270_RGB332(void)
+{
+	return compare_rotate_270(GP_PIXEL_RGB332);
+}
+static int compare_rotate_270_CMYK8888(void)
+{
+	return compare_rotate_270(GP_PIXEL_CMYK8888);
+}
+static int compare_rotate_270_P2(void)
+{
+	return compare_rotate_270(GP_PIXEL_P2);
+}
+static int compare_rotate_270_P4(void)
+{
+	return compare_rotate_270(GP_PIXEL_P4);
+}
+static int compare_rotate_270_P8(void)
+{
+	return compare_rotate_270(GP_PIXEL_P8);
+}
+static int compare_rotate_270_G1_DB(void)
+{
+	return compare_rotate_270(GP_PIXEL_G1_DB);
+}
+static int compare_rotate_270_G2_DB(void)
+{
+	return compare_rotate_270(GP_PIXEL_G2_DB);
+}
+static int compare_rotate_270_G4_DB(void)
+{
+	return compare_rotate_270(GP_PIXEL_G4_DB);
+}
+static int compare_rotate_270_G1_UB(void)
+{
+	return compare_rotate_270(GP_PIXEL_G1_UB);
+}
+static int compare_rotate_270_G2_UB(void)
+{
+	return compare_rotate_270(GP_PIXEL_G2_UB);
+}
+static int compare_rotate_270_G4_UB(void)
+{
+	return compare_rotate_270(GP_PIXEL_G4_UB);
+}
+static int compare_rotate_270_G8(void)
+{
+	return compare_rotate_270(GP_PIXEL_G8);
+}
+static int compare_rotate_270_GA88(void)
+{
+	return compare_rotate_270(GP_PIXEL_GA88);
+}
+static int compare_rotate_270_G16(void)
+{
+	return compare_rotate_270(GP_PIXEL_G16);
+}
+static int compare_resize_nn_RGB101010(void)
+{
+	return compare_resize_nn(GP_PIXEL_RGB101010);
+}
+static int compare_resize_nn_xRGB8888(void)
+{
+	return compare_resize_nn(GP_PIXEL_xRGB8888);
+}
+static int compare_resize_nn_RGBA8888(void)
+{
+	return compare_resize_nn(GP_PIXEL_RGBA8888);
+}
+static int compare_resize_nn_RGB888(void)
+{
+	return compare_resize_nn(GP_PIXEL_RGB888);
+}
+static int compare_resize_nn_BGR888(void)
+{
+	return compare_resize_nn(GP_PIXEL_BGR888);
+}
+static int compare_resize_nn_RGB555(void)
+{
+	return compare_resize_nn(GP_PIXEL_RGB555);
+}
+static int compare_resize_nn_RGB565_BE(void)
+{
+	return compare_resize_nn(GP_PIXEL_RGB565_BE);
+}
+static int compare_resize_nn_RGB565_LE(void)
+{
+	return compare_resize_nn(GP_PIXEL_RGB565_LE);
+}
+static int compare_resize_nn_RGB666(void)
+{
+	return compare_resize_nn(GP_PIXEL_RGB666);
+}
+static int compare_resize_nn_RGB332(void)
+{
+	return compare_resize_nn(GP_PIXEL_RGB332);
+}
+static int compare_resize_nn_CMYK8888(void)
+{
+	return compare_resize_nn(GP_PIXEL_CMYK8888);
+}
+static int compare_resize_nn_P2(void)
+{
+	return compare_resize_nn(GP_PIXEL_P2);
+}
+static int compare_resize_nn_P4(void)
+{
+	return compare_resize_nn(GP_PIXEL_P4);
+}
+static int compare_resize_nn_P8(void)
+{
+	return compare_resize_nn(GP_PIXEL_P8);
+}
+static int compare_resize_nn_G1_DB(void)
+{
+	return compare_resize_nn(GP_PIXEL_G1_DB);
+}
+static int compare_resize_nn_G2_DB(void)
+{
+	return compare_resize_nn(GP_PIXEL_G2_DB);
+}
+static int compare_resize_nn_G4_DB(void)
+{
+	return compare_resize_nn(GP_PIXEL_G4_DB);
+}
+static int compare_resize_nn_G1_UB(void)
+{
+	return compare_resize_nn(GP_PIXEL_G1_UB);
+}
+static int compare_resize_nn_G2_UB(void)
+{
+	return compare_resize_nn(GP_PIXEL_G2_UB);
+}
+static int compare_resize_nn_G4_UB(void)
+{
+	return compare_resize_nn(GP_PIXEL_G4_UB);
+}
+static int compare_resize_nn_G8(void)
+{
+	return compare_resize_nn(GP_PIXEL_G8);
+}
+static int compare_resize_nn_GA88(void)
+{
+	return compare_resize_nn(GP_PIXEL_GA88);
+}
+static int compare_resize_nn_G16(void)
+{
+	return compare_resize_nn(GP_PIXEL_G16);
+}
+static int compare_resize_linear_int_RGB101010(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_RGB101010);
+}
+static int compare_resize_linear_int_xRGB8888(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_xRGB8888);
+}
+static int compare_resize_linear_int_RGBA8888(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_RGBA8888);
+}
+static int compare_resize_linear_int_RGB888(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_RGB888);
+}
+static int compare_resize_linear_int_BGR888(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_BGR888);
+}
+static int compare_resize_linear_int_RGB555(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_RGB555);
+}
+static int compare_resize_linear_int_RGB565_BE(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_RGB565_BE);
+}
+static int compare_resize_linear_int_RGB565_LE(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_RGB565_LE);
+}
+static int compare_resize_linear_int_RGB666(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_RGB666);
+}
+static int compare_resize_linear_int_RGB332(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_RGB332);
+}
+static int compare_resize_linear_int_CMYK8888(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_CMYK8888);
+}
+static int compare_resize_linear_int_P2(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_P2);
+}
+static int compare_resize_linear_int_P4(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_P4);
+}
+static int compare_resize_linear_int_P8(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_P8);
+}
+static int compare_resize_linear_int_G1_DB(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_G1_DB);
+}
+static int compare_resize_linear_int_G2_DB(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_G2_DB);
+}
+static int compare_resize_linear_int_G4_DB(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_G4_DB);
+}
+static int compare_resize_linear_int_G1_UB(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_G1_UB);
+}
+static int compare_resize_linear_int_G2_UB(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_G2_UB);
+}
+static int compare_resize_linear_int_G4_UB(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_G4_UB);
+}
+static int compare_resize_linear_int_G8(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_G8);
+}
+static int compare_resize_linear_int_GA88(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_GA88);
+}
+static int compare_resize_linear_int_G16(void)
+{
+	return compare_resize_linear_int(GP_PIXEL_G16);
+}
+static int compare_resize_linear_lf_int_RGB101010(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_RGB101010);
+}
+static int compare_resize_linear_lf_int_xRGB8888(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_xRGB8888);
+}
+static int compare_resize_linear_lf_int_RGBA8888(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_RGBA8888);
+}
+static int compare_resize_linear_lf_int_RGB888(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_RGB888);
+}
+static int compare_resize_linear_lf_int_BGR888(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_BGR888);
+}
+static int compare_resize_linear_lf_int_RGB555(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_RGB555);
+}
+static int compare_resize_linear_lf_int_RGB565_BE(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_RGB565_BE);
+}
+static int compare_resize_linear_lf_int_RGB565_LE(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_RGB565_LE);
+}
+static int compare_resize_linear_lf_int_RGB666(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_RGB666);
+}
+static int compare_resize_linear_lf_int_RGB332(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_RGB332);
+}
+static int compare_resize_linear_lf_int_CMYK8888(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_CMYK8888);
+}
+static int compare_resize_linear_lf_int_P2(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_P2);
+}
+static int compare_resize_linear_lf_int_P4(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_P4);
+}
+static int compare_resize_linear_lf_int_P8(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_P8);
+}
+static int compare_resize_linear_lf_int_G1_DB(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_G1_DB);
+}
+static int compare_resize_linear_lf_int_G2_DB(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_G2_DB);
+}
+static int compare_resize_linear_lf_int_G4_DB(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_G4_DB);
+}
+static int compare_resize_linear_lf_int_G1_UB(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_G1_UB);
+}
+static int compare_resize_linear_lf_int_G2_UB(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_G2_UB);
+}
+static int compare_resize_linear_lf_int_G4_UB(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_G4_UB);
+}
+static int compare_resize_linear_lf_int_G8(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_G8);
+}
+static int compare_resize_linear_lf_int_GA88(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_GA88);
+}
+static int compare_resize_linear_lf_int_G16(void)
+{
+	return compare_resize_linear_lf_int(GP_PIXEL_G16);
+}
+static int compare_resize_cubic_int_RGB101010(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_RGB101010);
+}
+static int compare_resize_cubic_int_xRGB8888(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_xRGB8888);
+}
+static int compare_resize_cubic_int_RGBA8888(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_RGBA8888);
+}
+static int compare_resize_cubic_int_RGB888(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_RGB888);
+}
+static int compare_resize_cubic_int_BGR888(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_BGR888);
+}
+static int compare_resize_cubic_int_RGB555(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_RGB555);
+}
+static int compare_resize_cubic_int_RGB565_BE(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_RGB565_BE);
+}
+static int compare_resize_cubic_int_RGB565_LE(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_RGB565_LE);
+}
+static int compare_resize_cubic_int_RGB666(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_RGB666);
+}
+static int compare_resize_cubic_int_RGB332(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_RGB332);
+}
+static int compare_resize_cubic_int_CMYK8888(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_CMYK8888);
+}
+static int compare_resize_cubic_int_P2(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_P2);
+}
+static int compare_resize_cubic_int_P4(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_P4);
+}
+static int compare_resize_cubic_int_P8(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_P8);
+}
+static int compare_resize_cubic_int_G1_DB(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_G1_DB);
+}
+static int compare_resize_cubic_int_G2_DB(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_G2_DB);
+}
+static int compare_resize_cubic_int_G4_DB(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_G4_DB);
+}
+static int compare_resize_cubic_int_G1_UB(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_G1_UB);
+}
+static int compare_resize_cubic_int_G2_UB(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_G2_UB);
+}
+static int compare_resize_cubic_int_G4_UB(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_G4_UB);
+}
+static int compare_resize_cubic_int_G8(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_G8);
+}
+static int compare_resize_cubic_int_GA88(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_GA88);
+}
+static int compare_resize_cubic_int_G16(void)
+{
+	return compare_resize_cubic_int(GP_PIXEL_G16);
+}
+static int compare_resize_cubic_RGB101010(void)
+{
+	return compare_resize_cubic(GP_PIXEL_RGB101010);
+}
+static int compare_resize_cubic_xRGB8888(void)
+{
+	return compare_resize_cubic(GP_PIXEL_xRGB8888);
+}
+static int compare_resize_cubic_RGBA8888(void)
+{
+	return compare_resize_cubic(GP_PIXEL_RGBA8888);
+}
+static int compare_resize_cubic_RGB888(void)
+{
+	return compare_resize_cubic(GP_PIXEL_RGB888);
+}
+static int compare_resize_cubic_BGR888(void)
+{
+	return compare_resize_cubic(GP_PIXEL_BGR888);
+}
+static int compare_resize_cubic_RGB555(void)
+{
+	return compare_resize_cubic(GP_PIXEL_RGB555);
+}
+static int compare_resize_cubic_RGB565_BE(void)
+{
+	return compare_resize_cubic(GP_PIXEL_RGB565_BE);
+}
+static int compare_resize_cubic_RGB565_LE(void)
+{
+	return compare_resize_cubic(GP_PIXEL_RGB565_LE);
+}
+static int compare_resize_cubic_RGB666(void)
+{
+	return compare_resize_cubic(GP_PIXEL_RGB666);
+}
+static int compare_resize_cubic_RGB332(void)
+{
+	return compare_resize_cubic(GP_PIXEL_RGB332);
+}
+static int compare_resize_cubic_CMYK8888(void)
+{
+	return compare_resize_cubic(GP_PIXEL_CMYK8888);
+}
+static int compare_resize_cubic_P2(void)
+{
+	return compare_resize_cubic(GP_PIXEL_P2);
+}
+static int compare_resize_cubic_P4(void)
+{
+	return compare_resize_cubic(GP_PIXEL_P4);
+}
+static int compare_resize_cubic_P8(void)
+{
+	return compare_resize_cubic(GP_PIXEL_P8);
+}
+static int compare_resize_cubic_G1_DB(void)
+{
+	return compare_resize_cubic(GP_PIXEL_G1_DB);
+}
+static int compare_resize_cubic_G2_DB(void)
+{
+	return compare_resize_cubic(GP_PIXEL_G2_DB);
+}
+static int compare_resize_cubic_G4_DB(void)
+{
+	return compare_resize_cubic(GP_PIXEL_G4_DB);
+}
+static int compare_resize_cubic_G1_UB(void)
+{
+	return compare_resize_cubic(GP_PIXEL_G1_UB);
+}
+static int compare_resize_cubic_G2_UB(void)
+{
+	return compare_resize_cubic(GP_PIXEL_G2_UB);
+}
+static int compare_resize_cubic_G4_UB(void)
+{
+	return compare_resize_cubic(GP_PIXEL_G4_UB);
+}
+static int compare_resize_cubic_G8(void)
+{
+	return compare_resize_cubic(GP_PIXEL_G8);
+}
+static int compare_resize_cubic_GA88(void)
+{
+	return compare_resize_cubic(GP_PIXEL_GA88);
+}
+static int compare_resize_cubic_G16(void)
+{
+	return compare_resize_cubic(GP_PIXEL_G16);
+}
+static int compare_laplace_RGB101010(void)
+{
+	return compare_laplace(GP_PIXEL_RGB101010);
+}
+static int compare_laplace_xRGB8888(void)
+{
+	return compare_laplace(GP_PIXEL_xRGB8888);
+}
+static int compare_laplace_RGBA8888(void)
+{
+	return compare_laplace(GP_PIXEL_RGBA8888);
+}
+static int compare_laplace_RGB888(void)
+{
+	return compare_laplace(GP_PIXEL_RGB888);
+}
+static int compare_laplace_BGR888(void)
+{
+	return compare_laplace(GP_PIXEL_BGR888);
+}
+static int compare_laplace_RGB555(void)
+{
+	return compare_laplace(GP_PIXEL_RGB555);
+}
+static int compare_laplace_RGB565_BE(void)
+{
+	return compare_laplace(GP_PIXEL_RGB565_BE);
+}
+static int compare_laplace_RGB565_LE(void)
+{
+	return compare_laplace(GP_PIXEL_RGB565_LE);
+}
+static int compare_laplace_RGB666(void)
+{
+	return compare_laplace(GP_PIXEL_RGB666);
+}
+static int compare_laplace_RGB332(void)
+{
+	return compare_laplace(GP_PIXEL_RGB332);
+}
+static int compare_laplace_CMYK8888(void)
+{
+	return compare_laplace(GP_PIXEL_CMYK8888);
+}
+static int compare_laplace_P2(void)
+{
+	return compare_laplace(GP_PIXEL_P2);
+}
+static int compare_laplace_P4(void)
+{
+	return compare_laplace(GP_PIXEL_P4);
+}
+static int compare_laplace_P8(void)
+{
+	return compare_laplace(GP_PIXEL_P8);
+}
+static int compare_laplace_G1_DB(void)
+{
+	return compare_laplace(GP_PIXEL_G1_DB);
+}
+static int compare_laplace_G2_DB(void)
+{
+	return compare_laplace(GP_PIXEL_G2_DB);
+}
+static int compare_laplace_G4_DB(void)
+{
+	return compare_laplace(GP_PIXEL_G4_DB);
+}
+static int compare_laplace_G1_UB(void)
+{
+	return compare_laplace(GP_PIXEL_G1_UB);
+}
+static int compare_laplace_G2_UB(void)
+{
+	return compare_laplace(GP_PIXEL_G2_UB);
+}
+static int compare_laplace_G4_UB(void)
+{
+	return compare_laplace(GP_PIXEL_G4_UB);
+}
+static int compare_laplace_G8(void)
+{
+	return compare_laplace(GP_PIXEL_G8);
+}
+static int compare_laplace_GA88(void)
+{
+	return compare_laplace(GP_PIXEL_GA88);
+}
+static int compare_laplace_G16(void)
+{
+	return compare_laplace(GP_PIXEL_G16);
+}
+static int compare_edge_sharpening_RGB101010(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_RGB101010);
+}
+static int compare_edge_sharpening_xRGB8888(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_xRGB8888);
+}
+static int compare_edge_sharpening_RGBA8888(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_RGBA8888);
+}
+static int compare_edge_sharpening_RGB888(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_RGB888);
+}
+static int compare_edge_sharpening_BGR888(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_BGR888);
+}
+static int compare_edge_sharpening_RGB555(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_RGB555);
+}
+static int compare_edge_sharpening_RGB565_BE(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_RGB565_BE);
+}
+static int compare_edge_sharpening_RGB565_LE(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_RGB565_LE);
+}
+static int compare_edge_sharpening_RGB666(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_RGB666);
+}
+static int compare_edge_sharpening_RGB332(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_RGB332);
+}
+static int compare_edge_sharpening_CMYK8888(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_CMYK8888);
+}
+static int compare_edge_sharpening_P2(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_P2);
+}
+static int compare_edge_sharpening_P4(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_P4);
+}
+static int compare_edge_sharpening_P8(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_P8);
+}
+static int compare_edge_sharpening_G1_DB(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_G1_DB);
+}
+static int compare_edge_sharpening_G2_DB(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_G2_DB);
+}
+static int compare_edge_sharpening_G4_DB(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_G4_DB);
+}
+static int compare_edge_sharpening_G1_UB(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_G1_UB);
+}
+static int compare_edge_sharpening_G2_UB(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_G2_UB);
+}
+static int compare_edge_sharpening_G4_UB(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_G4_UB);
+}
+static int compare_edge_sharpening_G8(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_G8);
+}
+static int compare_edge_sharpening_GA88(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_GA88);
+}
+static int compare_edge_sharpening_G16(void)
+{
+	return compare_edge_sharpening(GP_PIXEL_G16);
+}
+static int compare_median_RGB101010(void)
+{
+	return compare_median(GP_PIXEL_RGB101010);
+}
+static int compare_median_xRGB8888(void)
+{
+	return compare_median(GP_PIXEL_xRGB8888);
+}
+static int compare_median_RGBA8888(void)
+{
+	return compare_median(GP_PIXEL_RGBA8888);
+}
+static int compare_median_RGB888(void)
+{
+	return compare_median(GP_PIXEL_RGB888);
+}
+static int compare_median_BGR888(void)
+{
+	return compare_median(GP_PIXEL_BGR888);
+}
+static int compare_median_RGB555(void)
+{
+	return compare_median(GP_PIXEL_RGB555);
+}
+static int compare_median_RGB565_BE(void)
+{
+	return compare_median(GP_PIXEL_RGB565_BE);
+}
+static int compare_median_RGB565_LE(void)
+{
+	return compare_median(GP_PIXEL_RGB565_LE);
+}
+static int compare_median_RGB666(void)
+{
+	return compare_median(GP_PIXEL_RGB666);
+}
+static int compare_median_RGB332(void)
+{
+	return compare_median(GP_PIXEL_RGB332);
+}
+static int compare_median_CMYK8888(void)
+{
+	return compare_median(GP_PIXEL_CMYK8888);
+}
+static int compare_median_P2(void)
+{
+	return compare_median(GP_PIXEL_P2);
+}
+static int compare_median_P4(void)
+{
+	return compare_median(GP_PIXEL_P4);
+}
+static int compare_median_P8(void)
+{
+	return compare_median(GP_PIXEL_P8);
+}
+static int compare_median_G1_DB(void)
+{
+	return compare_median(GP_PIXEL_G1_DB);
+}
+static int compare_median_G2_DB(void)
+{
+	return compare_median(GP_PIXEL_G2_DB);
+}
+static int compare_median_G4_DB(void)
+{
+	return compare_median(GP_PIXEL_G4_DB);
+}
+static int compare_median_G1_UB(void)
+{
+	return compare_median(GP_PIXEL_G1_UB);
+}
+static int compare_median_G2_UB(void)
+{
+	return compare_median(GP_PIXEL_G2_UB);
+}
+static int compare_median_G4_UB(void)
+{
+	return compare_median(GP_PIXEL_G4_UB);
+}
+static int compare_median_G8(void)
+{
+	return compare_median(GP_PIXEL_G8);
+}
+static int compare_median_GA88(void)
+{
+	return compare_median(GP_PIXEL_GA88);
+}
+static int compare_median_G16(void)
+{
+	return compare_median(GP_PIXEL_G16);
+}
+static int compare_sigma_RGB101010(void)
+{
+	return compare_sigma(GP_PIXEL_RGB101010);
+}
+static int compare_sigma_xRGB8888(void)
+{
+	return compare_sigma(GP_PIXEL_xRGB8888);
+}
+static int compare_sigma_RGBA8888(void)
+{
+	return compare_sigma(GP_PIXEL_RGBA8888);
+}
+static int compare_sigma_RGB888(void)
+{
+	return compare_sigma(GP_PIXEL_RGB888);
+}
+static int compare_sigma_BGR888(void)
+{
+	return compare_sigma(GP_PIXEL_BGR888);
+}
+static int compare_sigma_RGB555(void)
+{
+	return compare_sigma(GP_PIXEL_RGB555);
+}
+static int compare_sigma_RGB565_BE(void)
+{
+	return compare_sigma(GP_PIXEL_RGB565_BE);
+}
+static int compare_sigma_RGB565_LE(void)
+{
+	return compare_sigma(GP_PIXEL_RGB565_LE);
+}
+static int compare_sigma_RGB666(void)
+{
+	return compare_sigma(GP_PIXEL_RGB666);
+}
+static int compare_sigma_RGB332(void)
+{
+	return compare_sigma(GP_PIXEL_RGB332);
+}
+static int compare_sigma_CMYK8888(void)
+{
+	return compare_sigma(GP_PIXEL_CMYK8888);
+}
+static int compare_sigma_P2(void)
+{
+	return compare_sigma(GP_PIXEL_P2);
+}
+static int compare_sigma_P4(void)
+{
+	return compare_sigma(GP_PIXEL_P4);
+}
+static int compare_sigma_P8(void)
+{
+	return compare_sigma(GP_PIXEL_P8);
+}
+static int compare_sigma_G1_DB(void)
+{
+	return compare_sigma(GP_PIXEL_G1_DB);
+}
+static int compare_sigma_G2_DB(void)
+{
+	return compare_sigma(GP_PIXEL_G2_DB);
+}
+static int compare_sigma_G4_DB(void)
+{
+	return compare_sigma(GP_PIXEL_G4_DB);
+}
+static int compare_sigma_G1_UB(void)
+{
+	return compare_sigma(GP_PIXEL_G1_UB);
+}
+static int compare_sigma_G2_UB(void)
+{
+	return compare_sigma(GP_PIXEL_G2_UB);
+}
+static int compare_sigma_G4_UB(void)
+{
+	return compare_sigma(GP_PIXEL_G4_UB);
+}
+static int compare_sigma_G8(void)
+{
+	return compare_sigma(GP_PIXEL_G8);
+}
+static int compare_sigma_GA88(void)
+{
+	return compare_sigma(GP_PIXEL_GA88);
+}
+static int compare_sigma_G16(void)
+{
+	return compare_sigma(GP_PIXEL_G16);
+}
+static int compare_gaussian_blur_RGB101010(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_RGB101010);
+}
+static int compare_gaussian_blur_xRGB8888(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_xRGB8888);
+}
+static int compare_gaussian_blur_RGBA8888(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_RGBA8888);
+}
+static int compare_gaussian_blur_RGB888(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_RGB888);
+}
+static int compare_gaussian_blur_BGR888(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_BGR888);
+}
+static int compare_gaussian_blur_RGB555(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_RGB555);
+}
+static int compare_gaussian_blur_RGB565_BE(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_RGB565_BE);
+}
+static int compare_gaussian_blur_RGB565_LE(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_RGB565_LE);
+}
+static int compare_gaussian_blur_RGB666(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_RGB666);
+}
+static int compare_gaussian_blur_RGB332(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_RGB332);
+}
+static int compare_gaussian_blur_CMYK8888(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_CMYK8888);
+}
+static int compare_gaussian_blur_P2(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_P2);
+}
+static int compare_gaussian_blur_P4(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_P4);
+}
+static int compare_gaussian_blur_P8(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_P8);
+}
+static int compare_gaussian_blur_G1_DB(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_G1_DB);
+}
+static int compare_gaussian_blur_G2_DB(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_G2_DB);
+}
+static int compare_gaussian_blur_G4_DB(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_G4_DB);
+}
+static int compare_gaussian_blur_G1_UB(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_G1_UB);
+}
+static int compare_gaussian_blur_G2_UB(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_G2_UB);
+}
+static int compare_gaussian_blur_G4_UB(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_G4_UB);
+}
+static int compare_gaussian_blur_G8(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_G8);
+}
+static int compare_gaussian_blur_GA88(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_GA88);
+}
+static int compare_gaussian_blur_G16(void)
+{
+	return compare_gaussian_blur(GP_PIXEL_G16);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Filters Compare",
+	.tests = {
+		{.name = "Compare brightness RGB101010",
+		 .tst_fn = compare_brightness_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness xRGB8888",
+		 .tst_fn = compare_brightness_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness RGBA8888",
+		 .tst_fn = compare_brightness_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness RGB888",
+		 .tst_fn = compare_brightness_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness BGR888",
+		 .tst_fn = compare_brightness_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness RGB555",
+		 .tst_fn = compare_brightness_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness RGB565_BE",
+		 .tst_fn = compare_brightness_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness RGB565_LE",
+		 .tst_fn = compare_brightness_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness RGB666",
+		 .tst_fn = compare_brightness_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness RGB332",
+		 .tst_fn = compare_brightness_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness CMYK8888",
+		 .tst_fn = compare_brightness_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness P2",
+		 .tst_fn = compare_brightness_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness P4",
+		 .tst_fn = compare_brightness_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness P8",
+		 .tst_fn = compare_brightness_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness G1_DB",
+		 .tst_fn = compare_brightness_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness G2_DB",
+		 .tst_fn = compare_brightness_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness G4_DB",
+		 .tst_fn = compare_brightness_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness G1_UB",
+		 .tst_fn = compare_brightness_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness G2_UB",
+		 .tst_fn = compare_brightness_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness G4_UB",
+		 .tst_fn = compare_brightness_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness G8",
+		 .tst_fn = compare_brightness_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness GA88",
+		 .tst_fn = compare_brightness_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare brightness G16",
+		 .tst_fn = compare_brightness_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast RGB101010",
+		 .tst_fn = compare_contrast_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast xRGB8888",
+		 .tst_fn = compare_contrast_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast RGBA8888",
+		 .tst_fn = compare_contrast_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast RGB888",
+		 .tst_fn = compare_contrast_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast BGR888",
+		 .tst_fn = compare_contrast_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast RGB555",
+		 .tst_fn = compare_contrast_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast RGB565_BE",
+		 .tst_fn = compare_contrast_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast RGB565_LE",
+		 .tst_fn = compare_contrast_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast RGB666",
+		 .tst_fn = compare_contrast_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast RGB332",
+		 .tst_fn = compare_contrast_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast CMYK8888",
+		 .tst_fn = compare_contrast_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast P2",
+		 .tst_fn = compare_contrast_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast P4",
+		 .tst_fn = compare_contrast_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast P8",
+		 .tst_fn = compare_contrast_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast G1_DB",
+		 .tst_fn = compare_contrast_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast G2_DB",
+		 .tst_fn = compare_contrast_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast G4_DB",
+		 .tst_fn = compare_contrast_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast G1_UB",
+		 .tst_fn = compare_contrast_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast G2_UB",
+		 .tst_fn = compare_contrast_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast G4_UB",
+		 .tst_fn = compare_contrast_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast G8",
+		 .tst_fn = compare_contrast_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast GA88",
+		 .tst_fn = compare_contrast_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare contrast G16",
+		 .tst_fn = compare_contrast_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert RGB101010",
+		 .tst_fn = compare_invert_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert xRGB8888",
+		 .tst_fn = compare_invert_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert RGBA8888",
+		 .tst_fn = compare_invert_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert RGB888",
+		 .tst_fn = compare_invert_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert BGR888",
+		 .tst_fn = compare_invert_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert RGB555",
+		 .tst_fn = compare_invert_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert RGB565_BE",
+		 .tst_fn = compare_invert_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert RGB565_LE",
+		 .tst_fn = compare_invert_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert RGB666",
+		 .tst_fn = compare_invert_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert RGB332",
+		 .tst_fn = compare_invert_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert CMYK8888",
+		 .tst_fn = compare_invert_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert P2",
+		 .tst_fn = compare_invert_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert P4",
+		 .tst_fn = compare_invert_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert P8",
+		 .tst_fn = compare_invert_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert G1_DB",
+		 .tst_fn = compare_invert_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert G2_DB",
+		 .tst_fn = compare_invert_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert G4_DB",
+		 .tst_fn = compare_invert_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert G1_UB",
+		 .tst_fn = compare_invert_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert G2_UB",
+		 .tst_fn = compare_invert_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert G4_UB",
+		 .tst_fn = compare_invert_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert G8",
+		 .tst_fn = compare_invert_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert GA88",
+		 .tst_fn = compare_invert_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare invert G16",
+		 .tst_fn = compare_invert_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h RGB101010",
+		 .tst_fn = compare_mirror_h_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h xRGB8888",
+		 .tst_fn = compare_mirror_h_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h RGBA8888",
+		 .tst_fn = compare_mirror_h_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h RGB888",
+		 .tst_fn = compare_mirror_h_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h BGR888",
+		 .tst_fn = compare_mirror_h_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h RGB555",
+		 .tst_fn = compare_mirror_h_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h RGB565_BE",
+		 .tst_fn = compare_mirror_h_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h RGB565_LE",
+		 .tst_fn = compare_mirror_h_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h RGB666",
+		 .tst_fn = compare_mirror_h_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h RGB332",
+		 .tst_fn = compare_mirror_h_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h CMYK8888",
+		 .tst_fn = compare_mirror_h_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h P2",
+		 .tst_fn = compare_mirror_h_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h P4",
+		 .tst_fn = compare_mirror_h_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h P8",
+		 .tst_fn = compare_mirror_h_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h G1_DB",
+		 .tst_fn = compare_mirror_h_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h G2_DB",
+		 .tst_fn = compare_mirror_h_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h G4_DB",
+		 .tst_fn = compare_mirror_h_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h G1_UB",
+		 .tst_fn = compare_mirror_h_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h G2_UB",
+		 .tst_fn = compare_mirror_h_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h G4_UB",
+		 .tst_fn = compare_mirror_h_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h G8",
+		 .tst_fn = compare_mirror_h_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h GA88",
+		 .tst_fn = compare_mirror_h_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_h G16",
+		 .tst_fn = compare_mirror_h_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v RGB101010",
+		 .tst_fn = compare_mirror_v_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v xRGB8888",
+		 .tst_fn = compare_mirror_v_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v RGBA8888",
+		 .tst_fn = compare_mirror_v_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v RGB888",
+		 .tst_fn = compare_mirror_v_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v BGR888",
+		 .tst_fn = compare_mirror_v_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v RGB555",
+		 .tst_fn = compare_mirror_v_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v RGB565_BE",
+		 .tst_fn = compare_mirror_v_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v RGB565_LE",
+		 .tst_fn = compare_mirror_v_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v RGB666",
+		 .tst_fn = compare_mirror_v_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v RGB332",
+		 .tst_fn = compare_mirror_v_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v CMYK8888",
+		 .tst_fn = compare_mirror_v_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v P2",
+		 .tst_fn = compare_mirror_v_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v P4",
+		 .tst_fn = compare_mirror_v_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v P8",
+		 .tst_fn = compare_mirror_v_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v G1_DB",
+		 .tst_fn = compare_mirror_v_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v G2_DB",
+		 .tst_fn = compare_mirror_v_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v G4_DB",
+		 .tst_fn = compare_mirror_v_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v G1_UB",
+		 .tst_fn = compare_mirror_v_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v G2_UB",
+		 .tst_fn = compare_mirror_v_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v G4_UB",
+		 .tst_fn = compare_mirror_v_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v G8",
+		 .tst_fn = compare_mirror_v_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v GA88",
+		 .tst_fn = compare_mirror_v_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare mirror_v G16",
+		 .tst_fn = compare_mirror_v_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 RGB101010",
+		 .tst_fn = compare_rotate_90_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 xRGB8888",
+		 .tst_fn = compare_rotate_90_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 RGBA8888",
+		 .tst_fn = compare_rotate_90_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 RGB888",
+		 .tst_fn = compare_rotate_90_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 BGR888",
+		 .tst_fn = compare_rotate_90_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 RGB555",
+		 .tst_fn = compare_rotate_90_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 RGB565_BE",
+		 .tst_fn = compare_rotate_90_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 RGB565_LE",
+		 .tst_fn = compare_rotate_90_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 RGB666",
+		 .tst_fn = compare_rotate_90_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 RGB332",
+		 .tst_fn = compare_rotate_90_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 CMYK8888",
+		 .tst_fn = compare_rotate_90_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 P2",
+		 .tst_fn = compare_rotate_90_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 P4",
+		 .tst_fn = compare_rotate_90_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 P8",
+		 .tst_fn = compare_rotate_90_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 G1_DB",
+		 .tst_fn = compare_rotate_90_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 G2_DB",
+		 .tst_fn = compare_rotate_90_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 G4_DB",
+		 .tst_fn = compare_rotate_90_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 G1_UB",
+		 .tst_fn = compare_rotate_90_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 G2_UB",
+		 .tst_fn = compare_rotate_90_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 G4_UB",
+		 .tst_fn = compare_rotate_90_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 G8",
+		 .tst_fn = compare_rotate_90_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 GA88",
+		 .tst_fn = compare_rotate_90_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_90 G16",
+		 .tst_fn = compare_rotate_90_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 RGB101010",
+		 .tst_fn = compare_rotate_180_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 xRGB8888",
+		 .tst_fn = compare_rotate_180_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 RGBA8888",
+		 .tst_fn = compare_rotate_180_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 RGB888",
+		 .tst_fn = compare_rotate_180_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 BGR888",
+		 .tst_fn = compare_rotate_180_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 RGB555",
+		 .tst_fn = compare_rotate_180_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 RGB565_BE",
+		 .tst_fn = compare_rotate_180_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 RGB565_LE",
+		 .tst_fn = compare_rotate_180_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 RGB666",
+		 .tst_fn = compare_rotate_180_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 RGB332",
+		 .tst_fn = compare_rotate_180_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 CMYK8888",
+		 .tst_fn = compare_rotate_180_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 P2",
+		 .tst_fn = compare_rotate_180_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 P4",
+		 .tst_fn = compare_rotate_180_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 P8",
+		 .tst_fn = compare_rotate_180_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 G1_DB",
+		 .tst_fn = compare_rotate_180_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 G2_DB",
+		 .tst_fn = compare_rotate_180_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 G4_DB",
+		 .tst_fn = compare_rotate_180_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 G1_UB",
+		 .tst_fn = compare_rotate_180_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 G2_UB",
+		 .tst_fn = compare_rotate_180_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 G4_UB",
+		 .tst_fn = compare_rotate_180_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 G8",
+		 .tst_fn = compare_rotate_180_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 GA88",
+		 .tst_fn = compare_rotate_180_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_180 G16",
+		 .tst_fn = compare_rotate_180_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 RGB101010",
+		 .tst_fn = compare_rotate_270_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 xRGB8888",
+		 .tst_fn = compare_rotate_270_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 RGBA8888",
+		 .tst_fn = compare_rotate_270_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 RGB888",
+		 .tst_fn = compare_rotate_270_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 BGR888",
+		 .tst_fn = compare_rotate_270_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 RGB555",
+		 .tst_fn = compare_rotate_270_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 RGB565_BE",
+		 .tst_fn = compare_rotate_270_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 RGB565_LE",
+		 .tst_fn = compare_rotate_270_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 RGB666",
+		 .tst_fn = compare_rotate_270_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 RGB332",
+		 .tst_fn = compare_rotate_270_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 CMYK8888",
+		 .tst_fn = compare_rotate_270_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 P2",
+		 .tst_fn = compare_rotate_270_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 P4",
+		 .tst_fn = compare_rotate_270_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 P8",
+		 .tst_fn = compare_rotate_270_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 G1_DB",
+		 .tst_fn = compare_rotate_270_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 G2_DB",
+		 .tst_fn = compare_rotate_270_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 G4_DB",
+		 .tst_fn = compare_rotate_270_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 G1_UB",
+		 .tst_fn = compare_rotate_270_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 G2_UB",
+		 .tst_fn = compare_rotate_270_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 G4_UB",
+		 .tst_fn = compare_rotate_270_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 G8",
+		 .tst_fn = compare_rotate_270_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 GA88",
+		 .tst_fn = compare_rotate_270_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare rotate_270 G16",
+		 .tst_fn = compare_rotate_270_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn RGB101010",
+		 .tst_fn = compare_resize_nn_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn xRGB8888",
+		 .tst_fn = compare_resize_nn_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn RGBA8888",
+		 .tst_fn = compare_resize_nn_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn RGB888",
+		 .tst_fn = compare_resize_nn_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn BGR888",
+		 .tst_fn = compare_resize_nn_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn RGB555",
+		 .tst_fn = compare_resize_nn_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn RGB565_BE",
+		 .tst_fn = compare_resize_nn_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn RGB565_LE",
+		 .tst_fn = compare_resize_nn_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn RGB666",
+		 .tst_fn = compare_resize_nn_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn RGB332",
+		 .tst_fn = compare_resize_nn_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn CMYK8888",
+		 .tst_fn = compare_resize_nn_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn P2",
+		 .tst_fn = compare_resize_nn_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn P4",
+		 .tst_fn = compare_resize_nn_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn P8",
+		 .tst_fn = compare_resize_nn_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn G1_DB",
+		 .tst_fn = compare_resize_nn_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn G2_DB",
+		 .tst_fn = compare_resize_nn_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn G4_DB",
+		 .tst_fn = compare_resize_nn_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn G1_UB",
+		 .tst_fn = compare_resize_nn_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn G2_UB",
+		 .tst_fn = compare_resize_nn_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn G4_UB",
+		 .tst_fn = compare_resize_nn_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn G8",
+		 .tst_fn = compare_resize_nn_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn GA88",
+		 .tst_fn = compare_resize_nn_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_nn G16",
+		 .tst_fn = compare_resize_nn_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int RGB101010",
+		 .tst_fn = compare_resize_linear_int_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int xRGB8888",
+		 .tst_fn = compare_resize_linear_int_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int RGBA8888",
+		 .tst_fn = compare_resize_linear_int_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int RGB888",
+		 .tst_fn = compare_resize_linear_int_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int BGR888",
+		 .tst_fn = compare_resize_linear_int_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int RGB555",
+		 .tst_fn = compare_resize_linear_int_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int RGB565_BE",
+		 .tst_fn = compare_resize_linear_int_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int RGB565_LE",
+		 .tst_fn = compare_resize_linear_int_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int RGB666",
+		 .tst_fn = compare_resize_linear_int_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int RGB332",
+		 .tst_fn = compare_resize_linear_int_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int CMYK8888",
+		 .tst_fn = compare_resize_linear_int_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int P2",
+		 .tst_fn = compare_resize_linear_int_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int P4",
+		 .tst_fn = compare_resize_linear_int_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int P8",
+		 .tst_fn = compare_resize_linear_int_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int G1_DB",
+		 .tst_fn = compare_resize_linear_int_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int G2_DB",
+		 .tst_fn = compare_resize_linear_int_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int G4_DB",
+		 .tst_fn = compare_resize_linear_int_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int G1_UB",
+		 .tst_fn = compare_resize_linear_int_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int G2_UB",
+		 .tst_fn = compare_resize_linear_int_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int G4_UB",
+		 .tst_fn = compare_resize_linear_int_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int G8",
+		 .tst_fn = compare_resize_linear_int_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int GA88",
+		 .tst_fn = compare_resize_linear_int_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_int G16",
+		 .tst_fn = compare_resize_linear_int_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int RGB101010",
+		 .tst_fn = compare_resize_linear_lf_int_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int xRGB8888",
+		 .tst_fn = compare_resize_linear_lf_int_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int RGBA8888",
+		 .tst_fn = compare_resize_linear_lf_int_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int RGB888",
+		 .tst_fn = compare_resize_linear_lf_int_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int BGR888",
+		 .tst_fn = compare_resize_linear_lf_int_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int RGB555",
+		 .tst_fn = compare_resize_linear_lf_int_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int RGB565_BE",
+		 .tst_fn = compare_resize_linear_lf_int_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int RGB565_LE",
+		 .tst_fn = compare_resize_linear_lf_int_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int RGB666",
+		 .tst_fn = compare_resize_linear_lf_int_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int RGB332",
+		 .tst_fn = compare_resize_linear_lf_int_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int CMYK8888",
+		 .tst_fn = compare_resize_linear_lf_int_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int P2",
+		 .tst_fn = compare_resize_linear_lf_int_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int P4",
+		 .tst_fn = compare_resize_linear_lf_int_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int P8",
+		 .tst_fn = compare_resize_linear_lf_int_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int G1_DB",
+		 .tst_fn = compare_resize_linear_lf_int_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int G2_DB",
+		 .tst_fn = compare_resize_linear_lf_int_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int G4_DB",
+		 .tst_fn = compare_resize_linear_lf_int_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int G1_UB",
+		 .tst_fn = compare_resize_linear_lf_int_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int G2_UB",
+		 .tst_fn = compare_resize_linear_lf_int_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int G4_UB",
+		 .tst_fn = compare_resize_linear_lf_int_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int G8",
+		 .tst_fn = compare_resize_linear_lf_int_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int GA88",
+		 .tst_fn = compare_resize_linear_lf_int_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_linear_lf_int G16",
+		 .tst_fn = compare_resize_linear_lf_int_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int RGB101010",
+		 .tst_fn = compare_resize_cubic_int_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int xRGB8888",
+		 .tst_fn = compare_resize_cubic_int_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int RGBA8888",
+		 .tst_fn = compare_resize_cubic_int_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int RGB888",
+		 .tst_fn = compare_resize_cubic_int_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int BGR888",
+		 .tst_fn = compare_resize_cubic_int_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int RGB555",
+		 .tst_fn = compare_resize_cubic_int_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int RGB565_BE",
+		 .tst_fn = compare_resize_cubic_int_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int RGB565_LE",
+		 .tst_fn = compare_resize_cubic_int_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int RGB666",
+		 .tst_fn = compare_resize_cubic_int_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int RGB332",
+		 .tst_fn = compare_resize_cubic_int_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int CMYK8888",
+		 .tst_fn = compare_resize_cubic_int_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int P2",
+		 .tst_fn = compare_resize_cubic_int_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int P4",
+		 .tst_fn = compare_resize_cubic_int_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int P8",
+		 .tst_fn = compare_resize_cubic_int_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int G1_DB",
+		 .tst_fn = compare_resize_cubic_int_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int G2_DB",
+		 .tst_fn = compare_resize_cubic_int_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int G4_DB",
+		 .tst_fn = compare_resize_cubic_int_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int G1_UB",
+		 .tst_fn = compare_resize_cubic_int_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int G2_UB",
+		 .tst_fn = compare_resize_cubic_int_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int G4_UB",
+		 .tst_fn = compare_resize_cubic_int_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int G8",
+		 .tst_fn = compare_resize_cubic_int_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int GA88",
+		 .tst_fn = compare_resize_cubic_int_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic_int G16",
+		 .tst_fn = compare_resize_cubic_int_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic RGB101010",
+		 .tst_fn = compare_resize_cubic_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic xRGB8888",
+		 .tst_fn = compare_resize_cubic_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic RGBA8888",
+		 .tst_fn = compare_resize_cubic_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic RGB888",
+		 .tst_fn = compare_resize_cubic_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic BGR888",
+		 .tst_fn = compare_resize_cubic_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic RGB555",
+		 .tst_fn = compare_resize_cubic_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic RGB565_BE",
+		 .tst_fn = compare_resize_cubic_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic RGB565_LE",
+		 .tst_fn = compare_resize_cubic_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic RGB666",
+		 .tst_fn = compare_resize_cubic_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic RGB332",
+		 .tst_fn = compare_resize_cubic_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic CMYK8888",
+		 .tst_fn = compare_resize_cubic_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic P2",
+		 .tst_fn = compare_resize_cubic_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic P4",
+		 .tst_fn = compare_resize_cubic_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic P8",
+		 .tst_fn = compare_resize_cubic_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic G1_DB",
+		 .tst_fn = compare_resize_cubic_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic G2_DB",
+		 .tst_fn = compare_resize_cubic_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic G4_DB",
+		 .tst_fn = compare_resize_cubic_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic G1_UB",
+		 .tst_fn = compare_resize_cubic_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic G2_UB",
+		 .tst_fn = compare_resize_cubic_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic G4_UB",
+		 .tst_fn = compare_resize_cubic_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic G8",
+		 .tst_fn = compare_resize_cubic_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic GA88",
+		 .tst_fn = compare_resize_cubic_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare resize_cubic G16",
+		 .tst_fn = compare_resize_cubic_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace RGB101010",
+		 .tst_fn = compare_laplace_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace xRGB8888",
+		 .tst_fn = compare_laplace_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace RGBA8888",
+		 .tst_fn = compare_laplace_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace RGB888",
+		 .tst_fn = compare_laplace_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace BGR888",
+		 .tst_fn = compare_laplace_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace RGB555",
+		 .tst_fn = compare_laplace_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace RGB565_BE",
+		 .tst_fn = compare_laplace_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace RGB565_LE",
+		 .tst_fn = compare_laplace_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace RGB666",
+		 .tst_fn = compare_laplace_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace RGB332",
+		 .tst_fn = compare_laplace_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace CMYK8888",
+		 .tst_fn = compare_laplace_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace P2",
+		 .tst_fn = compare_laplace_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace P4",
+		 .tst_fn = compare_laplace_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace P8",
+		 .tst_fn = compare_laplace_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace G1_DB",
+		 .tst_fn = compare_laplace_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace G2_DB",
+		 .tst_fn = compare_laplace_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace G4_DB",
+		 .tst_fn = compare_laplace_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace G1_UB",
+		 .tst_fn = compare_laplace_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace G2_UB",
+		 .tst_fn = compare_laplace_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace G4_UB",
+		 .tst_fn = compare_laplace_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace G8",
+		 .tst_fn = compare_laplace_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace GA88",
+		 .tst_fn = compare_laplace_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare laplace G16",
+		 .tst_fn = compare_laplace_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening RGB101010",
+		 .tst_fn = compare_edge_sharpening_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening xRGB8888",
+		 .tst_fn = compare_edge_sharpening_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening RGBA8888",
+		 .tst_fn = compare_edge_sharpening_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening RGB888",
+		 .tst_fn = compare_edge_sharpening_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening BGR888",
+		 .tst_fn = compare_edge_sharpening_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening RGB555",
+		 .tst_fn = compare_edge_sharpening_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening RGB565_BE",
+		 .tst_fn = compare_edge_sharpening_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening RGB565_LE",
+		 .tst_fn = compare_edge_sharpening_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening RGB666",
+		 .tst_fn = compare_edge_sharpening_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening RGB332",
+		 .tst_fn = compare_edge_sharpening_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening CMYK8888",
+		 .tst_fn = compare_edge_sharpening_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening P2",
+		 .tst_fn = compare_edge_sharpening_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening P4",
+		 .tst_fn = compare_edge_sharpening_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening P8",
+		 .tst_fn = compare_edge_sharpening_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening G1_DB",
+		 .tst_fn = compare_edge_sharpening_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening G2_DB",
+		 .tst_fn = compare_edge_sharpening_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening G4_DB",
+		 .tst_fn = compare_edge_sharpening_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening G1_UB",
+		 .tst_fn = compare_edge_sharpening_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening G2_UB",
+		 .tst_fn = compare_edge_sharpening_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening G4_UB",
+		 .tst_fn = compare_edge_sharpening_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening G8",
+		 .tst_fn = compare_edge_sharpening_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening GA88",
+		 .tst_fn = compare_edge_sharpening_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare edge_sharpening G16",
+		 .tst_fn = compare_edge_sharpening_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median RGB101010",
+		 .tst_fn = compare_median_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median xRGB8888",
+		 .tst_fn = compare_median_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median RGBA8888",
+		 .tst_fn = compare_median_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median RGB888",
+		 .tst_fn = compare_median_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median BGR888",
+		 .tst_fn = compare_median_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median RGB555",
+		 .tst_fn = compare_median_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median RGB565_BE",
+		 .tst_fn = compare_median_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median RGB565_LE",
+		 .tst_fn = compare_median_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median RGB666",
+		 .tst_fn = compare_median_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median RGB332",
+		 .tst_fn = compare_median_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median CMYK8888",
+		 .tst_fn = compare_median_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median P2",
+		 .tst_fn = compare_median_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median P4",
+		 .tst_fn = compare_median_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median P8",
+		 .tst_fn = compare_median_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median G1_DB",
+		 .tst_fn = compare_median_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median G2_DB",
+		 .tst_fn = compare_median_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median G4_DB",
+		 .tst_fn = compare_median_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median G1_UB",
+		 .tst_fn = compare_median_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median G2_UB",
+		 .tst_fn = compare_median_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median G4_UB",
+		 .tst_fn = compare_median_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median G8",
+		 .tst_fn = compare_median_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median GA88",
+		 .tst_fn = compare_median_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare median G16",
+		 .tst_fn = compare_median_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma RGB101010",
+		 .tst_fn = compare_sigma_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma xRGB8888",
+		 .tst_fn = compare_sigma_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma RGBA8888",
+		 .tst_fn = compare_sigma_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma RGB888",
+		 .tst_fn = compare_sigma_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma BGR888",
+		 .tst_fn = compare_sigma_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma RGB555",
+		 .tst_fn = compare_sigma_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma RGB565_BE",
+		 .tst_fn = compare_sigma_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma RGB565_LE",
+		 .tst_fn = compare_sigma_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma RGB666",
+		 .tst_fn = compare_sigma_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma RGB332",
+		 .tst_fn = compare_sigma_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma CMYK8888",
+		 .tst_fn = compare_sigma_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma P2",
+		 .tst_fn = compare_sigma_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma P4",
+		 .tst_fn = compare_sigma_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma P8",
+		 .tst_fn = compare_sigma_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma G1_DB",
+		 .tst_fn = compare_sigma_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma G2_DB",
+		 .tst_fn = compare_sigma_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma G4_DB",
+		 .tst_fn = compare_sigma_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma G1_UB",
+		 .tst_fn = compare_sigma_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma G2_UB",
+		 .tst_fn = compare_sigma_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma G4_UB",
+		 .tst_fn = compare_sigma_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma G8",
+		 .tst_fn = compare_sigma_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma GA88",
+		 .tst_fn = compare_sigma_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare sigma G16",
+		 .tst_fn = compare_sigma_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur RGB101010",
+		 .tst_fn = compare_gaussian_blur_RGB101010,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur xRGB8888",
+		 .tst_fn = compare_gaussian_blur_xRGB8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur RGBA8888",
+		 .tst_fn = compare_gaussian_blur_RGBA8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur RGB888",
+		 .tst_fn = compare_gaussian_blur_RGB888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur BGR888",
+		 .tst_fn = compare_gaussian_blur_BGR888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur RGB555",
+		 .tst_fn = compare_gaussian_blur_RGB555,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur RGB565_BE",
+		 .tst_fn = compare_gaussian_blur_RGB565_BE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur RGB565_LE",
+		 .tst_fn = compare_gaussian_blur_RGB565_LE,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur RGB666",
+		 .tst_fn = compare_gaussian_blur_RGB666,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur RGB332",
+		 .tst_fn = compare_gaussian_blur_RGB332,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur CMYK8888",
+		 .tst_fn = compare_gaussian_blur_CMYK8888,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur P2",
+		 .tst_fn = compare_gaussian_blur_P2,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur P4",
+		 .tst_fn = compare_gaussian_blur_P4,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur P8",
+		 .tst_fn = compare_gaussian_blur_P8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur G1_DB",
+		 .tst_fn = compare_gaussian_blur_G1_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur G2_DB",
+		 .tst_fn = compare_gaussian_blur_G2_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur G4_DB",
+		 .tst_fn = compare_gaussian_blur_G4_DB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur G1_UB",
+		 .tst_fn = compare_gaussian_blur_G1_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur G2_UB",
+		 .tst_fn = compare_gaussian_blur_G2_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur G4_UB",
+		 .tst_fn = compare_gaussian_blur_G4_UB,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur G8",
+		 .tst_fn = compare_gaussian_blur_G8,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur GA88",
+		 .tst_fn = compare_gaussian_blur_GA88,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = "Compare gaussian_blur G16",
+		 .tst_fn = compare_gaussian_blur_G16,
+		 .flags = TST_CHECK_MALLOC},
+		{.name = NULL}
+	}
+};
@@ -0,0 +1,318 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <core/gp_core.h>
+#include <filters/gp_filters.h>
+#include <filters/gp_rand.h>
+#include "tst_test.h"
+
+static int check_philox(const uint32_t ctr[4], const uint32_t key[2],
+                        const uint32_t exp[4])
+{
+	uint32_t res[4] = {ctr[0], ctr[1], ctr[2], ctr[3]};
+
+	gp_rand_philox(res, key);
+
+	if (memcmp(res, exp, sizeof(res))) {
+		tst_msg("Wrong result %08x %08x %08x %08x expected %08x %08x %08x %08x",
+		        res[0], res[1], res[2], res[3],
+		        exp[0], exp[1], exp[2], exp[3]);
+		return 1;
+	}
+
+	return 0;
+}
+
+/* Known answers from the Philox reference implementation */
+static int philox_kat(void)
+{
+	static const uint32_t ctr0[4] = {0, 0, 0, 0};
+	static const uint32_t key0[2] = {0, 0};
+	static const uint32_t exp0[4] = {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8};
+	static const uint32_t ctr1[4] = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+	static const uint32_t key1[2] = {0xffffffff, 0xffffffff};
+	static const uint32_t exp1[4] = {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd};
+	static const uint32_t ctr2[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+	static const uint32_t key2[2] = {0xa4093822, 0x299f31d0};
+	static const uint32_t exp2[4] = {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1};
+
+	if (check_philox(ctr0, key0, exp0) ||
+	    check_philox(ctr1, key1, exp1) ||
+	    check_philox(ctr2, key2, exp2))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+#define NORM_SIZE 100000
+
+static int norm_int_ctr(void)
+{
+	int *arr = malloc(NORM_SIZE * sizeof(int));
+	int *arr2 = malloc(NORM_SIZE * sizeof(int));
+	double mean = 0, var = 0;
+	int ret = TST_PASSED;
+	unsigned int i;
+
+	if (!arr || !arr2) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_norm_int_ctr(arr, NORM_SIZE, 1000, 100, 42, 7);
+
+	for (i = 0; i < NORM_SIZE; i++)
+		mean += arr[i];
+
+	mean /= NORM_SIZE;
+
+	for (i = 0; i < NORM_SIZE; i++)
+		var += (arr[i] - mean) * (arr[i] - mean);
+
+	var /= NORM_SIZE;
+
+	if (fabs(mean - 100) > 15 || fabs(sqrt(var) - 1000) > 15) {
+		tst_msg("Wrong distribution mean %f sigma %f", mean, sqrt(var));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	gp_norm_int_ctr(arr2, NORM_SIZE, 1000, 100, 42, 7);
+
+	if (memcmp(arr, arr2, NORM_SIZE * sizeof(int))) {
+		tst_msg("Same seed and stream produced different numbers");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	gp_norm_int_ctr(arr2, NORM_SIZE, 1000, 100, 42, 8);
+
+	if (!memcmp(arr, arr2, NORM_SIZE * sizeof(int))) {
+		tst_msg("Different streams produced the same numbers");
+		ret = TST_FAILED;
+	}
+
+exit:
+	free(arr);
+	free(arr2);
+	return ret;
+}
+
+static int progress(gp_progress_cb *self)
+{
+	(void) self;
+	return 0;
+}
+
+static gp_pixmap *noise(gp_pixel_type pixel_type, gp_size w, gp_size h,
+                        gp_pixel fill, unsigned int threads)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = threads};
+	gp_pixmap *src = gp_pixmap_alloc(w, h, pixel_type);
+	gp_pixmap *dst;
+
+	if (!src)
+		return NULL;
+
+	gp_fill(src, fill);
+
+	srandom(42);
+
+	dst = gp_filter_gaussian_noise_add_alloc(src, 0.05, 0, &callback);
+
+	gp_pixmap_free(src);
+
+	return dst;
+}
+
+static unsigned int done_cnt;
+
+static int progress_done(gp_progress_cb *self)
+{
+	if (self->percentage >= 100)
+		done_cnt++;
+
+	return 0;
+}
+
+/* The callback has to be called with 100% exactly once */
+static int noise_done(unsigned int threads)
+{
+	gp_progress_cb callback = {.callback = progress_done, .threads = threads};
+	gp_pixmap *src = gp_pixmap_alloc(211, 157, GP_PIXEL_RGB888);
+	int ret = TST_PASSED;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	done_cnt = 0;
+
+	if (gp_filter_gaussian_noise_add(src, src, 0.05, 0, &callback)) {
+		tst_msg("Gaussian noise failed");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (done_cnt != 1) {
+		tst_msg("Progress done reported %u times", done_cnt);
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int noise_done_1(void)
+{
+	return noise_done(1);
+}
+
+static int noise_done_4(void)
+{
+	return noise_done(4);
+}
+
+static int noise_stats(void)
+{
+	gp_pixmap *dst = noise(GP_PIXEL_G8, 311, 217, 128, 1);
+	double mean = 0, var = 0;
+	gp_size cnt = 311 * 217;
+	int ret = TST_PASSED;
+	gp_coord x, y;
+
+	if (!dst)
+		return TST_UNTESTED;
+
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++)
+			mean += gp_getpixel_raw(dst, x, y);
+	}
+
+	mean /= cnt;
+
+	for (y = 0; y < (gp_coord)dst->h; y++) {
+		for (x = 0; x < (gp_coord)dst->w; x++) {
+			double d = gp_getpixel_raw(dst, x, y) - mean;
+			var += d * d;
+		}
+	}
+
+	var /= cnt;
+
+	/* sigma = 0.05 * 255 truncated, the samples are truncated as well */
+	if (fabs(mean - 128) > 1 || fabs(sqrt(var) - 12) > 1) {
+		tst_msg("Wrong noise mean %f sigma %f", mean, sqrt(var));
+		ret = TST_FAILED;
+	}
+
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+static int noise_compare(gp_pixel_type pixel_type, unsigned int threads1,
+                         unsigned int threads2)
+{
+	gp_pixmap *dst1 = noise(pixel_type, 173, 151, 0x404040, threads1);
+	gp_pixmap *dst2 = noise(pixel_type, 173, 151, 0x404040, threads2);
+	int ret = TST_PASSED;
+	gp_coord x, y;
+
+	if (!dst1 || !dst2) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	for (y = 0; y < (gp_coord)dst1->h; y++) {
+		for (x = 0; x < (gp_coord)dst1->w; x++) {
+			gp_pixel p1 = gp_getpixel_raw(dst1, x, y);
+			gp_pixel p2 = gp_getpixel_raw(dst2, x, y);
+
+			if (p1 != p2) {
+				tst_msg("Pixels differ at %i %i %08x != %08x",
+				        x, y, p1, p2);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(dst1);
+	gp_pixmap_free(dst2);
+	return ret;
+}
+
+static int noise_reproducible(void)
+{
+	return noise_compare(GP_PIXEL_RGB888, 1, 1);
+}
+
+static int noise_threads(void)
+{
+	return noise_compare(GP_PIXEL_RGB888, 1, 4);
+}
+
+static int noise_threads_rgb565(void)
+{
+	return noise_compare(GP_PIXEL_RGB565, 3, 7);
+}
+
+static gp_pixmap *bench_src;
+
+static int bench_noise(void)
+{
+	if (!bench_src) {
+		bench_src = gp_pixmap_alloc(1000, 1000, GP_PIXEL_RGB888);
+		if (!bench_src)
+			return TST_UNTESTED;
+
+		gp_fill(bench_src, 0x808080);
+	}
+
+	if (gp_filter_gaussian_noise_add(bench_src, bench_src, 0.05, 0, NULL))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Gaussian noise testsuite",
+	.tests = {
+		{.name = "Philox known answers",
+		 .tst_fn = philox_kat},
+
+		{.name = "Counter based normal distribution",
+		 .tst_fn = norm_int_ctr,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Gaussian noise statistics",
+		 .tst_fn = noise_stats},
+
+		{.name = "Gaussian noise reproducible",
+		 .tst_fn = noise_reproducible},
+
+		{.name = "Gaussian noise progress done",
+		 .tst_fn = noise_done_1},
+
+		{.name = "Gaussian noise progress done threads",
+		 .tst_fn = noise_done_4},
+
+		{.name = "Gaussian noise threads",
+		 .tst_fn = noise_threads},
+
+		{.name = "Gaussian noise threads RGB565",
+		 .tst_fn = noise_threads_rgb565},
+
+		{.name = "Gaussian noise RGB888 1000x1000",
+		 .tst_fn = bench_noise,
+		 .bench_iter = 10},
+
+		{},
+	}
+};
@@ -0,0 +1,413 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <core/gp_core.h>
+#include <filters/gp_filters.h>
+#include "tst_test.h"
+
+static gp_pixmap *random_pixmap(gp_size w, gp_size h, gp_pixel_type pixel_type)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(w, h, pixel_type);
+	gp_coord x, y;
+
+	if (!ret)
+		return NULL;
+
+	srandom(42);
+
+	for (y = 0; y < (gp_coord)h; y++) {
+		for (x = 0; x < (gp_coord)w; x++)
+			gp_putpixel_raw(ret, x, y, random());
+	}
+
+	return ret;
+}
+
+/*
+ * Counts every step-th pixel in every step-th row of the rectangle and
+ * compares the result with the histogram.
+ */
+static int check_hist(const gp_histogram *hist, const gp_pixmap *src,
+                      gp_coord x0, gp_coord y0, gp_size w, gp_size h,
+                      unsigned int step)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(src->pixel_type);
+	unsigned int chan, i;
+	int ret = 0;
+
+	for (chan = 0; chan < desc->numchannels; chan++) {
+		const gp_pixel_channel *c = &desc->channels[chan];
+		const gp_histogram_channel *hc = hist->channels[chan];
+		uint32_t *ref = calloc(hc->len, sizeof(uint32_t));
+		gp_coord x, y;
+
+		if (!ref)
+			return 1;
+
+		for (y = y0; y < y0 + (gp_coord)h; y += step) {
+			for (x = x0; x < x0 + (gp_coord)w; x += step) {
+				gp_pixel pix = gp_getpixel_raw(src, x, y);
+
+				ref[(pix >> c->offset) & ((1 << c->size) - 1)]++;
+			}
+		}
+
+		for (i = 0; i < hc->len; i++) {
+			if (hc->hist[i] != ref[i]) {
+				tst_msg("Wrong count chan %s val %u %u != %u",
+				        hc->chan_name, i, hc->hist[i], ref[i]);
+				ret = 1;
+				break;
+			}
+		}
+
+		free(ref);
+
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+
+static int hist_ref(gp_pixel_type pixel_type, gp_size w, gp_size h)
+{
+	gp_pixmap *src = random_pixmap(w, h, pixel_type);
+	gp_histogram *hist = gp_histogram_alloc(pixel_type);
+	int ret = TST_PASSED;
+
+	if (!src || !hist) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	if (gp_filter_histogram(hist, src, NULL)) {
+		tst_msg("Histogram failed: %s", strerror(errno));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (check_hist(hist, src, 0, 0, w, h, 1))
+		ret = TST_FAILED;
+
+exit:
+	gp_histogram_free(hist);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int hist_rgb888(void)
+{
+	return hist_ref(GP_PIXEL_RGB888, 101, 67);
+}
+
+static int hist_rgb565(void)
+{
+	return hist_ref(GP_PIXEL_RGB565, 33, 17);
+}
+
+static int hist_g16(void)
+{
+	return hist_ref(GP_PIXEL_G16, 55, 43);
+}
+
+static int hist_g1(void)
+{
+	return hist_ref(GP_PIXEL_G1, 13, 7);
+}
+
+static int hist_uniform(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(97, 31, GP_PIXEL_G8);
+	gp_histogram *hist = gp_histogram_alloc(GP_PIXEL_G8);
+	gp_histogram_channel *chan;
+	int ret = TST_PASSED;
+
+	if (!src || !hist) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_fill(src, 0x80);
+
+	if (gp_filter_histogram(hist, src, NULL)) {
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	chan = gp_histogram_channel_by_name(hist, "V");
+
+	if (chan->hist[0x80] != 97 * 31 || chan->max != 97 * 31 || chan->min != 0) {
+		tst_msg("Wrong histogram %u max %u min %u",
+		        chan->hist[0x80], chan->max, chan->min);
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_histogram_free(hist);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int progress(gp_progress_cb *self)
+{
+	(void) self;
+	return 0;
+}
+
+static int hist_threads(void)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = 4};
+	gp_pixmap *src = random_pixmap(211, 157, GP_PIXEL_RGBA8888);
+	gp_histogram *hist = gp_histogram_alloc(GP_PIXEL_RGBA8888);
+	int ret = TST_PASSED;
+
+	if (!src || !hist) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	if (gp_filter_histogram(hist, src, &callback)) {
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (check_hist(hist, src, 0, 0, src->w, src->h, 1))
+		ret = TST_FAILED;
+
+exit:
+	gp_histogram_free(hist);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static unsigned int done_cnt;
+
+static int progress_done(gp_progress_cb *self)
+{
+	if (self->percentage >= 100)
+		done_cnt++;
+
+	return 0;
+}
+
+/* The callback has to be called with 100% exactly once */
+static int hist_done(unsigned int threads)
+{
+	gp_progress_cb callback = {.callback = progress_done, .threads = threads};
+	gp_pixmap *src = random_pixmap(211, 157, GP_PIXEL_RGB888);
+	gp_histogram *hist = gp_histogram_alloc(GP_PIXEL_RGB888);
+	int ret = TST_PASSED;
+
+	if (!src || !hist) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	done_cnt = 0;
+
+	if (gp_filter_histogram(hist, src, &callback)) {
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (done_cnt != 1) {
+		tst_msg("Progress done reported %u times", done_cnt);
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_histogram_free(hist);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int hist_done_1(void)
+{
+	return hist_done(1);
+}
+
+static int hist_done_4(void)
+{
+	return hist_done(4);
+}
+
+static int hist_ex(gp_coord x, gp_coord y, gp_size w, gp_size h,
+                   unsigned int step, unsigned int threads)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = threads};
+	gp_pixmap *src = random_pixmap(173, 149, GP_PIXEL_RGB888);
+	gp_histogram *hist = gp_histogram_alloc(GP_PIXEL_RGB888);
+	int ret = TST_PASSED;
+
+	if (!src || !hist) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	if (gp_filter_histogram_ex(hist, src, x, y, w, h, step, &callback)) {
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (check_hist(hist, src, x, y, w, h, step ? step : 1))
+		ret = TST_FAILED;
+
+exit:
+	gp_histogram_free(hist);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int hist_rect(void)
+{
+	return hist_ex(17, 23, 101, 79, 1, 1);
+}
+
+static int hist_rect_threads(void)
+{
+	return hist_ex(17, 23, 101, 79, 1, 4);
+}
+
+static int hist_step(void)
+{
+	return hist_ex(3, 5, 150, 130, 3, 1);
+}
+
+static int hist_step_threads(void)
+{
+	return hist_ex(3, 5, 150, 130, 7, 4);
+}
+
+static int hist_step_zero(void)
+{
+	return hist_ex(0, 0, 173, 149, 0, 1);
+}
+
+static int hist_wrong_type(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(10, 10, GP_PIXEL_RGB888);
+	gp_histogram *hist = gp_histogram_alloc(GP_PIXEL_G8);
+	int ret = TST_PASSED;
+
+	if (!src || !hist) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	if (!gp_filter_histogram(hist, src, NULL)) {
+		tst_msg("Histogram succeeded on mismatched pixel type");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (errno != EINVAL) {
+		tst_msg("Wrong errno %s (%i) expected EINVAL",
+		        strerror(errno), errno);
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_histogram_free(hist);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static gp_pixmap *bench_src;
+static gp_histogram *bench_hist;
+
+static int bench_hist_step(unsigned int step)
+{
+	if (!bench_src)
+		bench_src = random_pixmap(1000, 1000, GP_PIXEL_RGB888);
+
+	if (!bench_hist)
+		bench_hist = gp_histogram_alloc(GP_PIXEL_RGB888);
+
+	if (!bench_src || !bench_hist)
+		return TST_UNTESTED;
+
+	if (gp_filter_histogram_ex(bench_hist, bench_src, 0, 0,
+	                           bench_src->w, bench_src->h, step, NULL))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int bench_histogram(void)
+{
+	return bench_hist_step(1);
+}
+
+static int bench_hist_4(void)
+{
+	return bench_hist_step(4);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Histogram testsuite",
+	.tests = {
+		{.name = "Histogram RGB888",
+		 .tst_fn = hist_rgb888,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Histogram RGB565",
+		 .tst_fn = hist_rgb565,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Histogram G16",
+		 .tst_fn = hist_g16,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Histogram G1",
+		 .tst_fn = hist_g1,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Histogram uniform",
+		 .tst_fn = hist_uniform,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Histogram threads",
+		 .tst_fn = hist_threads},
+
+		{.name = "Histogram progress done",
+		 .tst_fn = hist_done_1},
+
+		{.name = "Histogram progress done threads",
+		 .tst_fn = hist_done_4},
+
+		{.name = "Histogram rect",
+		 .tst_fn = hist_rect},
+
+		{.name = "Histogram rect threads",
+		 .tst_fn = hist_rect_threads},
+
+		{.name = "Histogram step 3",
+		 .tst_fn = hist_step},
+
+		{.name = "Histogram step 7 threads",
+		 .tst_fn = hist_step_threads},
+
+		{.name = "Histogram step 0",
+		 .tst_fn = hist_step_zero},
+
+		{.name = "Histogram wrong pixel type",
+		 .tst_fn = hist_wrong_type,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Histogram RGB888 1000x1000",
+		 .tst_fn = bench_histogram,
+		 .bench_iter = 10},
+
+		{.name = "Histogram RGB888 1000x1000 step 4",
+		 .tst_fn = bench_hist_4,
+		 .bench_iter = 10},
+
+		{},
+	}
+};
@@ -0,0 +1,400 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include <errno.h>
+#include <core/gp_core.h>
+#include <filters/gp_filters.h>
+#include "tst_test.h"
+
+static gp_pixmap *random_pixmap(gp_size w, gp_size h, gp_pixel_type pixel_type)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(w, h, pixel_type);
+	gp_coord x, y;
+
+	if (!ret)
+		return NULL;
+
+	srandom(42);
+
+	for (y = 0; y < (gp_coord)h; y++) {
+		for (x = 0; x < (gp_coord)w; x++)
+			gp_putpixel_raw(ret, x, y, random());
+	}
+
+	return ret;
+}
+
+static void ref_sums(const gp_pixmap *src, unsigned int chan,
+                     gp_coord x0, gp_coord y0, gp_size w, gp_size h,
+                     uint64_t *sum, uint64_t *sq_sum)
+{
+	const gp_pixel_channel *c = &gp_pixel_desc(src->pixel_type)->channels[chan];
+	gp_coord x, y;
+
+	*sum = 0;
+	*sq_sum = 0;
+
+	for (y = y0; y < y0 + (gp_coord)h; y++) {
+		for (x = x0; x < x0 + (gp_coord)w; x++) {
+			if (x < 0 || y < 0 || x >= (gp_coord)src->w || y >= (gp_coord)src->h)
+				continue;
+
+			gp_pixel pix = gp_getpixel_raw(src, x, y);
+			uint64_t val = (pix >> c->offset) & ((1 << c->size) - 1);
+
+			*sum += val;
+			*sq_sum += val * val;
+		}
+	}
+}
+
+static int check_rects(const gp_pixmap *src, const gp_integral_image *ii)
+{
+	unsigned int i, chan;
+
+	srandom(7);
+
+	for (i = 0; i < 200; i++) {
+		gp_coord x = random() % (src->w + 10) - 5;
+		gp_coord y = random() % (src->h + 10) - 5;
+		gp_size w = random() % src->w + 1;
+		gp_size h = random() % src->h + 1;
+
+		for (chan = 0; chan < ii->chan_cnt; chan++) {
+			uint64_t sum, sq_sum;
+
+			ref_sums(src, chan, x, y, w, h, &sum, &sq_sum);
+
+			if (gp_integral_image_sum(ii, chan, x, y, w, h) != sum) {
+				tst_msg("Wrong sum chan %u rect %i %i %u %u %llu != %llu",
+				        chan, x, y, w, h,
+				        (unsigned long long)gp_integral_image_sum(ii, chan, x, y, w, h),
+				        (unsigned long long)sum);
+				return 1;
+			}
+
+			if (ii->sq_sum[chan] &&
+			    gp_integral_image_sq_sum(ii, chan, x, y, w, h) != sq_sum) {
+				tst_msg("Wrong squared sum chan %u rect %i %i %u %u",
+				        chan, x, y, w, h);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int integral_vs_ref(gp_pixel_type pixel_type, gp_size w, gp_size h, int flags)
+{
+	gp_pixmap *src = random_pixmap(w, h, pixel_type);
+	gp_integral_image *ii;
+	int ret = TST_PASSED;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	ii = gp_filter_integral_image_alloc(src, flags, NULL);
+	if (!ii) {
+		tst_msg("gp_filter_integral_image_alloc() failed %s", tst_strerr(errno));
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	if (check_rects(src, ii))
+		ret = TST_FAILED;
+
+	gp_integral_image_free(ii);
+	gp_pixmap_free(src);
+
+	return ret;
+}
+
+static int integral_rgb888(void)
+{
+	return integral_vs_ref(GP_PIXEL_RGB888, 67, 45, GP_INTEGRAL_SQUARES);
+}
+
+static int integral_rgb888_wide(void)
+{
+	return integral_vs_ref(GP_PIXEL_RGB888, 67, 45, GP_INTEGRAL_SQUARES | GP_INTEGRAL_WIDE);
+}
+
+static int integral_rgb565(void)
+{
+	return integral_vs_ref(GP_PIXEL_RGB565, 31, 80, 0);
+}
+
+static int integral_g1(void)
+{
+	return integral_vs_ref(GP_PIXEL_G1, 77, 13, GP_INTEGRAL_SQUARES);
+}
+
+static int integral_g16_auto_wide(void)
+{
+	gp_integral_image *ii = gp_integral_image_alloc(GP_PIXEL_G16, 300, 300, 0);
+	int ret;
+
+	if (!ii)
+		return TST_FAILED;
+
+	ret = ii->wide ? TST_PASSED : TST_FAILED;
+
+	if (!ii->wide)
+		tst_msg("G16 300x300 sums not 64-bit wide");
+
+	gp_integral_image_free(ii);
+
+	if (ret)
+		return ret;
+
+	return integral_vs_ref(GP_PIXEL_G16, 300, 300, GP_INTEGRAL_SQUARES);
+}
+
+static int progress(gp_progress_cb *self)
+{
+	(void) self;
+	return 0;
+}
+
+static int integral_threads(void)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = 4};
+	gp_pixmap *src = random_pixmap(211, 157, GP_PIXEL_RGBA8888);
+	gp_integral_image *ii1, *ii4;
+	int ret = TST_PASSED;
+	size_t size, i;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	ii1 = gp_filter_integral_image_alloc(src, GP_INTEGRAL_SQUARES, NULL);
+	ii4 = gp_filter_integral_image_alloc(src, GP_INTEGRAL_SQUARES, &callback);
+
+	if (!ii1 || !ii4) {
+		tst_msg("gp_filter_integral_image_alloc() failed");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	size = (size_t)(src->w + 1) * (src->h + 1);
+
+	for (i = 0; i < size; i++) {
+		unsigned int c;
+
+		for (c = 0; c < 4; c++) {
+			if (ii1->sum32[c][i] != ii4->sum32[c][i] ||
+			    ii1->sq_sum[c][i] != ii4->sq_sum[c][i]) {
+				tst_msg("Tables differ at %zu", i);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_integral_image_free(ii1);
+	gp_integral_image_free(ii4);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static unsigned int done_cnt;
+
+static int progress_done(gp_progress_cb *self)
+{
+	if (self->percentage >= 100)
+		done_cnt++;
+
+	return 0;
+}
+
+static int integral_done(unsigned int threads)
+{
+	gp_progress_cb callback = {.callback = progress_done, .threads = threads};
+	gp_pixmap *src = random_pixmap(211, 157, GP_PIXEL_RGB888);
+	gp_integral_image *ii;
+	int ret = TST_PASSED;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	done_cnt = 0;
+
+	ii = gp_filter_integral_image_alloc(src, 0, &callback);
+	if (!ii) {
+		tst_msg("gp_filter_integral_image_alloc() failed");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (done_cnt != 1) {
+		tst_msg("Progress done reported %u times", done_cnt);
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_integral_image_free(ii);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int integral_done_1(void)
+{
+	return integral_done(1);
+}
+
+static int integral_done_4(void)
+{
+	return integral_done(4);
+}
+
+static int integral_mean_variance(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(20, 20, GP_PIXEL_G8);
+	gp_integral_image *ii;
+	int ret = TST_PASSED;
+	float mean, var;
+	gp_coord x, y;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	/* Checkerboard of 0 and 100 */
+	for (y = 0; y < 20; y++) {
+		for (x = 0; x < 20; x++)
+			gp_putpixel_raw(src, x, y, (x + y) % 2 ? 100 : 0);
+	}
+
+	ii = gp_filter_integral_image_alloc(src, GP_INTEGRAL_SQUARES, NULL);
+	if (!ii) {
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	mean = gp_integral_image_mean(ii, 0, 2, 2, 4, 4);
+	var = gp_integral_image_variance(ii, 0, 2, 2, 4, 4);
+
+	if (fabsf(mean - 50) > 0.001 || fabsf(var - 2500) > 0.01) {
+		tst_msg("Wrong mean %f or variance %f", mean, var);
+		ret = TST_FAILED;
+	}
+
+	/* Clipped to a single pixel at 19, 19 = 0 */
+	mean = gp_integral_image_mean(ii, 0, 19, 19, 5, 5);
+	var = gp_integral_image_variance(ii, 0, 19, 19, 5, 5);
+
+	if (mean != 0 || var != 0) {
+		tst_msg("Wrong clipped mean %f or variance %f", mean, var);
+		ret = TST_FAILED;
+	}
+
+	if (gp_integral_image_mean(ii, 0, 20, 0, 5, 5) != 0) {
+		tst_msg("Non-zero mean outside of the image");
+		ret = TST_FAILED;
+	}
+
+	gp_integral_image_free(ii);
+	gp_pixmap_free(src);
+
+	return ret;
+}
+
+static int integral_wrong_size(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(10, 10, GP_PIXEL_G8);
+	gp_integral_image *ii = gp_integral_image_alloc(GP_PIXEL_G8, 10, 11, 0);
+	int ret = TST_PASSED;
+
+	if (!src || !ii) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	errno = 0;
+
+	if (!gp_filter_integral_image(ii, src, NULL)) {
+		tst_msg("Integral image computed for wrong size");
+		ret = TST_FAILED;
+	} else if (errno != EINVAL) {
+		tst_msg("Wrong errno %s", tst_strerr(errno));
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_integral_image_free(ii);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static gp_pixmap *bench_src;
+static gp_integral_image *bench_ii;
+
+static int bench_integral(void)
+{
+	if (!bench_src)
+		bench_src = random_pixmap(1000, 1000, GP_PIXEL_RGB888);
+
+	if (!bench_ii && bench_src)
+		bench_ii = gp_integral_image_alloc(GP_PIXEL_RGB888, 1000, 1000, GP_INTEGRAL_SQUARES);
+
+	if (!bench_ii)
+		return TST_UNTESTED;
+
+	if (gp_filter_integral_image(bench_ii, bench_src, NULL))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Integral image testsuite",
+	.tests = {
+		{.name = "Integral image RGB888",
+		 .tst_fn = integral_rgb888,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Integral image RGB888 64-bit",
+		 .tst_fn = integral_rgb888_wide,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Integral image RGB565",
+		 .tst_fn = integral_rgb565,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Integral image G1",
+		 .tst_fn = integral_g1,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Integral image G16 64-bit",
+		 .tst_fn = integral_g16_auto_wide,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Integral image threads",
+		 .tst_fn = integral_threads},
+
+		{.name = "Integral image progress done",
+		 .tst_fn = integral_done_1},
+
+		{.name = "Integral image progress done threads",
+		 .tst_fn = integral_done_4},
+
+		{.name = "Integral image mean and variance",
+		 .tst_fn = integral_mean_variance,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Integral image wrong size",
+		 .tst_fn = integral_wrong_size,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Integral image RGB888 1000x1000",
+		 .tst_fn = bench_integral,
+		 .bench_iter = 10},
+
+		{},
+	}
+};
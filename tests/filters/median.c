@@ -0,0 +1,327 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <errno.h>
+#include <core/gp_core.h>
+#include <filters/gp_filters.h>
+#include "tst_test.h"
+
+static gp_pixmap *random_pixmap(gp_size w, gp_size h, gp_pixel_type pixel_type)
+{
+	gp_pixmap *ret = gp_pixmap_alloc(w, h, pixel_type);
+	gp_coord x, y;
+
+	if (!ret)
+		return NULL;
+
+	srandom(42);
+
+	for (y = 0; y < (gp_coord)h; y++) {
+		for (x = 0; x < (gp_coord)w; x++)
+			gp_putpixel_raw(ret, x, y, random());
+	}
+
+	return ret;
+}
+
+static int compare(const gp_pixmap *a, const gp_pixmap *b)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)a->h; y++) {
+		for (x = 0; x < (gp_coord)a->w; x++) {
+			gp_pixel pa = gp_getpixel_raw(a, x, y);
+			gp_pixel pb = gp_getpixel_raw(b, x, y);
+
+			if (pa != pb) {
+				tst_msg("Pixels differ at %i %i 0x%08x != 0x%08x",
+				        x, y, pa, pb);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int progress(gp_progress_cb *self)
+{
+	(void) self;
+	return 0;
+}
+
+static int cmp_int(const void *a, const void *b)
+{
+	return *(const int*)a - *(const int*)b;
+}
+
+/*
+ * Brute force median of the G8 pixel neighbourhood with clamped edges.
+ *
+ * The filter returns the first value the histogram accumulates n/2 values
+ * for, which is the value just below the middle one for odd n.
+ */
+static gp_pixel median_ref(const gp_pixmap *src, gp_coord x, gp_coord y,
+                           int xmed, int ymed)
+{
+	int vals[(2 * xmed + 1) * (2 * ymed + 1)];
+	int i, j, n = 0;
+
+	for (j = -ymed; j <= ymed; j++) {
+		for (i = -xmed; i <= xmed; i++) {
+			gp_coord xi = GP_CLAMP(x + i, 0, (gp_coord)src->w - 1);
+			gp_coord yi = GP_CLAMP(y + j, 0, (gp_coord)src->h - 1);
+
+			vals[n++] = gp_getpixel_raw(src, xi, yi);
+		}
+	}
+
+	qsort(vals, n, sizeof(int), cmp_int);
+
+	return vals[n / 2 - 1];
+}
+
+static int median_G8_ref(void)
+{
+	gp_pixmap *src = random_pixmap(64, 48, GP_PIXEL_G8);
+	gp_pixmap *dst;
+	gp_coord x, y;
+	int ret = TST_PASSED;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	dst = gp_filter_median_alloc(src, 2, 3, NULL);
+	if (!dst) {
+		tst_msg("gp_filter_median_alloc() failed %s", tst_strerr(errno));
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel exp = median_ref(src, x, y, 2, 3);
+			gp_pixel pix = gp_getpixel_raw(dst, x, y);
+
+			if (exp != pix) {
+				tst_msg("Wrong median at %i %i %u != %u",
+				        x, y, pix, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+enum filter {
+	MEDIAN,
+	WEIGHTED_MEDIAN,
+	SIGMA,
+};
+
+static gp_pixmap *run_filter(enum filter filter, const gp_pixmap *src,
+                             gp_progress_cb *callback)
+{
+	unsigned int weights[] = {
+		1, 2, 1,
+		2, 4, 2,
+		1, 2, 1,
+	};
+	gp_median_weights w = {.w = 3, .h = 3, .weights = weights};
+
+	switch (filter) {
+	case MEDIAN:
+		return gp_filter_median_alloc(src, 3, 2, callback);
+	case WEIGHTED_MEDIAN:
+		return gp_filter_weighted_median_alloc(src, &w, callback);
+	case SIGMA:
+		return gp_filter_sigma_alloc(src, 2, 2, 5, 0.2, callback);
+	}
+
+	return NULL;
+}
+
+/*
+ * The filters running in vertical strips have to produce exactly the same
+ * results as the single threaded version.
+ */
+static int threads_compare(enum filter filter, gp_pixel_type pixel_type)
+{
+	gp_pixmap *src = random_pixmap(201, 77, pixel_type);
+	gp_progress_cb callback = {.callback = progress, .threads = 4};
+	gp_pixmap *seq = NULL, *par = NULL;
+	int ret = TST_PASSED;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	seq = run_filter(filter, src, NULL);
+	par = run_filter(filter, src, &callback);
+
+	if (!seq || !par) {
+		tst_msg("Filter failed %s", tst_strerr(errno));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (compare(seq, par))
+		ret = TST_FAILED;
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(seq);
+	gp_pixmap_free(par);
+	return ret;
+}
+
+static int median_G8(void)
+{
+	return threads_compare(MEDIAN, GP_PIXEL_G8);
+}
+
+static int median_xRGB8888(void)
+{
+	return threads_compare(MEDIAN, GP_PIXEL_xRGB8888);
+}
+
+static int median_RGBA8888(void)
+{
+	return threads_compare(MEDIAN, GP_PIXEL_RGBA8888);
+}
+
+static int median_RGB565(void)
+{
+	return threads_compare(MEDIAN, GP_PIXEL_RGB565);
+}
+
+static int weighted_median_G8(void)
+{
+	return threads_compare(WEIGHTED_MEDIAN, GP_PIXEL_G8);
+}
+
+static int weighted_median_xRGB8888(void)
+{
+	return threads_compare(WEIGHTED_MEDIAN, GP_PIXEL_xRGB8888);
+}
+
+static int sigma_G8(void)
+{
+	return threads_compare(SIGMA, GP_PIXEL_G8);
+}
+
+static int sigma_RGBA8888(void)
+{
+	return threads_compare(SIGMA, GP_PIXEL_RGBA8888);
+}
+
+static int median_unsupported(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(10, 10, GP_PIXEL_G16);
+	gp_pixmap *dst;
+
+	if (!src)
+		return TST_UNTESTED;
+
+	errno = 0;
+	dst = gp_filter_median_alloc(src, 1, 1, NULL);
+	gp_pixmap_free(src);
+
+	if (dst) {
+		tst_msg("Median succeeded on G16");
+		gp_pixmap_free(dst);
+		return TST_FAILED;
+	}
+
+	if (errno != ENOSYS) {
+		tst_msg("Wrong errno %s", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static gp_pixmap *bench_src;
+
+static int median_bench(unsigned int threads)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = threads};
+	gp_pixmap *dst;
+
+	if (!bench_src)
+		bench_src = random_pixmap(800, 600, GP_PIXEL_xRGB8888);
+
+	if (!bench_src)
+		return TST_UNTESTED;
+
+	dst = gp_filter_median_alloc(bench_src, 5, 5, &callback);
+	if (!dst)
+		return TST_FAILED;
+
+	gp_pixmap_free(dst);
+	return TST_PASSED;
+}
+
+static int median_bench_1(void)
+{
+	return median_bench(1);
+}
+
+static int median_bench_4(void)
+{
+	return median_bench(4);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Median filters testsuite",
+	.tests = {
+		{.name = "Median G8 reference",
+		 .tst_fn = median_G8_ref,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Median G8 threads",
+		 .tst_fn = median_G8},
+
+		{.name = "Median xRGB8888 threads",
+		 .tst_fn = median_xRGB8888},
+
+		{.name = "Median RGBA8888 threads",
+		 .tst_fn = median_RGBA8888},
+
+		{.name = "Median RGB565 threads",
+		 .tst_fn = median_RGB565},
+
+		{.name = "Weighted median G8 threads",
+		 .tst_fn = weighted_median_G8},
+
+		{.name = "Weighted median xRGB8888 threads",
+		 .tst_fn = weighted_median_xRGB8888},
+
+		{.name = "Sigma G8 threads",
+		 .tst_fn = sigma_G8},
+
+		{.name = "Sigma RGBA8888 threads",
+		 .tst_fn = sigma_RGBA8888},
+
+		{.name = "Median G16 unsupported",
+		 .tst_fn = median_unsupported,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Median 11x11 800x600 1 thread",
+		 .tst_fn = median_bench_1,
+		 .bench_iter = 5},
+
+		{.name = "Median 11x11 800x600 4 threads",
+		 .tst_fn = median_bench_4,
+		 .bench_iter = 5},
+
+		{},
+	}
+};
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <errno.h>
+#include <core/gp_core.h>
+#include <filters/gp_filters.h>
+#include "tst_test.h"
+
+static int progress(gp_progress_cb *self)
+{
+	(void) self;
+	return 0;
+}
+
+static void fill_random(gp_pixmap *pixmap)
+{
+	gp_coord x, y;
+
+	srandom(42);
+
+	for (y = 0; y < (gp_coord)pixmap->h; y++) {
+		for (x = 0; x < (gp_coord)pixmap->w; x++)
+			gp_putpixel_raw(pixmap, x, y, random());
+	}
+}
+
+static int compare(const gp_pixmap *a, const gp_pixmap *b)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)a->h; y++) {
+		for (x = 0; x < (gp_coord)a->w; x++) {
+			gp_pixel pa = gp_getpixel_raw(a, x, y);
+			gp_pixel pb = gp_getpixel_raw(b, x, y);
+
+			if (pa != pb) {
+				tst_msg("Pixels differ at %i %i 0x%08x != 0x%08x",
+				        x, y, pa, pb);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Runs the filter on a subrectangle with one and with several threads and
+ * compares the results, also checks that white ends up as the last tone.
+ */
+static int multitone_threads(gp_pixel_type src_type, unsigned int threads)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = threads};
+	gp_progress_cb callback1 = {.callback = progress, .threads = 1};
+	gp_pixmap *src = gp_pixmap_alloc(301, 203, src_type);
+	gp_pixmap *ref = gp_pixmap_alloc(280, 190, GP_PIXEL_RGB888);
+	gp_pixmap *res = gp_pixmap_alloc(280, 190, GP_PIXEL_RGB888);
+	gp_pixel pixels[3];
+	int ret = TST_PASSED;
+
+	if (!src || !ref || !res) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	pixels[0] = gp_rgb_to_pixel(0, 0, 0xff, GP_PIXEL_RGB888);
+	pixels[1] = gp_rgb_to_pixel(0, 0xff, 0, GP_PIXEL_RGB888);
+	pixels[2] = gp_rgb_to_pixel(0xff, 0, 0, GP_PIXEL_RGB888);
+
+	fill_random(src);
+	gp_putpixel_raw(src, 11, 7, (1 << gp_pixel_size(src_type)) - 1);
+
+	if (gp_filter_multitone_ex(src, 11, 7, 280, 190, ref, 0, 0,
+	                           pixels, 3, &callback1)) {
+		tst_msg("Multitone filter failed");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (gp_getpixel_raw(ref, 0, 0) != pixels[2]) {
+		tst_msg("Wrong last tone 0x%08x", gp_getpixel_raw(ref, 0, 0));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (gp_filter_multitone_ex(src, 11, 7, 280, 190, res, 0, 0,
+	                           pixels, 3, &callback)) {
+		tst_msg("Multitone filter %u threads failed", threads);
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (compare(ref, res))
+		ret = TST_FAILED;
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+	gp_pixmap_free(res);
+	return ret;
+}
+
+static int multitone_g8(void)
+{
+	return multitone_threads(GP_PIXEL_G8, 4);
+}
+
+static int multitone_g4(void)
+{
+	return multitone_threads(GP_PIXEL_G4, 3);
+}
+
+static int multitone_invalid(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(10, 10, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(10, 10, GP_PIXEL_RGB888);
+	gp_pixel pixels[2] = {0, 0xffffff};
+	int ret = TST_PASSED;
+
+	if (!src || !dst) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	if (!gp_filter_multitone(src, dst, pixels, 2, NULL)) {
+		tst_msg("Multitone on RGB888 source succeeded");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (errno != EINVAL) {
+		tst_msg("Wrong errno %s", tst_strerr(errno));
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+static int sepia_threads(void)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = 4};
+	gp_progress_cb callback1 = {.callback = progress, .threads = 1};
+	gp_pixmap *src = gp_pixmap_alloc(200, 300, GP_PIXEL_G8);
+	gp_pixmap *ref = NULL, *res = NULL;
+	int ret = TST_PASSED;
+
+	if (!src) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	fill_random(src);
+
+	ref = gp_filter_sepia_alloc(src, GP_PIXEL_RGB888, &callback1);
+	res = gp_filter_sepia_alloc(src, GP_PIXEL_RGB888, &callback);
+
+	if (!ref || !res) {
+		tst_msg("Sepia filter failed");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (compare(ref, res))
+		ret = TST_FAILED;
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+	gp_pixmap_free(res);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Multitone filter testsuite",
+	.tests = {
+		{.name = "Multitone G8 4 threads",
+		 .tst_fn = multitone_g8},
+
+		{.name = "Multitone G4 3 threads",
+		 .tst_fn = multitone_g4},
+
+		{.name = "Multitone invalid source",
+		 .tst_fn = multitone_invalid,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Sepia 4 threads",
+		 .tst_fn = sepia_threads},
+
+		{},
+	}
+};
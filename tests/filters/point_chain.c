@@ -0,0 +1,314 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <errno.h>
+#include <core/gp_core.h>
+#include <filters/gp_filters.h>
+#include "tst_test.h"
+
+static void fill_random(gp_pixmap *pixmap)
+{
+	gp_coord x, y;
+
+	srandom(42);
+
+	for (y = 0; y < (gp_coord)pixmap->h; y++) {
+		for (x = 0; x < (gp_coord)pixmap->w; x++)
+			gp_putpixel_raw(pixmap, x, y, random());
+	}
+}
+
+static void apply_sequential(gp_pixmap *pixmap)
+{
+	gp_filter_brightness(pixmap, pixmap, 0.1, NULL);
+	gp_filter_contrast(pixmap, pixmap, 1.3, NULL);
+	gp_filter_brightness_contrast(pixmap, pixmap, -0.05, 0.9, NULL);
+	gp_filter_posterize(pixmap, pixmap, 8, NULL);
+	gp_filter_invert(pixmap, pixmap, NULL);
+}
+
+static void chain_add(gp_point_chain *chain)
+{
+	gp_point_chain_brightness(chain, 0.1);
+	gp_point_chain_contrast(chain, 1.3);
+	gp_point_chain_brightness_contrast(chain, -0.05, 0.9);
+	gp_point_chain_posterize(chain, 8);
+	gp_point_chain_invert(chain);
+}
+
+static int compare(const gp_pixmap *a, const gp_pixmap *b)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)a->h; y++) {
+		for (x = 0; x < (gp_coord)a->w; x++) {
+			gp_pixel pa = gp_getpixel_raw(a, x, y);
+			gp_pixel pb = gp_getpixel_raw(b, x, y);
+
+			if (pa != pb) {
+				tst_msg("Pixels differ at %i %i 0x%08x != 0x%08x",
+				        x, y, pa, pb);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int chain_vs_sequential(gp_pixel_type pixel_type)
+{
+	gp_pixmap *seq = gp_pixmap_alloc(100, 100, pixel_type);
+	gp_pixmap *fused = gp_pixmap_alloc(100, 100, pixel_type);
+	gp_point_chain chain;
+	int ret = TST_PASSED;
+
+	if (!seq || !fused || gp_point_chain_init(&chain, pixel_type)) {
+		gp_pixmap_free(seq);
+		gp_pixmap_free(fused);
+		return TST_UNTESTED;
+	}
+
+	fill_random(seq);
+	fill_random(fused);
+
+	apply_sequential(seq);
+
+	chain_add(&chain);
+
+	if (gp_point_chain_apply(fused, fused, &chain, NULL)) {
+		tst_msg("gp_point_chain_apply() failed");
+		ret = TST_FAILED;
+	} else if (compare(seq, fused)) {
+		ret = TST_FAILED;
+	}
+
+	gp_point_chain_exit(&chain);
+	gp_pixmap_free(seq);
+	gp_pixmap_free(fused);
+
+	return ret;
+}
+
+static int chain_rgb888(void)
+{
+	return chain_vs_sequential(GP_PIXEL_RGB888);
+}
+
+static int chain_rgb565(void)
+{
+	return chain_vs_sequential(GP_PIXEL_RGB565);
+}
+
+static int chain_rgba8888(void)
+{
+	return chain_vs_sequential(GP_PIXEL_RGBA8888);
+}
+
+static int chain_g4(void)
+{
+	return chain_vs_sequential(GP_PIXEL_G4);
+}
+
+static int chain_reset(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(50, 50, GP_PIXEL_RGB888);
+	gp_pixmap *dst;
+	gp_point_chain chain;
+	int ret = TST_PASSED;
+
+	if (!src || gp_point_chain_init(&chain, GP_PIXEL_RGB888)) {
+		gp_pixmap_free(src);
+		return TST_UNTESTED;
+	}
+
+	fill_random(src);
+
+	chain_add(&chain);
+	gp_point_chain_reset(&chain);
+
+	dst = gp_point_chain_apply_alloc(src, &chain, NULL);
+	if (!dst) {
+		tst_msg("gp_point_chain_apply_alloc() failed");
+		ret = TST_FAILED;
+	} else if (compare(src, dst)) {
+		ret = TST_FAILED;
+	}
+
+	gp_point_chain_exit(&chain);
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+
+	return ret;
+}
+
+static int chain_gamma(void)
+{
+	gp_correction_desc desc = {
+		.corr_type = GP_CORRECTION_TYPE_GAMMA,
+		.gamma = 2.2,
+	};
+	gp_point_chain chain;
+	gp_pixel *table;
+	unsigned int i;
+	int ret = TST_PASSED;
+
+	if (gp_point_chain_init(&chain, GP_PIXEL_G8))
+		return TST_UNTESTED;
+
+	if (gp_point_chain_correction(&chain, &desc, 0)) {
+		tst_msg("gp_point_chain_correction() failed");
+		gp_point_chain_exit(&chain);
+		return TST_FAILED;
+	}
+
+	table = chain.tables.table[0];
+
+	if (table[0] != 0 || table[255] != 255) {
+		tst_msg("Wrong boundary values %u %u", table[0], table[255]);
+		ret = TST_FAILED;
+	}
+
+	/* (128/255)^2.2 * 255 = 56.0 */
+	if (table[128] < 55 || table[128] > 57) {
+		tst_msg("Wrong value for 128 = %u", table[128]);
+		ret = TST_FAILED;
+	}
+
+	for (i = 1; i < 256; i++) {
+		if (table[i] < table[i-1]) {
+			tst_msg("Table not monotonic at %u", i);
+			ret = TST_FAILED;
+			break;
+		}
+	}
+
+	/* Encoding the linearized values gets us back at least in highlights */
+	gp_point_chain_correction(&chain, &desc, 1);
+
+	for (i = 128; i < 256; i++) {
+		if (abs((int)table[i] - (int)i) > 2) {
+			tst_msg("Roundtrip failed for %u = %u", i, table[i]);
+			ret = TST_FAILED;
+			break;
+		}
+	}
+
+	gp_point_chain_exit(&chain);
+
+	return ret;
+}
+
+static int chain_wrong_type(void)
+{
+	gp_pixmap *pixmap = gp_pixmap_alloc(10, 10, GP_PIXEL_RGB565);
+	gp_point_chain chain;
+	int ret = TST_PASSED;
+
+	if (!pixmap || gp_point_chain_init(&chain, GP_PIXEL_RGB888)) {
+		gp_pixmap_free(pixmap);
+		return TST_UNTESTED;
+	}
+
+	errno = 0;
+
+	if (!gp_point_chain_apply(pixmap, pixmap, &chain, NULL)) {
+		tst_msg("Chain applied on a wrong pixel type");
+		ret = TST_FAILED;
+	} else if (errno != EINVAL) {
+		tst_msg("Wrong errno %i", errno);
+		ret = TST_FAILED;
+	}
+
+	gp_point_chain_exit(&chain);
+	gp_pixmap_free(pixmap);
+
+	return ret;
+}
+
+static gp_pixmap *bench_pixmap;
+
+static int bench_init(void)
+{
+	bench_pixmap = gp_pixmap_alloc(1000, 1000, GP_PIXEL_RGB888);
+
+	if (!bench_pixmap)
+		return 1;
+
+	fill_random(bench_pixmap);
+
+	return 0;
+}
+
+static int bench_sequential(void)
+{
+	if (!bench_pixmap && bench_init())
+		return TST_UNTESTED;
+
+	apply_sequential(bench_pixmap);
+
+	return TST_PASSED;
+}
+
+static int bench_chain(void)
+{
+	gp_point_chain chain;
+
+	if (!bench_pixmap && bench_init())
+		return TST_UNTESTED;
+
+	if (gp_point_chain_init(&chain, GP_PIXEL_RGB888))
+		return TST_UNTESTED;
+
+	chain_add(&chain);
+	gp_point_chain_apply(bench_pixmap, bench_pixmap, &chain, NULL);
+	gp_point_chain_exit(&chain);
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Point filter chain testsuite",
+	.tests = {
+		{.name = "Point chain vs sequential RGB888",
+		 .tst_fn = chain_rgb888,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Point chain vs sequential RGB565",
+		 .tst_fn = chain_rgb565,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Point chain vs sequential RGBA8888",
+		 .tst_fn = chain_rgba8888,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Point chain vs sequential G4",
+		 .tst_fn = chain_g4,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Point chain reset",
+		 .tst_fn = chain_reset,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Point chain gamma",
+		 .tst_fn = chain_gamma,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Point chain wrong pixel type",
+		 .tst_fn = chain_wrong_type,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Point filters sequential 1000x1000",
+		 .tst_fn = bench_sequential,
+		 .bench_iter = 10},
+
+		{.name = "Point chain 1000x1000",
+		 .tst_fn = bench_chain,
+		 .bench_iter = 10},
+
+		{},
+	}
+};
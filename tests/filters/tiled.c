@@ -0,0 +1,384 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
+#include <core/gp_core.h>
+#include <filters/gp_filters.h>
+#include "tst_test.h"
+
+static void fill_random(gp_pixmap *pixmap)
+{
+	gp_coord x, y;
+
+	srandom(42);
+
+	for (y = 0; y < (gp_coord)pixmap->h; y++) {
+		for (x = 0; x < (gp_coord)pixmap->w; x++)
+			gp_putpixel_raw(pixmap, x, y, random());
+	}
+}
+
+static int compare(const gp_pixmap *a, const gp_pixmap *b)
+{
+	gp_coord x, y;
+
+	for (y = 0; y < (gp_coord)a->h; y++) {
+		for (x = 0; x < (gp_coord)a->w; x++) {
+			gp_pixel pa = gp_getpixel_raw(a, x, y);
+			gp_pixel pb = gp_getpixel_raw(b, x, y);
+
+			if (pa != pb) {
+				tst_msg("Pixels differ at %i %i 0x%08x != 0x%08x",
+				        x, y, pa, pb);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int progress(gp_progress_cb *self)
+{
+	(void) self;
+	return 0;
+}
+
+static int tiled_vs_whole(const gp_tiled_filter *filter, gp_pixel_type pixel_type,
+                          unsigned int threads)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = threads};
+	gp_pixmap *src = gp_pixmap_alloc(150, 110, pixel_type);
+	gp_pixmap *whole = gp_pixmap_alloc(150, 110, pixel_type);
+	gp_pixmap *tiled = gp_pixmap_alloc(150, 110, pixel_type);
+	gp_tile_src tsrc;
+	gp_tile_sink tsink;
+	int ret = TST_PASSED;
+
+	if (!src || !whole || !tiled) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	fill_random(src);
+
+	if (filter->filter(src, whole, filter, NULL)) {
+		tst_msg("Filter failed %s", tst_strerr(errno));
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_tile_src_pixmap(&tsrc, src);
+	gp_tile_sink_pixmap(&tsink, tiled);
+
+	if (gp_filter_tiled(&tsrc, &tsink, filter, 37, 23, &callback)) {
+		tst_msg("gp_filter_tiled() failed %s", tst_strerr(errno));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (compare(whole, tiled))
+		ret = TST_FAILED;
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(whole);
+	gp_pixmap_free(tiled);
+	return ret;
+}
+
+static int tiled_median(void)
+{
+	gp_tiled_filter filter;
+
+	gp_tiled_filter_median(&filter, 3, 5);
+
+	return tiled_vs_whole(&filter, GP_PIXEL_RGB888, 1);
+}
+
+static int tiled_median_threads(void)
+{
+	gp_tiled_filter filter;
+
+	gp_tiled_filter_median(&filter, 4, 2);
+
+	return tiled_vs_whole(&filter, GP_PIXEL_G8, 4);
+}
+
+static int tiled_blur(void)
+{
+	gp_tiled_filter filter;
+
+	gp_tiled_filter_gaussian_blur(&filter, 2, 1.5);
+
+	return tiled_vs_whole(&filter, GP_PIXEL_RGB888, 3);
+}
+
+#define RAW_IN "tiled_in.raw"
+#define RAW_OUT "tiled_out.raw"
+
+static int tiled_raw(void)
+{
+	gp_pixmap *in, *out, *ref = NULL;
+	gp_tiled_filter filter;
+	gp_tile_src tsrc;
+	gp_tile_sink tsink;
+	int ret = TST_PASSED;
+
+	in = gp_tile_raw_map(RAW_IN, 201, 99, GP_PIXEL_RGB565, GP_TILE_RAW_CREATE);
+	out = gp_tile_raw_map(RAW_OUT, 201, 99, GP_PIXEL_RGB565, GP_TILE_RAW_CREATE);
+
+	if (!in || !out) {
+		tst_msg("gp_tile_raw_map() failed %s", tst_strerr(errno));
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	fill_random(in);
+
+	gp_tiled_filter_median(&filter, 2, 2);
+
+	ref = gp_filter_median_alloc(in, 2, 2, NULL);
+	if (!ref) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_tile_src_pixmap(&tsrc, in);
+	gp_tile_sink_pixmap(&tsink, out);
+
+	if (gp_filter_tiled(&tsrc, &tsink, &filter, 64, 64, NULL)) {
+		tst_msg("gp_filter_tiled() failed %s", tst_strerr(errno));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	/* Map the result again to check that it has been written */
+	gp_tile_raw_unmap(out);
+
+	out = gp_tile_raw_map(RAW_OUT, 201, 99, GP_PIXEL_RGB565, 0);
+	if (!out) {
+		tst_msg("gp_tile_raw_map() failed %s", tst_strerr(errno));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (compare(ref, out))
+		ret = TST_FAILED;
+
+exit:
+	gp_tile_raw_unmap(in);
+	gp_tile_raw_unmap(out);
+	gp_pixmap_free(ref);
+	unlink(RAW_IN);
+	unlink(RAW_OUT);
+	return ret;
+}
+
+static int tiled_raw_short(void)
+{
+	gp_pixmap *in;
+
+	in = gp_tile_raw_map(RAW_IN, 10, 10, GP_PIXEL_G8, GP_TILE_RAW_CREATE);
+	if (!in)
+		return TST_UNTESTED;
+
+	gp_tile_raw_unmap(in);
+
+	errno = 0;
+	in = gp_tile_raw_map(RAW_IN, 10, 11, GP_PIXEL_G8, 0);
+	unlink(RAW_IN);
+
+	if (in) {
+		tst_msg("Mapped file smaller than the image");
+		gp_tile_raw_unmap(in);
+		return TST_FAILED;
+	}
+
+	if (errno != EINVAL) {
+		tst_msg("Wrong errno %s", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int abort_progress(gp_progress_cb *self)
+{
+	return self->percentage > 50;
+}
+
+static int tiled_abort(void)
+{
+	gp_progress_cb callback = {.callback = abort_progress};
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_tiled_filter filter;
+	gp_tile_src tsrc;
+	gp_tile_sink tsink;
+	int ret = TST_PASSED;
+
+	if (!src || !dst) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	gp_tiled_filter_median(&filter, 1, 1);
+	gp_tile_src_pixmap(&tsrc, src);
+	gp_tile_sink_pixmap(&tsink, dst);
+
+	errno = 0;
+
+	if (!gp_filter_tiled(&tsrc, &tsink, &filter, 10, 10, &callback)) {
+		tst_msg("gp_filter_tiled() not aborted");
+		ret = TST_FAILED;
+	} else if (errno != ECANCELED) {
+		tst_msg("Wrong errno %s", tst_strerr(errno));
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+static int nested_threads;
+
+/* Copies the tile and checks that the filter is limited to a single thread */
+static int copy_single_thread(const gp_pixmap *src, gp_pixmap *dst,
+                              const gp_tiled_filter *self,
+                              gp_progress_cb *callback)
+{
+	(void) self;
+
+	if (!callback || callback->threads != 1 || !callback->callback)
+		__atomic_store_n(&nested_threads, 1, __ATOMIC_RELAXED);
+
+	gp_blit_xywh_raw(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	return 0;
+}
+
+static int tiled_single_thread(void)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = 4};
+	gp_pixmap *src = gp_pixmap_alloc(150, 110, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(150, 110, GP_PIXEL_G8);
+	gp_tiled_filter filter = {.filter = copy_single_thread};
+	gp_tile_src tsrc;
+	gp_tile_sink tsink;
+	int ret = TST_PASSED;
+
+	if (!src || !dst) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	fill_random(src);
+
+	gp_tile_src_pixmap(&tsrc, src);
+	gp_tile_sink_pixmap(&tsink, dst);
+
+	if (gp_filter_tiled(&tsrc, &tsink, &filter, 37, 23, &callback)) {
+		tst_msg("gp_filter_tiled() failed %s", tst_strerr(errno));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (nested_threads) {
+		tst_msg("Tile filter not limited to a single thread");
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	if (compare(src, dst))
+		ret = TST_FAILED;
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+static int tiled_nr_threads_default(void)
+{
+	gp_progress_cb callback = {.callback = progress, .threads = 2};
+	gp_pixmap *src = gp_pixmap_alloc(150, 110, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(150, 110, GP_PIXEL_G8);
+	gp_tiled_filter filter;
+	gp_tile_src tsrc;
+	gp_tile_sink tsink;
+	unsigned int nr;
+	int ret = TST_PASSED;
+
+	if (!src || !dst) {
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	unsetenv("GP_THREADS");
+	gp_nr_threads_set(4);
+
+	fill_random(src);
+
+	gp_tiled_filter_median(&filter, 2, 2);
+	gp_tile_src_pixmap(&tsrc, src);
+	gp_tile_sink_pixmap(&tsink, dst);
+
+	if (gp_filter_tiled(&tsrc, &tsink, &filter, 37, 23, &callback)) {
+		tst_msg("gp_filter_tiled() failed %s", tst_strerr(errno));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	nr = gp_nr_threads(1000, 1000, NULL);
+	if (nr != 4) {
+		tst_msg("Default number of threads changed to %u", nr);
+		ret = TST_FAILED;
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Tiled filters testsuite",
+	.tests = {
+		{.name = "Tiled median RGB888",
+		 .tst_fn = tiled_median,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Tiled median G8 threads",
+		 .tst_fn = tiled_median_threads},
+
+		{.name = "Tiled gaussian blur RGB888 threads",
+		 .tst_fn = tiled_blur},
+
+		{.name = "Tiled median raw files",
+		 .tst_fn = tiled_raw,
+		 .flags = TST_TMPDIR},
+
+		{.name = "Tiled raw file too short",
+		 .tst_fn = tiled_raw_short,
+		 .flags = TST_TMPDIR},
+
+		{.name = "Tiled abort",
+		 .tst_fn = tiled_abort,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Tiled filter single thread",
+		 .tst_fn = tiled_single_thread},
+
+		{.name = "Tiled keeps default nr threads",
+		 .tst_fn = tiled_nr_threads_default},
+
+		{},
+	}
+};
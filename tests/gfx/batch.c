@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+ * Checks that batch functions draw exactly the same pixels as the
+ * corresponding single primitive functions.
+ */
+
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <gfx/gp_gfx.h>
+
+#include "tst_test.h"
+
+#define CNT 1000
+
+enum prim {
+	PUTPIXELS,
+	LINES,
+	FILL_RECTS,
+};
+
+static void draw_single(gp_pixmap *pixmap, enum prim prim,
+                        const gp_coord *xy, gp_pixel pixel)
+{
+	unsigned int i;
+
+	for (i = 0; i < CNT; i++) {
+		switch (prim) {
+		case PUTPIXELS:
+			gp_putpixel(pixmap, xy[2*i], xy[2*i+1], pixel);
+		break;
+		case LINES:
+			gp_line(pixmap, xy[4*i], xy[4*i+1],
+			        xy[4*i+2], xy[4*i+3], pixel);
+		break;
+		case FILL_RECTS:
+			gp_fill_rect(pixmap, xy[4*i], xy[4*i+1],
+			             xy[4*i+2], xy[4*i+3], pixel);
+		break;
+		}
+	}
+}
+
+static void draw_batch(gp_pixmap *pixmap, enum prim prim,
+                       const gp_coord *xy, gp_pixel pixel)
+{
+	switch (prim) {
+	case PUTPIXELS:
+		gp_putpixels(pixmap, CNT, xy, pixel);
+	break;
+	case LINES:
+		gp_lines(pixmap, CNT, xy, pixel);
+	break;
+	case FILL_RECTS:
+		gp_fill_rects(pixmap, CNT, xy, pixel);
+	break;
+	}
+}
+
+static int test_batch(enum prim prim, gp_pixel_type pixel_type)
+{
+	gp_pixmap *a = gp_pixmap_alloc(97, 61, pixel_type);
+	gp_pixmap *b = gp_pixmap_alloc(97, 61, pixel_type);
+	gp_coord xy[4 * CNT];
+	unsigned int i, r;
+	int ret = TST_PASSED;
+
+	if (!a || !b) {
+		tst_msg("Malloc failed");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	srand(prim);
+
+	for (i = 0; i < 4 * CNT; i++)
+		xy[i] = rand() % 140 - 20;
+
+	for (r = 0; r < 8; r++) {
+		gp_fill(a, 0);
+		gp_fill(b, 0);
+
+		a->axes_swap = b->axes_swap = !!(r & 1);
+		a->x_swap = b->x_swap = !!(r & 2);
+		a->y_swap = b->y_swap = !!(r & 4);
+
+		draw_single(a, prim, xy, 1);
+		draw_batch(b, prim, xy, 1);
+
+		if (!gp_pixmap_equal(a, b)) {
+			tst_msg("Pixmaps differ for rotation flags %u", r);
+			ret = TST_FAILED;
+		}
+	}
+
+exit:
+	gp_pixmap_free(a);
+	gp_pixmap_free(b);
+	return ret;
+}
+
+static int test_putpixels_G1(void)
+{
+	return test_batch(PUTPIXELS, GP_PIXEL_G1);
+}
+
+static int test_putpixels_RGB888(void)
+{
+	return test_batch(PUTPIXELS, GP_PIXEL_RGB888);
+}
+
+static int test_lines_G4(void)
+{
+	return test_batch(LINES, GP_PIXEL_G4);
+}
+
+static int test_lines_xRGB8888(void)
+{
+	return test_batch(LINES, GP_PIXEL_xRGB8888);
+}
+
+static int test_fill_rects_G2(void)
+{
+	return test_batch(FILL_RECTS, GP_PIXEL_G2);
+}
+
+static int test_fill_rects_RGB565(void)
+{
+	return test_batch(FILL_RECTS, GP_PIXEL_RGB565);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "GFX batch testsuite",
+	.tests = {
+		{.name = "putpixels G1", .tst_fn = test_putpixels_G1},
+		{.name = "putpixels RGB888", .tst_fn = test_putpixels_RGB888},
+		{.name = "lines G4", .tst_fn = test_lines_G4},
+		{.name = "lines xRGB8888", .tst_fn = test_lines_xRGB8888},
+		{.name = "fill_rects G2", .tst_fn = test_fill_rects_G2},
+		{.name = "fill_rects RGB565", .tst_fn = test_fill_rects_RGB565},
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * fill_triangle.gen.c
+ *
+ * GENERATED on 2026 10 19 16:37:47 from fill_triangle.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Copyright (C) 2018 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+
+#include <core/gp_pixmap.h>
+#include <gfx/gp_gfx.h>
+#include <filters/gp_rotate.h>
+
+#include "tst_test.h"
+#include "compare.h"
+
+
+static void prep(gp_pixmap **p1, gp_pixmap **p2, gp_size w, gp_size h)
+{
+	*p1 = gp_pixmap_alloc(w, h, GP_PIXEL_G8);
+	*p2 = gp_pixmap_alloc(w, h, GP_PIXEL_G8);
+
+	gp_fill(*p1, 0);
+	gp_fill(*p2, 0);
+}
+
+static int isosceles_symmetry_2_1(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 1+1);
+
+	gp_fill_triangle(p1, 2/2, 0, 0, 1, 2, 1, 1);
+	gp_fill_triangle(p2, 2/2, 0, 0, 1, 2, 1, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int isosceles_symmetry_2_2(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 2+1, 2+1);
+
+	gp_fill_triangle(p1, 2/2, 0, 0, 2, 2, 2, 1);
+	gp_fill_triangle(p2, 2/2, 0, 0, 2, 2, 2, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int isosceles_symmetry_4_1(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 1+1);
+
+	gp_fill_triangle(p1, 4/2, 0, 0, 1, 4, 1, 1);
+	gp_fill_triangle(p2, 4/2, 0, 0, 1, 4, 1, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int isosceles_symmetry_4_2(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 4+1, 2+1);
+
+	gp_fill_triangle(p1, 4/2, 0, 0, 2, 4, 2, 1);
+	gp_fill_triangle(p2, 4/2, 0, 0, 2, 4, 2, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int isosceles_symmetry_6_1(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 1+1);
+
+	gp_fill_triangle(p1, 6/2, 0, 0, 1, 6, 1, 1);
+	gp_fill_triangle(p2, 6/2, 0, 0, 1, 6, 1, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int isosceles_symmetry_6_2(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 6+1, 2+1);
+
+	gp_fill_triangle(p1, 6/2, 0, 0, 2, 6, 2, 1);
+	gp_fill_triangle(p2, 6/2, 0, 0, 2, 6, 2, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int isosceles_symmetry_8_1(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 1+1);
+
+	gp_fill_triangle(p1, 8/2, 0, 0, 1, 8, 1, 1);
+	gp_fill_triangle(p2, 8/2, 0, 0, 1, 8, 1, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+static int isosceles_symmetry_8_2(void)
+{
+	gp_pixmap *p1, *p2;
+
+	prep(&p1, &p2, 8+1, 2+1);
+
+	gp_fill_triangle(p1, 8/2, 0, 0, 2, 8, 2, 1);
+	gp_fill_triangle(p2, 8/2, 0, 0, 2, 8, 2, 1);
+
+	gp_filter_mirror_h(p2, p2, NULL);
+
+	return compare_pixmaps(p1, p2);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Triangle fill testsuite",
+	.tests = {
+		{.name = "Isosceles symmetry 2, 1",
+		 .tst_fn = isosceles_symmetry_2_1},
+		{.name = "Isosceles symmetry 2, 2",
+		 .tst_fn = isosceles_symmetry_2_2},
+		{.name = "Isosceles symmetry 4, 1",
+		 .tst_fn = isosceles_symmetry_4_1},
+		{.name = "Isosceles symmetry 4, 2",
+		 .tst_fn = isosceles_symmetry_4_2},
+		{.name = "Isosceles symmetry 6, 1",
+		 .tst_fn = isosceles_symmetry_6_1},
+		{.name = "Isosceles symmetry 6, 2",
+		 .tst_fn = isosceles_symmetry_6_2},
+		{.name = "Isosceles symmetry 8, 1",
+		 .tst_fn = isosceles_symmetry_8_1},
+		{.name = "Isosceles symmetry 8, 2",
+		 .tst_fn = isosceles_symmetry_8_2},
+		{.name = NULL}
+	}
+};
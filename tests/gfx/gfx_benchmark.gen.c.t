@@ -1,5 +1,7 @@
 @ include source.t
 
+#include <math.h>
+
 #include <core/gp_pixmap.h>
 #include <gfx/gp_gfx.h>
 
@@ -186,6 +188,113 @@ static int bench_fill_polygon_17(gp_pixel_type type)
 	return TST_PASSED;
 }
 
+static int bench_fill_polygon_1000(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+	gp_coord poly[2 * 1000];
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i, j;
+
+	for (i = 0; i < 20; i++) {
+		for (j = 0; j < 1000; j++) {
+			float r = j % 2 ? 490 : 100 + 20 * i;
+
+			poly[2*j] = 500 + r * cos(2 * M_PI * j / 1000);
+			poly[2*j+1] = 500 + r * sin(2 * M_PI * j / 1000);
+		}
+
+		gp_fill_polygon(img, 0, 0, 1000, poly, i%0xff);
+	}
+
+	return TST_PASSED;
+}
+
+static int bench_fill_polygons_100(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+	unsigned int vertex_counts[100];
+	gp_coord poly[2 * 4 * 100];
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i, j;
+
+	for (i = 0; i < 100; i++) {
+		gp_coord x = 100 * (i % 10);
+		gp_coord y = 100 * (i / 10);
+
+		vertex_counts[i] = 4;
+
+		poly[8*i+0] = x;
+		poly[8*i+1] = y;
+		poly[8*i+2] = x + 90;
+		poly[8*i+3] = y + 10;
+		poly[8*i+4] = x + 99;
+		poly[8*i+5] = y + 99;
+		poly[8*i+6] = x + 10;
+		poly[8*i+7] = y + 90;
+	}
+
+	for (j = 0; j < 100; j++)
+		gp_fill_polygons(img, 0, 0, 100, vertex_counts, poly, GP_FILL_EVEN_ODD, j%0xff);
+
+	return TST_PASSED;
+}
+
+static int bench_putpixels(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+	static gp_coord xy[2 * 100000];
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 2 * 100000; i++)
+		xy[i] = (i * 7919) % 1100 - 50;
+
+	for (i = 0; i < 10; i++)
+		gp_putpixels(img, 100000, xy, i%0xff);
+
+	return TST_PASSED;
+}
+
+static int bench_fill_rects(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+	static gp_coord xyxy[4 * 10000];
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 10000; i++) {
+		xyxy[4*i] = (i * 7919) % 1000;
+		xyxy[4*i+1] = (i * 104729) % 1000;
+		xyxy[4*i+2] = xyxy[4*i] + 8;
+		xyxy[4*i+3] = xyxy[4*i+1] + 8;
+	}
+
+	for (i = 0; i < 10; i++)
+		gp_fill_rects(img, 10000, xyxy, i%0xff);
+
+	return TST_PASSED;
+}
+
 @ bpps = [["1BPP", "GP_PIXEL_G1"],
 @         ["2BPP", "GP_PIXEL_G2"],
 @         ["4BPP", "GP_PIXEL_G4"],
@@ -194,7 +303,8 @@ static int bench_fill_polygon_17(gp_pixel_type type)
 @         ["24BPP", "GP_PIXEL_RGB888"],
 @         ["32BPP", "GP_PIXEL_xRGB8888"]]
 @
-@ prims = ["line", "line_th", "circle", "circle_seg", "fill_circle", "fill_polygon_4", "fill_polygon_9", "fill_polygon_17"]
+@ prims = ["line", "line_th", "circle", "circle_seg", "fill_circle", "fill_polygon_4", "fill_polygon_9", "fill_polygon_17",
+@          "fill_polygon_1000", "fill_polygons_100", "putpixels", "fill_rects"]
 @
 @ def bench(prim, bpp, pixel_type):
 static int bench_{{ prim }}_{{ bpp }}(void)
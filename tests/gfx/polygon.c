@@ -455,6 +455,142 @@ struct testcase testcase_cross_6 = {
 };
 
 
+struct testcase_multi {
+	/* polygons description */
+	unsigned int poly_count;
+	unsigned int vertex_counts[8];
+	enum gp_fill_rule rule;
+	gp_coord edges[64];
+
+	/* expected result */
+	gp_size w, h;
+	const char pixmap[];
+};
+
+static int test_polygons(struct testcase_multi *t)
+{
+	gp_pixmap *c;
+	int err;
+
+	c = pixmap_alloc_canary(t->w, t->h, GP_PIXEL_G8);
+
+	if (!c) {
+		tst_err("Failed to allocate pixmap");
+		return TST_UNTESTED;
+	}
+
+	/* zero the pixels buffer */
+	memset(c->pixels, 0, c->w * c->h);
+
+	gp_fill_polygons(c, 0, 0, t->poly_count, t->vertex_counts,
+	                 t->edges, t->rule, 1);
+
+	err = compare_buffers(t->pixmap, c) || check_canary(c);
+
+	if (err) {
+		tst_msg("Patterns are different");
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+struct testcase_multi testcase_hole_even_odd = {
+	.poly_count = 2,
+	.vertex_counts = {4, 4},
+	.rule = GP_FILL_EVEN_ODD,
+	.edges = {
+		1, 1, 8, 1, 8, 8, 1, 8,
+		3, 3, 6, 3, 6, 6, 3, 6,
+	},
+	.w = 10,
+	.h = 10,
+	.pixmap = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 0, 0, 1, 1, 1, 0,
+		0, 1, 1, 1, 0, 0, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	}
+};
+
+struct testcase_multi testcase_nested_non_zero = {
+	.poly_count = 2,
+	.vertex_counts = {4, 4},
+	.rule = GP_FILL_NON_ZERO,
+	.edges = {
+		1, 1, 8, 1, 8, 8, 1, 8,
+		3, 3, 6, 3, 6, 6, 3, 6,
+	},
+	.w = 10,
+	.h = 10,
+	.pixmap = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	}
+};
+
+struct testcase_multi testcase_hole_non_zero = {
+	.poly_count = 2,
+	.vertex_counts = {4, 4},
+	.rule = GP_FILL_NON_ZERO,
+	.edges = {
+		1, 1, 8, 1, 8, 8, 1, 8,
+		3, 3, 3, 6, 6, 6, 6, 3,
+	},
+	.w = 10,
+	.h = 10,
+	.pixmap = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 0, 0, 1, 1, 1, 0,
+		0, 1, 1, 1, 0, 0, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	}
+};
+
+struct testcase_multi testcase_disjoint = {
+	.poly_count = 2,
+	.vertex_counts = {3, 3},
+	.rule = GP_FILL_EVEN_ODD,
+	.edges = {
+		1, 1, 3, 1, 3, 3,
+		6, 6, 8, 6, 8, 8,
+	},
+	.w = 10,
+	.h = 10,
+	.pixmap = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	}
+};
+
 const struct tst_suite tst_suite = {
 	.suite_name = "Polygon Testsuite",
 	.tests = {
@@ -534,6 +670,22 @@ const struct tst_suite tst_suite = {
 		 .tst_fn = test_polygon,
 		 .data = &testcase_cross_6},
 
+		{.name = "Square with a hole even-odd",
+		 .tst_fn = test_polygons,
+		 .data = &testcase_hole_even_odd},
+
+		{.name = "Nested squares non-zero",
+		 .tst_fn = test_polygons,
+		 .data = &testcase_nested_non_zero},
+
+		{.name = "Square with a hole non-zero",
+		 .tst_fn = test_polygons,
+		 .data = &testcase_hole_non_zero},
+
+		{.name = "Two disjoint triangles",
+		 .tst_fn = test_polygons,
+		 .data = &testcase_disjoint},
+
 		{.name = NULL}
 	}
 };
@@ -0,0 +1,1751 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * save_load.gen.c
+ *
+ * GENERATED on 2026 10 19 16:37:43 from save_load.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Iterate over all pixel types, try to save and load back pixmap.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <loaders/gp_loaders.h>
+
+#include "tst_test.h"
+
+typedef int (*Save)(const gp_pixmap *src, const char *path, gp_progress_cb *callback);
+typedef gp_pixmap *(*Load)(const char *path, gp_progress_cb *callback);
+
+static int test(Save Saver, Load Loader, gp_pixel_type pixel_type)
+{
+	gp_pixmap *src;
+	gp_pixmap *res;
+	unsigned int x, y;
+	int ret = TST_PASSED;
+
+	src = gp_pixmap_alloc(100, 100, pixel_type);
+
+	if (!src) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	for (x = 0; x < src->w; x++)
+		for (y = 0; y < src->w; y++)
+			gp_putpixel(src, x, y, 0);
+
+	if (Saver(src, "testfile", NULL)) {
+		if (errno == ENOSYS) {
+			tst_msg("Unimplemented pixel value");
+			ret = TST_SKIPPED;
+			goto err;
+		}
+
+		if (errno == EINVAL) {
+			tst_msg("Invalid pixel value for the format");
+			ret = TST_SKIPPED;
+			goto err;
+		}
+
+		tst_msg("Saver failed with %s", strerror(errno));
+		ret = TST_FAILED;
+		goto err;
+	}
+
+	res = Loader("testfile", NULL);
+
+	if (!res) {
+		tst_msg("Failed to load saved image");
+		ret = TST_FAILED;
+		goto err;
+	}
+
+	tst_msg("Loaded back as %s", gp_pixel_type_name(res->pixel_type));
+
+	if (res->w != src->w || res->h != src->h) {
+		tst_msg("Invalid loaded image size %ux%u", res->w, res->h);
+		ret = TST_FAILED;
+	}
+
+	if (gp_getpixel(res, 0, 0) != 0) {
+		tst_msg("Pixel value is wrong %x", gp_getpixel(res, 0, 0));
+		ret = TST_FAILED;
+	}
+
+	gp_pixmap_free(res);
+err:
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int test_png_RGB101010(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_RGB101010);
+}
+
+static int test_png_xRGB8888(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_xRGB8888);
+}
+
+static int test_png_RGBA8888(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_RGBA8888);
+}
+
+static int test_png_RGB888(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_RGB888);
+}
+
+static int test_png_BGR888(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_BGR888);
+}
+
+static int test_png_RGB555(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_RGB555);
+}
+
+static int test_png_RGB565_BE(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_RGB565_BE);
+}
+
+static int test_png_RGB565_LE(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_RGB565_LE);
+}
+
+static int test_png_RGB666(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_RGB666);
+}
+
+static int test_png_RGB332(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_RGB332);
+}
+
+static int test_png_CMYK8888(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_CMYK8888);
+}
+
+static int test_png_P2(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_P2);
+}
+
+static int test_png_P4(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_P4);
+}
+
+static int test_png_P8(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_P8);
+}
+
+static int test_png_G1_DB(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_G1_DB);
+}
+
+static int test_png_G2_DB(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_G2_DB);
+}
+
+static int test_png_G4_DB(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_G4_DB);
+}
+
+static int test_png_G1_UB(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_G1_UB);
+}
+
+static int test_png_G2_UB(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_G2_UB);
+}
+
+static int test_png_G4_UB(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_G4_UB);
+}
+
+static int test_png_G8(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_G8);
+}
+
+static int test_png_GA88(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_GA88);
+}
+
+static int test_png_G16(void)
+{
+	return test(gp_save_png, gp_load_png, GP_PIXEL_G16);
+}
+
+static int test_jpg_RGB101010(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_RGB101010);
+}
+
+static int test_jpg_xRGB8888(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_xRGB8888);
+}
+
+static int test_jpg_RGBA8888(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_RGBA8888);
+}
+
+static int test_jpg_RGB888(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_RGB888);
+}
+
+static int test_jpg_BGR888(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_BGR888);
+}
+
+static int test_jpg_RGB555(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_RGB555);
+}
+
+static int test_jpg_RGB565_BE(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_RGB565_BE);
+}
+
+static int test_jpg_RGB565_LE(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_RGB565_LE);
+}
+
+static int test_jpg_RGB666(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_RGB666);
+}
+
+static int test_jpg_RGB332(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_RGB332);
+}
+
+static int test_jpg_CMYK8888(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_CMYK8888);
+}
+
+static int test_jpg_P2(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_P2);
+}
+
+static int test_jpg_P4(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_P4);
+}
+
+static int test_jpg_P8(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_P8);
+}
+
+static int test_jpg_G1_DB(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_G1_DB);
+}
+
+static int test_jpg_G2_DB(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_G2_DB);
+}
+
+static int test_jpg_G4_DB(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_G4_DB);
+}
+
+static int test_jpg_G1_UB(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_G1_UB);
+}
+
+static int test_jpg_G2_UB(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_G2_UB);
+}
+
+static int test_jpg_G4_UB(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_G4_UB);
+}
+
+static int test_jpg_G8(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_G8);
+}
+
+static int test_jpg_GA88(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_GA88);
+}
+
+static int test_jpg_G16(void)
+{
+	return test(gp_save_jpg, gp_load_jpg, GP_PIXEL_G16);
+}
+
+static int test_tiff_RGB101010(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_RGB101010);
+}
+
+static int test_tiff_xRGB8888(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_xRGB8888);
+}
+
+static int test_tiff_RGBA8888(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_RGBA8888);
+}
+
+static int test_tiff_RGB888(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_RGB888);
+}
+
+static int test_tiff_BGR888(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_BGR888);
+}
+
+static int test_tiff_RGB555(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_RGB555);
+}
+
+static int test_tiff_RGB565_BE(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_RGB565_BE);
+}
+
+static int test_tiff_RGB565_LE(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_RGB565_LE);
+}
+
+static int test_tiff_RGB666(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_RGB666);
+}
+
+static int test_tiff_RGB332(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_RGB332);
+}
+
+static int test_tiff_CMYK8888(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_CMYK8888);
+}
+
+static int test_tiff_P2(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_P2);
+}
+
+static int test_tiff_P4(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_P4);
+}
+
+static int test_tiff_P8(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_P8);
+}
+
+static int test_tiff_G1_DB(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_G1_DB);
+}
+
+static int test_tiff_G2_DB(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_G2_DB);
+}
+
+static int test_tiff_G4_DB(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_G4_DB);
+}
+
+static int test_tiff_G1_UB(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_G1_UB);
+}
+
+static int test_tiff_G2_UB(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_G2_UB);
+}
+
+static int test_tiff_G4_UB(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_G4_UB);
+}
+
+static int test_tiff_G8(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_G8);
+}
+
+static int test_tiff_GA88(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_GA88);
+}
+
+static int test_tiff_G16(void)
+{
+	return test(gp_save_tiff, gp_load_tiff, GP_PIXEL_G16);
+}
+
+static int test_bmp_RGB101010(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_RGB101010);
+}
+
+static int test_bmp_xRGB8888(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_xRGB8888);
+}
+
+static int test_bmp_RGBA8888(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_RGBA8888);
+}
+
+static int test_bmp_RGB888(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_RGB888);
+}
+
+static int test_bmp_BGR888(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_BGR888);
+}
+
+static int test_bmp_RGB555(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_RGB555);
+}
+
+static int test_bmp_RGB565_BE(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_RGB565_BE);
+}
+
+static int test_bmp_RGB565_LE(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_RGB565_LE);
+}
+
+static int test_bmp_RGB666(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_RGB666);
+}
+
+static int test_bmp_RGB332(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_RGB332);
+}
+
+static int test_bmp_CMYK8888(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_CMYK8888);
+}
+
+static int test_bmp_P2(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_P2);
+}
+
+static int test_bmp_P4(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_P4);
+}
+
+static int test_bmp_P8(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_P8);
+}
+
+static int test_bmp_G1_DB(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_G1_DB);
+}
+
+static int test_bmp_G2_DB(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_G2_DB);
+}
+
+static int test_bmp_G4_DB(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_G4_DB);
+}
+
+static int test_bmp_G1_UB(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_G1_UB);
+}
+
+static int test_bmp_G2_UB(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_G2_UB);
+}
+
+static int test_bmp_G4_UB(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_G4_UB);
+}
+
+static int test_bmp_G8(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_G8);
+}
+
+static int test_bmp_GA88(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_GA88);
+}
+
+static int test_bmp_G16(void)
+{
+	return test(gp_save_bmp, gp_load_bmp, GP_PIXEL_G16);
+}
+
+static int test_pbm_RGB101010(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_RGB101010);
+}
+
+static int test_pbm_xRGB8888(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_xRGB8888);
+}
+
+static int test_pbm_RGBA8888(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_RGBA8888);
+}
+
+static int test_pbm_RGB888(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_RGB888);
+}
+
+static int test_pbm_BGR888(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_BGR888);
+}
+
+static int test_pbm_RGB555(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_RGB555);
+}
+
+static int test_pbm_RGB565_BE(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_RGB565_BE);
+}
+
+static int test_pbm_RGB565_LE(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_RGB565_LE);
+}
+
+static int test_pbm_RGB666(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_RGB666);
+}
+
+static int test_pbm_RGB332(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_RGB332);
+}
+
+static int test_pbm_CMYK8888(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_CMYK8888);
+}
+
+static int test_pbm_P2(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_P2);
+}
+
+static int test_pbm_P4(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_P4);
+}
+
+static int test_pbm_P8(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_P8);
+}
+
+static int test_pbm_G1_DB(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_G1_DB);
+}
+
+static int test_pbm_G2_DB(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_G2_DB);
+}
+
+static int test_pbm_G4_DB(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_G4_DB);
+}
+
+static int test_pbm_G1_UB(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_G1_UB);
+}
+
+static int test_pbm_G2_UB(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_G2_UB);
+}
+
+static int test_pbm_G4_UB(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_G4_UB);
+}
+
+static int test_pbm_G8(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_G8);
+}
+
+static int test_pbm_GA88(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_GA88);
+}
+
+static int test_pbm_G16(void)
+{
+	return test(gp_save_pbm, gp_load_pbm, GP_PIXEL_G16);
+}
+
+static int test_pgm_RGB101010(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_RGB101010);
+}
+
+static int test_pgm_xRGB8888(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_xRGB8888);
+}
+
+static int test_pgm_RGBA8888(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_RGBA8888);
+}
+
+static int test_pgm_RGB888(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_RGB888);
+}
+
+static int test_pgm_BGR888(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_BGR888);
+}
+
+static int test_pgm_RGB555(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_RGB555);
+}
+
+static int test_pgm_RGB565_BE(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_RGB565_BE);
+}
+
+static int test_pgm_RGB565_LE(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_RGB565_LE);
+}
+
+static int test_pgm_RGB666(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_RGB666);
+}
+
+static int test_pgm_RGB332(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_RGB332);
+}
+
+static int test_pgm_CMYK8888(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_CMYK8888);
+}
+
+static int test_pgm_P2(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_P2);
+}
+
+static int test_pgm_P4(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_P4);
+}
+
+static int test_pgm_P8(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_P8);
+}
+
+static int test_pgm_G1_DB(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_G1_DB);
+}
+
+static int test_pgm_G2_DB(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_G2_DB);
+}
+
+static int test_pgm_G4_DB(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_G4_DB);
+}
+
+static int test_pgm_G1_UB(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_G1_UB);
+}
+
+static int test_pgm_G2_UB(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_G2_UB);
+}
+
+static int test_pgm_G4_UB(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_G4_UB);
+}
+
+static int test_pgm_G8(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_G8);
+}
+
+static int test_pgm_GA88(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_GA88);
+}
+
+static int test_pgm_G16(void)
+{
+	return test(gp_save_pgm, gp_load_pgm, GP_PIXEL_G16);
+}
+
+static int test_ppm_RGB101010(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_RGB101010);
+}
+
+static int test_ppm_xRGB8888(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_xRGB8888);
+}
+
+static int test_ppm_RGBA8888(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_RGBA8888);
+}
+
+static int test_ppm_RGB888(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_RGB888);
+}
+
+static int test_ppm_BGR888(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_BGR888);
+}
+
+static int test_ppm_RGB555(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_RGB555);
+}
+
+static int test_ppm_RGB565_BE(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_RGB565_BE);
+}
+
+static int test_ppm_RGB565_LE(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_RGB565_LE);
+}
+
+static int test_ppm_RGB666(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_RGB666);
+}
+
+static int test_ppm_RGB332(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_RGB332);
+}
+
+static int test_ppm_CMYK8888(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_CMYK8888);
+}
+
+static int test_ppm_P2(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_P2);
+}
+
+static int test_ppm_P4(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_P4);
+}
+
+static int test_ppm_P8(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_P8);
+}
+
+static int test_ppm_G1_DB(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_G1_DB);
+}
+
+static int test_ppm_G2_DB(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_G2_DB);
+}
+
+static int test_ppm_G4_DB(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_G4_DB);
+}
+
+static int test_ppm_G1_UB(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_G1_UB);
+}
+
+static int test_ppm_G2_UB(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_G2_UB);
+}
+
+static int test_ppm_G4_UB(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_G4_UB);
+}
+
+static int test_ppm_G8(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_G8);
+}
+
+static int test_ppm_GA88(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_GA88);
+}
+
+static int test_ppm_G16(void)
+{
+	return test(gp_save_ppm, gp_load_ppm, GP_PIXEL_G16);
+}
+
+static int test_pnm_RGB101010(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_RGB101010);
+}
+
+static int test_pnm_xRGB8888(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_xRGB8888);
+}
+
+static int test_pnm_RGBA8888(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_RGBA8888);
+}
+
+static int test_pnm_RGB888(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_RGB888);
+}
+
+static int test_pnm_BGR888(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_BGR888);
+}
+
+static int test_pnm_RGB555(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_RGB555);
+}
+
+static int test_pnm_RGB565_BE(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_RGB565_BE);
+}
+
+static int test_pnm_RGB565_LE(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_RGB565_LE);
+}
+
+static int test_pnm_RGB666(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_RGB666);
+}
+
+static int test_pnm_RGB332(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_RGB332);
+}
+
+static int test_pnm_CMYK8888(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_CMYK8888);
+}
+
+static int test_pnm_P2(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_P2);
+}
+
+static int test_pnm_P4(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_P4);
+}
+
+static int test_pnm_P8(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_P8);
+}
+
+static int test_pnm_G1_DB(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_G1_DB);
+}
+
+static int test_pnm_G2_DB(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_G2_DB);
+}
+
+static int test_pnm_G4_DB(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_G4_DB);
+}
+
+static int test_pnm_G1_UB(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_G1_UB);
+}
+
+static int test_pnm_G2_UB(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_G2_UB);
+}
+
+static int test_pnm_G4_UB(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_G4_UB);
+}
+
+static int test_pnm_G8(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_G8);
+}
+
+static int test_pnm_GA88(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_GA88);
+}
+
+static int test_pnm_G16(void)
+{
+	return test(gp_save_pnm, gp_load_pnm, GP_PIXEL_G16);
+}
+
+static int test_webp_RGB101010(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_RGB101010);
+}
+
+static int test_webp_xRGB8888(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_xRGB8888);
+}
+
+static int test_webp_RGBA8888(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_RGBA8888);
+}
+
+static int test_webp_RGB888(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_RGB888);
+}
+
+static int test_webp_BGR888(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_BGR888);
+}
+
+static int test_webp_RGB555(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_RGB555);
+}
+
+static int test_webp_RGB565_BE(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_RGB565_BE);
+}
+
+static int test_webp_RGB565_LE(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_RGB565_LE);
+}
+
+static int test_webp_RGB666(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_RGB666);
+}
+
+static int test_webp_RGB332(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_RGB332);
+}
+
+static int test_webp_CMYK8888(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_CMYK8888);
+}
+
+static int test_webp_P2(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_P2);
+}
+
+static int test_webp_P4(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_P4);
+}
+
+static int test_webp_P8(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_P8);
+}
+
+static int test_webp_G1_DB(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_G1_DB);
+}
+
+static int test_webp_G2_DB(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_G2_DB);
+}
+
+static int test_webp_G4_DB(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_G4_DB);
+}
+
+static int test_webp_G1_UB(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_G1_UB);
+}
+
+static int test_webp_G2_UB(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_G2_UB);
+}
+
+static int test_webp_G4_UB(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_G4_UB);
+}
+
+static int test_webp_G8(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_G8);
+}
+
+static int test_webp_GA88(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_GA88);
+}
+
+static int test_webp_G16(void)
+{
+	return test(gp_save_webp, gp_load_webp, GP_PIXEL_G16);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "SaveLoad",
+	.tests = {
+		{.name = "png RGB101010",
+		 .tst_fn = test_png_RGB101010,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png xRGB8888",
+		 .tst_fn = test_png_xRGB8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png RGBA8888",
+		 .tst_fn = test_png_RGBA8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png RGB888",
+		 .tst_fn = test_png_RGB888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png BGR888",
+		 .tst_fn = test_png_BGR888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png RGB555",
+		 .tst_fn = test_png_RGB555,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png RGB565_BE",
+		 .tst_fn = test_png_RGB565_BE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png RGB565_LE",
+		 .tst_fn = test_png_RGB565_LE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png RGB666",
+		 .tst_fn = test_png_RGB666,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png RGB332",
+		 .tst_fn = test_png_RGB332,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png CMYK8888",
+		 .tst_fn = test_png_CMYK8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png P2",
+		 .tst_fn = test_png_P2,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png P4",
+		 .tst_fn = test_png_P4,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png P8",
+		 .tst_fn = test_png_P8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png G1_DB",
+		 .tst_fn = test_png_G1_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png G2_DB",
+		 .tst_fn = test_png_G2_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png G4_DB",
+		 .tst_fn = test_png_G4_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png G1_UB",
+		 .tst_fn = test_png_G1_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png G2_UB",
+		 .tst_fn = test_png_G2_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png G4_UB",
+		 .tst_fn = test_png_G4_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png G8",
+		 .tst_fn = test_png_G8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png GA88",
+		 .tst_fn = test_png_GA88,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "png G16",
+		 .tst_fn = test_png_G16,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg RGB101010",
+		 .tst_fn = test_jpg_RGB101010,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg xRGB8888",
+		 .tst_fn = test_jpg_xRGB8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg RGBA8888",
+		 .tst_fn = test_jpg_RGBA8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg RGB888",
+		 .tst_fn = test_jpg_RGB888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg BGR888",
+		 .tst_fn = test_jpg_BGR888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg RGB555",
+		 .tst_fn = test_jpg_RGB555,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg RGB565_BE",
+		 .tst_fn = test_jpg_RGB565_BE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg RGB565_LE",
+		 .tst_fn = test_jpg_RGB565_LE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg RGB666",
+		 .tst_fn = test_jpg_RGB666,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg RGB332",
+		 .tst_fn = test_jpg_RGB332,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg CMYK8888",
+		 .tst_fn = test_jpg_CMYK8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg P2",
+		 .tst_fn = test_jpg_P2,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg P4",
+		 .tst_fn = test_jpg_P4,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg P8",
+		 .tst_fn = test_jpg_P8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg G1_DB",
+		 .tst_fn = test_jpg_G1_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg G2_DB",
+		 .tst_fn = test_jpg_G2_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg G4_DB",
+		 .tst_fn = test_jpg_G4_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg G1_UB",
+		 .tst_fn = test_jpg_G1_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg G2_UB",
+		 .tst_fn = test_jpg_G2_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg G4_UB",
+		 .tst_fn = test_jpg_G4_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg G8",
+		 .tst_fn = test_jpg_G8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg GA88",
+		 .tst_fn = test_jpg_GA88,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "jpg G16",
+		 .tst_fn = test_jpg_G16,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff RGB101010",
+		 .tst_fn = test_tiff_RGB101010,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff xRGB8888",
+		 .tst_fn = test_tiff_xRGB8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff RGBA8888",
+		 .tst_fn = test_tiff_RGBA8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff RGB888",
+		 .tst_fn = test_tiff_RGB888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff BGR888",
+		 .tst_fn = test_tiff_BGR888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff RGB555",
+		 .tst_fn = test_tiff_RGB555,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff RGB565_BE",
+		 .tst_fn = test_tiff_RGB565_BE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff RGB565_LE",
+		 .tst_fn = test_tiff_RGB565_LE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff RGB666",
+		 .tst_fn = test_tiff_RGB666,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff RGB332",
+		 .tst_fn = test_tiff_RGB332,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff CMYK8888",
+		 .tst_fn = test_tiff_CMYK8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff P2",
+		 .tst_fn = test_tiff_P2,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff P4",
+		 .tst_fn = test_tiff_P4,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff P8",
+		 .tst_fn = test_tiff_P8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff G1_DB",
+		 .tst_fn = test_tiff_G1_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff G2_DB",
+		 .tst_fn = test_tiff_G2_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff G4_DB",
+		 .tst_fn = test_tiff_G4_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff G1_UB",
+		 .tst_fn = test_tiff_G1_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff G2_UB",
+		 .tst_fn = test_tiff_G2_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff G4_UB",
+		 .tst_fn = test_tiff_G4_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff G8",
+		 .tst_fn = test_tiff_G8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff GA88",
+		 .tst_fn = test_tiff_GA88,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "tiff G16",
+		 .tst_fn = test_tiff_G16,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp RGB101010",
+		 .tst_fn = test_bmp_RGB101010,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp xRGB8888",
+		 .tst_fn = test_bmp_xRGB8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp RGBA8888",
+		 .tst_fn = test_bmp_RGBA8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp RGB888",
+		 .tst_fn = test_bmp_RGB888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp BGR888",
+		 .tst_fn = test_bmp_BGR888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp RGB555",
+		 .tst_fn = test_bmp_RGB555,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp RGB565_BE",
+		 .tst_fn = test_bmp_RGB565_BE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp RGB565_LE",
+		 .tst_fn = test_bmp_RGB565_LE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp RGB666",
+		 .tst_fn = test_bmp_RGB666,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp RGB332",
+		 .tst_fn = test_bmp_RGB332,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp CMYK8888",
+		 .tst_fn = test_bmp_CMYK8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp P2",
+		 .tst_fn = test_bmp_P2,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp P4",
+		 .tst_fn = test_bmp_P4,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp P8",
+		 .tst_fn = test_bmp_P8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp G1_DB",
+		 .tst_fn = test_bmp_G1_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp G2_DB",
+		 .tst_fn = test_bmp_G2_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp G4_DB",
+		 .tst_fn = test_bmp_G4_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp G1_UB",
+		 .tst_fn = test_bmp_G1_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp G2_UB",
+		 .tst_fn = test_bmp_G2_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp G4_UB",
+		 .tst_fn = test_bmp_G4_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp G8",
+		 .tst_fn = test_bmp_G8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp GA88",
+		 .tst_fn = test_bmp_GA88,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "bmp G16",
+		 .tst_fn = test_bmp_G16,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm RGB101010",
+		 .tst_fn = test_pbm_RGB101010,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm xRGB8888",
+		 .tst_fn = test_pbm_xRGB8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm RGBA8888",
+		 .tst_fn = test_pbm_RGBA8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm RGB888",
+		 .tst_fn = test_pbm_RGB888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm BGR888",
+		 .tst_fn = test_pbm_BGR888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm RGB555",
+		 .tst_fn = test_pbm_RGB555,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm RGB565_BE",
+		 .tst_fn = test_pbm_RGB565_BE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm RGB565_LE",
+		 .tst_fn = test_pbm_RGB565_LE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm RGB666",
+		 .tst_fn = test_pbm_RGB666,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm RGB332",
+		 .tst_fn = test_pbm_RGB332,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm CMYK8888",
+		 .tst_fn = test_pbm_CMYK8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm P2",
+		 .tst_fn = test_pbm_P2,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm P4",
+		 .tst_fn = test_pbm_P4,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm P8",
+		 .tst_fn = test_pbm_P8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm G1_DB",
+		 .tst_fn = test_pbm_G1_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm G2_DB",
+		 .tst_fn = test_pbm_G2_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm G4_DB",
+		 .tst_fn = test_pbm_G4_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm G1_UB",
+		 .tst_fn = test_pbm_G1_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm G2_UB",
+		 .tst_fn = test_pbm_G2_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm G4_UB",
+		 .tst_fn = test_pbm_G4_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm G8",
+		 .tst_fn = test_pbm_G8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm GA88",
+		 .tst_fn = test_pbm_GA88,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pbm G16",
+		 .tst_fn = test_pbm_G16,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm RGB101010",
+		 .tst_fn = test_pgm_RGB101010,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm xRGB8888",
+		 .tst_fn = test_pgm_xRGB8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm RGBA8888",
+		 .tst_fn = test_pgm_RGBA8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm RGB888",
+		 .tst_fn = test_pgm_RGB888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm BGR888",
+		 .tst_fn = test_pgm_BGR888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm RGB555",
+		 .tst_fn = test_pgm_RGB555,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm RGB565_BE",
+		 .tst_fn = test_pgm_RGB565_BE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm RGB565_LE",
+		 .tst_fn = test_pgm_RGB565_LE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm RGB666",
+		 .tst_fn = test_pgm_RGB666,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm RGB332",
+		 .tst_fn = test_pgm_RGB332,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm CMYK8888",
+		 .tst_fn = test_pgm_CMYK8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm P2",
+		 .tst_fn = test_pgm_P2,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm P4",
+		 .tst_fn = test_pgm_P4,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm P8",
+		 .tst_fn = test_pgm_P8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm G1_DB",
+		 .tst_fn = test_pgm_G1_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm G2_DB",
+		 .tst_fn = test_pgm_G2_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm G4_DB",
+		 .tst_fn = test_pgm_G4_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm G1_UB",
+		 .tst_fn = test_pgm_G1_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm G2_UB",
+		 .tst_fn = test_pgm_G2_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm G4_UB",
+		 .tst_fn = test_pgm_G4_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm G8",
+		 .tst_fn = test_pgm_G8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm GA88",
+		 .tst_fn = test_pgm_GA88,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pgm G16",
+		 .tst_fn = test_pgm_G16,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm RGB101010",
+		 .tst_fn = test_ppm_RGB101010,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm xRGB8888",
+		 .tst_fn = test_ppm_xRGB8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm RGBA8888",
+		 .tst_fn = test_ppm_RGBA8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm RGB888",
+		 .tst_fn = test_ppm_RGB888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm BGR888",
+		 .tst_fn = test_ppm_BGR888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm RGB555",
+		 .tst_fn = test_ppm_RGB555,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm RGB565_BE",
+		 .tst_fn = test_ppm_RGB565_BE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm RGB565_LE",
+		 .tst_fn = test_ppm_RGB565_LE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm RGB666",
+		 .tst_fn = test_ppm_RGB666,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm RGB332",
+		 .tst_fn = test_ppm_RGB332,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm CMYK8888",
+		 .tst_fn = test_ppm_CMYK8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm P2",
+		 .tst_fn = test_ppm_P2,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm P4",
+		 .tst_fn = test_ppm_P4,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm P8",
+		 .tst_fn = test_ppm_P8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm G1_DB",
+		 .tst_fn = test_ppm_G1_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm G2_DB",
+		 .tst_fn = test_ppm_G2_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm G4_DB",
+		 .tst_fn = test_ppm_G4_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm G1_UB",
+		 .tst_fn = test_ppm_G1_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm G2_UB",
+		 .tst_fn = test_ppm_G2_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm G4_UB",
+		 .tst_fn = test_ppm_G4_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm G8",
+		 .tst_fn = test_ppm_G8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm GA88",
+		 .tst_fn = test_ppm_GA88,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "ppm G16",
+		 .tst_fn = test_ppm_G16,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm RGB101010",
+		 .tst_fn = test_pnm_RGB101010,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm xRGB8888",
+		 .tst_fn = test_pnm_xRGB8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm RGBA8888",
+		 .tst_fn = test_pnm_RGBA8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm RGB888",
+		 .tst_fn = test_pnm_RGB888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm BGR888",
+		 .tst_fn = test_pnm_BGR888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm RGB555",
+		 .tst_fn = test_pnm_RGB555,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm RGB565_BE",
+		 .tst_fn = test_pnm_RGB565_BE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm RGB565_LE",
+		 .tst_fn = test_pnm_RGB565_LE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm RGB666",
+		 .tst_fn = test_pnm_RGB666,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm RGB332",
+		 .tst_fn = test_pnm_RGB332,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm CMYK8888",
+		 .tst_fn = test_pnm_CMYK8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm P2",
+		 .tst_fn = test_pnm_P2,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm P4",
+		 .tst_fn = test_pnm_P4,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm P8",
+		 .tst_fn = test_pnm_P8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm G1_DB",
+		 .tst_fn = test_pnm_G1_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm G2_DB",
+		 .tst_fn = test_pnm_G2_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm G4_DB",
+		 .tst_fn = test_pnm_G4_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm G1_UB",
+		 .tst_fn = test_pnm_G1_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm G2_UB",
+		 .tst_fn = test_pnm_G2_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm G4_UB",
+		 .tst_fn = test_pnm_G4_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm G8",
+		 .tst_fn = test_pnm_G8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm GA88",
+		 .tst_fn = test_pnm_GA88,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "pnm G16",
+		 .tst_fn = test_pnm_G16,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp RGB101010",
+		 .tst_fn = test_webp_RGB101010,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp xRGB8888",
+		 .tst_fn = test_webp_xRGB8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp RGBA8888",
+		 .tst_fn = test_webp_RGBA8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp RGB888",
+		 .tst_fn = test_webp_RGB888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp BGR888",
+		 .tst_fn = test_webp_BGR888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp RGB555",
+		 .tst_fn = test_webp_RGB555,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp RGB565_BE",
+		 .tst_fn = test_webp_RGB565_BE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp RGB565_LE",
+		 .tst_fn = test_webp_RGB565_LE,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp RGB666",
+		 .tst_fn = test_webp_RGB666,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp RGB332",
+		 .tst_fn = test_webp_RGB332,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp CMYK8888",
+		 .tst_fn = test_webp_CMYK8888,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp P2",
+		 .tst_fn = test_webp_P2,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp P4",
+		 .tst_fn = test_webp_P4,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp P8",
+		 .tst_fn = test_webp_P8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp G1_DB",
+		 .tst_fn = test_webp_G1_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp G2_DB",
+		 .tst_fn = test_webp_G2_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp G4_DB",
+		 .tst_fn = test_webp_G4_DB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp G1_UB",
+		 .tst_fn = test_webp_G1_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp G2_UB",
+		 .tst_fn = test_webp_G2_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp G4_UB",
+		 .tst_fn = test_webp_G4_UB,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp G8",
+		 .tst_fn = test_webp_G8,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp GA88",
+		 .tst_fn = test_webp_GA88,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = "webp G16",
+		 .tst_fn = test_webp_G16,
+		 .flags = TST_TMPDIR | TST_MALLOC_CANARIES},
+		{.name = NULL},
+	}
+};
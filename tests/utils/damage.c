@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+
+  Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+
+ */
+
+#include <stdlib.h>
+#include <utils/gp_damage.h>
+
+#include "tst_test.h"
+
+static int overlaps(gp_bbox a, gp_bbox b)
+{
+	if (a.x >= b.x + (gp_coord)b.w || b.x >= a.x + (gp_coord)a.w)
+		return 0;
+
+	if (a.y >= b.y + (gp_coord)b.h || b.y >= a.y + (gp_coord)a.h)
+		return 0;
+
+	return 1;
+}
+
+static int covered(gp_damage *damage, gp_bbox box)
+{
+	unsigned int i;
+
+	for (i = 0; i < damage->cnt; i++) {
+		gp_bbox r = damage->rects[i];
+
+		if (box.x >= r.x && box.y >= r.y &&
+		    box.x + box.w <= r.x + r.w &&
+		    box.y + box.h <= r.y + r.h)
+			return 1;
+	}
+
+	return 0;
+}
+
+static int damage_corners(void)
+{
+	gp_damage damage = {};
+
+	gp_damage_add(&damage, gp_bbox_pack(0, 0, 10, 10));
+	gp_damage_add(&damage, gp_bbox_pack(990, 990, 10, 10));
+
+	if (damage.cnt != 2) {
+		tst_msg("Expected 2 rects got %u", damage.cnt);
+		return TST_FAILED;
+	}
+
+	gp_bbox bbox = gp_damage_bbox(&damage);
+
+	if (bbox.x != 0 || bbox.y != 0 || bbox.w != 1000 || bbox.h != 1000) {
+		tst_msg("Wrong bbox " GP_BBOX_FMT, GP_BBOX_PARS(bbox));
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int damage_merge(void)
+{
+	gp_damage damage = {};
+
+	/* Adjacent rects are merged without wasting area */
+	gp_damage_add(&damage, gp_bbox_pack(0, 0, 10, 10));
+	gp_damage_add(&damage, gp_bbox_pack(10, 0, 10, 10));
+
+	if (damage.cnt != 1) {
+		tst_msg("Adjacent rects not merged cnt %u", damage.cnt);
+		return TST_FAILED;
+	}
+
+	/* Overlapping rects are merged */
+	gp_damage_add(&damage, gp_bbox_pack(100, 100, 10, 10));
+	gp_damage_add(&damage, gp_bbox_pack(105, 105, 10, 10));
+
+	if (damage.cnt != 2) {
+		tst_msg("Overlapping rects not merged cnt %u", damage.cnt);
+		return TST_FAILED;
+	}
+
+	/* Covered rect does not change anything */
+	gp_damage_add(&damage, gp_bbox_pack(2, 2, 4, 4));
+	gp_damage_add(&damage, gp_bbox_pack(0, 0, 0, 0));
+
+	if (damage.cnt != 2) {
+		tst_msg("Covered rect added cnt %u", damage.cnt);
+		return TST_FAILED;
+	}
+
+	gp_damage_clear(&damage);
+
+	if (!gp_damage_empty(&damage)) {
+		tst_msg("Damage not empty after clear");
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int damage_random(void)
+{
+	gp_bbox boxes[1000];
+	gp_damage damage = {};
+	unsigned int i, j;
+
+	srand(0);
+
+	for (i = 0; i < 1000; i++) {
+		boxes[i] = gp_bbox_pack(rand() % 1000, rand() % 1000,
+		                        1 + rand() % 50, 1 + rand() % 50);
+
+		gp_damage_add(&damage, boxes[i]);
+
+		if (damage.cnt > GP_DAMAGE_RECTS_MAX) {
+			tst_msg("Too many rects %u", damage.cnt);
+			return TST_FAILED;
+		}
+
+		for (j = 0; j <= i; j++) {
+			if (!covered(&damage, boxes[j])) {
+				tst_msg("Rect " GP_BBOX_FMT " not covered",
+				        GP_BBOX_PARS(boxes[j]));
+				return TST_FAILED;
+			}
+		}
+
+		for (j = 0; j < damage.cnt; j++) {
+			unsigned int k;
+
+			for (k = j + 1; k < damage.cnt; k++) {
+				if (overlaps(damage.rects[j], damage.rects[k])) {
+					tst_msg("Rects in damage overlap");
+					return TST_FAILED;
+				}
+			}
+		}
+	}
+
+	return TST_PASSED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "damage testsuite",
+	.tests = {
+		{.name = "damage corners",
+		 .tst_fn = damage_corners},
+
+		{.name = "damage merge",
+		 .tst_fn = damage_merge},
+
+		{.name = "damage random",
+		 .tst_fn = damage_random},
+
+		{.name = NULL},
+	}
+};
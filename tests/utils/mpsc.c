@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+
+  Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+
+ */
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <core/gp_common.h>
+#include <utils/gp_mpsc.h>
+
+#include "tst_test.h"
+
+struct node {
+	gp_mpsc_node node;
+	unsigned int thread;
+	unsigned int seq;
+};
+
+static int mpsc_single(void)
+{
+	struct node nodes[10];
+	gp_mpsc_node *n;
+	gp_mpsc queue;
+	unsigned int i;
+
+	gp_mpsc_init(&queue);
+
+	if (gp_mpsc_pop(&queue)) {
+		tst_msg("Popped node from empty queue");
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < 10; i++) {
+		nodes[i].seq = i;
+		gp_mpsc_push(&queue, &nodes[i].node);
+	}
+
+	for (i = 0; i < 10; i++) {
+		n = gp_mpsc_pop(&queue);
+		if (!n) {
+			tst_msg("Queue empty after %u pops", i);
+			return TST_FAILED;
+		}
+
+		if (GP_CONTAINER_OF(n, struct node, node)->seq != i) {
+			tst_msg("Wrong order at %u", i);
+			return TST_FAILED;
+		}
+
+		/* Push the nodes again to check that the queue is reusable */
+		if (i == 4)
+			gp_mpsc_push(&queue, &nodes[0].node);
+	}
+
+	n = gp_mpsc_pop(&queue);
+	if (n != &nodes[0].node) {
+		tst_msg("Wrong node after requeue");
+		return TST_FAILED;
+	}
+
+	if (gp_mpsc_pop(&queue)) {
+		tst_msg("Popped node from empty queue");
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+#define THREADS 4
+#define NODES 100000
+
+static gp_mpsc queue;
+
+static void *producer(void *arg)
+{
+	struct node *nodes = arg;
+	unsigned int i;
+
+	for (i = 0; i < NODES; i++)
+		gp_mpsc_push(&queue, &nodes[i].node);
+
+	return NULL;
+}
+
+static int mpsc_threads(void)
+{
+	struct node *nodes;
+	pthread_t threads[THREADS];
+	unsigned int seq[THREADS] = {};
+	unsigned int i, j, cnt = 0;
+	int ret = TST_PASSED;
+
+	nodes = malloc(sizeof(*nodes) * THREADS * NODES);
+	if (!nodes) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	gp_mpsc_init(&queue);
+
+	for (i = 0; i < THREADS; i++) {
+		for (j = 0; j < NODES; j++) {
+			nodes[i * NODES + j].thread = i;
+			nodes[i * NODES + j].seq = j;
+		}
+	}
+
+	for (i = 0; i < THREADS; i++)
+		pthread_create(&threads[i], NULL, producer, &nodes[i * NODES]);
+
+	while (cnt < THREADS * NODES) {
+		gp_mpsc_node *n = gp_mpsc_pop(&queue);
+		struct node *node;
+
+		if (!n)
+			continue;
+
+		node = GP_CONTAINER_OF(n, struct node, node);
+
+		if (node->seq != seq[node->thread]) {
+			tst_msg("Thread %u wrong order %u expected %u",
+			        node->thread, node->seq, seq[node->thread]);
+			ret = TST_FAILED;
+			break;
+		}
+
+		seq[node->thread]++;
+		cnt++;
+	}
+
+	for (i = 0; i < THREADS; i++)
+		pthread_join(threads[i], NULL);
+
+	if (ret == TST_PASSED && gp_mpsc_pop(&queue)) {
+		tst_msg("Queue not empty");
+		ret = TST_FAILED;
+	}
+
+	free(nodes);
+
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "mpsc testsuite",
+	.tests = {
+		{.name = "mpsc single thread",
+		 .tst_fn = mpsc_single},
+
+		{.name = "mpsc threads",
+		 .tst_fn = mpsc_threads},
+
+		{.name = NULL},
+	}
+};
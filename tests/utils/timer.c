@@ -13,6 +13,7 @@
 #include <stdlib.h>
 #include <inttypes.h>
 #include <utils/gp_timer.h>
+#include <utils/gp_timer_wheel.h>
 
 #include "tst_test.h"
 
@@ -391,6 +392,272 @@ static int rem_clears_expires(void)
 	return TST_PASSED;
 }
 
+static uint64_t wheel_now;
+static unsigned int wheel_fired;
+static int wheel_failed;
+
+static uint32_t callback_check_exact(gp_timer *self)
+{
+	if (self->expires != wheel_now) {
+		if (!wheel_failed) {
+			tst_msg("Timer expires %"PRIu64" processed at %"PRIu64,
+			        self->expires, wheel_now);
+		}
+		wheel_failed = 1;
+	}
+
+	wheel_fired++;
+
+	return GP_TIMER_STOP;
+}
+
+#define WHEEL_TIMERS 100000
+
+static int wheel_expirations_exact(void)
+{
+	gp_timer *timers = malloc(sizeof(gp_timer) * WHEEL_TIMERS);
+	gp_timer_wheel wheel;
+	unsigned int i;
+
+	if (!timers) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	wheel_now = 1000;
+	wheel_fired = 0;
+	wheel_failed = 0;
+
+	gp_timer_wheel_init(&wheel, wheel_now);
+
+	/* Spread the timers over all levels including the overflow */
+	for (i = 0; i < WHEEL_TIMERS; i++) {
+		timers[i] = (gp_timer) {
+			.expires = random() % (1<<26),
+			.callback = callback_check_exact,
+			.id = "Test",
+		};
+		gp_timer_wheel_ins(&wheel, wheel_now, &timers[i]);
+	}
+
+	/* Remove every second timer */
+	for (i = 0; i < WHEEL_TIMERS; i += 2)
+		gp_timer_wheel_rem(&wheel, &timers[i]);
+
+	if (gp_timer_wheel_size(&wheel) != WHEEL_TIMERS/2) {
+		tst_msg("Wrong wheel size %zu", gp_timer_wheel_size(&wheel));
+		free(timers);
+		return TST_FAILED;
+	}
+
+	while (gp_timer_wheel_size(&wheel)) {
+		wheel_now = gp_timer_wheel_expires(&wheel);
+		gp_timer_wheel_process(&wheel, wheel_now);
+	}
+
+	free(timers);
+
+	if (wheel_fired != WHEEL_TIMERS/2) {
+		tst_msg("Fired %u timers expected %u", wheel_fired, WHEEL_TIMERS/2);
+		return TST_FAILED;
+	}
+
+	if (wheel_failed)
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
+static int wheel_periodic(void)
+{
+	GP_TIMER_DECLARE(timer1, 10, 10, "Test1", callback_reschedule, NULL);
+	GP_TIMER_DECLARE(timer2, 100, 100, "Test2", callback_reschedule, NULL);
+	gp_timer_wheel wheel;
+	int ret;
+
+	gp_timer_wheel_init(&wheel, 10);
+
+	gp_timer_wheel_ins(&wheel, 10, &timer1);
+	gp_timer_wheel_ins(&wheel, 10, &timer2);
+
+	ret = gp_timer_wheel_process(&wheel, 20);
+	if (ret != 1 || !timer1.priv || timer2.priv) {
+		tst_msg("Wrong timers processed %i", ret);
+		return TST_FAILED;
+	}
+
+	if (timer1.expires != 30) {
+		tst_msg("Timer1 rescheduled at wrong time %"PRIu64" expected 30", timer1.expires);
+		return TST_FAILED;
+	}
+
+	/* Jump over several periods of timer1 */
+	ret = gp_timer_wheel_process(&wheel, 110);
+	if (ret != 2 || !timer2.priv) {
+		tst_msg("Wrong timers processed %i", ret);
+		return TST_FAILED;
+	}
+
+	if (timer1.expires != 120 || timer2.expires != 210) {
+		tst_msg("Timers rescheduled at wrong time %"PRIu64" %"PRIu64,
+		        timer1.expires, timer2.expires);
+		return TST_FAILED;
+	}
+
+	if (gp_timer_wheel_size(&wheel) != 2) {
+		tst_msg("Wrong wheel size %zu", gp_timer_wheel_size(&wheel));
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static uint32_t callback_wheel_rem_ins(gp_timer *self)
+{
+	gp_timer_wheel *wheel = self->priv;
+
+	gp_timer_wheel_rem(wheel, self);
+	self->expires = 10;
+	gp_timer_wheel_ins(wheel, 20, self);
+
+	return 0;
+}
+
+static uint32_t callback_wheel_rem(gp_timer *self)
+{
+	gp_timer_wheel *wheel = self->priv;
+
+	gp_timer_wheel_rem(wheel, self);
+
+	return 0;
+}
+
+static int wheel_rem_ins_from_cb(void)
+{
+	gp_timer_wheel wheel;
+
+	GP_TIMER_DECLARE(timer, 0, 0, "Test", callback_wheel_rem_ins, &wheel);
+
+	gp_timer_wheel_init(&wheel, 0);
+	gp_timer_wheel_ins(&wheel, 0, &timer);
+
+	if (gp_timer_wheel_process(&wheel, 10) != 1) {
+		tst_msg("Wrong number of timers procesed");
+		return TST_FAILED;
+	}
+
+	if (gp_timer_wheel_size(&wheel) != 1 || timer.expires != 30) {
+		tst_msg("Timer was not re-inserted from a callback!");
+		return TST_FAILED;
+	}
+
+	timer.callback = callback_wheel_rem;
+
+	if (gp_timer_wheel_process(&wheel, 30) != 1) {
+		tst_msg("Wrong number of timers procesed");
+		return TST_FAILED;
+	}
+
+	if (gp_timer_wheel_size(&wheel) || timer.running) {
+		tst_msg("Timer was not removed from a callback!");
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int wheel_reschedule_now(void)
+{
+	gp_timer_wheel wheel;
+
+	GP_TIMER_DECLARE(timer, 0, 0, "Test", callback_reschedule_now, NULL);
+
+	gp_timer_wheel_init(&wheel, 0);
+	gp_timer_wheel_ins(&wheel, 0, &timer);
+
+	if (gp_timer_wheel_process(&wheel, 0) != 1) {
+		tst_msg("Wrong number of timers procesed");
+		return TST_FAILED;
+	}
+
+	if (gp_timer_wheel_process(&wheel, 0) != 1) {
+		tst_msg("Timer not processed on a second call");
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+/*
+ * A typical UI load, timers with short expirations that are restarted
+ * frequently, e.g. cursors blinking, key repeat, timeouts.
+ */
+static gp_timer bench_timers[WHEEL_TIMERS];
+
+static uint32_t callback_bench(gp_timer *self)
+{
+	(void) self;
+
+	return GP_TIMER_STOP;
+}
+
+static void bench_timers_init(void)
+{
+	unsigned int i;
+
+	srandom(42);
+
+	for (i = 0; i < WHEEL_TIMERS; i++) {
+		bench_timers[i] = (gp_timer) {
+			.expires = 10 + random() % 1000,
+			.callback = callback_bench,
+			.id = "Bench",
+		};
+	}
+}
+
+static int queue_benchmark(void)
+{
+	gp_timer *head = NULL;
+	uint64_t now;
+	unsigned int i;
+
+	bench_timers_init();
+
+	for (i = 0; i < WHEEL_TIMERS; i++)
+		gp_timer_queue_ins(&head, 0, &bench_timers[i]);
+
+	for (i = 0; i < WHEEL_TIMERS; i += 2)
+		gp_timer_queue_rem(&head, &bench_timers[i]);
+
+	for (now = 0; head; now += 16)
+		gp_timer_queue_process(&head, now);
+
+	return TST_PASSED;
+}
+
+static int wheel_benchmark(void)
+{
+	gp_timer_wheel wheel;
+	uint64_t now;
+	unsigned int i;
+
+	bench_timers_init();
+
+	gp_timer_wheel_init(&wheel, 0);
+
+	for (i = 0; i < WHEEL_TIMERS; i++)
+		gp_timer_wheel_ins(&wheel, 0, &bench_timers[i]);
+
+	for (i = 0; i < WHEEL_TIMERS; i += 2)
+		gp_timer_wheel_rem(&wheel, &bench_timers[i]);
+
+	for (now = 0; gp_timer_wheel_size(&wheel); now += 16)
+		gp_timer_wheel_process(&wheel, now);
+
+	return TST_PASSED;
+}
+
 const struct tst_suite tst_suite = {
 	.suite_name = "Timer Testsuite",
 	.tests = {
@@ -420,6 +687,20 @@ const struct tst_suite tst_suite = {
 		{.name = "Call rem ins rem from cb",
 		 .tst_fn = call_rem_from_cb,
 		 .data = callback_call_rem_ins_rem},
+		{.name = "Wheel expirations are exact",
+		 .tst_fn = wheel_expirations_exact},
+		{.name = "Wheel periodic timers",
+		 .tst_fn = wheel_periodic},
+		{.name = "Wheel rem ins from cb",
+		 .tst_fn = wheel_rem_ins_from_cb},
+		{.name = "Wheel zero reschedule time from cb",
+		 .tst_fn = wheel_reschedule_now},
+		{.name = "Timer queue 100k benchmark",
+		 .tst_fn = queue_benchmark,
+		 .bench_iter = 10},
+		{.name = "Timer wheel 100k benchmark",
+		 .tst_fn = wheel_benchmark,
+		 .bench_iter = 10},
 		{.name = NULL},
 	}
 };
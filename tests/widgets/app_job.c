@@ -0,0 +1,639 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <unistd.h>
+#include <pthread.h>
+#include <core/gp_clamp.h>
+#include <widgets/gp_widgets.h>
+#include "tst_test.h"
+#include "common.h"
+
+static int job_run(gp_app_job *self)
+{
+	int *cnt = self->priv;
+
+	(*cnt)++;
+
+	return 42;
+}
+
+static int done_cnt;
+
+static void job_done(gp_app_job *self)
+{
+	done_cnt++;
+
+	if (gp_app_job_busy(self))
+		tst_msg("Job busy in done callback");
+}
+
+static int app_job_sync(void)
+{
+	int run_cnt = 0;
+	gp_app_job job = {
+		.id = "test",
+		.run = job_run,
+		.done = job_done,
+		.priv = &run_cnt,
+	};
+
+	done_cnt = 0;
+
+	if (gp_app_job_submit(&job)) {
+		tst_msg("Submit failed");
+		return TST_FAILED;
+	}
+
+	if (run_cnt != 1 || done_cnt != 1) {
+		tst_msg("Wrong callback counts run=%i done=%i", run_cnt, done_cnt);
+		return TST_FAILED;
+	}
+
+	if (job.ret != 42) {
+		tst_msg("Wrong ret %i", job.ret);
+		return TST_FAILED;
+	}
+
+	if (gp_app_job_busy(&job)) {
+		tst_msg("Job busy after completion");
+		return TST_FAILED;
+	}
+
+	/* Job can be submitted again */
+	if (gp_app_job_submit(&job) || run_cnt != 2 || done_cnt != 2) {
+		tst_msg("Resubmit failed run=%i done=%i", run_cnt, done_cnt);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static int app_job_cancel_idle(void)
+{
+	int run_cnt = 0;
+	gp_app_job job = {
+		.id = "test",
+		.run = job_run,
+		.done = job_done,
+		.priv = &run_cnt,
+	};
+
+	done_cnt = 0;
+
+	gp_app_job_cancel(&job);
+
+	if (run_cnt || done_cnt || job.canceled) {
+		tst_msg("Canceling idle job had side effects");
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+/*
+ * A backend for the threaded tests, job completions are posted from the
+ * worker threads and processed by the main_loop_iter().
+ */
+static gp_task_queue tasks;
+static gp_ev_queue ev_queue;
+
+static gp_backend backend = {
+	.name = "Job backend",
+	.tasks = &tasks,
+	.event_queue = &ev_queue,
+};
+
+static int main_loop_init(void)
+{
+	gp_ev_queue_init(&ev_queue, 1, 1, 0, NULL, NULL, 0);
+
+	gp_widgets_backend_set(&backend);
+
+	if (gp_backend_post_init(&backend)) {
+		tst_msg("Failed to initialize backend post queue");
+		return 1;
+	}
+
+	return 0;
+}
+
+static void main_loop_iter(void)
+{
+	gp_poll_wait(&backend.fds, 10);
+
+	while (gp_task_queue_process(&tasks));
+}
+
+/* Runs the main loop until *cnt reaches val, gives up after ~10s */
+static int main_loop_wait(int *cnt, int val)
+{
+	unsigned int i;
+
+	for (i = 0; i < 1000; i++) {
+		if (__atomic_load_n(cnt, __ATOMIC_SEQ_CST) >= val)
+			return 0;
+
+		main_loop_iter();
+	}
+
+	tst_msg("Timeouted waiting for %i got %i", val, *cnt);
+	return 1;
+}
+
+/* Same number of worker threads the library starts */
+static unsigned int job_threads(void)
+{
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return GP_CLAMP(cpus, 1, GP_APP_JOB_THREADS_MAX);
+}
+
+static pthread_t main_thread;
+static int run_in_main;
+
+static int job_run_thread(gp_app_job *self)
+{
+	int *cnt = self->priv;
+
+	if (pthread_equal(pthread_self(), main_thread))
+		run_in_main = 1;
+
+	__atomic_add_fetch(cnt, 1, __ATOMIC_SEQ_CST);
+
+	return 42;
+}
+
+static int app_job_threaded(void)
+{
+	int run_cnt = 0;
+	gp_app_job job = {
+		.id = "test",
+		.run = job_run_thread,
+		.done = job_done,
+		.priv = &run_cnt,
+	};
+
+	if (main_loop_init())
+		return TST_UNTESTED;
+
+	main_thread = pthread_self();
+	done_cnt = 0;
+
+	if (gp_app_job_submit(&job)) {
+		tst_msg("Submit failed");
+		return TST_FAILED;
+	}
+
+	if (done_cnt) {
+		tst_msg("Job completed synchronously");
+		return TST_FAILED;
+	}
+
+	if (main_loop_wait(&done_cnt, 1))
+		return TST_FAILED;
+
+	if (run_in_main) {
+		tst_msg("Job run in the main thread");
+		return TST_FAILED;
+	}
+
+	if (run_cnt != 1 || done_cnt != 1 || job.ret != 42 || job.canceled) {
+		tst_msg("Wrong job state run=%i done=%i ret=%i canceled=%i",
+		        run_cnt, done_cnt, job.ret, job.canceled);
+		return TST_FAILED;
+	}
+
+	if (gp_app_job_busy(&job)) {
+		tst_msg("Job busy after completion");
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+/*
+ * Blocker jobs keep the worker threads busy until their gate is opened so
+ * that the jobs submitted afterwards stay in the queue.
+ */
+static int blockers_started;
+static int blocker_gates[GP_APP_JOB_THREADS_MAX];
+static gp_app_job blockers[GP_APP_JOB_THREADS_MAX];
+
+static int blocker_run(gp_app_job *self)
+{
+	int *gate = self->priv;
+
+	__atomic_add_fetch(&blockers_started, 1, __ATOMIC_SEQ_CST);
+
+	while (!__atomic_load_n(gate, __ATOMIC_SEQ_CST))
+		usleep(1000);
+
+	return 0;
+}
+
+static int blockers_start(void)
+{
+	unsigned int i, threads = job_threads();
+
+	for (i = 0; i < threads; i++) {
+		blockers[i] = (gp_app_job) {
+			.id = "blocker",
+			.prio = GP_TASK_MIN_PRIO,
+			.run = blocker_run,
+			.priv = &blocker_gates[i],
+		};
+
+		if (gp_app_job_submit(&blockers[i])) {
+			tst_msg("Blocker submit failed");
+			return 1;
+		}
+	}
+
+	for (i = 0; i < 10000; i++) {
+		if (__atomic_load_n(&blockers_started, __ATOMIC_SEQ_CST) >= (int)threads)
+			return 0;
+
+		usleep(1000);
+	}
+
+	tst_msg("Blockers did not start");
+	return 1;
+}
+
+static void blocker_release(unsigned int i)
+{
+	__atomic_store_n(&blocker_gates[i], 1, __ATOMIC_SEQ_CST);
+}
+
+static void blockers_release(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < job_threads(); i++)
+		blocker_release(i);
+}
+
+#define PRIO_JOBS 5
+
+static const int job_idx[PRIO_JOBS] = {0, 1, 2, 3, 4};
+static int run_order[PRIO_JOBS];
+static int run_order_cnt;
+
+static int job_run_order(gp_app_job *self)
+{
+	int idx = __atomic_fetch_add(&run_order_cnt, 1, __ATOMIC_SEQ_CST);
+	const int *job = self->priv;
+
+	run_order[idx] = *job;
+
+	return 0;
+}
+
+static void job_done_cnt(gp_app_job *self)
+{
+	(void) self;
+
+	__atomic_add_fetch(&done_cnt, 1, __ATOMIC_SEQ_CST);
+}
+
+static int app_job_prio(void)
+{
+	static const unsigned int prios[PRIO_JOBS] = {3, 2, 1, 3, 2};
+	static const int exp_order[PRIO_JOBS] = {2, 1, 4, 0, 3};
+	gp_app_job jobs[PRIO_JOBS];
+	unsigned int i;
+
+	if (main_loop_init())
+		return TST_UNTESTED;
+
+	done_cnt = 0;
+
+	if (blockers_start())
+		return TST_FAILED;
+
+	for (i = 0; i < PRIO_JOBS; i++) {
+		jobs[i] = (gp_app_job) {
+			.id = "prio",
+			.prio = prios[i],
+			.run = job_run_order,
+			.done = job_done_cnt,
+			.priv = (void *)&job_idx[i],
+		};
+
+		if (gp_app_job_submit(&jobs[i])) {
+			tst_msg("Submit failed");
+			blockers_release();
+			return TST_FAILED;
+		}
+	}
+
+	/* A single worker runs the queued jobs one after another */
+	blocker_release(0);
+
+	if (main_loop_wait(&done_cnt, PRIO_JOBS)) {
+		blockers_release();
+		return TST_FAILED;
+	}
+
+	blockers_release();
+
+	for (i = 0; i < PRIO_JOBS; i++) {
+		if (run_order[i] != exp_order[i]) {
+			tst_msg("Wrong job order at %u got %i expected %i",
+			        i, run_order[i], exp_order[i]);
+			return TST_FAILED;
+		}
+	}
+
+	return TST_PASSED;
+}
+
+static int app_job_cancel_queued(void)
+{
+	int run_cnt = 0;
+	gp_app_job job = {
+		.id = "test",
+		.run = job_run_thread,
+		.done = job_done_cnt,
+		.priv = &run_cnt,
+	};
+
+	if (main_loop_init())
+		return TST_UNTESTED;
+
+	done_cnt = 0;
+
+	if (blockers_start())
+		return TST_FAILED;
+
+	if (gp_app_job_submit(&job)) {
+		tst_msg("Submit failed");
+		goto fail;
+	}
+
+	gp_app_job_cancel(&job);
+
+	if (done_cnt) {
+		tst_msg("Done called synchronously from cancel");
+		goto fail;
+	}
+
+	if (main_loop_wait(&done_cnt, 1))
+		goto fail;
+
+	blockers_release();
+
+	/* Give the workers a chance to pick the job if it was still queued */
+	usleep(10000);
+
+	if (run_cnt || done_cnt != 1 || !job.canceled) {
+		tst_msg("Wrong job state run=%i done=%i canceled=%i",
+		        run_cnt, done_cnt, job.canceled);
+		return TST_FAILED;
+	}
+
+	if (gp_app_job_busy(&job)) {
+		tst_msg("Job busy after cancel");
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+fail:
+	blockers_release();
+	return TST_FAILED;
+}
+
+static int running_started;
+
+static int job_run_until_canceled(gp_app_job *self)
+{
+	unsigned int i;
+
+	__atomic_store_n(&running_started, 1, __ATOMIC_SEQ_CST);
+
+	for (i = 0; i < 10000; i++) {
+		if (gp_app_job_canceled(self))
+			return 1;
+
+		usleep(1000);
+	}
+
+	return 0;
+}
+
+static int app_job_cancel_running(void)
+{
+	gp_app_job job = {
+		.id = "test",
+		.run = job_run_until_canceled,
+		.done = job_done_cnt,
+	};
+	unsigned int i;
+
+	if (main_loop_init())
+		return TST_UNTESTED;
+
+	done_cnt = 0;
+
+	if (gp_app_job_submit(&job)) {
+		tst_msg("Submit failed");
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < 10000 && !__atomic_load_n(&running_started, __ATOMIC_SEQ_CST); i++)
+		usleep(1000);
+
+	if (!running_started) {
+		tst_msg("Job did not start");
+		return TST_FAILED;
+	}
+
+	gp_app_job_cancel(&job);
+
+	/* Running job is only marked as canceled */
+	if (done_cnt || !gp_app_job_busy(&job)) {
+		tst_msg("Running job finished by cancel");
+		return TST_FAILED;
+	}
+
+	if (main_loop_wait(&done_cnt, 1))
+		return TST_FAILED;
+
+	if (job.ret != 1 || !job.canceled) {
+		tst_msg("Job did not see cancel ret=%i canceled=%i",
+		        job.ret, job.canceled);
+		return TST_FAILED;
+	}
+
+	return TST_PASSED;
+}
+
+static gp_pixmap *render(gp_size w, gp_size h, gp_pixel_type type, void *priv)
+{
+	int *cnt = priv;
+
+	(void) type;
+
+	(*cnt)++;
+
+	return gp_pixmap_alloc(w, h, GP_PIXEL_RGB888);
+}
+
+static int pixmap_render_async(void)
+{
+	gp_widget *pixmap;
+	gp_pixmap *pix;
+	int cnt = 0;
+
+	pixmap = gp_widget_pixmap_new(GP_WIDGET_SIZE(10, 0, 0), GP_WIDGET_SIZE(10, 0, 0), NULL, NULL);
+	if (!pixmap) {
+		tst_msg("Failed to allocate pixmap widget");
+		return TST_FAILED;
+	}
+
+	pixmap->w = 10;
+	pixmap->h = 20;
+
+	if (gp_widget_pixmap_render_async(pixmap, render, &cnt)) {
+		tst_msg("Render failed");
+		goto fail;
+	}
+
+	pix = gp_widget_pixmap_get(pixmap);
+	if (!pix || cnt != 1) {
+		tst_msg("Pixmap not rendered");
+		goto fail;
+	}
+
+	if (pix->w != 10 || pix->h != 20) {
+		tst_msg("Wrong pixmap size %ux%u", pix->w, pix->h);
+		goto fail;
+	}
+
+	/* Second render replaces and frees the previous pixmap */
+	if (gp_widget_pixmap_render_async(pixmap, render, &cnt) || cnt != 2) {
+		tst_msg("Second render failed");
+		goto fail;
+	}
+
+	gp_widget_free(pixmap);
+	return TST_PASSED;
+fail:
+	gp_widget_free(pixmap);
+	return TST_FAILED;
+}
+
+static gp_widget *resize_widget;
+
+/* Simulates widget resize while the first render is in progress */
+static gp_pixmap *render_resize(gp_size w, gp_size h, gp_pixel_type type, void *priv)
+{
+	int *cnt = priv;
+
+	if (!*cnt) {
+		resize_widget->w = 30;
+		resize_widget->h = 40;
+	}
+
+	return render(w, h, type, priv);
+}
+
+/* Render that returns pixmap of a different size than requested */
+static gp_pixmap *render_fixed(gp_size w, gp_size h, gp_pixel_type type, void *priv)
+{
+	int *cnt = priv;
+
+	(void) w;
+	(void) h;
+	(void) type;
+
+	(*cnt)++;
+
+	return gp_pixmap_alloc(5, 5, GP_PIXEL_RGB888);
+}
+
+static int pixmap_render_resize(void)
+{
+	gp_widget *pixmap;
+	gp_pixmap *pix;
+	int cnt = 0;
+
+	pixmap = gp_widget_pixmap_new(GP_WIDGET_SIZE(10, 0, 0), GP_WIDGET_SIZE(10, 0, 0), NULL, NULL);
+	if (!pixmap) {
+		tst_msg("Failed to allocate pixmap widget");
+		return TST_FAILED;
+	}
+
+	pixmap->w = 10;
+	pixmap->h = 20;
+	resize_widget = pixmap;
+
+	if (gp_widget_pixmap_render_async(pixmap, render_resize, &cnt)) {
+		tst_msg("Render failed");
+		goto fail;
+	}
+
+	pix = gp_widget_pixmap_get(pixmap);
+	if (!pix || cnt != 2) {
+		tst_msg("Pixmap not rendered twice cnt=%i", cnt);
+		goto fail;
+	}
+
+	if (pix->w != 30 || pix->h != 40) {
+		tst_msg("Wrong pixmap size %ux%u", pix->w, pix->h);
+		goto fail;
+	}
+
+	/* Pixmap size does not match the widget, must not be rendered again */
+	if (gp_widget_pixmap_render_async(pixmap, render_fixed, &cnt) || cnt != 3) {
+		tst_msg("Render with fixed size failed cnt=%i", cnt);
+		goto fail;
+	}
+
+	pix = gp_widget_pixmap_get(pixmap);
+	if (!pix || pix->w != 5 || pix->h != 5) {
+		tst_msg("Wrong fixed size pixmap");
+		goto fail;
+	}
+
+	gp_widget_free(pixmap);
+	return TST_PASSED;
+fail:
+	gp_widget_free(pixmap);
+	return TST_FAILED;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "app job testsuite",
+	.tests = {
+		{.name = "app job sync",
+		 .tst_fn = app_job_sync},
+
+		{.name = "app job cancel idle",
+		 .tst_fn = app_job_cancel_idle},
+
+		{.name = "app job threaded",
+		 .tst_fn = app_job_threaded},
+
+		{.name = "app job priorities",
+		 .tst_fn = app_job_prio},
+
+		{.name = "app job cancel queued",
+		 .tst_fn = app_job_cancel_queued},
+
+		{.name = "app job cancel running",
+		 .tst_fn = app_job_cancel_running},
+
+		{.name = "pixmap render async",
+		 .tst_fn = pixmap_render_async,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "pixmap render resize",
+		 .tst_fn = pixmap_render_resize,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = NULL},
+	}
+};
@@ -111,7 +111,8 @@ static inline void paste_event(gp_widget *widget)
  * @brief Sets backend for widget rendering.
  *
  * Allows to set widget backend. Does work only before backend was initialized
- * by a call to gp_widgets_main_loop(). This function is useful only for testing.
+ * by a call to gp_widgets_main_loop(). If the backend has a pixmap it's used
+ * as a render buffer as well. This function is useful only for testing.
  *
  * @backend A new backend.
  */
@@ -0,0 +1,254 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <widgets/gp_dir_cache.h>
+#include "tst_test.h"
+
+#define ENTRIES 2000
+
+static void add_random(gp_dir_cache *cache, unsigned int cnt)
+{
+	unsigned int i;
+	char name[32];
+
+	for (i = 0; i < cnt; i++) {
+		snprintf(name, sizeof(name), "file_%08lx", random());
+		gp_dir_cache_add_entry(cache, random() % 100, name, S_IFREG, 0);
+	}
+}
+
+static int check_order(gp_dir_cache *cache, gp_dir_entry **arr, size_t len)
+{
+	size_t i, first = 0;
+
+	if (len && !strcmp(arr[0]->name, "../"))
+		first = 1;
+
+	for (i = first + 1; i < len; i++) {
+		int cmp = 0;
+
+		switch (cache->sort_type) {
+		case GP_DIR_SORT_ASC | GP_DIR_SORT_BY_NAME:
+			cmp = strcmp(arr[i-1]->name, arr[i]->name);
+		break;
+		case GP_DIR_SORT_ASC | GP_DIR_SORT_BY_SIZE:
+			if (arr[i-1]->size != arr[i]->size)
+				cmp = arr[i-1]->size > arr[i]->size ? 1 : -1;
+			else
+				cmp = strcmp(arr[i-1]->name, arr[i]->name);
+		break;
+		default:
+		break;
+		}
+
+		if (cmp >= 0) {
+			tst_msg("Wrong order at %zu '%s' '%s'",
+			        i, arr[i-1]->name, arr[i]->name);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int check_filter_idx(gp_dir_cache *cache)
+{
+	size_t i, j = 0;
+
+	for (i = 0; i < cache->used; i++) {
+		if (cache->entries[i]->filtered)
+			continue;
+
+		if (gp_dir_cache_get_filtered(cache, j) != cache->entries[i]) {
+			tst_msg("Wrong filtered entry at %zu", j);
+			return 1;
+		}
+
+		j++;
+	}
+
+	if (j != gp_dir_cache_entries_filter(cache)) {
+		tst_msg("Wrong number of filtered entries %zu expected %zu",
+		        gp_dir_cache_entries_filter(cache), j);
+		return 1;
+	}
+
+	if (gp_dir_cache_get_filtered(cache, j)) {
+		tst_msg("Entry returned after the end");
+		return 1;
+	}
+
+	return 0;
+}
+
+static int dir_cache_sorted_insert(void *sort_type)
+{
+	gp_dir_cache cache = {};
+	char name[32];
+	unsigned int i;
+	int ret = TST_FAILED;
+
+	srandom(1);
+
+	gp_dir_cache_add_entry(&cache, 0, "..", S_IFDIR, 0);
+	add_random(&cache, ENTRIES);
+	gp_dir_cache_sort(&cache, (long)sort_type);
+
+	/* Entries added after sort has to be inserted in order */
+	add_random(&cache, ENTRIES);
+	gp_dir_cache_add_entry(&cache, 10, "dir", S_IFDIR, 0);
+
+	if (check_order(&cache, cache.entries, cache.used))
+		goto exit;
+
+	if (strcmp(cache.entries[0]->name, "../")) {
+		tst_msg("Parent dir is not first");
+		goto exit;
+	}
+
+	/* Remove every other entry */
+	srandom(1);
+	for (i = 0; i < ENTRIES; i += 2) {
+		snprintf(name, sizeof(name), "file_%08lx", random());
+		/* Skip the size and the next entry */
+		random();
+		random();
+		random();
+		if (gp_dir_cache_rem_entry_by_name(&cache, name)) {
+			tst_msg("Failed to remove '%s'", name);
+			goto exit;
+		}
+	}
+
+	if (gp_dir_cache_entries(&cache) != ENTRIES + 2 + ENTRIES/2) {
+		tst_msg("Wrong number of entries %zu", gp_dir_cache_entries(&cache));
+		goto exit;
+	}
+
+	if (check_order(&cache, cache.entries, cache.used))
+		goto exit;
+
+	if (!gp_dir_cache_entry_lookup(&cache, "dir") ||
+	    !gp_dir_cache_entry_lookup(&cache, "dir/") ||
+	    gp_dir_cache_entry_lookup(&cache, "nonexistent")) {
+		tst_msg("Wrong lookup result");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_dir_cache_free_entries(&cache);
+	return ret;
+}
+
+static int dir_cache_filter(void)
+{
+	gp_dir_cache cache = {};
+	unsigned int i, pos;
+	gp_dir_entry *entry;
+	int ret = TST_FAILED;
+
+	srandom(2);
+
+	add_random(&cache, ENTRIES);
+	gp_dir_cache_sort(&cache, GP_DIR_SORT_ASC | GP_DIR_SORT_BY_NAME);
+
+	for (i = 0; i < cache.used; i += 3)
+		gp_dir_cache_set_filter(&cache, i, 1);
+
+	/* Setting the same value twice must not change the counters */
+	gp_dir_cache_set_filter(&cache, 0, 1);
+
+	if (check_filter_idx(&cache))
+		goto exit;
+
+	/* The filtered index is updated on insert and remove */
+	add_random(&cache, 100);
+	gp_dir_cache_add_entry(&cache, 0, "a", S_IFREG, 0);
+
+	if (check_filter_idx(&cache))
+		goto exit;
+
+	pos = gp_dir_cache_pos_by_name_filtered(&cache, "a");
+	entry = gp_dir_cache_get_filtered(&cache, pos);
+	if (!entry || strcmp(entry->name, "a")) {
+		tst_msg("Wrong position %u for 'a'", pos);
+		goto exit;
+	}
+
+	for (i = 0; i < 100; i++)
+		gp_dir_cache_rem_entry_by_name(&cache, cache.entries[i]->name);
+
+	if (check_filter_idx(&cache))
+		goto exit;
+
+	for (i = 0; !cache.entries[i]->filtered; i++);
+
+	if (gp_dir_cache_pos_by_name_filtered(&cache, cache.entries[i]->name) != (unsigned int)-1) {
+		tst_msg("Position returned for filtered entry");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_dir_cache_free_entries(&cache);
+	return ret;
+}
+
+static int dir_cache_replace(void)
+{
+	gp_dir_cache cache = {};
+	gp_dir_entry *entry;
+	int ret = TST_FAILED;
+
+	gp_dir_cache_add_entry(&cache, 1, "a", S_IFREG, 0);
+	gp_dir_cache_add_entry(&cache, 2, "b", S_IFREG, 0);
+	gp_dir_cache_sort(&cache, GP_DIR_SORT_ASC | GP_DIR_SORT_BY_NAME);
+	gp_dir_cache_add_entry(&cache, 3, "a", S_IFREG, 0);
+
+	if (gp_dir_cache_entries(&cache) != 2) {
+		tst_msg("Duplicate entry added");
+		goto exit;
+	}
+
+	entry = gp_dir_cache_entry_lookup(&cache, "a");
+	if (!entry || entry->size != 3) {
+		tst_msg("Entry not replaced");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_dir_cache_free_entries(&cache);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "dir cache testsuite",
+	.tests = {
+		{.name = "dir cache sorted insert by name",
+		 .tst_fn = dir_cache_sorted_insert,
+		 .data = (void*)(GP_DIR_SORT_ASC | GP_DIR_SORT_BY_NAME),
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "dir cache sorted insert by size",
+		 .tst_fn = dir_cache_sorted_insert,
+		 .data = (void*)(GP_DIR_SORT_ASC | GP_DIR_SORT_BY_SIZE),
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "dir cache filter index",
+		 .tst_fn = dir_cache_filter,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "dir cache replace entry",
+		 .tst_fn = dir_cache_replace,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = NULL},
+	}
+};
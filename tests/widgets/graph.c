@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <widgets/gp_widgets.h>
+#include "tst_test.h"
+
+#define POINTS 16
+
+static int check_range(gp_widget *graph, double min_x, double max_x,
+                       double min_y, double max_y)
+{
+	double gmin_x, gmax_x, gmin_y, gmax_y;
+
+	gp_widget_graph_range_get(graph, &gmin_x, &gmax_x, &gmin_y, &gmax_y);
+
+	if (gmin_x != min_x || gmax_x != max_x ||
+	    gmin_y != min_y || gmax_y != max_y) {
+		tst_msg("Wrong range x [%g, %g] y [%g, %g] expected x [%g, %g] y [%g, %g]",
+		        gmin_x, gmax_x, gmin_y, gmax_y, min_x, max_x, min_y, max_y);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int graph_evict_min_max(void)
+{
+	gp_widget *graph = gp_widget_graph_new(GP_WIDGET_SIZE(10, 0, 0),
+	                                       GP_WIDGET_SIZE(10, 0, 0),
+	                                       NULL, NULL, 4);
+	int ret = TST_FAILED;
+
+	if (!graph) {
+		tst_msg("Allocation failure");
+		return TST_FAILED;
+	}
+
+	gp_widget_graph_point_add(graph, 0, 10);
+	gp_widget_graph_point_add(graph, 1, -5);
+	gp_widget_graph_point_add(graph, 2, 3);
+	gp_widget_graph_point_add(graph, 3, 4);
+
+	if (check_range(graph, 0, 3, -5, 10))
+		goto exit;
+
+	/* Evicts the maximum, next maximum is 4 */
+	gp_widget_graph_point_add(graph, 4, 2);
+
+	if (check_range(graph, 1, 4, -5, 4))
+		goto exit;
+
+	/* Evicts the minimum, next minimum is 2 */
+	gp_widget_graph_point_add(graph, 5, 3);
+
+	if (check_range(graph, 2, 5, 2, 4))
+		goto exit;
+
+	/* Evicts the duplicate 3 but the other one stays */
+	gp_widget_graph_point_add(graph, 6, 3);
+
+	if (check_range(graph, 3, 6, 2, 4))
+		goto exit;
+
+	/* Evicts the maximum 4 */
+	gp_widget_graph_point_add(graph, 7, 3);
+
+	if (check_range(graph, 4, 7, 2, 3))
+		goto exit;
+
+	/* Evicts the minimum 2, all values are the same */
+	gp_widget_graph_point_add(graph, 8, 3);
+
+	if (check_range(graph, 5, 8, 3, 3))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(graph);
+	return ret;
+}
+
+static void ref_range(struct gp_widget_graph_point *points, size_t cnt,
+                      double *min_x, double *max_x, double *min_y, double *max_y)
+{
+	size_t i;
+
+	*min_x = *max_x = points[0].x;
+	*min_y = *max_y = points[0].y;
+
+	for (i = 1; i < cnt; i++) {
+		*min_x = GP_MIN(*min_x, points[i].x);
+		*max_x = GP_MAX(*max_x, points[i].x);
+		*min_y = GP_MIN(*min_y, points[i].y);
+		*max_y = GP_MAX(*max_y, points[i].y);
+	}
+}
+
+static int graph_random(void)
+{
+	struct gp_widget_graph_point points[1000];
+	double min_x, max_x, min_y, max_y;
+	int ret = TST_PASSED;
+	gp_widget *graph;
+	size_t i, first;
+
+	graph = gp_widget_graph_new(GP_WIDGET_SIZE(10, 0, 0),
+	                            GP_WIDGET_SIZE(10, 0, 0),
+	                            NULL, NULL, POINTS);
+	if (!graph) {
+		tst_msg("Allocation failure");
+		return TST_FAILED;
+	}
+
+	srandom(42);
+
+	for (i = 0; i < GP_ARRAY_SIZE(points); i++) {
+		points[i].x = random() % 100;
+		points[i].y = random() % 100 - 50;
+
+		gp_widget_graph_point_add(graph, points[i].x, points[i].y);
+
+		first = i + 1 > POINTS ? i + 1 - POINTS : 0;
+
+		ref_range(points + first, i + 1 - first, &min_x, &max_x, &min_y, &max_y);
+
+		if (check_range(graph, min_x, max_x, min_y, max_y)) {
+			tst_msg("After point %zu", i);
+			ret = TST_FAILED;
+			break;
+		}
+	}
+
+	gp_widget_free(graph);
+	return ret;
+}
+
+static int graph_points_add(void)
+{
+	struct gp_widget_graph_point points[3 * POINTS];
+	double min_x, max_x, min_y, max_y;
+	int ret = TST_FAILED;
+	gp_widget *graph;
+	size_t i;
+
+	graph = gp_widget_graph_new(GP_WIDGET_SIZE(10, 0, 0),
+	                            GP_WIDGET_SIZE(10, 0, 0),
+	                            NULL, NULL, POINTS);
+	if (!graph) {
+		tst_msg("Allocation failure");
+		return TST_FAILED;
+	}
+
+	/* The extremes are in the first POINTS and have to be discarded */
+	for (i = 0; i < GP_ARRAY_SIZE(points); i++) {
+		points[i].x = i;
+		points[i].y = i < POINTS ? (i % 2 ? 1000 : -1000) : (double)(i % 7);
+	}
+
+	gp_widget_graph_points_add(graph, points, 2 * POINTS);
+
+	ref_range(points + POINTS, POINTS, &min_x, &max_x, &min_y, &max_y);
+
+	if (check_range(graph, min_x, max_x, min_y, max_y))
+		goto exit;
+
+	/* Shorter than the buffer, shifts the window by POINTS/2 */
+	gp_widget_graph_points_add(graph, points + 2 * POINTS, POINTS / 2);
+
+	ref_range(points + POINTS + POINTS / 2, POINTS, &min_x, &max_x, &min_y, &max_y);
+
+	if (check_range(graph, min_x, max_x, min_y, max_y))
+		goto exit;
+
+	/* Has to be the same as adding the points one by one */
+	gp_widget_graph_points_add(graph, points, POINTS / 2);
+
+	ref_range(points + 2 * POINTS, POINTS / 2, &min_x, &max_x, &min_y, &max_y);
+	min_x = GP_MIN(min_x, 0);
+	min_y = -1000;
+	max_y = 1000;
+
+	if (check_range(graph, min_x, max_x, min_y, max_y))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(graph);
+	return ret;
+}
+
+static int graph_yrange_fixed(void)
+{
+	gp_widget *graph = gp_widget_graph_new(GP_WIDGET_SIZE(10, 0, 0),
+	                                       GP_WIDGET_SIZE(10, 0, 0),
+	                                       NULL, NULL, 2);
+	int ret = TST_FAILED;
+
+	if (!graph) {
+		tst_msg("Allocation failure");
+		return TST_FAILED;
+	}
+
+	gp_widget_graph_yrange_set(graph, -1, 1);
+
+	gp_widget_graph_point_add(graph, 0, 10);
+	gp_widget_graph_point_add(graph, 1, 20);
+	gp_widget_graph_point_add(graph, 2, 30);
+
+	if (check_range(graph, 1, 2, -1, 1))
+		goto exit;
+
+	gp_widget_graph_yrange_clear(graph);
+
+	if (check_range(graph, 1, 2, 20, 30))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(graph);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "graph testsuite",
+	.tests = {
+		{.name = "graph evict min max",
+		 .tst_fn = graph_evict_min_max,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "graph random points",
+		 .tst_fn = graph_random,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "graph points add",
+		 .tst_fn = graph_points_add,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "graph fixed yrange",
+		 .tst_fn = graph_yrange_fixed,
+		 .flags = TST_CHECK_MALLOC},
+
+		{},
+	}
+};
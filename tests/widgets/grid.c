@@ -465,6 +465,67 @@ static int grid_rpad_set(void)
 	return TST_PASSED;
 }
 
+static int grid_incremental_layout(void)
+{
+	gp_widget *grid, *label, *sibling;
+	unsigned int x, w;
+
+	grid = gp_widget_grid_new(1, 2, 0);
+	label = gp_widget_label_new("a", 0, 0);
+	sibling = gp_widget_label_new("A long sibling label", 0, 0);
+	if (!grid || !label || !sibling) {
+		tst_msg("Allocation failure");
+		return TST_FAILED;
+	}
+
+	gp_widget_grid_put(grid, 0, 0, label);
+	gp_widget_grid_put(grid, 0, 1, sibling);
+
+	gp_widget_calc_size(grid, &dummy_ctx, 0, 0, 1);
+	dummy_render(grid);
+
+	x = sibling->x;
+	w = sibling->w;
+
+	gp_widget_label_set(label, "aaaa");
+
+	if (grid->no_resize) {
+		tst_msg("Layout not marked for resize");
+		return TST_FAILED;
+	}
+
+	gp_widget_calc_size(grid, &dummy_ctx, 0, 0, 0);
+
+	if (!label->redraw) {
+		tst_msg("Resized label not redrawn");
+		return TST_FAILED;
+	}
+
+	if (!grid->redraw_children) {
+		tst_msg("Grid children not redrawn");
+		return TST_FAILED;
+	}
+
+	if (sibling->redraw) {
+		tst_msg("Unchanged sibling was laid out again");
+		return TST_FAILED;
+	}
+
+	if (sibling->x != x || sibling->w != w) {
+		tst_msg("Sibling moved %u %u -> %u %u", x, w, sibling->x, sibling->w);
+		return TST_FAILED;
+	}
+
+	if (!sibling->no_resize || !label->no_resize || !grid->no_resize) {
+		tst_msg("Layout not finished");
+		return TST_FAILED;
+	}
+
+	gp_widget_free(grid);
+
+	return TST_PASSED;
+}
+
 const struct tst_suite tst_suite = {
 	.suite_name = "grid testsuite",
 	.tests = {
@@ -497,6 +558,9 @@ const struct tst_suite tst_suite = {
 		{.name = "rpad set",
 		 .tst_fn = grid_rpad_set},
 
+		{.name = "incremental layout",
+		 .tst_fn = grid_incremental_layout},
+
 		{.name = NULL},
 	}
 };
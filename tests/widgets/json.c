@@ -1,8 +1,9 @@
 // SPDX-License-Identifier: GPL-2.1-or-later
 /*
- * Copyright (C) 2021 Cyril Hrubis <metan@ucw.cz>
+ * Copyright (C) 2021-2026 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <stdio.h>
 #include <string.h>
 #include <widgets/gp_widgets.h>
 #include "tst_test.h"
@@ -185,6 +186,152 @@ static struct tcase widget_no_shrink = {
 	.no_shrink = 1,
 };
 
+static int cb_a(gp_widget_event *ev) { (void)ev; return 'a'; }
+static int cb_b(gp_widget_event *ev) { (void)ev; return 'b'; }
+static int cb_c(gp_widget_event *ev) { (void)ev; return 'c'; }
+static int cb_d(gp_widget_event *ev) { (void)ev; return 'd'; }
+static int cb_e(gp_widget_event *ev) { (void)ev; return 'e'; }
+
+static const gp_widget_json_addr cb_addrs[] = {
+	{.id = "a", .on_event = cb_a},
+	{.id = "b", .on_event = cb_b},
+	{.id = "c", .on_event = cb_c},
+	{.id = "d", .on_event = cb_d},
+	{.id = "e", .on_event = cb_e},
+	{}
+};
+
+static int callbacks_lookup(void)
+{
+	static int priv;
+	gp_widget_json_callbacks callbacks = {
+		.default_priv = &priv,
+		.addrs = cb_addrs,
+	};
+	const char *names[] = {"a", "b", "c", "d", "e", "0", "ab", "f"};
+	unsigned int i;
+	char buf[256];
+
+	for (i = 0; i < GP_ARRAY_SIZE(names); i++) {
+		gp_widget *ret;
+		int exp = names[i][1] || names[i][0] < 'a' || names[i][0] > 'e' ? 0 : names[i][0];
+
+		snprintf(buf, sizeof(buf),
+		         "{\"info\": {\"version\": 1, \"license\": \"GPL-2.1-or-later\"},\n"
+		         " \"layout\": {\"on_event\": \"%s\", \"widgets\": [{}]}}", names[i]);
+
+		ret = gp_widget_from_json_str(buf, &callbacks, NULL);
+		if (!ret) {
+			tst_msg("Parser failed!");
+			return TST_FAILED;
+		}
+
+		if (!exp) {
+			if (ret->on_event) {
+				tst_msg("Callback '%s' found", names[i]);
+				return TST_FAILED;
+			}
+			gp_widget_free(ret);
+			continue;
+		}
+
+		if (!ret->on_event || ret->on_event(NULL) != exp) {
+			tst_msg("Wrong callback for '%s'", names[i]);
+			return TST_FAILED;
+		}
+
+		if (ret->priv != &priv) {
+			tst_msg("Wrong priv for '%s'", names[i]);
+			return TST_FAILED;
+		}
+
+		gp_widget_free(ret);
+	}
+
+	return TST_PASSED;
+}
+
+/*
+ * Loads a layout with an on_event callback name and returns the value
+ * returned from the callback, 0 if it was not resolved or -1 on a failure.
+ */
+static int load_callback(const gp_widget_json_callbacks *callbacks, const char *name)
+{
+	gp_widget *layout;
+	char buf[256];
+	int ret = 0;
+
+	snprintf(buf, sizeof(buf),
+	         "{\"info\": {\"version\": 1, \"license\": \"GPL-2.1-or-later\"},\n"
+	         " \"layout\": {\"on_event\": \"%s\", \"widgets\": [{}]}}", name);
+
+	layout = gp_widget_from_json_str(buf, callbacks, NULL);
+	if (!layout) {
+		tst_msg("Parser failed!");
+		return -1;
+	}
+
+	if (layout->on_event)
+		ret = layout->on_event(NULL);
+
+	gp_widget_free(layout);
+
+	return ret;
+}
+
+static int check_callback(const gp_widget_json_callbacks *callbacks,
+                          const char *name, int exp)
+{
+	int ret = load_callback(callbacks, name);
+
+	if (ret == exp)
+		return 0;
+
+	if (!exp)
+		tst_msg("Callback '%s' found", name);
+	else
+		tst_msg("Wrong callback for '%s' got %i", name, ret);
+
+	return 1;
+}
+
+/*
+ * The same callbacks array is reused with a different number of entries, the
+ * count must not be remembered between the loads.
+ */
+static int callbacks_lookup_resize(void)
+{
+	gp_widget_json_addr addrs[6] = {
+		{.id = "a", .on_event = cb_a},
+		{.id = "b", .on_event = cb_b},
+		{.id = "c", .on_event = cb_c},
+		{}
+	};
+	gp_widget_json_callbacks callbacks = {.addrs = addrs};
+	unsigned int i;
+
+	if (check_callback(&callbacks, "a", 'a') ||
+	    check_callback(&callbacks, "c", 'c') ||
+	    check_callback(&callbacks, "e", 0))
+		return TST_FAILED;
+
+	for (i = 0; i < GP_ARRAY_SIZE(addrs); i++)
+		addrs[i] = cb_addrs[i];
+
+	if (check_callback(&callbacks, "a", 'a') ||
+	    check_callback(&callbacks, "e", 'e') ||
+	    check_callback(&callbacks, "f", 0))
+		return TST_FAILED;
+
+	addrs[1] = addrs[5];
+
+	if (check_callback(&callbacks, "a", 'a') ||
+	    check_callback(&callbacks, "b", 0))
+		return TST_FAILED;
+
+	return TST_PASSED;
+}
+
 const struct tst_suite tst_suite = {
 	.suite_name = "widget JSON testsuite",
 	.tests = {
@@ -256,6 +403,12 @@ const struct tst_suite tst_suite = {
 		 .tst_fn = load_json,
 		 .data = &widget_no_shrink},
 
+		{.name = "callbacks lookup",
+		 .tst_fn = callbacks_lookup},
+
+		{.name = "callbacks lookup first last missing",
+		 .tst_fn = callbacks_lookup_resize},
+
 		{.name = NULL},
 	}
 };
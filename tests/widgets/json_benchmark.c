@@ -1,8 +1,9 @@
 // SPDX-License-Identifier: GPL-2.1-or-later
 /*
- * Copyright (C) 2021 Cyril Hrubis <metan@ucw.cz>
+ * Copyright (C) 2021-2026 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <stdio.h>
 #include <string.h>
 #include <widgets/gp_widgets.h>
 #include "tst_test.h"
@@ -19,6 +20,92 @@ static int load_json(const char *path)
 	return TST_PASSED;
 }
 
+#define CALLBACKS 128
+#define BUTTONS 64
+
+static int callback(gp_widget_event *ev)
+{
+	(void) ev;
+	return 0;
+}
+
+static char callback_ids[CALLBACKS][8];
+static gp_widget_json_addr callback_addrs[CALLBACKS + 1];
+
+static gp_widget_json_callbacks callbacks = {
+	.addrs = callback_addrs,
+};
+
+/* Layout with BUTTONS buttons, each of them with an on_event callback */
+static char layout[BUTTONS * 128 + 256];
+static char layout_indented[BUTTONS * 256 + 256];
+
+static void callbacks_layout_init(void)
+{
+	unsigned int i;
+	size_t off = 0, off_ind = 0;
+
+	if (callback_addrs[0].id)
+		return;
+
+	for (i = 0; i < CALLBACKS; i++) {
+		snprintf(callback_ids[i], sizeof(callback_ids[i]), "cb_%03u", i);
+		callback_addrs[i].id = callback_ids[i];
+		callback_addrs[i].on_event = callback;
+	}
+
+	off += snprintf(layout + off, sizeof(layout) - off,
+	                "{\"info\": {\"version\": 1, \"license\": \"GPL-2.1-or-later\"},\n"
+	                "\"layout\": {\n\"rows\": %u,\n\"widgets\": [\n", BUTTONS);
+	off_ind += snprintf(layout_indented + off_ind, sizeof(layout_indented) - off_ind,
+	                    "{\n  \"info\": {\"version\": 1, \"license\": \"GPL-2.1-or-later\"},\n"
+	                    "  \"layout\": {\n    \"rows\": %u,\n    \"widgets\": [\n", BUTTONS);
+
+	for (i = 0; i < BUTTONS; i++) {
+		const char *sep = i + 1 < BUTTONS ? "," : "";
+		unsigned int cb = (i * 37) % CALLBACKS;
+
+		off += snprintf(layout + off, sizeof(layout) - off,
+		                "{\n\"type\": \"button\",\n\"label\": \"Button %u\",\n"
+		                "\"on_event\": \"cb_%03u\"\n}%s\n", i, cb, sep);
+		off_ind += snprintf(layout_indented + off_ind, sizeof(layout_indented) - off_ind,
+		                    "      {\n        \"type\": \"button\",\n"
+		                    "        \"label\": \"Button %u\",\n"
+		                    "        \"on_event\": \"cb_%03u\"\n      }%s\n",
+		                    i, cb, sep);
+	}
+
+	snprintf(layout + off, sizeof(layout) - off, "]\n}\n}\n");
+	snprintf(layout_indented + off_ind, sizeof(layout_indented) - off_ind,
+	         "    ]\n  }\n}\n");
+}
+
+static int load_json_str(const char *str)
+{
+	gp_widget *layout = gp_widget_from_json_str(str, &callbacks, NULL);
+
+	if (!layout)
+		return TST_FAILED;
+
+	gp_widget_free(layout);
+
+	return TST_PASSED;
+}
+
+static int load_callbacks(void)
+{
+	callbacks_layout_init();
+
+	return load_json_str(layout);
+}
+
+static int load_callbacks_indented(void)
+{
+	callbacks_layout_init();
+
+	return load_json_str(layout_indented);
+}
+
 const struct tst_suite tst_suite = {
 	.suite_name = "JSON loader benchmark",
 	.tests = {
@@ -46,6 +133,12 @@ const struct tst_suite tst_suite = {
 		 .flags = TST_TMPDIR | TST_CHECK_MALLOC,
 	         .bench_iter = 50000},
 
+		{.name = "callbacks", .tst_fn = load_callbacks,
+	         .bench_iter = 5000},
+
+		{.name = "callbacks indented", .tst_fn = load_callbacks_indented,
+	         .bench_iter = 5000},
+
 		{.name = NULL},
 	}
 };
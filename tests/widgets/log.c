@@ -0,0 +1,298 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2024 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <widgets/gp_widgets.h>
+#include "tst_test.h"
+#include "common.h"
+
+static int log_new_free(void)
+{
+	gp_widget *log;
+
+	log = gp_widget_log_new(0, 20, 10, 0);
+	if (!log) {
+		tst_msg("Allocation failure");
+		return TST_FAILED;
+	}
+
+	gp_widget_log_append(log, "Log line");
+
+	gp_widget_free(log);
+
+	return TST_PASSED;
+}
+
+/*
+ * Checks that the log contains the last lines_cnt lines from the lines array
+ * in the original order.
+ */
+static int check_lines(gp_widget *log, const char *const lines[], size_t lines_cnt)
+{
+	size_t i, cnt = gp_widget_log_lines(log);
+
+	if (cnt != lines_cnt) {
+		tst_msg("Expected %zu lines got %zu", lines_cnt, cnt);
+		return 1;
+	}
+
+	for (i = 0; i < cnt; i++) {
+		const char *line = gp_widget_log_line(log, i);
+
+		if (strcmp(line, lines[i])) {
+			tst_msg("Line %zu is '%s' expected '%s'", i, line, lines[i]);
+			return 1;
+		}
+	}
+
+	if (gp_widget_log_line(log, cnt)) {
+		tst_msg("Line past the end returned");
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Checks that the log contains a suffix of the lines array that fits into the
+ * buffer.
+ */
+static int check_suffix(gp_widget *log, const char *const lines[], size_t lines_cnt,
+                        size_t max_bytes)
+{
+	size_t i, cnt = gp_widget_log_lines(log), bytes = 0;
+
+	if (!cnt || cnt > lines_cnt) {
+		tst_msg("Wrong number of lines %zu", cnt);
+		return 1;
+	}
+
+	for (i = 0; i < cnt; i++)
+		bytes += strlen(gp_widget_log_line(log, i)) + 1;
+
+	if (bytes > max_bytes) {
+		tst_msg("Lines take %zu bytes, buffer size is %zu", bytes, max_bytes);
+		return 1;
+	}
+
+	return check_lines(log, lines + lines_cnt - cnt, cnt);
+}
+
+static int log_max_lines(void)
+{
+	const char *lines[25];
+	char buf[25][16];
+	gp_widget *log;
+	unsigned int i;
+	int ret = TST_FAILED;
+
+	log = gp_widget_log_new_ex(0, 20, 10, 10, 4096);
+	if (!log) {
+		tst_msg("Allocation failure");
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < 25; i++) {
+		snprintf(buf[i], sizeof(buf[i]), "Line %u", i);
+		lines[i] = buf[i];
+
+		gp_widget_log_append(log, lines[i]);
+	}
+
+	if (check_lines(log, lines + 15, 10))
+		goto exit;
+
+	/* Only the last 10 lines are kept */
+	gp_widget_log_append_lines(log, lines, 13);
+
+	if (check_lines(log, lines + 3, 10))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(log);
+	return ret;
+}
+
+static int log_wrap(void)
+{
+	const char *lines[25];
+	char buf[25][16];
+	gp_widget *log;
+	unsigned int i;
+	int ret = TST_FAILED;
+
+	/* Four 16 byte lines fit into the buffer */
+	log = gp_widget_log_new_ex(0, 20, 10, 100, 64);
+	if (!log) {
+		tst_msg("Allocation failure");
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < 4; i++) {
+		snprintf(buf[i], sizeof(buf[i]), "Line %02u =======", i);
+		lines[i] = buf[i];
+
+		gp_widget_log_append(log, lines[i]);
+	}
+
+	if (check_lines(log, lines, 4))
+		goto exit;
+
+	/* Each new line evicts exactly one line after the wrap-around */
+	for (i = 4; i < 25; i++) {
+		snprintf(buf[i], sizeof(buf[i]), "Line %02u =======", i);
+		lines[i] = buf[i];
+
+		gp_widget_log_append(log, lines[i]);
+
+		if (check_lines(log, lines + i - 3, 4)) {
+			tst_msg("After line %u", i);
+			goto exit;
+		}
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(log);
+	return ret;
+}
+
+static int log_truncate(void)
+{
+	char long_line[512];
+	const char *line;
+	gp_widget *log;
+	size_t len;
+	int ret = TST_FAILED;
+
+	log = gp_widget_log_new_ex(0, 20, 10, 0, 256);
+	if (!log) {
+		tst_msg("Allocation failure");
+		return TST_FAILED;
+	}
+
+	memset(long_line, 'a', sizeof(long_line));
+	long_line[sizeof(long_line)-1] = 0;
+
+	gp_widget_log_append(log, "Short line");
+	gp_widget_log_append(log, long_line);
+
+	if (gp_widget_log_lines(log) != 1) {
+		tst_msg("Expected the long line to evict everything, got %zu lines",
+		        gp_widget_log_lines(log));
+		goto exit;
+	}
+
+	line = gp_widget_log_line(log, 0);
+	len = strlen(line);
+
+	if (len != 255 || strncmp(line, long_line, len)) {
+		tst_msg("Wrong truncated line length %zu", len);
+		goto exit;
+	}
+
+	gp_widget_log_append(log, "Short line");
+
+	if (gp_widget_log_lines(log) != 1 ||
+	    strcmp(gp_widget_log_line(log, 0), "Short line")) {
+		tst_msg("Truncated line not evicted");
+		goto exit;
+	}
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(log);
+	return ret;
+}
+
+static int log_ring(void)
+{
+	const char *lines[100];
+	char buf[100][64];
+	char long_line[512];
+	gp_widget *log;
+	unsigned int i, j;
+	int ret = TST_FAILED;
+
+	log = gp_widget_log_new_ex(0, 20, 10, 0, 256);
+	if (!log) {
+		tst_msg("Allocation failure");
+		return TST_FAILED;
+	}
+
+	log->w = 100;
+	log->h = 100;
+
+	for (i = 0; i < 100; i++) {
+		snprintf(buf[i], sizeof(buf[i]), "Line %u %.*s", i, (int)(i % 40),
+		         "========================================");
+		lines[i] = buf[i];
+	}
+
+	for (i = 0; i < 10; i++) {
+		for (j = 0; j < 100; j++)
+			gp_widget_log_append(log, lines[j]);
+
+		if (check_suffix(log, lines, 100, 256))
+			goto exit;
+
+		dummy_render(log);
+
+		gp_widget_log_append_lines(log, lines, 100);
+
+		if (check_suffix(log, lines, 100, 256))
+			goto exit;
+
+		dummy_render(log);
+	}
+
+	/* Longer than the whole buffer */
+	memset(long_line, 'a', sizeof(long_line));
+	long_line[sizeof(long_line)-1] = 0;
+
+	for (i = 0; i < 10; i++)
+		gp_widget_log_append(log, long_line);
+
+	if (gp_widget_log_lines(log) != 1 ||
+	    strlen(gp_widget_log_line(log, 0)) != 255) {
+		tst_msg("Wrong log content after long lines");
+		goto exit;
+	}
+
+	dummy_render(log);
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(log);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "log testsuite",
+	.tests = {
+		{.name = "log new free",
+		 .tst_fn = log_new_free,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "log max lines",
+		 .tst_fn = log_max_lines,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "log wrap",
+		 .tst_fn = log_wrap,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "log truncate",
+		 .tst_fn = log_truncate,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "log ring",
+		 .tst_fn = log_ring},
+
+		{},
+	}
+};
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <widgets/gp_widgets.h>
+#include "tst_test.h"
+#include "common.h"
+
+static unsigned int update_cnt;
+static unsigned int flip_cnt;
+static unsigned int flip_pending;
+
+static void update_rects(gp_backend *self, const gp_bbox *rects, unsigned int cnt)
+{
+	(void) self;
+	(void) rects;
+	(void) cnt;
+
+	update_cnt++;
+	flip_pending = 1;
+}
+
+static void update_rect(gp_backend *self, gp_coord x0, gp_coord y0,
+                        gp_coord x1, gp_coord y1)
+{
+	gp_bbox rect = gp_bbox_pack(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+
+	update_rects(self, &rect, 1);
+}
+
+static void flip(gp_backend *self)
+{
+	(void) self;
+
+	flip_cnt++;
+	flip_pending = 0;
+}
+
+static gp_backend b = {
+	.name = "test",
+	.update_rect = update_rect,
+	.update_rects = update_rects,
+	.flip = flip,
+};
+
+static int redraw_and_check(gp_widget *layout, unsigned int flips)
+{
+	update_cnt = 0;
+	flip_cnt = 0;
+
+	gp_widgets_redraw(layout);
+
+	if (!update_cnt) {
+		tst_msg("Widget redraw not updated");
+		return 1;
+	}
+
+	if (flip_cnt != flips) {
+		tst_msg("Wrong number of flips %u expected %u", flip_cnt, flips);
+		return 1;
+	}
+
+	if (flips && flip_pending) {
+		tst_msg("Update not presented by flip");
+		return 1;
+	}
+
+	return 0;
+}
+
+static int render_flip(int flip_presents)
+{
+	gp_pixmap *pixmap;
+	gp_widget *label;
+	int ret = TST_FAILED;
+
+	pixmap = gp_pixmap_alloc(200, 100, GP_PIXEL_RGB888);
+	if (!pixmap) {
+		tst_msg("Pixmap allocation failed");
+		return TST_UNTESTED;
+	}
+
+	b.pixmap = pixmap;
+	b.flip_presents = flip_presents;
+	gp_widgets_backend_set(&b);
+
+	label = gp_widget_label_new("Hello", 0, 0);
+	if (!label) {
+		tst_msg("Label allocation failed");
+		gp_pixmap_free(pixmap);
+		return TST_UNTESTED;
+	}
+
+	gp_widget_redraw(label);
+
+	if (redraw_and_check(label, !!flip_presents))
+		goto exit;
+
+	/* Incremental redraw after a widget change */
+	gp_widget_label_set(label, "World");
+
+	if (redraw_and_check(label, !!flip_presents))
+		goto exit;
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(label);
+	gp_pixmap_free(pixmap);
+	return ret;
+}
+
+static int render_update(void)
+{
+	return render_flip(0);
+}
+
+static int render_swapchain(void)
+{
+	return render_flip(1);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "render testsuite",
+	.tests = {
+		{.name = "render update",
+		 .tst_fn = render_update},
+
+		{.name = "render swapchain flip",
+		 .tst_fn = render_swapchain},
+
+		{.name = NULL},
+	}
+};
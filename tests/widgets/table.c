@@ -0,0 +1,311 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2026 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <widgets/gp_widgets.h>
+#include "tst_test.h"
+#include "common.h"
+
+#define VIRT_ROWS 10000000
+
+/* Seek counters */
+static unsigned int row_max_cnt;
+static unsigned int reset_cnt;
+static unsigned int seek_cnt;
+static unsigned int rows_visited;
+static unsigned int seek_max;
+
+static int seek_row(gp_widget *self, int op, unsigned int pos)
+{
+	gp_widget_table_priv *priv = gp_widget_table_priv_get(self);
+
+	switch (op) {
+	case GP_TABLE_ROW_RESET:
+		priv->row_idx = 0;
+		reset_cnt++;
+	break;
+	case GP_TABLE_ROW_ADVANCE:
+		priv->row_idx += pos;
+		if (pos > 1) {
+			seek_cnt++;
+			seek_max = GP_MAX(seek_max, pos);
+		} else {
+			rows_visited++;
+		}
+	break;
+	case GP_TABLE_ROW_MAX:
+		row_max_cnt++;
+		return -1;
+	}
+
+	return priv->row_idx < VIRT_ROWS;
+}
+
+static int get_cell(gp_widget *self, gp_widget_table_cell *cell, unsigned int col_idx)
+{
+	(void) self;
+	(void) col_idx;
+
+	cell->text = "cell";
+
+	return 1;
+}
+
+/*
+ * Sorted data, an incremental bottom-up merge sort, one merge pass per step.
+ */
+#define SORT_ROWS 1000
+
+static int sort_data[SORT_ROWS];
+static int sort_tmp[SORT_ROWS];
+static unsigned int sort_width;
+static unsigned int sort_step_cnt;
+static unsigned int sort_restart_cnt;
+
+static int sort_cmp(int a, int b, int desc)
+{
+	return desc ? a > b : a < b;
+}
+
+static unsigned int sort_step(gp_widget *self, int desc, unsigned int col_idx, int restart)
+{
+	unsigned int i, l, r, m, e, k, passes = 0, done = 0;
+
+	(void) self;
+	(void) col_idx;
+
+	sort_step_cnt++;
+
+	if (restart) {
+		sort_restart_cnt++;
+		sort_width = 1;
+	}
+
+	for (i = 0; i < SORT_ROWS; i += 2 * sort_width) {
+		l = i;
+		m = GP_MIN(i + sort_width, (unsigned int)SORT_ROWS);
+		e = GP_MIN(i + 2 * sort_width, (unsigned int)SORT_ROWS);
+		r = m;
+
+		for (k = l; k < e; k++) {
+			if (l < m && (r >= e || !sort_cmp(sort_data[r], sort_data[l], desc)))
+				sort_tmp[k] = sort_data[l++];
+			else
+				sort_tmp[k] = sort_data[r++];
+		}
+	}
+
+	memcpy(sort_data, sort_tmp, sizeof(sort_data));
+
+	sort_width *= 2;
+
+	for (i = 1; i < SORT_ROWS; i *= 2) {
+		passes++;
+		if (i < sort_width)
+			done++;
+	}
+
+	if (sort_width >= SORT_ROWS)
+		return 100;
+
+	return 100 * done / passes;
+}
+
+static gp_widget_table_col_ops col_ops = {
+	.seek_row = seek_row,
+	.get_cell = get_cell,
+	.sort_step = sort_step,
+	.col_map = {
+		{.id = "col", .idx = 0, .sortable = 1},
+		{}
+	}
+};
+
+static gp_widget_table_header header[] = {
+	{.col_desc = &col_ops.col_map[0], .label = "Col"},
+};
+
+/* Tasks started by the table end up in this queue */
+static gp_task_queue tasks;
+
+static gp_backend task_backend = {
+	.name = "Task backend",
+	.tasks = &tasks,
+};
+
+static unsigned int run_tasks(void)
+{
+	unsigned int cnt = 0;
+
+	while (gp_task_queue_process(&tasks))
+		cnt++;
+
+	return cnt;
+}
+
+static int table_virtual(void)
+{
+	gp_widget *table;
+	int ret = TST_PASSED;
+
+	table = gp_widget_table_new(1, 10, &col_ops, header);
+	if (!table) {
+		tst_msg("Allocation failure");
+		return TST_FAILED;
+	}
+
+	gp_widget_table_rows_set(table, VIRT_ROWS);
+	gp_widget_table_off_set(table, VIRT_ROWS - 5);
+
+	table->w = 100;
+	table->h = 100;
+
+	row_max_cnt = 0;
+	reset_cnt = 0;
+	seek_cnt = 0;
+	rows_visited = 0;
+	seek_max = 0;
+
+	dummy_render(table);
+
+	if (row_max_cnt) {
+		tst_msg("Table size queried in virtual mode");
+		ret = TST_FAILED;
+	}
+
+	/* Each seek to the first displayed row is done in a single call */
+	if (!seek_cnt || seek_cnt > reset_cnt) {
+		tst_msg("Expected at most one seek per reset, got %u seeks %u resets",
+		        seek_cnt, reset_cnt);
+		ret = TST_FAILED;
+	}
+
+	if (seek_max != VIRT_ROWS - 5) {
+		tst_msg("Seeked to %u expected %u", seek_max, VIRT_ROWS - 5);
+		ret = TST_FAILED;
+	}
+
+	/* Only the displayed rows are walked, at most one per pixel */
+	if (rows_visited > table->h) {
+		tst_msg("Visited %u rows row by row", rows_visited);
+		ret = TST_FAILED;
+	}
+
+	tst_msg("Seeks %u resets %u rows visited %u",
+	        seek_cnt, reset_cnt, rows_visited);
+
+	send_keypress(table, GP_KEY_END);
+
+	if (gp_widget_table_sel_get(table) + 1 < VIRT_ROWS) {
+		tst_msg("Wrong row selected %u", gp_widget_table_sel_get(table));
+		ret = TST_FAILED;
+	}
+
+	gp_widget_free(table);
+
+	return ret;
+}
+
+static int check_sorted(int desc)
+{
+	unsigned int i;
+
+	for (i = 1; i < SORT_ROWS; i++) {
+		if (sort_cmp(sort_data[i], sort_data[i-1], desc)) {
+			tst_msg("Rows %u %u not sorted %s %i %i", i - 1, i,
+			        desc ? "descending" : "ascending",
+			        sort_data[i-1], sort_data[i]);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int table_sort_task(void)
+{
+	gp_widget *table;
+	unsigned int i, cnt;
+	int ret = TST_FAILED;
+
+	gp_widgets_backend_set(&task_backend);
+
+	srandom(42);
+
+	for (i = 0; i < SORT_ROWS; i++)
+		sort_data[i] = random() % 10000;
+
+	sort_step_cnt = 0;
+	sort_restart_cnt = 0;
+
+	table = gp_widget_table_new(1, 10, &col_ops, header);
+	if (!table) {
+		tst_msg("Allocation failure");
+		return TST_FAILED;
+	}
+
+	gp_widget_table_rows_set(table, SORT_ROWS);
+
+	gp_widget_table_sort_by(table, 1, 0);
+
+	if (!gp_widget_table_sorting(table)) {
+		tst_msg("Incremental sort not running");
+		goto exit;
+	}
+
+	if (sort_step_cnt) {
+		tst_msg("Sort step called synchronously");
+		goto exit;
+	}
+
+	/* Run one step, then restart the sort in the other direction */
+	if (!gp_task_queue_process(&tasks)) {
+		tst_msg("No sort task queued");
+		goto exit;
+	}
+
+	gp_widget_table_sort_by(table, 0, 0);
+
+	cnt = run_tasks();
+
+	if (gp_widget_table_sorting(table)) {
+		tst_msg("Sort still running after the queue was drained");
+		goto exit;
+	}
+
+	if (sort_restart_cnt != 2) {
+		tst_msg("Expected two sort restarts got %u", sort_restart_cnt);
+		goto exit;
+	}
+
+	if (sort_step_cnt != cnt + 1) {
+		tst_msg("Sort steps %u tasks run %u", sort_step_cnt, cnt + 1);
+		goto exit;
+	}
+
+	if (check_sorted(0))
+		goto exit;
+
+	tst_msg("Sorted in %u steps", sort_step_cnt);
+
+	ret = TST_PASSED;
+exit:
+	gp_widget_free(table);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "table testsuite",
+	.tests = {
+		{.name = "table virtual",
+		 .tst_fn = table_virtual},
+
+		{.name = "table sort task",
+		 .tst_fn = table_sort_task},
+
+		{},
+	}
+};